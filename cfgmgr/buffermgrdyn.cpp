@@ -1,3 +1,4 @@
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <string.h>
@@ -49,11 +50,13 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         m_stateBufferMaximumTable(stateDb, STATE_BUFFER_MAXIMUM_VALUE_TABLE),
         m_stateBufferPoolTable(stateDb, STATE_BUFFER_POOL_TABLE_NAME),
         m_stateBufferProfileTable(stateDb, STATE_BUFFER_PROFILE_TABLE_NAME),
+        m_stateBufferCalculationLatencyTable(stateDb, STATE_BUFFER_CALCULATION_LATENCY_TABLE),
         m_applPortTable(applDb, APP_PORT_TABLE_NAME),
         m_portInitDone(false),
         m_bufferPoolReady(false),
         m_bufferObjectsPending(true),
         m_bufferCompletelyInitialized(false),
+        m_poolSizeRecalculationPending(false),
         m_bufferProfileApplDbWritten(false),
         m_mmuSizeNumber(0)
 {
@@ -599,6 +602,17 @@ bool BufferMgrDynamic::needRefreshPortDueToEffectiveSpeed(port_info_t &portInfo,
     return effectiveSpeedChanged;
 }
 
+// Record the latency of a vendor-specific lua calculation in STATE_DB
+// so the buffer reconfiguration window can be broken down in the field.
+void BufferMgrDynamic::recordLuaComputationLatency(const string &computation, unsigned long long duration_us)
+{
+    vector<FieldValueTuple> fvVector;
+
+    fvVector.emplace_back("last_duration_us", to_string(duration_us));
+    fvVector.emplace_back("count", to_string(++m_luaComputationCount[computation]));
+    m_stateBufferCalculationLatencyTable.set(computation, fvVector);
+}
+
 // Meta flows which are called by main flows
 void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
 {
@@ -615,7 +629,10 @@ void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
 
     try
     {
+        auto start = chrono::steady_clock::now();
         auto ret = swss::runRedisScript(*m_applDb, m_headroomSha, keys, argv);
+        auto duration = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+        recordLuaComputationLatency("headroom", duration.count());
 
         if (ret.empty())
         {
@@ -692,7 +709,10 @@ void BufferMgrDynamic::recalculateSharedBufferPool()
             }
         }
 
+        auto start = chrono::steady_clock::now();
         auto ret = runRedisScript(*m_applDb, m_bufferpoolSha, keys, argv);
+        auto duration = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+        recordLuaComputationLatency("buffer_pool", duration.count());
 
         // The format of the result:
         // a list of lines containing key, value pairs with colon as separator
@@ -868,6 +888,26 @@ void BufferMgrDynamic::checkSharedBufferPoolSize(bool force_update_during_initia
     }
 }
 
+// Mark the shared buffer pool sizes as to-be-recalculated.
+// The handlers call it for every change that can affect the pool sizes but the
+// recalculation, which runs the vendor lua plugin against all ports, is
+// deferred to the end of the batch of updates by applySharedBufferPoolSizeIfPending.
+// This way a cable length or speed update touching tens of ports triggers one
+// recalculation instead of one per port.
+void BufferMgrDynamic::markSharedBufferPoolSizePending()
+{
+    m_poolSizeRecalculationPending = true;
+}
+
+void BufferMgrDynamic::applySharedBufferPoolSizeIfPending()
+{
+    if (!m_poolSizeRecalculationPending)
+        return;
+
+    m_poolSizeRecalculationPending = false;
+    checkSharedBufferPoolSize();
+}
+
 // For buffer pool, only size can be updated on-the-fly
 void BufferMgrDynamic::updateBufferPoolToDb(const string &name, const buffer_pool_t &pool)
 {
@@ -1571,7 +1611,7 @@ task_process_status BufferMgrDynamic::refreshPgsForPort(const string &port, cons
 
     if (isHeadroomUpdated)
     {
-        checkSharedBufferPoolSize();
+        markSharedBufferPoolSizePending();
     }
     else
     {
@@ -1705,7 +1745,7 @@ void BufferMgrDynamic::refreshSharedHeadroomPool(bool enable_state_updated_by_ra
 
     if (m_portInitDone)
     {
-        checkSharedBufferPoolSize();
+        markSharedBufferPoolSizePending();
     }
 }
 
@@ -1775,7 +1815,7 @@ task_process_status BufferMgrDynamic::doRemovePgTask(const string &pg_key, const
     SWSS_LOG_NOTICE("Remove BUFFER_PG %s (profile %s, %s)", pg_key.c_str(), bufferPg.running_profile_name.c_str(), bufferPg.configured_profile_name.c_str());
 
     // Recalculate pool size
-    checkSharedBufferPoolSize();
+    markSharedBufferPoolSizePending();
 
     if (portInfo.state != PORT_ADMIN_DOWN)
     {
@@ -1828,7 +1868,7 @@ task_process_status BufferMgrDynamic::doUpdateBufferProfileForDynamicTh(buffer_p
         }
     }
 
-    checkSharedBufferPoolSize();
+    markSharedBufferPoolSizePending();
 
     return task_process_status::task_success;
 }
@@ -1864,7 +1904,7 @@ task_process_status BufferMgrDynamic::doUpdateBufferProfileForSize(buffer_profil
     }
 
     if (update_pool_size)
-        checkSharedBufferPoolSize();
+        markSharedBufferPoolSizePending();
 
     return task_process_status::task_success;
 }
@@ -2454,7 +2494,7 @@ task_process_status BufferMgrDynamic::handlePortTable(KeyOpFieldsValuesTuple &tu
                 {
                     reclaimReservedBufferForPort(port, m_portPgLookup, BUFFER_PG);
                     reclaimReservedBufferForPort(port, m_portQueueLookup, BUFFER_QUEUE);
-                    checkSharedBufferPoolSize();
+                    markSharedBufferPoolSizePending();
                 }
                 else
                 {
@@ -3607,6 +3647,9 @@ void BufferMgrDynamic::doTask(Consumer &consumer)
                 break;
         }
     }
+
+    // Recalculate the shared buffer pool sizes once for the whole batch
+    applySharedBufferPoolSizeIfPending();
 }
 
 /*
@@ -3790,9 +3833,12 @@ void BufferMgrDynamic::cleanUpItemsForReclaimingBuffer(const string &port)
 
 void BufferMgrDynamic::doTask(SelectableTimer &timer)
 {
+    m_poolSizeRecalculationPending = false;
     checkSharedBufferPoolSize(true);
     if (!m_bufferCompletelyInitialized)
     {
         handlePendingBufferObjects();
+        // handlePendingBufferObjects can mark the pool sizes pending again
+        applySharedBufferPoolSizeIfPending();
     }
 }
@@ -14,6 +14,9 @@ namespace swss {
 #define INGRESS_LOSSLESS_PG_POOL_NAME "ingress_lossless_pool"
 #define DEFAULT_MTU_STR             "9100"
 
+// STATE_DB table exposing the latency of the lua buffer calculations
+#define STATE_BUFFER_CALCULATION_LATENCY_TABLE "BUFFER_CALCULATION_LATENCY_TABLE"
+
 #define BUFFERMGR_TIMER_PERIOD 10
 
 typedef enum {
@@ -177,6 +180,9 @@ private:
     bool m_bufferPoolReady;
     bool m_bufferObjectsPending;
     bool m_bufferCompletelyInitialized;
+    // Set by the table handlers when a change affects the shared buffer pool
+    // sizes; the recalculation itself runs once per batch of updates
+    bool m_poolSizeRecalculationPending;
 
     std::string m_configuredSharedHeadroomPoolSize;
 
@@ -246,6 +252,10 @@ private:
     Table m_cfgDefaultLosslessBufferParam;
     Table m_cfgDeviceMetaDataTable;
     Table m_stateBufferMaximumTable;
+    Table m_stateBufferCalculationLatencyTable;
+    // Number of lua computations per calculation type since start, exposed
+    // together with the latency
+    std::map<std::string, unsigned long> m_luaComputationCount;
 
     Table m_applPortTable;
 
@@ -298,6 +308,9 @@ private:
     bool needRefreshPortDueToEffectiveSpeed(port_info_t &portInfo, std::string &portName);
     void calculateHeadroomSize(buffer_profile_t &headroom);
     void checkSharedBufferPoolSize(bool force_update_during_initialization);
+    void markSharedBufferPoolSizePending();
+    void applySharedBufferPoolSizeIfPending();
+    void recordLuaComputationLatency(const std::string &computation, unsigned long long duration_us);
     void recalculateSharedBufferPool();
     task_process_status allocateProfile(const std::string &speed, const std::string &cable, const std::string &mtu, const std::string &threshold, const std::string &gearbox_model, long lane_count, std::string &profile_name);
     void releaseProfile(const std::string &profile_name);
@@ -123,7 +123,7 @@ void CoppMgr::setFeatureTrapIdsStatus(string feature, bool enable)
     */
     if (checkTrapGroupPending(trap_group) && !prev_group_state)
     {
-        m_appCoppTable.del(trap_group);
+        delCoppEntry(trap_group);
         delCoppGroupStateOk(trap_group);
         return;
     }
@@ -149,7 +149,7 @@ void CoppMgr::setFeatureTrapIdsStatus(string feature, bool enable)
     }
     if (!fvs.empty())
     {
-        m_appCoppTable.set(trap_group, fvs);
+        setCoppEntry(trap_group, fvs);
         setCoppGroupStateOk(trap_group);
     }
 }
@@ -286,6 +286,7 @@ bool CoppMgr::isDupEntry(const std::string &key, std::vector<FieldValueTuple> &f
             {
                 // overwrite -> delete preserved entry from copp table and set a new entry instead
                 m_appCoppTable.del(key);
+                m_appCoppContents.erase(key);
                 return false;
             }
         }
@@ -293,12 +294,80 @@ bool CoppMgr::isDupEntry(const std::string &key, std::vector<FieldValueTuple> &f
     return true;
 }
 
+void CoppMgr::setCoppEntry(const string &key, const vector<FieldValueTuple> &fvs)
+{
+    auto &pending = m_pendingCoppEntries[key];
+    for (const auto &fv : fvs)
+    {
+        pending.fvs[fvField(fv)] = fvValue(fv);
+    }
+}
+
+void CoppMgr::delCoppEntry(const string &key)
+{
+    auto &pending = m_pendingCoppEntries[key];
+    pending.del = true;
+    pending.fvs.clear();
+}
+
+/* Applies the desired-state changes accumulated during one drain. Repeated
+ * rewrites of the same key collapse into its final contents, writes that
+ * would not change the applied entry are suppressed and the remainder is
+ * flushed to APPL_DB as one pipelined transaction.
+ */
+void CoppMgr::flushCoppEntries()
+{
+    for (auto &entry : m_pendingCoppEntries)
+    {
+        const string &key = entry.first;
+        auto &pending = entry.second;
+        auto cached = m_appCoppContents.find(key);
+
+        if (pending.del)
+        {
+            m_appCoppTable.del(key);
+            if (cached != m_appCoppContents.end())
+            {
+                m_appCoppContents.erase(cached);
+                cached = m_appCoppContents.end();
+            }
+        }
+
+        if (pending.fvs.empty())
+        {
+            continue;
+        }
+
+        bool changed = (cached == m_appCoppContents.end());
+        auto &applied = m_appCoppContents[key];
+        vector<FieldValueTuple> fvs;
+        for (const auto &fv : pending.fvs)
+        {
+            auto f = applied.find(fv.first);
+            if (f == applied.end() || f->second != fv.second)
+            {
+                applied[fv.first] = fv.second;
+                changed = true;
+            }
+            fvs.emplace_back(fv.first, fv.second);
+        }
+
+        if (changed)
+        {
+            m_appCoppTable.set(key, fvs);
+        }
+    }
+    m_pendingCoppEntries.clear();
+    m_appDbPipeline.flush();
+}
+
 CoppMgr::CoppMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<string> &tableNames, const string copp_init_file) :
         Orch(cfgDb, tableNames),
         m_cfgCoppTrapTable(cfgDb, CFG_COPP_TRAP_TABLE_NAME),
         m_cfgCoppGroupTable(cfgDb, CFG_COPP_GROUP_TABLE_NAME),
         m_cfgFeatureTable(cfgDb, CFG_FEATURE_TABLE_NAME),
-        m_appCoppTable(appDb, APP_COPP_TABLE_NAME),
+        m_appDbPipeline(appDb),
+        m_appCoppTable(&m_appDbPipeline, APP_COPP_TABLE_NAME, true),
         m_stateCoppTrapTable(stateDb, STATE_COPP_TRAP_TABLE_NAME),
         m_stateCoppGroupTable(stateDb, STATE_COPP_GROUP_TABLE_NAME),
         m_coppTable(appDb, APP_COPP_TABLE_NAME),
@@ -323,6 +392,18 @@ CoppMgr::CoppMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
     m_cfgFeatureTable.getKeys(feature_keys);
     m_coppTable.getKeys(preserved_copp_keys);
 
+    /* Seed the applied-contents cache with the preserved entries so that
+     * later writes can be diffed against them
+     */
+    for (auto i: preserved_copp_keys)
+    {
+        std::vector<FieldValueTuple> preserved_fvs;
+        m_coppTable.get(i, preserved_fvs);
+        for (auto fv: preserved_fvs)
+        {
+            m_appCoppContents[i][fvField(fv)] = fvValue(fv);
+        }
+    }
 
     for (auto i: feature_keys)
     {
@@ -400,6 +481,11 @@ CoppMgr::CoppMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
                 continue;
             }
             m_appCoppTable.set(i.first, trap_group_fvs);
+            m_appCoppContents[i.first].clear();
+            for (auto fv: trap_group_fvs)
+            {
+                m_appCoppContents[i.first][fvField(fv)] = fvValue(fv);
+            }
         }
 
         setCoppGroupStateOk(i.first);
@@ -417,8 +503,11 @@ CoppMgr::CoppMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
         if (copp_it == supported_copp_keys.end())
         {
             m_appCoppTable.del(it);
+            m_appCoppContents.erase(it);
         }
     }
+
+    m_appDbPipeline.flush();
 }
 
 void CoppMgr::setCoppGroupStateOk(string alias)
@@ -508,7 +597,7 @@ void CoppMgr::removeTrap(string key)
     fvs.push_back(fv);
     if (!checkTrapGroupPending(m_coppTrapConfMap[key].trap_group))
     {
-        m_appCoppTable.set(m_coppTrapConfMap[key].trap_group, fvs);
+        setCoppEntry(m_coppTrapConfMap[key].trap_group, fvs);
         setCoppGroupStateOk(m_coppTrapConfMap[key].trap_group);
     }
 }
@@ -523,7 +612,7 @@ void CoppMgr::addTrap(string trap_ids, string trap_group)
     fvs.push_back(fv1);
     if (!checkTrapGroupPending(trap_group))
     {
-        m_appCoppTable.set(trap_group, fvs);
+        setCoppEntry(trap_group, fvs);
         setCoppGroupStateOk(trap_group);
     }
 }
@@ -730,7 +819,7 @@ void CoppMgr::doCoppTrapTask(Consumer &consumer)
                 fvs.push_back(fv2);
                 if (!checkTrapGroupPending(m_coppTrapConfMap[key].trap_group))
                 {
-                    m_appCoppTable.set(m_coppTrapConfMap[key].trap_group, fvs);
+                    setCoppEntry(m_coppTrapConfMap[key].trap_group, fvs);
                     setCoppGroupStateOk(m_coppTrapConfMap[key].trap_group);
                 }
             }
@@ -755,7 +844,7 @@ void CoppMgr::doCoppTrapTask(Consumer &consumer)
                 fvs.push_back(fv);
                 if (!checkTrapGroupPending(m_coppTrapConfMap[key].trap_group))
                 {
-                    m_appCoppTable.set(m_coppTrapConfMap[key].trap_group, fvs);
+                    setCoppEntry(m_coppTrapConfMap[key].trap_group, fvs);
                     setCoppGroupStateOk(m_coppTrapConfMap[key].trap_group);
                 }
             }
@@ -871,7 +960,7 @@ void CoppMgr::doCoppGroupTask(Consumer &consumer)
             {
                 if (!modified_fvs.empty())
                 {
-                    m_appCoppTable.set(key, modified_fvs);
+                    setCoppEntry(key, modified_fvs);
                     setCoppGroupStateOk(key);
                 }
             }
@@ -888,7 +977,7 @@ void CoppMgr::doCoppGroupTask(Consumer &consumer)
             SWSS_LOG_NOTICE("%s: DEL",key.c_str());
             if (!checkTrapGroupPending(key))
             {
-                m_appCoppTable.del(key);
+                delCoppEntry(key);
                 delCoppGroupStateOk(key);
             }
 
@@ -911,7 +1000,7 @@ void CoppMgr::doCoppGroupTask(Consumer &consumer)
                         FieldValueTuple fv(COPP_TRAP_ID_LIST_FIELD, trap_ids);
                         fvs.push_back(fv);
                     }
-                    m_appCoppTable.set(key, fvs);
+                    setCoppEntry(key, fvs);
                     setCoppGroupStateOk(key);
                 }
             }
@@ -982,4 +1071,6 @@ void CoppMgr::doTask(Consumer &consumer)
     {
         doFeatureTask(consumer);
     }
+
+    flushCoppEntries();
 }
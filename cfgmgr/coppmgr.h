@@ -3,6 +3,7 @@
 #include "dbconnector.h"
 #include "orch.h"
 #include "producerstatetable.h"
+#include "redispipeline.h"
 #include <unistd.h>
 
 #include <map>
@@ -68,6 +69,7 @@ public:
 private:
     Table                  m_cfgCoppTrapTable, m_cfgCoppGroupTable, m_cfgFeatureTable, m_coppTable;
     Table                  m_stateCoppTrapTable, m_stateCoppGroupTable;
+    RedisPipeline          m_appDbPipeline;
     ProducerStateTable     m_appCoppTable;
     CoppTrapConfMap        m_coppTrapConfMap;
     CoppTrapIdTrapGroupMap m_coppTrapIdTrapGroupMap;
@@ -77,6 +79,19 @@ private:
     CoppCfg                m_featuresCfgTable;
     std::string            m_coppCfgfile;
 
+    /* Last applied APPL_DB CoPP entry contents, used to suppress no-op writes */
+    std::map<std::string, std::map<std::string, std::string>> m_appCoppContents;
+
+    /* Desired-state changes accumulated during one drain, applied as a single
+     * pipelined transaction by flushCoppEntries()
+     */
+    struct PendingCoppEntry
+    {
+        bool del = false;
+        std::map<std::string, std::string> fvs;
+    };
+    std::map<std::string, PendingCoppEntry> m_pendingCoppEntries;
+
 
     void doTask(Consumer &consumer);
     void doCoppGroupTask(Consumer &consumer);
@@ -106,6 +121,10 @@ private:
     void removeTrap(std::string key);
     void addTrap(std::string trap_ids, std::string trap_group);
 
+    void setCoppEntry(const std::string &key, const std::vector<FieldValueTuple> &fvs);
+    void delCoppEntry(const std::string &key);
+    void flushCoppEntries();
+
 
 };
 
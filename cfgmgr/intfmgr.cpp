@@ -1,4 +1,9 @@
+#include <errno.h>
 #include <string.h>
+#include <net/if.h>
+#include <linux/rtnetlink.h>
+#include <netlink/attr.h>
+
 #include "logger.h"
 #include "dbconnector.h"
 #include "producerstatetable.h"
@@ -146,23 +151,68 @@ void IntfMgr::setIntfMac(const string &alias, const string &mac_str)
     }
 }
 
-void IntfMgr::setIntfVrf(const string &alias, const string &vrfName)
+/*
+ * Builds an RTM_NEWLINK request updating attributes of an existing netdev.
+ * 'flags'/'change' toggle ifi_flags bits, a non-zero 'mtu' sets IFLA_MTU and
+ * a non-negative 'master' enslaves the netdev to that ifindex (0 detaches).
+ * Returns NULL when the netdev is gone or an allocation fails.
+ */
+struct nl_msg *IntfMgr::buildLinkSetMsg(const string &alias, unsigned int flags,
+                                        unsigned int change, unsigned int mtu, int master)
 {
-    stringstream cmd;
-    string res;
+    unsigned int ifindex = if_nametoindex(alias.c_str());
+    if (ifindex == 0)
+    {
+        SWSS_LOG_INFO("Failed to get ifindex for '%s'", alias.c_str());
+        return NULL;
+    }
 
-    if (!vrfName.empty())
+    struct nl_msg *msg = nlmsg_alloc_simple(RTM_NEWLINK, 0);
+    if (!msg)
     {
-        cmd << IP_CMD << " link set " << shellquote(alias) << " master " << shellquote(vrfName);
+        SWSS_LOG_ERROR("Netlink message alloc failed for '%s'", alias.c_str());
+        return NULL;
     }
-    else
+
+    struct ifinfomsg ifi = {};
+    ifi.ifi_family = AF_UNSPEC;
+    ifi.ifi_index = (int)ifindex;
+    ifi.ifi_flags = flags;
+    ifi.ifi_change = change;
+
+    if (nlmsg_append(msg, &ifi, sizeof(ifi), NLMSG_ALIGNTO) < 0 ||
+        (mtu != 0 && nla_put_u32(msg, IFLA_MTU, mtu) < 0) ||
+        (master >= 0 && nla_put_u32(msg, IFLA_MASTER, (uint32_t)master) < 0))
     {
-        cmd << IP_CMD << " link set " << shellquote(alias) << " nomaster";
+        SWSS_LOG_ERROR("Netlink attribute alloc failed for '%s'", alias.c_str());
+        nlmsg_free(msg);
+        return NULL;
     }
-    int ret = swss::exec(cmd.str(), res);
-    if (ret)
+
+    return msg;
+}
+
+void IntfMgr::setIntfVrf(const string &alias, const string &vrfName)
+{
+    int master = 0;
+
+    if (!vrfName.empty())
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
+        unsigned int vrf_ifindex = if_nametoindex(vrfName.c_str());
+        if (vrf_ifindex == 0)
+        {
+            SWSS_LOG_ERROR("Failed to get ifindex for vrf '%s'", vrfName.c_str());
+            return;
+        }
+        master = (int)vrf_ifindex;
+    }
+
+    struct nl_msg *msg = buildLinkSetMsg(alias, 0, 0, 0, master);
+    int err = msg ? m_rtnlBatch.sendRequest(msg) : ENODEV;
+    if (err != 0)
+    {
+        SWSS_LOG_ERROR("Failed to set vrf '%s' on '%s', error '%s'",
+                       vrfName.c_str(), alias.c_str(), strerror(err));
     }
 }
 
@@ -430,9 +480,6 @@ void IntfMgr::updateSubIntfMtu(const string &alias, const string &mtu)
 
 std::string IntfMgr::setHostSubIntfMtu(const string &alias, const string &mtu, const string &parent_mtu)
 {
-    stringstream cmd;
-    string res;
-
     string subifMtu = mtu;
     subIntf subIf(alias);
 
@@ -444,19 +491,18 @@ std::string IntfMgr::setHostSubIntfMtu(const string &alias, const string &mtu, c
         subifMtu = parent_mtu;
     }
     SWSS_LOG_INFO("subintf %s active mtu: %s", alias.c_str(), subifMtu.c_str());
-    cmd << IP_CMD " link set " << shellquote(alias) << " mtu " << shellquote(subifMtu);
-    std::string cmd_str = cmd.str();
-    int ret = swss::exec(cmd_str, res);
 
-    if (ret && !isIntfStateOk(alias))
+    struct nl_msg *msg = buildLinkSetMsg(alias, 0, 0, (unsigned int)stoul(subifMtu), -1);
+    int err = msg ? m_rtnlBatch.sendRequest(msg) : ENODEV;
+    if (err != 0 && !isIntfStateOk(alias))
     {
         // Can happen when a SET notification on the PORT_TABLE in the State DB
         // followed by a new DEL notification that send by portmgrd
-        SWSS_LOG_WARN("Setting mtu to %s netdev failed with cmd:%s, rc:%d, error:%s", alias.c_str(), cmd_str.c_str(), ret, res.c_str());
+        SWSS_LOG_WARN("Setting mtu to %s netdev failed, error:%s", alias.c_str(), strerror(err));
     }
-    else if (ret)
+    else if (err != 0)
     {
-        throw runtime_error(cmd_str + " : " + res);
+        throw runtime_error("RTM_NEWLINK " + alias + " mtu " + subifMtu + " : " + strerror(err));
     }
     return subifMtu;
 }
@@ -488,23 +534,20 @@ void IntfMgr::updateSubIntfAdminStatus(const string &alias, const string &admin)
 
 bool IntfMgr::setIntfAdminStatus(const string &alias, const string &admin_status)
 {
-    stringstream cmd;
-    string res, cmd_str;
-
     SWSS_LOG_INFO("intf %s admin_status: %s", alias.c_str(), admin_status.c_str());
-    cmd << IP_CMD " link set " << shellquote(alias) << " " << shellquote(admin_status);
-    cmd_str = cmd.str();
-    int ret = swss::exec(cmd_str, res);
-    if (ret && !isIntfStateOk(alias))
+
+    struct nl_msg *msg = buildLinkSetMsg(alias, (admin_status == "up") ? IFF_UP : 0, IFF_UP, 0, -1);
+    int err = msg ? m_rtnlBatch.sendRequest(msg) : ENODEV;
+    if (err != 0 && !isIntfStateOk(alias))
     {
         // Can happen when a DEL notification is sent by portmgrd immediately followed by a new SET notification
-        SWSS_LOG_WARN("Setting admin_status to %s netdev failed with cmd:%s, rc:%d, error:%s",
-                      alias.c_str(), cmd_str.c_str(), ret, res.c_str());
+        SWSS_LOG_WARN("Setting admin_status to %s netdev failed, error:%s",
+                      alias.c_str(), strerror(err));
         return false;
     }
-    else if (ret)
+    else if (err != 0)
     {
-        throw runtime_error(cmd_str + " : " + res);
+        throw runtime_error("RTM_NEWLINK " + alias + " admin " + admin_status + " : " + strerror(err));
     }
     return true;
 }
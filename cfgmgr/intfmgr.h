@@ -4,6 +4,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "rtnlbatch.h"
 
 #include <map>
 #include <string>
@@ -40,6 +41,10 @@ private:
     std::map<std::string, std::set<std::string>> m_intfLLAddresses;
     std::string mySwitchType;
 
+    RtnlBatch m_rtnlBatch;
+
+    struct nl_msg *buildLinkSetMsg(const std::string &alias, unsigned int flags,
+                                   unsigned int change, unsigned int mtu, int master);
     void setIntfIp(const std::string &alias, const std::string &opCmd, const IpPrefix &ipPrefix);
     void setIntfVrf(const std::string &alias, const std::string &vrfName);
     void setIntfMac(const std::string &alias, const std::string &macAddr);
@@ -178,6 +178,49 @@ bool NatMgr::isGlobalIpMatching(const string &prefix, const string &global_ip)
     return false;
 }
 
+/* To add a reference on the given global ip in the address index */
+void NatMgr::addAddrIndex(natAddrIndex_map_t &addrIndex, const string &global_ip)
+{
+    struct in_addr addr;
+
+    if (inet_pton(AF_INET, global_ip.c_str(), &addr) != 1)
+    {
+        return;
+    }
+
+    addrIndex[ntohl(addr.s_addr)]++;
+}
+
+/* To drop a reference on the given global ip from the address index */
+void NatMgr::removeAddrIndex(natAddrIndex_map_t &addrIndex, const string &global_ip)
+{
+    struct in_addr addr;
+
+    if (inet_pton(AF_INET, global_ip.c_str(), &addr) != 1)
+    {
+        return;
+    }
+
+    auto it = addrIndex.find(ntohl(addr.s_addr));
+    if (it == addrIndex.end())
+    {
+        return;
+    }
+
+    if (--(it->second) == 0)
+    {
+        addrIndex.erase(it);
+    }
+}
+
+/* To check any indexed address falls within the given range */
+bool NatMgr::isAddrIndexInRange(const natAddrIndex_map_t &addrIndex, uint32_t range_low, uint32_t range_high)
+{
+    auto it = addrIndex.lower_bound(range_low);
+
+    return ((it != addrIndex.end()) and (it->first <= range_high));
+}
+
 /* To check the given pool_name is mapped to any binding or not */
 bool NatMgr::isPoolMappedtoBinding(const string &pool_name, string &binding_name)
 {
@@ -369,55 +412,40 @@ void NatMgr::flushAllNatEntries(void)
     }
 }
 
-/* To Update a conntrack entry for the Dynamic Single NAT entry in the kernel */
-void NatMgr::updateDynamicSingleNatConnTrackTimeout(string key, int timeout)
+/* To frame the conntrack command to update the Dynamic Single NAT entry timeout in the kernel */
+string NatMgr::getDynamicSingleNatConnTrackTimeoutCmd(const string &key, int timeout)
 {
-    std::string res;
     std::string cmds = std::string("") + CONNTRACK_CMD;
     IpAddress   ip_address = IpAddress(key);
 
     cmds += (" -U -s " + ip_address.to_string() + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
-    int ret = swss::exec(cmds, res);
 
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-    }
-    else
-    {
-        SWSS_LOG_INFO("Updated the active NAT conntrack entry with src-ip %s, timeout %u",
-                      ip_address.to_string().c_str(), timeout);
-    }
+    SWSS_LOG_INFO("Updating the active NAT conntrack entry with src-ip %s, timeout %u",
+                  ip_address.to_string().c_str(), timeout);
+
+    return cmds;
 }
 
-/* To Update a conntrack entry for the Dynamic Single NAPT entry in the kernel */
-void NatMgr::updateDynamicSingleNaptConnTrackTimeout(string key, int timeout)
+/* To frame the conntrack command to update the Dynamic Single NAPT entry timeout in the kernel */
+string NatMgr::getDynamicSingleNaptConnTrackTimeoutCmd(const string &key, int timeout)
 {
-    std::string     res;
     vector<string>  keys = tokenize(key, ':');
     IpAddress       ip_address = IpAddress(keys[1]);
     int             l4_port = stoi(keys[2]);
     string          prototype = ((keys[0] == string("TCP")) ? "tcp" : "udp");
     std::string     cmds = std::string("") + CONNTRACK_CMD;
-    
+
     cmds += (" -U -s " + ip_address.to_string() + " -p " + prototype + " --orig-port-src " + to_string(l4_port) + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
-    int ret = swss::exec(cmds, res);
 
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-    }
-    else
-    {
-        SWSS_LOG_INFO("Updated active NAPT conntrack entry with protocol %s, src-ip %s, src-port %d, timeout %u",
-                      prototype.c_str(), ip_address.to_string().c_str(), l4_port, timeout);
-    }
+    SWSS_LOG_INFO("Updating active NAPT conntrack entry with protocol %s, src-ip %s, src-port %d, timeout %u",
+                  prototype.c_str(), ip_address.to_string().c_str(), l4_port, timeout);
+
+    return cmds;
 }
 
-/* To Update a conntrack entry for the Dynamic Twice NAT entry in the kernel */
-void NatMgr::updateDynamicTwiceNatConnTrackTimeout(string key, int timeout)
+/* To frame the conntrack command to update the Dynamic Twice NAT entry timeout in the kernel */
+string NatMgr::getDynamicTwiceNatConnTrackTimeoutCmd(const string &key, int timeout)
 {
-    std::string     res;
     std::string     cmd = std::string("") + CONNTRACK_CMD;
     vector<string>  keys = tokenize(key, ':');
     IpAddress       src_ip = IpAddress(keys[1]);
@@ -425,16 +453,15 @@ void NatMgr::updateDynamicTwiceNatConnTrackTimeout(string key, int timeout)
 
     cmd += (" -U -s " + src_ip.to_string() + " -d " + dst_ip.to_string() + " -t " + std::to_string(timeout) + REDIRECT_TO_DEV_NULL);
 
-    swss::exec(cmd, res);
-
-    SWSS_LOG_INFO("Updated active Twice NAT conntrack entry with src-ip %s, dst-ip %s, timeout %u",
+    SWSS_LOG_INFO("Updating active Twice NAT conntrack entry with src-ip %s, dst-ip %s, timeout %u",
                   src_ip.to_string().c_str(), dst_ip.to_string().c_str(), timeout);
+
+    return cmd;
 }
 
-/* To Update a conntrack entry for the Dynamic Twice NAPT entry in the kernel */
-void NatMgr::updateDynamicTwiceNaptConnTrackTimeout(string key, int timeout)
+/* To frame the conntrack command to update the Dynamic Twice NAPT entry timeout in the kernel */
+string NatMgr::getDynamicTwiceNaptConnTrackTimeoutCmd(const string &key, int timeout)
 {
-    std::string     res;
     std::string     cmd = std::string("") + CONNTRACK_CMD;
     vector<string>  keys = tokenize(key, ':');
     IpAddress       src_ip      = IpAddress(keys[1]);
@@ -447,10 +474,26 @@ void NatMgr::updateDynamicTwiceNaptConnTrackTimeout(string key, int timeout)
             " -d " + dst_ip.to_string() + " --orig-port-dst " + std::to_string(dst_l4_port) +
             " -t " + std::to_string(timeout) + REDIRECT_TO_DEV_NULL);
 
-    swss::exec(cmd, res);
-
-    SWSS_LOG_INFO("Updated active Twice NAPT conntrack entry with protocol %s, src-ip %s, src-port %d, dst-ip %s, dst-port %d, timeout %u",
+    SWSS_LOG_INFO("Updating active Twice NAPT conntrack entry with protocol %s, src-ip %s, src-port %d, dst-ip %s, dst-port %d, timeout %u",
                   prototype.c_str(), src_ip.to_string().c_str(), src_l4_port, dst_ip.to_string().c_str(), dst_l4_port, timeout);
+
+    return cmd;
+}
+
+/* To run a batch of framed conntrack update commands with a single shell invocation */
+void NatMgr::execConnTrackCmdBatch(const std::string &cmds, int count)
+{
+    std::string res;
+    int ret = swss::exec(cmds, res);
+
+    if (ret)
+    {
+        SWSS_LOG_ERROR("Batch of %d conntrack update commands '%s' failed with rc %d", count, cmds.c_str(), ret);
+    }
+    else
+    {
+        SWSS_LOG_INFO("Updated the timeout of %d conntrack entries", count);
+    }
 }
 
 /* To Add a dummy conntrack entry for the Static Single NAT entry in the kernel */
@@ -2674,6 +2717,8 @@ void NatMgr::removeStaticSingleNatEntry(const string &key)
     if (m_staticNatEntry[key].interface != interface)
     {
         SWSS_LOG_INFO("Interface is not matching for %s, skipping NAT entry deletion", key.c_str());
+        removeAddrIndex(m_staticNatAddrIndex, (m_staticNatEntry[key].nat_type == SNAT_NAT_TYPE) ?
+                        m_staticNatEntry[key].local_ip : key);
         m_staticNatEntry.erase(key);
         return;
     }
@@ -5820,12 +5865,11 @@ void NatMgr::doStaticNatTask(Consumer &consumer)
         string key = kfvKey(t), op = kfvOp(t);
         vector<string> keys = tokenize(key, config_db_key_delimiter);
         const vector<FieldValueTuple>& data = kfvFieldsValues(t);
-        string global_ip, ipAddress;
         string local_ip = EMPTY_STRING, interface = EMPTY_STRING;
         string nat_type = EMPTY_STRING, twice_nat_id = EMPTY_STRING;
         bool ipFound = false, natTypeFound = false, twiceNatFound = false, nonValueFound = false, isOverlap = false;
         int ip_num = 0, nat_type_num = 0, twice_nat_num = 0, twice_nat_value;
-        uint32_t ipv4_addr, global_addr, local_addr, pool_addr_low, pool_addr_high;
+        uint32_t ipv4_addr, global_addr, local_addr;
 
         /* Example : Config_Db
          * STATIC_NAT|65.55.42.1
@@ -5982,26 +6026,15 @@ void NatMgr::doStaticNatTask(Consumer &consumer)
             }
 
             /* check the global address is overlapping with any NAPT entry */
-            global_ip = key;
+            ipv4_addr = global_addr;
             if (nat_type == SNAT_NAT_TYPE)
             {
-                global_ip = local_ip;
+                ipv4_addr = local_addr;
             }
 
-            for (auto it = m_staticNaptEntry.begin(); it != m_staticNaptEntry.end(); it++)
+            if (m_staticNaptAddrIndex.find(ipv4_addr) != m_staticNaptAddrIndex.end())
             {
-                vector<string> napt_keys = tokenize((*it).first, config_db_key_delimiter);
-                ipAddress = napt_keys[0];
-                if ((*it).second.nat_type == SNAT_NAT_TYPE)
-                {
-                    ipAddress = (*it).second.local_ip;
-                }
-
-                if (ipAddress == global_ip)
-                {
-                    isOverlap = true;
-                    break;
-                }
+                isOverlap = true;
             }
 
             if (isOverlap)
@@ -6012,37 +6045,9 @@ void NatMgr::doStaticNatTask(Consumer &consumer)
             }
 
             /* check the global address is overlapping with any Dynamic Pool entry */
-            ipv4_addr = global_addr;
-            if (nat_type == SNAT_NAT_TYPE)
+            for (auto it = m_natPoolAddrRange.begin(); it != m_natPoolAddrRange.end(); it++)
             {
-                ipv4_addr = local_addr;
-            }
-
-            for (auto it = m_natPoolInfo.begin(); it != m_natPoolInfo.end(); it++)
-            {            
-                vector<string> nat_ip = tokenize((*it).second.ip_range, range_specifier);
-
-                /* Check the pool is valid */
-                if ((nat_ip.empty()) or (nat_ip.size() > 2))
-                {
-                    continue;
-                }
-                else if (nat_ip.size() == 2)
-                {
-                    inet_pton(AF_INET, nat_ip[1].c_str(), &pool_addr_high);
-                    pool_addr_high = ntohl(pool_addr_high);
-
-                    inet_pton(AF_INET, nat_ip[0].c_str(), &pool_addr_low);
-                    pool_addr_low = ntohl(pool_addr_low);
-                }
-                else if (nat_ip.size() == 1)
-                {
-                    inet_pton(AF_INET, nat_ip[0].c_str(), &pool_addr_low);
-                    pool_addr_high = ntohl(pool_addr_low);
-                    pool_addr_low = ntohl(pool_addr_low);
-                }
-
-                if ((ipv4_addr >= pool_addr_low) and (ipv4_addr <= pool_addr_high))
+                if ((ipv4_addr >= (*it).second.first) and (ipv4_addr <= (*it).second.second))
                 {
                     isOverlap = true;
                     break;
@@ -6079,6 +6084,13 @@ void NatMgr::doStaticNatTask(Consumer &consumer)
                         SWSS_LOG_INFO("Deleting the Static NAT entry for %s", key.c_str());
                         removeStaticNatEntry(key);
                     }
+
+                    /* Drop the old effective global address before the cache is overwritten */
+                    if (m_staticNatEntry.find(key) != m_staticNatEntry.end())
+                    {
+                        removeAddrIndex(m_staticNatAddrIndex, (m_staticNatEntry[key].nat_type == SNAT_NAT_TYPE) ?
+                                        m_staticNatEntry[key].local_ip : key);
+                    }
                 }
             }
              
@@ -6096,6 +6108,7 @@ void NatMgr::doStaticNatTask(Consumer &consumer)
             m_staticNatEntry[key].twice_nat_id = twice_nat_id;
             m_staticNatEntry[key].twice_nat_added = false;
             m_staticNatEntry[key].binding_key = EMPTY_STRING;
+            addAddrIndex(m_staticNatAddrIndex, (m_staticNatEntry[key].nat_type == SNAT_NAT_TYPE) ? local_ip : key);
             SWSS_LOG_INFO("Static NAT %s is added to cache", key.c_str());
 
             /* Add the new Static NAT entry */
@@ -6117,7 +6130,12 @@ void NatMgr::doStaticNatTask(Consumer &consumer)
 
                 /* Cleaned the cache */
                 SWSS_LOG_INFO("Static NAT %s is removed from the cache", key.c_str());
-                m_staticNatEntry.erase(key);
+                if (m_staticNatEntry.find(key) != m_staticNatEntry.end())
+                {
+                    removeAddrIndex(m_staticNatAddrIndex, (m_staticNatEntry[key].nat_type == SNAT_NAT_TYPE) ?
+                                    m_staticNatEntry[key].local_ip : key);
+                    m_staticNatEntry.erase(key);
+                }
             }
             else
             {
@@ -6146,12 +6164,11 @@ void NatMgr::doStaticNaptTask(Consumer &consumer)
         string key = kfvKey(t), op = kfvOp(t);
         vector<string> keys = tokenize(key, config_db_key_delimiter);
         const vector<FieldValueTuple>& data = kfvFieldsValues(t);
-        string global_ip, ipAddress;
         string local_ip = EMPTY_STRING, local_port = EMPTY_STRING, interface = EMPTY_STRING;
         string nat_type = EMPTY_STRING, twice_nat_id = EMPTY_STRING;
         bool ipFound = false, portFound = false, natTypeFound = false, twiceNatFound = false, nonValueFound = false, isOverlap = false;
         int ip_num = 0, port_num = 0, portValue = 0, nat_type_num = 0, twice_nat_num = 0, twice_nat_value;
-        uint32_t ipv4_addr;
+        uint32_t ipv4_addr, global_addr;
   
         /* Example : Config_Db
          * STATIC_NAPT|65.55.42.1|TCP|1024
@@ -6176,6 +6193,7 @@ void NatMgr::doStaticNaptTask(Consumer &consumer)
         }
 
         ipv4_addr = ntohl(ipv4_addr);
+        global_addr = ipv4_addr;
         /* Ensure the local ip is not Zero, Broadcast, Loopback, Multicast and Reserved address */
         if (IS_ZERO_ADDR(ipv4_addr) or IS_BROADCAST_ADDR(ipv4_addr) or IS_LOOPBACK_ADDR(ipv4_addr) or
             IS_MULTICAST_ADDR(ipv4_addr) or IS_RESERVED_ADDR(ipv4_addr))
@@ -6370,25 +6388,15 @@ void NatMgr::doStaticNaptTask(Consumer &consumer)
             }
 
             /* check the global address is overlapping with any NAT entry */
-            global_ip = keys[0];
             if (nat_type == SNAT_NAT_TYPE)
             {
-                global_ip = local_ip;
+                /* ipv4_addr holds the validated local ip at this point */
+                global_addr = ipv4_addr;
             }
 
-            for (auto it = m_staticNatEntry.begin(); it != m_staticNatEntry.end(); it++)
+            if (m_staticNatAddrIndex.find(global_addr) != m_staticNatAddrIndex.end())
             {
-                ipAddress = (*it).first;
-                if ((*it).second.nat_type == SNAT_NAT_TYPE)
-                {
-                    ipAddress = (*it).second.local_ip;
-                }
-
-                if (ipAddress == global_ip)
-                {
-                    isOverlap = true;
-                    break;
-                }
+                isOverlap = true;
             }
 
             if (isOverlap)
@@ -6421,6 +6429,10 @@ void NatMgr::doStaticNaptTask(Consumer &consumer)
                         SWSS_LOG_INFO("Deleting the Static NAPT entry for %s", key.c_str());
                         removeStaticNaptEntry(key);
                     }
+
+                    /* Drop the old effective global address before the cache is overwritten */
+                    removeAddrIndex(m_staticNaptAddrIndex, (m_staticNaptEntry[key].nat_type == SNAT_NAT_TYPE) ?
+                                    m_staticNaptEntry[key].local_ip : keys[0]);
                 }
             }
 
@@ -6439,6 +6451,7 @@ void NatMgr::doStaticNaptTask(Consumer &consumer)
             m_staticNaptEntry[key].twice_nat_id = twice_nat_id;
             m_staticNaptEntry[key].twice_nat_added = false;
             m_staticNaptEntry[key].binding_key = EMPTY_STRING;
+            addAddrIndex(m_staticNaptAddrIndex, (m_staticNaptEntry[key].nat_type == SNAT_NAT_TYPE) ? local_ip : keys[0]);
             SWSS_LOG_INFO("Static NAPT %s is added to cache", key.c_str());
 
             /* Add the new Static NAT entry */
@@ -6460,6 +6473,8 @@ void NatMgr::doStaticNaptTask(Consumer &consumer)
 
                 /* Cleaned the cache */
                 SWSS_LOG_INFO("Static NAPT %s is removed from the cache", key.c_str());
+                removeAddrIndex(m_staticNaptAddrIndex, (m_staticNaptEntry[key].nat_type == SNAT_NAT_TYPE) ?
+                                m_staticNaptEntry[key].local_ip : keys[0]);
                 m_staticNaptEntry.erase(key);
             }
             else
@@ -6489,10 +6504,10 @@ void NatMgr::doNatPoolTask(Consumer &consumer)
         string key = kfvKey(t), op = kfvOp(t);
         vector<string> keys = tokenize(key, config_db_key_delimiter);
         const vector<FieldValueTuple>& data = kfvFieldsValues(t);
-        string nat_ip = EMPTY_STRING, nat_port = EMPTY_STRING, binding_name = EMPTY_STRING, static_ip;
+        string nat_ip = EMPTY_STRING, nat_port = EMPTY_STRING, binding_name = EMPTY_STRING;
         bool ipFound = false, portFound = false, nonValueFound = false, isOverlap = false;
         int ip_num = 0, port_num = 0, portValue_low, portValue_high;
-        uint32_t ipv4_addr_low, ipv4_addr_high, static_address;
+        uint32_t ipv4_addr_low, ipv4_addr_high;
 
         /* Example : Config_Db
          * NAT_POOL|PoolName
@@ -6750,22 +6765,9 @@ void NatMgr::doNatPoolTask(Consumer &consumer)
             }
 
             /* check the pool ip address is overlapping with any NAT entry */
-            for (auto it = m_staticNatEntry.begin(); it != m_staticNatEntry.end(); it++)
+            if (isAddrIndexInRange(m_staticNatAddrIndex, ipv4_addr_low, ipv4_addr_high))
             {
-                static_ip = (*it).first;
-                if ((*it).second.nat_type == SNAT_NAT_TYPE)
-                {
-                    static_ip = (*it).second.local_ip;
-                }
-
-                inet_pton(AF_INET, static_ip.c_str(), &static_address);
-                static_address = ntohl(static_address);
-
-                if ((static_address >= ipv4_addr_low) and (static_address <= ipv4_addr_high))
-                {
-                    isOverlap = true;
-                    break;
-                }
+                isOverlap = true;
             }
 
             if (isOverlap)
@@ -6811,6 +6813,7 @@ void NatMgr::doNatPoolTask(Consumer &consumer)
             {
                 m_natPoolInfo[key].port_range = EMPTY_STRING;
             }
+            m_natPoolAddrRange[key] = make_pair(ipv4_addr_low, ipv4_addr_high);
 
             /* Check this pool name on any nat binding */
             if (isPoolMappedtoBinding(key, binding_name))
@@ -6847,6 +6850,7 @@ void NatMgr::doNatPoolTask(Consumer &consumer)
 
                 /* Clean the pool Info */
                 m_natPoolInfo.erase(key);
+                m_natPoolAddrRange.erase(key);
                 SWSS_LOG_INFO("Pool %s is cleaned from the cache", key.c_str());
             }
             else
@@ -8203,49 +8207,87 @@ void NatMgr::timeoutNotifications(string op, string data)
 {
     SWSS_LOG_ENTER();
 
-    if (op == "SET-SINGLE-NAT")
-    {
-        SWSS_LOG_INFO("Received set single nat timeout notification");
-        updateDynamicSingleNatConnTrackTimeout(data, NAT_TIMEOUT_MAX);
-    }
-    else if (op == "AGEOUT-SINGLE-NAT")
-    {
-        SWSS_LOG_INFO("Received reset single nat timeout notification");
-        updateDynamicSingleNatConnTrackTimeout(data, NAT_TIMEOUT_LOW);
-    }
-    else if (op == "SET-SINGLE-NAPT")
-    {
-        SWSS_LOG_INFO("Received set single napt timeout notification");
-        updateDynamicSingleNaptConnTrackTimeout(data, NAT_TIMEOUT_MAX);
-    }
-    else if (op == "AGEOUT-SINGLE-NAPT")
-    {
-        SWSS_LOG_INFO("Received reset single napt timeout notification");
-        updateDynamicSingleNaptConnTrackTimeout(data, NAT_TIMEOUT_LOW);
-    }
-    else if (op == "SET-TWICE-NAT")
-    {
-        SWSS_LOG_INFO("Received set twice nat timeout notification");
-        updateDynamicTwiceNatConnTrackTimeout(data, NAT_TIMEOUT_MAX);
-    }
-    else if (op == "AGEOUT-TWICE-NAT")
-    {
-        SWSS_LOG_INFO("Received reset twice nat timeout notification");
-        updateDynamicTwiceNatConnTrackTimeout(data, NAT_TIMEOUT_LOW);
-    }
-    else if (op == "SET-TWICE-NAPT")
-    {
-        SWSS_LOG_INFO("Received set twice napt timeout notification");
-        updateDynamicTwiceNaptConnTrackTimeout(data, NAT_TIMEOUT_MAX);
-    }
-    else if (op == "AGEOUT-TWICE-NAPT")
+    timeoutNotifications(std::deque<KeyOpFieldsValuesTuple>{{data, op, std::vector<FieldValueTuple>{}}});
+}
+
+/* To parse a drained batch of timeout notifications. The conntrack update
+ * commands framed for the batch are run with one shell invocation per
+ * CONNTRACK_BATCH_CMDS_MAX commands instead of one invocation per entry. */
+void NatMgr::timeoutNotifications(const std::deque<KeyOpFieldsValuesTuple> &entries)
+{
+    SWSS_LOG_ENTER();
+
+    std::string cmds;
+    int batched = 0;
+
+    for (auto &entry : entries)
     {
-        SWSS_LOG_INFO("Received reset twice napt timeout notification");
-        updateDynamicTwiceNaptConnTrackTimeout(data, NAT_TIMEOUT_LOW);
+        const string &op = kfvOp(entry);
+        const string &data = kfvKey(entry);
+        std::string cmd;
+
+        if (op == "SET-SINGLE-NAT")
+        {
+            SWSS_LOG_INFO("Received set single nat timeout notification");
+            cmd = getDynamicSingleNatConnTrackTimeoutCmd(data, NAT_TIMEOUT_MAX);
+        }
+        else if (op == "AGEOUT-SINGLE-NAT")
+        {
+            SWSS_LOG_INFO("Received reset single nat timeout notification");
+            cmd = getDynamicSingleNatConnTrackTimeoutCmd(data, NAT_TIMEOUT_LOW);
+        }
+        else if (op == "SET-SINGLE-NAPT")
+        {
+            SWSS_LOG_INFO("Received set single napt timeout notification");
+            cmd = getDynamicSingleNaptConnTrackTimeoutCmd(data, NAT_TIMEOUT_MAX);
+        }
+        else if (op == "AGEOUT-SINGLE-NAPT")
+        {
+            SWSS_LOG_INFO("Received reset single napt timeout notification");
+            cmd = getDynamicSingleNaptConnTrackTimeoutCmd(data, NAT_TIMEOUT_LOW);
+        }
+        else if (op == "SET-TWICE-NAT")
+        {
+            SWSS_LOG_INFO("Received set twice nat timeout notification");
+            cmd = getDynamicTwiceNatConnTrackTimeoutCmd(data, NAT_TIMEOUT_MAX);
+        }
+        else if (op == "AGEOUT-TWICE-NAT")
+        {
+            SWSS_LOG_INFO("Received reset twice nat timeout notification");
+            cmd = getDynamicTwiceNatConnTrackTimeoutCmd(data, NAT_TIMEOUT_LOW);
+        }
+        else if (op == "SET-TWICE-NAPT")
+        {
+            SWSS_LOG_INFO("Received set twice napt timeout notification");
+            cmd = getDynamicTwiceNaptConnTrackTimeoutCmd(data, NAT_TIMEOUT_MAX);
+        }
+        else if (op == "AGEOUT-TWICE-NAPT")
+        {
+            SWSS_LOG_INFO("Received reset twice napt timeout notification");
+            cmd = getDynamicTwiceNaptConnTrackTimeoutCmd(data, NAT_TIMEOUT_LOW);
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Received unknown timeout nat request");
+            continue;
+        }
+
+        if (!cmds.empty())
+        {
+            cmds += "; ";
+        }
+        cmds += cmd;
+        if (++batched >= CONNTRACK_BATCH_CMDS_MAX)
+        {
+            execConnTrackCmdBatch(cmds, batched);
+            cmds.clear();
+            batched = 0;
+        }
     }
-    else
+
+    if (batched)
     {
-        SWSS_LOG_ERROR("Received unknown timeout nat request");
+        execConnTrackCmdBatch(cmds, batched);
     }
 }
 
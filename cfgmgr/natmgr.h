@@ -24,9 +24,11 @@
 #include "notificationproducer.h"
 #include "timer.h"
 #include <unistd.h>
+#include <deque>
 #include <set>
 #include <map>
 #include <string>
+#include <utility>
 
 namespace swss {
 
@@ -125,6 +127,7 @@ namespace swss {
 #define NAT_ENTRY_REFRESH_PERIOD   86400    // 1 day
 #define REDIRECT_TO_DEV_NULL       " &> /dev/null"
 #define FLUSH                      " -F"
+#define CONNTRACK_BATCH_CMDS_MAX   64
 
 const char ip_address_delimiter = '/';
 
@@ -234,6 +237,19 @@ typedef std::map<std::string, std::string> natZoneInterface_map_t;
  */
 typedef std::map<std::string, int> natDnatPool_map_t;
 
+/* To index the effective global-side addresses of the configured static
+ * NAT or NAPT entries, so conflict checks need not iterate the entries,
+ * Key is "Ipv4_address" in host byte order
+ * Value is "ref_count" (Eg. 1)
+ */
+typedef std::map<uint32_t, uint32_t> natAddrIndex_map_t;
+
+/* To store NAT Pool address ranges parsed once at configuration time,
+ * Key is "Pool_name"
+ * Value is "(range_low, range_high)" in host byte order
+ */
+typedef std::map<std::string, std::pair<uint32_t, uint32_t>> natPoolAddrRange_map_t;
+
 /* Define NatMgr Class inherited from Orch Class */
 class NatMgr : public Orch
 {
@@ -247,6 +263,7 @@ public:
     void cleanupMangleIpTables();
     bool isPortInitDone(DBConnector *app_db);
     void timeoutNotifications(std::string op, std::string data);
+    void timeoutNotifications(const std::deque<swss::KeyOpFieldsValuesTuple> &entries);
     void flushNotifications(std::string op, std::string data);
     void removeStaticNatIptables(const std::string port = NONE_STRING);
     void removeStaticNaptIptables(const std::string port = NONE_STRING);
@@ -266,9 +283,12 @@ private:
     std::string  natAdminMode;
 
     natPool_map_t            m_natPoolInfo;
+    natPoolAddrRange_map_t   m_natPoolAddrRange;
     natBinding_map_t         m_natBindingInfo;
     staticNatEntry_map_t     m_staticNatEntry;
     staticNaptEntry_map_t    m_staticNaptEntry;
+    natAddrIndex_map_t       m_staticNatAddrIndex;
+    natAddrIndex_map_t       m_staticNaptAddrIndex;
     natIpInterface_map_t     m_natIpInterfaceInfo;
     natZoneInterface_map_t   m_natZoneInterfaceInfo;
     natAclTable_map_t        m_natAclTableInfo;
@@ -308,10 +328,11 @@ private:
     void deleteConntrackStaticTwiceNatEntry(const std::string &snatKey, const std::string &dnatKey);
     void deleteConntrackStaticTwiceNaptEntry(const std::string &snatKey, const std::string &dnatKey);
     void deleteConntrackDynamicEntries(const std::string &ip_range);
-    void updateDynamicSingleNatConnTrackTimeout(std::string key, int timeout);
-    void updateDynamicSingleNaptConnTrackTimeout(std::string key, int timeout);
-    void updateDynamicTwiceNatConnTrackTimeout(std::string key, int timeout);
-    void updateDynamicTwiceNaptConnTrackTimeout(std::string key, int timeout);
+    std::string getDynamicSingleNatConnTrackTimeoutCmd(const std::string &key, int timeout);
+    std::string getDynamicSingleNaptConnTrackTimeoutCmd(const std::string &key, int timeout);
+    std::string getDynamicTwiceNatConnTrackTimeoutCmd(const std::string &key, int timeout);
+    std::string getDynamicTwiceNaptConnTrackTimeoutCmd(const std::string &key, int timeout);
+    void execConnTrackCmdBatch(const std::string &cmds, int count);
     void addStaticNatEntry(const std::string &key);
     void addStaticNaptEntry(const std::string &key);
     void addStaticSingleNatEntry(const std::string &key);
@@ -364,6 +385,9 @@ private:
     bool isMatchesWithStaticNat(const std::string &global_ip, std::string &local_ip);
     bool isMatchesWithStaticNapt(const std::string &global_ip, std::string &local_ip);
     bool isGlobalIpMatching(const std::string &intf_keys, const std::string &global_ip);
+    void addAddrIndex(natAddrIndex_map_t &addrIndex, const std::string &global_ip);
+    void removeAddrIndex(natAddrIndex_map_t &addrIndex, const std::string &global_ip);
+    bool isAddrIndexInRange(const natAddrIndex_map_t &addrIndex, uint32_t range_low, uint32_t range_high);
     bool getIpEnabledIntf(const std::string &global_ip, std::string &interface);
     void setNaptPoolIpTable(const std::string &opCmd, const std::string &nat_ip, const std::string &nat_port);
     bool setFullConeDnatIptablesRule(const std::string &opCmd);
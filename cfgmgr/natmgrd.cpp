@@ -15,6 +15,7 @@
  */
 
 #include <unistd.h>
+#include <deque>
 #include <vector>
 #include <sstream>
 #include <fstream>
@@ -167,12 +168,11 @@ int main(int argc, char **argv)
 
             if (sel == timeoutNotificationsConsumer)
             {
-               std::string op;
-               std::string data;
-               std::vector<swss::FieldValueTuple> values;
+               std::deque<swss::KeyOpFieldsValuesTuple> entries;
 
-               timeoutNotificationsConsumer->pop(op, data, values);
-               natmgr->timeoutNotifications(op, data);
+               /* Drain all pending timeout notifications in one batch */
+               timeoutNotificationsConsumer->pops(entries);
+               natmgr->timeoutNotifications(entries);
                continue;
             }
 
@@ -1,6 +1,7 @@
 #include <arpa/inet.h>
 #include <netinet/in.h>
 #include <net/if.h>
+#include <string.h>
 #include <unistd.h>
 #include <netlink/cache.h>
 
@@ -15,32 +16,6 @@
 
 using namespace swss;
 
-static bool send_message(struct nl_sock *sk, struct nl_msg *msg)
-{
-    bool rc = false;
-    int err = 0;
-
-    do
-    {
-        if (!sk)
-        {
-            SWSS_LOG_ERROR("Netlink socket null pointer");
-            break;
-        }
-
-        if ((err = nl_send_auto(sk, msg)) < 0)
-        {
-            SWSS_LOG_ERROR("Netlink send message failed, error '%s'", nl_geterror(err));
-            break;
-        }
-
-        rc = true;
-    } while(0);
-
-    nlmsg_free(msg);
-    return rc;
-}
-
 NbrMgr::NbrMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<string> &tableNames) :
         Orch(cfgDb, tableNames),
         m_statePortTable(stateDb, STATE_PORT_TABLE_NAME),
@@ -49,18 +24,6 @@ NbrMgr::NbrMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, con
         m_stateIntfTable(stateDb, STATE_INTERFACE_TABLE_NAME),
         m_stateNeighRestoreTable(stateDb, STATE_NEIGH_RESTORE_TABLE_NAME)
 {
-    int err = 0;
-
-    m_nl_sock = nl_socket_alloc();
-    if (!m_nl_sock)
-    {
-        SWSS_LOG_ERROR("Netlink socket alloc failed");
-    }
-    else if ((err = nl_connect(m_nl_sock, NETLINK_ROUTE)) < 0)
-    {
-        SWSS_LOG_ERROR("Netlink socket connect failed, error '%s'", nl_geterror(err));
-    }
-
     auto consumerStateTable = new swss::ConsumerStateTable(appDb, APP_NEIGH_RESOLVE_TABLE_NAME,
                               TableConsumable::DEFAULT_POP_BATCH_SIZE, default_orch_pri);
     auto consumer = new Consumer(consumerStateTable, this, APP_NEIGH_RESOLVE_TABLE_NAME);
@@ -110,7 +73,7 @@ bool NbrMgr::isNeighRestoreDone()
     return false;
 }
 
-bool NbrMgr::setNeighbor(const string& alias, const IpAddress& ip, const MacAddress& mac)
+struct nl_msg *NbrMgr::buildNeighborMsg(const string& alias, const IpAddress& ip, const MacAddress& mac)
 {
     SWSS_LOG_ENTER();
 
@@ -118,7 +81,7 @@ bool NbrMgr::setNeighbor(const string& alias, const IpAddress& ip, const MacAddr
     if (!msg)
     {
         SWSS_LOG_ERROR("Netlink message alloc failed for '%s'", ip.to_string().c_str());
-        return false;
+        return NULL;
     }
 
     auto flags = (NLM_F_REQUEST | NLM_F_ACK | NLM_F_CREATE | NLM_F_REPLACE);
@@ -128,7 +91,7 @@ bool NbrMgr::setNeighbor(const string& alias, const IpAddress& ip, const MacAddr
     {
         SWSS_LOG_ERROR("Netlink message header alloc failed for '%s'", ip.to_string().c_str());
         nlmsg_free(msg);
-        return false;
+        return NULL;
     }
 
     struct ndmsg *nd_msg = static_cast<struct ndmsg *>
@@ -137,7 +100,7 @@ bool NbrMgr::setNeighbor(const string& alias, const IpAddress& ip, const MacAddr
     {
         SWSS_LOG_ERROR("Netlink ndmsg reserve failed for '%s'", ip.to_string().c_str());
         nlmsg_free(msg);
-        return false;
+        return NULL;
     }
 
     memset(nd_msg, 0, sizeof(struct ndmsg));
@@ -152,7 +115,7 @@ bool NbrMgr::setNeighbor(const string& alias, const IpAddress& ip, const MacAddr
     {
         SWSS_LOG_ERROR("Netlink rtattr (IP) failed for '%s'", ip.to_string().c_str());
         nlmsg_free(msg);
-        return false;
+        return NULL;
     }
 
     rta->rta_type = NDA_DST;
@@ -197,7 +160,7 @@ bool NbrMgr::setNeighbor(const string& alias, const IpAddress& ip, const MacAddr
         {
             SWSS_LOG_ERROR("Netlink rtattr (MAC) failed for '%s'", ip.to_string().c_str());
             nlmsg_free(msg);
-            return false;
+            return NULL;
         }
 
         rta->rta_type = NDA_LLADDR;
@@ -205,7 +168,28 @@ bool NbrMgr::setNeighbor(const string& alias, const IpAddress& ip, const MacAddr
         memcpy(RTA_DATA(rta), mac_addr, mac_len);
     }
 
-    return send_message(m_nl_sock, msg);
+    return msg;
+}
+
+bool NbrMgr::setNeighbor(const string& alias, const IpAddress& ip, const MacAddress& mac)
+{
+    SWSS_LOG_ENTER();
+
+    struct nl_msg *msg = buildNeighborMsg(alias, ip, mac);
+    if (!msg)
+    {
+        return false;
+    }
+
+    int err = m_rtnlBatch.sendRequest(msg);
+    if (err != 0)
+    {
+        SWSS_LOG_ERROR("Netlink neighbor request failed for '%s', error '%s'",
+                       ip.to_string().c_str(), strerror(err));
+        return false;
+    }
+
+    return true;
 }
 
 /**
@@ -285,6 +269,9 @@ void NbrMgr::doResolveNeighTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    /* Resolve requests queued in this drain, pipelined as one flush below */
+    vector<pair<size_t, string>> queuedNeighs;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -302,18 +289,37 @@ void NbrMgr::doResolveNeighTask(Consumer &consumer)
         IpAddress                 ip(keys[1]);
         string                    alias(keys[0]);
 
-        if (!setNeighbor(alias, ip, mac))
+        struct nl_msg *msg = buildNeighborMsg(alias, ip, mac);
+        if (!msg)
         {
             SWSS_LOG_ERROR("Neigh entry resolve failed for '%s'", kfvKey(t).c_str());
         }
+        else
+        {
+            queuedNeighs.emplace_back(m_rtnlBatch.queue(msg), kfvKey(t));
+        }
         it = consumer.m_toSync.erase(it);
     }
+
+    auto failed = m_rtnlBatch.flush();
+    for (const auto &neigh : queuedNeighs)
+    {
+        auto err = failed.find(neigh.first);
+        if (err != failed.end())
+        {
+            SWSS_LOG_ERROR("Neigh entry resolve failed for '%s', error '%s'",
+                           neigh.second.c_str(), strerror(err->second));
+        }
+    }
 }
 
 void NbrMgr::doSetNeighTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    /* Neighbor requests queued in this drain, pipelined as one flush below */
+    vector<pair<size_t, string>> queuedNeighs;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -361,13 +367,14 @@ void NbrMgr::doSetNeighTask(Consumer &consumer)
                 continue;
             }
 
-            if (!setNeighbor(alias, ip, mac))
+            struct nl_msg *msg = buildNeighborMsg(alias, ip, mac);
+            if (!msg)
             {
                 SWSS_LOG_ERROR("Neigh entry add failed for '%s'", kfvKey(t).c_str());
             }
             else
             {
-                SWSS_LOG_NOTICE("Neigh entry added for '%s'", kfvKey(t).c_str());
+                queuedNeighs.emplace_back(m_rtnlBatch.queue(msg), kfvKey(t));
             }
         }
         else if (op == DEL_COMMAND)
@@ -381,6 +388,21 @@ void NbrMgr::doSetNeighTask(Consumer &consumer)
 
         it = consumer.m_toSync.erase(it);
     }
+
+    auto failed = m_rtnlBatch.flush();
+    for (const auto &neigh : queuedNeighs)
+    {
+        auto err = failed.find(neigh.first);
+        if (err != failed.end())
+        {
+            SWSS_LOG_ERROR("Neigh entry add failed for '%s', error '%s'",
+                           neigh.second.c_str(), strerror(err->second));
+        }
+        else
+        {
+            SWSS_LOG_NOTICE("Neigh entry added for '%s'", neigh.second.c_str());
+        }
+    }
 }
 
 void NbrMgr::doTask(Consumer &consumer)
@@ -417,6 +439,22 @@ void NbrMgr::doStateSystemNeighTask(Consumer &consumer)
         return;
     }
 
+    struct QueuedSystemNeigh
+    {
+        size_t seq;                 // sequence returned by the netlink batch
+        SyncMap::iterator it;       // m_toSync entry the install came from
+        IpAddress ip;
+        MacAddress mac;
+        bool new_install;           // first install, so the kernel route is still missing
+
+        QueuedSystemNeigh(size_t s, SyncMap::iterator i, const IpAddress &ip_addr, const MacAddress &mac_addr, bool is_new)
+            : seq(s), it(i), ip(ip_addr), mac(mac_addr), new_install(is_new)
+        {
+        }
+    };
+    /* Neighbor installs queued in this drain, programmed as one netlink flush */
+    vector<QueuedSystemNeigh> queuedNeighs;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -450,34 +488,28 @@ void NbrMgr::doStateSystemNeighTask(Consumer &consumer)
                 continue;
             }
 
-            if (!addKernelNeigh(nbr_odev, ip_address, mac_address))
+            auto cached = m_systemNeighCache.find(ip_address);
+            if (cached != m_systemNeighCache.end() && cached->second == mac_address)
             {
-                SWSS_LOG_INFO("Neigh entry add on dev %s failed for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
-                // Delete neigh to take care of deletion of exiting nbr for mac change. This makes sure that
-                // re-try will be successful and route addtion (below) will be attempted and be successful
-                delKernelNeigh(nbr_odev, ip_address);
-                it++;
+                /* Kernel already holds this neighbor with the same MAC */
+                SWSS_LOG_DEBUG("System neigh %s is already programmed, skipping", kfvKey(t).c_str());
+                it = consumer.m_toSync.erase(it);
                 continue;
             }
-            else
-            {
-                SWSS_LOG_NOTICE("Neigh entry added on dev %s for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
-            }
 
-            if (!addKernelRoute(nbr_odev, ip_address))
+            /* The netlink request replaces any existing entry, so a MAC move
+             * is a single in-place update instead of a delete/add cycle */
+            struct nl_msg *msg = buildNeighborMsg(nbr_odev, ip_address, mac_address);
+            if (!msg)
             {
-                SWSS_LOG_INFO("Route entry add on dev %s failed for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
-                delKernelNeigh(nbr_odev, ip_address);
-                // Delete route to take care of deletion of exiting route of nbr for mac change.
-                delKernelRoute(ip_address);
+                SWSS_LOG_ERROR("Neigh entry add on dev %s failed for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
                 it++;
                 continue;
             }
-            else
-            {
-                SWSS_LOG_NOTICE("Route entry added on dev %s for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
-            }
-            SWSS_LOG_NOTICE("Added voq neighbor %s to kernel", kfvKey(t).c_str());
+
+            queuedNeighs.emplace_back(m_rtnlBatch.queue(msg), it, ip_address, mac_address,
+                                      cached == m_systemNeighCache.end());
+            it++;
         }
         else if (op == DEL_COMMAND)
         {
@@ -498,10 +530,45 @@ void NbrMgr::doStateSystemNeighTask(Consumer &consumer)
             {
                 SWSS_LOG_NOTICE("Neigh entry on dev %s deleted for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
             }
+            m_systemNeighCache.erase(ip_address);
             SWSS_LOG_DEBUG("Deleted voq neighbor %s from kernel", kfvKey(t).c_str());
+            it = consumer.m_toSync.erase(it);
         }
+        else
+        {
+            it = consumer.m_toSync.erase(it);
+        }
+    }
 
-        it = consumer.m_toSync.erase(it);
+    if (queuedNeighs.empty())
+    {
+        return;
+    }
+
+    auto failed = m_rtnlBatch.flush();
+    for (const auto &neigh : queuedNeighs)
+    {
+        auto err = failed.find(neigh.seq);
+        if (err != failed.end())
+        {
+            /* Left in m_toSync for retry on the next drain */
+            SWSS_LOG_INFO("Neigh entry add on dev %s failed for '%s', error '%s'",
+                          nbr_odev.c_str(), neigh.it->first.c_str(), strerror(err->second));
+            continue;
+        }
+
+        if (neigh.new_install && !addKernelRoute(nbr_odev, neigh.ip))
+        {
+            SWSS_LOG_INFO("Route entry add on dev %s failed for '%s'", nbr_odev.c_str(), neigh.it->first.c_str());
+            delKernelNeigh(nbr_odev, neigh.ip);
+            // Delete route to take care of deletion of exiting route of nbr for mac change.
+            delKernelRoute(neigh.ip);
+            continue;
+        }
+
+        m_systemNeighCache[neigh.ip] = neigh.mac;
+        SWSS_LOG_NOTICE("Added voq neighbor %s to kernel", neigh.it->first.c_str());
+        consumer.m_toSync.erase(neigh.it);
     }
 }
 
@@ -618,38 +685,6 @@ bool NbrMgr::delKernelRoute(IpAddress ip_addr)
     return true;
 }
 
-bool NbrMgr::addKernelNeigh(string odev, IpAddress ip_addr, MacAddress mac_addr)
-{
-    SWSS_LOG_ENTER();
-
-    string cmd, res;
-    string ip_str = ip_addr.to_string();
-    string mac_str = mac_addr.to_string();
-
-    if(ip_addr.isV4())
-    {
-        cmd = string("") + IP_CMD + " neigh add " + ip_str + " lladdr " + mac_str + " dev " + odev;
-        SWSS_LOG_NOTICE("IPv4 Nbr Add cmd: %s",cmd.c_str());
-    }
-    else
-    {
-        cmd = string("") + IP_CMD + " -6 neigh add " + ip_str + " lladdr " + mac_str + " dev " + odev;
-        SWSS_LOG_NOTICE("IPv6 Nbr Add cmd: %s",cmd.c_str());
-    }
-
-    int32_t ret = swss::exec(cmd, res);
-
-    if(ret)
-    {
-        /* This failure the caller expects is due to mac move */
-        SWSS_LOG_INFO("Failed to add Nbr for %s, error: %d", ip_str.c_str(), ret);
-        return false;
-    }
-
-    SWSS_LOG_INFO("Added Nbr for %s on interface %s", ip_str.c_str(), odev.c_str());
-    return true;
-}
-
 bool NbrMgr::delKernelNeigh(string odev, IpAddress ip_addr)
 {
     string cmd, res;
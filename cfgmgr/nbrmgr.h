@@ -9,6 +9,7 @@
 #include "producerstatetable.h"
 #include "orch.h"
 #include "netmsg.h"
+#include "rtnlbatch.h"
 
 using namespace std;
 
@@ -25,6 +26,7 @@ public:
 private:
     void reconcileNeighResolveTable(DBConnector *appDb);
     bool isIntfStateOk(const std::string &alias);
+    struct nl_msg *buildNeighborMsg(const std::string& alias, const IpAddress& ip, const MacAddress& mac);
     bool setNeighbor(const std::string& alias, const IpAddress& ip, const MacAddress& mac);
 
     vector<string> parseAliasIp(const string &app_db_nbr_tbl_key, const char *delimiter);
@@ -36,13 +38,16 @@ private:
     bool getVoqInbandInterfaceName(string &nbr_odev, string &ibiftype);
     bool addKernelRoute(string odev, IpAddress ip_addr);
     bool delKernelRoute(IpAddress ip_addr);
-    bool addKernelNeigh(string odev, IpAddress ip_addr, MacAddress mac_addr);
     bool delKernelNeigh(string odev, IpAddress ip_addr);
     bool isIntfOperUp(const std::string &alias);
     unique_ptr<Table> m_cfgVoqInbandInterfaceTable;
 
     Table m_statePortTable, m_stateLagTable, m_stateVlanTable, m_stateIntfTable, m_stateNeighRestoreTable;
-    struct nl_sock *m_nl_sock;
+    RtnlBatch m_rtnlBatch;
+    /* Remote neighbors already programmed into the kernel, so a re-delivered
+     * entry with an unchanged MAC is answered from memory instead of another
+     * kernel round trip */
+    std::map<IpAddress, MacAddress> m_systemNeighCache;
 };
 
 }
@@ -0,0 +1,199 @@
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+
+#include "logger.h"
+#include "rtnlbatch.h"
+
+using namespace std;
+using namespace swss;
+
+/* Maximum number of RTM requests carried by one sendmsg() */
+#define RTNL_BATCH_MAX          128
+
+/* How long to wait for outstanding kernel ACKs, in milliseconds */
+#define RTNL_ACK_TIMEOUT_MS     1000
+
+RtnlBatch::RtnlBatch() :
+    m_seq(1)
+{
+    int err = 0;
+
+    m_sock = nl_socket_alloc();
+    if (!m_sock)
+    {
+        SWSS_LOG_ERROR("Netlink socket alloc failed");
+    }
+    else if ((err = nl_connect(m_sock, NETLINK_ROUTE)) < 0)
+    {
+        SWSS_LOG_ERROR("Netlink socket connect failed, error '%s'", nl_geterror(err));
+        nl_socket_free(m_sock);
+        m_sock = NULL;
+    }
+}
+
+RtnlBatch::~RtnlBatch()
+{
+    for (auto *msg : m_msgs)
+    {
+        nlmsg_free(msg);
+    }
+
+    if (m_sock)
+    {
+        nl_socket_free(m_sock);
+    }
+}
+
+size_t RtnlBatch::queue(struct nl_msg *msg)
+{
+    struct nlmsghdr *hdr = nlmsg_hdr(msg);
+
+    hdr->nlmsg_flags |= (NLM_F_REQUEST | NLM_F_ACK);
+    hdr->nlmsg_seq = m_seq++;
+    hdr->nlmsg_pid = m_sock ? nl_socket_get_local_port(m_sock) : 0;
+
+    m_msgs.push_back(msg);
+    return m_msgs.size() - 1;
+}
+
+map<size_t, int> RtnlBatch::flush()
+{
+    map<size_t, int> failed;
+
+    if (m_msgs.empty())
+    {
+        return failed;
+    }
+
+    if (!m_sock)
+    {
+        SWSS_LOG_ERROR("Netlink socket null pointer, dropping %zu requests", m_msgs.size());
+        for (size_t i = 0; i < m_msgs.size(); i++)
+        {
+            failed[i] = ENOTCONN;
+            nlmsg_free(m_msgs[i]);
+        }
+        m_msgs.clear();
+        return failed;
+    }
+
+    int fd = nl_socket_get_fd(m_sock);
+
+    for (size_t offset = 0; offset < m_msgs.size(); offset += RTNL_BATCH_MAX)
+    {
+        size_t count = m_msgs.size() - offset;
+        if (count > RTNL_BATCH_MAX)
+        {
+            count = RTNL_BATCH_MAX;
+        }
+
+        vector<struct iovec> iov(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            struct nlmsghdr *hdr = nlmsg_hdr(m_msgs[offset + i]);
+            iov[i].iov_base = hdr;
+            iov[i].iov_len = hdr->nlmsg_len;
+        }
+
+        struct sockaddr_nl dst = {};
+        dst.nl_family = AF_NETLINK;
+
+        struct msghdr mh = {};
+        mh.msg_name = &dst;
+        mh.msg_namelen = sizeof(dst);
+        mh.msg_iov = iov.data();
+        mh.msg_iovlen = count;
+
+        if (sendmsg(fd, &mh, 0) < 0)
+        {
+            SWSS_LOG_ERROR("Netlink batch send failed, error '%s'", strerror(errno));
+            for (size_t i = 0; i < count; i++)
+            {
+                failed[offset + i] = errno;
+            }
+            continue;
+        }
+
+        collectAcks(nlmsg_hdr(m_msgs[offset])->nlmsg_seq, offset, count, failed);
+    }
+
+    for (auto *msg : m_msgs)
+    {
+        nlmsg_free(msg);
+    }
+    m_msgs.clear();
+
+    return failed;
+}
+
+void RtnlBatch::collectAcks(uint32_t first_seq, size_t base, size_t count,
+                            map<size_t, int> &failed)
+{
+    int fd = nl_socket_get_fd(m_sock);
+    size_t acked = 0;
+    char buf[32768];
+
+    while (acked < count)
+    {
+        struct pollfd pfd = {fd, POLLIN, 0};
+
+        int rc = poll(&pfd, 1, RTNL_ACK_TIMEOUT_MS);
+        if (rc <= 0)
+        {
+            SWSS_LOG_WARN("Timed out waiting for %zu of %zu netlink ACKs",
+                          count - acked, count);
+            return;
+        }
+
+        ssize_t len = recv(fd, buf, sizeof(buf), 0);
+        if (len <= 0)
+        {
+            SWSS_LOG_ERROR("Netlink ACK receive failed, error '%s'", strerror(errno));
+            return;
+        }
+
+        int remaining = (int)len;
+        for (struct nlmsghdr *hdr = (struct nlmsghdr *)buf;
+             NLMSG_OK(hdr, remaining);
+             hdr = NLMSG_NEXT(hdr, remaining))
+        {
+            if (hdr->nlmsg_type != NLMSG_ERROR)
+            {
+                continue;
+            }
+
+            if (hdr->nlmsg_seq < first_seq || hdr->nlmsg_seq >= first_seq + count)
+            {
+                continue;
+            }
+
+            acked++;
+
+            auto *err = (struct nlmsgerr *)NLMSG_DATA(hdr);
+            if (err->error != 0)
+            {
+                failed[base + (hdr->nlmsg_seq - first_seq)] = -err->error;
+            }
+        }
+    }
+}
+
+int RtnlBatch::sendRequest(struct nl_msg *msg)
+{
+    if (!m_sock)
+    {
+        SWSS_LOG_ERROR("Netlink socket null pointer");
+        nlmsg_free(msg);
+        return ENOTCONN;
+    }
+
+    size_t index = queue(msg);
+    auto failed = flush();
+
+    auto it = failed.find(index);
+    return (it == failed.end()) ? 0 : it->second;
+}
@@ -0,0 +1,49 @@
+#ifndef __RTNLBATCH__
+#define __RTNLBATCH__
+
+#include <netlink/netlink.h>
+#include <netlink/msg.h>
+
+#include <map>
+#include <vector>
+
+namespace swss {
+
+/*
+ * Shared rtnetlink request channel for the cfgmgr daemons.  Requests are
+ * queued as libnl messages and flushed in batches: one sendmsg() carries
+ * multiple RTM requests and the kernel ACKs are collected in a single
+ * receive pass, mapped back to the queued requests by sequence number.
+ */
+class RtnlBatch
+{
+public:
+    RtnlBatch();
+    ~RtnlBatch();
+
+    bool isConnected() const { return m_sock != NULL; }
+
+    /* Queues a request and returns its index within the batch.
+     * The batch takes ownership of the message. */
+    size_t queue(struct nl_msg *msg);
+
+    /* Sends the queued requests and collects their ACKs.  The returned
+     * map carries the kernel errno per failed request index. */
+    std::map<size_t, int> flush();
+
+    /* Queues and flushes a single request.  Returns zero on success or
+     * the kernel errno on failure. */
+    int sendRequest(struct nl_msg *msg);
+
+private:
+    void collectAcks(uint32_t first_seq, size_t base, size_t count,
+                     std::map<size_t, int> &failed);
+
+    struct nl_sock *m_sock;
+    std::vector<struct nl_msg *> m_msgs;
+    uint32_t m_seq;
+};
+
+}
+
+#endif // __RTNLBATCH__
@@ -12,8 +12,9 @@ using namespace swss;
 
 SflowMgr::SflowMgr(DBConnector *appDb, const std::vector<TableConnector>& tableNames) :
         Orch(tableNames),
-        m_appSflowTable(appDb, APP_SFLOW_TABLE_NAME),
-        m_appSflowSessionTable(appDb, APP_SFLOW_SESSION_TABLE_NAME)
+        m_appDbPipeline(appDb),
+        m_appSflowTable(&m_appDbPipeline, APP_SFLOW_TABLE_NAME, true),
+        m_appSflowSessionTable(&m_appDbPipeline, APP_SFLOW_SESSION_TABLE_NAME, true)
 {
     m_intfAllConf = true;
     m_gEnable = false;
@@ -217,6 +218,8 @@ void SflowMgr::sflowProcessOperSpeed(Consumer &consumer)
     }
 }
 
+/* Per-port session writes during a drain land in the pipeline and reach
+   APPL_DB as one bulk write when doTask flushes */
 void SflowMgr::sflowHandleSessionAll(bool enable, string direction)
 {
     for (auto it: m_sflowPortConfMap)
@@ -272,16 +275,33 @@ void SflowMgr::sflowHandleSessionLocal(bool enable)
     }
 }
 
-void SflowMgr::sflowGetGlobalInfo(vector<FieldValueTuple> &fvs, const string& alias, const string& dir)
+const vector<FieldValueTuple>& SflowMgr::sflowGetSpeedGroupFvs(const string& speed, const string& dir)
 {
+    /* Ports sharing a speed and direction use one computed session record,
+       so a fabric-wide speed event computes each group only once */
+    auto group = m_speedGroupFvs.find(make_pair(speed, dir));
+    if (group != m_speedGroupFvs.end())
+    {
+        return group->second;
+    }
+
+    vector<FieldValueTuple> fvs;
+
     FieldValueTuple fv1("admin_state", "up");
     fvs.push_back(fv1);
 
-    FieldValueTuple fv2("sample_rate", findSamplingRate(alias));
+    FieldValueTuple fv2("sample_rate", speed);
     fvs.push_back(fv2);
 
     FieldValueTuple fv3("sample_direction",dir);
     fvs.push_back(fv3);
+
+    return m_speedGroupFvs[make_pair(speed, dir)] = fvs;
+}
+
+void SflowMgr::sflowGetGlobalInfo(vector<FieldValueTuple> &fvs, const string& alias, const string& dir)
+{
+    fvs = sflowGetSpeedGroupFvs(findSamplingRate(alias), dir);
 }
 
 void SflowMgr::sflowGetPortInfo(vector<FieldValueTuple> &fvs, SflowPortInfo &local_info)
@@ -409,11 +429,13 @@ void SflowMgr::doTask(Consumer &consumer)
     if (table == CFG_PORT_TABLE_NAME)
     {
         sflowUpdatePortInfo(consumer);
+        m_appDbPipeline.flush();
         return;
     }
     else if (table == STATE_PORT_TABLE_NAME)
     {
         sflowProcessOperSpeed(consumer);
+        m_appDbPipeline.flush();
         return;
     }
 
@@ -584,4 +606,5 @@ void SflowMgr::doTask(Consumer &consumer)
         }
         it = consumer.m_toSync.erase(it);
     }
+    m_appDbPipeline.flush();
 }
@@ -3,10 +3,12 @@
 #include "dbconnector.h"
 #include "orch.h"
 #include "producerstatetable.h"
+#include "redispipeline.h"
 
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 
 namespace swss {
 
@@ -28,6 +30,9 @@ struct SflowPortInfo
 /* Port to Local config map  */
 typedef std::map<std::string, SflowPortInfo> SflowPortConfMap;
 
+/* (speed, direction) group to computed session attributes map */
+typedef std::map<std::pair<std::string, std::string>, std::vector<FieldValueTuple>> SflowGroupFvsMap;
+
 class SflowMgr : public Orch
 {
 public:
@@ -36,9 +41,11 @@ public:
 
     using Orch::doTask;
 private:
+    RedisPipeline          m_appDbPipeline;
     ProducerStateTable     m_appSflowTable;
     ProducerStateTable     m_appSflowSessionTable;
     SflowPortConfMap       m_sflowPortConfMap;
+    SflowGroupFvsMap       m_speedGroupFvs;
     bool                   m_intfAllConf;
     bool                   m_gEnable;
     std::string            m_intfAllDir;
@@ -53,6 +60,7 @@ private:
     void sflowCheckAndFillValues(std::string alias, std::vector<FieldValueTuple> &values, std::vector<FieldValueTuple> &fvs);
     void sflowGetPortInfo(std::vector<FieldValueTuple> &fvs, SflowPortInfo &local_info);
     void sflowGetGlobalInfo(std::vector<FieldValueTuple> &fvs, const std::string& alias, const std::string& direction);
+    const std::vector<FieldValueTuple>& sflowGetSpeedGroupFvs(const std::string& speed, const std::string& direction);
     bool isPortEnabled(const std::string& alias);
     std::string findSamplingRate(const std::string& speed);
 };
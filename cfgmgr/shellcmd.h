@@ -3,6 +3,11 @@
 
 #include <iomanip>
 #include <regex>
+#include <map>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cstdlib>
 
 #define IP_CMD               "/sbin/ip"
 #define BRIDGE_CMD           "/sbin/bridge"
@@ -29,4 +34,95 @@ static inline std::string shellquote(const std::string& str)
     return "\"" + std::regex_replace(str, re, "\\$1") + "\"";
 }
 
+/* Maximum number of commands joined into one shell invocation */
+#define SHELLCMD_BATCH_MAX    128
+
+/* Marker echoed after each batched command to delimit its output and
+ * carry its exit status */
+#define SHELLCMD_BATCH_MARKER "__SHELLCMD_BATCH_RC__"
+
+/*
+ * Accumulates the shell commands queued while draining one batch of tasks
+ * and runs them with a single shell invocation instead of one fork/exec per
+ * command.  Every command's exit status and output are captured separately
+ * so a failure can be mapped back to the task that queued the command.
+ */
+class ShellCmdBatch
+{
+public:
+    /* Queues a command and returns its index within the batch */
+    size_t add(const std::string &cmd)
+    {
+        m_cmds.push_back(cmd);
+        return m_cmds.size() - 1;
+    }
+
+    bool empty() const
+    {
+        return m_cmds.empty();
+    }
+
+    /*
+     * Runs the accumulated commands and clears the batch.  The commands are
+     * independent of each other: a failing command does not stop the rest of
+     * the batch.  The returned map carries "<cmd> : <output>" per failed
+     * command index, matching the message format of EXEC_WITH_ERROR_THROW.
+     */
+    std::map<size_t, std::string> exec()
+    {
+        std::map<size_t, std::string> failed;
+
+        for (size_t offset = 0; offset < m_cmds.size(); offset += SHELLCMD_BATCH_MAX)
+        {
+            size_t count = m_cmds.size() - offset;
+            if (count > SHELLCMD_BATCH_MAX)
+            {
+                count = SHELLCMD_BATCH_MAX;
+            }
+
+            std::ostringstream batch;
+            for (size_t i = 0; i < count; i++)
+            {
+                batch << "{ " << m_cmds[offset + i] << " ; } 2>&1; "
+                         "rc=$?; echo; echo \"" SHELLCMD_BATCH_MARKER " $rc\"; ";
+            }
+
+            std::string res;
+            swss::exec(batch.str(), res);
+
+            /* Attribute the output preceding each marker to the command
+             * that produced it */
+            size_t pos = 0;
+            for (size_t i = 0; i < count; i++)
+            {
+                size_t mpos = res.find(SHELLCMD_BATCH_MARKER, pos);
+                if (mpos == std::string::npos)
+                {
+                    /* The shell itself failed to run the remaining commands */
+                    for (; i < count; i++)
+                    {
+                        failed[offset + i] = m_cmds[offset + i] + " : " + res;
+                    }
+                    break;
+                }
+
+                int rc = std::atoi(res.c_str() + mpos + sizeof(SHELLCMD_BATCH_MARKER) - 1);
+                if (rc != 0)
+                {
+                    failed[offset + i] = m_cmds[offset + i] + " : " + res.substr(pos, mpos - pos);
+                }
+
+                pos = res.find('\n', mpos);
+                pos = (pos == std::string::npos) ? res.size() : pos + 1;
+            }
+        }
+
+        m_cmds.clear();
+        return failed;
+    }
+
+private:
+    std::vector<std::string> m_cmds;
+};
+
 #endif /* __SHELLCMD__ */
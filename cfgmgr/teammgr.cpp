@@ -24,6 +24,8 @@
 using namespace std;
 using namespace swss;
 
+#define TEAMD_READY_RETRIES 100    // checked every 10ms; bounds the wait for a spawned teamd to daemonize
+
 
 TeamMgr::TeamMgr(DBConnector *confDb, DBConnector *applDb, DBConnector *statDb,
         const vector<TableConnector> &tables) :
@@ -235,6 +237,22 @@ void TeamMgr::doLagTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    // Port channels created in this drain are collected first and their
+    // teamd instances are spawned concurrently, so the bring-up time of a
+    // batch is bounded by the slowest instance instead of the sum.
+    struct LagSpawn
+    {
+        std::string alias;
+        std::string admin_status;
+        std::string mtu;
+        std::string learn_mode;
+        std::string tpid;
+        SyncMap::iterator entry;
+    };
+    vector<LagSpawn> spawnedLags;
+    set<string> spawningAliases;
+    string spawnCmds;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -300,15 +318,20 @@ void TeamMgr::doLagTask(Consumer &consumer)
 
             if (m_lagList.find(alias) == m_lagList.end())
             {
-                if (addLag(alias, min_links, fallback, fast_rate) == task_need_retry)
+                // A duplicate entry for an alias being spawned is retried in
+                // the next drain.
+                if (spawningAliases.find(alias) == spawningAliases.end())
                 {
-                    // If LAG creation fails, we need to clean up any potentially orphaned teamd processes
-                    removeLag(alias);
-                    it++;
-                    continue;
+                    if (!spawnCmds.empty())
+                    {
+                        spawnCmds += " & ";
+                    }
+                    spawnCmds += getTeamdStartCmd(alias, min_links, fallback, fast_rate);
+                    spawnedLags.push_back({alias, admin_status, mtu, learn_mode, tpid, it});
+                    spawningAliases.insert(alias);
                 }
-
-                m_lagList.insert(alias);
+                it++;
+                continue;
             }
 
             setLagAdminStatus(alias, admin_status);
@@ -335,6 +358,54 @@ void TeamMgr::doLagTask(Consumer &consumer)
 
         it = consumer.m_toSync.erase(it);
     }
+
+    if (spawnedLags.empty())
+    {
+        return;
+    }
+
+    // Start every teamd instance of the batch as a background job; the
+    // command returns once all the daemonizing foreground processes have
+    // exited. Per-instance failures are detected through the pid files.
+    string res;
+    spawnCmds += " & wait";
+    if (exec(spawnCmds, res) != 0)
+    {
+        SWSS_LOG_WARN("Some of the %zu spawned teamd instances failed to start", spawnedLags.size());
+    }
+
+    for (const auto &spawn : spawnedLags)
+    {
+        if (!waitForTeamdReady(spawn.alias))
+        {
+            SWSS_LOG_INFO("Failed to start port channel %s with teamd, retry...",
+                    spawn.alias.c_str());
+            // If LAG creation fails, we need to clean up any potentially
+            // orphaned teamd processes; the entry stays in m_toSync for the
+            // retry.
+            removeLag(spawn.alias);
+            continue;
+        }
+
+        SWSS_LOG_NOTICE("Start port channel %s with teamd", spawn.alias.c_str());
+
+        m_lagList.insert(spawn.alias);
+
+        setLagAdminStatus(spawn.alias, spawn.admin_status);
+        setLagMtu(spawn.alias, spawn.mtu);
+        if (!spawn.learn_mode.empty())
+        {
+            setLagLearnMode(spawn.alias, spawn.learn_mode);
+            SWSS_LOG_NOTICE("Configure %s MAC learn mode to %s", spawn.alias.c_str(), spawn.learn_mode.c_str());
+        }
+        if (!spawn.tpid.empty())
+        {
+            setLagTpid(spawn.alias, spawn.tpid);
+            SWSS_LOG_NOTICE("Configure %s TPID to %s", spawn.alias.c_str(), spawn.tpid.c_str());
+        }
+
+        consumer.m_toSync.erase(spawn.entry);
+    }
 }
 
 void TeamMgr::doLagMemberTask(Consumer &consumer)
@@ -561,12 +632,11 @@ bool TeamMgr::setLagLearnMode(const string &alias, const string &learn_mode)
     return true;
 }
 
-task_process_status TeamMgr::addLag(const string &alias, int min_links, bool fallback, bool fast_rate)
+string TeamMgr::getTeamdStartCmd(const string &alias, int min_links, bool fallback, bool fast_rate)
 {
     SWSS_LOG_ENTER();
 
     stringstream cmd;
-    string res;
 
     stringstream conf;
 
@@ -637,16 +707,26 @@ task_process_status TeamMgr::addLag(const string &alias, int min_links, bool fal
         << " -L " << dump_path
         << " -g -d";
 
-    if (exec(cmd.str(), res) != 0)
+    return cmd.str();
+}
+
+// teamd writes its pid file once the team device is set up, so the file
+// appearing is the readiness signal of a concurrently spawned instance.
+bool TeamMgr::waitForTeamdReady(const string &alias)
+{
+    SWSS_LOG_ENTER();
+
+    for (int i = 0; i < TEAMD_READY_RETRIES; i++)
     {
-        SWSS_LOG_INFO("Failed to start port channel %s with teamd, retry...",
-                alias.c_str());
-        return task_need_retry;
+        ifstream pidfile("/var/run/teamd/" + alias + ".pid");
+        if (pidfile.is_open())
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 
-    SWSS_LOG_NOTICE("Start port channel %s with teamd", alias.c_str());
-
-    return task_success;
+    return false;
 }
 
 bool TeamMgr::removeLag(const string &alias)
@@ -41,7 +41,8 @@ private:
     void doLagMemberTask(Consumer &consumer);
     void doPortUpdateTask(Consumer &consumer);
 
-    task_process_status addLag(const std::string &alias, int min_links, bool fall_back, bool fast_rate);
+    std::string getTeamdStartCmd(const std::string &alias, int min_links, bool fall_back, bool fast_rate);
+    bool waitForTeamdReady(const std::string &alias);
     bool removeLag(const std::string &alias);
     task_process_status addLagMember(const std::string &lag, const std::string &member);
     bool removeLagMember(const std::string &lag, const std::string &member);
@@ -230,10 +230,8 @@ bool VlanMgr::setHostVlanMac(int vlan_id, const string &mac)
     return true;
 }
 
-bool VlanMgr::addHostVlanMember(int vlan_id, const string &port_alias, const string& tagging_mode)
+std::string VlanMgr::getAddHostVlanMemberCmd(int vlan_id, const string &port_alias, const string &tagging_mode)
 {
-    SWSS_LOG_ENTER();
-
     std::string tagging_cmd;
     if (tagging_mode == "untagged" || tagging_mode == "priority_tagged")
     {
@@ -250,10 +248,19 @@ bool VlanMgr::addHostVlanMember(int vlan_id, const string &port_alias, const str
       BRIDGE_CMD " vlan add vid " + std::to_string(vlan_id) + " dev " << shellquote(port_alias) << " " + tagging_cmd;
     cmds << BASH_CMD " -c " << shellquote(inner.str());
 
+    return cmds.str();
+}
+
+bool VlanMgr::addHostVlanMember(int vlan_id, const string &port_alias, const string& tagging_mode)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string cmds = getAddHostVlanMemberCmd(vlan_id, port_alias, tagging_mode);
+
     std::string res;
     try
     {
-        EXEC_WITH_ERROR_THROW(cmds.str(), res);
+        EXEC_WITH_ERROR_THROW(cmds, res);
     }
     catch (const std::runtime_error& e)
     {
@@ -265,17 +272,15 @@ bool VlanMgr::addHostVlanMember(int vlan_id, const string &port_alias, const str
 	}
         else
 	{
-            EXEC_WITH_ERROR_THROW(cmds.str(), res);
+            EXEC_WITH_ERROR_THROW(cmds, res);
 	}
     }
 
     return true;
 }
 
-bool VlanMgr::removeHostVlanMember(int vlan_id, const string &port_alias)
+std::string VlanMgr::getRemoveHostVlanMemberCmd(int vlan_id, const string &port_alias)
 {
-    SWSS_LOG_ENTER();
-
     // The command should be generated as:
     // /bin/bash -c '/sbin/bridge vlan del vid {{vlan_id}} dev {{port_alias}} &&
     //               ( vlanShow=$(/sbin/bridge vlan show dev {{port_alias}});
@@ -302,8 +307,17 @@ bool VlanMgr::removeHostVlanMember(int vlan_id, const string &port_alias)
       "else exit $ret; fi )";
     cmds << BASH_CMD " -c " << shellquote(inner.str());
 
+    return cmds.str();
+}
+
+bool VlanMgr::removeHostVlanMember(int vlan_id, const string &port_alias)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string cmds = getRemoveHostVlanMemberCmd(vlan_id, port_alias);
+
     std::string res;
-    EXEC_WITH_ERROR_THROW(cmds.str(), res);
+    EXEC_WITH_ERROR_THROW(cmds, res);
 
     return true;
 }
@@ -592,6 +606,19 @@ void VlanMgr::processUntaggedVlanMembers(string vlan, const string &members)
 
 void VlanMgr::doVlanMemberTask(Consumer &consumer)
 {
+    /* Member adds/removes queued in this drain, executed as one batch below */
+    struct PendingMember
+    {
+        int vlan_id;
+        std::string port_alias;
+        std::string tagging_mode;
+        bool add;
+        size_t cmdIndex;
+        SyncMap::iterator entry;
+    };
+    std::vector<PendingMember> pendingMembers;
+    ShellCmdBatch batch;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -664,39 +691,19 @@ void VlanMgr::doVlanMemberTask(Consumer &consumer)
                 continue;
             }
 
-            if (addHostVlanMember(vlan_id, port_alias, tagging_mode))
-            {
-                key = VLAN_PREFIX + to_string(vlan_id);
-                key += DEFAULT_KEY_SEPARATOR;
-                key += port_alias;
-                m_appVlanMemberTableProducer.set(key, kfvFieldsValues(t));
-
-                vector<FieldValueTuple> fvVector;
-                FieldValueTuple s("state", "ok");
-                fvVector.push_back(s);
-                m_stateVlanMemberTable.set(kfvKey(t), fvVector);
-
-                m_vlanMemberReplay.erase(kfvKey(t));
-                m_PortVlanMember[port_alias][vlan_alias] = tagging_mode;
-            }
-            else
-            {
-                SWSS_LOG_INFO("Netdevice for  %s not ready, delaying", kfvKey(t).c_str());
-                it++;
-                continue;
-            }
+            size_t cmdIndex = batch.add(getAddHostVlanMemberCmd(vlan_id, port_alias, tagging_mode));
+            pendingMembers.push_back({vlan_id, port_alias, tagging_mode, true, cmdIndex, it});
+            it++;
+            continue;
         }
         else if (op == DEL_COMMAND)
         {
             if (isVlanMemberStateOk(kfvKey(t)))
             {
-                removeHostVlanMember(vlan_id, port_alias);
-                key = VLAN_PREFIX + to_string(vlan_id);
-                key += DEFAULT_KEY_SEPARATOR;
-                key += port_alias;
-                m_appVlanMemberTableProducer.del(key);
-                m_stateVlanMemberTable.del(kfvKey(t));
-                m_PortVlanMember[port_alias].erase(vlan_alias);
+                size_t cmdIndex = batch.add(getRemoveHostVlanMemberCmd(vlan_id, port_alias));
+                pendingMembers.push_back({vlan_id, port_alias, "", false, cmdIndex, it});
+                it++;
+                continue;
             }
             else
             {
@@ -711,6 +718,67 @@ void VlanMgr::doVlanMemberTask(Consumer &consumer)
         /* Other than the case of member port/lag is not ready, no retry will be performed */
         it = consumer.m_toSync.erase(it);
     }
+
+    /* Run all queued kernel operations with a single shell invocation and
+     * map any failures back to the tasks that queued them */
+    auto failedCmds = batch.exec();
+
+    for (const auto &member : pendingMembers)
+    {
+        auto &t = member.entry->second;
+        string vlan_alias = VLAN_PREFIX + to_string(member.vlan_id);
+        auto failure = failedCmds.find(member.cmdIndex);
+
+        if (member.add)
+        {
+            if (failure != failedCmds.end())
+            {
+                /* Race condition can happen with portchannel removal might happen
+                 * but state db is not updated yet so we can do retry instead of sending exception */
+                if (!member.port_alias.compare(0, strlen(LAG_PREFIX), LAG_PREFIX))
+                {
+                    SWSS_LOG_INFO("Netdevice for  %s not ready, delaying", kfvKey(t).c_str());
+                    continue;
+                }
+
+                /* Retry the command on its own before giving up, as the
+                 * former per-entry path did */
+                const std::string cmds = getAddHostVlanMemberCmd(member.vlan_id, member.port_alias, member.tagging_mode);
+                std::string res;
+                EXEC_WITH_ERROR_THROW(cmds, res);
+            }
+
+            string key = VLAN_PREFIX + to_string(member.vlan_id);
+            key += DEFAULT_KEY_SEPARATOR;
+            key += member.port_alias;
+            m_appVlanMemberTableProducer.set(key, kfvFieldsValues(t));
+
+            vector<FieldValueTuple> fvVector;
+            FieldValueTuple s("state", "ok");
+            fvVector.push_back(s);
+            m_stateVlanMemberTable.set(kfvKey(t), fvVector);
+
+            m_vlanMemberReplay.erase(kfvKey(t));
+            m_PortVlanMember[member.port_alias][vlan_alias] = member.tagging_mode;
+        }
+        else
+        {
+            if (failure != failedCmds.end())
+            {
+                throw runtime_error(failure->second);
+            }
+
+            string key = VLAN_PREFIX + to_string(member.vlan_id);
+            key += DEFAULT_KEY_SEPARATOR;
+            key += member.port_alias;
+            m_appVlanMemberTableProducer.del(key);
+            m_stateVlanMemberTable.del(kfvKey(t));
+            m_PortVlanMember[member.port_alias].erase(vlan_alias);
+            SWSS_LOG_DEBUG("%s", (consumer.dumpTuple(t)).c_str());
+        }
+
+        consumer.m_toSync.erase(member.entry);
+    }
     if (!replayDone && m_vlanMemberReplay.empty() &&
         WarmStart::isWarmStart())
     {
@@ -40,6 +40,8 @@ private:
     bool setHostVlanAdminState(int vlan_id, const std::string &admin_status);
     bool setHostVlanMtu(int vlan_id, uint32_t mtu);
     bool setHostVlanMac(int vlan_id, const std::string &mac);
+    std::string getAddHostVlanMemberCmd(int vlan_id, const std::string &port_alias, const std::string &tagging_mode);
+    std::string getRemoveHostVlanMemberCmd(int vlan_id, const std::string &port_alias);
     bool addHostVlanMember(int vlan_id, const std::string &port_alias, const std::string& tagging_mode);
     bool removeHostVlanMember(int vlan_id, const std::string &port_alias);
     bool isMemberStateOk(const std::string &alias);
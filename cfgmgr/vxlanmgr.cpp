@@ -282,6 +282,8 @@ void VxlanMgr::doTask(Consumer &consumer)
             ++it;
         }
     }
+
+    flushNetdevBatch();
 }
 
 bool VxlanMgr::doVxlanCreateTask(const KeyOpFieldsValuesTuple & t)
@@ -954,7 +956,7 @@ int VxlanMgr::createVxlanNetdevice(std::string vxlanTunnelName, std::string vni_
                                    std::string src_ip, std::string dst_ip,
                                    std::string vlan_id)
 {
-    std::string res, cmds;
+    std::string cmds;
     std::string link_add_cmd, link_set_master_cmd, link_up_cmd;
     std::string bridge_add_cmd, bridge_untagged_add_cmd, bridge_del_vid_cmd, bridge_learn_off_cmd;
     std::string vxlan_dev_name;
@@ -1050,21 +1052,88 @@ int VxlanMgr::createVxlanNetdevice(std::string vxlanTunnelName, std::string vni_
 
     cmds += link_up_cmd + "\"";
 
-    return swss::exec(cmds,res);
+    auto state = m_vxlanNetdevStates.find(vxlan_dev_name);
+    if (state != m_vxlanNetdevStates.end() && state->second != NETDEV_STATE_FAILED)
+    {
+        SWSS_LOG_INFO("VxlanNetDevice %s already programmed", vxlan_dev_name.c_str());
+        return RET_SUCCESS;
+    }
+
+    m_pendingNetdevs.emplace_back(m_netdevBatch.add(cmds), vxlan_dev_name);
+    m_vxlanNetdevStates[vxlan_dev_name] = NETDEV_STATE_CREATE_PENDING;
+
+    return RET_SUCCESS;
+}
+
+void VxlanMgr::flushNetdevBatch()
+{
+    if (m_netdevBatch.empty())
+    {
+        m_pendingNetdevs.clear();
+        return;
+    }
+
+    auto failedCmds = m_netdevBatch.exec();
+    for (const auto & pending : m_pendingNetdevs)
+    {
+        auto failure = failedCmds.find(pending.first);
+        if (failure == failedCmds.end())
+        {
+            m_vxlanNetdevStates[pending.second] = NETDEV_STATE_CREATED;
+        }
+        else
+        {
+            m_vxlanNetdevStates[pending.second] = NETDEV_STATE_FAILED;
+            SWSS_LOG_WARN("Vxlan Net Dev creation failure for %s : %s",
+                          pending.second.c_str(), failure->second.c_str());
+        }
+    }
+    m_pendingNetdevs.clear();
 }
 
 int VxlanMgr::downVxlanNetdevice(std::string vxlan_dev_name)
 {
     int ret = 0;
     std::string res;
+
+    auto state = m_vxlanNetdevStates.find(vxlan_dev_name);
+    if (state != m_vxlanNetdevStates.end())
+    {
+        if (state->second == NETDEV_STATE_CREATE_PENDING)
+        {
+            flushNetdevBatch();
+        }
+        if (m_vxlanNetdevStates[vxlan_dev_name] == NETDEV_STATE_FAILED)
+        {
+            /* The netdev never made it into the kernel */
+            return ret;
+        }
+    }
+
     const std::string cmd = std::string("") + IP_CMD + " link set dev " + vxlan_dev_name + " down";
     exec(cmd, res);
     return ret;
 }
 
 int VxlanMgr::deleteVxlanNetdevice(std::string vxlan_dev_name)
-{    
+{
     std::string res;
+
+    auto state = m_vxlanNetdevStates.find(vxlan_dev_name);
+    if (state != m_vxlanNetdevStates.end())
+    {
+        if (state->second == NETDEV_STATE_CREATE_PENDING)
+        {
+            flushNetdevBatch();
+        }
+        bool create_failed = (m_vxlanNetdevStates[vxlan_dev_name] == NETDEV_STATE_FAILED);
+        m_vxlanNetdevStates.erase(vxlan_dev_name);
+        if (create_failed)
+        {
+            return RET_SUCCESS;
+        }
+    }
+
     const std::string cmd = std::string("") + IP_CMD  + " link del dev " + vxlan_dev_name;
     return swss::exec(cmd, res);
 }
@@ -1207,6 +1276,7 @@ void VxlanMgr::restoreVxlanNetDevices()
 
         SWSS_LOG_INFO("RESTORE Created Kernel Net Device (%s-%s)", vxlanTunnelName.c_str(), vlan_id.c_str());
     }
+    flushNetdevBatch();
 
     SWSS_LOG_INFO("RESTORE Delete Stale Kernel Net Devices");
     clearAllVxlanDevices();
@@ -4,6 +4,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "shellcmd.h"
 
 #include <map>
 #include <vector>
@@ -70,6 +71,7 @@ private:
     void delAppDBTunnelMapTable(std::string vxlanTunnelMapName);
     int createVxlanNetdevice(std::string vxlanTunnelName, std::string vni_id,
                              std::string src_ip, std::string dst_ip, std::string vlan_id);
+    void flushNetdevBatch();
     int downVxlanNetdevice(std::string vxlan_dev_name);
     int deleteVxlanNetdevice(std::string vxlan_dev_name);
     std::vector<std::string> parseNetDev(const std::string& stdout);
@@ -118,6 +120,22 @@ private:
     bool m_in_reconcile;
     std::vector<std::string> m_appVxlanTunnelMapKeysRecon;
     std::map<std::string, std::string> m_vxlanNetDevices;
+
+    /*
+    * Kernel programming state of the VNI map netdevs. Creations are queued
+    * into m_netdevBatch and executed once per drain by flushNetdevBatch();
+    * the state map lets the deletion path skip kernel calls for devices
+    * that never made it into the kernel.
+    */
+    enum VxlanNetdevState
+    {
+        NETDEV_STATE_CREATE_PENDING,
+        NETDEV_STATE_CREATED,
+        NETDEV_STATE_FAILED
+    };
+    std::map<std::string, VxlanNetdevState> m_vxlanNetdevStates;
+    ShellCmdBatch m_netdevBatch;
+    std::vector<std::pair<size_t, std::string>> m_pendingNetdevs;
 };
 
 }
@@ -24,6 +24,7 @@ using namespace swss;
 FdbSync::FdbSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConnector *config_db) :
     m_fdbTable(pipelineAppDB, APP_VXLAN_FDB_TABLE_NAME),
     m_imetTable(pipelineAppDB, APP_VXLAN_REMOTE_VNI_TABLE_NAME),
+    m_fdbSyncStatsTable(stateDb, "FDB_SYNC_STATS"),
     m_fdbStateTable(stateDb, STATE_FDB_TABLE_NAME),
     m_mclagRemoteFdbStateTable(stateDb, STATE_MCLAG_REMOTE_FDB_TABLE_NAME),
     m_cfgEvpnNvoTable(config_db, CFG_VXLAN_EVPN_NVO_TABLE_NAME)
@@ -641,8 +642,17 @@ void FdbSync::macDelVxlanDB(string key)
         m_AppRestartAssist->insertToMap(APP_VXLAN_FDB_TABLE_NAME, key, fvVector, true);
         return;
     }
-    
-    m_fdbTable.del(key);
+
+    if (m_pendingFdb.find(key) != m_pendingFdb.end())
+    {
+        m_coalescedEvents++;
+    }
+    m_pendingFdb[key] = make_pair(true, std::vector<FieldValueTuple>());
+
+    if (m_pendingFdb.size() >= FDB_AGGREGATE_MAX_PENDING)
+    {
+        flushPendingFdb();
+    }
     return;
 
 }
@@ -672,12 +682,67 @@ void FdbSync::macAddVxlan(string key, struct in_addr vtep, string type, uint32_t
         m_AppRestartAssist->insertToMap(APP_VXLAN_FDB_TABLE_NAME, key, fvVector, false);
         return;
     }
-    
-    m_fdbTable.set(key, fvVector);
+
+    /* A MAC moving between VTEPs within the window keeps only its final
+     * destination; earlier transitions are coalesced away */
+    if (m_pendingFdb.find(key) != m_pendingFdb.end())
+    {
+        m_coalescedEvents++;
+    }
+    m_pendingFdb[key] = make_pair(false, fvVector);
+
+    if (m_pendingFdb.size() >= FDB_AGGREGATE_MAX_PENDING)
+    {
+        flushPendingFdb();
+    }
 
     return;
 }
 
+void FdbSync::flushPendingFdb()
+{
+    if (m_pendingFdb.empty())
+    {
+        return;
+    }
+
+    std::vector<KeyOpFieldsValuesTuple> sets;
+    std::vector<std::string> dels;
+    for (auto &entry : m_pendingFdb)
+    {
+        if (entry.second.first)
+        {
+            dels.push_back(entry.first);
+        }
+        else
+        {
+            sets.emplace_back(entry.first, SET_COMMAND, entry.second.second);
+        }
+    }
+
+    if (!dels.empty())
+    {
+        m_fdbTable.del(dels);
+    }
+    if (!sets.empty())
+    {
+        m_fdbTable.set(sets);
+    }
+
+    m_flushedEvents += m_pendingFdb.size();
+
+    /* Replay-rate gauge: lets sync lag be observed during fabric events */
+    std::vector<FieldValueTuple> fvs;
+    fvs.emplace_back("flushed_entries", to_string(m_flushedEvents));
+    fvs.emplace_back("coalesced_events", to_string(m_coalescedEvents));
+    fvs.emplace_back("last_batch_size", to_string(m_pendingFdb.size()));
+    m_fdbSyncStatsTable.set("VXLAN_FDB", fvs);
+
+    SWSS_LOG_INFO("Flushed %zu MAC route sets, %zu dels, %zu coalesced",
+                  sets.size(), dels.size(), m_coalescedEvents);
+    m_pendingFdb.clear();
+}
+
 void FdbSync::macDelVxlan(string key)
 {
     if (m_mac.find(key) != m_mac.end())
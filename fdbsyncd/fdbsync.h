@@ -16,11 +16,21 @@
 
 /*
  * This is the MAX time in seconds, fdbsyncd will wait after warm-reboot
- * for the interface entries to be recreated in kernel before attempting to 
+ * for the interface entries to be recreated in kernel before attempting to
  * write the FDB data to kernel
  */
 #define INTF_RESTORE_MAX_WAIT_TIME 180
 
+/*
+ * The window (in milliseconds) over which VXLAN FDB events are aggregated
+ * before being flushed to APPL_DB. MAC moves arriving in bursts collapse to
+ * the final VTEP within the window.
+ */
+#define FDB_AGGREGATE_WINDOW_MS 10
+
+/* Flush immediately once this many entries are pending, to bound memory */
+#define FDB_AGGREGATE_MAX_PENDING 1024
+
 namespace swss {
 
 enum FDB_OP_TYPE {
@@ -80,6 +90,13 @@ public:
 
     void processCfgEvpnNvo();
 
+    void flushPendingFdb();
+
+    size_t pendingFdbCount() const
+    {
+        return m_pendingFdb.size();
+    }
+
     bool m_reconcileDone = false;
 
     bool m_isEvpnNvoExist = false;
@@ -87,7 +104,16 @@ public:
 private:
     ProducerStateTable m_fdbTable;
     ProducerStateTable m_imetTable;
+    Table m_fdbSyncStatsTable;
     SubscriberStateTable m_fdbStateTable;
+
+    /* Last transition seen per MAC route within the aggregation window.
+     * A MAC moving through several VTEPs in one window collapses to the
+     * final one; the flush emits vectorized set()/del() calls.
+     */
+    std::map<std::string, std::pair<bool, std::vector<FieldValueTuple>>> m_pendingFdb;
+    size_t m_coalescedEvents = 0;
+    size_t m_flushedEvents = 0;
     SubscriberStateTable m_mclagRemoteFdbStateTable;
     AppRestartAssist  *m_AppRestartAssist;
     SubscriberStateTable m_cfgEvpnNvoTable;
@@ -89,7 +89,18 @@ int main(int argc, char **argv)
             s.addSelectable(sync.getCfgEvpnNvoTable());
             while (true)
             {
-                s.select(&temps);
+                /* Only arm the aggregation timeout while events are pending */
+                ret = s.select(&temps, sync.pendingFdbCount() ? FDB_AGGREGATE_WINDOW_MS : -1);
+                if (ret == Select::TIMEOUT)
+                {
+                    /* Aggregation window elapsed with no new events */
+                    sync.flushPendingFdb();
+                    continue;
+                }
+                else if (ret != Select::OBJECT)
+                {
+                    continue;
+                }
 
                 if (temps == (Selectable *)sync.getFdbStateTable())
                 {
@@ -118,11 +118,16 @@ bool FpmLink::isRawProcessing(struct nlmsghdr *h)
 FpmLink::FpmLink(RouteSync *rsync, unsigned short port) :
     MSG_BATCH_SIZE(256),
     m_bufSize(FPM_MAX_MSG_LEN * MSG_BATCH_SIZE),
-    m_messageBuffer(NULL),
-    m_pos(0),
+    m_fillBuffer(NULL),
+    m_parseBuffer(NULL),
+    m_fillPos(0),
+    m_parseLen(0),
     m_connected(false),
     m_server_up(false),
-    m_routesync(rsync)
+    m_routesync(rsync),
+    m_running(false),
+    m_readError(0),
+    m_eof(false)
 {
     struct sockaddr_in addr = {};
     int true_val = 1;
@@ -162,7 +167,8 @@ FpmLink::FpmLink(RouteSync *rsync, unsigned short port) :
     }
 
     m_server_up = true;
-    m_messageBuffer = new char[m_bufSize];
+    m_fillBuffer = new char[m_bufSize];
+    m_parseBuffer = new char[m_bufSize];
     m_sendBuffer = new char[m_bufSize];
 
     m_routesync->onFpmConnected(*this);
@@ -172,7 +178,20 @@ FpmLink::~FpmLink()
 {
     m_routesync->onFpmDisconnected();
 
-    delete[] m_messageBuffer;
+    if (m_reader.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_running = false;
+        }
+        /* Unblock the reader from ::read() and from waiting for buffer space */
+        shutdown(m_connection_socket, SHUT_RD);
+        m_space.notify_all();
+        m_reader.join();
+    }
+
+    delete[] m_fillBuffer;
+    delete[] m_parseBuffer;
     delete[] m_sendBuffer;
     if (m_connected)
         close(m_connection_socket);
@@ -194,56 +213,123 @@ void FpmLink::accept()
         throw system_error(errno, system_category());
 
     SWSS_LOG_INFO("New connection accepted from: %s\n", inet_ntoa(client_addr.sin_addr));
+
+    m_connected = true;
+    m_running = true;
+    m_reader = std::thread(&FpmLink::readerLoop, this);
 }
 
 int FpmLink::getFd()
 {
-    return m_connection_socket;
+    return m_bufferReady.getFd();
 }
 
-uint64_t FpmLink::readData()
+void FpmLink::readerLoop()
 {
-    fpm_msg_hdr_t *hdr;
-    size_t msg_len;
-    size_t start = 0, left;
-    ssize_t read;
-
-    read = ::read(m_connection_socket, m_messageBuffer + m_pos, m_bufSize - m_pos);
-    if (read == 0)
-        throw FpmConnectionClosedException();
-    if (read < 0)
-        throw system_error(errno, system_category());
-    m_pos+= (uint32_t)read;
-
-    /* Check for complete messages */
     while (true)
     {
-        hdr = reinterpret_cast<fpm_msg_hdr_t *>(static_cast<void *>(m_messageBuffer + start));
-        left = m_pos - start;
-        if (left < FPM_MSG_HDR_LEN)
+        ssize_t read = ::read(m_connection_socket, m_fillBuffer + m_fillPos, m_bufSize - m_fillPos);
+        if (read <= 0)
         {
-            break;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_eof = (read == 0);
+            m_readError = (read < 0) ? errno : 0;
+            m_bufferReady.notify();
+            return;
         }
+        m_fillPos += (uint32_t)read;
 
-        /* fpm_msg_len includes header size */
-        msg_len = fpm_msg_len(hdr);
-        if (left < msg_len)
+        /* Find the boundary of the last complete FPM frame */
+        size_t complete = 0;
+        while (m_fillPos - complete >= FPM_MSG_HDR_LEN)
         {
-            break;
+            fpm_msg_hdr_t *hdr = reinterpret_cast<fpm_msg_hdr_t *>(
+                    static_cast<void *>(m_fillBuffer + complete));
+            if (!fpm_msg_hdr_ok(hdr))
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_readError = EBADMSG;
+                m_bufferReady.notify();
+                return;
+            }
+            /* fpm_msg_len includes header size */
+            size_t msg_len = fpm_msg_len(hdr);
+            if (m_fillPos - complete < msg_len)
+            {
+                break;
+            }
+            complete += msg_len;
         }
 
-        if (!fpm_msg_ok(hdr, left))
+        if (complete == 0)
         {
-            throw system_error(make_error_code(errc::bad_message), "Malformed FPM message received");
+            continue;
         }
 
-        processFpmMessage(hdr);
+        /* Hand the complete frames to the parser: swap buffers, keep the
+         * partial tail at the head of the new fill buffer. Wait only when
+         * the parser still owns the other buffer. */
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_space.wait(lock, [&]{ return m_parseLen == 0 || !m_running; });
+        if (!m_running)
+        {
+            return;
+        }
+        std::swap(m_fillBuffer, m_parseBuffer);
+        m_parseLen = (uint32_t)complete;
+        memcpy(m_fillBuffer, m_parseBuffer + complete, m_fillPos - complete);
+        m_fillPos -= (uint32_t)complete;
+        lock.unlock();
 
-        start += msg_len;
+        m_bufferReady.notify();
     }
+}
 
-    memmove(m_messageBuffer, m_messageBuffer + start, m_pos - start);
-    m_pos = m_pos - (uint32_t)start;
+uint64_t FpmLink::readData()
+{
+    m_bufferReady.readData();
+
+    unsigned int len;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        len = m_parseLen;
+    }
+
+    if (len != 0)
+    {
+        /* The reader only hands over whole frames, so no remainder handling */
+        size_t start = 0;
+        while (start < len)
+        {
+            fpm_msg_hdr_t *hdr = reinterpret_cast<fpm_msg_hdr_t *>(
+                    static_cast<void *>(m_parseBuffer + start));
+            if (!fpm_msg_ok(hdr, len - start))
+            {
+                throw system_error(make_error_code(errc::bad_message), "Malformed FPM message received");
+            }
+            processFpmMessage(hdr);
+            start += fpm_msg_len(hdr);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_parseLen = 0;
+        }
+        m_space.notify_one();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_parseLen == 0)
+    {
+        if (m_eof)
+            throw FpmConnectionClosedException();
+        if (m_readError != 0)
+        {
+            if (m_readError == EBADMSG)
+                throw system_error(make_error_code(errc::bad_message), "Malformed FPM message received");
+            throw system_error(m_readError, system_category());
+        }
+    }
     return 0;
 }
 
@@ -9,7 +9,12 @@
 #include <errno.h>
 #include <assert.h>
 #include <unistd.h>
+#include <condition_variable>
 #include <exception>
+#include <mutex>
+#include <thread>
+
+#include <swss/selectableevent.h>
 
 #include "fpm/fpm.h"
 #include "fpmsyncd/fpminterface.h"
@@ -30,9 +35,17 @@ public:
     FpmLink(RouteSync *rsync, unsigned short port = FPM_DEFAULT_PORT);
     virtual ~FpmLink();
 
-    /* Wait for connection (blocking) */
+    /* Wait for connection (blocking); starts the FPM reader thread */
     void accept();
 
+    /*
+     * The FPM socket is drained by a dedicated reader thread into one
+     * buffer while RouteSync parses the other, so zebra's FPM writes are
+     * never blocked behind route parsing. The selectable fd is therefore
+     * the buffer-ready event, not the socket itself: readData() swaps in
+     * the filled buffer, parses it and returns the empty one to the
+     * reader.
+     */
     int getFd() override;
     uint64_t readData() override;
     /* readMe throws FpmConnectionClosedException when connection is lost */
@@ -51,16 +64,29 @@ public:
     bool send(nlmsghdr* nl_hdr) override;
 
 private:
+    /* Reader thread body: drain the socket and hand over complete frames */
+    void readerLoop();
+
     RouteSync *m_routesync;
     unsigned int m_bufSize;
-    char *m_messageBuffer;
+    char *m_fillBuffer;     /* owned by the reader thread */
+    char *m_parseBuffer;    /* owned by the parser while m_parseLen != 0 */
     char *m_sendBuffer;
-    unsigned int m_pos;
+    unsigned int m_fillPos;
+    unsigned int m_parseLen;
 
     bool m_connected;
     bool m_server_up;
     int m_server_socket;
     int m_connection_socket;
+
+    std::thread m_reader;
+    std::mutex m_mutex;
+    std::condition_variable m_space;
+    swss::SelectableEvent m_bufferReady;
+    bool m_running;
+    int m_readError;        /* errno reported by the reader thread */
+    bool m_eof;
 };
 
 }
@@ -1,5 +1,6 @@
 #include <iostream>
 #include <inttypes.h>
+#include <signal.h>
 #include <sys/stat.h>
 #include "logger.h"
 #include "routesync.h"
@@ -50,6 +51,19 @@ const uint32_t DEFAULT_ROUTING_RESTART_INTERVAL = 120;
 // TODO: support eoiu hold interval config
 const uint32_t DEFAULT_EOIU_HOLD_INTERVAL = 3;
 
+static bool received_sigterm = false;
+static struct sigaction old_sigaction;
+
+static void sig_handler(int signo)
+{
+    if (old_sigaction.sa_handler != SIG_IGN && old_sigaction.sa_handler != SIG_DFL) {
+        old_sigaction.sa_handler(signo);
+    }
+
+    received_sigterm = true;
+    return;
+}
+
 // Check if eoiu state reached by both ipv4 and ipv6
 static bool eoiuFlagsSet(Table &bgpStateTable)
 {
@@ -109,6 +123,15 @@ int main(int argc, char **argv)
     rtnl_route_read_protocol_names(routeProtoFilePath);
     nlmsg_set_default_size(FPM_MAX_MSG_LEN);
 
+    /* Register the signal handler for SIGTERM */
+    struct sigaction sigact = {};
+    sigact.sa_handler = sig_handler;
+    if (sigaction(SIGTERM, &sigact, &old_sigaction))
+    {
+        SWSS_LOG_ERROR("failed to setup SIGTERM action handler");
+        exit(EXIT_FAILURE);
+    }
+
     std::string suppressionEnabledStr;
     deviceMetadataTable.hget("localhost", "suppress-fib-pending", suppressionEnabledStr);
     if (suppressionEnabledStr == "enabled")
@@ -117,7 +140,7 @@ int main(int argc, char **argv)
         sync.setSuppressionEnabled(true);
     }
 
-    while (true)
+    while (!received_sigterm)
     {
         try
         {
@@ -185,13 +208,18 @@ int main(int argc, char **argv)
 
             gSelectTimeout = INFINITE;
 
-            while (true)
+            while (!received_sigterm)
             {
                 Selectable *temps;
 
                 /* Reading FPM messages forever (and calling "readMe" to read them) */
                 s.select(&temps, gSelectTimeout);
 
+                if (received_sigterm)
+                {
+                    break;
+                }
+
                 /*
                  * Upon expiration of the warm-restart timer or eoiu Hold Timer, proceed to run the
                  * reconciliation process if not done yet and remove the timer from
@@ -329,7 +357,16 @@ int main(int argc, char **argv)
         }
     }
 
-    return 1;
+    /*
+     * Pre-shutdown window: flush whatever is pending and snapshot the
+     * current route view, so the restarting instance can skip the
+     * full-table redis read during restoration.
+     */
+    pipeline.flush();
+    sync.getWarmStartHelper().dumpSnapshot();
+    SWSS_LOG_NOTICE("Received SIGTERM, exiting.");
+
+    return 0;
 }
 
 void flushPipeline(RedisPipeline& pipeline) {
@@ -1000,54 +1000,55 @@ bool RouteSync::getSrv6VpnRouteNextHop(struct nlmsghdr *h, int received_bytes,
 vector<FieldValueTuple>
 RouteTableFieldValueTupleWrapper::fieldValueTupleVector() {
     vector<FieldValueTuple> fvVector;
+    fvVector.reserve(11);
     // If Northbound ZMQ is enabled, simply send all the fields even if the value is
     // empty. The duplication of code between ZMQ and non-ZMQ is deliberate. This way
     // for the ZMQ case we can avoid an if check for every field attribute.
     if(nbZmqEnabled) {
-        fvVector.push_back(FieldValueTuple("protocol", protocol.c_str()));
-        fvVector.push_back(FieldValueTuple("blackhole", blackhole.c_str()));
-        fvVector.push_back(FieldValueTuple("nexthop", nexthop.c_str()));
-        fvVector.push_back(FieldValueTuple("ifname", ifname.c_str()));
-        fvVector.push_back(FieldValueTuple("nexthop_group", nexthop_group.c_str()));
-        fvVector.push_back(FieldValueTuple("mpls_nh", mpls_nh.c_str()));
-        fvVector.push_back(FieldValueTuple("weight", weight.c_str()));
-        fvVector.push_back(FieldValueTuple("vni_label", vni_label.c_str()));
-        fvVector.push_back(FieldValueTuple("router_mac", router_mac.c_str()));
-        fvVector.push_back(FieldValueTuple("segment", segment.c_str()));
-        fvVector.push_back(FieldValueTuple("seg_src", seg_src.c_str()));
+        fvVector.emplace_back("protocol", std::move(protocol));
+        fvVector.emplace_back("blackhole", std::move(blackhole));
+        fvVector.emplace_back("nexthop", std::move(nexthop));
+        fvVector.emplace_back("ifname", std::move(ifname));
+        fvVector.emplace_back("nexthop_group", std::move(nexthop_group));
+        fvVector.emplace_back("mpls_nh", std::move(mpls_nh));
+        fvVector.emplace_back("weight", std::move(weight));
+        fvVector.emplace_back("vni_label", std::move(vni_label));
+        fvVector.emplace_back("router_mac", std::move(router_mac));
+        fvVector.emplace_back("segment", std::move(segment));
+        fvVector.emplace_back("seg_src", std::move(seg_src));
     } else {
         if (protocol != string()) {
-            fvVector.push_back(FieldValueTuple("protocol", protocol.c_str()));
+            fvVector.emplace_back("protocol", std::move(protocol));
         }
         if (blackhole != string("false")) {
-            fvVector.push_back(FieldValueTuple("blackhole", blackhole.c_str()));
+            fvVector.emplace_back("blackhole", std::move(blackhole));
         }
         if (nexthop != string()) {
-            fvVector.push_back(FieldValueTuple("nexthop", nexthop.c_str()));
+            fvVector.emplace_back("nexthop", std::move(nexthop));
         }
         if (ifname != string()) {
-            fvVector.push_back(FieldValueTuple("ifname", ifname.c_str()));
+            fvVector.emplace_back("ifname", std::move(ifname));
         }
         if (nexthop_group != string()) {
-            fvVector.push_back(FieldValueTuple("nexthop_group", nexthop_group.c_str()));
+            fvVector.emplace_back("nexthop_group", std::move(nexthop_group));
         }
         if (mpls_nh != string()) {
-            fvVector.push_back(FieldValueTuple("mpls_nh", mpls_nh.c_str()));
+            fvVector.emplace_back("mpls_nh", std::move(mpls_nh));
         }
         if (weight != string()) {
-            fvVector.push_back(FieldValueTuple("weight", weight.c_str()));
+            fvVector.emplace_back("weight", std::move(weight));
         }
         if (vni_label != string()) {
-            fvVector.push_back(FieldValueTuple("vni_label", vni_label.c_str()));
+            fvVector.emplace_back("vni_label", std::move(vni_label));
         }
         if (router_mac != string()) {
-            fvVector.push_back(FieldValueTuple("router_mac", router_mac.c_str()));
+            fvVector.emplace_back("router_mac", std::move(router_mac));
         }
         if (segment != string()) {
-            fvVector.push_back(FieldValueTuple("segment", segment.c_str()));
+            fvVector.emplace_back("segment", std::move(segment));
         }
         if (seg_src != string()) {
-            fvVector.push_back(FieldValueTuple("seg_src", seg_src.c_str()));
+            fvVector.emplace_back("seg_src", std::move(seg_src));
         }
     }
     // Return value optimization will avoid copy of the following vector
@@ -1059,34 +1060,35 @@ RouteTableFieldValueTupleWrapper::fieldValueTupleVector() {
 vector<FieldValueTuple>
 LabelRouteTableFieldValueTupleWrapper::fieldValueTupleVector() {
     vector<FieldValueTuple> fvVector;
+    fvVector.reserve(6);
     // If Northbound ZMQ is enabled, simply send all the fields even if the value is
     // empty. The duplication of code between ZMQ and non-ZMQ is deliberate. This way
     // for the ZMQ case we can avoid an if check for every field attribute.
     if(nbZmqEnabled) {
-        fvVector.push_back(FieldValueTuple("protocol", protocol.c_str()));
-        fvVector.push_back(FieldValueTuple("blackhole", blackhole.c_str()));
-        fvVector.push_back(FieldValueTuple("nexthop", nexthop.c_str()));
-        fvVector.push_back(FieldValueTuple("ifname", ifname.c_str()));
-        fvVector.push_back(FieldValueTuple("mpls_nh", mpls_nh.c_str()));
-        fvVector.push_back(FieldValueTuple("mpls_pop", mpls_pop.c_str()));
+        fvVector.emplace_back("protocol", std::move(protocol));
+        fvVector.emplace_back("blackhole", std::move(blackhole));
+        fvVector.emplace_back("nexthop", std::move(nexthop));
+        fvVector.emplace_back("ifname", std::move(ifname));
+        fvVector.emplace_back("mpls_nh", std::move(mpls_nh));
+        fvVector.emplace_back("mpls_pop", std::move(mpls_pop));
     } else {
         if (protocol != string()) {
-            fvVector.push_back(FieldValueTuple("protocol", protocol.c_str()));
+            fvVector.emplace_back("protocol", std::move(protocol));
         }
         if (blackhole != string("false")) {
-            fvVector.push_back(FieldValueTuple("blackhole", blackhole.c_str()));
+            fvVector.emplace_back("blackhole", std::move(blackhole));
         }
         if (nexthop != string()) {
-            fvVector.push_back(FieldValueTuple("nexthop", nexthop.c_str()));
+            fvVector.emplace_back("nexthop", std::move(nexthop));
         }
         if (ifname != string()) {
-            fvVector.push_back(FieldValueTuple("ifname", ifname.c_str()));
+            fvVector.emplace_back("ifname", std::move(ifname));
         }
         if (mpls_nh != string()) {
-            fvVector.push_back(FieldValueTuple("mpls_nh", mpls_nh.c_str()));
+            fvVector.emplace_back("mpls_nh", std::move(mpls_nh));
         }
         if (mpls_pop != string()) {
-            fvVector.push_back(FieldValueTuple("mpls_pop", mpls_pop.c_str()));
+            fvVector.emplace_back("mpls_pop", std::move(mpls_pop));
         }
     }
     return fvVector;
@@ -1097,18 +1099,19 @@ LabelRouteTableFieldValueTupleWrapper::fieldValueTupleVector() {
 vector<FieldValueTuple>
 VnetRouteTableFieldValueTupleWrapper::fieldValueTupleVector() {
     vector<FieldValueTuple> fvVector;
+    fvVector.reserve(2);
     // If Northbound ZMQ is enabled, simply send all the fields even if the value is
     // empty. The duplication of code between ZMQ and non-ZMQ is deliberate. This way
     // for the ZMQ case we can avoid an if check for every field attribute.
     if(nbZmqEnabled) {
-        fvVector.push_back(FieldValueTuple("nexthop", nexthop.c_str()));
-        fvVector.push_back(FieldValueTuple("ifname", ifname.c_str()));
+        fvVector.emplace_back("nexthop", std::move(nexthop));
+        fvVector.emplace_back("ifname", std::move(ifname));
     } else {
         if (nexthop != string()) {
-            fvVector.push_back(FieldValueTuple("nexthop", nexthop.c_str()));
+            fvVector.emplace_back("nexthop", std::move(nexthop));
         }
         if (ifname != string()) {
-            fvVector.push_back(FieldValueTuple("ifname", ifname.c_str()));
+            fvVector.emplace_back("ifname", std::move(ifname));
         }
     }
     return fvVector;
@@ -1119,14 +1122,15 @@ VnetRouteTableFieldValueTupleWrapper::fieldValueTupleVector() {
 vector<FieldValueTuple>
 VnetTunnelTableFieldValueTupleWrapper::fieldValueTupleVector() {
     vector<FieldValueTuple> fvVector;
+    fvVector.reserve(1);
     // If Northbound ZMQ is enabled, simply send all the fields even if the value is
     // empty. The duplication of code between ZMQ and non-ZMQ is deliberate. This way
     // for the ZMQ case we can avoid an if check for every field attribute.
     if(nbZmqEnabled) {
-        fvVector.push_back(FieldValueTuple("endpoint", endpoint.c_str()));
+        fvVector.emplace_back("endpoint", std::move(endpoint));
     } else {
         if (endpoint != string()) {
-            fvVector.push_back(FieldValueTuple("endpoint", endpoint.c_str()));
+            fvVector.emplace_back("endpoint", std::move(endpoint));
         }
     }
     return fvVector;
@@ -1137,22 +1141,23 @@ VnetTunnelTableFieldValueTupleWrapper::fieldValueTupleVector() {
 vector<FieldValueTuple>
 NextHopGroupTableFieldValueTupleWrapper::fieldValueTupleVector() {
     vector<FieldValueTuple> fvVector;
+    fvVector.reserve(3);
     // If Northbound ZMQ is enabled, simply send all the fields even if the value is
     // empty. The duplication of code between ZMQ and non-ZMQ is deliberate. This way
     // for the ZMQ case we can avoid an if check for every field attribute.
     if(nbZmqEnabled) {
-        fvVector.push_back(FieldValueTuple("nexthop", nexthop.c_str()));
-        fvVector.push_back(FieldValueTuple("ifname", ifname.c_str()));
-        fvVector.push_back(FieldValueTuple("weight", weight.c_str()));
+        fvVector.emplace_back("nexthop", std::move(nexthop));
+        fvVector.emplace_back("ifname", std::move(ifname));
+        fvVector.emplace_back("weight", std::move(weight));
     } else {
         if (nexthop != string()) {
-            fvVector.push_back(FieldValueTuple("nexthop", nexthop.c_str()));
+            fvVector.emplace_back("nexthop", std::move(nexthop));
         }
         if (ifname != string()) {
-            fvVector.push_back(FieldValueTuple("ifname", ifname.c_str()));
+            fvVector.emplace_back("ifname", std::move(ifname));
         }
         if (weight != string()) {
-            fvVector.push_back(FieldValueTuple("weight", weight.c_str()));
+            fvVector.emplace_back("weight", std::move(weight));
         }
     }
     return fvVector;
@@ -1163,22 +1168,23 @@ NextHopGroupTableFieldValueTupleWrapper::fieldValueTupleVector() {
 vector<FieldValueTuple>
 Srv6MySidTableFieldValueTupleWrapper::fieldValueTupleVector() {
     vector<FieldValueTuple> fvVector;
+    fvVector.reserve(3);
     // If Northbound ZMQ is enabled, simply send all the fields even if the value is
     // empty. The duplication of code between ZMQ and non-ZMQ is deliberate. This way
     // for the ZMQ case we can avoid an if check for every field attribute.
     if(nbZmqEnabled) {
-        fvVector.push_back(FieldValueTuple("action", action.c_str()));
-        fvVector.push_back(FieldValueTuple("vrf", vrf.c_str()));
-        fvVector.push_back(FieldValueTuple("adj", adj.c_str()));
+        fvVector.emplace_back("action", std::move(action));
+        fvVector.emplace_back("vrf", std::move(vrf));
+        fvVector.emplace_back("adj", std::move(adj));
     } else {
         if (action != string()) {
-            fvVector.push_back(FieldValueTuple("action", action.c_str()));
+            fvVector.emplace_back("action", std::move(action));
         }
         if (vrf != string()) {
-            fvVector.push_back(FieldValueTuple("vrf", vrf.c_str()));
+            fvVector.emplace_back("vrf", std::move(vrf));
         }
         if (adj != string()) {
-            fvVector.push_back(FieldValueTuple("adj", adj.c_str()));
+            fvVector.emplace_back("adj", std::move(adj));
         }
     }
     return fvVector;
@@ -1189,14 +1195,15 @@ Srv6MySidTableFieldValueTupleWrapper::fieldValueTupleVector() {
 vector<FieldValueTuple>
 Srv6SidListTableFieldValueTupleWrapper::fieldValueTupleVector() {
     vector<FieldValueTuple> fvVector;
+    fvVector.reserve(1);
     // If Northbound ZMQ is enabled, simply send all the fields even if the value is
     // empty. The duplication of code between ZMQ and non-ZMQ is deliberate. This way
     // for the ZMQ case we can avoid an if check for every field attribute.
     if(nbZmqEnabled) {
-        fvVector.push_back(FieldValueTuple("path", path.c_str()));
+        fvVector.emplace_back("path", std::move(path));
     } else {
         if (path != string()) {
-            fvVector.push_back(FieldValueTuple("path", path.c_str()));
+            fvVector.emplace_back("path", std::move(path));
         }
     }
     return fvVector;
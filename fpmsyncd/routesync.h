@@ -67,6 +67,11 @@ class FieldValueTupleWrapperBase {
         : key(std::move(_key)), nbZmqEnabled(_nbZmqEnabled) {}
     virtual ~FieldValueTupleWrapperBase() = default;
 
+    /* Consumes the wrapper: the field members are moved into the returned
+     * tuples rather than copied, so call this at most once per message.
+     * string_views over the netlink buffer cannot survive the swss-common
+     * API boundary (FieldValueTuple owns std::string), so moving the
+     * already-built strings is the closest we get to zero-copy here. */
     virtual vector<FieldValueTuple> fieldValueTupleVector() = 0;
 
     vector<KeyOpFieldsValuesTuple> KeyOpFieldsValuesTupleVector() {
@@ -78,17 +83,17 @@ class FieldValueTupleWrapperBase {
         // then we would like to atomically cleanup earlier fields and set the new
         // fields in the hash-set in redis.
         vector<KeyOpFieldsValuesTuple> kfvVector;
+        kfvVector.reserve(nbZmqEnabled ? 1 : 2);
         if(!nbZmqEnabled) {
-            kfvVector.push_back(KeyOpFieldsValuesTuple {key.c_str(), "DEL", {}});
+            kfvVector.emplace_back(key, "DEL", vector<FieldValueTuple>{});
         }
-        auto fvVector = fieldValueTupleVector();
-        kfvVector.push_back(KeyOpFieldsValuesTuple {key.c_str(), "SET", fvVector});
+        kfvVector.emplace_back(key, "SET", fieldValueTupleVector());
         return kfvVector;
     }
 
     // For DEL-only operations with warm restart support
     KeyOpFieldsValuesTuple KeyOpFieldsValuesTupleVectorForDel() {
-        return KeyOpFieldsValuesTuple {key.c_str(), "DEL", {}};
+        return KeyOpFieldsValuesTuple {key, "DEL", {}};
     }
 
     string key = string();
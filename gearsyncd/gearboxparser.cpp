@@ -17,6 +17,8 @@
 #include "gearboxparser.h"
 #include "gearboxutils.h"
 #include "phyparser.h"
+#include <thread>
+#include <utility>
 #include <vector>
 
 void GearboxParser::notifyGearboxConfigDone(bool success)
@@ -47,6 +49,9 @@ bool GearboxParser::parse()
 
     std::vector<swss::FieldValueTuple> attrs;
 
+    /* phy_id/config_file pairs collected for the parallel phy apply phase */
+    std::vector<std::pair<int, std::string>> phyConfigs;
+
     try 
     {
         phys = root["phys"];
@@ -178,22 +183,45 @@ bool GearboxParser::parse()
             {
                 writeToDb(key, attrs);
             }
+            phyConfigs.push_back(std::make_pair(phyId, cfgFile));
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("unable to read 'phys' item %d in gearbox configuration (invalid format)", iter);
+            return false;
+        }
+    }
+
+    /*
+     * Parse and apply each phy's config concurrently; phys are independent
+     * and every PhyParser owns a private DB connection, so the per-phy
+     * contexts do not share any state.
+     */
+    std::vector<std::thread> phyWorkers;
+    std::vector<int> phyResults(phyConfigs.size(), 0);
+    for (size_t i = 0; i < phyConfigs.size(); i++)
+    {
+        phyWorkers.emplace_back([this, i, &phyConfigs, &phyResults]()
+        {
             PhyParser p;
-            p.setPhyId(phyId);
+            p.setPhyId(phyConfigs[i].first);
             p.setWriteToDb(getWriteToDb());
-            p.setConfigPath(cfgFile);
-            if (p.parse() == false) 
-            {
-                SWSS_LOG_ERROR("phy parser failed to parse item %d in gearbox configuration", iter);
-                return false;
-            }
-        } 
-        catch (const std::exception& e) 
+            p.setConfigPath(phyConfigs[i].second);
+            phyResults[i] = p.parse() ? 1 : 0;
+        });
+    }
+    for (auto &worker : phyWorkers)
+    {
+        worker.join();
+    }
+    for (size_t i = 0; i < phyResults.size(); i++)
+    {
+        if (phyResults[i] == 0)
         {
-            SWSS_LOG_ERROR("unable to read 'phys' item %d in gearbox configuration (invalid format)", iter);
+            SWSS_LOG_ERROR("phy parser failed to parse phy %d in gearbox configuration", phyConfigs[i].first);
             return false;
         }
-    } 
+    }
 
     if (root.find("interfaces") != root.end()) 
     {
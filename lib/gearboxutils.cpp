@@ -208,6 +208,26 @@ std::map<int, gearbox_phy_t> GearboxUtils::loadPhyMap(Table *gearboxTable)
     return gearboxPhyMap;
 }
 
+gearbox_phy_t *GearboxUtils::getPhy(Table *gearboxTable, int phy_id)
+{
+    SWSS_LOG_ENTER();
+
+    // the phy map is loaded once and then indexed by phy id
+    if (gearboxPhyMap.empty())
+    {
+        loadPhyMap(gearboxTable);
+    }
+
+    auto phy = gearboxPhyMap.find(phy_id);
+    if (phy == gearboxPhyMap.end())
+    {
+        SWSS_LOG_ERROR("PHY %d not found in Gearbox records!", phy_id);
+        return nullptr;
+    }
+
+    return &phy->second;
+}
+
 std::map<int, gearbox_interface_t> GearboxUtils::loadInterfaceMap(Table *gearboxTable)
 {
     std::vector<FieldValueTuple> ovalues;
@@ -125,6 +125,7 @@ class GearboxUtils
         bool isGearboxConfigDone(Table *gearboxTable);
         bool isGearboxEnabled(Table *gearboxTable);
         std::map<int, gearbox_phy_t> loadPhyMap(Table *gearboxTable);
+        gearbox_phy_t *getPhy(Table *gearboxTable, int phy_id);
         std::map<int, gearbox_interface_t> loadInterfaceMap(Table *gearboxTable);
         std::map<int, gearbox_lane_t> loadLaneMap(Table *gearboxTable);
         std::map<int, gearbox_port_t> loadPortMap(Table *gearboxTable);
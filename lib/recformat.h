@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+
+namespace swss {
+
+/*
+ * On-disk layout of the binary recording format.
+ *
+ * Data file: one RecBinFileHeader, then a stream of records, each being a
+ * RecBinRecordHeader followed by the payload bytes (the record line without
+ * its timestamp, which lives in the header as epoch microseconds).
+ *
+ * Index sidecar (<data file>.idx): one RecBinFileHeader, then a fixed-size
+ * RecBinIndexEntry for every RECBIN_INDEX_STRIDE-th record, so a replay
+ * tool can binary-search a time range and seek straight to it instead of
+ * scanning the whole recording.
+ */
+
+constexpr uint32_t RECBIN_MAGIC = 0x43455253;   /* "SREC" */
+constexpr uint32_t RECBIN_VERSION = 1;
+constexpr uint32_t RECBIN_INDEX_STRIDE = 1024;
+
+struct RecBinFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+};
+
+struct RecBinRecordHeader
+{
+    uint32_t length;     /* payload bytes following this header */
+    uint32_t reserved;
+    uint64_t timestamp;  /* epoch microseconds */
+};
+
+struct RecBinIndexEntry
+{
+    uint64_t timestamp;  /* timestamp of the record at 'offset' */
+    uint64_t offset;     /* byte offset of that record's header in the data file */
+};
+
+}
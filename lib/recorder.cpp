@@ -1,6 +1,7 @@
 #include "recorder.h"
 #include "timestamp.h"
 #include "logger.h"
+#include <chrono>
 #include <cstring>
 #include <inttypes.h>
 #include <unistd.h>
@@ -388,16 +389,47 @@ void RecWriter::startRec(bool exit_if_failure)
             setRecord(false);
         }
     }
-    record_ofs << swss::getTimestamp() << Recorder::REC_START << std::endl;
+
+    if (isBinary())
+    {
+        index_ofs.open(fname + ".idx", std::ofstream::out | std::ofstream::app);
+        if (!index_ofs.is_open())
+        {
+            SWSS_LOG_ERROR("%s Recorder: Failed to open index file %s.idx: error %s",
+                           getName().c_str(), fname.c_str(), strerror(errno));
+            record_ofs.close();
+            if (exit_if_failure)
+            {
+                exit(EXIT_FAILURE);
+            }
+            else
+            {
+                setRecord(false);
+                return;
+            }
+        }
+        writeBinaryFileHeader(record_ofs);
+        writeBinaryFileHeader(index_ofs);
+        recordBinary(Recorder::REC_START);
+    }
+    else
+    {
+        record_ofs << swss::getTimestamp() << Recorder::REC_START << std::endl;
+    }
     SWSS_LOG_NOTICE("%s Recorder: Recording started at %s", getName().c_str(), fname.c_str());
 }
 
 
 RecWriter::~RecWriter()
 {
+    stopRingFlusher();
     if (record_ofs.is_open())
     {
-        record_ofs.close();      
+        record_ofs.close();
+    }
+    if (index_ofs.is_open())
+    {
+        index_ofs.close();
     }
 }
 
@@ -413,6 +445,28 @@ void RecWriter::record(const std::string& timestamp, const std::string& val)
     {
         return ;
     }
+
+    if (isBinary())
+    {
+        if (isRotate())
+        {
+            setRotate(false);
+            logfileReopen();
+        }
+        recordBinary(val);
+        return;
+    }
+
+    if (m_ringEnabled.load(std::memory_order_relaxed))
+    {
+        /* Preformat once; the flusher only has to write the line out */
+        if (!ringPush(timestamp + "|" + val))
+        {
+            m_ringDropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+    }
+
     if (isRotate())
     {
         setRotate(false);
@@ -422,6 +476,144 @@ void RecWriter::record(const std::string& timestamp, const std::string& val)
 }
 
 
+void RecWriter::setRingMode(bool enabled)
+{
+    if (enabled == m_ringEnabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    if (enabled)
+    {
+        if (m_ring.empty())
+        {
+            m_ring = std::vector<RingCell>(RING_CAPACITY);
+            for (size_t i = 0; i < RING_CAPACITY; i++)
+            {
+                m_ring[i].seq.store(i, std::memory_order_relaxed);
+            }
+        }
+        m_ringShutdown.store(false, std::memory_order_relaxed);
+        m_flusher = std::thread(&RecWriter::ringFlusher, this);
+        m_ringEnabled.store(true, std::memory_order_release);
+        SWSS_LOG_NOTICE("%s Recorder: ring buffering enabled, capacity %zu",
+                        getName().c_str(), RING_CAPACITY);
+    }
+    else
+    {
+        /* New records go back to the synchronous path right away */
+        m_ringEnabled.store(false, std::memory_order_release);
+        stopRingFlusher();
+    }
+}
+
+
+/*
+ * Claim a cell with a CAS on the head counter and publish the line by
+ * bumping the cell's sequence number. Producers never take a lock and
+ * never wait on the flusher: a full ring fails the push instead.
+ */
+bool RecWriter::ringPush(std::string&& line)
+{
+    uint64_t pos = m_ringHead.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        RingCell &cell = m_ring[pos & (RING_CAPACITY - 1)];
+        uint64_t seq = cell.seq.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0)
+        {
+            if (m_ringHead.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.line = std::move(line);
+                cell.seq.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = m_ringHead.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+
+/* Flusher-thread only: consume the next published cell, if any */
+bool RecWriter::ringPop(std::string& line)
+{
+    RingCell &cell = m_ring[m_ringTail & (RING_CAPACITY - 1)];
+    uint64_t seq = cell.seq.load(std::memory_order_acquire);
+
+    if ((intptr_t)seq - (intptr_t)(m_ringTail + 1) < 0)
+    {
+        return false;
+    }
+
+    line = std::move(cell.line);
+    cell.seq.store(m_ringTail + RING_CAPACITY, std::memory_order_release);
+    m_ringTail++;
+    return true;
+}
+
+
+void RecWriter::ringFlusher()
+{
+    std::string line;
+
+    for (;;)
+    {
+        bool wrote = false;
+
+        while (ringPop(line))
+        {
+            if (isRotate())
+            {
+                setRotate(false);
+                logfileReopen();
+            }
+            record_ofs << line << '\n';
+            wrote = true;
+        }
+        if (wrote)
+        {
+            record_ofs.flush();
+        }
+
+        if (m_ringShutdown.load(std::memory_order_acquire))
+        {
+            /* Drained above after the flag was set: nothing can be left behind */
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(RING_FLUSH_INTERVAL_MS));
+    }
+}
+
+
+void RecWriter::stopRingFlusher()
+{
+    if (!m_flusher.joinable())
+    {
+        return;
+    }
+
+    m_ringShutdown.store(true, std::memory_order_release);
+    m_flusher.join();
+
+    uint64_t dropped = m_ringDropped.exchange(0, std::memory_order_relaxed);
+    if (dropped != 0)
+    {
+        SWSS_LOG_NOTICE("%s Recorder: ring overflow dropped %" PRIu64 " records",
+                        getName().c_str(), dropped);
+    }
+}
+
+
 void RecWriter::logfileReopen()
 {
     /*
@@ -437,5 +629,59 @@ void RecWriter::logfileReopen()
         SWSS_LOG_ERROR("%s Recorder: Failed to open file %s: %s", getName().c_str(), fname.c_str(), strerror(errno));
         return;
     }
+
+    if (isBinary())
+    {
+        index_ofs.close();
+        index_ofs.open(fname + ".idx", std::ofstream::out | std::ofstream::app);
+        if (!index_ofs.is_open())
+        {
+            SWSS_LOG_ERROR("%s Recorder: Failed to open index file %s.idx: %s",
+                           getName().c_str(), fname.c_str(), strerror(errno));
+            return;
+        }
+        writeBinaryFileHeader(record_ofs);
+        writeBinaryFileHeader(index_ofs);
+    }
     SWSS_LOG_INFO("%s Recorder: LogRotate request handled", getName().c_str());
 }
+
+
+/* Stamp the format header on a freshly rotated (i.e. empty) file only */
+void RecWriter::writeBinaryFileHeader(std::ofstream& ofs)
+{
+    if (ofs.tellp() != std::streampos(0))
+    {
+        return;
+    }
+
+    RecBinFileHeader header = { RECBIN_MAGIC, RECBIN_VERSION };
+    ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    if (&ofs == &record_ofs)
+    {
+        m_binRecords = 0;
+    }
+}
+
+
+void RecWriter::recordBinary(const std::string& val)
+{
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+
+    RecBinRecordHeader header = {};
+    header.length = (uint32_t)val.size();
+    header.timestamp = (uint64_t)tv.tv_sec * 1000000ULL + (uint64_t)tv.tv_usec;
+
+    if (m_binRecords % RECBIN_INDEX_STRIDE == 0)
+    {
+        RecBinIndexEntry entry = { header.timestamp, (uint64_t)record_ofs.tellp() };
+        index_ofs.write(reinterpret_cast<const char *>(&entry), sizeof(entry));
+        index_ofs.flush();
+    }
+    m_binRecords++;
+
+    record_ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    record_ofs.write(val.data(), (std::streamsize)val.size());
+}
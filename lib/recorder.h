@@ -2,6 +2,7 @@
 
 #include <string>
 #include <fstream>
+#include <vector>
 #include <iostream>
 #include <sstream>
 #include <memory>
@@ -14,6 +15,7 @@
 #include <sys/time.h>
 
 #include "table.h"
+#include "recformat.h"
 
 namespace swss {
 
@@ -50,12 +52,60 @@ public:
     void record(const std::string& val);
     void record(const std::string& timestamp, const std::string& val);
 
+    /*
+     * Ring mode turns record() into a wait-free enqueue of the already
+     * formatted line into a bounded ring; a flusher thread writes the
+     * lines out in the background. When the ring is full the record is
+     * dropped and counted rather than stalling the caller.
+     */
+    void setRingMode(bool enabled);
+    bool isRingMode() const { return m_ringEnabled.load(std::memory_order_relaxed); }
+    uint64_t getRingDropCount() const { return m_ringDropped.load(std::memory_order_relaxed); }
+
+    /*
+     * Binary mode replaces the text lines with the length-prefixed record
+     * format from recformat.h and maintains a timestamp index sidecar, so
+     * swssrecdump can seek a time range instead of scanning. Must be set
+     * before startRec(); takes precedence over ring mode.
+     */
+    void setBinary(bool enabled) { m_binary = enabled; }
+    bool isBinary() const { return m_binary; }
+
 protected:
     void logfileReopen();
 
 private:
+    /* Cell of a Vyukov-style bounded multi-producer ring */
+    struct RingCell
+    {
+        std::atomic<uint64_t> seq;
+        std::string line;
+    };
+
+    static constexpr size_t RING_CAPACITY = 8192;  // must stay a power of two
+    static constexpr unsigned int RING_FLUSH_INTERVAL_MS = 100;
+
+    bool ringPush(std::string&& line);
+    bool ringPop(std::string& line);
+    void ringFlusher();
+    void stopRingFlusher();
+
+    void writeBinaryFileHeader(std::ofstream& ofs);
+    void recordBinary(const std::string& val);
+
     std::ofstream record_ofs;
+    std::ofstream index_ofs;
     std::string fname;
+    bool m_binary = false;
+    uint64_t m_binRecords = 0;
+
+    std::vector<RingCell> m_ring;
+    std::atomic<uint64_t> m_ringHead{0};   // producers claim cells here
+    uint64_t m_ringTail = 0;               // owned by the flusher thread
+    std::atomic<bool> m_ringEnabled{false};
+    std::atomic<bool> m_ringShutdown{false};
+    std::atomic<uint64_t> m_ringDropped{0};
+    std::thread m_flusher;
 };
 
 class RetryRec : public RecWriter {
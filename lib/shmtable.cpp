@@ -0,0 +1,400 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+#include "logger.h"
+#include "shmtable.h"
+
+#define SHM_RING_MAGIC      0x53574d52 /* "SWMR" */
+#define SHM_RING_VERSION    1
+
+/* Bounded wait for a full ring: 1ms naps, give up after one second. A full
+ * second without the consumer freeing a byte means it is gone, not slow. */
+#define SHM_FULL_RETRY_USECS    1000
+#define SHM_FULL_RETRY_MAX      1000
+
+/* Bounded wait for the creating side to finish header initialization. */
+#define SHM_INIT_RETRY_USECS    1000
+#define SHM_INIT_RETRY_MAX      1000
+
+using namespace std;
+
+namespace swss {
+
+set<string> load_shm_tables()
+{
+    set<string> tables;
+    ifstream config_file(SHM_TABLE_CONFIGFILE);
+    if (config_file.is_open())
+    {
+        string table;
+        while (getline(config_file, table))
+        {
+            tables.emplace(table);
+        }
+        config_file.close();
+    }
+
+    return tables;
+}
+
+static void encodeString(string &buf, const string &s)
+{
+    uint32_t len = (uint32_t)s.size();
+    buf.append(reinterpret_cast<const char *>(&len), sizeof(len));
+    buf.append(s);
+}
+
+static bool decodeString(const string &buf, size_t &pos, string &s)
+{
+    uint32_t len;
+    if (pos + sizeof(len) > buf.size())
+    {
+        return false;
+    }
+    memcpy(&len, buf.data() + pos, sizeof(len));
+    pos += sizeof(len);
+    if (pos + len > buf.size())
+    {
+        return false;
+    }
+    s.assign(buf, pos, len);
+    pos += len;
+    return true;
+}
+
+ShmRing::ShmRing(const string &name, size_t ringSize)
+{
+    SWSS_LOG_ENTER();
+
+    /* Round the capacity up to a power of two so ring positions reduce to
+     * a mask instead of a modulo. */
+    size_t capacity = 2;
+    while (capacity < ringSize)
+    {
+        capacity <<= 1;
+    }
+
+    m_shmName = "/sonic-swss." + name;
+    m_doorbellPath = "/dev/shm/sonic-swss." + name + ".doorbell";
+
+    bool creator = false;
+    m_shmFd = shm_open(m_shmName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (m_shmFd >= 0)
+    {
+        creator = true;
+    }
+    else
+    {
+        m_shmFd = shm_open(m_shmName.c_str(), O_RDWR, 0600);
+        if (m_shmFd < 0)
+        {
+            SWSS_LOG_THROW("Failed to open shared memory ring %s: %s",
+                           m_shmName.c_str(), strerror(errno));
+        }
+    }
+
+    if (creator)
+    {
+        m_mapSize = sizeof(Header) + capacity;
+        if (ftruncate(m_shmFd, (off_t)m_mapSize) < 0)
+        {
+            SWSS_LOG_THROW("Failed to size shared memory ring %s: %s",
+                           m_shmName.c_str(), strerror(errno));
+        }
+    }
+    else
+    {
+        /* The creating side picks the size; wait for it to settle. */
+        struct stat st;
+        int retries = 0;
+        while (true)
+        {
+            if (fstat(m_shmFd, &st) < 0)
+            {
+                SWSS_LOG_THROW("Failed to stat shared memory ring %s: %s",
+                               m_shmName.c_str(), strerror(errno));
+            }
+            if (st.st_size > (off_t)sizeof(Header))
+            {
+                break;
+            }
+            if (++retries > SHM_INIT_RETRY_MAX)
+            {
+                SWSS_LOG_THROW("Shared memory ring %s never got sized",
+                               m_shmName.c_str());
+            }
+            this_thread::sleep_for(chrono::microseconds(SHM_INIT_RETRY_USECS));
+        }
+        m_mapSize = (size_t)st.st_size;
+        capacity = m_mapSize - sizeof(Header);
+    }
+
+    void *base = mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_shmFd, 0);
+    if (base == MAP_FAILED)
+    {
+        SWSS_LOG_THROW("Failed to map shared memory ring %s: %s",
+                       m_shmName.c_str(), strerror(errno));
+    }
+    m_header = static_cast<Header *>(base);
+    m_data = reinterpret_cast<char *>(base) + sizeof(Header);
+
+    if (creator)
+    {
+        m_header->version = SHM_RING_VERSION;
+        m_header->capacity = capacity;
+        m_header->head.store(0, memory_order_relaxed);
+        m_header->tail.store(0, memory_order_relaxed);
+        /* Publish the magic last so the attaching side never observes a
+         * half-initialized header. */
+        __atomic_store_n(&m_header->magic, SHM_RING_MAGIC, __ATOMIC_RELEASE);
+    }
+    else
+    {
+        int retries = 0;
+        while (__atomic_load_n(&m_header->magic, __ATOMIC_ACQUIRE) != SHM_RING_MAGIC)
+        {
+            if (++retries > SHM_INIT_RETRY_MAX)
+            {
+                SWSS_LOG_THROW("Shared memory ring %s never got initialized",
+                               m_shmName.c_str());
+            }
+            this_thread::sleep_for(chrono::microseconds(SHM_INIT_RETRY_USECS));
+        }
+        if (m_header->version != SHM_RING_VERSION)
+        {
+            SWSS_LOG_THROW("Shared memory ring %s has version %u, expected %u",
+                           m_shmName.c_str(), m_header->version, SHM_RING_VERSION);
+        }
+    }
+
+    if (mkfifo(m_doorbellPath.c_str(), 0600) < 0 && errno != EEXIST)
+    {
+        SWSS_LOG_THROW("Failed to create doorbell %s: %s",
+                       m_doorbellPath.c_str(), strerror(errno));
+    }
+
+    /* O_RDWR keeps the FIFO open-able regardless of which side starts
+     * first and never blocks or raises SIGPIPE on a missing peer. */
+    m_doorbellFd = open(m_doorbellPath.c_str(), O_RDWR | O_NONBLOCK);
+    if (m_doorbellFd < 0)
+    {
+        SWSS_LOG_THROW("Failed to open doorbell %s: %s",
+                       m_doorbellPath.c_str(), strerror(errno));
+    }
+
+    SWSS_LOG_NOTICE("%s shared memory ring %s, capacity %zu bytes",
+                    creator ? "Created" : "Attached to", m_shmName.c_str(), capacity);
+}
+
+ShmRing::~ShmRing()
+{
+    /* The segment and doorbell stay behind for the peer; both daemons are
+     * long-lived and re-attach across restarts. */
+    if (m_header != nullptr)
+    {
+        munmap(m_header, m_mapSize);
+    }
+    if (m_shmFd >= 0)
+    {
+        close(m_shmFd);
+    }
+    if (m_doorbellFd >= 0)
+    {
+        close(m_doorbellFd);
+    }
+}
+
+void ShmRing::copyIn(uint64_t offset, const char *src, size_t len)
+{
+    size_t mask = m_header->capacity - 1;
+    size_t pos = offset & mask;
+    size_t contiguous = min(len, (size_t)(m_header->capacity - pos));
+    memcpy(m_data + pos, src, contiguous);
+    if (contiguous < len)
+    {
+        memcpy(m_data, src + contiguous, len - contiguous);
+    }
+}
+
+void ShmRing::copyOut(uint64_t offset, char *dst, size_t len)
+{
+    size_t mask = m_header->capacity - 1;
+    size_t pos = offset & mask;
+    size_t contiguous = min(len, (size_t)(m_header->capacity - pos));
+    memcpy(dst, m_data + pos, contiguous);
+    if (contiguous < len)
+    {
+        memcpy(dst + contiguous, m_data, len - contiguous);
+    }
+}
+
+bool ShmRing::write(const string &record)
+{
+    uint32_t len = (uint32_t)record.size();
+    uint64_t need = sizeof(len) + record.size();
+
+    if (need > m_header->capacity)
+    {
+        SWSS_LOG_ERROR("Record of %zu bytes exceeds ring %s capacity %zu",
+                       (size_t)need, m_shmName.c_str(), (size_t)m_header->capacity);
+        return false;
+    }
+
+    uint64_t tail = m_header->tail.load(memory_order_relaxed);
+    int retries = 0;
+    while (m_header->capacity - (tail - m_header->head.load(memory_order_acquire)) < need)
+    {
+        if (++retries > SHM_FULL_RETRY_MAX)
+        {
+            SWSS_LOG_ERROR("Ring %s stayed full, dropping record", m_shmName.c_str());
+            return false;
+        }
+        this_thread::sleep_for(chrono::microseconds(SHM_FULL_RETRY_USECS));
+    }
+
+    copyIn(tail, reinterpret_cast<const char *>(&len), sizeof(len));
+    copyIn(tail + sizeof(len), record.data(), record.size());
+    m_header->tail.store(tail + need, memory_order_release);
+
+    /* A full doorbell already guarantees a pending wakeup. */
+    char byte = 0;
+    if (::write(m_doorbellFd, &byte, 1) < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+        SWSS_LOG_ERROR("Failed to ring doorbell %s: %s",
+                       m_doorbellPath.c_str(), strerror(errno));
+    }
+
+    return true;
+}
+
+bool ShmRing::read(string &record)
+{
+    uint64_t head = m_header->head.load(memory_order_relaxed);
+    uint64_t tail = m_header->tail.load(memory_order_acquire);
+    if (head == tail)
+    {
+        return false;
+    }
+
+    uint32_t len;
+    copyOut(head, reinterpret_cast<char *>(&len), sizeof(len));
+    record.resize(len);
+    copyOut(head + sizeof(len), &record[0], len);
+    m_header->head.store(head + sizeof(len) + len, memory_order_release);
+    return true;
+}
+
+bool ShmRing::empty() const
+{
+    return m_header->head.load(memory_order_relaxed) ==
+           m_header->tail.load(memory_order_acquire);
+}
+
+void ShmRing::drainDoorbell()
+{
+    char buf[256];
+    while (::read(m_doorbellFd, buf, sizeof(buf)) > 0)
+    {
+    }
+}
+
+ShmProducerTable::ShmProducerTable(const string &tableName, size_t ringSize)
+    : TableBase(tableName, TABLE_NAME_SEPARATOR_COLON)
+    , m_ring(tableName, ringSize)
+{
+}
+
+void ShmProducerTable::set(const string &key, const vector<FieldValueTuple> &values, const string &op)
+{
+    string record;
+    encodeString(record, key);
+    encodeString(record, op);
+    uint32_t count = (uint32_t)values.size();
+    record.append(reinterpret_cast<const char *>(&count), sizeof(count));
+    for (const auto &value : values)
+    {
+        encodeString(record, fvField(value));
+        encodeString(record, fvValue(value));
+    }
+
+    if (!m_ring.write(record))
+    {
+        SWSS_LOG_ERROR("Dropped %s %s:%s", op.c_str(), getTableName().c_str(), key.c_str());
+    }
+}
+
+void ShmProducerTable::del(const string &key, const string &op)
+{
+    set(key, {}, op);
+}
+
+ShmConsumerTable::ShmConsumerTable(const string &tableName, int popBatchSize, int pri, size_t ringSize)
+    : Selectable(pri)
+    , TableBase(tableName, TABLE_NAME_SEPARATOR_COLON)
+    , m_ring(tableName, ringSize)
+    , m_popBatchSize(popBatchSize > 0 ? popBatchSize : (int)TableConsumable::DEFAULT_POP_BATCH_SIZE)
+{
+}
+
+uint64_t ShmConsumerTable::readData()
+{
+    m_ring.drainDoorbell();
+    return 0;
+}
+
+void ShmConsumerTable::pops(deque<KeyOpFieldsValuesTuple> &entries)
+{
+    SWSS_LOG_ENTER();
+
+    string record;
+    while ((int)entries.size() < m_popBatchSize && m_ring.read(record))
+    {
+        string key, op;
+        size_t pos = 0;
+        uint32_t count;
+        if (!decodeString(record, pos, key) || !decodeString(record, pos, op) ||
+            pos + sizeof(count) > record.size())
+        {
+            SWSS_LOG_ERROR("Corrupt record in ring for table %s, dropping",
+                           getTableName().c_str());
+            continue;
+        }
+        memcpy(&count, record.data() + pos, sizeof(count));
+        pos += sizeof(count);
+
+        entries.emplace_back();
+        auto &entry = entries.back();
+        kfvKey(entry) = key;
+        kfvOp(entry) = op;
+        auto &values = kfvFieldsValues(entry);
+        values.reserve(count);
+        bool ok = true;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            string field, value;
+            if (!decodeString(record, pos, field) || !decodeString(record, pos, value))
+            {
+                ok = false;
+                break;
+            }
+            values.emplace_back(move(field), move(value));
+        }
+        if (!ok)
+        {
+            SWSS_LOG_ERROR("Corrupt record in ring for table %s, dropping",
+                           getTableName().c_str());
+            entries.pop_back();
+        }
+    }
+}
+
+}
@@ -0,0 +1,131 @@
+#ifndef SWSS_SHMTABLE_H
+#define SWSS_SHMTABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "selectable.h"
+#include "table.h"
+
+/*
+ * Per-table opt-in list for the shared-memory transport, one table name per
+ * line. Mirrors the ZMQ table list handled by orch_zmq_config.cpp: a table
+ * listed here is carried over a local shared-memory ring instead of the
+ * ProducerStateTable/ConsumerStateTable redis hop. Only suitable for tables
+ * whose content is ephemeral — nothing is persisted and nothing survives a
+ * consumer restart.
+ */
+#define SHM_TABLE_CONFIGFILE "/etc/swss/orch_shm_tables.conf"
+
+namespace swss {
+
+std::set<std::string> load_shm_tables();
+
+/*
+ * Single-producer/single-consumer byte ring in POSIX shared memory, plus a
+ * FIFO doorbell so the consumer side integrates with select(). Records are
+ * length-prefixed serialized KeyOpFieldsValuesTuples; the FIFO only carries
+ * wakeup bytes, never data. Whichever side starts first creates and sizes
+ * the segment, the other attaches and validates the header.
+ */
+class ShmRing
+{
+public:
+    ShmRing(const std::string &name, size_t ringSize);
+    ~ShmRing();
+
+    ShmRing(const ShmRing &) = delete;
+    ShmRing &operator=(const ShmRing &) = delete;
+
+    /* Producer side: append one record, ringing the doorbell. Blocks in
+     * short sleeps while the ring is full; returns false only if the
+     * consumer made no room within the bounded wait. */
+    bool write(const std::string &record);
+
+    /* Consumer side: pop one record, or return false when the ring is
+     * empty. */
+    bool read(std::string &record);
+
+    bool empty() const;
+
+    int getDoorbellFd() const { return m_doorbellFd; }
+
+    /* Consumer side: discard pending doorbell bytes after a wakeup. */
+    void drainDoorbell();
+
+private:
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t capacity;
+        /* Byte offsets, monotonically increasing; position in the data
+         * region is offset & (capacity - 1). */
+        std::atomic<uint64_t> head;
+        std::atomic<uint64_t> tail;
+    };
+
+    void copyIn(uint64_t offset, const char *src, size_t len);
+    void copyOut(uint64_t offset, char *dst, size_t len);
+
+    std::string m_shmName;
+    std::string m_doorbellPath;
+    Header *m_header = nullptr;
+    char *m_data = nullptr;
+    size_t m_mapSize = 0;
+    int m_shmFd = -1;
+    int m_doorbellFd = -1;
+};
+
+/*
+ * Producer endpoint with the ProducerStateTable set/del surface. Syncds that
+ * feed an opted-in table construct this instead of a ProducerStateTable;
+ * each operation is serialized once, straight into the shared ring.
+ */
+class ShmProducerTable : public TableBase
+{
+public:
+    ShmProducerTable(const std::string &tableName, size_t ringSize = DEFAULT_RING_BYTES);
+
+    void set(const std::string &key,
+             const std::vector<FieldValueTuple> &values,
+             const std::string &op = SET_COMMAND);
+    void del(const std::string &key,
+             const std::string &op = DEL_COMMAND);
+
+    static constexpr size_t DEFAULT_RING_BYTES = 1 << 20;
+
+private:
+    ShmRing m_ring;
+};
+
+/*
+ * Consumer endpoint: a Selectable over the doorbell FIFO with the same
+ * pops() contract as ConsumerStateTable. Wrapped by ShmConsumer (orch.h) to
+ * slot into the Executor/Consumer flow.
+ */
+class ShmConsumerTable : public Selectable, public TableBase
+{
+public:
+    ShmConsumerTable(const std::string &tableName, int popBatchSize, int pri = 0,
+                     size_t ringSize = ShmProducerTable::DEFAULT_RING_BYTES);
+
+    void pops(std::deque<KeyOpFieldsValuesTuple> &entries);
+
+    int getFd() override { return m_ring.getDoorbellFd(); }
+    uint64_t readData() override;
+    bool hasCachedData() override { return !m_ring.empty(); }
+    bool initializedWithData() override { return !m_ring.empty(); }
+
+private:
+    ShmRing m_ring;
+    int m_popBatchSize;
+};
+
+}
+
+#endif /* SWSS_SHMTABLE_H */
@@ -420,6 +420,9 @@ void MclagLink::setPortMacLearnMode(char *msg)
 
 void MclagLink::setFdbFlush()
 {
+    /* Keep ordering: entries queued before the flush request must land first */
+    flushFdbWrites();
+
     swss::NotificationProducer flushFdb(p_appl_db.get(), "FLUSHFDBREQUEST");
 
     vector<FieldValueTuple> values;
@@ -508,18 +511,42 @@ void MclagLink::setFdbEntry(char *msg, int msg_len)
             /*set type attr*/
             FieldValueTuple type_attr("type", fdb.type);
             attrs.push_back(type_attr);
-            p_fdb_tbl->set(fdb_key, attrs);
-            SWSS_LOG_NOTICE("add fdb entry into ASIC_DB:key =%s, type =%s", fdb_key.c_str(),  fdb.type.c_str());
+            m_pendingFdbWrites[fdb_key] = make_pair(false, attrs);
+            SWSS_LOG_INFO("add fdb entry into ASIC_DB:key =%s, type =%s", fdb_key.c_str(),  fdb.type.c_str());
         }
         else if (fdb_info->op_type == MCLAG_FDB_OPER_DEL)
         {
-            p_fdb_tbl->del(fdb_key);
-            SWSS_LOG_NOTICE("del fdb entry from ASIC_DB:key =%s", fdb_key.c_str());
+            m_pendingFdbWrites[fdb_key] = make_pair(true, vector<FieldValueTuple>());
+            SWSS_LOG_INFO("del fdb entry from ASIC_DB:key =%s", fdb_key.c_str());
         }
     }
     return;
 }
 
+void MclagLink::flushFdbWrites()
+{
+    if (m_pendingFdbWrites.empty())
+        return;
+
+    vector<KeyOpFieldsValuesTuple> sets;
+    vector<string> dels;
+    for (auto &entry : m_pendingFdbWrites)
+    {
+        if (entry.second.first)
+            dels.push_back(entry.first);
+        else
+            sets.emplace_back(entry.first, SET_COMMAND, entry.second.second);
+    }
+
+    if (!dels.empty())
+        p_fdb_tbl->del(dels);
+    if (!sets.empty())
+        p_fdb_tbl->set(sets);
+
+    SWSS_LOG_NOTICE("flush fdb entries to ASIC_DB: %zu sets, %zu dels", sets.size(), dels.size());
+    m_pendingFdbWrites.clear();
+}
+
 void MclagLink::mclagsyncdSendFdbEntries(std::deque<KeyOpFieldsValuesTuple> &entries)
 {
     size_t infor_len = sizeof(mclag_msg_hdr_t);
@@ -1958,6 +1985,10 @@ uint64_t MclagLink::readData()
 
         start += msg_len;
     }
+
+    /* One batched DB write per receive batch instead of one per entry */
+    flushFdbWrites();
+
     memmove(m_messageBuffer, m_messageBuffer + start, m_pos - start);
     m_pos = m_pos - (uint32_t)start;
     return 0;
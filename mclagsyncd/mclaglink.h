@@ -281,6 +281,12 @@ namespace swss {
             void setFdbFlush();
             void setIntfMac(char *msg);
             void setFdbEntry(char *msg, int msg_len);
+            void flushFdbWrites();
+
+            /* FDB updates accumulated over one receive batch; the last
+             * operation per key wins and the flush writes them with the
+             * producer's vectorized set()/del() calls */
+            std::map<std::string, std::pair<bool, std::vector<FieldValueTuple>>> m_pendingFdbWrites;
 
             void addVlanMbr(std::string, std::string);
             void delVlanMbr(std::string, std::string);
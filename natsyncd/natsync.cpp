@@ -15,9 +15,13 @@
  */
 
 #include <string>
+#include <string.h>
+#include <errno.h>
 #include <netinet/in.h>
 #include <netlink/netfilter/ct.h>
 #include <netlink/utils.h>
+#include <linux/filter.h>
+#include <sys/socket.h>
 
 #include "logger.h"
 #include "dbconnector.h"
@@ -38,10 +42,10 @@ using namespace swss;
 #define CT_UDP_EXPIRY_TIMEOUT   600 /* Max conntrack timeout in the user configurable range */
 
 NatSync::NatSync(RedisPipeline *pipelineAppDB, DBConnector *appDb, DBConnector *stateDb, NfNetlink *nfnl) :
-    m_natTable(appDb, APP_NAT_TABLE_NAME),
-    m_naptTable(appDb, APP_NAPT_TABLE_NAME),
-    m_natTwiceTable(appDb, APP_NAT_TWICE_TABLE_NAME),
-    m_naptTwiceTable(appDb, APP_NAPT_TWICE_TABLE_NAME),
+    m_natTable(pipelineAppDB, APP_NAT_TABLE_NAME, true),
+    m_naptTable(pipelineAppDB, APP_NAPT_TABLE_NAME, true),
+    m_natTwiceTable(pipelineAppDB, APP_NAT_TWICE_TABLE_NAME, true),
+    m_naptTwiceTable(pipelineAppDB, APP_NAPT_TWICE_TABLE_NAME, true),
     m_natCheckTable(appDb, APP_NAT_TABLE_NAME),
     m_naptCheckTable(appDb, APP_NAPT_TABLE_NAME),
     m_twiceNatCheckTable(appDb, APP_NAT_TWICE_TABLE_NAME),
@@ -49,8 +53,11 @@ NatSync::NatSync(RedisPipeline *pipelineAppDB, DBConnector *appDb, DBConnector *
     m_naptPoolCheckTable(appDb, APP_NAPT_POOL_IP_TABLE_NAME),
     m_stateNatRestoreTable(stateDb, STATE_NAT_RESTORE_TABLE_NAME)
 {
+    m_appDbPipeline = pipelineAppDB;
     nfsock = nfnl;
 
+    attachConnTrackFilter();
+
     m_AppRestartAssist = new AppRestartAssist(pipelineAppDB, "natsyncd", "nat", DEFAULT_NATSYNC_WARMSTART_TIMER);
     if (m_AppRestartAssist)
     {
@@ -71,6 +78,51 @@ NatSync::~NatSync()
     }
 }
 
+/* Attach a socket filter to the conntrack netlink socket so that events
+ * natsyncd is never interested in are dropped in the kernel instead of
+ * crossing into userspace just to be discarded. Only IPv4 connections are
+ * NAT'ted in SONiC, so conntrack events for any other address family
+ * (identified by the nfgenmsg family byte that follows the netlink header)
+ * are filtered out. The userspace checks in parseConnTrackMsg() stay as a
+ * backstop in case the filter could not be installed.
+ */
+void NatSync::attachConnTrackFilter()
+{
+    static struct sock_filter ctFilter[] = {
+        /* A <- nfgen_family */
+        BPF_STMT(BPF_LD | BPF_B | BPF_ABS, NLMSG_HDRLEN),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, AF_INET, 0, 1),
+        /* IPv4 conntrack event, pass the whole message */
+        BPF_STMT(BPF_RET | BPF_K, 0xffffffff),
+        /* Any other family, drop it in the kernel */
+        BPF_STMT(BPF_RET | BPF_K, 0),
+    };
+    struct sock_fprog ctFilterProg = {
+        .len = sizeof(ctFilter) / sizeof(ctFilter[0]),
+        .filter = ctFilter,
+    };
+
+    if (!nfsock)
+    {
+        return;
+    }
+
+    if (setsockopt(nfsock->getFd(), SOL_SOCKET, SO_ATTACH_FILTER,
+                   &ctFilterProg, sizeof(ctFilterProg)) < 0)
+    {
+        SWSS_LOG_WARN("Failed to attach conntrack socket filter, falling back to userspace filtering: %s",
+                      strerror(errno));
+        return;
+    }
+
+    SWSS_LOG_NOTICE("Attached IPv4 conntrack filter to the netlink socket");
+}
+
+void NatSync::flushPipeline()
+{
+    m_appDbPipeline->flush();
+}
+
 /* To check the port init is done or not */
 bool NatSync::isPortInitDone(DBConnector *app_db)
 {
@@ -18,6 +18,7 @@
 #define __NATSYNC_H__
 
 #include "dbconnector.h"
+#include "redispipeline.h"
 #include "producerstatetable.h"
 #include "notificationproducer.h"
 #include "netmsg.h"
@@ -51,6 +52,9 @@ public:
     bool isNatRestoreDone();
     bool isPortInitDone(DBConnector *app_db);
 
+    /* Push the NAT entry writes buffered over one select cycle to APPL_DB */
+    void flushPipeline();
+
     AppRestartAssist *getRestartAssist()
     {
         return m_AppRestartAssist;
@@ -61,6 +65,8 @@ private:
     void        updateConnTrackEntry(struct nfnl_ct *ct);
     void        deleteConnTrackEntry(struct nfnl_ct *ct);
 
+    void        attachConnTrackFilter();
+
     bool        matchingSnaptPoolExists(const IpAddress &natIp);
     bool        matchingSnaptEntryExists(const naptEntry &entry);
     bool        matchingDnaptEntryExists(const naptEntry &entry);
@@ -82,6 +88,7 @@ private:
     Table              m_stateNatRestoreTable;
     AppRestartAssist  *m_AppRestartAssist;
 
+    RedisPipeline      *m_appDbPipeline;
     NfNetlink          *nfsock;
 };
 
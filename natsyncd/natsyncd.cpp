@@ -87,6 +87,10 @@ int main(int argc, char **argv)
                         sync.getRestartAssist()->reconcile();
                     }
                 }
+
+                /* All NAT entry updates from this batch of conntrack
+                 * events go to APPL_DB in one pipelined transaction */
+                sync.flushPipeline();
             }
         }
         catch (const std::exception& e)
@@ -180,15 +180,68 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     }
     else
     {
-        if (delete_key == true)
+        /* Only the last transition of a neighbor within the aggregation
+         * window reaches APPL_DB; earlier ones are suppressed */
+        if (m_pendingNeighs.find(key) != m_pendingNeighs.end())
         {
-            m_neighTable.del(key);
-            return;
+            m_suppressedEvents++;
+        }
+        m_pendingNeighs[key] = make_pair(delete_key, fvVector);
+
+        if (m_pendingNeighs.size() >= NEIGH_AGGREGATE_MAX_PENDING)
+        {
+            flushPendingNeighs();
         }
-        m_neighTable.set(key, fvVector);
     }
 }
 
+void NeighSync::flushPendingNeighs()
+{
+    if (m_pendingNeighs.empty())
+    {
+        return;
+    }
+
+    std::vector<KeyOpFieldsValuesTuple> sets;
+    std::vector<std::string> dels;
+    for (auto &neigh : m_pendingNeighs)
+    {
+        if (neigh.second.first)
+        {
+            dels.push_back(neigh.first);
+            m_neighCache.erase(neigh.first);
+        }
+        else
+        {
+            auto cached = m_neighCache.find(neigh.first);
+            if (cached != m_neighCache.end() && cached->second == neigh.second.second)
+            {
+                /* Already in APPL_DB with the same attributes, e.g. replayed
+                 * by the kernel dump after a receive-buffer overrun */
+                m_unchangedNeighs++;
+                continue;
+            }
+            m_neighCache[neigh.first] = neigh.second.second;
+            sets.emplace_back(neigh.first, SET_COMMAND, neigh.second.second);
+        }
+    }
+
+    if (!dels.empty())
+    {
+        m_neighTable.del(dels);
+    }
+    if (!sets.empty())
+    {
+        m_neighTable.set(sets);
+    }
+
+    SWSS_LOG_INFO("Flushed %zu neighbor sets, %zu dels, %zu events suppressed, %zu unchanged",
+                  sets.size(), dels.size(), m_suppressedEvents, m_unchangedNeighs);
+    m_suppressedEvents = 0;
+    m_unchangedNeighs = 0;
+    m_pendingNeighs.clear();
+}
+
 /* To check the ipv6 link local is enabled on a given port */
 bool NeighSync::isLinkLocalEnabled(const string &port)
 {
@@ -6,9 +6,22 @@
 #include "netmsg.h"
 #include "warmRestartAssist.h"
 
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 // The timeout value (in seconds) for neighsyncd reconcilation logic
 #define DEFAULT_NEIGHSYNC_WARMSTART_TIMER 5
 
+// The window (in milliseconds) over which neighbor events are aggregated
+// before being flushed to APPL_DB. During ARP storms repeated transitions
+// of the same neighbor within the window collapse into one write.
+#define NEIGH_AGGREGATE_WINDOW_MS 10
+
+// Flush immediately once this many neighbors are pending, to bound memory
+#define NEIGH_AGGREGATE_MAX_PENDING 1024
+
 /*
  * This is the timer value (in seconds) that the neighsyncd waits for restore_neighbors
  * service to finish, should be longer than the restore_neighbors timeout value (110)
@@ -30,6 +43,13 @@ public:
 
     bool isNeighRestoreDone();
 
+    void flushPendingNeighs();
+
+    size_t pendingNeighCount() const
+    {
+        return m_pendingNeighs.size();
+    }
+
     AppRestartAssist *getRestartAssist()
     {
         return m_AppRestartAssist;
@@ -41,6 +61,17 @@ private:
     AppRestartAssist  *m_AppRestartAssist;
     Table m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
 
+    /* Last transition seen per neighbor key within the aggregation window */
+    std::map<std::string, std::pair<bool, std::vector<FieldValueTuple>>> m_pendingNeighs;
+    size_t m_suppressedEvents = 0;
+
+    /* Mirror of the neighbor entries written to APPL_DB. After a netlink
+     * receive-buffer overrun the kernel re-dump is merged against it, so
+     * only neighbors that actually changed are replayed to APPL_DB.
+     */
+    std::map<std::string, std::vector<FieldValueTuple>> m_neighCache;
+    size_t m_unchangedNeighs = 0;
+
     bool isLinkLocalEnabled(const std::string &port);
 };
 
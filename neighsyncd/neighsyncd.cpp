@@ -70,7 +70,22 @@ int main(int argc, char **argv)
             while (true)
             {
                 Selectable *temps;
-                s.select(&temps);
+                int ret;
+                /* Only arm the aggregation timeout while events are pending */
+                ret = s.select(&temps, sync.pendingNeighCount() ? NEIGH_AGGREGATE_WINDOW_MS : -1);
+
+                if (ret == Select::ERROR)
+                {
+                    cerr << "Error had been returned in select" << endl;
+                    continue;
+                }
+                else if (ret == Select::TIMEOUT)
+                {
+                    /* Aggregation window elapsed with no new events */
+                    sync.flushPendingNeighs();
+                    continue;
+                }
+
                 /*
                  * If warmstart is in progress, we check the reconcile timer,
                  * if timer expired, we stop the timer and start the reconcile process
@@ -87,8 +102,16 @@ int main(int argc, char **argv)
         }
         catch (const std::exception& e)
         {
+            /*
+             * Netlink receive-buffer overruns (ENOBUFS) surface here. Instead
+             * of exiting and paying a cold restart, recover in-process: the
+             * outer loop recreates the netlink socket and re-issues the
+             * RTM_GETNEIGH dump, and the neighbor cache in NeighSync merges
+             * the replay so only changed entries are rewritten to APPL_DB.
+             */
             cout << "Exception \"" << e.what() << "\" had been thrown in daemon" << endl;
-            return 0;
+            SWSS_LOG_ERROR("Exception \"%s\" in daemon, recovering with a fresh netlink dump", e.what());
+            sleep(1);
         }
     }
 
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <sstream>
 #include "aclorch.h"
+#include "pipelineperf.h"
 #include "logger.h"
 #include "schema.h"
 #include "ipprefix.h"
@@ -18,6 +19,7 @@ using namespace std;
 using namespace swss;
 
 map<acl_range_properties_t, AclRange*> AclRange::m_ranges;
+map<sai_object_id_t, AclRange*> AclRange::m_rangesByOid;
 sai_uint32_t AclRule::m_minPriority = 0;
 sai_uint32_t AclRule::m_maxPriority = 0;
 
@@ -3394,6 +3396,7 @@ AclRange *AclRange::create(sai_acl_range_type_t type, int min, int max)
 
         SWSS_LOG_INFO("Created ACL Range object. Type: %d, range %d-%d, oid: %" PRIx64, type, min, max, range_oid);
         m_ranges[rangeProperties] = new AclRange(type, range_oid, min, max);
+        m_rangesByOid[range_oid] = m_ranges[rangeProperties];
 
         range_it = m_ranges.find(rangeProperties);
     }
@@ -3428,12 +3431,10 @@ bool AclRange::remove(sai_object_id_t *oids, int oidsCnt)
 
     for (int oidIdx = 0; oidIdx < oidsCnt; oidIdx++)
     {
-        for (auto it : m_ranges)
+        auto range_it = m_rangesByOid.find(oids[oidIdx]);
+        if (range_it != m_rangesByOid.end())
         {
-            if (it.second->m_oid == oids[oidIdx])
-            {
-                return it.second->remove();
-            }
+            return range_it->second->remove();
         }
     }
 
@@ -3460,6 +3461,7 @@ bool AclRange::remove()
         auto range_it = m_ranges.find(make_tuple(m_type, m_min, m_max));
 
         m_ranges.erase(range_it);
+        m_rangesByOid.erase(m_oid);
         delete this;
     }
     else
@@ -4196,8 +4198,9 @@ AclOrch::AclOrch(vector<TableConnector>& connectors, DBConnector* stateDb, Switc
         PortsOrch *portOrch, MirrorOrch *mirrorOrch, NeighOrch *neighOrch, RouteOrch *routeOrch, DTelOrch *dtelOrch) :
         Orch(connectors),
         m_aclStageCapabilityTable(stateDb, STATE_ACL_STAGE_CAPABILITY_TABLE_NAME),
-        m_aclTableStateTable(stateDb, STATE_ACL_TABLE_TABLE_NAME),
-        m_aclRuleStateTable(stateDb, STATE_ACL_RULE_TABLE_NAME),
+        m_stateDbPipeline(new RedisPipeline(stateDb)),
+        m_aclTableStateTable(m_stateDbPipeline.get(), STATE_ACL_TABLE_TABLE_NAME, true),
+        m_aclRuleStateTable(m_stateDbPipeline.get(), STATE_ACL_RULE_TABLE_NAME, true),
         m_switchOrch(switchOrch),
         m_mirrorOrch(mirrorOrch),
         m_neighOrch(neighOrch),
@@ -4289,6 +4292,10 @@ void AclOrch::doTask(Consumer &consumer)
     {
         SWSS_LOG_ERROR("Invalid table %s", table_name.c_str());
     }
+
+    // The drain is over; table groups emptied above that no rebind picked
+    // back up can now actually be destroyed
+    gPortsOrch->flushAclTableGroupQuarantine();
 }
 
 void AclOrch::getAddDeletePorts(AclTable    &newT,
@@ -5343,7 +5350,7 @@ void AclOrch::doAclTableTask(Consumer &consumer)
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
-        KeyOpFieldsValuesTuple t = it->second;
+        const KeyOpFieldsValuesTuple &t = it->second;
         string key = kfvKey(t);
         size_t found = key.find(consumer.getConsumerTable()->getTableNameSeparator().c_str());
         string table_id = key.substr(0, found);
@@ -5517,7 +5524,7 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
-        KeyOpFieldsValuesTuple t = it->second;
+        const KeyOpFieldsValuesTuple &t = it->second;
         string key = kfvKey(t);
         size_t found = key.find(consumer.getConsumerTable()->getTableNameSeparator().c_str());
         string table_id = key.substr(0, found);
@@ -6099,6 +6106,15 @@ void AclOrch::removeAllAclRuleStatus()
     }
 }
 
+// The status tables are buffered: per-rule status writes accumulated over a
+// drain cycle leave in a single pipeline flush once all orchs have run
+void AclOrch::flushResponses()
+{
+    m_flex_counter_manager.flush();
+    PipelinePerf::Instance().flushPipeline("ACL_RULE_STATE", m_stateDbPipeline.get());
+    Orch::flushResponses();
+}
+
 void MetaDataMgr::populateRange(uint16_t min, uint16_t max)
 {
     metaMin = min;
@@ -10,6 +10,7 @@
 #include <condition_variable>
 
 #include "orch.h"
+#include "redispipeline.h"
 #include "switchorch.h"
 #include "portsorch.h"
 #include "mirrororch.h"
@@ -287,6 +288,9 @@ private:
     int m_max;
     sai_acl_range_type_t m_type;
     static map<acl_range_properties_t, AclRange*> m_ranges;
+    /* OID index over m_ranges so removal by range object id stays
+     * logarithmic as the number of shared range objects grows */
+    static map<sai_object_id_t, AclRange*> m_rangesByOid;
 };
 
 class AclTable;
@@ -636,6 +640,8 @@ public:
     // Get the OID for the ACL bind point for a given port
     static bool getAclBindPortId(Port& port, sai_object_id_t& port_id);
 
+    void flushResponses() override;
+
     using Orch::doTask;  // Allow access to the basic doTask
     map<sai_object_id_t, AclTable>  getAclTables()
     {
@@ -702,6 +708,10 @@ private:
 
     Table m_aclStageCapabilityTable;
 
+    /* Table/rule status writes ride a dedicated buffered pipeline so a bulk
+     * rule install produces one STATE_DB round trip per drain instead of one
+     * per rule */
+    std::unique_ptr<swss::RedisPipeline> m_stateDbPipeline;
     Table m_aclTableStateTable;
     Table m_aclRuleStateTable;
 
@@ -714,7 +724,9 @@ private:
 
     acl_capabilities_t m_aclCapabilities;
     acl_action_enum_values_capabilities_t m_aclEnumActionCapabilities;
-    FlexCounterManager m_flex_counter_manager;
+    /* Cached so per-rule counter registrations during a drain collapse into
+     * one polling request per counter-id set instead of one per rule */
+    FlexCounterTaggedCachedManager<void> m_flex_counter_manager;
 };
 
 #endif /* SWSS_ACLORCH_H */
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+/*
+ * Incrementally maintained digest over a set of keys.
+ *
+ * The digest is an xor-fold of a 64-bit hash of every member key plus a
+ * member count. Xor is its own inverse, so insertion and removal are both
+ * O(1) and order-independent, and two digests are equal exactly when they
+ * were built from the same multiset of keys. This is what lets an Orch keep
+ * a live summary of its programmed state that the audit engine can compare
+ * against an ASIC_DB-derived summary without walking either side.
+ */
+class AuditDigest
+{
+public:
+    void add(const std::string &key)
+    {
+        m_fold ^= hashKey(key);
+        m_count++;
+    }
+
+    void remove(const std::string &key)
+    {
+        m_fold ^= hashKey(key);
+        m_count--;
+    }
+
+    void clear()
+    {
+        m_fold = 0;
+        m_count = 0;
+    }
+
+    uint64_t count() const
+    {
+        return m_count;
+    }
+
+    /* Fold another digest in; the result summarizes the union of both key
+     * sets as long as they are disjoint */
+    void merge(const AuditDigest &other)
+    {
+        m_fold ^= other.m_fold;
+        m_count += other.m_count;
+    }
+
+    bool operator==(const AuditDigest &rhs) const
+    {
+        return m_fold == rhs.m_fold && m_count == rhs.m_count;
+    }
+
+    bool operator!=(const AuditDigest &rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    std::string toString() const
+    {
+        char buf[40];
+        snprintf(buf, sizeof(buf), "%llu:%016llx",
+                 (unsigned long long)m_count, (unsigned long long)m_fold);
+        return std::string(buf);
+    }
+
+private:
+    /* FNV-1a, 64 bit */
+    static uint64_t hashKey(const std::string &key)
+    {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (char c : key)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 0x100000001b3ULL;
+        }
+        return hash;
+    }
+
+    uint64_t m_fold = 0;
+    uint64_t m_count = 0;
+};
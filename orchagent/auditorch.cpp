@@ -0,0 +1,257 @@
+#include "auditorch.h"
+#include "converter.h"
+#include "notifier.h"
+#include "schema.h"
+#include <inttypes.h>
+
+using namespace std;
+using namespace swss;
+
+#define AUDIT_TABLE_NAME             "AUDIT"
+#define AUDIT_STATE_TABLE            "AUDIT_STATE"
+#define AUDIT_DEFAULT_INTERVAL_SEC   10
+/* Cap on the per-key samples logged during a drill-down */
+#define AUDIT_DRILLDOWN_LOG_MAX      20
+
+AuditOrch &AuditOrch::getInstance(DBConnector *db)
+{
+    SWSS_LOG_ENTER();
+
+    static vector<string> tableNames = { AUDIT_TABLE_NAME };
+    static AuditOrch *audit = new AuditOrch(db, tableNames);
+
+    return *audit;
+}
+
+AuditOrch::AuditOrch(DBConnector *db, vector<string> &tableNames) :
+    Orch(db, tableNames, default_orch_pri),
+    m_asicDb(new DBConnector("ASIC_DB", 0)),
+    m_stateDb(new DBConnector("STATE_DB", 0)),
+    m_auditTable(new Table(m_stateDb.get(), AUDIT_STATE_TABLE))
+{
+    SWSS_LOG_ENTER();
+
+    auto interv = timespec { .tv_sec = AUDIT_DEFAULT_INTERVAL_SEC, .tv_nsec = 0 };
+    m_auditTimer = new SelectableTimer(interv);
+    auto executor = new ExecutableTimer(m_auditTimer, this, "AUDIT_TIMER");
+    Orch::addExecutor(executor);
+    /* The timer only runs once the audit is enabled from CONFIG_DB */
+}
+
+AuditOrch::~AuditOrch(void)
+{
+    SWSS_LOG_ENTER();
+}
+
+void AuditOrch::registerTarget(AuditTarget target)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("Registered audit target %s over %s with %zu contributors",
+                    target.name.c_str(), target.pattern.c_str(), target.contributors.size());
+    m_targets.push_back(move(target));
+}
+
+void AuditOrch::registerContributor(const string &targetName, AuditContributor contributor)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto &target : m_targets)
+    {
+        if (target.name == targetName)
+        {
+            SWSS_LOG_NOTICE("Registered audit contributor %s for target %s",
+                            contributor.name.c_str(), targetName.c_str());
+            target.contributors.push_back(move(contributor));
+            return;
+        }
+    }
+
+    SWSS_LOG_ERROR("Audit contributor %s references unknown target %s",
+                   contributor.name.c_str(), targetName.c_str());
+}
+
+void AuditOrch::doTask(Consumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = consumer.m_toSync.begin();
+    while (it != consumer.m_toSync.end())
+    {
+        KeyOpFieldsValuesTuple t = it->second;
+        string op = kfvOp(t);
+
+        if (op == SET_COMMAND)
+        {
+            for (const auto &fv : kfvFieldsValues(t))
+            {
+                if (fvField(fv) == "enable")
+                {
+                    bool enable = fvValue(fv) == "true";
+                    if (enable && !m_enabled)
+                    {
+                        m_auditTimer->start();
+                        SWSS_LOG_NOTICE("Consistency audit enabled");
+                    }
+                    else if (!enable && m_enabled)
+                    {
+                        m_auditTimer->stop();
+                        SWSS_LOG_NOTICE("Consistency audit disabled");
+                    }
+                    m_enabled = enable;
+                }
+                else if (fvField(fv) == "interval")
+                {
+                    auto interv = timespec {
+                        .tv_sec = static_cast<time_t>(to_uint<uint32_t>(fvValue(fv))),
+                        .tv_nsec = 0
+                    };
+                    m_auditTimer->setInterval(interv);
+                    if (m_enabled)
+                    {
+                        m_auditTimer->reset();
+                    }
+                }
+                else
+                {
+                    SWSS_LOG_WARN("Unsupported audit field: %s", fvField(fv).c_str());
+                }
+            }
+        }
+        else if (op == DEL_COMMAND)
+        {
+            if (m_enabled)
+            {
+                m_auditTimer->stop();
+                m_enabled = false;
+                SWSS_LOG_NOTICE("Consistency audit disabled");
+            }
+        }
+
+        consumer.m_toSync.erase(it++);
+    }
+}
+
+void AuditOrch::doTask(SelectableTimer &timer)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_targets.empty())
+    {
+        return;
+    }
+
+    /* One target per tick keeps the per-iteration redis load bounded */
+    auditTarget(m_targets[m_nextTarget % m_targets.size()]);
+    m_nextTarget++;
+}
+
+AuditDigest AuditOrch::syncedDigest(const AuditTarget &target)
+{
+    AuditDigest digest;
+    for (const auto &contributor : target.contributors)
+    {
+        digest.merge(contributor.digest());
+    }
+    return digest;
+}
+
+void AuditOrch::auditTarget(AuditTarget &target)
+{
+    SWSS_LOG_ENTER();
+
+    AuditDigest before = syncedDigest(target);
+
+    auto asicKeys = m_asicDb->keys(target.pattern);
+
+    AuditDigest asic;
+    string canonical;
+    for (const auto &key : asicKeys)
+    {
+        if (target.canonicalize(key, canonical))
+        {
+            asic.add(canonical);
+        }
+    }
+
+    /* If the synced state moved while we were reading ASIC_DB the two
+     * snapshots are not comparable; skip rather than raise a false alarm */
+    AuditDigest synced = syncedDigest(target);
+    string status;
+    if (synced != before)
+    {
+        status = "skipped_churn";
+    }
+    else if (asic == synced)
+    {
+        status = "ok";
+    }
+    else
+    {
+        status = drillDownStatus(target, asicKeys);
+    }
+
+    vector<FieldValueTuple> fvs;
+    fvs.emplace_back("status", status);
+    fvs.emplace_back("synced_digest", synced.toString());
+    fvs.emplace_back("asic_digest", asic.toString());
+    fvs.emplace_back("last_check", to_string(time(nullptr)));
+    m_auditTable->set(target.name, fvs);
+}
+
+string AuditOrch::drillDownStatus(const AuditTarget &target, const vector<string> &asicKeys)
+{
+    SWSS_LOG_ENTER();
+
+    set<string> syncedKeys;
+    for (const auto &contributor : target.contributors)
+    {
+        contributor.keys(syncedKeys);
+    }
+
+    /* Keys present in ASIC_DB but not claimed by any contributor. These are
+     * not necessarily faults: an Orch programming this object type without
+     * a registered contributor also lands here. */
+    uint64_t unaccounted = 0;
+    string canonical;
+    for (const auto &key : asicKeys)
+    {
+        if (!target.canonicalize(key, canonical))
+        {
+            continue;
+        }
+
+        auto it = syncedKeys.find(canonical);
+        if (it != syncedKeys.end())
+        {
+            syncedKeys.erase(it);
+        }
+        else
+        {
+            if (unaccounted < AUDIT_DRILLDOWN_LOG_MAX)
+            {
+                SWSS_LOG_WARN("Audit %s: %s in ASIC_DB but not in synced state",
+                              target.name.c_str(), canonical.c_str());
+            }
+            unaccounted++;
+        }
+    }
+
+    /* Whatever is left was programmed by an Orch but is missing from
+     * ASIC_DB - this is the fault the audit exists to catch */
+    uint64_t missing = 0;
+    for (const auto &key : syncedKeys)
+    {
+        if (missing < AUDIT_DRILLDOWN_LOG_MAX)
+        {
+            SWSS_LOG_ERROR("Audit %s: %s synced but missing from ASIC_DB",
+                           target.name.c_str(), key.c_str());
+        }
+        missing++;
+    }
+
+    SWSS_LOG_NOTICE("Audit %s drill-down: %" PRIu64 " missing, %" PRIu64 " unaccounted",
+                    target.name.c_str(), missing, unaccounted);
+
+    return missing > 0 ? "mismatch" : "unaccounted";
+}
@@ -0,0 +1,65 @@
+#ifndef SWSS_AUDITORCH_H
+#define SWSS_AUDITORCH_H
+
+#include "orch.h"
+#include "auditdigest.h"
+#include "timer.h"
+#include <functional>
+#include <set>
+
+/*
+ * One Orch's share of an audited ASIC_DB table: its live synced-state
+ * digest and, for drill-down, an enumeration of the canonical keys the
+ * digest was built from. Several contributors can feed one target when
+ * more than one Orch programs the same SAI object type.
+ */
+struct AuditContributor
+{
+    std::string name;
+    std::function<AuditDigest()> digest;
+    std::function<void(std::set<std::string> &)> keys;
+};
+
+struct AuditTarget
+{
+    /* Key under STATE_DB AUDIT_STATE */
+    std::string name;
+    /* ASIC_DB key pattern the sweep covers */
+    std::string pattern;
+    /* Map an ASIC_DB key to the canonical form the contributors fold into
+     * their digests; return false to skip a key */
+    std::function<bool(const std::string &, std::string &)> canonicalize;
+    std::vector<AuditContributor> contributors;
+};
+
+class AuditOrch : public Orch
+{
+public:
+    static AuditOrch &getInstance(swss::DBConnector *db = nullptr);
+    virtual void doTask(Consumer &consumer);
+    virtual void doTask(swss::SelectableTimer &timer);
+
+    void registerTarget(AuditTarget target);
+    void registerContributor(const std::string &targetName, AuditContributor contributor);
+
+private:
+    AuditOrch(swss::DBConnector *db, std::vector<std::string> &tableNames);
+    virtual ~AuditOrch(void);
+
+    void auditTarget(AuditTarget &target);
+    AuditDigest syncedDigest(const AuditTarget &target);
+    std::string drillDownStatus(const AuditTarget &target, const std::vector<std::string> &asicKeys);
+
+    bool m_enabled = false;
+    std::vector<AuditTarget> m_targets;
+    /* Round robin cursor; one target is audited per timer tick */
+    size_t m_nextTarget = 0;
+
+    swss::SelectableTimer *m_auditTimer = nullptr;
+
+    std::shared_ptr<swss::DBConnector> m_asicDb;
+    std::shared_ptr<swss::DBConnector> m_stateDb;
+    std::unique_ptr<swss::Table> m_auditTable;
+};
+
+#endif /* SWSS_AUDITORCH_H */
@@ -1,4 +1,5 @@
 #include "bfdorch.h"
+#include "pipelineperf.h"
 #include "intfsorch.h"
 #include "vrforch.h"
 #include "converter.h"
@@ -56,7 +57,8 @@ const map<sai_bfd_session_state_t, string> session_state_lookup =
 
 BfdOrch::BfdOrch(DBConnector *db, string tableName, TableConnector stateDbBfdSessionTable):
     Orch(db, tableName),
-    m_stateBfdSessionTable(stateDbBfdSessionTable.first, stateDbBfdSessionTable.second)
+    m_stateDbPipeline(new RedisPipeline(stateDbBfdSessionTable.first)),
+    m_stateBfdSessionTable(m_stateDbPipeline.get(), stateDbBfdSessionTable.second, true)
 {
     SWSS_LOG_ENTER();
 
@@ -77,6 +79,7 @@ BfdOrch::BfdOrch(DBConnector *db, string tableName, TableConnector stateDbBfdSes
     {
         m_stateBfdSessionTable.del(alias);
     }
+    m_stateDbPipeline->flush();
     // Clean up state database software BFD entries
     m_stateSoftBfdSessionTable->getKeys(keys);
     for (auto alias : keys)
@@ -221,19 +224,30 @@ void BfdOrch::doTask(NotificationConsumer &consumer)
 {
     SWSS_LOG_ENTER();
 
-    std::string op;
-    std::string data;
-    std::vector<swss::FieldValueTuple> values;
-
-    consumer.pop(op, data, values);
-
     if (&consumer != m_bfdStateNotificationConsumer)
     {
         return;
     }
 
-    if (op == "bfd_session_state_change")
+    // During an incast of session flaps the backlog grows faster than one
+    // notification per select loop wake-up can absorb; drain everything
+    // pending and fold repeated transitions down to the last state seen
+    // per session before fanning out to observers
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    consumer.pops(entries);
+
+    std::map<sai_object_id_t, sai_bfd_session_state_t> final_states;
+
+    for (auto &entry : entries)
     {
+        string op = kfvOp(entry);
+        string data = kfvKey(entry);
+
+        if (op != "bfd_session_state_change")
+        {
+            continue;
+        }
+
         uint32_t count;
         sai_bfd_session_state_notification_t *bfdSessionState = nullptr;
 
@@ -246,27 +260,43 @@ void BfdOrch::doTask(NotificationConsumer &consumer)
 
             SWSS_LOG_INFO("Get BFD session state change notification id:%" PRIx64 " state: %s", id, session_state_lookup.at(state).c_str());
 
-            if (state != bfd_session_lookup[id].state)
-            {
-                auto key = bfd_session_lookup[id].peer;
-                m_stateBfdSessionTable.hset(key, "state", session_state_lookup.at(state));
+            final_states[id] = state;
+        }
+
+        sai_deserialize_free_bfd_session_state_ntf(count, bfdSessionState);
+    }
 
-                SWSS_LOG_NOTICE("BFD session state for %s changed from %s to %s", key.c_str(),
-                            session_state_lookup.at(bfd_session_lookup[id].state).c_str(), session_state_lookup.at(state).c_str());
+    for (auto &final_state : final_states)
+    {
+        sai_object_id_t id = final_state.first;
+        sai_bfd_session_state_t state = final_state.second;
 
-                BfdUpdate update;
-                update.peer = key;
-                update.state = state;
-                notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&update));
+        if (state != bfd_session_lookup[id].state)
+        {
+            auto key = bfd_session_lookup[id].peer;
+            m_stateBfdSessionTable.hset(key, "state", session_state_lookup.at(state));
 
-                bfd_session_lookup[id].state = state;
-            }
-        }
+            SWSS_LOG_NOTICE("BFD session state for %s changed from %s to %s", key.c_str(),
+                        session_state_lookup.at(bfd_session_lookup[id].state).c_str(), session_state_lookup.at(state).c_str());
 
-        sai_deserialize_free_bfd_session_state_ntf(count, bfdSessionState);
+            BfdUpdate update;
+            update.peer = key;
+            update.state = state;
+            notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&update));
+
+            bfd_session_lookup[id].state = state;
+        }
     }
 }
 
+void BfdOrch::flushResponses()
+{
+    SWSS_LOG_ENTER();
+
+    PipelinePerf::Instance().flushPipeline("BFD_STATE", m_stateDbPipeline.get());
+    Orch::flushResponses();
+}
+
 bool BfdOrch::register_bfd_state_change_notification(void)
 {
     sai_attribute_t  attr;
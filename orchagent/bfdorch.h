@@ -3,6 +3,7 @@
 
 #include "orch.h"
 #include "observer.h"
+#include "redispipeline.h"
 
 struct BfdUpdate
 {
@@ -15,6 +16,7 @@ class BfdOrch: public Orch, public Subject
 public:
     void doTask(Consumer &consumer);
     void doTask(swss::NotificationConsumer &consumer);
+    void flushResponses();
     BfdOrch(swss::DBConnector *db, std::string tableName, TableConnector stateDbBfdSessionTable);
     virtual ~BfdOrch(void);
     void handleTsaStateChange(bool tsaState);
@@ -44,6 +46,10 @@ private:
     std::map<std::string, sai_object_id_t> bfd_session_map;
     std::map<sai_object_id_t, BfdUpdate> bfd_session_lookup;
 
+    // state db writes are buffered and flushed once per select loop
+    // iteration so a mass session bring-up does not pay one redis round
+    // trip per session
+    std::unique_ptr<swss::RedisPipeline> m_stateDbPipeline;
     swss::Table m_stateBfdSessionTable;
 
     std::unique_ptr<swss::DBConnector> m_stateDbConnector;
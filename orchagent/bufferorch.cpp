@@ -52,14 +52,13 @@ std::map<string, std::map<size_t, string>> queue_port_flags;
 
 BufferOrch::BufferOrch(DBConnector *applDb, DBConnector *confDb, DBConnector *stateDb, vector<string> &tableNames) :
     Orch(applDb, tableNames),
-    m_counterNameMapUpdater(new CounterNameMapUpdater("COUNTERS_DB", COUNTERS_BUFFER_POOL_NAME_MAP)),
+    m_counterNameMapUpdater(CounterNameMapUpdater::getUpdater("COUNTERS_DB", COUNTERS_BUFFER_POOL_NAME_MAP)),
     m_countersDb(new DBConnector("COUNTERS_DB", 0)),
     m_stateBufferMaximumValueTable(stateDb, STATE_BUFFER_MAXIMUM_VALUE_TABLE)
 {
     SWSS_LOG_ENTER();
     initTableHandlers();
     initBufferReadyLists(applDb, confDb);
-    initFlexCounterGroupTable();
 
     if (gMySwitchType != "dpu")
     {
@@ -231,6 +230,12 @@ void BufferOrch::initBufferConstants()
 
 void BufferOrch::initFlexCounterGroupTable(void)
 {
+    if (m_isFlexCounterGroupTableInitialized)
+    {
+        return;
+    }
+    m_isFlexCounterGroupTableInitialized = true;
+
     string bufferPoolWmPluginName = "watermark_bufferpool.lua";
     string bufferPoolWmSha;
 
@@ -296,6 +301,10 @@ void BufferOrch::generateBufferPoolWatermarkCounterIdList(void)
         return;
     }
 
+    // The group and its watermark plugin are created lazily here rather than
+    // in the constructor so that systems with telemetry disabled never load them
+    initFlexCounterGroupTable();
+
     // Detokenize the SAI watermark stats to a string, separated by comma
     string statList;
     for (const auto &it : bufferPoolWatermarkStatIds)
@@ -624,6 +633,10 @@ task_process_status BufferOrch::processBufferProfile(KeyOpFieldsValuesTuple &tup
     {
         BufferProfileConfig cfg;
         m_bufHlpr.getBufferConfig(cfg, object_name);
+        /* Fields matching the last applied config carry no change for an
+         * existing profile; skip them so a dynamic buffer recalculation only
+         * programs the attributes that actually moved */
+        const auto lastAppliedFieldValueMap = cfg.fieldValueMap;
         vector<sai_attribute_t> attribs;
         for (auto i = kfvFieldsValues(tuple).begin(); i != kfvFieldsValues(tuple).end(); i++)
         {
@@ -634,6 +647,20 @@ task_process_status BufferOrch::processBufferProfile(KeyOpFieldsValuesTuple &tup
 
             SWSS_LOG_DEBUG("FIELD: %s, VALUE: %s", field.c_str(), value.c_str());
 
+            if (SAI_NULL_OBJECT_ID != sai_object && field != buffer_pool_field_name)
+            {
+                auto lastApplied = lastAppliedFieldValueMap.find(field);
+                if (lastApplied != lastAppliedFieldValueMap.end() && lastApplied->second == value)
+                {
+                    if (field == buffer_xoff_field_name)
+                    {
+                        is_lossless = true;
+                    }
+                    SWSS_LOG_DEBUG("Field %s of buffer profile %s is unchanged, skipping", field.c_str(), object_name.c_str());
+                    continue;
+                }
+            }
+
             sai_attribute_t attr;
             if (field == buffer_pool_field_name)
             {
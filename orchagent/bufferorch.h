@@ -153,10 +153,11 @@ private:
 
     Table m_stateBufferMaximumValueTable;
 
-    unique_ptr<CounterNameMapUpdater> m_counterNameMapUpdater;
+    shared_ptr<CounterNameMapUpdater> m_counterNameMapUpdater;
     unique_ptr<DBConnector> m_countersDb;
 
     bool m_isBufferPoolWatermarkCounterIdListGenerated = false;
+    bool m_isFlexCounterGroupTableInitialized = false;
     set<string> m_partiallyAppliedQueues;
 
     // Bulk task buffers per DB operation
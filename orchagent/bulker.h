@@ -1,15 +1,18 @@
 #pragma once
 
 #include <assert.h>
+#include <algorithm>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
 #include <stdexcept>
+#include <future>
 #include <boost/functional/hash.hpp>
 #include <sairedis.h>
 #include "sai.h"
 #include "logger.h"
 #include "sai_serialize.h"
+#include "eventring.h"
 
 typedef sai_status_t (*sai_bulk_set_outbound_ca_to_pa_entry_attribute_fn) (
         _In_ uint32_t object_count,
@@ -111,6 +114,36 @@ static inline bool operator==(const sai_neighbor_entry_t& a, const sai_neighbor_
         ;
 }
 
+static inline bool operator==(const sai_nat_entry_t& a, const sai_nat_entry_t& b)
+{
+    return a.switch_id == b.switch_id
+        && a.vr_id == b.vr_id
+        && a.nat_type == b.nat_type
+        && a.data.key.src_ip == b.data.key.src_ip
+        && a.data.key.dst_ip == b.data.key.dst_ip
+        && a.data.key.proto == b.data.key.proto
+        && a.data.key.l4_src_port == b.data.key.l4_src_port
+        && a.data.key.l4_dst_port == b.data.key.l4_dst_port
+        && a.data.mask.src_ip == b.data.mask.src_ip
+        && a.data.mask.dst_ip == b.data.mask.dst_ip
+        && a.data.mask.proto == b.data.mask.proto
+        && a.data.mask.l4_src_port == b.data.mask.l4_src_port
+        && a.data.mask.l4_dst_port == b.data.mask.l4_dst_port
+        ;
+}
+
+static inline bool operator==(const sai_my_sid_entry_t& a, const sai_my_sid_entry_t& b)
+{
+    return a.switch_id == b.switch_id
+        && a.vr_id == b.vr_id
+        && a.locator_block_len == b.locator_block_len
+        && a.locator_node_len == b.locator_node_len
+        && a.function_len == b.function_len
+        && a.args_len == b.args_len
+        && memcmp(a.sid, b.sid, sizeof(a.sid)) == 0
+        ;
+}
+
 static inline bool operator==(const sai_inbound_routing_entry_t& a, const sai_inbound_routing_entry_t& b)
 {
     return a.switch_id == b.switch_id
@@ -240,6 +273,41 @@ namespace std
         }
     };
   
+    template <>
+    struct hash<sai_nat_entry_t>
+    {
+        size_t operator()(const sai_nat_entry_t& a) const noexcept
+        {
+            size_t seed = 0;
+            boost::hash_combine(seed, a.switch_id);
+            boost::hash_combine(seed, a.vr_id);
+            boost::hash_combine(seed, a.nat_type);
+            boost::hash_combine(seed, a.data.key.src_ip);
+            boost::hash_combine(seed, a.data.key.dst_ip);
+            boost::hash_combine(seed, a.data.key.proto);
+            boost::hash_combine(seed, a.data.key.l4_src_port);
+            boost::hash_combine(seed, a.data.key.l4_dst_port);
+            return seed;
+        }
+    };
+
+    template <>
+    struct hash<sai_my_sid_entry_t>
+    {
+        size_t operator()(const sai_my_sid_entry_t& a) const noexcept
+        {
+            size_t seed = 0;
+            boost::hash_combine(seed, a.switch_id);
+            boost::hash_combine(seed, a.vr_id);
+            boost::hash_combine(seed, a.locator_block_len);
+            boost::hash_combine(seed, a.locator_node_len);
+            boost::hash_combine(seed, a.function_len);
+            boost::hash_combine(seed, a.args_len);
+            boost::hash_combine(seed, a.sid);
+            return seed;
+        }
+    };
+
     template <>
     struct hash<sai_outbound_ca_to_pa_entry_t>
     {
@@ -384,6 +452,45 @@ struct SaiBulkerTraits<sai_next_hop_api_t>
     using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_vlan_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_vlan_api_t;
+    using create_entry_fn = sai_create_vlan_member_fn;
+    using remove_entry_fn = sai_remove_vlan_member_fn;
+    using set_entry_attribute_fn = sai_set_vlan_member_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_stp_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_stp_api_t;
+    using create_entry_fn = sai_create_stp_port_fn;
+    using remove_entry_fn = sai_remove_stp_port_fn;
+    using set_entry_attribute_fn = sai_set_stp_port_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_tunnel_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_tunnel_api_t;
+    using create_entry_fn = sai_create_tunnel_term_table_entry_fn;
+    using remove_entry_fn = sai_remove_tunnel_term_table_entry_fn;
+    using set_entry_attribute_fn = sai_set_tunnel_term_table_entry_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_mpls_api_t>
 {
@@ -410,6 +517,32 @@ struct SaiBulkerTraits<sai_neighbor_api_t>
     using bulk_set_entry_attribute_fn = sai_bulk_set_neighbor_entry_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_nat_api_t>
+{
+    using entry_t = sai_nat_entry_t;
+    using api_t = sai_nat_api_t;
+    using create_entry_fn = sai_create_nat_entry_fn;
+    using remove_entry_fn = sai_remove_nat_entry_fn;
+    using set_entry_attribute_fn = sai_set_nat_entry_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_create_nat_entry_fn;
+    using bulk_remove_entry_fn = sai_bulk_remove_nat_entry_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_set_nat_entry_attribute_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_srv6_api_t>
+{
+    using entry_t = sai_my_sid_entry_t;
+    using api_t = sai_srv6_api_t;
+    using create_entry_fn = sai_create_my_sid_entry_fn;
+    using remove_entry_fn = sai_remove_my_sid_entry_fn;
+    using set_entry_attribute_fn = sai_set_my_sid_entry_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_create_my_sid_entry_fn;
+    using bulk_remove_entry_fn = sai_bulk_remove_my_sid_entry_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_set_my_sid_entry_attribute_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_dash_meter_api_t>
 {
@@ -537,10 +670,7 @@ public:
         assert(attr_list);
         if (!attr_list) throw std::invalid_argument("attr_list is null");
 
-        auto rc = creating_entries.emplace(std::piecewise_construct,
-                std::forward_as_tuple(*entry),
-                std::forward_as_tuple());
-        auto it = rc.first;
+        auto rc = creating_tokens.emplace(*entry, creating_entries.size());
         bool inserted = rc.second;
         if (!inserted)
         {
@@ -549,11 +679,12 @@ public:
             return *object_status;
         }
 
-        create_order.push_back(it->first);
-        auto& attrs = it->second.first;
-        attrs.insert(attrs.end(), attr_list, attr_list + attr_count);
-        it->second.second = object_status;
-        SWSS_LOG_INFO("EntityBulker.create_entry %zu, %zu, %d\n", creating_entries.size(), it->second.first.size(), inserted);
+        creating_entries.emplace_back();
+        auto& queued = creating_entries.back();
+        queued.entry = *entry;
+        queued.attrs.insert(queued.attrs.end(), attr_list, attr_list + attr_count);
+        queued.object_status = object_status;
+        SWSS_LOG_INFO("EntityBulker.create_entry %zu, %zu, %d\n", creating_entries.size(), queued.attrs.size(), inserted);
         *object_status = SAI_STATUS_NOT_EXECUTED;
         return *object_status;
     }
@@ -567,36 +698,40 @@ public:
         assert(entry);
         if (!entry) throw std::invalid_argument("entry is null");
 
-        auto found_setting = setting_entries.find(*entry);
-        if (found_setting != setting_entries.end())
+        auto found_setting = setting_tokens.find(*entry);
+        if (found_setting != setting_tokens.end())
         {
-            // Mark old one as done
-            auto& attrs = found_setting->second;
-            for (auto& attr: attrs)
+            // Mark old ones as done and cancel their queued slots
+            for (auto token: found_setting->second)
             {
-                *attr.second = SAI_STATUS_SUCCESS;
+                *setting_entries[token].object_status = SAI_STATUS_SUCCESS;
+                setting_entries[token].object_status = nullptr;
             }
             // Erase old one
-            setting_entries.erase(found_setting);
+            setting_tokens.erase(found_setting);
         }
 
-        auto found_creating = creating_entries.find(*entry);
-        if (found_creating != creating_entries.end())
+        auto found_creating = creating_tokens.find(*entry);
+        if (found_creating != creating_tokens.end())
         {
-            // Mark old ones as done
-            *found_creating->second.second = SAI_STATUS_SUCCESS;
+            // Mark old one as done and cancel its queued slot
+            *creating_entries[found_creating->second].object_status = SAI_STATUS_SUCCESS;
+            creating_entries[found_creating->second].object_status = nullptr;
             // Erase old one
-            creating_entries.erase(found_creating);
+            creating_tokens.erase(found_creating);
             // No need to keep in bulker, claim success immediately
             *object_status = SAI_STATUS_SUCCESS;
-            SWSS_LOG_INFO("EntityBulker.remove_entry quickly removed %zu, creating_entries.size=%zu\n", removing_entries.size(), creating_entries.size());
+            SWSS_LOG_INFO("EntityBulker.remove_entry quickly removed %zu, creating_entries.size=%zu\n", removing_entries.size(), creating_tokens.size());
             return *object_status;
         }
-        auto rc = removing_entries.emplace(std::piecewise_construct,
-                std::forward_as_tuple(*entry),
-                std::forward_as_tuple(object_status));
-        remove_order.push_back(rc.first->first);
+        auto rc = removing_tokens.emplace(*entry, removing_entries.size());
         bool inserted = rc.second;
+        if (inserted)
+        {
+            removing_entries.emplace_back();
+            removing_entries.back().entry = *entry;
+            removing_entries.back().object_status = object_status;
+        }
         SWSS_LOG_INFO("EntityBulker.remove_entry %zu, %d\n", removing_entries.size(), inserted);
 
         *object_status = SAI_STATUS_NOT_EXECUTED;
@@ -615,51 +750,47 @@ public:
         assert(attr);
         if (!attr) throw std::invalid_argument("attr is null");
 
-        auto rc = setting_entries.emplace(std::piecewise_construct,
-                std::forward_as_tuple(*entry),
-                std::forward_as_tuple());
-        auto it = rc.first;
-        set_order.push_back(it->first);
+        // Remember the token of the queued attr under its entry
+        setting_tokens[*entry].push_back(setting_entries.size());
 
-        // Insert or find the key (entry)
-        auto& attrs = it->second;
-
-        // Insert attr
-        attrs.emplace_back(std::piecewise_construct,
-                std::forward_as_tuple(*attr),
-                std::forward_as_tuple(object_status));
+        setting_entries.emplace_back();
+        setting_entries.back().entry = *entry;
+        setting_entries.back().attr = *attr;
+        setting_entries.back().object_status = object_status;
         *object_status = SAI_STATUS_NOT_EXECUTED;
     }
 
     void flush()
     {
+        EventRing::record(OrchEvent::BulkerFlushBegin,
+                          reinterpret_cast<uintptr_t>(this),
+                          removing_entries.size() + creating_entries.size() + setting_entries.size());
+
         // Removing
         if (!removing_entries.empty())
         {
             std::vector<Te> rs;
+            std::vector<sai_status_t*> status_vector;
+            rs.reserve(std::min(removing_entries.size(), max_bulk_size));
+            status_vector.reserve(std::min(removing_entries.size(), max_bulk_size));
 
-            for (auto const& entry : remove_order)
+            for (auto const& queued : removing_entries)
             {
-                auto i = removing_entries.find(entry);
-                if (i == removing_entries.end())
-                {
-                    continue;
-                }
-                sai_status_t *object_status = i->second;
-                if (*object_status == SAI_STATUS_NOT_EXECUTED)
+                if (queued.object_status && *queued.object_status == SAI_STATUS_NOT_EXECUTED)
                 {
-                    rs.push_back(entry);
+                    rs.push_back(queued.entry);
+                    status_vector.push_back(queued.object_status);
 
                     if (rs.size() >= max_bulk_size)
                     {
-                        flush_removing_entries(rs);
+                        flush_removing_entries(rs, status_vector);
                     }
                 }
             }
-            flush_removing_entries(rs);
+            flush_removing_entries(rs, status_vector);
 
             removing_entries.clear();
-            remove_order.clear();
+            removing_tokens.clear();
         }
 
         // Creating
@@ -668,32 +799,31 @@ public:
             std::vector<Te> rs;
             std::vector<sai_attribute_t const*> tss;
             std::vector<uint32_t> cs;
+            std::vector<sai_status_t*> status_vector;
+            rs.reserve(std::min(creating_entries.size(), max_bulk_size));
+            tss.reserve(std::min(creating_entries.size(), max_bulk_size));
+            cs.reserve(std::min(creating_entries.size(), max_bulk_size));
+            status_vector.reserve(std::min(creating_entries.size(), max_bulk_size));
 
-            for (auto const& entry : create_order)
+            for (auto const& queued : creating_entries)
             {
-                auto i = creating_entries.find(entry);
-                if (i == creating_entries.end())
+                if (queued.object_status && *queued.object_status == SAI_STATUS_NOT_EXECUTED)
                 {
-                    continue;
-                }
-                auto const& attrs = i->second.first;
-                sai_status_t *object_status = i->second.second;
-                if (*object_status == SAI_STATUS_NOT_EXECUTED)
-                {
-                    rs.push_back(entry);
-                    tss.push_back(attrs.data());
-                    cs.push_back((uint32_t)attrs.size());
+                    rs.push_back(queued.entry);
+                    tss.push_back(queued.attrs.data());
+                    cs.push_back((uint32_t)queued.attrs.size());
+                    status_vector.push_back(queued.object_status);
 
                     if (rs.size() >= max_bulk_size)
                     {
-                        flush_creating_entries(rs, tss, cs);
+                        flush_creating_entries(rs, tss, cs, status_vector);
                     }
                 }
             }
-            flush_creating_entries(rs, tss, cs);
+            flush_creating_entries(rs, tss, cs, status_vector);
 
             creating_entries.clear();
-            create_order.clear();
+            creating_tokens.clear();
         }
 
         // Setting
@@ -702,33 +832,27 @@ public:
             std::vector<Te> rs;
             std::vector<sai_attribute_t> ts;
             std::vector<sai_status_t*> status_vector;
-            // Use a set to keep track of the entries that have been processed.
-            std::unordered_set<Te> entries;
+            rs.reserve(std::min(setting_entries.size(), max_bulk_size));
+            ts.reserve(std::min(setting_entries.size(), max_bulk_size));
+            status_vector.reserve(std::min(setting_entries.size(), max_bulk_size));
 
-            for (auto const& entry : set_order)
+            for (auto const& queued : setting_entries)
             {
-                // Skip the entry if it is alreay processed.
-                // All attributes of an entry are processed in the first run.
-                if (entries.count(entry) != 0)
-                {
-                    continue;
-                }
-                auto i = setting_entries.find(entry);
-                if (i == setting_entries.end())
+                // All attributes of an entry are processed in the first run;
+                // the token list is dropped once the entry is grouped.
+                auto i = setting_tokens.find(queued.entry);
+                if (i == setting_tokens.end())
                 {
                     continue;
                 }
-                entries.insert(entry);
-                auto const& attrs = i->second;
-                for (auto const& ia: attrs)
+                for (auto token: i->second)
                 {
-                    auto const& attr = ia.first;
-                    sai_status_t *object_status = ia.second;
-                    if (*object_status == SAI_STATUS_NOT_EXECUTED)
+                    auto const& slot = setting_entries[token];
+                    if (slot.object_status && *slot.object_status == SAI_STATUS_NOT_EXECUTED)
                     {
-                        rs.push_back(entry);
-                        ts.push_back(attr);
-                        status_vector.push_back(object_status);
+                        rs.push_back(slot.entry);
+                        ts.push_back(slot.attr);
+                        status_vector.push_back(slot.object_status);
 
                         if (rs.size() >= max_bulk_size)
                         {
@@ -736,11 +860,37 @@ public:
                         }
                     }
                 }
+                setting_tokens.erase(i);
             }
             flush_setting_entries(rs, ts, status_vector);
 
             setting_entries.clear();
-            set_order.clear();
+            setting_tokens.clear();
+        }
+
+        EventRing::record(OrchEvent::BulkerFlushEnd,
+                          reinterpret_cast<uintptr_t>(this));
+    }
+
+    /*
+     * Submit the queued entries asynchronously. The SAI bulk calls run on a
+     * worker task; the caller may keep doing status-independent work and
+     * must call wait() before reading any object status or touching the
+     * bulker again. Statuses are written through the pointers handed to
+     * create/set/remove_entry, exactly as with a synchronous flush().
+     */
+    void flush_async()
+    {
+        wait();
+        m_pendingFlush = std::async(std::launch::async, [this]{ flush(); });
+    }
+
+    /* Block until a flush_async() submission has completed (no-op otherwise) */
+    void wait()
+    {
+        if (m_pendingFlush.valid())
+        {
+            m_pendingFlush.get();
         }
     }
 
@@ -749,78 +899,89 @@ public:
         removing_entries.clear();
         creating_entries.clear();
         setting_entries.clear();
-        remove_order.clear();
-        create_order.clear();
-        set_order.clear();
+        removing_tokens.clear();
+        creating_tokens.clear();
+        setting_tokens.clear();
     }
 
     size_t creating_entries_count() const
     {
-        return creating_entries.size();
+        return creating_tokens.size();
     }
 
     size_t setting_entries_count() const
     {
-        return setting_entries.size();
+        return setting_tokens.size();
     }
 
     size_t removing_entries_count() const
     {
-        return removing_entries.size();
+        return removing_tokens.size();
     }
 
     size_t creating_entries_count(const Te& entry) const
     {
-        return creating_entries.count(entry);
+        return creating_tokens.count(entry);
     }
 
     bool bulk_entry_pending_removal(const Te& entry) const
     {
-        return removing_entries.find(entry) != removing_entries.end();
+        return removing_tokens.find(entry) != removing_tokens.end();
     }
 
     bool bulk_entry_pending_removal_or_set(const Te& entry) const
     {
-        return removing_entries.find(entry) != removing_entries.end() ||
-               setting_entries.find(entry) != setting_entries.end();
+        return removing_tokens.find(entry) != removing_tokens.end() ||
+               setting_tokens.find(entry) != setting_tokens.end();
     }
 
 private:
-    std::unordered_map<                                     // A map of
-            Te,                                             // entry ->
-            std::pair<
-                    std::vector<sai_attribute_t>,           // (attributes, OUT object_status)
-                    sai_status_t *
-            >
-    >                                                       creating_entries;
+    /*
+     * Queued operations live in flat, submission-ordered vectors that
+     * flush() walks contiguously. The token maps translate an entry to
+     * its index (completion token) in the matching vector and serve
+     * deduplication, cancellation and the pending-state queries. A
+     * cancelled slot keeps its place but has a null object_status.
+     */
+    struct creating_entry
+    {
+        Te entry;
+        std::vector<sai_attribute_t> attrs;
+        sai_status_t *object_status;                        // OUT object_status, null if cancelled
+    };
 
-    std::unordered_map<                                     // A map of
-            Te,                                             // entry ->
-            std::vector<                                    //     vector of attribute and status
-                    std::pair<
-                            sai_attribute_t,                //     (attr_value, OUT object_status)
-                            sai_status_t *
-                    >
-            >
-    >                                                       setting_entries;
+    struct setting_entry
+    {
+        Te entry;
+        sai_attribute_t attr;
+        sai_status_t *object_status;                        // OUT object_status, null if cancelled
+    };
 
-    std::unordered_map<                                     // A map of
-            Te,                                             // entry ->
-            sai_status_t *                                  // OUT object_status
-    >                                                       removing_entries;
+    struct removing_entry
+    {
+        Te entry;
+        sai_status_t *object_status;                        // OUT object_status
+    };
+
+    std::vector<creating_entry>                             creating_entries;
+    std::vector<setting_entry>                              setting_entries;
+    std::vector<removing_entry>                             removing_entries;
 
-    std::vector<Te>                                         create_order;
-    std::vector<Te>                                         set_order;
-    std::vector<Te>                                         remove_order;
+    std::unordered_map<Te, size_t>                          creating_tokens;
+    std::unordered_map<Te, std::vector<size_t>>             setting_tokens;
+    std::unordered_map<Te, size_t>                          removing_tokens;
 
     size_t max_bulk_size;
 
+    std::future<void>                                       m_pendingFlush;
+
     typename Ts::bulk_create_entry_fn                       create_entries;
     typename Ts::bulk_remove_entry_fn                       remove_entries;
     typename Ts::bulk_set_entry_attribute_fn                set_entries_attribute;
 
     sai_status_t flush_removing_entries(
-        _Inout_ std::vector<Te> &rs)
+        _Inout_ std::vector<Te> &rs,
+        _Inout_ std::vector<sai_status_t*> &status_vector)
     {
         if (rs.empty())
         {
@@ -841,8 +1002,7 @@ private:
 
         for (size_t ir = 0; ir < count; ir++)
         {
-            auto& entry = rs[ir];
-            sai_status_t *object_status = removing_entries[entry];
+            sai_status_t *object_status = status_vector[ir];
             if (object_status)
             {
                 *object_status = statuses[ir];
@@ -850,6 +1010,7 @@ private:
         }
 
         rs.clear();
+        status_vector.clear();
 
         return status;
     }
@@ -857,7 +1018,8 @@ private:
     sai_status_t flush_creating_entries(
         _Inout_ std::vector<Te> &rs,
         _Inout_ std::vector<sai_attribute_t const*> &tss,
-        _Inout_ std::vector<uint32_t> &cs)
+        _Inout_ std::vector<uint32_t> &cs,
+        _Inout_ std::vector<sai_status_t*> &status_vector)
     {
         if (rs.empty())
         {
@@ -879,8 +1041,7 @@ private:
 
         for (size_t ir = 0; ir < count; ir++)
         {
-            auto& entry = rs[ir];
-            sai_status_t *object_status = creating_entries[entry].second;
+            sai_status_t *object_status = status_vector[ir];
             if (object_status)
             {
                 *object_status = statuses[ir];
@@ -890,6 +1051,7 @@ private:
         rs.clear();
         tss.clear();
         cs.clear();
+        status_vector.clear();
 
         return status;
     }
@@ -975,6 +1137,24 @@ inline EntityBulker<sai_neighbor_api_t>::EntityBulker(sai_neighbor_api_t *api, s
     set_entries_attribute = api->set_neighbor_entries_attribute;
 }
 
+template <>
+inline EntityBulker<sai_nat_api_t>::EntityBulker(sai_nat_api_t *api, size_t max_bulk_size) :
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_nat_entries;
+    remove_entries = api->remove_nat_entries;
+    set_entries_attribute = api->set_nat_entries_attribute;
+}
+
+template <>
+inline EntityBulker<sai_srv6_api_t>::EntityBulker(sai_srv6_api_t *api, size_t max_bulk_size) :
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_my_sid_entries;
+    remove_entries = api->remove_my_sid_entries;
+    set_entries_attribute = api->set_my_sid_entries_attribute;
+}
+
 template <>
 inline EntityBulker<sai_dash_inbound_routing_api_t>::EntityBulker(sai_dash_inbound_routing_api_t *api, size_t max_bulk_size) : max_bulk_size(max_bulk_size)
 {
@@ -1097,6 +1277,10 @@ public:
 
     void flush()
     {
+        EventRing::record(OrchEvent::BulkerFlushBegin,
+                          reinterpret_cast<uintptr_t>(this),
+                          removing_entries.size() + creating_entries.size() + setting_entries.size());
+
         // Removing
         if (!removing_entries.empty())
         {
@@ -1173,6 +1357,9 @@ public:
 
             setting_entries.clear();
         }
+
+        EventRing::record(OrchEvent::BulkerFlushEnd,
+                          reinterpret_cast<uintptr_t>(this));
     }
 
     void clear()
@@ -1357,6 +1544,36 @@ inline ObjectBulker<sai_next_hop_api_t>::ObjectBulker(SaiBulkerTraits<sai_next_h
     set_entries_attribute = api->set_next_hops_attribute;
 }
 
+template <>
+inline ObjectBulker<sai_vlan_api_t>::ObjectBulker(SaiBulkerTraits<sai_vlan_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_vlan_members;
+    remove_entries = api->remove_vlan_members;
+    set_entries_attribute = nullptr;
+}
+
+template <>
+inline ObjectBulker<sai_stp_api_t>::ObjectBulker(SaiBulkerTraits<sai_stp_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_stp_ports;
+    remove_entries = api->remove_stp_ports;
+    set_entries_attribute = nullptr;
+}
+
+template <>
+inline ObjectBulker<sai_tunnel_api_t>::ObjectBulker(SaiBulkerTraits<sai_tunnel_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_tunnel_term_table_entries;
+    remove_entries = api->remove_tunnel_term_table_entries;
+    set_entries_attribute = nullptr;
+}
+
 template <>
 inline ObjectBulker<sai_dash_vnet_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_vnet_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
     switch_id(switch_id),
@@ -462,44 +462,9 @@ bool CbfNhg::update(const vector<string> &members, const string &selection_map)
      */
     if (!m_temp_nhgs.empty() && hasSameMembers(members))
     {
-        /* Iterate over the temporary NHGs and check if they were updated. */
-        for (auto member = m_temp_nhgs.begin(); member != m_temp_nhgs.end();)
+        if (!updateTempMembers())
         {
-            const auto &nhg = gNhgOrch->getNhg(member->first);
-
-            /*
-             * If the NHG ID has changed since storing the first occurence,
-             * we have to update the CBF NHG member's attribute.
-             */
-            if (nhg.getId() != member->second)
-            {
-                if (!m_members.at(member->first).updateNhAttr())
-                {
-                    SWSS_LOG_ERROR("Failed to update temporary next hop group "
-                                    "member %s of CBF next hop group %s",
-                                    member->first.c_str(), m_key.c_str());
-                    return false;
-                }
-
-                /* If the NHG was promoted, remove it from the temporary NHG map. */
-                if (!nhg.isTemp())
-                {
-                    member = m_temp_nhgs.erase(member);
-                }
-                /*
-                 * If the NHG was just updated, update its current NHG ID value
-                 * in the map.
-                 */
-                else
-                {
-                    member->second = nhg.getId();
-                    ++member;
-                }
-            }
-            else
-            {
-                ++member;
-            }
+            return false;
         }
     }
     /* If the members are different, update the whole members list. */
@@ -592,6 +557,105 @@ bool CbfNhg::update(const vector<string> &members, const string &selection_map)
     return true;
 }
 
+/*
+ * Purpose: Reprogram the NEXT_HOP attribute of the synced temporary members
+ *          whose NHG ID changed since they were last programmed.  All the
+ *          updates are applied with a single bulk SAI call.
+ *
+ * Params:  None.
+ *
+ * Returns: true, if the operation was successful,
+ *          false, otherwise.
+ */
+bool CbfNhg::updateTempMembers()
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Collect the temporary members whose NHG ID has changed since storing
+     * the first occurence.
+     */
+    vector<string> stale_members;
+    vector<sai_object_id_t> member_ids;
+    vector<sai_attribute_t> member_attrs;
+
+    for (const auto &member : m_temp_nhgs)
+    {
+        const auto &nhg = gNhgOrch->getNhg(member.first);
+
+        if (nhg.getId() == member.second)
+        {
+            continue;
+        }
+
+        const auto &nhgm = m_members.at(member.first);
+
+        if (!nhgm.isSynced())
+        {
+            SWSS_LOG_ERROR("Trying to update next hop attribute of CBF NHG member %s that is not synced",
+                            nhgm.to_string().c_str());
+            throw logic_error("Trying to update attribute of unsynced object.");
+        }
+
+        sai_attribute_t attr;
+        attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+        attr.value.oid = nhg.getId();
+
+        stale_members.push_back(member.first);
+        member_ids.push_back(nhgm.getId());
+        member_attrs.push_back(attr);
+    }
+
+    if (stale_members.empty())
+    {
+        return true;
+    }
+
+    for (size_t base = 0; base < member_ids.size(); base += gMaxBulkSize)
+    {
+        size_t count = min(gMaxBulkSize, member_ids.size() - base);
+        vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+
+        sai_status_t status = sai_next_hop_group_api->set_next_hop_group_members_attribute(
+                                        (uint32_t)count,
+                                        &member_ids[base],
+                                        &member_attrs[base],
+                                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                                        statuses.data());
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto &key = stale_members[base + i];
+
+            if (status != SAI_STATUS_SUCCESS && statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Failed to update temporary next hop group "
+                                "member %s of CBF next hop group %s",
+                                key.c_str(), m_key.c_str());
+                return false;
+            }
+
+            const auto &nhg = gNhgOrch->getNhg(key);
+
+            /* If the NHG was promoted, remove it from the temporary NHG map. */
+            if (!nhg.isTemp())
+            {
+                m_temp_nhgs.erase(key);
+            }
+            /*
+             * If the NHG was just updated, update its current NHG ID value
+             * in the map.
+             */
+            else
+            {
+                m_temp_nhgs[key] = nhg.getId();
+            }
+        }
+    }
+
+    return true;
+}
+
 /*
  * Purpose: Sync the given CBF group members.
  *
@@ -758,40 +822,6 @@ void CbfNhgMember::sync(sai_object_id_t gm_id)
     gNhgOrch->incNhgRefCount(m_key);
 }
 
-/*
- * Purpose: Update the next hop attribute of the member.
- *
- * Params:  None.
- *
- * Returns: true, if the operation was successful,
- *          false, otherwise.
- */
-bool CbfNhgMember::updateNhAttr()
-{
-    SWSS_LOG_ENTER();
-
-    if (!isSynced())
-    {
-        SWSS_LOG_ERROR("Trying to update next hop attribute of CBF NHG member %s that is not synced",
-                        to_string().c_str());
-        throw logic_error("Trying to update attribute of unsynced object.");
-    }
-
-    /*
-     * Fill in the attribute.
-     */
-    sai_attribute_t attr;
-    attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
-    attr.value.oid = getNhgId();
-
-    /*
-     * Set the attribute over SAI.
-     */
-    auto status = sai_next_hop_group_api->set_next_hop_group_member_attribute(m_gm_id, &attr);
-
-    return status == SAI_STATUS_SUCCESS;
-}
-
 /*
  * Purpose: Remove the member, reseting its SAI ID and decrementing the NHG ref
  *          counter.
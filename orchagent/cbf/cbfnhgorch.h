@@ -19,9 +19,6 @@ public:
     /* Get the NHG ID of this member. */
     sai_object_id_t getNhgId() const;
 
-    /* Update the NEXT_HOP attribute of this member. */
-    bool updateNhAttr();
-
     /* Get the index of this group member. */
     uint8_t getIndex() const { return m_index; }
 
@@ -78,6 +75,9 @@ private:
     /* Sync the given members over SAI. */
     bool syncMembers(const set<string> &members) override;
 
+    /* Reprogram the NEXT_HOP attribute of the updated temporary members in one bulk call. */
+    bool updateTempMembers();
+
     /* Get the SAI attributes for creating the members over SAI. */
     vector<sai_attribute_t>
                     createNhgmAttrs(const CbfNhgMember &nhg) const override;
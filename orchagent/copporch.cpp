@@ -420,35 +420,41 @@ bool CoppOrch::createGenetlinkHostIfTable(vector<sai_hostif_trap_type_t> &trap_i
 {
     SWSS_LOG_ENTER();
 
+    /* The entry type and channel type are fixed; cache the attribute set
+     * and patch the trap object and host interface per entry */
+    sai_attribute_t attr;
+    vector<sai_attribute_t> sai_host_table_attr;
+
+    attr.id = SAI_HOSTIF_TABLE_ENTRY_ATTR_TYPE;
+    attr.value.s32 = SAI_HOSTIF_TABLE_ENTRY_TYPE_TRAP_ID;
+    sai_host_table_attr.push_back(attr);
+
+    attr.id = SAI_HOSTIF_TABLE_ENTRY_ATTR_TRAP_ID;
+    attr.value.oid = SAI_NULL_OBJECT_ID;
+    sai_host_table_attr.push_back(attr);
+
+    attr.id = SAI_HOSTIF_TABLE_ENTRY_ATTR_CHANNEL_TYPE;
+    attr.value.s32 =  SAI_HOSTIF_TABLE_ENTRY_CHANNEL_TYPE_GENETLINK;
+    sai_host_table_attr.push_back(attr);
+
+    attr.id = SAI_HOSTIF_TABLE_ENTRY_ATTR_HOST_IF;
+    attr.value.oid = SAI_NULL_OBJECT_ID;
+    sai_host_table_attr.push_back(attr);
+
     for (auto trap_id : trap_id_list)
     {
         auto host_tbl_entry = m_trapid_hostif_table_map.find(trap_id);
 
         if (host_tbl_entry == m_trapid_hostif_table_map.end())
         {
-            sai_object_id_t trap_group_id = m_syncdTrapIds[trap_id].trap_group_obj;
-            auto hostif_map = m_trap_group_hostif_map.find(trap_group_id);
+            const auto &trap_objects = m_syncdTrapIds[trap_id];
+            auto hostif_map = m_trap_group_hostif_map.find(trap_objects.trap_group_obj);
             if (hostif_map != m_trap_group_hostif_map.end())
             {
                 sai_object_id_t hostif_table_entry = SAI_NULL_OBJECT_ID;
-                sai_attribute_t attr;
-                vector<sai_attribute_t> sai_host_table_attr;
-
-                attr.id = SAI_HOSTIF_TABLE_ENTRY_ATTR_TYPE;
-                attr.value.s32 = SAI_HOSTIF_TABLE_ENTRY_TYPE_TRAP_ID;
-                sai_host_table_attr.push_back(attr);
 
-                attr.id = SAI_HOSTIF_TABLE_ENTRY_ATTR_TRAP_ID;
-                attr.value.oid = m_syncdTrapIds[trap_id].trap_obj;
-                sai_host_table_attr.push_back(attr);
-
-                attr.id = SAI_HOSTIF_TABLE_ENTRY_ATTR_CHANNEL_TYPE;
-                attr.value.s32 =  SAI_HOSTIF_TABLE_ENTRY_CHANNEL_TYPE_GENETLINK;
-                sai_host_table_attr.push_back(attr);
-
-                attr.id = SAI_HOSTIF_TABLE_ENTRY_ATTR_HOST_IF;
-                attr.value.oid = hostif_map->second;
-                sai_host_table_attr.push_back(attr);
+                sai_host_table_attr[1].value.oid = trap_objects.trap_obj;
+                sai_host_table_attr[3].value.oid = hostif_map->second;
 
                 sai_status_t status = sai_hostif_api->create_hostif_table_entry(&hostif_table_entry,
                                                                                 gSwitchId,
@@ -500,16 +506,20 @@ bool CoppOrch::applyAttributesToTrapIds(sai_object_id_t trap_group_id,
                                         const vector<sai_hostif_trap_type_t> &trap_id_list,
                                         vector<sai_attribute_t> &trap_id_attribs)
 {
-    for (auto trap_id : trap_id_list)
-    {
-        sai_attribute_t attr;
-        vector<sai_attribute_t> attrs;
+    /* Precompile the attribute set once; only the trap type differs
+     * between the traps of one install */
+    sai_attribute_t attr;
+    vector<sai_attribute_t> attrs;
+
+    attr.id = SAI_HOSTIF_TRAP_ATTR_TRAP_TYPE;
+    attr.value.s32 = SAI_HOSTIF_TRAP_TYPE_START;
+    attrs.push_back(attr);
 
-        attr.id = SAI_HOSTIF_TRAP_ATTR_TRAP_TYPE;
-        attr.value.s32 = trap_id;
-        attrs.push_back(attr);
+    attrs.insert(attrs.end(), trap_id_attribs.begin(), trap_id_attribs.end());
 
-        attrs.insert(attrs.end(), trap_id_attribs.begin(), trap_id_attribs.end());
+    for (auto trap_id : trap_id_list)
+    {
+        attrs[0].value.s32 = trap_id;
 
         sai_object_id_t hostif_trap_id;
         sai_status_t status = sai_hostif_api->create_hostif_trap(&hostif_trap_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
@@ -802,19 +812,19 @@ task_process_status CoppOrch::processCoppRule(Consumer& consumer)
         if (!trap_id_attribs.empty())
         {
             vector<sai_hostif_trap_type_t> group_trap_ids;
-            TrapIdAttribs trap_attr = m_trap_group_trap_id_attrs[trap_group_name];
+            TrapIdAttribs &trap_attr = m_trap_group_trap_id_attrs[trap_group_name];
             getTrapIdsFromTrapGroup(m_trap_group_map[trap_group_name],
                                     group_trap_ids);
             for (auto trap_id : group_trap_ids)
             {
+                sai_object_id_t trap_obj = m_syncdTrapIds[trap_id].trap_obj;
                 for (auto i: trap_id_attribs)
                 {
-                    sai_status = sai_hostif_api->set_hostif_trap_attribute(
-                                                   m_syncdTrapIds[trap_id].trap_obj, &i);
+                    sai_status = sai_hostif_api->set_hostif_trap_attribute(trap_obj, &i);
                     if (sai_status != SAI_STATUS_SUCCESS)
                     {
                         SWSS_LOG_ERROR("Failed to set attribute %d on trap %" PRIx64 ""
-                                " on group %s", i.id, m_syncdTrapIds[trap_id].trap_obj,
+                                " on group %s", i.id, trap_obj,
                                 trap_group_name.c_str());
                         task_process_status handle_status = handleSaiSetStatus(SAI_API_HOSTIF, sai_status);
                         if (handle_status != task_process_status::task_success)
@@ -828,7 +838,6 @@ task_process_status CoppOrch::processCoppRule(Consumer& consumer)
             {
                 trap_attr[i.id] = i.value;
             }
-            m_trap_group_trap_id_attrs[trap_group_name] = trap_attr;
         }
         if (!genetlink_attribs.empty())
         {
@@ -22,7 +22,7 @@ CounterCheckOrch& CounterCheckOrch::getInstance(DBConnector *db)
 }
 
 CounterCheckOrch::CounterCheckOrch(DBConnector *db, vector<string> &tableNames):
-    Orch(db, tableNames),
+    Orch(db, tableNames, counter_orch_pri),
     m_countersDb(new DBConnector("COUNTERS_DB", 0)),
     m_countersTable(new Table(m_countersDb.get(), COUNTERS_TABLE))
 {
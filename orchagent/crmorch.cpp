@@ -491,6 +491,21 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
                 m_timer->setInterval(interv);
                 m_timer->reset();
             }
+            else if ((field.size() > strlen(CRM_POLLING_INTERVAL) + 1) &&
+                     (field.compare(field.size() - strlen(CRM_POLLING_INTERVAL) - 1, string::npos, string("_") + CRM_POLLING_INTERVAL) == 0))
+            {
+                // Per-resource polling interval, e.g. "ipv4_route_polling_interval".
+                // Resources without one keep following the global interval.
+                auto prefix = field.substr(0, field.size() - strlen(CRM_POLLING_INTERVAL) - 1);
+                auto resIt = crmThreshTypeResMap.find(prefix + "_threshold_type");
+                if (resIt == crmThreshTypeResMap.end())
+                {
+                    SWSS_LOG_ERROR("Failed to parse CRM %s configuration. Unknown resource in attribute %s.\n", key.c_str(), field.c_str());
+                    continue;
+                }
+
+                m_resourcesMap.at(resIt->second).pollingInterval = chrono::seconds(to_uint<uint32_t>(value));
+            }
             else if (crmThreshTypeResMap.find(field) != crmThreshTypeResMap.end())
             {
                 auto thresholdType = crmThreshTypeMap.at(value);
@@ -614,6 +629,7 @@ void CrmOrch::decCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 
             // remove ACL_TABLE_STATS in crm database
             m_countersCrmTable->del(getCrmAclTableKey(oid));
+            m_writtenCrmCounters.erase(getCrmAclTableKey(oid));
         }
     }
     catch (...)
@@ -728,12 +744,14 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
             decCrmResUsedCounter(resource);
             m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV4_ACL_RULE).countersMap.erase(getCrmDashAclGroupKey(tableId));
             m_countersCrmTable->del(getCrmDashAclGroupKey(tableId));
+            m_writtenCrmCounters.erase(getCrmDashAclGroupKey(tableId));
         }
         else if (resource == CrmResourceType::CRM_DASH_IPV6_ACL_GROUP)
         {
             decCrmResUsedCounter(resource);
             m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV6_ACL_RULE).countersMap.erase(getCrmDashAclGroupKey(tableId));
             m_countersCrmTable->del(getCrmDashAclGroupKey(tableId));
+            m_writtenCrmCounters.erase(getCrmDashAclGroupKey(tableId));
         }
         else 
         {
@@ -879,6 +897,8 @@ void CrmOrch::getResAvailableCounters()
 {
     SWSS_LOG_ENTER();
 
+    auto now = chrono::steady_clock::now();
+
     for (auto &res : m_resourcesMap)
     {
         // ignore unsupported resources
@@ -887,6 +907,14 @@ void CrmOrch::getResAvailableCounters()
             continue;
         }
 
+        // honor the per-resource polling cadence when one is configured
+        if ((res.second.pollingInterval.count() != 0) &&
+            (now - res.second.lastPolledAt < res.second.pollingInterval))
+        {
+            continue;
+        }
+        res.second.lastPolledAt = now;
+
         switch (res.first)
         {
             case CrmResourceType::CRM_IPV4_ROUTE:
@@ -1077,9 +1105,17 @@ void CrmOrch::updateCrmCountersTable()
 
             for (const auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.usedCounter));
+                auto value = to_string(cnt.second.usedCounter);
+                auto &written = m_writtenCrmCounters[cnt.first][i.first];
+                if (written == value)
+                {
+                    continue;
+                }
+
+                FieldValueTuple attr(i.first, value);
                 vector<FieldValueTuple> attrs = { attr };
                 m_countersCrmTable->set(cnt.first, attrs);
+                written = value;
             }
         }
         catch(const out_of_range &e)
@@ -1101,9 +1137,17 @@ void CrmOrch::updateCrmCountersTable()
 
             for (const auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.availableCounter));
+                auto value = to_string(cnt.second.availableCounter);
+                auto &written = m_writtenCrmCounters[cnt.first][i.first];
+                if (written == value)
+                {
+                    continue;
+                }
+
+                FieldValueTuple attr(i.first, value);
                 vector<FieldValueTuple> attrs = { attr };
                 m_countersCrmTable->set(cnt.first, attrs);
+                written = value;
             }
         }
         catch(const out_of_range &e)
@@ -1133,6 +1177,19 @@ void CrmOrch::checkCrmThresholds()
             uint32_t percentageUtil = 0;
             string threshType = "";
 
+            /* Only a counter movement can change the verdict; while an alarm
+             * is raised keep evaluating so the repeated warnings and the
+             * eventual clear still go out */
+            if ((cnt.usedCounter == cnt.lastCheckedUsed) &&
+                (cnt.availableCounter == cnt.lastCheckedAvailable) &&
+                (cnt.exceededLogCounter == 0))
+            {
+                continue;
+            }
+
+            cnt.lastCheckedUsed = cnt.usedCounter;
+            cnt.lastCheckedAvailable = cnt.availableCounter;
+
             if (cnt.usedCounter != 0)
             {
                 uint32_t dvsr = cnt.usedCounter + cnt.availableCounter;
@@ -104,6 +104,11 @@ private:
         uint32_t availableCounter = 0;
         uint32_t usedCounter = 0;
         uint32_t exceededLogCounter = 0;
+
+        // Values seen by the last threshold evaluation; while both are
+        // unchanged and no alarm is pending the evaluation is skipped
+        uint32_t lastCheckedAvailable = 0;
+        uint32_t lastCheckedUsed = 0;
     };
 
     struct CrmResourceEntry
@@ -119,12 +124,20 @@ private:
         std::map<std::string, CrmResourceCounter> countersMap;
 
         CrmResourceStatus resStatus = CrmResourceStatus::CRM_RES_SUPPORTED;
+
+        // Per-resource polling cadence; zero means follow the global interval
+        std::chrono::seconds pollingInterval = std::chrono::seconds(0);
+        std::chrono::steady_clock::time_point lastPolledAt;
     };
 
     std::chrono::seconds m_pollingInterval;
 
     std::map<CrmResourceType, CrmResourceEntry> m_resourcesMap;
 
+    // Last written counter values per COUNTERS_DB key/field, so unchanged
+    // values are not rewritten on every polling interval
+    std::map<std::string, std::map<std::string, std::string>> m_writtenCrmCounters;
+
     void doTask(Consumer &consumer);
     void handleSetCommand(const std::string& key, const std::vector<swss::FieldValueTuple>& data);
     void doTask(swss::SelectableTimer &timer);
@@ -1,5 +1,7 @@
 #include <boost/iterator/counting_iterator.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <map>
 
 #include "dashaclgroupmgr.h"
@@ -91,6 +93,52 @@ bool from_pb(const dash::acl_group::AclGroup &data, DashAclGroup& group)
     return true;
 }
 
+static bool prefixEqual(const sai_ip_prefix_t &lhs, const sai_ip_prefix_t &rhs)
+{
+    if (lhs.addr_family != rhs.addr_family)
+    {
+        return false;
+    }
+
+    if (lhs.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+    {
+        return lhs.addr.ip4 == rhs.addr.ip4 && lhs.mask.ip4 == rhs.mask.ip4;
+    }
+
+    return memcmp(lhs.addr.ip6, rhs.addr.ip6, sizeof(lhs.addr.ip6)) == 0 &&
+           memcmp(lhs.mask.ip6, rhs.mask.ip6, sizeof(lhs.mask.ip6)) == 0;
+}
+
+bool operator==(const DashAclRule &lhs, const DashAclRule &rhs)
+{
+    auto prefixes_equal = [](const vector<sai_ip_prefix_t> &l, const vector<sai_ip_prefix_t> &r)
+    {
+        return l.size() == r.size() && equal(l.begin(), l.end(), r.begin(), prefixEqual);
+    };
+
+    auto ranges_equal = [](const vector<sai_u16_range_t> &l, const vector<sai_u16_range_t> &r)
+    {
+        return l.size() == r.size() && equal(l.begin(), l.end(), r.begin(),
+            [](const sai_u16_range_t &lr, const sai_u16_range_t &rr)
+            {
+                return lr.min == rr.min && lr.max == rr.max;
+            });
+    };
+
+    // Tags are compared by name: tag prefix churn does not reprogram
+    // existing rules, so the names fully describe what was programmed
+    return lhs.m_priority == rhs.m_priority &&
+           lhs.m_action == rhs.m_action &&
+           lhs.m_terminating == rhs.m_terminating &&
+           lhs.m_protocols == rhs.m_protocols &&
+           prefixes_equal(lhs.m_src_prefixes, rhs.m_src_prefixes) &&
+           prefixes_equal(lhs.m_dst_prefixes, rhs.m_dst_prefixes) &&
+           lhs.m_src_tags == rhs.m_src_tags &&
+           lhs.m_dst_tags == rhs.m_dst_tags &&
+           ranges_equal(lhs.m_src_ports, rhs.m_src_ports) &&
+           ranges_equal(lhs.m_dst_ports, rhs.m_dst_ports);
+}
+
 sai_attr_id_t getSaiStage(DashAclDirection d, sai_ip_addr_family_t f, DashAclStage s)
 {
     const static map<tuple<DashAclDirection, sai_ip_addr_family_t, DashAclStage>, sai_attr_id_t> StageMaps =
@@ -378,6 +426,29 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
     return rule_info;
 }
 
+void DashAclGroupMgr::removeRule(DashAclGroup& group, DashAclRuleInfo& rule_info)
+{
+    SWSS_LOG_ENTER();
+
+    if (rule_info.m_dash_acl_rule_id == SAI_NULL_OBJECT_ID)
+    {
+        return;
+    }
+
+    auto status = sai_dash_acl_api->remove_dash_acl_rule(rule_info.m_dash_acl_rule_id);
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to remove ACL rule: %d, %s", status, sai_serialize_status(status).c_str());
+        handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, status);
+    }
+
+    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+    gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+
+    rule_info.m_dash_acl_rule_id = SAI_NULL_OBJECT_ID;
+}
+
 task_process_status DashAclGroupMgr::createRule(const string& group_id, const string& rule_id, DashAclRule& rule)
 {
     SWSS_LOG_ENTER();
@@ -408,9 +479,26 @@ task_process_status DashAclGroupMgr::createRule(const string& group_id, const st
         }
     }
 
-    auto rule_info = createRule(group, rule);
+    auto rule_it = group.m_rules.find(rule_id);
+    if (rule_it != group.m_rules.end())
+    {
+        if (rule_it->second.m_spec == rule)
+        {
+            SWSS_LOG_INFO("ACL rule %s:%s is unchanged", group_id.c_str(), rule_id.c_str());
+            return task_success;
+        }
+
+        // Only this rule is reprogrammed; the rest of the group stays untouched
+        removeRule(group, rule_it->second.m_info);
+        rule_it->second.m_info = createRule(group, rule);
+        rule_it->second.m_spec = rule;
+    }
+    else
+    {
+        auto rule_info = createRule(group, rule);
+        group.m_rules.emplace(rule_id, DashAclRuleEntry{rule, rule_info});
+    }
 
-    group.m_rule_count++;
     attachTags(group_id, group.m_tags);
 
     SWSS_LOG_INFO("Created ACL rule %s:%s", group_id.c_str(), rule_id.c_str());
@@ -448,7 +536,7 @@ task_process_status DashAclGroupMgr::bind(const string& group_id, const string&
 
     auto& group = group_it->second;
 
-    if (group.m_rule_count == 0)
+    if (group.m_rules.empty())
     {
         SWSS_LOG_INFO("Failed to bind ACL group %s to ENI %s. ACL group has no rules attached.", group_id.c_str(), eni_id.c_str());
         return task_failed;
@@ -51,6 +51,8 @@ struct DashAclRule
     std::vector<sai_u16_range_t> m_dst_ports;
 };
 
+bool operator==(const DashAclRule &lhs, const DashAclRule &rhs);
+
 struct DashAclRuleInfo
 {
     sai_object_id_t m_dash_acl_rule_id = SAI_NULL_OBJECT_ID;
@@ -64,12 +66,19 @@ struct DashAclRuleInfo
     bool isTagUsed(const std::string &tag_id) const;
 };
 
+struct DashAclRuleEntry
+{
+    // last programmed spec, diffed against re-pushes so unchanged rules are skipped
+    DashAclRule m_spec;
+    DashAclRuleInfo m_info;
+};
+
 struct DashAclGroup
 {
     using EniTable = std::unordered_map<std::string, std::unordered_set<DashAclStage>>;
     sai_object_id_t m_dash_acl_group_id = SAI_NULL_OBJECT_ID;
     std::unordered_set<std::string> m_tags;
-    int m_rule_count = 0;
+    std::unordered_map<std::string, DashAclRuleEntry> m_rules;
 
     sai_ip_addr_family_t m_ip_version;
     
@@ -118,6 +127,7 @@ private:
     void remove(DashAclGroup& group);
 
     DashAclRuleInfo createRule(DashAclGroup& group, DashAclRule& rule);
+    void removeRule(DashAclGroup& group, DashAclRuleInfo& rule_info);
 
     void bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
     void unbind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
@@ -113,6 +113,8 @@ void DashAclOrch::doTask(ConsumerBase &consumer)
      };
 
     const string &table_name = consumer.getTableName();
+    // Resolve this table's workers once; the drain loop dispatches on the op alone
+    const auto table_tasks = tableTasks(TaskMap, table_name);
     auto itr = consumer.m_toSync.begin();
     while (itr != consumer.m_toSync.end())
     {
@@ -120,8 +122,8 @@ void DashAclOrch::doTask(ConsumerBase &consumer)
         auto &message = itr->second;
         const string &op = kfvOp(message);
 
-        auto task = TaskMap.find(make_tuple(table_name, op));
-        if (task != TaskMap.end())
+        auto task = table_tasks.find(op);
+        if (task != table_tasks.end())
         {
             task_status = task->second->process(kfvKey(message), kfvFieldsValues(message));
         }
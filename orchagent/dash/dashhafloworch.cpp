@@ -14,6 +14,7 @@
 
 #include <chrono>
 #include <cinttypes>
+#include <deque>
 #include <sstream>
 #include <iomanip>
 #include <map>
@@ -463,8 +464,15 @@ task_process_status BulkSyncHandler::createSession()
 void BulkSyncHandler::handleFinished()
 {
     SWSS_LOG_ENTER();
-    FlowApiHandler::updateState("completed", m_key, {{"type", DashHaFlowOrch::SESSION_TYPE_BULK_SYNC}});
-    SWSS_LOG_NOTICE("Flow sync session %s completed successfully", m_key.c_str());
+
+    // Published so the HA control plane can gauge sync rate per switchover
+    auto sync_duration_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - m_creation_time).count();
+
+    vector<FieldValueTuple> fvs;
+    fvs.push_back(FieldValueTuple("type", DashHaFlowOrch::SESSION_TYPE_BULK_SYNC));
+    fvs.push_back(FieldValueTuple("sync_duration_in_ms", to_string(sync_duration_ms)));
+    FlowApiHandler::updateState("completed", m_key, fvs);
+    SWSS_LOG_NOTICE("Flow sync session %s completed successfully in %" PRId64 " ms", m_key.c_str(), static_cast<int64_t>(sync_duration_ms));
     deleteSession();
     reset();
 }
@@ -848,19 +856,25 @@ void DashHaFlowOrch::doTask(NotificationConsumer &consumer)
 {
     SWSS_LOG_ENTER();
 
-    std::string notification_name;
-    std::string data;
-    std::vector<FieldValueTuple> values;
+    // Drain everything queued at once; a busy sync session can raise many
+    // events between select wake-ups
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    consumer.pops(entries);
 
-    consumer.pop(notification_name, data, values);
-
-    if (notification_name == SAI_SWITCH_NOTIFICATION_NAME_FLOW_BULK_GET_SESSION_EVENT)
-    {
-        handleSessionNotification(notification_name, data, values);
-    }
-    else
+    for (auto &entry : entries)
     {
-        SWSS_LOG_WARN("Unknown notification: %s", notification_name.c_str());
+        string notification_name = kfvOp(entry);
+        string data = kfvKey(entry);
+        const vector<FieldValueTuple> &values = kfvFieldsValues(entry);
+
+        if (notification_name == SAI_SWITCH_NOTIFICATION_NAME_FLOW_BULK_GET_SESSION_EVENT)
+        {
+            handleSessionNotification(notification_name, data, values);
+        }
+        else
+        {
+            SWSS_LOG_WARN("Unknown notification: %s", notification_name.c_str());
+        }
     }
 }
 
@@ -997,7 +1011,10 @@ void DashHaFlowOrch::handleSessionNotification(const string &notification_name,
     {
         if (event_data[i].event_type == SAI_FLOW_BULK_GET_SESSION_EVENT_FINISHED)
         {
+            // A session finishes once; the handler resets on the first sweep,
+            // so duplicate FINISHED events in one payload are dropped here
             handleSessionFinished(flow_bulk_session_id);
+            break;
         }
     }
 
@@ -324,6 +324,7 @@ bool DashMeterOrch::addMeterRule(const string& key, MeterRuleBulkContext& ctxt)
         SWSS_LOG_INFO("Retry for rule %s as meter policy %s not found", key.c_str(), ctxt.meter_policy.c_str());
         return false;
     }
+    ctxt.addr_family = getMeterPolicyAddrFamily(ctxt.meter_policy);
 
     auto& object_ids = ctxt.object_ids;
     vector<sai_attribute_t> meter_rule_attrs;
@@ -376,7 +377,7 @@ bool DashMeterOrch::addMeterRulePost(const string& key, const MeterRuleBulkConte
     meter_rule_entries_[key] = { id, ctxt.metadata, ctxt.meter_policy, ctxt.rule_num };
     incrMeterPolicyRuleCount(ctxt.meter_policy);
 
-    gCrmOrch->incCrmResUsedCounter(isV4(ctxt.meter_policy) ? CrmResourceType::CRM_DASH_IPV4_METER_RULE : CrmResourceType::CRM_DASH_IPV6_METER_RULE);
+    gCrmOrch->incCrmResUsedCounter((ctxt.addr_family == SAI_IP_ADDR_FAMILY_IPV4) ? CrmResourceType::CRM_DASH_IPV4_METER_RULE : CrmResourceType::CRM_DASH_IPV6_METER_RULE);
     SWSS_LOG_INFO("Meter Rule entry for %s added", key.c_str());
 
     return true;
@@ -398,6 +399,8 @@ bool DashMeterOrch::removeMeterRule(const string& key, MeterRuleBulkContext& ctx
         return true;
     }
 
+    ctxt.addr_family = getMeterPolicyAddrFamily(ctxt.meter_policy);
+
     auto& object_statuses = ctxt.object_statuses;
     object_statuses.emplace_back();
     meter_rule_bulker_.remove_entry(&object_statuses.back(),
@@ -433,7 +436,7 @@ bool DashMeterOrch::removeMeterRulePost(const string& key, const MeterRuleBulkCo
         }
     }
 
-    gCrmOrch->decCrmResUsedCounter(isV4(ctxt.meter_policy) ? CrmResourceType::CRM_DASH_IPV4_METER_RULE : CrmResourceType::CRM_DASH_IPV6_METER_RULE);
+    gCrmOrch->decCrmResUsedCounter((ctxt.addr_family == SAI_IP_ADDR_FAMILY_IPV4) ? CrmResourceType::CRM_DASH_IPV4_METER_RULE : CrmResourceType::CRM_DASH_IPV6_METER_RULE);
     meter_rule_entries_.erase(key);
     decrMeterPolicyRuleCount(ctxt.meter_policy);
     SWSS_LOG_INFO("Meter rule entry removed for %s", key.c_str());
@@ -472,12 +475,9 @@ void DashMeterOrch::doTaskMeterRuleTable(ConsumerBase& consumer)
             string& meter_policy = ctxt.meter_policy;
             uint32_t& rule_num   = ctxt.rule_num;
 
-            vector<string> keys = tokenize(key, ':');
-            meter_policy = keys[0];
-            string rule_num_str;
-            size_t pos = key.find(":", meter_policy.length());
-            rule_num_str = key.substr(pos + 1);
-            rule_num = stoi(rule_num_str);
+            size_t pos = key.find(':');
+            meter_policy = key.substr(0, pos);
+            rule_num = stoi(key.substr(pos + 1));
 
             if (op == SET_COMMAND)
             {
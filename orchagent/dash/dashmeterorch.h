@@ -38,6 +38,9 @@ struct MeterRuleBulkContext
 {
     std::string meter_policy;
     uint32_t rule_num;
+    // Address family of the owning policy, resolved once at admission so the
+    // post-flush sweep does not probe the policy table per rule
+    sai_ip_addr_family_t addr_family = SAI_IP_ADDR_FAMILY_IPV4;
     dash::meter_rule::MeterRule metadata;
     std::deque<sai_object_id_t> object_ids;
     std::deque<sai_status_t> object_statuses;
@@ -541,12 +541,13 @@ bool DashOrch::setEniAdminState(const string& eni, const EniEntry& entry)
     SWSS_LOG_ENTER();
 
     bool eni_enable = entry.metadata.admin_state() == dash::eni::State::STATE_ENABLED;
+    EniEntry &cached_entry = eni_entries_[eni];
 
     sai_attribute_t eni_attr;
     eni_attr.id = SAI_ENI_ATTR_ADMIN_STATE;
     eni_attr.value.booldata = eni_enable;
 
-    sai_status_t status = sai_dash_eni_api->set_eni_attribute(eni_entries_[eni].eni_id,
+    sai_status_t status = sai_dash_eni_api->set_eni_attribute(cached_entry.eni_id,
                                 &eni_attr);
     if (status != SAI_STATUS_SUCCESS)
     {
@@ -557,7 +558,7 @@ bool DashOrch::setEniAdminState(const string& eni, const EniEntry& entry)
             return parseHandleSaiStatusFailure(handle_status);
         }
     }
-    eni_entries_[eni].metadata.set_admin_state(entry.metadata.admin_state());
+    cached_entry.metadata.set_admin_state(entry.metadata.admin_state());
     SWSS_LOG_NOTICE("Set ENI %s admin state to %s", eni.c_str(), eni_enable ? "UP" : "DOWN");
 
     return true;
@@ -807,6 +808,7 @@ bool DashOrch::addEniTrustedVnis(const std::string& eni, const EniEntry& entry)
     trusted_vni_entry.eni_id = entry.eni_id;
     sai_u32_range_t vni_range;
     bool success = true;
+    EniEntry &cached_entry = eni_entries_[eni];
 
     for (int i = 0; i < entry.metadata.trusted_vnis_list_size(); i++)
     {
@@ -831,7 +833,7 @@ bool DashOrch::addEniTrustedVnis(const std::string& eni, const EniEntry& entry)
                 continue;
             }
         }
-        eni_entries_[eni].metadata.mutable_trusted_vnis_list()->Add()->CopyFrom(vni_range_pb);
+        cached_entry.metadata.mutable_trusted_vnis_list()->Add()->CopyFrom(vni_range_pb);
         SWSS_LOG_NOTICE("Created ENI trusted vni entry for ENI %s with range %u-%u",
                         entry.metadata.eni_id().c_str(), vni_range.min, vni_range.max);
     }
@@ -862,9 +864,10 @@ bool DashOrch::addEni(const string& eni, EniEntry &entry)
     {
         return false;
     }
-    eni_entries_[eni] = entry;
+    EniEntry &cached_entry = eni_entries_[eni];
+    cached_entry = entry;
     // clear out the trusted VNIs list. They will be readded by addEniTrustedVni() after successful creation to ensure that internal cache state is consistent with SAI state
-    eni_entries_[eni].metadata.clear_trusted_vnis_list();
+    cached_entry.metadata.clear_trusted_vnis_list();
 
     if (!entry.metadata.trusted_vnis_list().empty())
     {
@@ -897,7 +900,7 @@ bool DashOrch::removeEniObject(const string& eni)
 {
     SWSS_LOG_ENTER();
 
-    EniEntry entry = eni_entries_[eni];
+    const EniEntry &entry = eni_entries_[eni];
     DashMeterOrch *dash_meter_orch = gDirectory.get<DashMeterOrch*>();
 
     MeterCounter.removeFromFC(entry.eni_id, eni);
@@ -945,7 +948,7 @@ bool DashOrch::removeEniAddrMapEntry(const string& eni)
 {
     SWSS_LOG_ENTER();
 
-    EniEntry entry = eni_entries_[eni];
+    const EniEntry &entry = eni_entries_[eni];
     sai_eni_ether_address_map_entry_t eni_ether_address_map_entry;
     eni_ether_address_map_entry.switch_id = gSwitchId;
     memcpy(eni_ether_address_map_entry.address, entry.metadata.mac_address().c_str(), sizeof(sai_mac_t));
@@ -981,6 +984,7 @@ bool DashOrch::removeEniTrustedVnis(const std::string& eni, const EniEntry& entr
     trusted_vni_entry.eni_id = entry.eni_id;
     sai_u32_range_t vni_range;
     bool success = true;
+    EniEntry &cached_entry = eni_entries_[eni];
 
     for (int i = entry.metadata.trusted_vnis_list_size() - 1; i >= 0; i--)
     {
@@ -1005,7 +1009,7 @@ bool DashOrch::removeEniTrustedVnis(const std::string& eni, const EniEntry& entr
                 continue;
             }
         }
-        eni_entries_[eni].metadata.mutable_trusted_vnis_list()->RemoveLast();
+        cached_entry.metadata.mutable_trusted_vnis_list()->RemoveLast();
         SWSS_LOG_NOTICE("Removed ENI trusted vni entry for ENI %s with range %u-%u",
                         entry.metadata.eni_id().c_str(), vni_range.min, vni_range.max);
     }
@@ -1016,15 +1020,16 @@ bool DashOrch::removeEni(const string& eni)
 {
     SWSS_LOG_ENTER();
 
-    if (eni_entries_.find(eni) == eni_entries_.end())
+    auto it = eni_entries_.find(eni);
+    if (it == eni_entries_.end())
     {
         SWSS_LOG_WARN("ENI %s does not exist", eni.c_str());
         return true;
     }
 
-    if (!eni_entries_[eni].metadata.trusted_vnis_list().empty())
+    if (!it->second.metadata.trusted_vnis_list().empty())
     {
-        bool all_trusted_vnis_removed = removeEniTrustedVnis(eni, eni_entries_[eni]);
+        bool all_trusted_vnis_removed = removeEniTrustedVnis(eni, it->second);
         if (!all_trusted_vnis_removed)
         {
             SWSS_LOG_ERROR("Failed to remove all trusted vni entries for ENI %s.", eni.c_str());
@@ -1037,7 +1042,7 @@ bool DashOrch::removeEni(const string& eni)
         return false;
     }
 
-    eni_entries_.erase(eni);
+    eni_entries_.erase(it);
 
     return true;
 }
@@ -1183,7 +1188,8 @@ bool DashOrch::setEniRoute(const std::string& eni, const dash::eni_route::EniRou
     SWSS_LOG_ENTER();
 
 
-    if (eni_entries_.find(eni) == eni_entries_.end())
+    auto eni_it = eni_entries_.find(eni);
+    if (eni_it == eni_entries_.end())
     {
         SWSS_LOG_INFO("ENI %s not yet created, not programming ENI route entry", eni.c_str());
         return false;
@@ -1198,12 +1204,13 @@ bool DashOrch::setEniRoute(const std::string& eni, const dash::eni_route::EniRou
     }
 
     std::string old_group_id;
-    if (eni_route_entries_.find(eni) != eni_route_entries_.end())
+    auto route_it = eni_route_entries_.find(eni);
+    if (route_it != eni_route_entries_.end())
     {
-        if (eni_route_entries_[eni].group_id() != entry.group_id())
+        if (route_it->second.group_id() != entry.group_id())
         {
-            old_group_id = eni_route_entries_[eni].group_id();
-            SWSS_LOG_INFO("Updating route entry from %s to %s for ENI %s", eni_route_entries_[eni].group_id().c_str(), entry.group_id().c_str(), eni.c_str());
+            old_group_id = route_it->second.group_id();
+            SWSS_LOG_INFO("Updating route entry from %s to %s for ENI %s", old_group_id.c_str(), entry.group_id().c_str(), eni.c_str());
         }
         else
         {
@@ -1216,7 +1223,7 @@ bool DashOrch::setEniRoute(const std::string& eni, const dash::eni_route::EniRou
     eni_attr.id = SAI_ENI_ATTR_OUTBOUND_ROUTING_GROUP_ID;
     eni_attr.value.oid = route_group_oid;
 
-    sai_status_t status = sai_dash_eni_api->set_eni_attribute(eni_entries_[eni].eni_id,
+    sai_status_t status = sai_dash_eni_api->set_eni_attribute(eni_it->second.eni_id,
                                 &eni_attr);
 
     if (status != SAI_STATUS_SUCCESS)
@@ -1244,19 +1251,21 @@ bool DashOrch::removeEniRoute(const std::string& eni)
 {
     SWSS_LOG_ENTER();
 
-    if (eni_route_entries_.find(eni) == eni_route_entries_.end())
+    auto route_it = eni_route_entries_.find(eni);
+    if (route_it == eni_route_entries_.end())
     {
         SWSS_LOG_WARN("ENI route entry does not exist for %s", eni.c_str());
         return true;
     }
 
-    if (eni_entries_.find(eni) != eni_entries_.end())
+    auto eni_it = eni_entries_.find(eni);
+    if (eni_it != eni_entries_.end())
     {
         sai_attribute_t eni_attr;
         eni_attr.id = SAI_ENI_ATTR_OUTBOUND_ROUTING_GROUP_ID;
         eni_attr.value.oid = SAI_NULL_OBJECT_ID;
 
-        sai_status_t status = sai_dash_eni_api->set_eni_attribute(eni_entries_[eni].eni_id,
+        sai_status_t status = sai_dash_eni_api->set_eni_attribute(eni_it->second.eni_id,
                                     &eni_attr);
         if (status != SAI_STATUS_SUCCESS)
         {
@@ -1270,8 +1279,8 @@ bool DashOrch::removeEniRoute(const std::string& eni)
     }
 
     DashRouteOrch *dash_route_orch = gDirectory.get<DashRouteOrch*>();
-    dash_route_orch->unbindRouteGroup(eni_route_entries_[eni].group_id());
-    eni_route_entries_.erase(eni);
+    dash_route_orch->unbindRouteGroup(route_it->second.group_id());
+    eni_route_entries_.erase(route_it);
 
     SWSS_LOG_NOTICE("Removed ENI route entry for %s", eni.c_str());
 
@@ -44,7 +44,9 @@ struct EniEntry
     sai_object_id_t getOid() const { return eni_id; }
 };
 
-typedef std::map<std::string, EniEntry> EniTable;
+// Hashed by ENI name: resolution is on every route/ACL/mapping hot path, and
+// node stability keeps EniEntry pointers handed out by getEni() valid
+typedef std::unordered_map<std::string, EniEntry> EniTable;
 
 using DashEniCounter = DashCounter<CounterType::ENI, EniTable>;
 using DashMeterCounter = DashCounter<CounterType::DASH_METER, EniTable>;
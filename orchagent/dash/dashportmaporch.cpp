@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <cstring>
+
 #include "dashportmaporch.h"
 #include "orch.h"
 #include "dashorch.h"
@@ -17,6 +20,19 @@ static const std::unordered_map<dash::outbound_port_map_range::PortMapRangeActio
         {dash::outbound_port_map_range::PortMapRangeAction::ACTION_MAP_PRIVATE_LINK_SERVICE,
          SAI_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY_ACTION_MAP_TO_PRIVATE_LINK_SERVICE}};
 
+static bool sameBackendIp(const sai_ip_address_t &lhs, const sai_ip_address_t &rhs)
+{
+    if (lhs.addr_family != rhs.addr_family)
+    {
+        return false;
+    }
+    if (lhs.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+    {
+        return lhs.addr.ip4 == rhs.addr.ip4;
+    }
+    return memcmp(lhs.addr.ip6, rhs.addr.ip6, sizeof(lhs.addr.ip6)) == 0;
+}
+
 DashPortMapOrch::DashPortMapOrch(swss::DBConnector *db, std::vector<std::string> &tables, swss::DBConnector *app_state_db, swss::ZmqServer *zmqServer) : ZmqOrch(db, tables, zmqServer),
                                                                                                                                                          port_map_bulker_(sai_dash_outbound_port_map_api, gSwitchId, gMaxBulkSize),
                                                                                                                                                          port_map_range_bulker_(sai_dash_outbound_port_map_api, gMaxBulkSize)
@@ -273,6 +289,8 @@ bool DashPortMapOrch::removePortMapPost(const std::string &port_map_id, DashPort
     }
 
     port_map_table_.erase(port_map_id);
+    port_map_range_config_.erase(port_map_id);
+    programmed_port_map_ranges_.erase(port_map_id);
     SWSS_LOG_NOTICE("Removed port map %s", port_map_id.c_str());
     return true;
 }
@@ -282,30 +300,18 @@ void DashPortMapOrch::doTaskPortMapRangeTable(ConsumerBase &consumer)
     SWSS_LOG_ENTER();
 
     auto it = consumer.m_toSync.begin();
-    uint32_t result;
 
-    std::map<std::pair<std::string, std::string>,
-             DashPortMapRangeBulkContext>
-        toBulk;
+    std::map<std::string, DashPortMapRangeDiffContext> toBulk;
     while (it != consumer.m_toSync.end())
     {
         swss::KeyOpFieldsValuesTuple tuple = it->second;
         std::string key = kfvKey(tuple);
         std::string op = kfvOp(tuple);
-        auto rc = toBulk.emplace(std::piecewise_construct,
-                                 std::forward_as_tuple(key, op),
-                                 std::forward_as_tuple());
-        bool inserted = rc.second;
-        auto &ctxt = rc.first->second;
-        result = DASH_RESULT_FAILURE;
+        std::string parent_map_id;
+        int start_port, end_port;
         SWSS_LOG_INFO("Processing port map range entry: %s, operation: %s", key.c_str(), op.c_str());
 
-        if (!inserted)
-        {
-            ctxt.clear();
-        }
-
-        if (!parsePortMapRange(key, ctxt))
+        if (!parsePortMapRangeKey(key, parent_map_id, start_port, end_port))
         {
             SWSS_LOG_ERROR("Failed to parse port map range key: %s", key.c_str());
             it = consumer.m_toSync.erase(it);
@@ -314,36 +320,59 @@ void DashPortMapOrch::doTaskPortMapRangeTable(ConsumerBase &consumer)
 
         if (op == SET_COMMAND)
         {
-            if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata))
+            dash::outbound_port_map_range::OutboundPortMapRange metadata;
+            if (!parsePbMessage(kfvFieldsValues(tuple), metadata))
             {
                 SWSS_LOG_ERROR("Failed to parse protobuf message for port map range %s", key.c_str());
                 it = consumer.m_toSync.erase(it);
                 continue;
             }
 
-            if (addPortMapRange(ctxt))
+            DashPortMapRangeConfig cfg;
+            cfg.end_port = end_port;
+            if (!parsePortMapRangeConfig(metadata, cfg))
             {
+                // a retry will not help, so treat it as a failure
                 it = consumer.m_toSync.erase(it);
-                // if we ever remove from consumer early, that means parsing was unsuccessful and a retry will not help,
-                // so treat it as a failure
-                writeResultToDB(dash_port_map_range_result_table_, key, result);
+                writeResultToDB(dash_port_map_range_result_table_, key, DASH_RESULT_FAILURE);
+                continue;
             }
-            else
+
+            if (port_map_table_.find(parent_map_id) == port_map_table_.end())
             {
+                SWSS_LOG_INFO("Parent port map %s does not exist for port map range", parent_map_id.c_str());
                 it++;
+                continue;
             }
+
+            port_map_range_config_[parent_map_id][start_port] = cfg;
+            toBulk[parent_map_id];
+            it++;
         }
         else if (op == DEL_COMMAND)
         {
-            if (removePortMapRange(ctxt))
+            if (port_map_table_.find(parent_map_id) == port_map_table_.end())
             {
+                // this should never happen - it's not possible to create a port map range w/o first creating the parent port map,
+                // and it's not possible to delete a port map while it still has child port map ranges
+                SWSS_LOG_ERROR("Parent port map %s not found for port map range removal", parent_map_id.c_str());
                 it = consumer.m_toSync.erase(it);
                 removeResultFromDB(dash_port_map_range_result_table_, key);
+                continue;
+            }
+
+            auto config_it = port_map_range_config_.find(parent_map_id);
+            if (config_it == port_map_range_config_.end() || config_it->second.erase(start_port) == 0)
+            {
+                // Not part of the compiled state (e.g. programmed before a
+                // restart), so remove the exact range directly
+                toBulk[parent_map_id].removed_ranges.emplace_back(start_port, end_port);
             }
             else
             {
-                it++;
+                toBulk[parent_map_id];
             }
+            it++;
         }
         else
         {
@@ -352,43 +381,59 @@ void DashPortMapOrch::doTaskPortMapRangeTable(ConsumerBase &consumer)
         }
     }
 
+    // Compile the configured ranges of each touched port map into a merged
+    // range set and queue the delta against the programmed state
+    for (auto &bulk_it : toBulk)
+    {
+        queuePortMapRangeDiff(bulk_it.first, bulk_it.second);
+    }
+
     port_map_range_bulker_.flush();
+
+    std::map<std::string, bool> map_results;
+    for (auto &bulk_it : toBulk)
+    {
+        map_results[bulk_it.first] = portMapRangeDiffPost(bulk_it.first, bulk_it.second);
+    }
+
     auto it_prev = consumer.m_toSync.begin();
     while (it_prev != it)
     {
         swss::KeyOpFieldsValuesTuple tuple = it_prev->second;
         std::string key = kfvKey(tuple);
         std::string op = kfvOp(tuple);
-        result = DASH_RESULT_SUCCESS;
-        auto found = toBulk.find(std::make_pair(key, op));
-        if (found == toBulk.end())
+        std::string parent_map_id;
+        int start_port, end_port;
+        if (!parsePortMapRangeKey(key, parent_map_id, start_port, end_port))
         {
-            it_prev++;
+            it_prev = consumer.m_toSync.erase(it_prev);
             continue;
         }
-        auto &ctxt = found->second;
-        if (ctxt.port_map_range_statuses.empty())
+
+        auto result_it = map_results.find(parent_map_id);
+        if (result_it == map_results.end())
         {
+            // parent port map does not exist yet, retry later
             it_prev++;
             continue;
         }
 
         if (op == SET_COMMAND)
         {
-            if (addPortMapRangePost(ctxt))
+            if (result_it->second)
             {
                 it_prev = consumer.m_toSync.erase(it_prev);
+                writeResultToDB(dash_port_map_range_result_table_, key, DASH_RESULT_SUCCESS);
             }
             else
             {
-                result = DASH_RESULT_FAILURE;
+                writeResultToDB(dash_port_map_range_result_table_, key, DASH_RESULT_FAILURE);
                 it_prev++;
             }
-            writeResultToDB(dash_port_map_range_result_table_, key, result);
         }
-        else if (op == DEL_COMMAND)
+        else
         {
-            if (removePortMapRangePost(ctxt))
+            if (result_it->second)
             {
                 it_prev = consumer.m_toSync.erase(it_prev);
                 removeResultFromDB(dash_port_map_range_result_table_, key);
@@ -398,161 +443,195 @@ void DashPortMapOrch::doTaskPortMapRangeTable(ConsumerBase &consumer)
                 it_prev++;
             }
         }
-        else
-        {
-            SWSS_LOG_ERROR("Unknown operation %s", op.c_str());
-            it_prev = consumer.m_toSync.erase(it_prev);
-        }
     }
 }
 
-bool DashPortMapOrch::addPortMapRange(DashPortMapRangeBulkContext &ctxt)
+void DashPortMapOrch::compilePortMapRanges(const std::string &parent_map_id, std::map<int, int> &merged)
 {
     SWSS_LOG_ENTER();
 
-    auto parent_it = port_map_table_.find(ctxt.parent_map_id);
-    if (parent_it == port_map_table_.end())
-    {
-        SWSS_LOG_INFO("Parent port map %s does not exist for port map range", ctxt.parent_map_id.c_str());
-        return false;
-    }
-
-    sai_outbound_port_map_port_range_entry_t entry;
-    entry.switch_id = gSwitchId;
-    entry.outbound_port_map_id = parent_it->second;
-    sai_u32_range_t port_range;
-    port_range.min = ctxt.start_port;
-    port_range.max = ctxt.end_port;
-    entry.dst_port_range = port_range;
-
-    std::vector<sai_attribute_t> attrs;
-    sai_attribute_t attr;
-
-    auto action_it = gPortMapRangeActionMap.find(ctxt.metadata.action());
-    if (action_it == gPortMapRangeActionMap.end())
+    auto config_it = port_map_range_config_.find(parent_map_id);
+    if (config_it == port_map_range_config_.end())
     {
-        SWSS_LOG_ERROR("Unknown port map range action: %s", dash::outbound_port_map_range::PortMapRangeAction_Name(ctxt.metadata.action()).c_str());
-        return true;
+        return;
     }
 
-    attr.id = SAI_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY_ATTR_ACTION;
-    attr.value.s32 = action_it->second;
-    attrs.push_back(attr);
-
-    attr.id = SAI_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY_ATTR_BACKEND_IP;
-    if (!to_sai(ctxt.metadata.backend_ip(), attr.value.ipaddr))
+    // Fold adjacent/overlapping ranges into one entry when they share the
+    // action and backend IP and their backend port bases line up, so the
+    // mapping of every port in the merged range is unchanged
+    int run_start = 0;
+    const DashPortMapRangeConfig *run_head = nullptr;
+    for (const auto &range_it : config_it->second)
     {
-        SWSS_LOG_ERROR("Failed to convert backend IP %s to SAI format", ctxt.metadata.backend_ip().DebugString().c_str());
-        return true;
+        int start_port = range_it.first;
+        const DashPortMapRangeConfig &cfg = range_it.second;
+        if (run_head != nullptr &&
+            start_port <= merged[run_start] + 1 &&
+            cfg.action == run_head->action &&
+            sameBackendIp(cfg.backend_ip, run_head->backend_ip) &&
+            cfg.backend_port_base == run_head->backend_port_base + (uint32_t)(start_port - run_start))
+        {
+            merged[run_start] = std::max(merged[run_start], cfg.end_port);
+        }
+        else
+        {
+            run_start = start_port;
+            run_head = &cfg;
+            merged[run_start] = cfg.end_port;
+        }
     }
-    attrs.push_back(attr);
-
-    attr.id = SAI_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY_ATTR_MATCH_PORT_BASE;
-    attr.value.u32 = ctxt.start_port;
-    attrs.push_back(attr);
-
-    attr.id = SAI_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY_ATTR_BACKEND_PORT_BASE;
-    attr.value.u32 = ctxt.metadata.backend_port_base();
-    attrs.push_back(attr);
-
-    auto &object_statuses = ctxt.port_map_range_statuses;
-    object_statuses.emplace_back();
-    port_map_range_bulker_.create_entry(&object_statuses.back(), &entry, (uint32_t)attrs.size(), attrs.data());
-    SWSS_LOG_INFO("Adding port map range for %s: start=%d, end=%d", ctxt.parent_map_id.c_str(), ctxt.start_port, ctxt.end_port);
-    return false;
 }
 
-bool DashPortMapOrch::addPortMapRangePost(DashPortMapRangeBulkContext &ctxt)
+void DashPortMapOrch::queuePortMapRangeDiff(const std::string &parent_map_id, DashPortMapRangeDiffContext &ctxt)
 {
     SWSS_LOG_ENTER();
 
-    auto &object_statuses = ctxt.port_map_range_statuses;
-    if (object_statuses.empty())
+    auto parent_it = port_map_table_.find(parent_map_id);
+    if (parent_it == port_map_table_.end())
     {
-        return false;
+        return;
     }
 
-    auto it_status = object_statuses.begin();
-    sai_status_t status = *it_status++;
-    if (status != SAI_STATUS_SUCCESS)
+    std::map<int, int> merged;
+    compilePortMapRanges(parent_map_id, merged);
+
+    auto &programmed = programmed_port_map_ranges_[parent_map_id];
+    for (const auto &prog : programmed)
     {
-        if (status == SAI_STATUS_ITEM_ALREADY_EXISTS)
+        auto merged_it = merged.find(prog.first);
+        if (merged_it != merged.end() && merged_it->second == prog.second)
         {
-            SWSS_LOG_INFO("Port map range for %s already exists", ctxt.parent_map_id.c_str());
-            return true;
+            continue;
         }
-        SWSS_LOG_ERROR("Failed to create port map range for %s, status: %s", ctxt.parent_map_id.c_str(), sai_serialize_status(status).c_str());
-        task_process_status handle_status = handleSaiCreateStatus((sai_api_t)SAI_API_DASH_OUTBOUND_PORT_MAP, status);
-        if (handle_status != task_success)
+        auto range = std::make_pair(prog.first, prog.second);
+        if (std::find(ctxt.removed_ranges.begin(), ctxt.removed_ranges.end(), range) == ctxt.removed_ranges.end())
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            ctxt.removed_ranges.push_back(range);
         }
     }
 
-    SWSS_LOG_INFO("Created port map range for %s: start=%d, end=%d", ctxt.parent_map_id.c_str(), ctxt.start_port, ctxt.end_port);
-    return true;
-}
-
-bool DashPortMapOrch::removePortMapRange(DashPortMapRangeBulkContext &ctxt)
-{
-    SWSS_LOG_ENTER();
-
-    auto parent_it = port_map_table_.find(ctxt.parent_map_id);
-    if (parent_it == port_map_table_.end())
+    for (const auto &merged_range : merged)
     {
-        // this should never happen - it's not possible to create a port map range w/o first creating the parent port map,
-        // and it's not possible to delete a port map while it still has child port map ranges
-        SWSS_LOG_ERROR("Parent port map %s not found for port map range removal", ctxt.parent_map_id.c_str());
-        return true;
+        auto prog_it = programmed.find(merged_range.first);
+        if (prog_it != programmed.end() && prog_it->second == merged_range.second)
+        {
+            continue;
+        }
+        ctxt.created_ranges.emplace_back(merged_range.first, merged_range.second);
     }
 
     sai_outbound_port_map_port_range_entry_t entry;
     entry.switch_id = gSwitchId;
     entry.outbound_port_map_id = parent_it->second;
-    sai_u32_range_t port_range;
-    port_range.min = ctxt.start_port;
-    port_range.max = ctxt.end_port;
-    entry.dst_port_range = port_range;
 
-    auto &object_statuses = ctxt.port_map_range_statuses;
-    object_statuses.emplace_back();
-    port_map_range_bulker_.remove_entry(&object_statuses.back(), &entry);
-    SWSS_LOG_NOTICE("Removing port map range for %s: start=%d, end=%d", ctxt.parent_map_id.c_str(), ctxt.start_port, ctxt.end_port);
-    return false;
+    for (const auto &range : ctxt.removed_ranges)
+    {
+        entry.dst_port_range.min = (uint32_t)range.first;
+        entry.dst_port_range.max = (uint32_t)range.second;
+        ctxt.remove_statuses.emplace_back();
+        port_map_range_bulker_.remove_entry(&ctxt.remove_statuses.back(), &entry);
+        SWSS_LOG_NOTICE("Removing port map range for %s: start=%d, end=%d", parent_map_id.c_str(), range.first, range.second);
+    }
+
+    const auto &config = port_map_range_config_[parent_map_id];
+    for (const auto &range : ctxt.created_ranges)
+    {
+        const DashPortMapRangeConfig &cfg = config.at(range.first);
+
+        entry.dst_port_range.min = (uint32_t)range.first;
+        entry.dst_port_range.max = (uint32_t)range.second;
+
+        std::vector<sai_attribute_t> attrs;
+        sai_attribute_t attr;
+
+        attr.id = SAI_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY_ATTR_ACTION;
+        attr.value.s32 = cfg.action;
+        attrs.push_back(attr);
+
+        attr.id = SAI_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY_ATTR_BACKEND_IP;
+        attr.value.ipaddr = cfg.backend_ip;
+        attrs.push_back(attr);
+
+        attr.id = SAI_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY_ATTR_MATCH_PORT_BASE;
+        attr.value.u32 = (uint32_t)range.first;
+        attrs.push_back(attr);
+
+        attr.id = SAI_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY_ATTR_BACKEND_PORT_BASE;
+        attr.value.u32 = cfg.backend_port_base;
+        attrs.push_back(attr);
+
+        ctxt.create_statuses.emplace_back();
+        port_map_range_bulker_.create_entry(&ctxt.create_statuses.back(), &entry, (uint32_t)attrs.size(), attrs.data());
+        SWSS_LOG_INFO("Adding port map range for %s: start=%d, end=%d", parent_map_id.c_str(), range.first, range.second);
+    }
 }
 
-bool DashPortMapOrch::removePortMapRangePost(DashPortMapRangeBulkContext &ctxt)
+bool DashPortMapOrch::portMapRangeDiffPost(const std::string &parent_map_id, DashPortMapRangeDiffContext &ctxt)
 {
     SWSS_LOG_ENTER();
 
-    auto &object_statuses = ctxt.port_map_range_statuses;
-    if (object_statuses.empty())
-    {
-        return false;
-    }
+    bool success = true;
+    auto &programmed = programmed_port_map_ranges_[parent_map_id];
 
-    auto it_status = object_statuses.begin();
-    sai_status_t status = *it_status++;
-    if (status != SAI_STATUS_SUCCESS)
+    auto it_status = ctxt.remove_statuses.begin();
+    for (const auto &range : ctxt.removed_ranges)
     {
-        if (status == SAI_STATUS_ITEM_NOT_FOUND)
+        sai_status_t status = *it_status++;
+        if (status != SAI_STATUS_SUCCESS && status != SAI_STATUS_ITEM_NOT_FOUND)
         {
-            SWSS_LOG_INFO("Port map range for %s already removed", ctxt.parent_map_id.c_str());
-            return true;
+            if (status == SAI_STATUS_NOT_EXECUTED)
+            {
+                SWSS_LOG_INFO("Port map range for %s not removed, will retry later", parent_map_id.c_str());
+                success = false;
+                continue;
+            }
+            SWSS_LOG_ERROR("Failed to remove port map range for %s, status: %s", parent_map_id.c_str(), sai_serialize_status(status).c_str());
+            task_process_status handle_status = handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_OUTBOUND_PORT_MAP, status);
+            if (handle_status != task_success && !parseHandleSaiStatusFailure(handle_status))
+            {
+                success = false;
+            }
+            continue;
         }
-        SWSS_LOG_ERROR("Failed to remove port map range for %s, status: %s", ctxt.parent_map_id.c_str(), sai_serialize_status(status).c_str());
-        task_process_status handle_status = handleSaiCreateStatus((sai_api_t)SAI_API_DASH_OUTBOUND_PORT_MAP, status);
-        if (handle_status != task_success)
+        auto prog_it = programmed.find(range.first);
+        if (prog_it != programmed.end() && prog_it->second == range.second)
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            programmed.erase(prog_it);
         }
+        SWSS_LOG_NOTICE("Removed port map range for %s: start=%d, end=%d", parent_map_id.c_str(), range.first, range.second);
     }
 
-    SWSS_LOG_NOTICE("Removed port map range for %s: start=%d, end=%d", ctxt.parent_map_id.c_str(), ctxt.start_port, ctxt.end_port);
-    return true;
+    it_status = ctxt.create_statuses.begin();
+    for (const auto &range : ctxt.created_ranges)
+    {
+        sai_status_t status = *it_status++;
+        if (status != SAI_STATUS_SUCCESS && status != SAI_STATUS_ITEM_ALREADY_EXISTS)
+        {
+            SWSS_LOG_ERROR("Failed to create port map range for %s, status: %s", parent_map_id.c_str(), sai_serialize_status(status).c_str());
+            task_process_status handle_status = handleSaiCreateStatus((sai_api_t)SAI_API_DASH_OUTBOUND_PORT_MAP, status);
+            if (handle_status != task_success && !parseHandleSaiStatusFailure(handle_status))
+            {
+                success = false;
+            }
+            continue;
+        }
+        programmed[range.first] = range.second;
+        SWSS_LOG_INFO("Created port map range for %s: start=%d, end=%d", parent_map_id.c_str(), range.first, range.second);
+    }
+
+    if (programmed.empty())
+    {
+        programmed_port_map_ranges_.erase(parent_map_id);
+    }
+    auto config_it = port_map_range_config_.find(parent_map_id);
+    if (config_it != port_map_range_config_.end() && config_it->second.empty())
+    {
+        port_map_range_config_.erase(config_it);
+    }
+    return success;
 }
 
-bool DashPortMapOrch::parsePortMapRange(const std::string &key, DashPortMapRangeBulkContext &ctxt)
+bool DashPortMapOrch::parsePortMapRangeKey(const std::string &key, std::string &parent_map_id, int &start_port, int &end_port)
 {
     SWSS_LOG_ENTER();
 
@@ -564,7 +643,7 @@ bool DashPortMapOrch::parsePortMapRange(const std::string &key, DashPortMapRange
         return false;
     }
 
-    ctxt.parent_map_id = key.substr(0, pos);
+    parent_map_id = key.substr(0, pos);
     std::string range = key.substr(pos + 1);
 
     size_t dash_pos = range.find('-');
@@ -576,8 +655,8 @@ bool DashPortMapOrch::parsePortMapRange(const std::string &key, DashPortMapRange
 
     try
     {
-        ctxt.start_port = std::stoi(range.substr(0, dash_pos));
-        ctxt.end_port = std::stoi(range.substr(dash_pos + 1));
+        start_port = std::stoi(range.substr(0, dash_pos));
+        end_port = std::stoi(range.substr(dash_pos + 1));
     }
     catch (const std::invalid_argument &e)
     {
@@ -585,6 +664,28 @@ bool DashPortMapOrch::parsePortMapRange(const std::string &key, DashPortMapRange
         return false;
     }
 
-    SWSS_LOG_INFO("Parsed port range for %s: start=%d, end=%d", ctxt.parent_map_id.c_str(), ctxt.start_port, ctxt.end_port);
+    SWSS_LOG_INFO("Parsed port range for %s: start=%d, end=%d", parent_map_id.c_str(), start_port, end_port);
+    return true;
+}
+
+bool DashPortMapOrch::parsePortMapRangeConfig(const dash::outbound_port_map_range::OutboundPortMapRange &metadata, DashPortMapRangeConfig &cfg)
+{
+    SWSS_LOG_ENTER();
+
+    auto action_it = gPortMapRangeActionMap.find(metadata.action());
+    if (action_it == gPortMapRangeActionMap.end())
+    {
+        SWSS_LOG_ERROR("Unknown port map range action: %s", dash::outbound_port_map_range::PortMapRangeAction_Name(metadata.action()).c_str());
+        return false;
+    }
+    cfg.action = action_it->second;
+
+    if (!to_sai(metadata.backend_ip(), cfg.backend_ip))
+    {
+        SWSS_LOG_ERROR("Failed to convert backend IP %s to SAI format", metadata.backend_ip().DebugString().c_str());
+        return false;
+    }
+
+    cfg.backend_port_base = metadata.backend_port_base();
     return true;
 }
@@ -21,22 +21,28 @@ struct DashPortMapBulkContext
     }
 };
 
-struct DashPortMapRangeBulkContext
+// Validated APPL_DB config for a single port map range, keyed by its start
+// port in the per map config cache
+struct DashPortMapRangeConfig
 {
-    std::string parent_map_id;
-    int start_port;
     int end_port;
-    dash::outbound_port_map_range::OutboundPortMapRange metadata;
-    std::deque<sai_status_t> port_map_range_statuses;
+    sai_outbound_port_map_port_range_entry_action_t action;
+    sai_ip_address_t backend_ip;
+    uint32_t backend_port_base;
+};
 
-    DashPortMapRangeBulkContext() {}
-    DashPortMapRangeBulkContext(const DashPortMapRangeBulkContext &) = delete;
-    DashPortMapRangeBulkContext(DashPortMapRangeBulkContext &) = delete;
+// Per port map diff queued against the bulker in the current drain: merged
+// ranges to remove/create and their statuses, swept after one flush
+struct DashPortMapRangeDiffContext
+{
+    std::vector<std::pair<int, int>> removed_ranges;
+    std::vector<std::pair<int, int>> created_ranges;
+    std::deque<sai_status_t> remove_statuses;
+    std::deque<sai_status_t> create_statuses;
 
-    void clear()
-    {
-        port_map_range_statuses.clear();
-    }
+    DashPortMapRangeDiffContext() {}
+    DashPortMapRangeDiffContext(const DashPortMapRangeDiffContext &) = delete;
+    DashPortMapRangeDiffContext(DashPortMapRangeDiffContext &) = delete;
 };
 
 class DashPortMapOrch : public ZmqOrch
@@ -53,17 +59,21 @@ private:
     bool removePortMap(const std::string &port_map_id, DashPortMapBulkContext &ctxt);
     bool removePortMapPost(const std::string &port_map_id, DashPortMapBulkContext &ctxt);
     void doTaskPortMapRangeTable(ConsumerBase &consumer);
-    bool addPortMapRange(DashPortMapRangeBulkContext &ctxt);
-    bool addPortMapRangePost(DashPortMapRangeBulkContext &ctxt);
-    bool removePortMapRange(DashPortMapRangeBulkContext &ctxt);
-    bool removePortMapRangePost(DashPortMapRangeBulkContext &ctxt);
+    void compilePortMapRanges(const std::string &parent_map_id, std::map<int, int> &merged);
+    void queuePortMapRangeDiff(const std::string &parent_map_id, DashPortMapRangeDiffContext &ctxt);
+    bool portMapRangeDiffPost(const std::string &parent_map_id, DashPortMapRangeDiffContext &ctxt);
 
-    bool parsePortMapRange(const std::string &key, DashPortMapRangeBulkContext &ctxt);
+    bool parsePortMapRangeKey(const std::string &key, std::string &parent_map_id, int &start_port, int &end_port);
+    bool parsePortMapRangeConfig(const dash::outbound_port_map_range::OutboundPortMapRange &metadata, DashPortMapRangeConfig &cfg);
 
     ObjectBulker<sai_dash_outbound_port_map_api_t> port_map_bulker_;
     EntityBulker<sai_dash_outbound_port_map_api_t> port_map_range_bulker_;
 
     std::unordered_map<std::string, sai_object_id_t> port_map_table_;
+    // Configured ranges per port map keyed by start port, and the merged
+    // ranges currently programmed to SAI after compilation
+    std::unordered_map<std::string, std::map<int, DashPortMapRangeConfig>> port_map_range_config_;
+    std::unordered_map<std::string, std::map<int, int>> programmed_port_map_ranges_;
     std::unique_ptr<swss::Table> dash_port_map_result_table_;
     std::unique_ptr<swss::Table> dash_port_map_range_result_table_;
 };
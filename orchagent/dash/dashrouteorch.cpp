@@ -422,7 +422,8 @@ bool DashRouteOrch::addInboundRouting(const string& key, InboundRoutingBulkConte
 {
     SWSS_LOG_ENTER();
 
-    if (!dash_orch_->getEni(ctxt.eni))
+    const EniEntry *eni_entry = dash_orch_->getEni(ctxt.eni);
+    if (!eni_entry)
     {
         SWSS_LOG_INFO("Retry as ENI entry %s not found", ctxt.eni.c_str());
         return false;
@@ -436,7 +437,7 @@ bool DashRouteOrch::addInboundRouting(const string& key, InboundRoutingBulkConte
     sai_inbound_routing_entry_t inbound_routing_entry;
 
     inbound_routing_entry.switch_id = gSwitchId;
-    inbound_routing_entry.eni_id = dash_orch_->getEni(ctxt.eni)->eni_id;
+    inbound_routing_entry.eni_id = eni_entry->eni_id;
     inbound_routing_entry.vni = ctxt.vni;
     swss::copy(inbound_routing_entry.sip, ctxt.sip);
     swss::copy(inbound_routing_entry.sip_mask, ctxt.sip_mask);
@@ -71,7 +71,7 @@ bool DashVnetOrch::addVnet(const string& vnet_name, DashVnetBulkContext& ctxt)
     auto& object_ids = ctxt.object_ids;
     sai_attribute_t dash_vnet_attr;
     dash_vnet_attr.id = SAI_VNET_ATTR_VNI;
-    dash_vnet_attr.value.u32 = ctxt.metadata.vni();
+    dash_vnet_attr.value.u32 = ctxt.metadata->vni();
     object_ids.emplace_back();
     vnet_bulker_.create_entry(&object_ids.back(), attr_count, &dash_vnet_attr);
 
@@ -96,7 +96,7 @@ bool DashVnetOrch::addVnetPost(const string& vnet_name, const DashVnetBulkContex
         return false;
     }
 
-    VnetEntry entry = { id, ctxt.metadata, std::set<std::string>() };
+    VnetEntry entry = { id, *ctxt.metadata, std::set<std::string>() };
     vnet_table_[vnet_name] = entry;
     gVnetNameToId[vnet_name] = id;
 
@@ -181,6 +181,9 @@ void DashVnetOrch::doTaskVnetTable(ConsumerBase& consumer)
         // Map to store vnet bulk op results
         std::map<std::pair<std::string, std::string>,
             DashVnetBulkContext> toBulk;
+        // Arena backing every message decoded in this batch; contexts in
+        // toBulk borrow their metadata from it
+        google::protobuf::Arena arena;
 
         while (it != consumer.m_toSync.end())
         {
@@ -201,7 +204,8 @@ void DashVnetOrch::doTaskVnetTable(ConsumerBase& consumer)
             vnet_ctxt.vnet_name = key;
             if (op == SET_COMMAND)
             {
-                if (!parsePbMessage(kfvFieldsValues(tuple), vnet_ctxt.metadata))
+                vnet_ctxt.metadata = parsePbMessage<dash::vnet::Vnet>(kfvFieldsValues(tuple), arena);
+                if (vnet_ctxt.metadata == nullptr)
                 {
                     SWSS_LOG_WARN("Requires protobuff at Vnet :%s", key.c_str());
                     it = consumer.m_toSync.erase(it);
@@ -312,7 +316,7 @@ bool DashVnetOrch::addOutboundCaToPa(const string& key, VnetMapBulkContext& ctxt
 
     DashOrch* dash_orch = gDirectory.get<DashOrch*>();
     dash::route_type::RouteType route_type_actions;
-    if (!dash_orch->getRouteTypeActions(ctxt.metadata.routing_type(), route_type_actions))
+    if (!dash_orch->getRouteTypeActions(ctxt.metadata->routing_type(), route_type_actions))
     {
         SWSS_LOG_INFO("Failed to get route type actions for %s", key.c_str());
         return false;
@@ -344,19 +348,19 @@ bool DashVnetOrch::addOutboundCaToPa(const string& key, VnetMapBulkContext& ctxt
             }
 
             outbound_ca_to_pa_attr.id = SAI_OUTBOUND_CA_TO_PA_ENTRY_ATTR_UNDERLAY_DIP;
-            to_sai(ctxt.metadata.underlay_ip(), outbound_ca_to_pa_attr.value.ipaddr);
+            to_sai(ctxt.metadata->underlay_ip(), outbound_ca_to_pa_attr.value.ipaddr);
             outbound_ca_to_pa_attrs.push_back(outbound_ca_to_pa_attr); 
 
         }
     }
 
     // Setting SAI attributes that are valid for all values of SAI_OUTBOUND_CA_TO_PA_ENTRY_ATTR_ACTION
-    if (ctxt.metadata.has_tunnel())
+    if (ctxt.metadata->has_tunnel())
     {
-        auto tunnel_oid = gDirectory.get<DashTunnelOrch*>()->getTunnelOid(ctxt.metadata.tunnel());
+        auto tunnel_oid = gDirectory.get<DashTunnelOrch*>()->getTunnelOid(ctxt.metadata->tunnel());
         if (tunnel_oid == SAI_NULL_OBJECT_ID)
         {
-            SWSS_LOG_INFO("Tunnel %s for VnetMap %s does not exist yet", ctxt.metadata.tunnel().c_str(), key.c_str());
+            SWSS_LOG_INFO("Tunnel %s for VnetMap %s does not exist yet", ctxt.metadata->tunnel().c_str(), key.c_str());
             return false;
         }
         outbound_ca_to_pa_attr.id = SAI_OUTBOUND_CA_TO_PA_ENTRY_ATTR_DASH_TUNNEL_ID;
@@ -364,14 +368,14 @@ bool DashVnetOrch::addOutboundCaToPa(const string& key, VnetMapBulkContext& ctxt
         outbound_ca_to_pa_attrs.push_back(outbound_ca_to_pa_attr);
     }
 
-    if (ctxt.metadata.has_metering_class_or())
+    if (ctxt.metadata->has_metering_class_or())
     {
         outbound_ca_to_pa_attr.id = SAI_OUTBOUND_CA_TO_PA_ENTRY_ATTR_METER_CLASS_OR;
-        outbound_ca_to_pa_attr.value.u32 = ctxt.metadata.metering_class_or();
+        outbound_ca_to_pa_attr.value.u32 = ctxt.metadata->metering_class_or();
         outbound_ca_to_pa_attrs.push_back(outbound_ca_to_pa_attr);
     }
 
-    if (ctxt.metadata.routing_type() == dash::route_type::ROUTING_TYPE_PRIVATELINK)
+    if (ctxt.metadata->routing_type() == dash::route_type::ROUTING_TYPE_PRIVATELINK)
     {
         SWSS_LOG_DEBUG("Creating private link outbound CA to PA entry for %s", key.c_str());
         // Setting SAI attributes specific to private link routing type
@@ -384,19 +388,19 @@ bool DashVnetOrch::addOutboundCaToPa(const string& key, VnetMapBulkContext& ctxt
         outbound_ca_to_pa_attrs.push_back(outbound_ca_to_pa_attr);
 
         outbound_ca_to_pa_attr.id = SAI_OUTBOUND_CA_TO_PA_ENTRY_ATTR_OVERLAY_DIP;
-        to_sai(ctxt.metadata.overlay_dip_prefix().ip(), outbound_ca_to_pa_attr.value.ipaddr);
+        to_sai(ctxt.metadata->overlay_dip_prefix().ip(), outbound_ca_to_pa_attr.value.ipaddr);
         outbound_ca_to_pa_attrs.push_back(outbound_ca_to_pa_attr);
 
         outbound_ca_to_pa_attr.id = SAI_OUTBOUND_CA_TO_PA_ENTRY_ATTR_OVERLAY_DIP_MASK;
-        to_sai(ctxt.metadata.overlay_dip_prefix().mask(), outbound_ca_to_pa_attr.value.ipaddr);
+        to_sai(ctxt.metadata->overlay_dip_prefix().mask(), outbound_ca_to_pa_attr.value.ipaddr);
         outbound_ca_to_pa_attrs.push_back(outbound_ca_to_pa_attr);
 
         outbound_ca_to_pa_attr.id = SAI_OUTBOUND_CA_TO_PA_ENTRY_ATTR_OVERLAY_SIP;
-        to_sai(ctxt.metadata.overlay_sip_prefix().ip(), outbound_ca_to_pa_attr.value.ipaddr);
+        to_sai(ctxt.metadata->overlay_sip_prefix().ip(), outbound_ca_to_pa_attr.value.ipaddr);
         outbound_ca_to_pa_attrs.push_back(outbound_ca_to_pa_attr);
 
         outbound_ca_to_pa_attr.id = SAI_OUTBOUND_CA_TO_PA_ENTRY_ATTR_OVERLAY_SIP_MASK;
-        to_sai(ctxt.metadata.overlay_sip_prefix().mask(), outbound_ca_to_pa_attr.value.ipaddr);
+        to_sai(ctxt.metadata->overlay_sip_prefix().mask(), outbound_ca_to_pa_attr.value.ipaddr);
         outbound_ca_to_pa_attrs.push_back(outbound_ca_to_pa_attr);
 
         if (routing_type_tunnel_key != 0)
@@ -406,14 +410,14 @@ bool DashVnetOrch::addOutboundCaToPa(const string& key, VnetMapBulkContext& ctxt
             outbound_ca_to_pa_attrs.push_back(outbound_ca_to_pa_attr);
         }
 
-        if (ctxt.metadata.has_port_map())
+        if (ctxt.metadata->has_port_map())
         {
             auto port_map_oid =
-                gDirectory.get<DashPortMapOrch*>()->getPortMapOid(ctxt.metadata.port_map());
+                gDirectory.get<DashPortMapOrch*>()->getPortMapOid(ctxt.metadata->port_map());
             if (port_map_oid == SAI_NULL_OBJECT_ID)
             {
                 SWSS_LOG_ERROR("Portmap %s for VnetMap %s does not exist yet",
-                               ctxt.metadata.port_map().c_str(), key.c_str());
+                               ctxt.metadata->port_map().c_str(), key.c_str());
                 return false;
             }
             outbound_ca_to_pa_attr.id = SAI_OUTBOUND_CA_TO_PA_ENTRY_ATTR_OUTBOUND_PORT_MAP_ID;
@@ -424,17 +428,17 @@ bool DashVnetOrch::addOutboundCaToPa(const string& key, VnetMapBulkContext& ctxt
     else
     {
         // Setting SAI attributes specific to non-private link routing types
-        if (ctxt.metadata.has_mac_address())
+        if (ctxt.metadata->has_mac_address())
         {
             outbound_ca_to_pa_attr.id = SAI_OUTBOUND_CA_TO_PA_ENTRY_ATTR_OVERLAY_DMAC;
-            memcpy(outbound_ca_to_pa_attr.value.mac, ctxt.metadata.mac_address().c_str(), sizeof(sai_mac_t));
+            memcpy(outbound_ca_to_pa_attr.value.mac, ctxt.metadata->mac_address().c_str(), sizeof(sai_mac_t));
             outbound_ca_to_pa_attrs.push_back(outbound_ca_to_pa_attr);
         }
 
-        if (ctxt.metadata.has_use_dst_vni())
+        if (ctxt.metadata->has_use_dst_vni())
         {
             outbound_ca_to_pa_attr.id = SAI_OUTBOUND_CA_TO_PA_ENTRY_ATTR_USE_DST_VNET_VNI;
-            outbound_ca_to_pa_attr.value.booldata = ctxt.metadata.use_dst_vni();
+            outbound_ca_to_pa_attr.value.booldata = ctxt.metadata->use_dst_vni();
             outbound_ca_to_pa_attrs.push_back(outbound_ca_to_pa_attr);
         }
     }
@@ -452,14 +456,14 @@ void DashVnetOrch::addPaValidation(const string& key, VnetMapBulkContext& ctxt)
     SWSS_LOG_ENTER();
 
     auto& object_statuses = ctxt.pa_validation_object_statuses;
-    string underlay_ip_str = to_string(ctxt.metadata.underlay_ip());
+    string underlay_ip_str = to_string(ctxt.metadata->underlay_ip());
     string pa_ref_key = ctxt.vnet_name + ":" + underlay_ip_str;
 
     auto& vnet_underlay_ips = vnet_table_[ctxt.vnet_name].underlay_ips;
-    std::string underlay_sip_str = to_string(ctxt.metadata.underlay_ip());
+    std::string underlay_sip_str = to_string(ctxt.metadata->underlay_ip());
     if (vnet_underlay_ips.find(underlay_sip_str) != vnet_underlay_ips.end())
     {
-        SWSS_LOG_INFO("Vnet %s already has PA validation entry for IP %s", ctxt.vnet_name.c_str(), to_string(ctxt.metadata.underlay_ip()).c_str());
+        SWSS_LOG_INFO("Vnet %s already has PA validation entry for IP %s", ctxt.vnet_name.c_str(), to_string(ctxt.metadata->underlay_ip()).c_str());
         object_statuses.emplace_back(SAI_STATUS_ITEM_ALREADY_EXISTS);
         return;
     }
@@ -468,7 +472,7 @@ void DashVnetOrch::addPaValidation(const string& key, VnetMapBulkContext& ctxt)
     sai_pa_validation_entry_t pa_validation_entry;
     pa_validation_entry.vnet_id = gVnetNameToId[ctxt.vnet_name];
     pa_validation_entry.switch_id = gSwitchId;
-    to_sai(ctxt.metadata.underlay_ip(), pa_validation_entry.sip);
+    to_sai(ctxt.metadata->underlay_ip(), pa_validation_entry.sip);
     sai_attribute_t pa_validation_attr;
 
     pa_validation_attr.id = SAI_PA_VALIDATION_ENTRY_ATTR_ACTION;
@@ -479,7 +483,7 @@ void DashVnetOrch::addPaValidation(const string& key, VnetMapBulkContext& ctxt)
             attr_count, &pa_validation_attr);
     vnet_table_[ctxt.vnet_name].underlay_ips.insert(underlay_sip_str);
     SWSS_LOG_INFO("Bulk create PA validation entry for Vnet %s underlay IP %s",
-                    ctxt.vnet_name.c_str(), to_string(ctxt.metadata.underlay_ip()).c_str());
+                    ctxt.vnet_name.c_str(), to_string(ctxt.metadata->underlay_ip()).c_str());
 }
 
 bool DashVnetOrch::addVnetMap(const string& key, VnetMapBulkContext& ctxt)
@@ -540,7 +544,7 @@ bool DashVnetOrch::addPaValidationPost(const string& key, const VnetMapBulkConte
     }
 
     auto it_status = object_statuses.begin();
-    string underlay_ip_str = to_string(ctxt.metadata.underlay_ip());
+    string underlay_ip_str = to_string(ctxt.metadata->underlay_ip());
     string pa_ref_key = ctxt.vnet_name + ":" + underlay_ip_str;
     sai_status_t status = *it_status++;
     if (status != SAI_STATUS_SUCCESS)
@@ -558,7 +562,7 @@ bool DashVnetOrch::addPaValidationPost(const string& key, const VnetMapBulkConte
         }
     }
 
-    gCrmOrch->incCrmResUsedCounter(ctxt.metadata.underlay_ip().has_ipv4() ? CrmResourceType::CRM_DASH_IPV4_PA_VALIDATION : CrmResourceType::CRM_DASH_IPV6_PA_VALIDATION);
+    gCrmOrch->incCrmResUsedCounter(ctxt.metadata->underlay_ip().has_ipv4() ? CrmResourceType::CRM_DASH_IPV4_PA_VALIDATION : CrmResourceType::CRM_DASH_IPV6_PA_VALIDATION);
 
     SWSS_LOG_INFO("PA validation entry for %s added", key.c_str());
 
@@ -733,6 +737,9 @@ void DashVnetOrch::doTaskVnetMapTable(ConsumerBase& consumer)
     {
         std::map<std::pair<std::string, std::string>,
             VnetMapBulkContext> toBulk;
+        // Arena backing every mapping decoded in this batch; contexts in
+        // toBulk borrow their metadata from it
+        google::protobuf::Arena arena;
 
         while (it != consumer.m_toSync.end())
         {
@@ -762,20 +769,21 @@ void DashVnetOrch::doTaskVnetMapTable(ConsumerBase& consumer)
 
             if (op == SET_COMMAND)
             {
-                if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata))
+                ctxt.metadata = parsePbMessage<dash::vnet_mapping::VnetMapping>(kfvFieldsValues(tuple), arena);
+                if (ctxt.metadata == nullptr)
                 {
                     SWSS_LOG_WARN("Requires protobuff at VnetMap :%s", key.c_str());
                     it = consumer.m_toSync.erase(it);
                     continue;
                 }
-                if (ctxt.metadata.routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_UNSPECIFIED)
+                if (ctxt.metadata->routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_UNSPECIFIED)
                 {
                     // VnetMapping::action_type is deprecated in favor of VnetMapping::routing_type. For messages still using the old action_type field,
                     // copy it to the new routing_type field. All subsequent operations will use the new field.
                     #pragma GCC diagnostic push
                     #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
                     SWSS_LOG_WARN("VnetMapping::action_type is deprecated. Use VnetMapping::routing_type instead");
-                    ctxt.metadata.set_routing_type(ctxt.metadata.action_type());
+                    ctxt.metadata->set_routing_type(ctxt.metadata->action_type());
                     #pragma GCC diagnostic pop
                 }
                 if (addVnetMap(key, ctxt))
@@ -5,6 +5,7 @@
 #include <set>
 #include <string>
 #include <memory>
+#include <google/protobuf/arena.h>
 #include "bulker.h"
 #include "dbconnector.h"
 #include "ipaddress.h"
@@ -29,7 +30,8 @@ typedef std::unordered_map<std::string, VnetEntry> DashVnetTable;
 struct DashVnetBulkContext
 {
     std::string vnet_name;
-    dash::vnet::Vnet metadata;
+    // decoded on the per-batch arena in doTaskVnetTable; valid for the drain only
+    dash::vnet::Vnet *metadata = nullptr;
     std::deque<sai_object_id_t> object_ids;
     std::deque<sai_status_t> vnet_statuses;
     std::deque<sai_status_t> pa_validation_statuses;
@@ -50,7 +52,8 @@ struct VnetMapBulkContext
 {
     std::string vnet_name;
     swss::IpAddress dip;
-    dash::vnet_mapping::VnetMapping metadata;
+    // decoded on the per-batch arena in doTaskVnetMapTable; valid for the drain only
+    dash::vnet_mapping::VnetMapping *metadata = nullptr;
     std::deque<sai_status_t> outbound_ca_to_pa_object_statuses;
     std::deque<sai_status_t> pa_validation_object_statuses;
     VnetMapBulkContext() {}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstring>
 #include <vector>
 #include <limits>
 
@@ -10,11 +11,73 @@
 
 #include "dash_api/types.pb.h"
 
-bool to_sai(const dash::types::IpVersion &pb_version, sai_ip_addr_family_t &sai_ip_family);
+// The IP converters run once per mapping/route during tenant scale-up, so
+// they are defined inline: no call overhead, no temporaries, and the protobuf
+// bytes are copied straight into the SAI structure
+inline bool to_sai(const dash::types::IpVersion &pb_version, sai_ip_addr_family_t &sai_ip_family)
+{
+    switch (pb_version)
+    {
+    case dash::types::IP_VERSION_IPV4:
+        sai_ip_family = SAI_IP_ADDR_FAMILY_IPV4;
+        break;
+    case dash::types::IP_VERSION_IPV6:
+        sai_ip_family = SAI_IP_ADDR_FAMILY_IPV6;
+        break;
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+inline bool to_sai(const dash::types::IpAddress &pb_address, sai_ip_address_t &sai_address)
+{
+    if (pb_address.has_ipv4())
+    {
+        sai_address.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        sai_address.addr.ip4 = pb_address.ipv4();
+    }
+    else if (pb_address.has_ipv6())
+    {
+        sai_address.addr_family = SAI_IP_ADDR_FAMILY_IPV6;
+        memcpy(sai_address.addr.ip6, pb_address.ipv6().data(), sizeof(sai_address.addr.ip6));
+    }
+    else
+    {
+        SWSS_LOG_WARN("The protobuf IP address %s is invalid", pb_address.DebugString().c_str());
+        return false;
+    }
 
-bool to_sai(const dash::types::IpAddress &pb_address, sai_ip_address_t &sai_address);
+    return true;
+}
+
+inline bool to_sai(const dash::types::IpPrefix &pb_prefix, sai_ip_prefix_t &sai_prefix)
+{
+    if (pb_prefix.ip().has_ipv4() && pb_prefix.mask().has_ipv4())
+    {
+        sai_prefix.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        sai_prefix.addr.ip4 = pb_prefix.ip().ipv4();
+        sai_prefix.mask.ip4 = pb_prefix.mask().ipv4();
+    }
+    else if (pb_prefix.ip().has_ipv6() && pb_prefix.mask().has_ipv6())
+    {
+        sai_prefix.addr_family = SAI_IP_ADDR_FAMILY_IPV6;
+        memcpy(sai_prefix.addr.ip6, pb_prefix.ip().ipv6().data(), sizeof(sai_prefix.addr.ip6));
+        memcpy(sai_prefix.mask.ip6, pb_prefix.mask().ipv6().data(), sizeof(sai_prefix.mask.ip6));
+    }
+    else
+    {
+        SWSS_LOG_WARN("The protobuf IP prefix %s is invalid", pb_prefix.DebugString().c_str());
+        return false;
+    }
+
+    return true;
+}
 
-bool to_sai(const dash::types::IpPrefix &pb_prefix, sai_ip_prefix_t &sai_prefix);
+// Batch conversion into a caller-provided array sized for pb_prefixes.size()
+// entries; nothing is allocated on this path
+bool to_sai(const google::protobuf::RepeatedPtrField<dash::types::IpPrefix> &pb_prefixes, sai_ip_prefix_t *sai_prefixes);
 
 bool to_sai(const google::protobuf::RepeatedPtrField<dash::types::IpPrefix> &pb_prefixes, std::vector<sai_ip_prefix_t> &sai_prefixes);
 
@@ -6,6 +6,7 @@
 #include <string>
 #include <tuple>
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/message.h>
 
 #include <swss/logger.h>
@@ -26,6 +27,28 @@ using TaskKey = std::tuple<const std::string, const std::string>;
 using TaskFunc = std::shared_ptr<TaskWorker>;
 using TaskMap = std::map<TaskKey, TaskFunc>;
 
+/*
+ * Selects the workers registered for one table so a drain loop dispatches
+ * each entry on the op alone instead of rebuilding a (table, op) string
+ * tuple per entry. Workers run synchronously on the orchagent thread --
+ * SAI programming and the orch state they touch are single-threaded -- and
+ * per-key ordering is already guaranteed by the consumer's SyncMap.
+ */
+inline std::map<std::string, TaskFunc> tableTasks(
+    const TaskMap &tasks,
+    const std::string &table)
+{
+    std::map<std::string, TaskFunc> ops;
+    for (const auto &task : tasks)
+    {
+        if (std::get<0>(task.first) == table)
+        {
+            ops.emplace(std::get<1>(task.first), task.second);
+        }
+    }
+    return ops;
+}
+
 #define PbIdentifier "pb"
 
 template<typename MessageType>
@@ -55,6 +78,37 @@ bool parsePbMessage(
     return false;
 }
 
+/*
+ * Arena variant for batch drains: the message and all its submessages are
+ * carved out of the caller's arena, so decoding a whole batch costs a few
+ * block allocations instead of one heap message per entry. The returned
+ * pointer is owned by the arena and stays valid until the arena is destroyed.
+ */
+template<typename MessageType>
+MessageType *parsePbMessage(
+    const std::vector<swss::FieldValueTuple> &data,
+    google::protobuf::Arena &arena)
+{
+    SWSS_LOG_ENTER();
+
+    auto pb = swss::fvsGetValue(data, PbIdentifier);
+    if (pb)
+    {
+        auto *msg = google::protobuf::Arena::CreateMessage<MessageType>(&arena);
+        if (msg->ParseFromString(*pb))
+        {
+            return msg;
+        }
+        SWSS_LOG_WARN("Failed to parse protobuf message from string: %s", pb->c_str());
+    }
+    else
+    {
+        SWSS_LOG_WARN("Protobuf field cannot be found");
+    }
+
+    return nullptr;
+}
+
 template<typename MessageType>
 class PbWorker : public TaskWorker
 {
@@ -197,6 +197,34 @@ void DropCounter::removeDropReason(const std::string& drop_reason)
     }
 }
 
+// Replaces the whole reason list with new_drop_reasons in a single SAI
+// update, so a batch of reason changes costs one set call.
+//
+// If the update fails, this method restores the old reason list and throws
+// a runtime error.
+void DropCounter::setDropReasons(const std::unordered_set<std::string>& new_drop_reasons)
+{
+    SWSS_LOG_ENTER();
+
+    if (new_drop_reasons == drop_reasons)
+    {
+        SWSS_LOG_DEBUG("Drop reasons on '%s' are unchanged", name.c_str());
+        return;
+    }
+
+    std::unordered_set<std::string> old_drop_reasons(drop_reasons);
+    try
+    {
+        drop_reasons = new_drop_reasons;
+        updateDropReasonsInSAI();
+    }
+    catch (const std::runtime_error&)
+    {
+        drop_reasons = old_drop_reasons;
+        throw;
+    }
+}
+
 bool DropCounter::isIngressDropReasonValid(const std::string& drop_reason)
 {
     return ingress_drop_reason_lookup.find(drop_reason) != ingress_drop_reason_lookup.end();
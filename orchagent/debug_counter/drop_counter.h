@@ -28,6 +28,7 @@ class DropCounter : public DebugCounter
 
         void addDropReason(const std::string& drop_reason) noexcept(false);
         void removeDropReason(const std::string& drop_reason) noexcept(false);
+        void setDropReasons(const std::unordered_set<std::string>& new_drop_reasons) noexcept(false);
 
         static bool isIngressDropReasonValid(const std::string& drop_reason);
         static bool isEgressDropReasonValid(const std::string& drop_reason);
@@ -25,7 +25,7 @@ static const unordered_map<string, CounterType> flex_counter_type_lookup = {
 // Initializing DebugCounterOrch creates a group entry in FLEX_COUNTER_DB, so this
 // object should only be initialized once.
 DebugCounterOrch::DebugCounterOrch(DBConnector *db, const vector<string>& table_names, int poll_interval) :
-        Orch(db, table_names),
+        Orch(db, table_names, counter_orch_pri),
         flex_counter_manager(DEBUG_COUNTER_FLEX_COUNTER_GROUP, StatsMode::READ, poll_interval, true),
         m_stateDb(new DBConnector("STATE_DB", 0)),
         m_debugCapabilitiesTable(new Table(m_stateDb.get(), STATE_DEBUG_COUNTER_CAPABILITIES_NAME)),
@@ -37,6 +37,14 @@ DebugCounterOrch::DebugCounterOrch(DBConnector *db, const vector<string>& table_
     publishDropCounterCapabilities();
 
     gPortsOrch->attach(this);
+}
+
+void DebugCounterOrch::initDropMonitorPlugin()
+{
+    if (m_drop_monitor_plugin_loaded)
+    {
+        return;
+    }
 
     // Add drop monitor lua script
     string dropMonitorPluginName = "drop_monitor.lua";
@@ -57,6 +65,7 @@ DebugCounterOrch::DebugCounterOrch(DBConnector *db, const vector<string>& table_
                              STATS_MODE_READ,
                              PORT_PLUGIN_FIELD,
                              dropMonitorSha);
+    m_drop_monitor_plugin_loaded = true;
 }
 
 DebugCounterOrch::~DebugCounterOrch(void)
@@ -138,6 +147,10 @@ void DebugCounterOrch::doTask(Consumer& consumer)
         return;
     }
 
+    // Defer the drop monitor plugin until the first debug counter request so
+    // that systems that never configure one skip the group setup entirely
+    initDropMonitorPlugin();
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -305,6 +318,8 @@ void DebugCounterOrch::doTask(Consumer& consumer)
                 break;
         }
     }
+
+    flushDropReasonUpdates();
 }
 
 // Debug Capability Reporting Functions START HERE -------------------------------------------------
@@ -467,7 +482,12 @@ task_process_status DebugCounterOrch::addDropReason(const string& counter_name,
     }
 
     DropCounter *counter = dynamic_cast<DropCounter*>(it->second.get());
-    counter->addDropReason(drop_reason);
+    auto pending = pending_drop_reason_updates.find(counter_name);
+    if (pending == pending_drop_reason_updates.end())
+    {
+        pending = pending_drop_reason_updates.emplace(counter_name, counter->getDropReasons()).first;
+    }
+    pending->second.emplace(drop_reason);
 
     SWSS_LOG_NOTICE("Added drop reason %s to drop counter %s", drop_reason.c_str(), counter_name.c_str());
     return task_process_status::task_success;
@@ -492,20 +512,53 @@ task_process_status DebugCounterOrch::removeDropReason(const string& counter_nam
     }
 
     DropCounter *counter = dynamic_cast<DropCounter*>(it->second.get());
-    const unordered_set<string>& drop_reasons = counter->getDropReasons();
+    auto pending = pending_drop_reason_updates.find(counter_name);
+    if (pending == pending_drop_reason_updates.end())
+    {
+        pending = pending_drop_reason_updates.emplace(counter_name, counter->getDropReasons()).first;
+    }
 
-    if (drop_reasons.size() <= 1)
+    if (pending->second.size() <= 1)
     {
         SWSS_LOG_WARN("Attempted to remove all drop reasons from counter '%s'", counter_name.c_str());
         return task_ignore;
     }
 
-    counter->removeDropReason(drop_reason);
+    pending->second.erase(drop_reason);
 
     SWSS_LOG_NOTICE("Removed drop reason %s from drop counter %s", drop_reason.c_str(), counter_name.c_str());
     return task_success;
 }
 
+// flushDropReasonUpdates applies the reason sets staged during the current
+// drain: each touched counter gets a single SAI update no matter how many of
+// its reasons changed.
+void DebugCounterOrch::flushDropReasonUpdates()
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto& update : pending_drop_reason_updates)
+    {
+        auto it = debug_counters.find(update.first);
+        if (it == debug_counters.end())
+        {
+            continue;
+        }
+
+        DropCounter *counter = dynamic_cast<DropCounter*>(it->second.get());
+        try
+        {
+            counter->setDropReasons(update.second);
+        }
+        catch (const std::runtime_error& e)
+        {
+            SWSS_LOG_ERROR("Failed to update drop reasons on counter '%s'", update.first.c_str());
+        }
+    }
+
+    pending_drop_reason_updates.clear();
+}
+
 // Free Table Management Functions START HERE ------------------------------------------------------
 
 // Note that entries will remain in the table until at least one drop reason is added to the counter.
@@ -626,6 +679,7 @@ void DebugCounterOrch::installDebugFlexCounters(const string& counter_type,
     }
     else if (flex_counter_type == CounterType::PORT_DEBUG)
     {
+        std::vector<sai_object_id_t> port_ids;
         for (auto const &curr : gPortsOrch->getAllPorts())
         {
             if (port_id != SAI_NULL_OBJECT_ID)
@@ -641,10 +695,7 @@ void DebugCounterOrch::installDebugFlexCounters(const string& counter_type,
                 continue;
             }
 
-            flex_counter_manager.addFlexCounterStat(
-                    curr.second.m_port_id,
-                    flex_counter_type,
-                    counter_stat);
+            port_ids.push_back(curr.second.m_port_id);
 
             if (debug_monitor_enabled)
             {
@@ -653,6 +704,8 @@ void DebugCounterOrch::installDebugFlexCounters(const string& counter_type,
                 startFlexCounterPolling(gSwitchId, key, monitored_debug_counter_stat, PORT_COUNTER_ID_LIST);
             }
         }
+
+        flex_counter_manager.addFlexCounterStats(port_ids, flex_counter_type, counter_stat);
     }
 }
 
@@ -679,6 +732,7 @@ void DebugCounterOrch::uninstallDebugFlexCounters(const string& counter_type,
     }
     else if (flex_counter_type == CounterType::PORT_DEBUG)
     {
+        std::vector<sai_object_id_t> port_ids;
         for (auto const &curr : gPortsOrch->getAllPorts())
         {
             if (port_id != SAI_NULL_OBJECT_ID)
@@ -698,10 +752,7 @@ void DebugCounterOrch::uninstallDebugFlexCounters(const string& counter_type,
             string key = string(DEBUG_COUNTER_FLEX_COUNTER_GROUP) + ":" + sai_serialize_object_id(curr.second.m_port_id);
             stopFlexCounterPolling(gSwitchId, key);
 
-            flex_counter_manager.removeFlexCounterStat(
-                curr.second.m_port_id,
-                flex_counter_type,
-                counter_stat);
+            port_ids.push_back(curr.second.m_port_id);
 
             debug_drop_monitor_stats_fields.push_back("DEBUG_DROP_MONITOR_STATS|" + counter_name + "|" + curr.first);
 
@@ -712,6 +763,8 @@ void DebugCounterOrch::uninstallDebugFlexCounters(const string& counter_type,
                 startFlexCounterPolling(gSwitchId, key, monitored_debug_counter_stat, PORT_COUNTER_ID_LIST);
             }
         }
+
+        flex_counter_manager.removeFlexCounterStats(port_ids, flex_counter_type, counter_stat);
     }
 
     // Delete DEBUG_DROP_MONITOR_STATS for this debug counter
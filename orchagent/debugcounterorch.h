@@ -39,11 +39,15 @@ private:
     // Debug Capability Reporting Functions
     void publishDropCounterCapabilities();
 
+    bool m_drop_monitor_plugin_loaded = false;
+    void initDropMonitorPlugin();
+
     // doTask Handler Functions
     task_process_status installDebugCounter(const std::string& counter_name, const std::vector<swss::FieldValueTuple>& attributes);
     task_process_status uninstallDebugCounter(const std::string& counter_name);
     task_process_status addDropReason(const std::string& counter_name, const std::string& drop_reason);
     task_process_status removeDropReason(const std::string& counter_name, const std::string& drop_reason);
+    void flushDropReasonUpdates();
 
     // Free Table Management Functions
     void addFreeCounter(const std::string& counter_name, const std::string& counter_type);
@@ -113,6 +117,11 @@ private:
     // cannot add drop reasons to a counter that doesn't exist yet,
     // we keep track of the reasons in this table.
     std::unordered_map<std::string, std::unordered_set<std::string>> free_drop_reasons;
+
+    // pending_drop_reason_updates stages the final reason set of each counter
+    // touched during the current drain, so a burst of reason changes on one
+    // counter is applied with a single SAI update at the end of doTask.
+    std::unordered_map<std::string, std::unordered_set<std::string>> pending_drop_reason_updates;
 };
 
 #endif
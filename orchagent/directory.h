@@ -7,8 +7,7 @@
 #include <typeinfo>
 #include <string>
 #include <stdexcept>
-#include <unordered_map>
-#include <algorithm>
+#include <vector>
 
 template <typename B>
 class Directory
@@ -18,37 +17,46 @@ public:
     template <typename U>
     void set(const U& value)
     {
-        std::string type_name { typeid(U).name() };
+        const size_t slot = typeSlot<U>();
 
-        if (m_values.find(type_name) != m_values.end())
+        if (slot < m_values.size() && m_values[slot] != nullptr)
         {
-            throw std::logic_error(std::string("Type ") + type_name + " already registered");
+            throw std::logic_error(std::string("Type ") + typeid(U).name() + " already registered");
         }
 
-        m_values[type_name] = value;
+        if (slot >= m_values.size())
+        {
+            m_values.resize(slot + 1, nullptr);
+        }
+
+        m_values[slot] = value;
     }
 
     template <typename U>
     const U get() const
     {
-        std::string type_name { typeid(U).name() };
+        const size_t slot = typeSlot<U>();
 
-        if (m_values.find(type_name) == m_values.end())
+        if (slot >= m_values.size())
         {
             return nullptr;
         }
 
-        return static_cast<U>(m_values.at(type_name));
+        return static_cast<U>(m_values[slot]);
     }
 
     class iterator : public std::iterator<std::input_iterator_tag, B>
     {
     public:
-        explicit iterator(const typename std::unordered_map<std::string, B>::iterator& it) : it(it) {}
+        iterator(const typename std::vector<B>::iterator& it,
+                 const typename std::vector<B>::iterator& end) : it(it), end(end)
+        {
+            skipEmptySlots();
+        }
 
         B& operator*() const
         {
-            return it->second;
+            return *it;
         }
 
         bool operator!=(iterator other) const
@@ -59,23 +67,50 @@ public:
         iterator& operator++()
         {
             ++it;
+            skipEmptySlots();
             return *this;
         }
 
     private:
-        typename std::unordered_map<std::string, B>::iterator it;
+        void skipEmptySlots()
+        {
+            while (it != end && *it == nullptr)
+            {
+                ++it;
+            }
+        }
+
+        typename std::vector<B>::iterator it;
+        typename std::vector<B>::iterator end;
     };
 
     iterator begin()
     {
-        return iterator(m_values.begin());
+        return iterator(m_values.begin(), m_values.end());
     }
 
     iterator end()
     {
-        return iterator(m_values.end());
+        return iterator(m_values.end(), m_values.end());
     }
 
 private:
-    std::unordered_map<std::string, B> m_values;
+    static size_t nextTypeSlot()
+    {
+        static size_t next = 0;
+        return next++;
+    }
+
+    // One array slot per stored type, assigned on the first set()/get() of
+    // that type. Every later lookup resolves the slot through a function-local
+    // static, making get<U>() a constant-time array read with no type-name
+    // string hashing on hot paths.
+    template <typename U>
+    static size_t typeSlot()
+    {
+        static const size_t slot = nextTypeSlot();
+        return slot;
+    }
+
+    std::vector<B> m_values;
 };
@@ -0,0 +1,179 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "drainjournal.h"
+#include "logger.h"
+
+DrainJournal *gDrainJournal = nullptr;
+
+DrainJournal::~DrainJournal()
+{
+    close();
+}
+
+bool DrainJournal::open(const std::string &path, size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    if (isOpen())
+    {
+        return true;
+    }
+
+    if (size < sizeof(Header) + sizeof(Record))
+    {
+        SWSS_LOG_ERROR("Drain journal size %zu is too small", size);
+        return false;
+    }
+
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (m_fd < 0)
+    {
+        SWSS_LOG_ERROR("Failed to open drain journal %s: %s", path.c_str(), strerror(errno));
+        return false;
+    }
+
+    m_slots = (size - sizeof(Header)) / sizeof(Record);
+    m_size = sizeof(Header) + m_slots * sizeof(Record);
+
+    if (ftruncate(m_fd, (off_t)m_size) != 0)
+    {
+        SWSS_LOG_ERROR("Failed to size drain journal %s: %s", path.c_str(), strerror(errno));
+        close();
+        return false;
+    }
+
+    void *base = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (base == MAP_FAILED)
+    {
+        SWSS_LOG_ERROR("Failed to map drain journal %s: %s", path.c_str(), strerror(errno));
+        close();
+        return false;
+    }
+
+    m_header = reinterpret_cast<Header *>(base);
+    m_records = reinterpret_cast<char *>(base) + sizeof(Header);
+
+    if (m_header->magic != JOURNAL_MAGIC ||
+        m_header->version != JOURNAL_VERSION ||
+        m_header->record_size != sizeof(Record))
+    {
+        /* Fresh or incompatible file, nothing to replay */
+        memset(base, 0, m_size);
+        m_header->magic = JOURNAL_MAGIC;
+        m_header->version = JOURNAL_VERSION;
+        m_header->record_size = sizeof(Record);
+        m_header->next_seq = 0;
+    }
+
+    SWSS_LOG_NOTICE("Drain journal %s mapped with %zu record slots", path.c_str(), m_slots);
+    return true;
+}
+
+void DrainJournal::close()
+{
+    if (m_header != nullptr)
+    {
+        munmap(m_header, m_size);
+        m_header = nullptr;
+        m_records = nullptr;
+    }
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+void DrainJournal::record(const std::string &table, const std::string &key, const std::string &op)
+{
+    append(RECORD_OP, table, key, op);
+}
+
+void DrainJournal::commit(const std::string &table)
+{
+    append(RECORD_COMMIT, table, "", "");
+}
+
+void DrainJournal::append(RecordType type, const std::string &table, const std::string &key, const std::string &op)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    if (!isOpen())
+    {
+        return;
+    }
+
+    Record *r = slot(m_header->next_seq % m_slots);
+    r->seq = m_header->next_seq + 1;
+    r->type = type;
+    strncpy(r->table, table.c_str(), sizeof(r->table) - 1);
+    r->table[sizeof(r->table) - 1] = '\0';
+    strncpy(r->key, key.c_str(), sizeof(r->key) - 1);
+    r->key[sizeof(r->key) - 1] = '\0';
+    strncpy(r->op, op.c_str(), sizeof(r->op) - 1);
+    r->op[sizeof(r->op) - 1] = '\0';
+
+    m_header->next_seq++;
+}
+
+DrainJournal::IncompleteKeys DrainJournal::recover()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    IncompleteKeys incomplete;
+
+    if (!isOpen())
+    {
+        return incomplete;
+    }
+
+    /* Replay the surviving window of the ring in append order */
+    std::vector<Record *> records;
+    for (size_t i = 0; i < m_slots; i++)
+    {
+        Record *r = slot(i);
+        if (r->seq != 0)
+        {
+            records.push_back(r);
+        }
+    }
+    std::sort(records.begin(), records.end(),
+              [](const Record *a, const Record *b) { return a->seq < b->seq; });
+
+    for (auto r : records)
+    {
+        std::string table(r->table, strnlen(r->table, sizeof(r->table)));
+        if (r->type == RECORD_OP)
+        {
+            incomplete[table].emplace(std::string(r->key, strnlen(r->key, sizeof(r->key))),
+                                      std::string(r->op, strnlen(r->op, sizeof(r->op))));
+        }
+        else if (r->type == RECORD_COMMIT)
+        {
+            incomplete.erase(table);
+        }
+    }
+
+    if (m_header->next_seq > m_slots)
+    {
+        SWSS_LOG_NOTICE("Drain journal wrapped (%" PRIu64 " records in %zu slots), recovery window is partial",
+                        m_header->next_seq, m_slots);
+    }
+
+    /* Reset the ring for this run */
+    memset(m_records, 0, m_slots * sizeof(Record));
+    m_header->next_seq = 0;
+
+    return incomplete;
+}
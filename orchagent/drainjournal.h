@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+
+/*
+ * Write-ahead journal of drain-cycle intents backed by an mmap'd ring file.
+ *
+ * Consumers append one record per (table, key, op) popped from APPL_DB and a
+ * commit marker once their backlog fully drains. After a crash the next start
+ * replays the ring: every intent without a later commit of its table names a
+ * key whose ASIC state may be partially programmed, so recovery can
+ * re-validate just those keys against ASIC_DB instead of auditing whole
+ * tables. Appends are sequential writes into the mapping and add no syscalls
+ * to the drain path.
+ */
+class DrainJournal
+{
+public:
+    /* Journaled keys of each table that were in flight when the previous
+     * run stopped, as (key, op) pairs */
+    using IncompleteKeys = std::map<std::string, std::set<std::pair<std::string, std::string>>>;
+
+    static constexpr size_t DEFAULT_SIZE = 1024 * 1024;
+
+    DrainJournal() = default;
+    ~DrainJournal();
+
+    bool open(const std::string &path, size_t size = DEFAULT_SIZE);
+    void close();
+
+    bool isOpen() const
+    {
+        return m_header != nullptr;
+    }
+
+    /* Journal the intent to process (table, key, op) in the current drain */
+    void record(const std::string &table, const std::string &key, const std::string &op);
+
+    /* Mark every journaled intent of a table as fully processed */
+    void commit(const std::string &table);
+
+    /* Replay the ring left by the previous run, then reset it for this one */
+    IncompleteKeys recover();
+
+private:
+    enum RecordType : uint8_t
+    {
+        RECORD_EMPTY = 0,
+        RECORD_OP = 1,
+        RECORD_COMMIT = 2
+    };
+
+    struct Header
+    {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t record_size;
+        uint64_t next_seq;
+    };
+
+    /* Fixed 256 byte slot; longer strings are truncated, which at worst
+     * widens the recovery scope of the table they belong to */
+    struct Record
+    {
+        uint64_t seq;                   // 0 marks a never written slot
+        uint8_t type;
+        char table[63];
+        char key[168];
+        char op[16];
+    };
+
+    void append(RecordType type, const std::string &table, const std::string &key, const std::string &op);
+
+    Record *slot(uint64_t index)
+    {
+        return reinterpret_cast<Record *>(m_records + index * sizeof(Record));
+    }
+
+    static constexpr uint64_t JOURNAL_MAGIC = 0x4c4e524a4e415244; // "DRANJRNL"
+    static constexpr uint32_t JOURNAL_VERSION = 1;
+
+    std::mutex m_mutex;
+    Header *m_header = nullptr;
+    char *m_records = nullptr;
+    size_t m_slots = 0;
+    size_t m_size = 0;
+    int m_fd = -1;
+};
+
+extern DrainJournal *gDrainJournal;
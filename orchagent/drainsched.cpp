@@ -0,0 +1,149 @@
+#include "drainsched.h"
+
+#include <vector>
+
+#include "logger.h"
+
+using namespace std;
+using namespace swss;
+
+constexpr int64_t DrainSched::RECOVERY_PERCENT;
+constexpr int64_t DrainSched::MAX_DEBT_USECS;
+constexpr long DrainSched::STARVE_FORCE_MSECS;
+constexpr long DrainSched::FLUSH_INTERVAL_SECS;
+
+DrainSched &DrainSched::Instance()
+{
+    static DrainSched sched;
+    return sched;
+}
+
+void DrainSched::setWeight(const string &name, uint32_t weight)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    auto &state = m_stats[name];
+    state.weight = weight != 0 ? weight : 1;
+
+    SWSS_LOG_NOTICE("Drain fairness weight for %s set to %u", name.c_str(), state.weight);
+}
+
+void DrainSched::replenish(State &state, chrono::steady_clock::time_point now)
+{
+    if (state.deficit_usecs < 0)
+    {
+        auto elapsed = chrono::duration_cast<chrono::microseconds>(
+            now - state.last_update).count();
+        state.deficit_usecs += elapsed * state.weight * RECOVERY_PERCENT / 100;
+        if (state.deficit_usecs > 0)
+        {
+            state.deficit_usecs = 0;
+        }
+    }
+    state.last_update = now;
+}
+
+bool DrainSched::mayDrain(const string &name, size_t pending)
+{
+    if (pending == 0)
+    {
+        /* Nothing to drain; leave the deficit untouched */
+        return true;
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+
+    auto now = chrono::steady_clock::now();
+    auto &state = m_stats[name];
+    replenish(state, now);
+
+    if (state.deficit_usecs >= 0)
+    {
+        state.deferred = false;
+        return true;
+    }
+
+    if (!state.deferred)
+    {
+        state.deferred = true;
+        state.deferred_since = now;
+    }
+    else if (chrono::duration_cast<chrono::milliseconds>(
+                 now - state.deferred_since).count() >= STARVE_FORCE_MSECS)
+    {
+        /* Waited long enough; forgive the debt and count the event */
+        state.starvation_events++;
+        state.deficit_usecs = 0;
+        state.deferred = false;
+        return true;
+    }
+
+    state.deferrals++;
+    return false;
+}
+
+void DrainSched::charge(const string &name, uint64_t usecs)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    auto now = chrono::steady_clock::now();
+    auto &state = m_stats[name];
+    replenish(state, now);
+
+    state.drains++;
+    state.drain_usecs += usecs;
+    state.deferred = false;
+
+    state.deficit_usecs -= static_cast<int64_t>(usecs);
+    if (state.deficit_usecs < -MAX_DEBT_USECS)
+    {
+        state.deficit_usecs = -MAX_DEBT_USECS;
+    }
+}
+
+void DrainSched::flush()
+{
+    unordered_map<string, State> snapshot;
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+
+        auto now = chrono::steady_clock::now();
+        if (chrono::duration_cast<chrono::seconds>(now - m_lastFlush).count() < FLUSH_INTERVAL_SECS)
+        {
+            return;
+        }
+        m_lastFlush = now;
+
+        if (m_stats.empty())
+        {
+            return;
+        }
+        snapshot = m_stats;
+    }
+
+    /* Lazy DB handle, matching the other STATE_DB stats publishers */
+    if (!m_table)
+    {
+        m_stateDb = unique_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
+        m_table = unique_ptr<Table>(new Table(m_stateDb.get(), DRAIN_SCHED_STATE_TABLE));
+    }
+
+    for (const auto &it : snapshot)
+    {
+        const auto &state = it.second;
+
+        /* Counters are cumulative since startup, not per flush window */
+        vector<FieldValueTuple> fvs = {
+            { "weight", to_string(state.weight) },
+            { "deficit_usecs", to_string(state.deficit_usecs) },
+            { "drains", to_string(state.drains) },
+            { "drain_usecs", to_string(state.drain_usecs) },
+            { "deferrals", to_string(state.deferrals) },
+            { "starvation_events", to_string(state.starvation_events) },
+        };
+        m_table->set(it.first, fvs);
+    }
+
+    SWSS_LOG_INFO("Published drain fairness counters for %zu executors", snapshot.size());
+}
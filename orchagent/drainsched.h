@@ -0,0 +1,117 @@
+#ifndef SWSS_DRAINSCHED_H
+#define SWSS_DRAINSCHED_H
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "dbconnector.h"
+#include "table.h"
+
+#define DRAIN_SCHED_STATE_TABLE "DRAIN_FAIRNESS"
+
+/*
+ * DrainSched applies deficit round-robin fairness to the periodic doTask()
+ * sweep. Each executor carries a deficit in microseconds: drains spend it,
+ * idle wall time repays it at weight x RECOVERY_PERCENT of real time. A
+ * consumer whose deficit is negative - typically ROUTE_TABLE after an
+ * exhaustive convergence drain - sits out subsequent sweeps until the debt
+ * is repaid, so small tables like MIRROR_SESSION or POLICER get the select
+ * loop back instead of queueing behind it for tens of seconds.
+ *
+ * Short drains never accumulate debt, so lightly loaded consumers are
+ * always admitted immediately. A consumer that has waited longer than
+ * STARVE_FORCE_MSECS with pending work runs regardless of its debt and the
+ * event is counted; the per-executor counters are published to STATE_DB
+ * under DRAIN_FAIRNESS so operators can see who is yielding to whom.
+ *
+ * Weights come from the CONFIG_DB DRAIN_FAIRNESS table (key: consumer
+ * table name, field: weight) read once at startup; a higher weight repays
+ * debt proportionally faster, biasing critical tables.
+ */
+class DrainSched
+{
+public:
+    /* Fraction of wall time at which a unit-weight executor repays debt */
+    static constexpr int64_t RECOVERY_PERCENT = 25;
+
+    /* Debt cap; bounds how long one pathological drain penalizes a table */
+    static constexpr int64_t MAX_DEBT_USECS = 1000000;
+
+    /* A consumer deferred this long with pending work runs regardless */
+    static constexpr long STARVE_FORCE_MSECS = 1000;
+
+    static constexpr long FLUSH_INTERVAL_SECS = 60;
+
+    static DrainSched &Instance();
+
+    /* Operator bias; weight 0 is treated as the default of 1 */
+    void setWeight(const std::string &name, uint32_t weight);
+
+    /*
+     * Admission check for the doTask() sweep. Returns false if the named
+     * executor should yield this sweep while it repays drain debt; pending
+     * is the executor's m_toSync depth, used for starvation tracking.
+     */
+    bool mayDrain(const std::string &name, size_t pending);
+
+    /* Spend usecs of drain time against the executor's deficit */
+    void charge(const std::string &name, uint64_t usecs);
+
+    /* Publish the per-executor fairness counters if the interval elapsed */
+    void flush();
+
+private:
+    DrainSched() = default;
+    DrainSched(const DrainSched &) = delete;
+    DrainSched &operator=(const DrainSched &) = delete;
+
+    struct State
+    {
+        uint32_t weight = 1;
+        int64_t deficit_usecs = 0;
+        std::chrono::steady_clock::time_point last_update;
+        std::chrono::steady_clock::time_point deferred_since;
+        bool deferred = false;
+        uint64_t drains = 0;
+        uint64_t drain_usecs = 0;
+        uint64_t deferrals = 0;
+        uint64_t starvation_events = 0;
+    };
+
+    /* Repay debt for the wall time elapsed since the last update */
+    void replenish(State &state, std::chrono::steady_clock::time_point now);
+
+    std::unordered_map<std::string, State> m_stats;
+    std::mutex m_mutex;
+    std::chrono::steady_clock::time_point m_lastFlush = std::chrono::steady_clock::now();
+
+    std::unique_ptr<swss::DBConnector> m_stateDb;
+    std::unique_ptr<swss::Table> m_table;
+};
+
+/* RAII helper charging one drain against the fairness deficit */
+class DrainSchedCharge
+{
+public:
+    DrainSchedCharge(const std::string &name) :
+        m_name(name),
+        m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~DrainSchedCharge()
+    {
+        auto usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - m_start).count();
+        DrainSched::Instance().charge(m_name, static_cast<uint64_t>(usecs));
+    }
+
+private:
+    const std::string &m_name;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+#endif /* SWSS_DRAINSCHED_H */
@@ -1088,6 +1088,70 @@ bool DTelOrch::deleteReportSession(const string &report_session_id)
     return true;
 }
 
+bool DTelOrch::getReportSessionAttr(const FieldValueTuple& fv, sai_attribute_t& rs_attr,
+                                    vector<sai_ip_address_t>& dst_ip_list)
+{
+    SWSS_LOG_ENTER();
+
+    if (fvField(fv) == SRC_IP)
+    {
+        IpAddress ip(fvValue(fv));
+        rs_attr.id = SAI_DTEL_REPORT_SESSION_ATTR_SRC_IP;
+        copy(rs_attr.value.ipaddr, ip);
+    }
+    else if (fvField(fv) == DST_IP_LIST)
+    {
+        sai_ip_address_t dst_ip;
+        dst_ip.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        size_t prev = 0;
+        size_t next = fvValue(fv).find(';');
+        while (next != std::string::npos)
+        {
+            IpAddress ip(fvValue(fv).substr(prev, next - prev));
+            copy(dst_ip, ip);
+            dst_ip_list.push_back(dst_ip);
+            prev = next + 1;
+            next = fvValue(fv).find(';', prev);
+        }
+
+        /* Add the last IP */
+        IpAddress ip(fvValue(fv).substr(prev));
+        copy(dst_ip, ip);
+        dst_ip_list.push_back(dst_ip);
+
+        rs_attr.id = SAI_DTEL_REPORT_SESSION_ATTR_DST_IP_LIST;
+        rs_attr.value.ipaddrlist.count = (uint32_t)dst_ip_list.size();
+        rs_attr.value.ipaddrlist.list = dst_ip_list.data();
+    }
+    else if (fvField(fv) == VRF)
+    {
+        string vrf_name = fvValue(fv);
+        rs_attr.value.oid = gVirtualRouterId;
+        if (vrf_name != "default")
+        {
+            VRFOrch* vrf_orch = gDirectory.get<VRFOrch*>();
+            rs_attr.value.oid = vrf_orch->getVRFid(vrf_name);
+        }
+        rs_attr.id = SAI_DTEL_REPORT_SESSION_ATTR_VIRTUAL_ROUTER_ID;
+    }
+    else if (fvField(fv) == TRUNCATE_SIZE)
+    {
+        rs_attr.id = SAI_DTEL_REPORT_SESSION_ATTR_TRUNCATE_SIZE;
+        rs_attr.value.u16 = to_uint<uint16_t>(fvValue(fv));
+    }
+    else if (fvField(fv) == UDP_DEST_PORT)
+    {
+        rs_attr.id = SAI_DTEL_REPORT_SESSION_ATTR_UDP_DST_PORT;
+        rs_attr.value.u16 = to_uint<uint16_t>(fvValue(fv));
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
 void DTelOrch::doDtelReportSessionTableTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
@@ -1108,73 +1172,72 @@ void DTelOrch::doDtelReportSessionTableTask(Consumer &consumer)
         {
             vector<sai_attribute_t> report_session_attr;
             vector<sai_ip_address_t> dst_ip_list;
-            sai_ip_address_t dst_ip;
             sai_attribute_t rs_attr;
 
-            /* If report session already exists, delete it first */
-            if (reportSessionExists(report_session_id))
+            map<string, string> config;
+            for (const auto &i : kfvFieldsValues(t))
             {
-                if (!deleteReportSession(report_session_id))
-                {
-                    goto report_session_table_continue;
-                }
+                config[fvField(i)] = fvValue(i);
             }
 
-            for (auto i : kfvFieldsValues(t))
+            auto rs_it = m_dTelReportSessionTable.find(report_session_id);
+            if (rs_it != m_dTelReportSessionTable.end())
             {
-                if (fvField(i) == SRC_IP)
+                if (rs_it->second.config == config)
                 {
-                    IpAddress ip(fvValue(i));
-                    rs_attr.id = SAI_DTEL_REPORT_SESSION_ATTR_SRC_IP;
-                    copy(rs_attr.value.ipaddr, ip);
-                    report_session_attr.push_back(rs_attr);
+                    /* Re-apply of the identical configuration; nothing to program */
+                    goto report_session_table_continue;
                 }
-                else if (fvField(i) == DST_IP_LIST)
+
+                /*
+                 * Update only the changed attributes in place. Recreating the
+                 * session would change its OID mid-stream and force every
+                 * event bound to it to be reprogrammed.
+                 */
+                bool update_failed = false;
+                for (const auto &i : kfvFieldsValues(t))
                 {
-                    dst_ip.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
-                    size_t prev = 0;
-                    size_t next = fvValue(i).find(';');
-                    while (next != std::string::npos)
+                    auto prev = rs_it->second.config.find(fvField(i));
+                    if (prev != rs_it->second.config.end() && prev->second == fvValue(i))
                     {
-                        IpAddress ip(fvValue(i).substr(prev, next - prev));
-                        copy(dst_ip, ip);
-                        dst_ip_list.push_back(dst_ip);
-                        prev = next + 1;
-                        next = fvValue(i).find(';', prev);
+                        continue;
                     }
 
-                    /* Add the last IP */
-                    IpAddress ip(fvValue(i).substr(prev));
-                    copy(dst_ip, ip);
-                    dst_ip_list.push_back(dst_ip);
+                    dst_ip_list.clear();
+                    if (!getReportSessionAttr(i, rs_attr, dst_ip_list))
+                    {
+                        continue;
+                    }
 
-                    rs_attr.id = SAI_DTEL_REPORT_SESSION_ATTR_DST_IP_LIST;
-                    rs_attr.value.ipaddrlist.count = (uint32_t)dst_ip_list.size();
-                    rs_attr.value.ipaddrlist.list = dst_ip_list.data();
-                    report_session_attr.push_back(rs_attr);
-                }
-                else if (fvField(i) == VRF)
-                {
-                    string vrf_name = fvValue(i);
-                    rs_attr.value.oid = gVirtualRouterId;
-                    if (vrf_name != "default")
+                    status = sai_dtel_api->set_dtel_report_session_attribute(
+                        rs_it->second.reportSessionOid, &rs_attr);
+                    if (status != SAI_STATUS_SUCCESS)
                     {
-                        VRFOrch* vrf_orch = gDirectory.get<VRFOrch*>();
-                        rs_attr.value.oid = vrf_orch->getVRFid(vrf_name);
+                        SWSS_LOG_ERROR("DTEL ERROR: Failed to update report session %s attribute %s",
+                                       report_session_id.c_str(), fvField(i).c_str());
+                        handleSaiSetStatus(SAI_API_DTEL, status);
+                        update_failed = true;
+                        break;
                     }
-                    rs_attr.id = SAI_DTEL_REPORT_SESSION_ATTR_VIRTUAL_ROUTER_ID;
-                    report_session_attr.push_back(rs_attr);
                 }
-                else if (fvField(i) == TRUNCATE_SIZE)
+
+                if (!update_failed)
                 {
-                    rs_attr.id = SAI_DTEL_REPORT_SESSION_ATTR_TRUNCATE_SIZE;
-                    rs_attr.value.u16 = to_uint<uint16_t>(fvValue(i));
-                    report_session_attr.push_back(rs_attr);
+                    rs_it->second.config = move(config);
+                    goto report_session_table_continue;
                 }
-                else if (fvField(i) == UDP_DEST_PORT)
+
+                /* Fall back to a full rebuild */
+                if (!deleteReportSession(report_session_id))
+                {
+                    goto report_session_table_continue;
+                }
+            }
+
+            for (const auto &i : kfvFieldsValues(t))
+            {
+                if (getReportSessionAttr(i, rs_attr, dst_ip_list))
                 {
-                    rs_attr.id = SAI_DTEL_REPORT_SESSION_ATTR_UDP_DST_PORT;
-                    rs_attr.value.u16 = to_uint<uint16_t>(fvValue(i));
                     report_session_attr.push_back(rs_attr);
                 }
             }
@@ -1201,6 +1264,7 @@ void DTelOrch::doDtelReportSessionTableTask(Consumer &consumer)
 
             DTelReportSessionEntry rs_entry = { };
             rs_entry.reportSessionOid = report_session_oid;
+            rs_entry.config = move(config);
             m_dTelReportSessionTable[report_session_id] = rs_entry;
         }
         else if (op == DEL_COMMAND)
@@ -1263,6 +1327,48 @@ bool DTelOrch::deleteINTSession(const string &int_session_id)
     return true;
 }
 
+bool DTelOrch::getINTSessionAttr(const FieldValueTuple& fv, sai_attribute_t& s_attr)
+{
+    SWSS_LOG_ENTER();
+
+    if (fvField(fv) == COLLECT_SWITCH_ID)
+    {
+        s_attr.id = SAI_DTEL_INT_SESSION_ATTR_COLLECT_SWITCH_ID;
+        s_attr.value.booldata = (fvValue(fv) == ENABLED) ? true : false;
+    }
+    else if (fvField(fv) == COLLECT_INGRESS_TIMESTAMP)
+    {
+        s_attr.id = SAI_DTEL_INT_SESSION_ATTR_COLLECT_INGRESS_TIMESTAMP;
+        s_attr.value.booldata = (fvValue(fv) == ENABLED) ? true : false;
+    }
+    else if (fvField(fv) == COLLECT_EGRESS_TIMESTAMP)
+    {
+        s_attr.id = SAI_DTEL_INT_SESSION_ATTR_COLLECT_EGRESS_TIMESTAMP;
+        s_attr.value.booldata = (fvValue(fv) == ENABLED) ? true : false;
+    }
+    else if (fvField(fv) == COLLECT_SWITCH_PORTS)
+    {
+        s_attr.id = SAI_DTEL_INT_SESSION_ATTR_COLLECT_SWITCH_PORTS;
+        s_attr.value.booldata = (fvValue(fv) == ENABLED) ? true : false;
+    }
+    else if (fvField(fv) == COLLECT_QUEUE_INFO)
+    {
+        s_attr.id = SAI_DTEL_INT_SESSION_ATTR_COLLECT_QUEUE_INFO;
+        s_attr.value.booldata = (fvValue(fv) == ENABLED) ? true : false;
+    }
+    else if (fvField(fv) == MAX_HOP_COUNT)
+    {
+        s_attr.id = SAI_DTEL_INT_SESSION_ATTR_MAX_HOP_COUNT;
+        s_attr.value.u16 = to_uint<uint16_t>(fvValue(fv));
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
 void DTelOrch::doDtelINTSessionTableTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
@@ -1284,51 +1390,70 @@ void DTelOrch::doDtelINTSessionTableTask(Consumer &consumer)
             vector<sai_attribute_t> int_session_attr;
             sai_attribute_t s_attr;
 
-            /* If INT session already exists, delete it first */
-            if (intSessionExists(int_session_id))
+            map<string, string> config;
+            for (const auto &i : kfvFieldsValues(t))
             {
-                if (!deleteINTSession(int_session_id))
-                {
-                    goto int_session_table_continue;
-                }
+                config[fvField(i)] = fvValue(i);
             }
 
-            for (auto i : kfvFieldsValues(t))
+            auto is_it = m_dTelINTSessionTable.find(int_session_id);
+            if (is_it != m_dTelINTSessionTable.end())
             {
-                if (fvField(i) == COLLECT_SWITCH_ID)
+                if (is_it->second.config == config)
                 {
-                    s_attr.id = SAI_DTEL_INT_SESSION_ATTR_COLLECT_SWITCH_ID;
-                    s_attr.value.booldata = (fvValue(i) == ENABLED) ? true : false;
-                    int_session_attr.push_back(s_attr);
-                }
-                else if (fvField(i) == COLLECT_INGRESS_TIMESTAMP)
-                {
-                    s_attr.id = SAI_DTEL_INT_SESSION_ATTR_COLLECT_INGRESS_TIMESTAMP;
-                    s_attr.value.booldata = (fvValue(i) == ENABLED) ? true : false;
-                    int_session_attr.push_back(s_attr);
+                    /* Re-apply of the identical configuration; nothing to program */
+                    goto int_session_table_continue;
                 }
-                else if (fvField(i) == COLLECT_EGRESS_TIMESTAMP)
+
+                /*
+                 * Update only the changed attributes in place. A session OID
+                 * kept stable means every watchlist ACL entry referencing it
+                 * stays valid, instead of being torn down and reprogrammed
+                 * through the INT session change notification.
+                 */
+                bool update_failed = false;
+                for (const auto &i : kfvFieldsValues(t))
                 {
-                    s_attr.id = SAI_DTEL_INT_SESSION_ATTR_COLLECT_EGRESS_TIMESTAMP;
-                    s_attr.value.booldata = (fvValue(i) == ENABLED) ? true : false;
-                    int_session_attr.push_back(s_attr);
+                    auto prev = is_it->second.config.find(fvField(i));
+                    if (prev != is_it->second.config.end() && prev->second == fvValue(i))
+                    {
+                        continue;
+                    }
+
+                    if (!getINTSessionAttr(i, s_attr))
+                    {
+                        continue;
+                    }
+
+                    status = sai_dtel_api->set_dtel_int_session_attribute(
+                        is_it->second.intSessionOid, &s_attr);
+                    if (status != SAI_STATUS_SUCCESS)
+                    {
+                        SWSS_LOG_ERROR("DTEL ERROR: Failed to update INT session %s attribute %s",
+                                       int_session_id.c_str(), fvField(i).c_str());
+                        handleSaiSetStatus(SAI_API_DTEL, status);
+                        update_failed = true;
+                        break;
+                    }
                 }
-                else if (fvField(i) == COLLECT_SWITCH_PORTS)
+
+                if (!update_failed)
                 {
-                    s_attr.id = SAI_DTEL_INT_SESSION_ATTR_COLLECT_SWITCH_PORTS;
-                    s_attr.value.booldata = (fvValue(i) == ENABLED) ? true : false;
-                    int_session_attr.push_back(s_attr);
+                    is_it->second.config = move(config);
+                    goto int_session_table_continue;
                 }
-                else if (fvField(i) == COLLECT_QUEUE_INFO)
+
+                /* Fall back to a full rebuild */
+                if (!deleteINTSession(int_session_id))
                 {
-                    s_attr.id = SAI_DTEL_INT_SESSION_ATTR_COLLECT_QUEUE_INFO;
-                    s_attr.value.booldata = (fvValue(i) == ENABLED) ? true : false;
-                    int_session_attr.push_back(s_attr);
+                    goto int_session_table_continue;
                 }
-                else if (fvField(i) == MAX_HOP_COUNT)
+            }
+
+            for (const auto &i : kfvFieldsValues(t))
+            {
+                if (getINTSessionAttr(i, s_attr))
                 {
-                    s_attr.id = SAI_DTEL_INT_SESSION_ATTR_MAX_HOP_COUNT;
-                    s_attr.value.u16 = to_uint<uint16_t>(fvValue(i));
                     int_session_attr.push_back(s_attr);
                 }
             }
@@ -1355,6 +1480,7 @@ void DTelOrch::doDtelINTSessionTableTask(Consumer &consumer)
 
             DTelINTSessionEntry is_entry;
             is_entry.intSessionOid = int_session_oid;
+            is_entry.config = move(config);
             m_dTelINTSessionTable[int_session_id] = is_entry;
 
             /* Notify all interested parties about INT session being added */
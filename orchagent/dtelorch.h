@@ -52,6 +52,10 @@ struct DTelINTSessionEntry
     sai_object_id_t intSessionOid;
     int64_t refCount;
 
+    /* Applied configuration, kept to detect no-op re-applies and to
+     * update changed attributes in place without recreating the OID */
+    map<string, string> config;
+
     DTelINTSessionEntry() :
         intSessionOid(0),
         refCount(1)
@@ -64,6 +68,9 @@ struct DTelReportSessionEntry
     sai_object_id_t reportSessionOid;
     int64_t refCount;
 
+    /* Applied configuration, same purpose as for INT sessions */
+    map<string, string> config;
+
     DTelReportSessionEntry() :
         reportSessionOid(0),
         refCount(1)
@@ -156,6 +163,9 @@ private:
     void removeEvent(const string& event);
     bool deleteReportSession(const string& report_session_id);
     bool deleteINTSession(const string& int_session_id);
+    bool getReportSessionAttr(const swss::FieldValueTuple& fv, sai_attribute_t& rs_attr,
+                              vector<sai_ip_address_t>& dst_ip_list);
+    bool getINTSessionAttr(const swss::FieldValueTuple& fv, sai_attribute_t& s_attr);
     bool disableQueueReport(const string& port, const string& queue);
     bool unConfigureEvent(string& event);
     sai_status_t updateSinkPortList();
@@ -0,0 +1,119 @@
+#include "eventring.h"
+#include "logger.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <string>
+
+using namespace std;
+
+thread_local EventRing::Ring *EventRing::t_ring = nullptr;
+
+EventRing &EventRing::Instance()
+{
+    static EventRing instance;
+    return instance;
+}
+
+EventRing::Ring *EventRing::threadRing()
+{
+    EventRing &inst = Instance();
+    lock_guard<mutex> lock(inst.m_mutex);
+
+    inst.m_rings.push_back(unique_ptr<Ring>(new Ring()));
+    t_ring = inst.m_rings.back().get();
+    return t_ring;
+}
+
+static const char *eventName(uint16_t id)
+{
+    switch (static_cast<OrchEvent>(id))
+    {
+        case OrchEvent::ConsumerPop:      return "consumer_pop";
+        case OrchEvent::DrainBegin:       return "drain_begin";
+        case OrchEvent::DrainEnd:         return "drain_end";
+        case OrchEvent::BulkerFlushBegin: return "bulker_flush_begin";
+        case OrchEvent::BulkerFlushEnd:   return "bulker_flush_end";
+    }
+    return "unknown";
+}
+
+static void formatEvent(FILE *out, const EventRing::Event &e)
+{
+    fprintf(out, "%" PRIu64 ".%06" PRIu64 " %s",
+            e.ts_ns / 1000000000ULL, (e.ts_ns % 1000000000ULL) / 1000, eventName(e.id));
+
+    switch (static_cast<OrchEvent>(e.id))
+    {
+        case OrchEvent::ConsumerPop:
+        case OrchEvent::DrainBegin:
+        case OrchEvent::DrainEnd:
+            fprintf(out, " %s %" PRIu64 "\n",
+                    reinterpret_cast<const char *>(static_cast<uintptr_t>(e.a0)), e.a1);
+            break;
+        case OrchEvent::BulkerFlushBegin:
+            fprintf(out, " 0x%" PRIx64 " %" PRIu64 "\n", e.a0, e.a1);
+            break;
+        case OrchEvent::BulkerFlushEnd:
+            fprintf(out, " 0x%" PRIx64 "\n", e.a0);
+            break;
+        default:
+            fprintf(out, " %" PRIu64 " %" PRIu64 "\n", e.a0, e.a1);
+            break;
+    }
+}
+
+void EventRing::dump(const char *reason)
+{
+    SWSS_LOG_ENTER();
+
+    lock_guard<mutex> lock(m_mutex);
+
+    auto now = chrono::steady_clock::now();
+    if (m_dumped &&
+        chrono::duration_cast<chrono::seconds>(now - m_lastDump).count() < DUMP_COOLDOWN_SECS)
+    {
+        return;
+    }
+    m_dumped = true;
+    m_lastDump = now;
+
+    vector<Event> events;
+    for (const auto &ring : m_rings)
+    {
+        uint64_t head = ring->head.load(memory_order_acquire);
+        uint64_t first = head > Ring::SIZE ? head - Ring::SIZE : 0;
+        for (uint64_t i = first; i < head; i++)
+        {
+            events.push_back(ring->events[i & (Ring::SIZE - 1)]);
+        }
+    }
+
+    sort(events.begin(), events.end(),
+         [](const Event &a, const Event &b) { return a.ts_ns < b.ts_ns; });
+
+    string tmp = string(EVENT_RING_DUMP_FILE) + ".tmp";
+    FILE *out = fopen(tmp.c_str(), "w");
+    if (out == nullptr)
+    {
+        SWSS_LOG_ERROR("Failed to open %s for the event ring dump", tmp.c_str());
+        return;
+    }
+
+    fprintf(out, "# orchagent event ring dump, reason: %s\n", reason);
+    for (const auto &e : events)
+    {
+        formatEvent(out, e);
+    }
+    fclose(out);
+
+    if (rename(tmp.c_str(), EVENT_RING_DUMP_FILE) != 0)
+    {
+        SWSS_LOG_ERROR("Failed to move the event ring dump to %s", EVENT_RING_DUMP_FILE);
+        return;
+    }
+
+    SWSS_LOG_NOTICE("Dumped %zu ring events to %s (%s)",
+                    events.size(), EVENT_RING_DUMP_FILE, reason);
+}
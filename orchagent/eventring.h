@@ -0,0 +1,117 @@
+#ifndef SWSS_EVENTRING_H
+#define SWSS_EVENTRING_H
+
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <memory>
+#include <vector>
+
+#define EVENT_RING_DUMP_FILE "/var/log/swss/orchagent_events.log"
+
+/*
+ * Structured event identifiers. The hot path records only the id and raw
+ * arguments; the text representation is produced by the dump formatter,
+ * so no printf work happens while draining or flushing.
+ */
+enum class OrchEvent : uint16_t
+{
+    ConsumerPop,        /* a0: executor name, a1: entries popped         */
+    DrainBegin,         /* a0: executor name, a1: pending tasks          */
+    DrainEnd,           /* a0: executor name, a1: tasks left unretired   */
+    BulkerFlushBegin,   /* a0: bulker instance, a1: queued entries       */
+    BulkerFlushEnd,     /* a0: bulker instance                           */
+};
+
+/*
+ * EventRing is an always-on flight recorder for designated hot-path events.
+ * Recording writes a fixed-size binary event (timestamp, id, two raw
+ * arguments) into a per-thread overwrite ring and never locks, allocates
+ * or formats, so it stays cheap enough to leave enabled in production and
+ * does not shift timing the way raising the SWSS_LOG level does.
+ *
+ * The rings retain the most recent events per thread. dump() - taken when
+ * a drain sweep stalls, see OrchDaemon - merges them by timestamp and
+ * formats them into EVENT_RING_DUMP_FILE, giving microsecond-granularity
+ * history of the moments leading up to the stall.
+ */
+class EventRing
+{
+public:
+    struct Event
+    {
+        uint64_t ts_ns;
+        uint64_t a0;
+        uint64_t a1;
+        uint16_t id;
+    };
+
+    /*
+     * Per-thread overwrite ring: the owning thread is the only writer and
+     * new events overwrite the oldest, so a full ring costs nothing. dump()
+     * reads racily against the writer; a torn slot at the seam is
+     * acceptable in a diagnostic snapshot.
+     */
+    struct Ring
+    {
+        static constexpr size_t SIZE = 8192;        /* power of two */
+        Event events[SIZE];
+        std::atomic<uint64_t> head{0};
+    };
+
+    static EventRing &Instance();
+
+    static inline uint64_t now()
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+    }
+
+    /* Hot path; no locks, no allocation, no formatting */
+    static inline void record(OrchEvent id, uint64_t a0 = 0, uint64_t a1 = 0)
+    {
+        Ring *ring = t_ring != nullptr ? t_ring : Instance().threadRing();
+        uint64_t head = ring->head.load(std::memory_order_relaxed);
+        Event &e = ring->events[head & (Ring::SIZE - 1)];
+        e.ts_ns = now();
+        e.a0 = a0;
+        e.a1 = a1;
+        e.id = static_cast<uint16_t>(id);
+        ring->head.store(head + 1, std::memory_order_release);
+    }
+
+    /* String arguments are recorded as pointers; they must outlive dump() */
+    static inline uint64_t strArg(const char *s)
+    {
+        return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(s));
+    }
+
+    /* Format the retained events into EVENT_RING_DUMP_FILE; rate limited */
+    void dump(const char *reason);
+
+private:
+    EventRing() = default;
+    EventRing(const EventRing &) = delete;
+    EventRing &operator=(const EventRing &) = delete;
+
+    /* Minimum spacing between dumps so a persistent stall cannot spam */
+    static constexpr long DUMP_COOLDOWN_SECS = 600;
+
+    /* Allocate and register this thread's ring on its first event */
+    Ring *threadRing();
+
+    /* Guards ring registration and dumping; never taken by record() */
+    std::mutex m_mutex;
+    std::vector<std::unique_ptr<Ring>> m_rings;
+    std::chrono::steady_clock::time_point m_lastDump;
+    bool m_dumped = false;
+
+    static thread_local Ring *t_ring;
+};
+
+#endif /* SWSS_EVENTRING_H */
@@ -45,6 +45,9 @@ using TimePoint = std::chrono::time_point<Clock>;
 #define RECOVERY_POLLS_CFG 8
 #define ERROR_RATE_CRC_CELLS_CFG 1
 #define ERROR_RATE_RX_CELLS_CFG 61035156
+// weight of the moving average of per poll error deltas:
+// new = old + (sample - old) / weight
+#define FABRIC_MON_EWMA_WEIGHT 8
 #define FABRIC_LINK_RATE 44316
 
 extern sai_object_id_t gSwitchId;
@@ -622,6 +625,7 @@ void FabricPortsOrch::updateFabricDebugCounters()
             SWSS_LOG_INFO("No state infor for port %s", key.c_str());
             return;
         }
+        refreshStateDbShadow(key, values);
         for (auto val : values)
         {
             valuePt = fvValue(val);
@@ -808,7 +812,14 @@ void FabricPortsOrch::updateFabricDebugCounters()
                     consecutivePollsWithErrors = 0;
                 }
             }
-            SWSS_LOG_INFO("port %s diffCrcCells %lld", key.c_str(), (long long)diffCrcCells);
+            // Fold this poll's delta into the moving average of crc errors
+            // and mirror it to STATE_DB when the rounded value moves.
+            double& crcEwma = m_laneCrcErrEwma[lane];
+            crcEwma += (static_cast<double>(diffCrcCells) - crcEwma) / FABRIC_MON_EWMA_WEIGHT;
+            updateStateDbTable(m_stateTable, key, "CRC_ERR_EWMA",
+                               static_cast<uint64_t>(llround(crcEwma)));
+            SWSS_LOG_INFO("port %s diffCrcCells %lld ewma %.2f", key.c_str(),
+                          (long long)diffCrcCells, crcEwma);
             SWSS_LOG_INFO("consecutivePollsWithCRCErrs %lld consecutivePollsWithNoCRCErrs %lld",
                            (long long)consecutivePollsWithErrors, (long long)consecutivePollsWithNoErrors);
         }
@@ -839,7 +850,12 @@ void FabricPortsOrch::updateFabricDebugCounters()
                 diffCodeErrors = codeErrors - prevCodeErrors;
                 prevCodeErrors = codeErrors;
             }
-            SWSS_LOG_INFO("port %s diffCodeErrors %lld", key.c_str(), (long long)diffCodeErrors);
+            double& codeEwma = m_laneCodeErrEwma[lane];
+            codeEwma += (static_cast<double>(diffCodeErrors) - codeEwma) / FABRIC_MON_EWMA_WEIGHT;
+            updateStateDbTable(m_stateTable, key, "CODE_ERR_EWMA",
+                               static_cast<uint64_t>(llround(codeEwma)));
+            SWSS_LOG_INFO("port %s diffCodeErrors %lld ewma %.2f", key.c_str(),
+                          (long long)diffCodeErrors, codeEwma);
             if (diffCodeErrors > 0)
             {
                 if (consecutivePollsWithFecErrs < fecIsolatedPolls)
@@ -944,21 +960,25 @@ void FabricPortsOrch::updateFabricDebugCounters()
         updateStateDbTable(m_stateTable, key, "ISOLATED", isolated);
         updateStateDbTable(m_stateTable, key, "PRM_ISOLATED", permIsolate);
 
-        // Update state_db with error rate
-        valuePt = to_string(rxCells);
-        m_stateTable->hset(key, "RX_CELLS", valuePt.c_str());
-        SWSS_LOG_INFO("port %s set RX_CELLS %s",
-                      key.c_str(), valuePt.c_str());
-
-        valuePt = to_string(prevCrcErrors);
-        m_stateTable->hset(key, "CRC_ERRORS", valuePt.c_str());
-        SWSS_LOG_INFO("port %s set CRC_ERRORS %s",
-                      key.c_str(), valuePt.c_str());
-
-        valuePt = to_string(prevCodeErrors);
-        m_stateTable->hset(key, "CODE_ERRORS", valuePt.c_str());
-        SWSS_LOG_INFO("port %s set CODE_ERRORS %s",
-                      key.c_str(), valuePt.c_str());
+        // Update state_db with error rate. On an idle lane none of these
+        // moved, so none of them costs a write.
+        updateStateDbTable(m_stateTable, key, "RX_CELLS", rxCells);
+        updateStateDbTable(m_stateTable, key, "CRC_ERRORS", prevCrcErrors);
+        updateStateDbTable(m_stateTable, key, "CODE_ERRORS", prevCodeErrors);
+    }
+}
+
+// Remember what STATE_DB currently holds for a port key, so that
+// updateStateDbTable can tell changed values from unchanged ones.
+void FabricPortsOrch::refreshStateDbShadow(
+    const std::string& key,
+    const std::vector<FieldValueTuple>& values)
+{
+    auto& shadow = m_stateDbShadow[key];
+    shadow.clear();
+    for (const auto& val : values)
+    {
+        shadow[fvField(val)] = fvValue(val);
     }
 }
 
@@ -972,6 +992,17 @@ void FabricPortsOrch::updateStateDbTable(
     // Convert the integer value to a string
     std::string valueStr = std::to_string(value);
 
+    // Skip the write if STATE_DB already holds this value. The shadow is
+    // refreshed from the actual table content on every debug poll, so a
+    // stale suppression heals within one poll.
+    auto& shadow = m_stateDbShadow[key];
+    auto it = shadow.find(field);
+    if (it != shadow.end() && it->second == valueStr)
+    {
+        return;
+    }
+    shadow[field] = valueStr;
+
     // Update the state table
     stateTable->hset(key, field, valueStr.c_str());
 
@@ -59,6 +59,16 @@ private:
     bool m_debugTimerEnabled = false;
     bool m_isSwitchStatsGenerated = false;
 
+    // Last value seen in STATE_DB per port key and field, refreshed from the
+    // per poll read. Lets link monitoring skip hset calls for fields that
+    // did not change, so a healthy lane costs no STATE_DB writes per poll.
+    unordered_map<std::string, unordered_map<std::string, std::string>> m_stateDbShadow;
+
+    // Exponentially weighted moving averages of the per poll error deltas,
+    // maintained in memory per fabric lane.
+    unordered_map<int, double> m_laneCrcErrEwma;
+    unordered_map<int, double> m_laneCodeErrEwma;
+
     int m_defaultPollWithErrors = 0;
     int m_defaultPollWithNoErrors = 8;
     int m_defaultPollWithFecErrors = 0;
@@ -78,6 +88,9 @@ private:
     void updateFabricRate();
     void createSwitchDropCounters();
     void clearFabricCnt(int lane, bool clearIsolation);
+    void refreshStateDbShadow(
+        const std::string& key,
+        const std::vector<swss::FieldValueTuple>& values);
     void updateStateDbTable(
         const unique_ptr<Table>& stateTable,
         const string& key,
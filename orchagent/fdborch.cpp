@@ -8,6 +8,8 @@
 #include "logger.h"
 #include "tokenize.h"
 #include "fdborch.h"
+#include "fieldvalueview.h"
+#include "pipelineperf.h"
 #include "crmorch.h"
 #include "notifier.h"
 #include "sai_serialize.h"
@@ -29,6 +31,8 @@ FdbOrch::FdbOrch(DBConnector* applDbConnector, vector<table_name_with_pri_t> app
     Orch(applDbConnector, appFdbTables),
     m_portsOrch(port),
     m_fdbStateTable(stateDbFdbConnector.first, stateDbFdbConnector.second),
+    m_fdbStatePipeline(new RedisPipeline(stateDbFdbConnector.first)),
+    m_fdbStateBatchTable(m_fdbStatePipeline.get(), stateDbFdbConnector.second, true),
     m_mclagFdbStateTable(stateDbMclagFdbConnector.first, stateDbMclagFdbConnector.second)
 {
     for(auto it: appFdbTables)
@@ -175,33 +179,6 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
     }
 }
 
-/*
-clears stateDb and decrements corresponding internal fdb counters
-*/
-void FdbOrch::clearFdbEntry(const FdbEntry& entry)
-{
-    FdbUpdate update;
-    update.entry = entry;
-    update.add = false;
-
-    /* Fetch Vlan and decrement the counter */
-    Port temp_vlan;
-    if (m_portsOrch->getPort(entry.bv_id, temp_vlan))
-    {
-        m_portsOrch->decrFdbCount(temp_vlan.m_alias, 1);
-    }
-
-    /* Decrement port fdb_counter */
-    m_portsOrch->decrFdbCount(entry.port_name, 1);
-
-    /* Remove the FdbEntry from the internal cache, update state DB and CRM counter */
-    storeFdbEntryState(update);
-    notify(SUBJECT_TYPE_FDB_CHANGE, &update);
-
-    SWSS_LOG_INFO("FdbEntry removed from internal cache, MAC: %s , port: %s, BVID: 0x%" PRIx64,
-                   update.entry.mac.to_string().c_str(), update.entry.port_name.c_str(), update.entry.bv_id);
-}
-
 /*
 Handles the SAI_FDB_EVENT_FLUSHED notification recieved from syncd
 */
@@ -213,65 +190,104 @@ void FdbOrch::handleSyncdFlushNotif(const sai_object_id_t& bv_id,
     // Consolidated flush will have a zero mac
     MacAddress flush_mac("00:00:00:00:00:00");
 
-    if (bridge_port_id == SAI_NULL_OBJECT_ID && bv_id == SAI_NULL_OBJECT_ID)
-    {
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
+    /*
+     * The flush predicate is applied against the in-memory table in a
+     * single sweep. Counter updates are accumulated per port and vlan and
+     * the state DB deletes go through the buffered pipeline, so flushing
+     * a many-MAC port costs one batched update instead of one write per
+     * entry.
+     */
+    vector<FdbUpdate> removals;
+    unordered_map<sai_object_id_t, Port> vlans;
+    unordered_map<string, int> port_decrements;
+    unordered_map<string, int> vlan_decrements;
+    size_t pending_dels = 0;
+
+    for (auto itr = m_entries.begin(); itr != m_entries.end();)
+    {
+        auto curr = itr++;
+
+        if (bridge_port_id != SAI_NULL_OBJECT_ID &&
+            curr->second.bridge_port_id != bridge_port_id)
         {
-            auto curr = itr++;
-            if (curr->second.sai_fdb_type == sai_fdb_type &&
-                (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-            {
-                clearFdbEntry(curr->first);
-            }
+            continue;
         }
-    }
-    else if (bv_id == SAI_NULL_OBJECT_ID)
-    {
-        /* FLUSH based on PORT */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
+        if (bv_id != SAI_NULL_OBJECT_ID && curr->first.bv_id != bv_id)
         {
-            auto curr = itr++;
-            if (curr->second.bridge_port_id == bridge_port_id)
-            {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first);
-                }
-            }
+            continue;
         }
-    }
-    else if (bridge_port_id == SAI_NULL_OBJECT_ID)
-    {
-        /* FLUSH based on BV_ID */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
+        if (curr->second.sai_fdb_type != sai_fdb_type ||
+            (curr->first.mac != mac && mac != flush_mac) ||
+            !curr->second.is_flush_pending)
         {
-            auto curr = itr++;
-            if (curr->first.bv_id == bv_id)
-            {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first);
-                }
-            }
+            continue;
         }
-    }
-    else
-    {
-        /* FLUSH based on port and VLAN */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
+
+        FdbUpdate update;
+        update.entry = curr->first;
+        update.add = false;
+
+        auto vit = vlans.find(curr->first.bv_id);
+        if (vit == vlans.end())
         {
-            auto curr = itr++;
-            if (curr->first.bv_id == bv_id && curr->second.bridge_port_id == bridge_port_id)
+            Port vlan;
+            if (!m_portsOrch->getPort(curr->first.bv_id, vlan))
             {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first);
-                }
+                SWSS_LOG_NOTICE("FdbOrch notification: Failed to locate \
+                                 vlan port from bv_id 0x%" PRIx64, curr->first.bv_id);
+                /* Match the single-entry removal path: the entry stays
+                 * cached but the port counter and observers are updated */
+                port_decrements[curr->first.port_name]++;
+                removals.push_back(update);
+                continue;
             }
+            vit = vlans.emplace(curr->first.bv_id, vlan).first;
         }
+
+        vlan_decrements[vit->second.m_alias]++;
+        port_decrements[curr->first.port_name]++;
+
+        string key = "Vlan" + to_string(vit->second.m_vlan_info.vlan_id) + ":" +
+                     curr->first.mac.to_string();
+        if (curr->second.origin == FDB_ORIGIN_MCLAG_ADVERTIZED)
+        {
+            SWSS_LOG_NOTICE("fdbEvent: FdbOrch MCLAG remote mac %s deleted, remove from state mclag remote fdb table:"
+                            "bv_id 0x%" PRIx64, curr->first.mac.to_string().c_str(), curr->first.bv_id);
+            m_mclagFdbStateTable.del(key);
+        }
+        if ((curr->second.origin == FDB_ORIGIN_LEARN) ||
+            (curr->second.origin == FDB_ORIGIN_PROVISIONED))
+        {
+            m_fdbStateBatchTable.del(key);
+            pending_dels++;
+        }
+        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_FDB_ENTRY);
+
+        SWSS_LOG_INFO("FdbEntry removed from internal cache, MAC: %s , port: %s, BVID: 0x%" PRIx64,
+                      update.entry.mac.to_string().c_str(), update.entry.port_name.c_str(),
+                      update.entry.bv_id);
+
+        m_entries.erase(curr);
+        removals.push_back(update);
+    }
+
+    if (pending_dels)
+    {
+        PipelinePerf::Instance().flushPipeline("FDB_STATE", m_fdbStatePipeline.get());
+    }
+
+    for (const auto &decrement : vlan_decrements)
+    {
+        m_portsOrch->decrFdbCount(decrement.first, decrement.second);
+    }
+    for (const auto &decrement : port_decrements)
+    {
+        m_portsOrch->decrFdbCount(decrement.first, decrement.second);
+    }
+
+    for (auto &update : removals)
+    {
+        notify(SUBJECT_TYPE_FDB_CHANGE, &update);
     }
 }
 
@@ -749,7 +765,7 @@ void FdbOrch::doTask(Consumer& consumer)
                     it = consumer.m_toSync.erase(it);
                     continue;
                 }
-                deleteFdbEntryFromSavedFDB(MacAddress(keys[1]), vlan_id, origin);
+                deleteFdbEntryFromSavedFDB(FieldValueView::cachedMac(keys[1]), vlan_id, origin);
 
                 it = consumer.m_toSync.erase(it);
             }
@@ -761,7 +777,7 @@ void FdbOrch::doTask(Consumer& consumer)
         }
 
         FdbEntry entry;
-        entry.mac = MacAddress(keys[1]);
+        entry.mac = FieldValueView::cachedMac(keys[1]);
         entry.bv_id = vlan.m_vlan_info.vlan_oid;
 
         if (op == SET_COMMAND)
@@ -956,7 +972,7 @@ void FdbOrch::doTask(NotificationConsumer& consumer)
             }
 
             if (status == SAI_STATUS_SUCCESS) {
-                for (map<FdbEntry, FdbData>::iterator it = m_entries.begin();
+                for (auto it = m_entries.begin();
                         it != m_entries.end(); it++)
                 {
                     it->second.is_flush_pending = true;
@@ -1051,7 +1067,70 @@ void FdbOrch::doTask(NotificationConsumer& consumer)
         sai_fdb_event_notification_data_t *fdbevent = nullptr;
         sai_deserialize_fdb_event_ntf(data, count, &fdbevent);
 
-        for (uint32_t i = 0; i < count; ++i)
+        /*
+         * Coalesce events for the same {mac, bv_id} within this notification.
+         * A MAC move storm delivers long bursts where the same MAC flaps
+         * between bridge ports, and replaying every intermediate event
+         * through update() costs a state table write and an observer walk
+         * each. Only same-type runs are merged: a repeated MOVE or LEARNED
+         * is replaced by the newest one (update() only uses the current
+         * cache state and the final bridge port; some vendors report a
+         * station move as a bare LEARNED on the new port, so a later
+         * LEARNED can carry a different port and must win), while a
+         * repeated AGED runs against an unchanged cache and at most repeats
+         * idempotent work, so duplicates are dropped. Cross-type merging is
+         * not safe because of the MCLAG and static entry special cases in
+         * update(). FLUSHED events can match wildcards, so they act as
+         * barriers.
+         */
+        std::vector<uint32_t> kept;
+        kept.reserve(count);
+        if (count > 1)
+        {
+            unordered_map<FdbEntry, size_t> last_kept;
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                if (fdbevent[i].event_type == SAI_FDB_EVENT_FLUSHED)
+                {
+                    last_kept.clear();
+                    kept.push_back(i);
+                    continue;
+                }
+
+                FdbEntry entry;
+                entry.mac = fdbevent[i].fdb_entry.mac_address;
+                entry.bv_id = fdbevent[i].fdb_entry.bv_id;
+
+                auto prev = last_kept.find(entry);
+                if (prev != last_kept.end() &&
+                    fdbevent[kept[prev->second]].event_type == fdbevent[i].event_type)
+                {
+                    if (fdbevent[i].event_type == SAI_FDB_EVENT_MOVE ||
+                        fdbevent[i].event_type == SAI_FDB_EVENT_LEARNED)
+                    {
+                        kept[prev->second] = i;
+                    }
+                    continue;
+                }
+
+                last_kept[entry] = kept.size();
+                kept.push_back(i);
+            }
+
+            if (kept.size() < count)
+            {
+                SWSS_LOG_INFO("Coalesced %u FDB events into %zu", count, kept.size());
+            }
+        }
+        else
+        {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                kept.push_back(i);
+            }
+        }
+
+        for (uint32_t i : kept)
         {
             sai_object_id_t oid = SAI_NULL_OBJECT_ID;
             sai_fdb_entry_type_t sai_fdb_type = SAI_FDB_ENTRY_TYPE_DYNAMIC;
@@ -1132,7 +1211,7 @@ void FdbOrch::flushFDBEntries(sai_object_id_t bridge_port_oid,
     }
 
     if (SAI_STATUS_SUCCESS == rv) {
-        for (map<FdbEntry, FdbData>::iterator it = m_entries.begin();
+        for (auto it = m_entries.begin();
                 it != m_entries.end(); it++)
         {
             if ((bridge_port_oid != SAI_NULL_OBJECT_ID &&
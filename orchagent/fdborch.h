@@ -1,6 +1,8 @@
 #ifndef SWSS_FDBORCH_H
 #define SWSS_FDBORCH_H
 
+#include <boost/functional/hash.hpp>
+
 #include "orch.h"
 #include "observer.h"
 #include "portsorch.h"
@@ -30,6 +32,20 @@ struct FdbEntry
     }
 };
 
+namespace std
+{
+    template <>
+    struct hash<FdbEntry>
+    {
+        size_t operator()(const FdbEntry& entry) const noexcept
+        {
+            size_t seed = boost::hash_range(entry.mac.getMac(), entry.mac.getMac() + 6);
+            boost::hash_combine(seed, entry.bv_id);
+            return seed;
+        }
+    };
+}
+
 struct FdbUpdate
 {
     FdbEntry entry;
@@ -108,10 +124,17 @@ public:
 
 private:
     PortsOrch *m_portsOrch;
-    map<FdbEntry, FdbData> m_entries;
+    /* Hashed storage: the MAC table can hold hundreds of thousands of
+     * entries and every FDB event does a lookup, so a tree walk per event
+     * does not scale. Nothing iterating m_entries depends on key order. */
+    unordered_map<FdbEntry, FdbData> m_entries;
     fdb_entries_by_port_t saved_fdb_entries;
     vector<Table*> m_appTables;
     Table m_fdbStateTable;
+    /* Buffered view of the FDB state table: flush handling queues its
+     * per-entry deletes here and issues them with one pipeline flush */
+    unique_ptr<RedisPipeline> m_fdbStatePipeline;
+    Table m_fdbStateBatchTable;
     Table m_mclagFdbStateTable;
     NotificationConsumer* m_flushNotificationsConsumer;
     NotificationConsumer* m_fdbNotificationConsumer;
@@ -129,7 +152,6 @@ private:
     bool storeFdbEntryState(const FdbUpdate& update);
     void notifyTunnelOrch(Port& port);
 
-    void clearFdbEntry(const FdbEntry&);
     void handleSyncdFlushNotif(const sai_object_id_t&, const sai_object_id_t&, const MacAddress&,
                                const sai_fdb_entry_type_t&);
 };
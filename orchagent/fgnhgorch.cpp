@@ -16,6 +16,7 @@ extern sai_object_id_t gVirtualRouterId;
 extern sai_object_id_t gSwitchId;
 
 extern sai_next_hop_group_api_t*    sai_next_hop_group_api;
+extern size_t gMaxBulkSize;
 extern sai_route_api_t*             sai_route_api;
 
 extern RouteOrch *gRouteOrch;
@@ -232,24 +233,62 @@ bool FgNhgOrch::writeHashBucketChange(FGNextHopGroupEntry *syncd_fg_route_entry,
 {
     SWSS_LOG_ENTER();
 
-    sai_attribute_t nhgm_attr;
-    nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
-    nhgm_attr.value.oid = nh_oid;
-    sai_status_t status = sai_next_hop_group_api->set_next_hop_group_member_attribute(
-                                                              syncd_fg_route_entry->nhopgroup_members[index],
-                                                              &nhgm_attr);
-    if (status != SAI_STATUS_SUCCESS)
+    /* Stage the member change, all staged changes for a group change are
+     * programmed with a single bulk call by flushHashBucketChanges */
+    m_pendingHashBucketChanges.push_back(HashBucketChange{index,
+            syncd_fg_route_entry->nhopgroup_members[index], nh_oid, nextHop});
+    return true;
+}
+
+bool FgNhgOrch::flushHashBucketChanges(const IpPrefix &ipPrefix)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pendingHashBucketChanges.empty())
     {
-        SWSS_LOG_ERROR("Failed to set next hop oid %" PRIx64 " member %" PRIx64 ": %d",
-            syncd_fg_route_entry->nhopgroup_members[index], nh_oid, status);
-        task_process_status handle_status = handleSaiSetStatus(SAI_API_NEXT_HOP_GROUP, status);
-        if (handle_status != task_success)
+        return true;
+    }
+
+    size_t total = m_pendingHashBucketChanges.size();
+    for (size_t base = 0; base < total; base += gMaxBulkSize)
+    {
+        size_t count = std::min(gMaxBulkSize, total - base);
+        std::vector<sai_object_id_t> member_oids(count);
+        std::vector<sai_attribute_t> nhgm_attrs(count);
+        std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+
+        for (size_t i = 0; i < count; i++)
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            auto &change = m_pendingHashBucketChanges[base + i];
+            member_oids[i] = change.member_oid;
+            nhgm_attrs[i].id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+            nhgm_attrs[i].value.oid = change.nh_oid;
+        }
+
+        sai_status_t status = sai_next_hop_group_api->set_next_hop_group_members_attribute(
+                                                                  (uint32_t)count,
+                                                                  member_oids.data(),
+                                                                  nhgm_attrs.data(),
+                                                                  SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                                                                  statuses.data());
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to bulk set %zu next hop group members for prefix %s: %d",
+                    count, ipPrefix.to_string().c_str(), status);
+            task_process_status handle_status = handleSaiSetStatus(SAI_API_NEXT_HOP_GROUP, status);
+            if (handle_status != task_success)
+            {
+                m_pendingHashBucketChanges.clear();
+                return parseHandleSaiStatusFailure(handle_status);
+            }
         }
     }
 
-    setStateDbRouteEntry(ipPrefix, index, nextHop);
+    for (auto &change : m_pendingHashBucketChanges)
+    {
+        setStateDbRouteEntry(ipPrefix, change.index, change.nextHop);
+    }
+    m_pendingHashBucketChanges.clear();
     return true;
 }
 
@@ -884,6 +923,12 @@ bool FgNhgOrch::setInactiveBankToNextAvailableActiveBank(FGNextHopGroupEntry *sy
                 return false;
             }
 
+            /* Program any staged member changes before the group is removed */
+            if (!flushHashBucketChanges(ipPrefix))
+            {
+                return false;
+            }
+
             if (!removeFineGrainedNextHopGroup(syncd_fg_route_entry))
             {
                 SWSS_LOG_ERROR("Failed to delete Fine Grained next hop group");
@@ -1016,6 +1061,7 @@ bool FgNhgOrch::computeAndSetHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
             if (!setActiveBankHashBucketChanges(syncd_fg_route_entry, fgNhgEntry,
                         bank_idx, bank_member_changes[bank_idx], nhopgroup_members_set, ipPrefix))
             {
+                m_pendingHashBucketChanges.clear();
                 return false;
             }
         }
@@ -1024,12 +1070,13 @@ bool FgNhgOrch::computeAndSetHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
             if (!setInactiveBankHashBucketChanges(syncd_fg_route_entry, fgNhgEntry,
                         bank_idx, bank_member_changes, nhopgroup_members_set, ipPrefix))
             {
+                m_pendingHashBucketChanges.clear();
                 return false;
             }
         }
     }
 
-    return true;
+    return flushHashBucketChanges(ipPrefix);
 }
 
 
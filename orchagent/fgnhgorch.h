@@ -136,6 +136,17 @@ private:
     FgPrefixOpCache m_fgPrefixAddCache;
     FgPrefixOpCache m_fgPrefixDelCache;
 
+    /* Hash bucket member writes staged by writeHashBucketChange and
+     * programmed with a single bulk SAI call per group change */
+    struct HashBucketChange
+    {
+        HashBucketIdx index;
+        sai_object_id_t member_oid;
+        sai_object_id_t nh_oid;
+        NextHopKey nextHop;
+    };
+    std::vector<HashBucketChange> m_pendingHashBucketChanges;
+
     // warm reboot support for recovery
     // < ip_prefix, < HashBuckets, nh_ip>>
     WarmBootRecoveryMap m_recoveryMap;
@@ -164,6 +175,7 @@ private:
     void setStateDbRouteEntry(const IpPrefix&, uint32_t index, NextHopKey nextHop);
     bool writeHashBucketChange(FGNextHopGroupEntry *syncd_fg_route_entry, uint32_t index, sai_object_id_t nh_oid,
                     const IpPrefix &ipPrefix, NextHopKey nextHop);
+    bool flushHashBucketChanges(const IpPrefix &ipPrefix);
     bool modifyRoutesNextHopId(sai_object_id_t vrf_id, const IpPrefix &ipPrefix, sai_object_id_t next_hop_id);
     bool createFineGrainedNextHopGroup(FGNextHopGroupEntry &syncd_fg_route_entry, FgNhgEntry *fgNhgEntry,
                     const NextHopGroupKey &nextHops);
@@ -0,0 +1,105 @@
+#include "fieldvalueview.h"
+
+#include <unordered_map>
+
+#include "converter.h"
+
+using namespace std;
+using namespace swss;
+
+/* Bound per cache so a scale run cannot grow them without limit; hitting
+ * the bound simply restarts the memoization. */
+#define PARSE_CACHE_MAX_ENTRIES 16384
+
+/* thread_local keeps the ring-buffer route thread and the main loop from
+ * ever contending on the caches. */
+template <typename T>
+static const T &cachedParse(const string &value)
+{
+    thread_local unordered_map<string, T> cache;
+
+    auto it = cache.find(value);
+    if (it == cache.end())
+    {
+        if (cache.size() >= PARSE_CACHE_MAX_ENTRIES)
+        {
+            cache.clear();
+        }
+        /* The constructor throws before anything is inserted, so a
+         * malformed value is never cached. */
+        it = cache.emplace(value, T(value)).first;
+    }
+    return it->second;
+}
+
+const string *FieldValueView::find(const string &field) const
+{
+    const string *value = nullptr;
+    for (const auto &fv : m_values)
+    {
+        if (fvField(fv) == field)
+        {
+            value = &fvValue(fv);
+        }
+    }
+    return value;
+}
+
+bool FieldValueView::str(const string &field, string &out) const
+{
+    auto value = find(field);
+    if (value == nullptr || value->empty())
+    {
+        return false;
+    }
+    out = *value;
+    return true;
+}
+
+bool FieldValueView::u32(const string &field, uint32_t &out) const
+{
+    auto value = find(field);
+    if (value == nullptr || value->empty())
+    {
+        return false;
+    }
+    out = to_uint<uint32_t>(*value);
+    return true;
+}
+
+bool FieldValueView::mac(const string &field, MacAddress &out) const
+{
+    auto value = find(field);
+    if (value == nullptr || value->empty())
+    {
+        return false;
+    }
+    out = cachedMac(*value);
+    return true;
+}
+
+bool FieldValueView::ip(const string &field, IpAddress &out) const
+{
+    auto value = find(field);
+    if (value == nullptr || value->empty())
+    {
+        return false;
+    }
+    out = cachedIp(*value);
+    return true;
+}
+
+const MacAddress &FieldValueView::cachedMac(const string &value)
+{
+    return cachedParse<MacAddress>(value);
+}
+
+const IpAddress &FieldValueView::cachedIp(const string &value)
+{
+    return cachedParse<IpAddress>(value);
+}
+
+const IpPrefix &FieldValueView::cachedIpPrefix(const string &value)
+{
+    return cachedParse<IpPrefix>(value);
+}
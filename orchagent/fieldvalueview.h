@@ -0,0 +1,59 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "table.h"
+#include "ipaddress.h"
+#include "ipprefix.h"
+#include "macaddress.h"
+
+/*
+ * Typed accessors over one task's field-value list.
+ *
+ * The doTask loops re-parse the same literal strings over and over: a task
+ * left in m_toSync for retry is re-converted on every drain, and identical
+ * MAC and IP strings arrive through several tables (the same neighbor MAC
+ * shows up in NEIGH, FDB and VLAN updates). The view resolves a field with
+ * one scan and routes the expensive conversions through small per-thread
+ * parse caches keyed by the literal string, so each distinct string is
+ * parsed once per thread instead of once per visit.
+ *
+ * Malformed values throw whatever the underlying constructor throws today;
+ * the bool return only reports whether the field is present and non-empty.
+ */
+class FieldValueView
+{
+public:
+    explicit FieldValueView(const swss::KeyOpFieldsValuesTuple &tuple)
+        : m_values(kfvFieldsValues(tuple))
+    {
+    }
+
+    explicit FieldValueView(const std::vector<swss::FieldValueTuple> &values)
+        : m_values(values)
+    {
+    }
+
+    /* Raw lookup; nullptr when the field is absent. The last occurrence
+     * wins, matching the last-assignment behavior of the classic field
+     * loops. */
+    const std::string *find(const std::string &field) const;
+
+    bool str(const std::string &field, std::string &out) const;
+    bool u32(const std::string &field, uint32_t &out) const;
+    bool mac(const std::string &field, swss::MacAddress &out) const;
+    bool ip(const std::string &field, swss::IpAddress &out) const;
+
+    /*
+     * The underlying caches, also usable directly on key fragments. The
+     * returned reference is only stable until the next parse on the same
+     * thread; copy it out.
+     */
+    static const swss::MacAddress &cachedMac(const std::string &value);
+    static const swss::IpAddress &cachedIp(const std::string &value);
+    static const swss::IpPrefix &cachedIpPrefix(const std::string &value);
+
+private:
+    const std::vector<swss::FieldValueTuple> &m_values;
+};
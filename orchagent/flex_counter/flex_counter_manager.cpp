@@ -1,5 +1,6 @@
 #include "flex_counter_manager.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "schema.h"
@@ -164,6 +165,91 @@ void FlexCounterManager::updateGroupPollingInterval(
             group_name.c_str(), polling_interval);
 }
 
+void FlexCounterManager::enableAdaptivePolling(
+        const uint max_polling_interval,
+        const uint idle_cycle_threshold)
+{
+    SWSS_LOG_ENTER();
+
+    if (max_polling_interval < polling_interval || idle_cycle_threshold == 0)
+    {
+        SWSS_LOG_ERROR("Invalid adaptive polling parameters for flex counter group '%s': max %d ms, threshold %d.",
+                group_name.c_str(), max_polling_interval, idle_cycle_threshold);
+        return;
+    }
+
+    adaptive_polling = true;
+    this->max_polling_interval = max_polling_interval;
+    this->idle_cycle_threshold = idle_cycle_threshold;
+    effective_polling_interval = polling_interval;
+    idle_cycles = 0;
+
+    SWSS_LOG_NOTICE("Enabled adaptive polling for flex counter group '%s': base %d ms, max %d ms, backoff after %d idle cycles.",
+            group_name.c_str(), polling_interval, max_polling_interval, idle_cycle_threshold);
+}
+
+void FlexCounterManager::disableAdaptivePolling()
+{
+    SWSS_LOG_ENTER();
+
+    if (!adaptive_polling)
+    {
+        return;
+    }
+
+    adaptive_polling = false;
+    if (effective_polling_interval != polling_interval)
+    {
+        updateGroupPollingInterval(polling_interval);
+        effective_polling_interval = polling_interval;
+    }
+
+    SWSS_LOG_NOTICE("Disabled adaptive polling for flex counter group '%s'.",
+            group_name.c_str());
+}
+
+void FlexCounterManager::reportCounterActivity(const bool active)
+{
+    SWSS_LOG_ENTER();
+
+    if (!adaptive_polling)
+    {
+        return;
+    }
+
+    if (active)
+    {
+        idle_cycles = 0;
+        if (effective_polling_interval != polling_interval)
+        {
+            updateGroupPollingInterval(polling_interval);
+            effective_polling_interval = polling_interval;
+
+            SWSS_LOG_INFO("Flex counter group '%s' is active again, restored polling interval to %d ms.",
+                    group_name.c_str(), polling_interval);
+        }
+        return;
+    }
+
+    if (effective_polling_interval >= max_polling_interval)
+    {
+        return;
+    }
+
+    if (++idle_cycles < idle_cycle_threshold)
+    {
+        return;
+    }
+
+    idle_cycles = 0;
+    auto widened = std::min(effective_polling_interval * 2, max_polling_interval);
+    updateGroupPollingInterval(widened);
+    effective_polling_interval = widened;
+
+    SWSS_LOG_INFO("Flex counter group '%s' is idle, widened polling interval to %d ms.",
+            group_name.c_str(), widened);
+}
+
 // enableFlexCounterGroup will do nothing if the flex counter group is already
 // enabled.
 void FlexCounterManager::enableFlexCounterGroup()
@@ -87,6 +87,19 @@ class FlexCounterManager
         void enableFlexCounterGroup();
         void disableFlexCounterGroup();
 
+        // Adaptive cadence: once enabled, callers report whether the group's
+        // counters showed activity during the last cycle. After
+        // idle_cycle_threshold consecutive idle reports the group's polling
+        // interval is doubled (capped at max_polling_interval); the first
+        // active report snaps it back to the configured base interval. The
+        // counter values themselves are read in syncd, so activity detection
+        // is left to the caller that consumes them.
+        void enableAdaptivePolling(
+                const uint max_polling_interval,
+                const uint idle_cycle_threshold = DEFAULT_IDLE_CYCLE_THRESHOLD);
+        void disableAdaptivePolling();
+        void reportCounterActivity(const bool active);
+
         virtual void setCounterIdList(
                 const sai_object_id_t object_id,
                 const CounterType counter_type,
@@ -129,6 +142,17 @@ class FlexCounterManager
         std::unordered_map<sai_object_id_t, sai_object_id_t> installed_counters;
         bool is_gearbox;
 
+        static const uint DEFAULT_IDLE_CYCLE_THRESHOLD = 3;
+
+        // Adaptive cadence state; effective_polling_interval tracks what was
+        // last written to the group while polling_interval stays the
+        // configured base the engine tightens back to.
+        bool adaptive_polling = false;
+        uint max_polling_interval = 0;
+        uint effective_polling_interval = 0;
+        uint idle_cycle_threshold = DEFAULT_IDLE_CYCLE_THRESHOLD;
+        uint idle_cycles = 0;
+
         static std::string serializeCounterStats(
                 const std::unordered_set<std::string>& counter_stats);
 
@@ -1,13 +1,18 @@
 #include "flex_counter_stat_manager.h"
 
+#include <map>
+#include <vector>
+
 #include "schema.h"
 #include "rediscommand.h"
 #include "logger.h"
 #include "sai_serialize.h"
 
+using std::map;
 using std::string;
 using std::unordered_map;
 using std::unordered_set;
+using std::vector;
 using swss::FieldValueTuple;
 
 FlexCounterStatManager::FlexCounterStatManager(
@@ -92,3 +97,118 @@ void FlexCounterStatManager::removeFlexCounterStat(
             counter_stat.c_str(),
             sai_serialize_object_id(object_id).c_str());
 }
+
+// addFlexCounterStats adds a stat to every given object in one pass: the
+// group configuration is re-applied once and the resulting counter id lists
+// are programmed through setCounterIdLists.
+void FlexCounterStatManager::addFlexCounterStats(
+        const vector<sai_object_id_t>& object_ids,
+        const CounterType counter_type,
+        const string& counter_stat)
+{
+    SWSS_LOG_ENTER();
+
+    if (object_ids.empty())
+    {
+        return;
+    }
+
+    for (const auto& object_id : object_ids)
+    {
+        object_stats[object_id].emplace(counter_stat);
+    }
+
+    // FIXME: see addFlexCounterStat, the group configuration has to be
+    // re-applied until syncd flex counters are refactored.
+    FlexCounterManager::applyGroupConfiguration();
+
+    setCounterIdLists(object_ids, counter_type);
+
+    SWSS_LOG_DEBUG("Added flex stat '%s' to %zu objects", counter_stat.c_str(), object_ids.size());
+}
+
+// removeFlexCounterStats removes a stat from every given object in one pass,
+// deleting the flex counter for objects whose stat set becomes empty.
+void FlexCounterStatManager::removeFlexCounterStats(
+        const vector<sai_object_id_t>& object_ids,
+        const CounterType counter_type,
+        const string& counter_stat)
+{
+    SWSS_LOG_ENTER();
+
+    vector<sai_object_id_t> remaining_objects;
+    remaining_objects.reserve(object_ids.size());
+
+    for (const auto& object_id : object_ids)
+    {
+        auto counter_stats = object_stats.find(object_id);
+        if (counter_stats == object_stats.end())
+        {
+            SWSS_LOG_WARN("Could not find flex stat '%s' on object '%s'",
+                    counter_stat.c_str(), sai_serialize_object_id(object_id).c_str());
+            continue;
+        }
+
+        counter_stats->second.erase(counter_stat);
+
+        if (counter_stats->second.empty())
+        {
+            object_stats.erase(counter_stats);
+            FlexCounterManager::clearCounterIdList(object_id);
+            continue;
+        }
+
+        remaining_objects.push_back(object_id);
+    }
+
+    setCounterIdLists(remaining_objects, counter_type);
+
+    SWSS_LOG_DEBUG("Removed flex stat '%s' from %zu objects", counter_stat.c_str(), object_ids.size());
+}
+
+// setCounterIdLists programs the current stat sets of the given objects,
+// serializing each distinct stat set once and grouping the objects sharing it
+// into a single comma-joined polling key.
+void FlexCounterStatManager::setCounterIdLists(
+        const vector<sai_object_id_t>& object_ids,
+        const CounterType counter_type)
+{
+    SWSS_LOG_ENTER();
+
+    if (gTraditionalFlexCounter)
+    {
+        // Comma-joined keys are only understood on the flex counter channel
+        for (const auto& object_id : object_ids)
+        {
+            FlexCounterManager::setCounterIdList(object_id, counter_type, object_stats.at(object_id));
+        }
+        return;
+    }
+
+    auto counter_type_it = counter_id_field_lookup.find(counter_type);
+    if (counter_type_it == counter_id_field_lookup.end())
+    {
+        SWSS_LOG_ERROR("Could not update flex counter id lists for group '%s': counter type not found.",
+                group_name.c_str());
+        return;
+    }
+
+    map<string, string> keys_by_counter_ids;
+    for (const auto& object_id : object_ids)
+    {
+        auto counter_ids = serializeCounterStats(object_stats.at(object_id));
+        auto& keys = keys_by_counter_ids[counter_ids];
+        if (!keys.empty())
+        {
+            keys += ",";
+        }
+        keys += sai_serialize_object_id(object_id);
+        installed_counters[object_id] = gSwitchId;
+    }
+
+    for (const auto& entry : keys_by_counter_ids)
+    {
+        startFlexCounterPolling(gSwitchId, group_name + ":" + entry.second,
+                entry.first, counter_type_it->second);
+    }
+}
@@ -27,7 +27,23 @@ class FlexCounterStatManager : public FlexCounterManager
                 const CounterType counter_type,
                 const std::string& counter_stat);
 
+        // Batch variants: the group configuration is applied once and the
+        // counter id list is serialized once per distinct stat set, so adding
+        // a stat to every port does not redo both per object.
+        void addFlexCounterStats(
+                const std::vector<sai_object_id_t>& object_ids,
+                const CounterType counter_type,
+                const std::string& counter_stat);
+        void removeFlexCounterStats(
+                const std::vector<sai_object_id_t>& object_ids,
+                const CounterType counter_type,
+                const std::string& counter_stat);
+
     private:
+        void setCounterIdLists(
+                const std::vector<sai_object_id_t>& object_ids,
+                const CounterType counter_type);
+
         std::unordered_map<sai_object_id_t, std::unordered_set<std::string>> object_stats;
 };
 
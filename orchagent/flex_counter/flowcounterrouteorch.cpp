@@ -190,6 +190,8 @@ void FlowCounterRouteOrch::generateRouteFlowStats()
     {
         createRouteFlowCounterByPattern(route_pattern, 0);
     }
+
+    processRouteFlowCounterBinding();
 }
 
 void FlowCounterRouteOrch::clearRouteFlowStats()
@@ -216,6 +218,8 @@ void FlowCounterRouteOrch::clearRouteFlowStats()
             }
         }
 
+        processRouteFlowCounterBinding();
+
         mBoundRouteCounters.clear();
         mPendingAddToFlexCntr.clear();
     }
@@ -242,6 +246,7 @@ void FlowCounterRouteOrch::addRoutePattern(const std::string &pattern, size_t ma
             return;
         }
 
+        rebuildRoutePatternMatcher();
         createRouteFlowCounterByPattern(*insert_result.first, 0);
     }
     else
@@ -250,6 +255,8 @@ void FlowCounterRouteOrch::addRoutePattern(const std::string &pattern, size_t ma
         RoutePattern &existing = const_cast<RoutePattern &>(*insert_result.first);
         onRoutePatternMaxMatchCountChange(existing, max_match_count);
     }
+
+    processRouteFlowCounterBinding();
 }
 
 void FlowCounterRouteOrch::removeRoutePattern(const std::string& pattern)
@@ -273,8 +280,10 @@ void FlowCounterRouteOrch::removeRoutePattern(const std::string& pattern)
         return;
     }
     mRoutePatternSet.erase(iter);
+    rebuildRoutePatternMatcher();
 
     removeRoutePattern(route_pattern);
+    processRouteFlowCounterBinding();
 }
 
 void FlowCounterRouteOrch::removeRoutePattern(const RoutePattern &route_pattern)
@@ -425,10 +434,13 @@ void FlowCounterRouteOrch::onAddVR(sai_object_id_t vrf_id)
         {
             RoutePattern &existing = const_cast<RoutePattern &>(route_pattern);
             existing.vrf_id = vrf_id;
+            rebuildRoutePatternMatcher();
             createRouteFlowCounterByPattern(existing, 0);
             break;
         }
     }
+
+    processRouteFlowCounterBinding();
 }
 
 void FlowCounterRouteOrch::onRemoveVR(sai_object_id_t vrf_id)
@@ -449,6 +461,9 @@ void FlowCounterRouteOrch::onRemoveVR(sai_object_id_t vrf_id)
             existing.vrf_id = SAI_NULL_OBJECT_ID;
         }
     }
+
+    rebuildRoutePatternMatcher();
+    processRouteFlowCounterBinding();
 }
 
 bool FlowCounterRouteOrch::bindFlowCounter(const RoutePattern &route_pattern, sai_object_id_t vrf_id, const IpPrefix& ip_prefix)
@@ -472,14 +487,11 @@ bool FlowCounterRouteOrch::bindFlowCounter(const RoutePattern &route_pattern, sa
     attr.id = SAI_ROUTE_ENTRY_ATTR_COUNTER_ID;
     attr.value.oid = counter_oid;
 
-    auto status = sai_route_api->set_route_entry_attribute(&route_entry, &attr);
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        FlowCounterHandler::removeGenericCounter(counter_oid);
-        SWSS_LOG_WARN("Failed to bind route entry vrf=%s prefix=%s to flow counter", route_pattern.vrf_name.c_str(), ip_prefix.to_string().c_str());
-        return false;
-    }
+    mRouteCounterBulkContexts.emplace_back(route_pattern, ip_prefix, counter_oid, true);
+    gRouteBulker.set_entry_attribute(&mRouteCounterBulkContexts.back().object_status, &route_entry, &attr);
 
+    // Insert into the pending cache right away so the walk sees the route as
+    // bound; a failed bulk status undoes this in processRouteFlowCounterBinding
     pendingUpdateFlexDb(route_pattern, ip_prefix, counter_oid);
     return true;
 }
@@ -498,13 +510,53 @@ void FlowCounterRouteOrch::unbindFlowCounter(const RoutePattern &route_pattern,
     attr.id = SAI_ROUTE_ENTRY_ATTR_COUNTER_ID;
     attr.value.oid = SAI_NULL_OBJECT_ID;
 
-    auto status = sai_route_api->set_route_entry_attribute(&route_entry, &attr);
-    if (status != SAI_STATUS_SUCCESS)
+    // The generic counter is removed after the bulker is flushed, see
+    // processRouteFlowCounterBinding
+    mRouteCounterBulkContexts.emplace_back(route_pattern, ip_prefix, counter_oid, false);
+    gRouteBulker.set_entry_attribute(&mRouteCounterBulkContexts.back().object_status, &route_entry, &attr);
+}
+
+void FlowCounterRouteOrch::processRouteFlowCounterBinding()
+{
+    SWSS_LOG_ENTER();
+
+    if (mRouteCounterBulkContexts.empty())
     {
-        SWSS_LOG_WARN("Failed to unbind route entry vrf=%s prefix=%s from flow counter", route_pattern.vrf_name.c_str(), ip_prefix.to_string().c_str());
+        return;
     }
 
-    FlowCounterHandler::removeGenericCounter(counter_oid);
+    gRouteBulker.flush();
+
+    for (auto &ctx : mRouteCounterBulkContexts)
+    {
+        if (ctx.bind)
+        {
+            if (ctx.object_status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_WARN("Failed to bind route entry vrf=%s prefix=%s to flow counter", ctx.route_pattern.vrf_name.c_str(), ctx.ip_prefix.to_string().c_str());
+                auto pending_iter = mPendingAddToFlexCntr.find(ctx.route_pattern);
+                if (pending_iter != mPendingAddToFlexCntr.end())
+                {
+                    pending_iter->second.erase(ctx.ip_prefix);
+                    if (pending_iter->second.empty())
+                    {
+                        mPendingAddToFlexCntr.erase(pending_iter);
+                    }
+                }
+                FlowCounterHandler::removeGenericCounter(ctx.counter_oid);
+            }
+        }
+        else
+        {
+            if (ctx.object_status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_WARN("Failed to unbind route entry vrf=%s prefix=%s from flow counter", ctx.route_pattern.vrf_name.c_str(), ctx.ip_prefix.to_string().c_str());
+            }
+            FlowCounterHandler::removeGenericCounter(ctx.counter_oid);
+        }
+    }
+
+    mRouteCounterBulkContexts.clear();
 }
 
 bool FlowCounterRouteOrch::removeRouteFlowCounter(const RoutePattern &route_pattern, sai_object_id_t vrf_id, const IpPrefix& ip_prefix)
@@ -855,6 +907,38 @@ void FlowCounterRouteOrch::getRouteFlowCounterNameMapKey(sai_object_id_t vrf_id,
     key = oss.str();
 }
 
+void FlowCounterRouteOrch::rebuildRoutePatternMatcher()
+{
+    SWSS_LOG_ENTER();
+
+    mRoutePatternMatcher.clear();
+    for (const auto &route_pattern : mRoutePatternSet)
+    {
+        mRoutePatternMatcher[route_pattern.vrf_id].emplace(route_pattern.ip_prefix, &route_pattern);
+    }
+}
+
+const RoutePattern *FlowCounterRouteOrch::matchRoutePattern(sai_object_id_t vrf_id, const IpPrefix &ip_prefix) const
+{
+    auto vrf_iter = mRoutePatternMatcher.find(vrf_id);
+    if (vrf_iter == mRoutePatternMatcher.end())
+    {
+        return nullptr;
+    }
+
+    auto iter = vrf_iter->second.longestMatch(ip_prefix);
+    if (iter == vrf_iter->second.end())
+    {
+        return nullptr;
+    }
+
+    // Patterns are validated to not overlap, so the longest covering pattern
+    // is the only candidate; re-check so an exact-match (default route)
+    // pattern does not claim routes it merely covers
+    const RoutePattern *route_pattern = iter->second;
+    return route_pattern->is_match(vrf_id, ip_prefix) ? route_pattern : nullptr;
+}
+
 void FlowCounterRouteOrch::handleRouteAdd(sai_object_id_t vrf_id, const IpPrefix& ip_prefix)
 {
     if (!mRouteFlowCounterSupported)
@@ -867,16 +951,14 @@ void FlowCounterRouteOrch::handleRouteAdd(sai_object_id_t vrf_id, const IpPrefix
         return;
     }
 
-    for (const auto &route_pattern : mRoutePatternSet)
+    auto *route_pattern = matchRoutePattern(vrf_id, ip_prefix);
+    if (route_pattern != nullptr)
     {
-        if (route_pattern.is_match(vrf_id, ip_prefix))
+        auto current_bound_count = getRouteFlowCounterSizeByPattern(*route_pattern);
+        if (current_bound_count < route_pattern->max_match_count)
         {
-            auto current_bound_count = getRouteFlowCounterSizeByPattern(route_pattern);
-            if (current_bound_count < route_pattern.max_match_count)
-            {
-                bindFlowCounter(route_pattern, vrf_id, ip_prefix);
-            }
-            break;
+            bindFlowCounter(*route_pattern, vrf_id, ip_prefix);
+            processRouteFlowCounterBinding();
         }
     }
 }
@@ -893,22 +975,20 @@ void FlowCounterRouteOrch::handleRouteRemove(sai_object_id_t vrf_id, const IpPre
         return;
     }
 
-    for (const auto &route_pattern : mRoutePatternSet)
+    auto *route_pattern = matchRoutePattern(vrf_id, ip_prefix);
+    if (route_pattern != nullptr)
     {
-        if (route_pattern.is_match(vrf_id, ip_prefix))
+        if (isRouteAlreadyBound(*route_pattern, ip_prefix))
         {
-            if (isRouteAlreadyBound(route_pattern, ip_prefix))
+            if (removeRouteFlowCounter(*route_pattern, vrf_id, ip_prefix))
             {
-                if (removeRouteFlowCounter(route_pattern, vrf_id, ip_prefix))
+                auto current_bound_count = getRouteFlowCounterSizeByPattern(*route_pattern);
+                if (current_bound_count == route_pattern->max_match_count - 1)
                 {
-                    auto current_bound_count = getRouteFlowCounterSizeByPattern(route_pattern);
-                    if (current_bound_count == route_pattern.max_match_count - 1)
-                    {
-                        createRouteFlowCounterByPattern(route_pattern, current_bound_count);
-                    }
+                    createRouteFlowCounterByPattern(*route_pattern, current_bound_count);
+                    processRouteFlowCounterBinding();
                 }
             }
-            break;
         }
     }
 }
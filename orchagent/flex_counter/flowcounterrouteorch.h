@@ -4,6 +4,8 @@
 #include "dbconnector.h"
 #include "ipprefix.h"
 #include "orch.h"
+#include "routetrie.h"
+#include <deque>
 #include <map>
 #include <memory>
 #include <set>
@@ -96,6 +98,21 @@ struct RoutePattern
 
 
 
+/* Counter bind/unbind queued on the route bulker, resolved once the bulker is flushed */
+struct RouteCounterBulkContext
+{
+    RouteCounterBulkContext(const RoutePattern &pattern, const IpPrefix &prefix, sai_object_id_t counter, bool is_bind)
+        :route_pattern(pattern), ip_prefix(prefix), counter_oid(counter), bind(is_bind)
+    {
+    }
+
+    RoutePattern                        route_pattern;
+    IpPrefix                            ip_prefix;
+    sai_object_id_t                     counter_oid;
+    bool                                bind;
+    sai_status_t                        object_status = SAI_STATUS_NOT_EXECUTED;
+};
+
 typedef std::set<RoutePattern> RoutePatternSet;
 /* RoutePattern to <prefix, counter OID> */
 typedef std::map<RoutePattern, std::map<IpPrefix, sai_object_id_t>> RouterFlowCounterCache;
@@ -137,6 +154,10 @@ private:
     bool mRouteFlowCounterSupported = false;
     /* Route pattern set, store configured route patterns */
     RoutePatternSet mRoutePatternSet;
+    /* Per-VRF trie over the configured pattern prefixes, rebuilt whenever the
+     * pattern set changes, so a route event matches in O(prefix length)
+     * instead of scanning every pattern */
+    std::map<sai_object_id_t, RouteTrie<const RoutePattern *>> mRoutePatternMatcher;
     /* Cache for those bound route flow counters*/
     RouterFlowCounterCache mBoundRouteCounters;
     /* Cache for those route flow counters pending update to FLEX DB */
@@ -149,8 +170,12 @@ private:
     SelectableTimer *mFlexCounterUpdTimer = nullptr;
 
     EntityBulker<sai_route_api_t> gRouteBulker;
+    /* Deque so the status slots handed to the bulker keep stable addresses */
+    std::deque<RouteCounterBulkContext> mRouteCounterBulkContexts;
 
     void initRouteFlowCounterCapability();
+    void rebuildRoutePatternMatcher();
+    const RoutePattern *matchRoutePattern(sai_object_id_t vrf_id, const IpPrefix &ip_prefix) const;
     void removeRoutePattern(const RoutePattern &route_pattern);
     void removeRouteFlowCounterFromDB(sai_object_id_t vrf_id, const IpPrefix& ip_prefix, sai_object_id_t counter_oid);
     bool bindFlowCounter(const RoutePattern &route_pattern, sai_object_id_t vrf_id, const IpPrefix& ip_prefix);
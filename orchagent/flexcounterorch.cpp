@@ -65,6 +65,8 @@ int gFlexCounterDelaySec;
 #define SWITCH_KEY                  "SWITCH"
 #define HA_SET_KEY                  "HA_SET"
 
+#define QUEUE_INDEX_LIST_FIELD      "queue_index_list"
+
 unordered_map<string, string> flexCounterGroupMap =
 {
     {"PORT", PORT_STAT_COUNTER_FLEX_COUNTER_GROUP},
@@ -100,7 +102,7 @@ unordered_map<string, string> flexCounterGroupMap =
 
 
 FlexCounterOrch::FlexCounterOrch(DBConnector *db, vector<string> &tableNames):
-    Orch(db, tableNames),
+    Orch(db, tableNames, counter_orch_pri),
     m_bufferQueueConfigTable(db, CFG_BUFFER_QUEUE_TABLE_NAME),
     m_bufferPgConfigTable(db, CFG_BUFFER_PG_TABLE_NAME),
     m_deviceMetadataConfigTable(db, CFG_DEVICE_METADATA_TABLE_NAME)
@@ -193,6 +195,19 @@ void FlexCounterOrch::doTask(Consumer &consumer)
             string bulk_chunk_size;
             string bulk_chunk_size_per_counter;
 
+            // Pick up a queue index filter before the status field can
+            // trigger counter id list generation further down
+            if (key == QUEUE_KEY || key == QUEUE_WATERMARK || key == WRED_QUEUE_KEY)
+            {
+                for (auto valuePair:data)
+                {
+                    if (fvField(valuePair) == QUEUE_INDEX_LIST_FIELD)
+                    {
+                        parseQueueIndexFilter(fvValue(valuePair));
+                    }
+                }
+            }
+
             for (auto valuePair:data)
             {
                 const auto &field = fvField(valuePair);
@@ -546,8 +561,33 @@ map<string, FlexCounterQueueStates> FlexCounterOrch::getQueueConfigurations()
     // to  the FLEX_COUNTER_DB irrespective of BUFFER_QUEUE configuration.
     if ((!isCreateOnlyConfigDbBuffers()) || (gMySwitchType == "voq"))
     {
-        FlexCounterQueueStates flexCounterQueueState(0);
-        queuesStateVector.insert(make_pair(createAllAvailableBuffersStr, flexCounterQueueState));
+        if (m_queueIndexFilter.empty() || (gMySwitchType == "voq"))
+        {
+            FlexCounterQueueStates flexCounterQueueState(0);
+            queuesStateVector.insert(make_pair(createAllAvailableBuffersStr, flexCounterQueueState));
+            return queuesStateVector;
+        }
+
+        /* A queue index filter narrows the all-queues default down to the
+         * configured indexes on every front panel port */
+        for (const auto& it : gPortsOrch->getAllPorts())
+        {
+            if (it.second.m_type != Port::PHY)
+            {
+                continue;
+            }
+
+            uint32_t maxQueueNumber = gPortsOrch->getNumberOfPortSupportedQueueCounters(it.first);
+            FlexCounterQueueStates flexCounterQueueState(maxQueueNumber);
+            for (auto queueIndex : m_queueIndexFilter)
+            {
+                if (queueIndex < maxQueueNumber)
+                {
+                    flexCounterQueueState.enableQueueCounter(queueIndex);
+                }
+            }
+            queuesStateVector.insert(make_pair(it.first, flexCounterQueueState));
+        }
         return queuesStateVector;
     }
 
@@ -581,14 +621,18 @@ map<string, FlexCounterQueueStates> FlexCounterOrch::getQueueConfigurations()
 
             try {
                 auto startIndex = to_uint<uint32_t>(toks[0], minQueueIndex, maxQueueIndex);
+                auto endIndex = startIndex;
                 if (toks.size() > 1)
                 {
-                    auto endIndex = to_uint<uint32_t>(toks[1], minQueueIndex, maxQueueIndex);
-                    queuesStateVector.at(configPortName).enableQueueCounters(startIndex, endIndex);
+                    endIndex = to_uint<uint32_t>(toks[1], minQueueIndex, maxQueueIndex);
                 }
-                else
+                for (uint32_t queueIndex = startIndex; queueIndex <= endIndex; queueIndex++)
                 {
-                    queuesStateVector.at(configPortName).enableQueueCounter(startIndex);
+                    if (!m_queueIndexFilter.empty() && !m_queueIndexFilter.count(queueIndex))
+                    {
+                        continue;
+                    }
+                    queuesStateVector.at(configPortName).enableQueueCounter(queueIndex);
                 }
 
                 Port port;
@@ -669,6 +713,44 @@ map<string, FlexCounterPgStates> FlexCounterOrch::getPgConfigurations()
     return pgsStateVector;
 }
 
+void FlexCounterOrch::parseQueueIndexFilter(const std::string &value)
+{
+    SWSS_LOG_ENTER();
+
+    m_queueIndexFilter.clear();
+
+    /* An empty list or "all" restores the default of instrumenting every queue */
+    if (value.empty() || value == "all")
+    {
+        return;
+    }
+
+    for (const auto &token : tokenize(value, ','))
+    {
+        auto range = tokenize(token, '-');
+        try
+        {
+            if (range.size() == 2)
+            {
+                auto startIndex = to_uint<uint32_t>(range[0]);
+                auto endIndex = to_uint<uint32_t>(range[1]);
+                for (uint32_t queueIndex = startIndex; queueIndex <= endIndex; queueIndex++)
+                {
+                    m_queueIndexFilter.insert(queueIndex);
+                }
+            }
+            else
+            {
+                m_queueIndexFilter.insert(to_uint<uint32_t>(token));
+            }
+        }
+        catch (const std::exception &e)
+        {
+            SWSS_LOG_ERROR("Invalid %s entry [%s], ignoring", QUEUE_INDEX_LIST_FIELD, token.c_str());
+        }
+    }
+}
+
 FlexCounterQueueStates::FlexCounterQueueStates(uint32_t maxQueueNumber)
 {
     SWSS_LOG_ENTER();
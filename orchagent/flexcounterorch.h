@@ -75,6 +75,7 @@ public:
 
 private:
     void handleDeviceMetadataTable(Consumer &consumer);
+    void parseQueueIndexFilter(const std::string &value);
     bool m_port_counter_enabled = false;
     bool m_port_phy_attr_enabled = false;
     bool m_port_phy_serdes_attr_enabled = false;
@@ -93,6 +94,9 @@ private:
     Table m_deviceMetadataConfigTable;
     SelectableTimer* m_delayTimer;
     std::unordered_set<std::string> m_groupsWithBulkChunkSize;
+    /* Queue indexes to instrument when a "queue_index_list" is configured
+     * on the queue counter groups; empty means all queues */
+    std::set<uint32_t> m_queueIndexFilter;
 
     bool m_createOnlyConfigDbBuffers = false;
 };
@@ -10,27 +10,41 @@ CounterNameMapUpdater::CounterNameMapUpdater(const std::string &db_name, const s
     : m_db_name(db_name),
       m_table_name(table_name),
       m_connector(m_db_name, 0),
-      m_counters_table(&m_connector, m_table_name)
+      m_counters_table(&m_connector, m_table_name),
+      m_snapshot(std::make_shared<const NameMap>())
 {
     SWSS_LOG_ENTER();
 }
 
+std::shared_ptr<CounterNameMapUpdater> CounterNameMapUpdater::getUpdater(const std::string &db_name, const std::string &table_name)
+{
+    SWSS_LOG_ENTER();
+
+    static std::mutex registry_mutex;
+    static std::unordered_map<std::string, std::shared_ptr<CounterNameMapUpdater>> registry;
+
+    std::lock_guard<std::mutex> guard(registry_mutex);
+
+    auto key = db_name + ":" + table_name;
+    auto it = registry.find(key);
+    if (it == registry.end())
+    {
+        it = registry.emplace(key, std::make_shared<CounterNameMapUpdater>(db_name, table_name)).first;
+    }
+
+    return it->second;
+}
+
 void CounterNameMapUpdater::setCounterNameMap(const std::string &counter_name, sai_object_id_t oid)
 {
     SWSS_LOG_ENTER();
 
-    if (gHFTOrch)
+    notifyCounterNameMap(counter_name, oid, OPERATION::SET);
+
     {
-        std::string unified_counter_name = unify_counter_name(counter_name);
-        Message msg{
-            .m_table_name = m_table_name.c_str(),
-            .m_operation = OPERATION::SET,
-            .m_set{
-                .m_counter_name = unified_counter_name.c_str(),
-                .m_oid = oid,
-            },
-        };
-        gHFTOrch->locallyNotify(msg);
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_nameMap[counter_name] = oid;
+        publishSnapshot();
     }
 
     m_counters_table.hset("", counter_name, sai_serialize_object_id(oid));
@@ -40,38 +54,86 @@ void CounterNameMapUpdater::setCounterNameMap(const std::vector<swss::FieldValue
 {
     SWSS_LOG_ENTER();
 
-    for (const auto& map : counter_name_maps)
+    if (counter_name_maps.empty())
+    {
+        return;
+    }
+
     {
-        const std::string& counter_name = fvField(map);
-        sai_object_id_t oid = SAI_NULL_OBJECT_ID;
-        if (!fvValue(map).empty())
+        std::lock_guard<std::mutex> guard(m_mutex);
+
+        for (const auto& map : counter_name_maps)
         {
-            sai_deserialize_object_id(fvValue(map), oid);
+            const std::string& counter_name = fvField(map);
+            sai_object_id_t oid = SAI_NULL_OBJECT_ID;
+            if (!fvValue(map).empty())
+            {
+                sai_deserialize_object_id(fvValue(map), oid);
+            }
+            notifyCounterNameMap(counter_name, oid, OPERATION::SET);
+            m_nameMap[counter_name] = oid;
         }
-        setCounterNameMap(counter_name, oid);
+
+        // One snapshot rebuild per batch, not per entry
+        publishSnapshot();
     }
+
+    // All entries land in one write so regenerating a map costs a single
+    // redis round trip rather than one per object
+    m_counters_table.set("", counter_name_maps);
 }
 
 void CounterNameMapUpdater::delCounterNameMap(const std::string &counter_name)
 {
     SWSS_LOG_ENTER();
 
-    if (gHFTOrch)
+    notifyCounterNameMap(counter_name, SAI_NULL_OBJECT_ID, OPERATION::DEL);
+
     {
-        std::string unified_counter_name = unify_counter_name(counter_name);
-        Message msg{
-            .m_table_name = m_table_name.c_str(),
-            .m_operation = OPERATION::DEL,
-            .m_del{
-                .m_counter_name = unified_counter_name.c_str(),
-            },
-        };
-        gHFTOrch->locallyNotify(msg);
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_nameMap.erase(counter_name);
+        publishSnapshot();
     }
 
     m_counters_table.hdel("", counter_name);
 }
 
+std::shared_ptr<const CounterNameMapUpdater::NameMap> CounterNameMapUpdater::getNameMapSnapshot() const
+{
+    return std::atomic_load(&m_snapshot);
+}
+
+void CounterNameMapUpdater::publishSnapshot()
+{
+    std::atomic_store(&m_snapshot, std::shared_ptr<const NameMap>(std::make_shared<const NameMap>(m_nameMap)));
+}
+
+void CounterNameMapUpdater::notifyCounterNameMap(const std::string &counter_name, sai_object_id_t oid, OPERATION operation)
+{
+    SWSS_LOG_ENTER();
+
+    if (!gHFTOrch)
+    {
+        return;
+    }
+
+    std::string unified_counter_name = unify_counter_name(counter_name);
+    Message msg{
+        .m_table_name = m_table_name.c_str(),
+        .m_operation = operation,
+    };
+    if (operation == OPERATION::SET)
+    {
+        msg.m_set.m_counter_name = unified_counter_name.c_str();
+        msg.m_set.m_oid = oid;
+    }
+    else
+    {
+        msg.m_del.m_counter_name = unified_counter_name.c_str();
+    }
+    gHFTOrch->locallyNotify(msg);
+}
+
 std::string CounterNameMapUpdater::unify_counter_name(const std::string &counter_name)
 {
     SWSS_LOG_ENTER();
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -40,18 +42,42 @@ public:
         };
     };
 
+    using NameMap = std::unordered_map<std::string, sai_object_id_t>;
+
     CounterNameMapUpdater(const std::string &db_name, const std::string &table_name);
     ~CounterNameMapUpdater() = default;
 
+    /*
+     * Shared per-table instance. Every orch writing the same name map goes
+     * through one updater, so its in-memory map is the authoritative copy
+     * and all writes share one redis connection.
+     */
+    static std::shared_ptr<CounterNameMapUpdater> getUpdater(const std::string &db_name, const std::string &table_name);
+
     void setCounterNameMap(const std::string &counter_name, sai_object_id_t oid);
     void setCounterNameMap(const std::vector<swss::FieldValueTuple> &counter_name_maps);
     void delCounterNameMap(const std::string &counter_name);
 
+    /*
+     * Immutable snapshot of the current name map, replaced wholesale on
+     * every update. Readers on the flex counter and high frequency
+     * telemetry paths keep the returned pointer and never contend with
+     * writers.
+     */
+    std::shared_ptr<const NameMap> getNameMapSnapshot() const;
+
 private:
     std::string m_db_name;
     std::string m_table_name;
     swss::DBConnector m_connector;
     swss::Table m_counters_table;
 
+    mutable std::mutex m_mutex;
+    NameMap m_nameMap;
+    std::shared_ptr<const NameMap> m_snapshot;
+
+    void notifyCounterNameMap(const std::string &counter_name, sai_object_id_t oid, OPERATION operation);
+    /* Rebuild and atomically publish m_snapshot; call with m_mutex held */
+    void publishSnapshot();
     std::string unify_counter_name(const std::string &counter_name);
 };
@@ -12,6 +12,7 @@
 #include "directory.h"
 #include "notifications.h"
 #include "icmporch.h"
+#include "pipelineperf.h"
 #include "switchorch.h"
 #include <string>
 
@@ -36,7 +37,8 @@ const std::map<std::string, sai_icmp_echo_session_state_t> IcmpOrch::m_session_s
 
 IcmpOrch::IcmpOrch(DBConnector *db, string tableName, TableConnector stateDbIcmpSessionTable):
     Orch(db, tableName),
-    m_stateIcmpSessionTable(stateDbIcmpSessionTable.first, stateDbIcmpSessionTable.second),
+    m_stateDbPipeline(new RedisPipeline(stateDbIcmpSessionTable.first)),
+    m_stateIcmpSessionTable(m_stateDbPipeline.get(), stateDbIcmpSessionTable.second, true),
     m_register_state_change_notif{false}
 {
     SWSS_LOG_ENTER();
@@ -62,6 +64,7 @@ IcmpOrch::IcmpOrch(DBConnector *db, string tableName, TableConnector stateDbIcmp
     {
         m_stateIcmpSessionTable.del(alias);
     }
+    m_stateDbPipeline->flush();
 
     auto icmpStateNotifier = new Notifier(m_icmpStateNotificationConsumer, this, "ICMP_STATE_NOTIFICATIONS");
     Orch::addExecutor(icmpStateNotifier);
@@ -124,19 +127,29 @@ void IcmpOrch::doTask(NotificationConsumer &consumer)
 {
     SWSS_LOG_ENTER();
 
-    std::string op;
-    std::string data;
-    std::vector<swss::FieldValueTuple> values;
-
-    consumer.pop(op, data, values);
-
     if (&consumer != m_icmpStateNotificationConsumer)
     {
         return;
     }
 
-    if (op == "icmp_echo_session_state_change")
+    // Mass session bring-up delivers state changes in a burst, so drain the
+    // whole backlog in one wake-up and keep only the final state per session
+    // before touching state db
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    consumer.pops(entries);
+
+    std::map<sai_object_id_t, sai_icmp_echo_session_state_t> coalesced_states;
+
+    for (auto &entry : entries)
     {
+        string op = kfvOp(entry);
+        string data = kfvKey(entry);
+
+        if (op != "icmp_echo_session_state_change")
+        {
+            continue;
+        }
+
         uint32_t count = 0;
         sai_icmp_echo_session_state_notification_t *icmpSessionState = nullptr;
 
@@ -149,35 +162,51 @@ void IcmpOrch::doTask(NotificationConsumer &consumer)
 
             SWSS_LOG_INFO("Got ICMP session state change notification id:%" PRIx64 " state: %s", id, m_session_state_lkup.at(state).c_str());
 
-            if (m_icmp_session_lookup.find(id) == m_icmp_session_lookup.end())
-            {
-                SWSS_LOG_NOTICE("ICMP session missing for state change notification id:%" PRIx64 " state: %s", id, m_session_state_lkup.at(state).c_str());
-                continue;
-            }
+            coalesced_states[id] = state;
+        }
 
-            // handle state update
-            if (state != m_icmp_session_lookup[id].state || m_icmp_session_lookup[id].init_state)
-            {
-                auto key = m_icmp_session_lookup[id].db_key;
-                vector<FieldValueTuple> fvVector;
-                m_stateIcmpSessionTable.get(key, fvVector);
+        sai_deserialize_free_icmp_echo_session_state_ntf(count, icmpSessionState);
+    }
 
-                fvVector.push_back({IcmpSaiSessionHandler::m_state_fname, m_session_state_lkup.at(state)});
+    for (auto &coalesced : coalesced_states)
+    {
+        sai_object_id_t id = coalesced.first;
+        sai_icmp_echo_session_state_t state = coalesced.second;
+
+        if (m_icmp_session_lookup.find(id) == m_icmp_session_lookup.end())
+        {
+            SWSS_LOG_NOTICE("ICMP session missing for state change notification id:%" PRIx64 " state: %s", id, m_session_state_lkup.at(state).c_str());
+            continue;
+        }
 
-                m_stateIcmpSessionTable.set(key, fvVector);
+        // handle state update
+        if (state != m_icmp_session_lookup[id].state || m_icmp_session_lookup[id].init_state)
+        {
+            auto key = m_icmp_session_lookup[id].db_key;
+            vector<FieldValueTuple> fvVector;
+            m_stateIcmpSessionTable.get(key, fvVector);
 
-                SWSS_LOG_NOTICE("ICMP session state for %s changed from %s to %s", key.c_str(),
-                            m_session_state_lkup.at(m_icmp_session_lookup[id].state).c_str(), m_session_state_lkup.at(state).c_str());
+            fvVector.push_back({IcmpSaiSessionHandler::m_state_fname, m_session_state_lkup.at(state)});
 
-                m_icmp_session_lookup[id].state = state;
-                m_icmp_session_lookup[id].init_state = false;
-            }
-        }
+            m_stateIcmpSessionTable.set(key, fvVector);
 
-        sai_deserialize_free_icmp_echo_session_state_ntf(count, icmpSessionState);
+            SWSS_LOG_NOTICE("ICMP session state for %s changed from %s to %s", key.c_str(),
+                        m_session_state_lkup.at(m_icmp_session_lookup[id].state).c_str(), m_session_state_lkup.at(state).c_str());
+
+            m_icmp_session_lookup[id].state = state;
+            m_icmp_session_lookup[id].init_state = false;
+        }
     }
 }
 
+void IcmpOrch::flushResponses()
+{
+    SWSS_LOG_ENTER();
+
+    PipelinePerf::Instance().flushPipeline("ICMP_STATE", m_stateDbPipeline.get());
+    Orch::flushResponses();
+}
+
 bool IcmpOrch::create_icmp_session(const string& key, const vector<FieldValueTuple>& data)
 {
     IcmpSaiSessionHandler sai_session_handler(*this);
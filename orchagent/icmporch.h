@@ -9,9 +9,11 @@
 
 #include "orch.h"
 #include "observer.h"
+#include "redispipeline.h"
 #include "saioffloadsession.h"
 #include <vector>
 #include <tuple>
+#include <memory>
 
 extern sai_icmp_echo_api_t* sai_icmp_echo_api;
 
@@ -98,6 +100,14 @@ public:
      */
     void doTask(swss::NotificationConsumer &consumer) override;
 
+    /**
+     *@method flushResponses
+     *
+     *@brief overriden method that flushes buffered state db
+     *       writes once per select loop iteration
+     */
+    void flushResponses() override;
+
     // friend handler have access to IcmpOrch
     friend struct IcmpSaiSessionHandler;
 
@@ -153,6 +163,9 @@ private:
     // map of session object id to update data for handling notification from asic db 
     std::map<sai_object_id_t, IcmpUpdate> m_icmp_session_lookup;
 
+    // pipeline buffering state db writes, flushed in flushResponses so a
+    // mass session bring-up costs one redis round trip per drain
+    std::unique_ptr<swss::RedisPipeline> m_stateDbPipeline;
     // Icmp session state table produced by IcmpOrch
     swss::Table m_stateIcmpSessionTable;
 
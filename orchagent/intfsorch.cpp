@@ -80,25 +80,6 @@ IntfsOrch::IntfsOrch(DBConnector *db, string tableName, VRFOrch *vrf_orch, DBCon
     auto executorT = new ExecutableTimer(m_updateMapsTimer, this, "UPDATE_MAPS_TIMER");
     Orch::addExecutor(executorT);
 
-    string rifRatePluginName = "rif_rates.lua";
-    string rifRateSha;
-
-    try
-    {
-        string rifRateLuaScript = swss::loadLuaScript(rifRatePluginName);
-        rifRateSha = swss::loadRedisScript(m_counter_db.get(), rifRateLuaScript);
-    }
-    catch (const runtime_error &e)
-    {
-        SWSS_LOG_WARN("RIF flex counter group plugins was not set successfully: %s", e.what());
-    }
-
-    setFlexCounterGroupParameter(RIF_STAT_COUNTER_FLEX_COUNTER_GROUP,
-                                 RIF_FLEX_STAT_COUNTER_POLL_MSECS,
-                                 STATS_MODE_READ,
-                                 RIF_PLUGIN_FIELD,
-                                 rifRateSha);
-
     if(isChassisDbInUse())
     {
         //Add subscriber to process VOQ system interface
@@ -1416,6 +1397,10 @@ void IntfsOrch::addIp2MeRoute(sai_object_id_t vrf_id, const IpPrefix &ip_prefix)
     }
 
     gFlowCounterRouteOrch->onAddMiscRouteEntry(vrf_id, IpPrefix(ip_prefix.getIp().to_string()));
+
+    auto auditKey = RouteOrch::routeAuditKey(vrf_id, IpPrefix(ip_prefix.getIp().to_string()));
+    m_ip2meDigest.add(auditKey);
+    m_ip2meKeys.insert(auditKey);
 }
 
 void IntfsOrch::removeIp2MeRoute(sai_object_id_t vrf_id, const IpPrefix &ip_prefix)
@@ -1447,6 +1432,21 @@ void IntfsOrch::removeIp2MeRoute(sai_object_id_t vrf_id, const IpPrefix &ip_pref
     }
 
     gFlowCounterRouteOrch->onRemoveMiscRouteEntry(vrf_id, IpPrefix(ip_prefix.getIp().to_string()));
+
+    auto auditKey = RouteOrch::routeAuditKey(vrf_id, IpPrefix(ip_prefix.getIp().to_string()));
+    m_ip2meDigest.remove(auditKey);
+    m_ip2meKeys.erase(auditKey);
+}
+
+AuditContributor IntfsOrch::routeAuditContributor()
+{
+    return AuditContributor{
+        "IntfsOrch",
+        [this]() { return m_ip2meDigest; },
+        [this](set<string> &keys)
+        {
+            keys.insert(m_ip2meKeys.begin(), m_ip2meKeys.end());
+        }};
 }
 
 void IntfsOrch::addDirectedBroadcast(const Port &port, const IpPrefix &ip_prefix)
@@ -1524,28 +1524,21 @@ void IntfsOrch::removeDirectedBroadcast(const Port &port, const IpPrefix &ip_pre
     SWSS_LOG_NOTICE("Remove broadcast route ip:%s", ip_addr.to_string().c_str());
 }
 
-void IntfsOrch::addRifToFlexCounter(const string &id, const string &name, const string &type)
+void IntfsOrch::addRifToFlexCounter(const string &id, const string &name)
 {
     SWSS_LOG_ENTER();
-    /* update RIF maps in COUNTERS_DB */
-    vector<FieldValueTuple> rifNameVector;
-    vector<FieldValueTuple> rifTypeVector;
-
-    rifNameVector.emplace_back(name, id);
-    rifTypeVector.emplace_back(id, type);
-
-    m_rifNameTable->set("", rifNameVector);
-    m_rifTypeTable->set("", rifTypeVector);
-
     /* update RIF in FLEX_COUNTER_DB */
     string key = getRifFlexCounterTableKey(id);
 
-    std::ostringstream counters_stream;
-    for (const auto& it: rifStatIds)
-    {
-        counters_stream << sai_serialize_router_interface_stat(it) << comma;
-    }
-    auto &&counters_str = counters_stream.str();
+    /* The counter id list is identical for every RIF; serialize it once */
+    static const string counters_str = []() {
+        std::ostringstream counters_stream;
+        for (const auto& it: rifStatIds)
+        {
+            counters_stream << sai_serialize_router_interface_stat(it) << comma;
+        }
+        return counters_stream.str();
+    }();
 
     /* check the state of intf, if registering the intf to FC will result in runtime error */
     startFlexCounterPolling(gSwitchId, key, counters_str.c_str(), RIF_COUNTER_ID_LIST);
@@ -1573,8 +1566,37 @@ string IntfsOrch::getRifFlexCounterTableKey(string key)
     return string(RIF_STAT_COUNTER_FLEX_COUNTER_GROUP) + ":" + key;
 }
 
+void IntfsOrch::initRifRatePlugin()
+{
+    if (m_rif_rate_plugin_loaded)
+    {
+        return;
+    }
+
+    string rifRatePluginName = "rif_rates.lua";
+    string rifRateSha;
+
+    try
+    {
+        string rifRateLuaScript = swss::loadLuaScript(rifRatePluginName);
+        rifRateSha = swss::loadRedisScript(m_counter_db.get(), rifRateLuaScript);
+    }
+    catch (const runtime_error &e)
+    {
+        SWSS_LOG_WARN("RIF flex counter group plugins was not set successfully: %s", e.what());
+    }
+
+    setFlexCounterGroupParameter(RIF_STAT_COUNTER_FLEX_COUNTER_GROUP,
+                                 RIF_FLEX_STAT_COUNTER_POLL_MSECS,
+                                 STATS_MODE_READ,
+                                 RIF_PLUGIN_FIELD,
+                                 rifRateSha);
+    m_rif_rate_plugin_loaded = true;
+}
+
 void IntfsOrch::generateInterfaceMap()
 {
+    initRifRatePlugin();
     m_updateMapsTimer->start();
 }
 
@@ -1601,6 +1623,12 @@ void IntfsOrch::doTask(SelectableTimer &timer)
 
     SWSS_LOG_DEBUG("Registering %" PRId64 " new intfs", m_rifsToAdd.size());
     string value;
+    /* Counter map updates for every interface that becomes ready in this
+     * pass are collected and written with one set per table */
+    vector<FieldValueTuple> rifNameVector;
+    vector<FieldValueTuple> rifTypeVector;
+    rifNameVector.reserve(m_rifsToAdd.size());
+    rifTypeVector.reserve(m_rifsToAdd.size());
     for (auto it = m_rifsToAdd.begin(); it != m_rifsToAdd.end(); )
     {
         const auto id = sai_serialize_object_id(it->m_rif_id);
@@ -1627,7 +1655,9 @@ void IntfsOrch::doTask(SelectableTimer &timer)
         if (!gTraditionalFlexCounter || m_vidToRidTable->hget("", id, value))
         {
             SWSS_LOG_INFO("Registering %s it is ready", it->m_alias.c_str());
-            addRifToFlexCounter(id, it->m_alias, type);
+            rifNameVector.emplace_back(it->m_alias, id);
+            rifTypeVector.emplace_back(id, type);
+            addRifToFlexCounter(id, it->m_alias);
             it = m_rifsToAdd.erase(it);
         }
         else
@@ -1635,6 +1665,12 @@ void IntfsOrch::doTask(SelectableTimer &timer)
             ++it;
         }
     }
+
+    if (!rifNameVector.empty())
+    {
+        m_rifNameTable->set("", rifNameVector);
+        m_rifTypeTable->set("", rifTypeVector);
+    }
 }
 
 bool IntfsOrch::isRemoteSystemPortIntf(string alias)
@@ -4,6 +4,7 @@
 #include "orch.h"
 #include "portsorch.h"
 #include "vrforch.h"
+#include "auditorch.h"
 #include "timer.h"
 
 #include "ipaddresses.h"
@@ -52,7 +53,7 @@ public:
     std::set<IpPrefix> getSubnetRoutes();
 
     void generateInterfaceMap();
-    void addRifToFlexCounter(const string&, const string&, const string&);
+    void addRifToFlexCounter(const string&, const string&);
     void removeRifFromFlexCounter(const string&, const string&);
 
     bool setIntfLoopbackAction(const Port &port, string actionStr);
@@ -63,6 +64,10 @@ public:
     void addIp2MeRoute(sai_object_id_t vrf_id, const IpPrefix &ip_prefix);
     void removeIp2MeRoute(sai_object_id_t vrf_id, const IpPrefix &ip_prefix);
 
+    /* IntfsOrch's share of the route_entry audit target: the ip2me routes
+     * it programs outside RouteOrch's view */
+    AuditContributor routeAuditContributor();
+
     const IntfsTable& getSyncdIntfses(void)
     {
         return m_syncdIntfses;
@@ -95,6 +100,13 @@ private:
 
     std::string getRifFlexCounterTableKey(std::string s);
 
+    bool m_rif_rate_plugin_loaded = false;
+    void initRifRatePlugin();
+
+    /* Audit digest plus key set over the programmed ip2me routes */
+    AuditDigest m_ip2meDigest;
+    std::set<std::string> m_ip2meKeys;
+
     bool addRouterIntfs(sai_object_id_t vrf_id, Port &port, string loopbackAction);
     bool removeRouterIntfs(Port &port);
 
@@ -469,50 +469,53 @@ IsolationGroup::setMembers(string ports)
     SWSS_LOG_ENTER();
     auto port_list = tokenize(ports, ',');
     set<string> portList(port_list.begin(), port_list.end());
-    vector<string> old_members = m_pending_members;
 
-    for (auto mem : m_members)
+    // Current membership is the programmed members plus the ones still
+    // waiting for their port to be created
+    set<string> cur_members(m_pending_members.begin(), m_pending_members.end());
+    for (auto &mem : m_members)
     {
-        old_members.emplace_back(mem.first);
+        cur_members.insert(mem.first);
     }
 
-    for (auto alias : portList)
+    // Additions: in the target list but neither programmed nor pending
+    for (auto &alias : portList)
     {
-        if ((0 == alias.find("Ethernet")) || (0 == alias.find("PortChannel")))
+        if ((0 != alias.find("Ethernet")) && (0 != alias.find("PortChannel")))
         {
-            auto iter = find(old_members.begin(), old_members.end(), alias);
-            if (iter != old_members.end())
-            {
-                SWSS_LOG_NOTICE("Port %s already part of %s. No change", alias.c_str(), m_name.c_str());
-                old_members.erase(iter);
-            }
-            else
-            {
-                Port port;
-                if (!gPortsOrch->getPort(alias, port))
-                {
-                    SWSS_LOG_NOTICE("Port %s not found. Added it to m_pending_members", alias.c_str());
-                    m_pending_members.emplace_back(alias);
-                    continue;
-                }
-                addMember(port);
-            }
+            SWSS_LOG_ERROR("Port %s not supported", alias.c_str());
+            continue;
         }
-        else
+
+        if (cur_members.find(alias) != cur_members.end())
         {
-            SWSS_LOG_ERROR("Port %s not supported", alias.c_str());
+            SWSS_LOG_DEBUG("Port %s already part of %s. No change", alias.c_str(), m_name.c_str());
             continue;
         }
+
+        Port port;
+        if (!gPortsOrch->getPort(alias, port))
+        {
+            SWSS_LOG_NOTICE("Port %s not found. Added it to m_pending_members", alias.c_str());
+            m_pending_members.emplace_back(alias);
+            continue;
+        }
+        addMember(port);
     }
 
-    // Remove all the ports which are no longer needed
-    for (auto alias : old_members)
+    // Removals: programmed or pending but absent from the target list
+    for (auto &alias : cur_members)
     {
+        if (portList.find(alias) != portList.end())
+        {
+            continue;
+        }
+
         Port port;
         if (!gPortsOrch->getPort(alias, port))
         {
             SWSS_LOG_ERROR("Port %s not found", alias.c_str());
-            m_pending_members.erase(find(m_pending_members.begin(), m_pending_members.end(), port.m_alias));
+            m_pending_members.erase(find(m_pending_members.begin(), m_pending_members.end(), alias));
         }
         else
         {
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "label.h"
+
+/**
+ * LabelRouteStore is a direct-indexed store for MPLS label routes. Labels
+ * are dense 20-bit integers (LABEL_VALUE_MAX), so instead of a red-black
+ * tree keyed by swss::Label every access is a two-level array index: a fixed
+ * page directory and lazily allocated pages of entry pointers. Lookup,
+ * insert and erase are O(1), which is what matters for SR label churn
+ * where the same small label range is hit tens of thousands of times a
+ * second.
+ *
+ * The exposed surface is the std::map subset RouteOrch relies on: find(),
+ * at(), operator[], emplace(), erase() by key, size(), empty() and forward
+ * iteration in ascending label order. Entries are individually heap
+ * allocated, so iterators and references stay valid under insertion and
+ * are only invalidated for erased entries.
+ */
+template <typename T>
+class LabelRouteStore
+{
+private:
+    static const size_t CAPACITY = LABEL_VALUE_MAX + 1;
+    static const size_t PAGE_BITS = 12;
+    static const size_t PAGE_SIZE = 1 << PAGE_BITS;
+    static const size_t NUM_PAGES = CAPACITY / PAGE_SIZE;
+
+public:
+    typedef std::pair<const swss::Label, T> value_type;
+
+private:
+    struct Page
+    {
+        value_type *slots[PAGE_SIZE] = {};
+    };
+
+    std::unique_ptr<Page> m_pages[NUM_PAGES];
+    size_t m_size = 0;
+
+    value_type **slot(swss::Label label)
+    {
+        if (label >= CAPACITY)
+        {
+            return nullptr;
+        }
+        auto &page = m_pages[label >> PAGE_BITS];
+        if (page == nullptr)
+        {
+            return nullptr;
+        }
+        return &page->slots[label & (PAGE_SIZE - 1)];
+    }
+
+    value_type **slotForInsert(swss::Label label)
+    {
+        if (label >= CAPACITY)
+        {
+            throw std::out_of_range("LabelRouteStore: label " + std::to_string(label) + " out of range");
+        }
+        auto &page = m_pages[label >> PAGE_BITS];
+        if (page == nullptr)
+        {
+            page.reset(new Page());
+        }
+        return &page->slots[label & (PAGE_SIZE - 1)];
+    }
+
+    /* First occupied label at or after pos, CAPACITY if none */
+    size_t scanFrom(size_t pos) const
+    {
+        while (pos < CAPACITY)
+        {
+            const auto &page = m_pages[pos >> PAGE_BITS];
+            if (page == nullptr)
+            {
+                /* Skip the whole unallocated page */
+                pos = (pos & ~(PAGE_SIZE - 1)) + PAGE_SIZE;
+                continue;
+            }
+            if (page->slots[pos & (PAGE_SIZE - 1)] != nullptr)
+            {
+                return pos;
+            }
+            pos++;
+        }
+        return CAPACITY;
+    }
+
+public:
+    class iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef LabelRouteStore::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef value_type *pointer;
+        typedef value_type &reference;
+
+        iterator() : m_store(nullptr), m_pos(CAPACITY) {}
+        iterator(const LabelRouteStore *store, size_t pos) : m_store(store), m_pos(pos) {}
+
+        reference operator*() const
+        {
+            return *m_store->m_pages[m_pos >> PAGE_BITS]->slots[m_pos & (PAGE_SIZE - 1)];
+        }
+        pointer operator->() const { return &**this; }
+
+        iterator &operator++()
+        {
+            m_pos = m_store->scanFrom(m_pos + 1);
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const iterator &other) const { return m_pos == other.m_pos; }
+        bool operator!=(const iterator &other) const { return m_pos != other.m_pos; }
+
+    private:
+        friend class LabelRouteStore;
+        const LabelRouteStore *m_store;
+        size_t m_pos;
+    };
+
+    LabelRouteStore() = default;
+
+    LabelRouteStore(const LabelRouteStore &other)
+    {
+        for (const auto &entry : other)
+        {
+            emplace(entry.first, entry.second);
+        }
+    }
+
+    LabelRouteStore &operator=(const LabelRouteStore &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (const auto &entry : other)
+            {
+                emplace(entry.first, entry.second);
+            }
+        }
+        return *this;
+    }
+
+    LabelRouteStore(LabelRouteStore &&other) noexcept
+        : m_size(other.m_size)
+    {
+        for (size_t i = 0; i < NUM_PAGES; i++)
+        {
+            m_pages[i] = std::move(other.m_pages[i]);
+        }
+        other.m_size = 0;
+    }
+
+    LabelRouteStore &operator=(LabelRouteStore &&other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            for (size_t i = 0; i < NUM_PAGES; i++)
+            {
+                m_pages[i] = std::move(other.m_pages[i]);
+            }
+            m_size = other.m_size;
+            other.m_size = 0;
+        }
+        return *this;
+    }
+
+    ~LabelRouteStore()
+    {
+        clear();
+    }
+
+    iterator begin() const
+    {
+        return iterator(this, scanFrom(0));
+    }
+
+    iterator end() const
+    {
+        return iterator(this, CAPACITY);
+    }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    iterator find(swss::Label label) const
+    {
+        auto *self = const_cast<LabelRouteStore *>(this);
+        value_type **s = self->slot(label);
+        if (s == nullptr || *s == nullptr)
+        {
+            return end();
+        }
+        return iterator(this, label);
+    }
+
+    size_t count(swss::Label label) const
+    {
+        return find(label) != end() ? 1 : 0;
+    }
+
+    T &at(swss::Label label)
+    {
+        value_type **s = slot(label);
+        if (s == nullptr || *s == nullptr)
+        {
+            throw std::out_of_range("LabelRouteStore::at: no entry for label " + std::to_string(label));
+        }
+        return (*s)->second;
+    }
+
+    const T &at(swss::Label label) const
+    {
+        return const_cast<LabelRouteStore *>(this)->at(label);
+    }
+
+    T &operator[](swss::Label label)
+    {
+        return emplace(label, T()).first->second;
+    }
+
+    std::pair<iterator, bool> emplace(swss::Label label, T val)
+    {
+        value_type **s = slotForInsert(label);
+        if (*s != nullptr)
+        {
+            return std::make_pair(iterator(this, label), false);
+        }
+        *s = new value_type(label, std::move(val));
+        m_size++;
+        return std::make_pair(iterator(this, label), true);
+    }
+
+    size_t erase(swss::Label label)
+    {
+        value_type **s = slot(label);
+        if (s == nullptr || *s == nullptr)
+        {
+            return 0;
+        }
+        delete *s;
+        *s = nullptr;
+        m_size--;
+        return 1;
+    }
+
+    iterator erase(iterator pos)
+    {
+        iterator next = pos;
+        ++next;
+        erase(static_cast<swss::Label>(pos.m_pos));
+        return next;
+    }
+
+    void clear()
+    {
+        for (size_t i = 0; i < NUM_PAGES; i++)
+        {
+            if (m_pages[i] == nullptr)
+            {
+                continue;
+            }
+            for (size_t j = 0; j < PAGE_SIZE; j++)
+            {
+                delete m_pages[i]->slots[j];
+            }
+            m_pages[i].reset();
+        }
+        m_size = 0;
+    }
+};
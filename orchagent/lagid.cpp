@@ -1,5 +1,8 @@
 #include "lagid.h"
 
+extern string gMyHostName;
+extern string gMyAsicName;
+
 LagIdAllocator::LagIdAllocator(
         _In_ DBConnector* chassis_app_db)
 {
@@ -13,6 +16,19 @@ LagIdAllocator::LagIdAllocator(
 
     string luaScript = loadLuaScript("lagids.lua");
     m_shaLagId = loadRedisScript(m_dbConnector, luaScript);
+
+    m_leasedSetKey = "SYSTEM_LAG_IDS_LEASED_SET|" + gMyHostName + "|" + gMyAsicName;
+
+    // Return any block a previous incarnation leased but never bound; the
+    // local cache is rebuilt lazily on the first allocation
+
+    vector<string> keys;
+
+    vector<string> args;
+    args.push_back("reclaim");
+    args.push_back(m_leasedSetKey);
+
+    runRedisScript(*m_dbConnector, m_shaLagId, keys, args);
 }
 
 int32_t LagIdAllocator::lagIdAdd(
@@ -21,13 +37,54 @@ int32_t LagIdAllocator::lagIdAdd(
 {
     SWSS_LOG_ENTER();
 
+    if (lag_id != 0)
+    {
+        // A caller proposing a specific id goes through the legacy path,
+        // which can pull that exact id out of the global free list
+
+        // No keys
+        vector<string> keys;
+
+        vector<string> args;
+        args.push_back("add");
+        args.push_back(pcname);
+        args.push_back(to_string(lag_id));
+
+        set<string> ret = runRedisScript(*m_dbConnector, m_shaLagId, keys, args);
+
+        if (!ret.empty())
+        {
+            // We expect only one value in the set returned
+
+            auto rv_lag_id = ret.begin();
+
+            return (stoi(*rv_lag_id));
+        }
+
+        return LAG_ID_ALLOCATOR_ERROR_DB_ERROR;
+    }
+
+    if (m_freeIds.empty())
+    {
+        lagIdLease();
+
+        if (m_freeIds.empty())
+        {
+            return LAG_ID_ALLOCATOR_ERROR_TABLE_FULL;
+        }
+    }
+
+    int32_t leased_id = m_freeIds.front();
+    m_freeIds.pop_front();
+
     // No keys
     vector<string> keys;
 
     vector<string> args;
-    args.push_back("add");
+    args.push_back("bind");
     args.push_back(pcname);
-    args.push_back(to_string(lag_id));
+    args.push_back(to_string(leased_id));
+    args.push_back(m_leasedSetKey);
 
     set<string> ret = runRedisScript(*m_dbConnector, m_shaLagId, keys, args);
 
@@ -35,11 +92,20 @@ int32_t LagIdAllocator::lagIdAdd(
     {
         // We expect only one value in the set returned
 
-        auto rv_lag_id = ret.begin();
+        int32_t bound_id = stoi(*ret.begin());
 
-        return (stoi(*rv_lag_id));
+        if (bound_id != leased_id)
+        {
+            // The name was already bound; keep the leased id cached
+
+            m_freeIds.push_front(leased_id);
+        }
+
+        return bound_id;
     }
 
+    m_freeIds.push_front(leased_id);
+
     return LAG_ID_ALLOCATOR_ERROR_DB_ERROR;
 }
 
@@ -52,8 +118,9 @@ int32_t LagIdAllocator::lagIdDel(
     vector<string> keys;
 
     vector<string> args;
-    args.push_back("del");
+    args.push_back("unbind");
     args.push_back(pcname);
+    args.push_back(m_leasedSetKey);
 
     set<string> ret = runRedisScript(*m_dbConnector, m_shaLagId, keys, args);
 
@@ -61,9 +128,17 @@ int32_t LagIdAllocator::lagIdDel(
     {
         // We expect only one value in the set returned
 
-        auto rv_lag_id = ret.begin();
+        int32_t lag_id = stoi(*ret.begin());
 
-        return (stoi(*rv_lag_id));
+        if (lag_id > 0)
+        {
+            // The freed id stays leased to this allocator for O(1) reuse
+
+            m_freeIds.push_back(lag_id);
+            lagIdReturnSurplus();
+        }
+
+        return lag_id;
     }
 
     return LAG_ID_ALLOCATOR_ERROR_DB_ERROR;
@@ -94,3 +169,48 @@ int32_t LagIdAllocator::lagIdGet(
 
     return LAG_ID_ALLOCATOR_ERROR_DB_ERROR;
 }
+
+void LagIdAllocator::lagIdLease()
+{
+    SWSS_LOG_ENTER();
+
+    // No keys
+    vector<string> keys;
+
+    vector<string> args;
+    args.push_back("lease");
+    args.push_back(to_string(LAG_ID_LEASE_BLOCK_SIZE));
+    args.push_back(m_leasedSetKey);
+
+    set<string> ret = runRedisScript(*m_dbConnector, m_shaLagId, keys, args);
+
+    for (const auto &leased_id : ret)
+    {
+        m_freeIds.push_back(stoi(leased_id));
+    }
+}
+
+void LagIdAllocator::lagIdReturnSurplus()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_freeIds.size() <= LAG_ID_LEASE_HIGH_WATERMARK)
+    {
+        return;
+    }
+
+    // No keys
+    vector<string> keys;
+
+    vector<string> args;
+    args.push_back("return");
+    args.push_back(m_leasedSetKey);
+
+    while (m_freeIds.size() > LAG_ID_LEASE_BLOCK_SIZE)
+    {
+        args.push_back(to_string(m_freeIds.back()));
+        m_freeIds.pop_back();
+    }
+
+    runRedisScript(*m_dbConnector, m_shaLagId, keys, args);
+}
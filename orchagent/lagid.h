@@ -6,6 +6,8 @@
 #include "schema.h"
 #include "redisapi.h"
 
+#include <deque>
+
 using namespace swss;
 using namespace std;
 
@@ -15,6 +17,11 @@ using namespace std;
 #define LAG_ID_ALLOCATOR_ERROR_INVALID_OP             -3
 #define LAG_ID_ALLOCATOR_ERROR_DB_ERROR               -4
 
+/* Ids leased from the global pool per request, and the cache level above
+ * which surplus ids are handed back */
+#define LAG_ID_LEASE_BLOCK_SIZE        8
+#define LAG_ID_LEASE_HIGH_WATERMARK   16
+
 class LagIdAllocator
 {
 public:
@@ -36,9 +43,21 @@ public:
 
 private:
 
+    void lagIdLease();
+
+    void lagIdReturnSurplus();
+
     DBConnector* m_dbConnector;
 
     string m_shaLagId;
+
+    // Key of the per-instance redis set tracking ids leased to this
+    // allocator but not yet bound to a lag name
+    string m_leasedSetKey;
+
+    // Locally leased ids; allocation and release are O(1) and need no
+    // redis round trip while the cache holds ids
+    deque<int32_t> m_freeIds;
 };
 
 #endif // SWSS_LAGID_H
@@ -1,13 +1,24 @@
 -- KEYS - None
--- ARGV[1] - operation (add/del/get)
--- ARGV[2] - lag name
--- ARGV[3] - current lag id (for "add" operation only)
-
--- return lagid if success for "add"/"del"
--- return 0 if lag does not exist for "del"
+-- ARGV[1] - operation (add/del/get/lease/bind/unbind/return/reclaim)
+-- ARGV[2] - lag name (add/del/get/bind/unbind), block size (lease),
+--           leased set key (return/reclaim)
+-- ARGV[3] - current lag id (add), lag id (bind), leased set key
+--           (lease/unbind), lag ids (return, ARGV[3..N])
+-- ARGV[4] - leased set key (bind)
+
+-- return lagid if success for "add"/"del"/"bind"/"unbind"
+-- return 0 if lag does not exist for "del"/"unbind"
 -- return -1 if lag table full for "add"
 -- return -2 if lag does not exist for "get"
 -- return -3 if invalid operation
+-- return array of leased lag ids for "lease" (empty if pool exhausted)
+-- return count of ids moved for "return"/"reclaim"
+
+-- The lease/bind/unbind/return/reclaim operations back the local free-list
+-- cache in LagIdAllocator: a line card leases a small block of ids under a
+-- per-instance leased set, binds and unbinds names against them locally and
+-- hands surplus blocks back. Ids sitting in a leased set are reclaimed to
+-- the free list when that allocator restarts.
 
 local op = ARGV[1]
 local pcname = ARGV[2]
@@ -112,4 +123,108 @@ if op == "get" then
 
 end
 
+if op == "lease" then
+
+    local want = tonumber(pcname)
+    local leased_key = ARGV[3]
+    local avail = redis.call("llen", "SYSTEM_LAG_IDS_FREE_LIST")
+
+    -- Never hoard more than a quarter of the remaining pool in one cache,
+    -- so an idle line card cannot starve the others
+    local cap = math.floor(avail / 4)
+    if cap < 1 then
+        cap = 1
+    end
+    if want > cap then
+        want = cap
+    end
+
+    local leased = {}
+    while #leased < want do
+        if redis.call("llen", "SYSTEM_LAG_IDS_FREE_LIST") <= 0 then
+            break
+        end
+        local lagid = redis.call("lpop", "SYSTEM_LAG_IDS_FREE_LIST")
+        if redis.call("sismember", "SYSTEM_LAG_ID_SET", tostring(lagid)) == 0 then
+            redis.call("sadd", "SYSTEM_LAG_ID_SET", lagid)
+            redis.call("sadd", leased_key, lagid)
+            table.insert(leased, tostring(lagid))
+        end
+    end
+
+    return leased
+
+end
+
+if op == "bind" then
+
+    local plagid = tostring(tonumber(ARGV[3]))
+    local leased_key = ARGV[4]
+
+    local dblagid = redis.call("hget", "SYSTEM_LAG_ID_TABLE", pcname)
+    if dblagid then
+        -- existing binding wins; the caller keeps its leased id cached
+        return tonumber(dblagid)
+    end
+
+    redis.call("hset", "SYSTEM_LAG_ID_TABLE", pcname, plagid)
+    redis.call("sadd", "SYSTEM_LAG_ID_SET", plagid)
+    redis.call("srem", leased_key, plagid)
+    return tonumber(plagid)
+
+end
+
+if op == "unbind" then
+
+    local leased_key = ARGV[3]
+
+    if redis.call("hexists", "SYSTEM_LAG_ID_TABLE", pcname) == 1 then
+        local lagid = redis.call("hget", "SYSTEM_LAG_ID_TABLE", pcname)
+        redis.call("hdel", "SYSTEM_LAG_ID_TABLE", pcname)
+        -- the id stays marked in use and goes back to the caller's cache
+        redis.call("sadd", leased_key, lagid)
+        return tonumber(lagid)
+    end
+
+    return 0
+
+end
+
+if op == "return" then
+
+    local leased_key = pcname
+    local count = 0
+
+    for i = 3, #ARGV do
+        local lagid = tostring(tonumber(ARGV[i]))
+        redis.call("srem", "SYSTEM_LAG_ID_SET", lagid)
+        redis.call("srem", leased_key, lagid)
+        if redis.call("lpos", "SYSTEM_LAG_IDS_FREE_LIST", lagid) == false then
+            redis.call("rpush", "SYSTEM_LAG_IDS_FREE_LIST", lagid)
+        end
+        count = count + 1
+    end
+
+    return count
+
+end
+
+if op == "reclaim" then
+
+    local leased_key = pcname
+    local count = 0
+
+    for _, lagid in pairs(redis.call("smembers", leased_key)) do
+        redis.call("srem", "SYSTEM_LAG_ID_SET", lagid)
+        if redis.call("lpos", "SYSTEM_LAG_IDS_FREE_LIST", lagid) == false then
+            redis.call("rpush", "SYSTEM_LAG_IDS_FREE_LIST", lagid)
+        end
+        count = count + 1
+    end
+    redis.call("del", leased_key)
+
+    return count
+
+end
+
 return -3
@@ -1133,7 +1133,16 @@ task_process_status MACsecOrch::taskUpdateEgressSA(
             return task_success;
         }
     }
-    return task_need_retry;
+
+    /*
+     * The SA belongs to an AN the SC is not encoding with yet, meaning a
+     * rekey is being prepared.  Stage the SA attributes so the switchover
+     * only has to create the pre-staged SA once the encoding AN flips,
+     * instead of retrying this task until then.
+     */
+    ctx.get_macsec_sc()->m_pending_rekey_sas[an] = sa_attr;
+    SWSS_LOG_NOTICE("Staged MACsec SA %s for the next encoding AN switchover.", port_sci_an.c_str());
+    return task_success;
 }
 
 task_process_status MACsecOrch::taskDeleteEgressSA(
@@ -1904,11 +1913,52 @@ task_process_status MACsecOrch::updateMACsecSC(
         {
             return task_failed;
         }
+
+        if (!applyPendingRekeySA(port_sci, *ctx.get_macsec_sc(), direction))
+        {
+            return task_failed;
+        }
     }
 
     return task_success;
 }
 
+/*
+ * Create the SA that was staged for the new encoding AN, if any.  Called
+ * right after the encoding AN of an egress SC switches, so the rotation
+ * completes within the same drain instead of waiting for the staged SA
+ * task to be retried.
+ */
+bool MACsecOrch::applyPendingRekeySA(
+    const std::string &port_sci,
+    MACsecSC &sc,
+    sai_macsec_direction_t direction)
+{
+    SWSS_LOG_ENTER();
+
+    if (direction != SAI_MACSEC_DIRECTION_EGRESS)
+    {
+        return true;
+    }
+
+    auto pending_sa = sc.m_pending_rekey_sas.find(sc.m_encoding_an);
+    if (pending_sa == sc.m_pending_rekey_sas.end())
+    {
+        return true;
+    }
+
+    const std::string port_sci_an = swss::join(':', port_sci, pending_sa->first);
+
+    if (createMACsecSA(port_sci_an, pending_sa->second, direction) != task_success)
+    {
+        SWSS_LOG_WARN("Cannot create the staged MACsec SA %s.", port_sci_an.c_str());
+        return false;
+    }
+
+    sc.m_pending_rekey_sas.erase(pending_sa);
+    return true;
+}
+
 bool MACsecOrch::setEncodingAN(
     MACsecSC &sc,
     const TaskArgs &sc_attr,
@@ -2401,6 +2451,11 @@ task_process_status MACsecOrch::deleteMACsecSA(
 
     if (ctx.get_macsec_sa() == nullptr)
     {
+        /* Drop the staged SA if the rekey was abandoned before the switchover. */
+        if (ctx.get_macsec_sc() != nullptr)
+        {
+            ctx.get_macsec_sc()->m_pending_rekey_sas.erase(an);
+        }
         SWSS_LOG_INFO("MACsec SA %s has been deleted.", port_sci_an.c_str());
         return task_success;
     }
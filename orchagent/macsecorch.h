@@ -97,6 +97,12 @@ private:
         macsec_an_t                             m_encoding_an;
         sai_object_id_t                         m_sc_id;
         std::map<macsec_an_t, sai_object_id_t>  m_sa_ids;
+        /*
+         * Egress SAs staged for a future AN during rekey.  They are applied
+         * as soon as the encoding AN switches to them instead of waiting for
+         * the SA task to be retried.
+         */
+        std::map<macsec_an_t, TaskArgs>         m_pending_rekey_sas;
         sai_object_id_t                         m_flow_id;
         sai_object_id_t                         m_entry_id;
         sai_uint32_t                            m_acl_priority;
@@ -176,6 +182,10 @@ private:
         MACsecSC &sc,
         const TaskArgs &sc_attr,
         sai_macsec_direction_t direction);
+    bool applyPendingRekeySA(
+        const std::string &port_sci,
+        MACsecSC &sc,
+        sai_macsec_direction_t direction);
     bool createMACsecSC(
         MACsecPort &macsec_port,
         const std::string &port_name,
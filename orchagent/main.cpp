@@ -58,8 +58,12 @@ extern size_t gMaxBulkSize;
 
 #define DEFAULT_BATCH_SIZE  128
 extern int gBatchSize;
+extern size_t gMaxToSyncSize;
+extern size_t gMinToSyncSize;
+extern bool gRetryBackoffEnabled;
 
 bool gRingMode = false;
+bool gParallelMode = false;
 bool gSyncMode = false;
 sai_redis_communication_mode_t gRedisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
 string gAsicInstance;
@@ -70,6 +74,7 @@ extern bool gIsNatSupported;
 #define SWSS_RECORD_ENABLE (0x1 << 1)
 #define RESPONSE_PUBLISHER_RECORD_ENABLE (0x1 << 2)
 #define RETRY_RECORD_ENABLE (0x1 << 3)
+#define SWSS_RECORD_BINARY (0x1 << 4)
 
 /* orchagent heart beat message interval */
 #define HEART_BEAT_INTERVAL_MSECS_DEFAULT 10 * 1000
@@ -92,7 +97,7 @@ bool isChassisDbInUse()
 
 void usage()
 {
-    cout << "usage: orchagent [-h] [-r record_type] [-A] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode] [-t create_switch_timeout] [-v VRF] [-I heart_beat_interval] [-R] [-M]" << endl;
+    cout << "usage: orchagent [-h] [-r record_type] [-A] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-B max_pending[:resume_below]] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode] [-t create_switch_timeout] [-v VRF] [-I heart_beat_interval] [-R] [-P] [-E] [-M] [-J drain_journal_file]" << endl;
     cout << "    -h: display this message" << endl;
     cout << "    -r record_type: record orchagent logs with type (default 3)" << endl;
     cout << "                    Bit 0: sairedis.rec, Bit 1: swss.rec, Bit 2: responsepublisher.rec. For example:" << endl;
@@ -101,8 +106,10 @@ void usage()
     cout << "                    2: record SwSS task sequence as swss.rec" << endl;
     cout << "                    3: enable both above two records" << endl;
     cout << "                    7: enable sairedis.rec, swss.rec and responsepublisher.rec" << endl;
+    cout << "                    Bit 4: write swss.rec in the indexed binary format (see swssrecdump)" << endl;
     cout << "    -d record_location: set record logs folder location (default .)" << endl;
     cout << "    -b batch_size: set consumer table pop operation batch size (default 128)" << endl;
+    cout << "    -B max_pending[:resume_below]: bound pending tasks per consumer, backlog stays in redis; popping resumes below resume_below (default max_pending/2)" << endl;
     cout << "    -m MAC: set switch MAC address" << endl;
     cout << "    -i INST_ID: set the ASIC instance_id in multi-asic platform" << endl;
     cout << "    -A: enable async swss.rec recording path" << endl;
@@ -117,8 +124,11 @@ void usage()
     cout << "    -v vrf: VRF name (default empty)" << endl;
     cout << "    -I heart_beat_interval: Heart beat interval in millisecond (default 10)" << endl;
     cout << "    -R enable the ring thread feature" << endl;
+    cout << "    -P enable the parallel orch execution engine" << endl;
+    cout << "    -E enable exponential backoff for consumer retry sweeps" << endl;
     cout << "    -M enable SAI MACSec POST" << endl;
     cout << "    -D Delay in seconds before flex counter processing begins after orchagent startup (default 0)" << endl;
+    cout << "    -J drain_journal_file: journal drain-cycle intents to this mmap'd ring file for crash-scoped recovery (default disabled)" << endl;
 }
 
 void sighup_handler(int signo)
@@ -471,13 +481,35 @@ int main(int argc, char **argv)
     // Disable SAI MACSec POST by default. Use option -M to enable it.
     bool macsec_post_enabled = false;
 
-    while ((opt = getopt(argc, argv, "b:m:r:Af:j:d:i:hsz:k:q:c:t:v:I:RD:M")) != -1)
+    // Drain journal disabled unless a file is given with -J.
+    string drain_journal_file;
+
+    while ((opt = getopt(argc, argv, "b:B:m:r:Af:j:d:i:hsz:k:q:c:t:v:I:RPD:MEJ:")) != -1)
     {
         switch (opt)
         {
         case 'b':
             gBatchSize = atoi(optarg);
             break;
+        case 'B':
+            {
+                /* -B <high>[:<low>]: pause popping at <high> pending tasks,
+                 * resume below <low> (default high/2) */
+                auto limit = atoi(optarg);
+                if (limit > 0)
+                {
+                    gMaxToSyncSize = limit;
+                    const char *sep = strchr(optarg, ':');
+                    if (sep != NULL && atoi(sep + 1) > 0)
+                    {
+                        gMinToSyncSize = min((size_t)atoi(sep + 1), gMaxToSyncSize);
+                    }
+                    SWSS_LOG_NOTICE("Bounding pending tasks per consumer to %zu, resuming below %zu",
+                                    gMaxToSyncSize,
+                                    gMinToSyncSize != 0 ? gMinToSyncSize : (gMaxToSyncSize + 1) / 2);
+                }
+            }
+            break;
         case 'i':
             {
                 // Limit asic instance string max length
@@ -498,7 +530,7 @@ int main(int argc, char **argv)
             // Disable all recordings if atoi() fails i.e. returns 0 due to
             // invalid command line argument.
             record_type = atoi(optarg);
-            if (record_type < 0 || record_type > 15) 
+            if (record_type < 0 || record_type > 31)
             {
                 usage();
                 exit(EXIT_FAILURE);
@@ -506,6 +538,7 @@ int main(int argc, char **argv)
             break;
         case 'A':
             Recorder::Instance().swss.setAsync(true);
+            Recorder::Instance().swss.setRingMode(true);
             SWSS_LOG_NOTICE("Async swss recorder enabled");
             break;
         case 'd':
@@ -593,10 +626,20 @@ int main(int argc, char **argv)
         case 'R':
             gRingMode = true;
             break;
+        case 'P':
+            gParallelMode = true;
+            break;
+        case 'E':
+            gRetryBackoffEnabled = true;
+            SWSS_LOG_NOTICE("Enabling exponential backoff for retry sweeps");
+            break;
          case 'M':
             macsec_post_enabled = true;
             break;
         case 'D': { gFlexCounterDelaySec = swss::to_int<int>(optarg); } break;
+        case 'J':
+            drain_journal_file = optarg;
+            break;
         default: /* '?' */
             exit(EXIT_FAILURE);
         }
@@ -622,6 +665,9 @@ int main(int argc, char **argv)
     );
     Recorder::Instance().swss.setLocation(record_location);
     Recorder::Instance().swss.setFileName(swss_rec_filename);
+    Recorder::Instance().swss.setBinary(
+        (record_type & SWSS_RECORD_BINARY) == SWSS_RECORD_BINARY
+    );
     Recorder::Instance().swss.startRec(true);
 
     Recorder::Instance().respub.setRecord(
@@ -1016,12 +1062,22 @@ int main(int argc, char **argv)
         orchDaemon->enableRingBuffer();
     }
 
+    if (!drain_journal_file.empty()) {
+        /* Replay and reset the journal before any consumer starts draining */
+        orchDaemon->enableDrainJournal(drain_journal_file);
+    }
+
     if (!orchDaemon->init())
     {
         SWSS_LOG_ERROR("Failed to initialize orchestration daemon");
         exit(EXIT_FAILURE);
     }
 
+    if (gParallelMode) {
+        /* The dependency graph needs the Orch list, so enable after init() */
+        orchDaemon->enableParallelExec();
+    }
+
     /*
     * In syncd view comparison solution, apply view has been sent
     * immediately after restore is done
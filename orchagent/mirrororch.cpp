@@ -504,6 +504,7 @@ task_process_status MirrorOrch::createEntry(const string& key, const vector<Fiel
     }
 
     m_syncdMirrors.emplace(key, entry);
+    indexSession(key, entry);
     setSessionState(key, entry);
 
     if (entry.type == MIRROR_SESSION_SPAN && !entry.dst_port.empty())
@@ -564,6 +565,7 @@ task_process_status MirrorOrch::deleteEntry(const string& name)
 
     removeSessionState(name);
 
+    unindexSession(name, session);
     m_syncdMirrors.erase(sessionIter);
 
     SWSS_LOG_NOTICE("Removed mirror session %s", name.c_str());
@@ -571,6 +573,57 @@ task_process_status MirrorOrch::deleteEntry(const string& name)
     return task_process_status::task_success;
 }
 
+void MirrorOrch::indexSession(const string& name, const MirrorEntry& session)
+{
+    SWSS_LOG_ENTER();
+
+    m_sessionsByDstIp[session.dstIp].insert(name);
+    m_sessionsByNexthopIp[session.nexthopInfo.nexthop.ip_address].insert(name);
+}
+
+void MirrorOrch::unindexSession(const string& name, const MirrorEntry& session)
+{
+    SWSS_LOG_ENTER();
+
+    auto dst_it = m_sessionsByDstIp.find(session.dstIp);
+    if (dst_it != m_sessionsByDstIp.end())
+    {
+        dst_it->second.erase(name);
+        if (dst_it->second.empty())
+        {
+            m_sessionsByDstIp.erase(dst_it);
+        }
+    }
+
+    auto nh_it = m_sessionsByNexthopIp.find(session.nexthopInfo.nexthop.ip_address);
+    if (nh_it != m_sessionsByNexthopIp.end())
+    {
+        nh_it->second.erase(name);
+        if (nh_it->second.empty())
+        {
+            m_sessionsByNexthopIp.erase(nh_it);
+        }
+    }
+}
+
+void MirrorOrch::setSessionNextHop(const string& name, MirrorEntry& session, const NextHopKey& nexthop)
+{
+    SWSS_LOG_ENTER();
+
+    auto nh_it = m_sessionsByNexthopIp.find(session.nexthopInfo.nexthop.ip_address);
+    if (nh_it != m_sessionsByNexthopIp.end())
+    {
+        nh_it->second.erase(name);
+        if (nh_it->second.empty())
+        {
+            m_sessionsByNexthopIp.erase(nh_it);
+        }
+    }
+
+    session.nexthopInfo.nexthop = nexthop;
+    m_sessionsByNexthopIp[nexthop.ip_address].insert(name);
+}
+
 void MirrorOrch::setSessionState(const string& name, const MirrorEntry& session, const string& attr)
 {
     SWSS_LOG_ENTER();
@@ -1294,16 +1347,24 @@ void MirrorOrch::updateNextHop(const NextHopUpdate& update)
 {
     SWSS_LOG_ENTER();
 
-    for (auto it = m_syncdMirrors.begin(); it != m_syncdMirrors.end(); it++)
+    // Only sessions whose destination IP is the update's destination IP
+    // are affected by the route change
+    auto dst_it = m_sessionsByDstIp.find(update.destination);
+    if (dst_it == m_sessionsByDstIp.end())
     {
-        const auto& name = it->first;
-        auto& session = it->second;
+        return;
+    }
 
-        // Check if mirror session's destination IP is the update's destination IP
-        if (session.dstIp != update.destination)
+    // Iterate over a copy since re-resolving a session may re-index it
+    auto session_names = dst_it->second;
+    for (const auto& name : session_names)
+    {
+        auto it = m_syncdMirrors.find(name);
+        if (it == m_syncdMirrors.end())
         {
             continue;
         }
+        auto& session = it->second;
 
         session.nexthopInfo.prefix = update.prefix;
 
@@ -1336,7 +1397,7 @@ void MirrorOrch::updateNextHop(const NextHopUpdate& update)
                 {
                     SWSS_LOG_NOTICE("Recover mirror session %s with next hop %s",
                             name.c_str(), nexthop.to_string().c_str());
-                    session.nexthopInfo.nexthop = nexthop;
+                    setSessionNextHop(name, session, nexthop);
                 }
                 else
                 {
@@ -1344,19 +1405,20 @@ void MirrorOrch::updateNextHop(const NextHopUpdate& update)
                     SWSS_LOG_NOTICE("Correct mirror session %s next hop from %s to %s",
                             name.c_str(), session.nexthopInfo.nexthop.to_string().c_str(),
                     nexthop.to_string().c_str());
-                    session.nexthopInfo.nexthop = *update.nexthopGroup.getNextHops().begin();
+                    setSessionNextHop(name, session, *update.nexthopGroup.getNextHops().begin());
                 }
             }
             else
             {
                 // Pick the first one from the next hop group
-                session.nexthopInfo.nexthop = *update.nexthopGroup.getNextHops().begin();
+                setSessionNextHop(name, session, *update.nexthopGroup.getNextHops().begin());
             }
         }
         else
         {
             string alias = "";
-            session.nexthopInfo.nexthop = session.dstIp.isV4() ? NextHopKey("0.0.0.0", alias) : NextHopKey("::", alias);
+            setSessionNextHop(name, session,
+                    session.dstIp.isV4() ? NextHopKey("0.0.0.0", alias) : NextHopKey("::", alias));
         }
 
         // Update State DB Nexthop
@@ -1377,15 +1439,24 @@ void MirrorOrch::updateNeighbor(const NeighborUpdate& update)
 {
     SWSS_LOG_ENTER();
 
-    for (auto it = m_syncdMirrors.begin(); it != m_syncdMirrors.end(); it++)
+    // Collect the sessions whose destination IP or next hop IP matches the
+    // neighbor's update IP
+    set<string> session_names;
+    auto dst_it = m_sessionsByDstIp.find(update.entry.ip_address);
+    if (dst_it != m_sessionsByDstIp.end())
     {
-        const auto& name = it->first;
-        auto& session = it->second;
+        session_names.insert(dst_it->second.begin(), dst_it->second.end());
+    }
+    auto nh_it = m_sessionsByNexthopIp.find(update.entry.ip_address);
+    if (nh_it != m_sessionsByNexthopIp.end())
+    {
+        session_names.insert(nh_it->second.begin(), nh_it->second.end());
+    }
 
-        // Check if the session's destination IP matches the neighbor's update IP
-        // or if the session's next hop IP matches the neighbor's update IP
-        if (session.dstIp != update.entry.ip_address &&
-                session.nexthopInfo.nexthop.ip_address != update.entry.ip_address)
+    for (const auto& name : session_names)
+    {
+        auto it = m_syncdMirrors.find(name);
+        if (it == m_syncdMirrors.end())
         {
             continue;
         }
@@ -1393,7 +1464,7 @@ void MirrorOrch::updateNeighbor(const NeighborUpdate& update)
         SWSS_LOG_NOTICE("Updating mirror session %s with neighbor %s",
                 name.c_str(), update.entry.alias.c_str());
 
-        updateSession(name, session);
+        updateSession(name, it->second);
     }
 }
 
@@ -105,6 +105,19 @@ private:
     // session_name -> VLAN | monitor_port_alias | next_hop_ip
     map<string, string> m_recoverySessionMap;
 
+    /*
+     * Reverse indexes from session destination IP and resolved next hop IP
+     * to session names, so a route/neighbor update only re-resolves the
+     * sessions that depend on the updated address instead of scanning
+     * every session.
+     */
+    map<IpAddress, set<string>> m_sessionsByDstIp;
+    map<IpAddress, set<string>> m_sessionsByNexthopIp;
+
+    void indexSession(const string& name, const MirrorEntry& session);
+    void unindexSession(const string& name, const MirrorEntry& session);
+    void setSessionNextHop(const string& name, MirrorEntry& session, const NextHopKey& nexthop);
+
     bool isHwResourcesAvailable();
 
     task_process_status createEntry(const string&, const vector<FieldValueTuple>&);
@@ -55,39 +55,51 @@ void RouteOrch::doLabelTask(ConsumerBase& consumer)
             /* Get notification from application */
             /* resync application:
              * When routeorch receives 'resync' message, it marks all current
-             * routes as dirty and waits for 'resync complete' message. For all
-             * newly received routes, if they match current dirty routes, it unmarks
-             * them dirty. After receiving 'resync complete' message, it creates all
-             * newly added routes and removes all dirty routes.
+             * routes as dirty and waits for 'resync complete' message. Every
+             * label route announced in between settles its key; after the
+             * 'resync complete' message only the keys nobody re-announced are
+             * deleted, the rest go through the regular update path.
              */
             if (key == "resync")
             {
                 if (op == "SET")
                 {
-                    /* Mark all current routes as dirty (DEL) in consumer.m_toSync map */
-                    SWSS_LOG_NOTICE("Start resync label routes\n");
-                    for (auto j : m_syncdLabelRoutes)
+                    if (m_resync)
                     {
-                        string vrf;
-
-                        if (j.first != gVirtualRouterId)
+                        SWSS_LOG_NOTICE("Absorbing label route resync request into generation %" PRIu64, m_resyncGeneration);
+                    }
+                    else
+                    {
+                        m_resyncGeneration++;
+                        SWSS_LOG_NOTICE("Start resync label routes, generation %" PRIu64, m_resyncGeneration);
+                        for (auto j : m_syncdLabelRoutes)
                         {
-                            vrf = m_vrfOrch->getVRFname(j.first) + ":";
-                        }
+                            string vrf;
 
-                        for (auto i : j.second)
-                        {
-                            vector<FieldValueTuple> v;
-                            key = vrf + to_string(i.first);
-                            auto x = KeyOpFieldsValuesTuple(key, DEL_COMMAND, v);
-                            consumer.addToSync(x);
+                            if (j.first != gVirtualRouterId)
+                            {
+                                vrf = m_vrfOrch->getVRFname(j.first) + ":";
+                            }
+
+                            for (auto i : j.second)
+                            {
+                                m_resyncDirtyLabelRoutes.emplace(vrf + to_string(i.first));
+                            }
                         }
+                        m_resync = true;
                     }
-                    m_resync = true;
                 }
                 else
                 {
-                    SWSS_LOG_NOTICE("Complete resync label routes\n");
+                    SWSS_LOG_NOTICE("Complete resync label routes, generation %" PRIu64 ", %zu stale label routes",
+                                    m_resyncGeneration, m_resyncDirtyLabelRoutes.size());
+                    for (const auto &stale : m_resyncDirtyLabelRoutes)
+                    {
+                        vector<FieldValueTuple> v;
+                        auto x = KeyOpFieldsValuesTuple(stale, DEL_COMMAND, v);
+                        consumer.addToSync(x);
+                    }
+                    m_resyncDirtyLabelRoutes.clear();
                     m_resync = false;
                 }
 
@@ -97,6 +109,7 @@ void RouteOrch::doLabelTask(ConsumerBase& consumer)
 
             if (m_resync)
             {
+                m_resyncDirtyLabelRoutes.erase(key);
                 it++;
                 continue;
             }
@@ -15,6 +15,7 @@
 #include "orch.h"
 #include "request_parser.h"
 #include "muxorch.h"
+#include "pipelineperf.h"
 #include "directory.h"
 #include "swssnet.h"
 #include "crmorch.h"
@@ -553,6 +554,9 @@ void MuxCable::setState(string new_state)
         throw std::runtime_error("Failed to handle state transition");
     }
 
+    /* Push the batched tunnel route updates out with the transition */
+    mux_cb_orch_->flushTunnelRoutes();
+
     mux_cb_orch_->updateMuxMetricState(mux_name_, new_state, false);
 
     st_chg_in_progress_ = false;
@@ -608,6 +612,7 @@ void MuxCable::rollbackStateChange()
         SWSS_LOG_ERROR("[%s] Rollback to %s failed",
                         mux_name_.c_str(), muxStateValToString.at(prev_state_).c_str());
     }
+    mux_cb_orch_->flushTunnelRoutes();
     mux_cb_orch_->updateMuxMetricState(mux_name_, muxStateValToString.at(state_), false);
     mux_cb_orch_->updateMuxState(mux_name_, muxStateValToString.at(state_));
 }
@@ -2499,12 +2504,26 @@ void MuxOrch::updateCachedNeighbors()
 
 MuxCableOrch::MuxCableOrch(DBConnector *db, DBConnector *sdb, const std::string& tableName):
               Orch2(db, tableName, request_),
-              app_tunnel_route_table_(db, APP_TUNNEL_ROUTE_TABLE_NAME),
+              tunnel_route_pipeline_(new RedisPipeline(db)),
+              app_tunnel_route_table_(tunnel_route_pipeline_.get(), APP_TUNNEL_ROUTE_TABLE_NAME, true),
               mux_metric_table_(sdb, STATE_MUX_METRICS_TABLE_NAME)
 {
     mux_table_ = unique_ptr<Table>(new Table(db, APP_HW_MUX_CABLE_TABLE_NAME));
 }
 
+void MuxCableOrch::flushTunnelRoutes()
+{
+    /* Tunnel routes steer traffic during a mux switchover; never defer */
+    PipelinePerf::Instance().flushPipeline("MUX_TUNNEL_ROUTE", tunnel_route_pipeline_.get(),
+                                           false /* allowDefer */);
+}
+
+void MuxCableOrch::flushResponses()
+{
+    flushTunnelRoutes();
+    Orch::flushResponses();
+}
+
 void MuxCableOrch::updateMuxState(string portName, string muxState)
 {
     vector<FieldValueTuple> tuples;
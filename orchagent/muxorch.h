@@ -385,6 +385,9 @@ public:
     void updateMuxMetricState(string portName, string muxState, bool start);
     void addTunnelRoute(const NextHopKey &nhKey);
     void removeTunnelRoute(const NextHopKey &nhKey);
+    void flushTunnelRoutes();
+
+    void flushResponses() override;
 
 private:
     virtual bool addOperation(const Request& request);
@@ -393,6 +396,10 @@ private:
     unique_ptr<Table> mux_table_;
     MuxCableRequest request_;
     swss::Table mux_metric_table_;
+    /* Tunnel route writes ride a dedicated buffered pipeline: a failover
+     * with thousands of neighbors behind the mux port leaves as a single
+     * redis round trip at the end of the state transition */
+    std::unique_ptr<swss::RedisPipeline> tunnel_route_pipeline_;
     ProducerStateTable app_tunnel_route_table_;
 };
 
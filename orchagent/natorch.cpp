@@ -72,6 +72,9 @@ NatOrch::NatOrch(DBConnector *appDb, DBConnector *stateDb, vector<table_name_wit
     /* Set NAT default udp timeout as 300 seconds */
     udp_timeout = 300;
 
+    /* No hit-bit snapshot is taken yet */
+    m_prevHitBitPollTime = 0;
+
     /* Set entries count to 0 */
     totalEntries = totalSnatEntries = totalDnatEntries = 0;
     totalStaticNatEntries = totalDynamicNatEntries = 0;
@@ -3315,60 +3318,16 @@ void NatOrch::queryHitBits(void)
 
     /* Remove the NAT entries that are aged out.
      * Query the NAT entries for their activity in the hardware
-     * and update the active timeout. */
-    NatEntry::iterator natIter = m_natEntries.begin();
-    while (natIter != m_natEntries.end())
-    {
-        if (checkIfNatEntryIsActive(natIter, time_now.tv_sec))
-        {
-            /* Since the entry is active in the hardware, reset the active time */
-            natIter->second.activeTime = time_now.tv_sec;
-        }
-        else
-        {
-            if ((natIter->second.nat_type == "snat") and (natIter->second.addedToHw == true) and
-                (natIter->second.entry_type != "static"))
-            {
-                if (time_now.tv_sec - natIter->second.activeTime >= timeout)
-                {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = natIter->first.to_string();
-                    setTimeoutNotifier->send("AGEOUT-SINGLE-NAT", key, fvVector);
-                }
-            } 
-        }
-        queried_entries++;
-        natIter++;
-    }
+     * with bulk gets and update the active timeout. */
+    queryNatHitBits(time_now.tv_sec, queried_entries);
 
     /* Remove the NAPT entries that are aged out.
      * Query the NAPT entries for their activity in the hardware
-     * and update the active timeout. */
-    NaptEntry::iterator naptIter = m_naptEntries.begin();
-    while (naptIter != m_naptEntries.end())
-    {
-        if (checkIfNaptEntryIsActive(naptIter, time_now.tv_sec))
-        {
-            /* Since the entry is active in the hardware, reset the active time */
-            naptIter->second.activeTime = time_now.tv_sec;
-        }
-        else
-        {
-            if ((naptIter->second.nat_type == "snat") and (naptIter->second.addedToHw == true) and
-                (naptIter->second.entry_type != "static"))
-            {
-                int timeout = naptIter->first.prototype == string("TCP") ? tcp_timeout : udp_timeout;
-                if (time_now.tv_sec - naptIter->second.activeTime >= timeout)
-                {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = (naptIter->first.prototype + ":" + naptIter->first.ip_address.to_string() + ":" + to_string(naptIter->first.l4_port));
-                    setTimeoutNotifier->send("AGEOUT-SINGLE-NAPT", key, fvVector);
-                }
-            }
-        }
-        queried_entries++;
-        naptIter++;
-    }
+     * with bulk gets and update the active timeout. */
+    queryNaptHitBits(time_now.tv_sec, queried_entries);
+
+    /* Both polls diff against the snapshots taken at this timestamp */
+    m_prevHitBitPollTime = time_now.tv_sec;
 
     /* Remove the Twice NAT entries that are aged out.
      * Query the Twice NAT entries for their activity in the hardware
@@ -4134,207 +4093,384 @@ void NatOrch::updateTwiceNaptCounters(const TwiceNaptEntryKey &key,
     m_countersTwiceNaptTable.set(naptKey, values);
 }
 
-bool NatOrch::checkIfNatEntryIsActive(const NatEntry::iterator &iter, time_t now)
+/* Helpers for the packed hit-bit snapshots */
+static inline void hitBitmapSet(HitBitmap &bitmap, size_t index)
 {
-    const IpAddress   &ipAddr = iter->first;
-    NatEntryValue     &entry  = iter->second;
-    uint32_t          attr_count;
-    IpAddress         srcIp;
-    sai_attribute_t   nat_entry_attr[4] = {};
-    sai_nat_entry_t   snat_entry = {};
-    sai_nat_entry_t   dnat_entry;
-    sai_status_t      status;
+    bitmap[index >> 6] |= (1ULL << (index & 63));
+}
 
-    if (entry.nat_type == "dnat")
+static inline bool hitBitmapTest(const HitBitmap &bitmap, size_t index)
+{
+    return (((bitmap[index >> 6] >> (index & 63)) & 1) != 0);
+}
+
+/* Fetch and clear the hardware hit-bits for a batch of NAT entries,
+ * NAT_HITBIT_BULK_QUERY_SIZE entries per bulk SAI get call. */
+void NatOrch::queryHitBitsBulk(const std::vector<sai_nat_entry_t> &nat_entries, HitBitmap &hit_bits)
+{
+    size_t offset = 0;
+
+    hit_bits.assign((nat_entries.size() + 63) / 64, 0);
+    while (offset < nat_entries.size())
     {
-        /* Hitbits are queried for both directions when SNAT entry is checked */
-        return 0;
+        uint32_t count = (uint32_t)(nat_entries.size() - offset);
+        if (count > NAT_HITBIT_BULK_QUERY_SIZE)
+        {
+            count = NAT_HITBIT_BULK_QUERY_SIZE;
+        }
+
+        std::vector<sai_attribute_t>   nat_entry_attrs(count * 2);
+        std::vector<sai_attribute_t *> attr_lists(count);
+        std::vector<uint32_t>          attr_counts(count, 2);
+        std::vector<sai_status_t>      statuses(count, SAI_STATUS_SUCCESS);
+        sai_status_t                   status;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            nat_entry_attrs[i * 2].id                 = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
+            nat_entry_attrs[i * 2].value.booldata     = 0;
+            nat_entry_attrs[i * 2 + 1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
+            nat_entry_attrs[i * 2 + 1].value.booldata = 1;
+            attr_lists[i] = &nat_entry_attrs[i * 2];
+        }
+
+        status = sai_nat_api->get_nat_entries_attribute(count, nat_entries.data() + offset, attr_counts.data(),
+                                                        attr_lists.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                                                        statuses.data());
+        if (status == SAI_STATUS_SUCCESS)
+        {
+            for (uint32_t i = 0; i < count; i++)
+            {
+                if ((statuses[i] == SAI_STATUS_SUCCESS) and nat_entry_attrs[i * 2].value.booldata)
+                {
+                    hitBitmapSet(hit_bits, offset + i);
+                }
+            }
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Failed to bulk get the hit-bits for %u NAT entries, rv:%d", count, status);
+        }
+        offset += count;
     }
+}
 
-    if (entry.addedToHw == false)
+/* Query the hardware activity of the dynamic SNAT entries for one poll cycle.
+ * The hit-bits are fetched with bulk SAI gets instead of one get per entry;
+ * entries showing no activity in the SNAT direction are checked in the
+ * reverse direction before being aged out. */
+void NatOrch::queryNatHitBits(time_t now, uint32_t &queried_entries)
+{
+    std::vector<NatEntry::iterator> natIters;
+    std::vector<IpAddress>          polledKeys;
+    std::vector<sai_nat_entry_t>    snatEntries;
+    HitBitmap                       hitBits;
+
+    NatEntry::iterator natIter = m_natEntries.begin();
+    while (natIter != m_natEntries.end())
     {
-        SWSS_LOG_DEBUG("Skip get hitbits for %s NAT entry [ip %s], as not yet added to HW", entry.nat_type.c_str(), ipAddr.to_string().c_str());
-        return 0;
+        NatEntryValue &entry = natIter->second;
+
+        /* Hitbits are queried for both directions when the SNAT entry is checked */
+        if ((entry.nat_type == "snat") and (entry.addedToHw == true))
+        {
+            if (entry.entry_type == "static")
+            {
+                /* Static NAT entries are always treated active */
+                entry.activeTime = now;
+            }
+            else
+            {
+                sai_nat_entry_t snat_entry = {};
+
+                snat_entry.vr_id            = gVirtualRouterId;
+                snat_entry.switch_id        = gSwitchId;
+                snat_entry.nat_type         = SAI_NAT_TYPE_SOURCE_NAT;
+                snat_entry.data.key.src_ip  = natIter->first.getV4Addr();
+                snat_entry.data.mask.src_ip = 0xffffffff;
+
+                natIters.push_back(natIter);
+                polledKeys.push_back(natIter->first);
+                snatEntries.push_back(snat_entry);
+            }
+        }
+        queried_entries++;
+        natIter++;
     }
 
-    if (entry.entry_type == "static")
+    queryHitBitsBulk(snatEntries, hitBits);
+
+    /* If the SNAT HitBit is not set, check for the HitBit in the reverse direction */
+    std::vector<size_t>          missIdx;
+    std::vector<sai_nat_entry_t> dnatEntries;
+    HitBitmap                    reverseHitBits;
+
+    for (size_t i = 0; i < natIters.size(); i++)
     {
-        /* Static NAT entries are always treated active */ 
-        return 1;
-    }
+        if (hitBitmapTest(hitBits, i))
+        {
+            continue;
+        }
+        NatEntryValue &entry = natIters[i]->second;
+        auto dnatIter = m_natEntries.find(entry.translated_ip);
+        if ((dnatIter == m_natEntries.end()) or (dnatIter->second.addedToHw == false))
+        {
+            continue;
+        }
 
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
+        sai_nat_entry_t dnat_entry = {};
 
-    attr_count = 2;
+        dnat_entry.vr_id            = gVirtualRouterId;
+        dnat_entry.switch_id        = gSwitchId;
+        dnat_entry.nat_type         = SAI_NAT_TYPE_DESTINATION_NAT;
+        dnat_entry.data.key.dst_ip  = entry.translated_ip.getV4Addr();
+        dnat_entry.data.mask.dst_ip = 0xffffffff;
 
-    snat_entry.vr_id                 = gVirtualRouterId;
-    snat_entry.switch_id             = gSwitchId;
-    snat_entry.nat_type              = SAI_NAT_TYPE_SOURCE_NAT;
-    srcIp     = ipAddr;
-    snat_entry.data.key.src_ip   = srcIp.getV4Addr();
-    snat_entry.data.mask.src_ip  = 0xffffffff;
+        missIdx.push_back(i);
+        dnatEntries.push_back(dnat_entry);
+    }
 
-    status = sai_nat_api->get_nat_entry_attribute(&snat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
+    queryHitBitsBulk(dnatEntries, reverseHitBits);
+    for (size_t i = 0; i < missIdx.size(); i++)
     {
-        SWSS_LOG_DEBUG("SNAT HIT BIT for src-ip %s = %d", srcIp.to_string().c_str(),
-                      nat_entry_attr[0].value.booldata);
-
-        if (nat_entry_attr[0].value.booldata)
+        if (hitBitmapTest(reverseHitBits, i))
         {
-            entry.ageOutTime = now + timeout;
-            return 1;
+            hitBitmapSet(hitBits, missIdx[i]);
         }
-        else
+    }
+
+    /* Word-wise diff against the previous cycle's snapshot. Entries active
+     * in this cycle and the previous one need no ageing work; their
+     * timestamps are back-filled from the previous poll time when the
+     * hit-bit clears. */
+    bool aligned = (polledKeys == m_natPolledKeys);
+    if (!aligned)
+    {
+        /* Entry churn invalidated the snapshot's bit positions. Refresh the
+         * timestamps of every entry seen active in the previous cycle before
+         * evaluating the current one. */
+        for (size_t i = 0; i < m_natPolledKeys.size(); i++)
         {
-            auto dnatIter = m_natEntries.find(entry.translated_ip);
-            if (dnatIter == m_natEntries.end())
+            if (!hitBitmapTest(m_natHitBitsSnapshot, i))
             {
-                return 0;
+                continue;
             }
-            if ((dnatIter->second).addedToHw == false)
+            auto it = m_natEntries.find(m_natPolledKeys[i]);
+            if (it != m_natEntries.end())
             {
-                return 0;
+                it->second.activeTime = m_prevHitBitPollTime;
+                it->second.ageOutTime = m_prevHitBitPollTime + timeout;
             }
+        }
+    }
 
-            /* If SNAT HitBit is not set, check for the HitBit in the reverse direction */
-            memset(&dnat_entry, 0, sizeof(dnat_entry));
+    for (size_t w = 0; w < hitBits.size(); w++)
+    {
+        uint64_t pending = aligned ? ~(hitBits[w] & m_natHitBitsSnapshot[w]) : ~0ULL;
 
-            dnat_entry.vr_id             = gVirtualRouterId;
-            dnat_entry.switch_id         = gSwitchId;
-            dnat_entry.nat_type          = SAI_NAT_TYPE_DESTINATION_NAT;
-            dnat_entry.data.key.dst_ip   = entry.translated_ip.getV4Addr();
-            dnat_entry.data.mask.dst_ip  = 0xffffffff;
+        while (pending)
+        {
+            size_t i = (w << 6) + (size_t)__builtin_ctzll(pending);
+            pending &= (pending - 1);
+            if (i >= natIters.size())
+            {
+                break;
+            }
 
-            status = sai_nat_api->get_nat_entry_attribute(&dnat_entry, attr_count, nat_entry_attr);
-            if (status == SAI_STATUS_SUCCESS)
+            NatEntryValue &entry = natIters[i]->second;
+            if (hitBitmapTest(hitBits, i))
             {
-                SWSS_LOG_DEBUG("DNAT HIT BIT for dst-ip %s = %d", entry.translated_ip.to_string().c_str(),
-                                nat_entry_attr[0].value.booldata);
-                if (nat_entry_attr[0].value.booldata)
-                {
-                    entry.ageOutTime = now + timeout;
-                    return 1;
-                }
+                /* Since the entry is active in the hardware, reset the active time */
+                entry.ageOutTime = now + timeout;
+                entry.activeTime = now;
+            }
+            else if (aligned and hitBitmapTest(m_natHitBitsSnapshot, i))
+            {
+                /* The hit-bit cleared this cycle; the entry was last seen
+                 * active at the previous poll. */
+                entry.activeTime = m_prevHitBitPollTime;
+                entry.ageOutTime = m_prevHitBitPollTime + timeout;
+            }
+            else if (now - entry.activeTime >= timeout)
+            {
+                std::vector<FieldValueTuple> fvVector;
+                std::string key = natIters[i]->first.to_string();
+                setTimeoutNotifier->send("AGEOUT-SINGLE-NAT", key, fvVector);
             }
         }
     }
-    return 0;
+
+    m_natHitBitsSnapshot = std::move(hitBits);
+    m_natPolledKeys      = std::move(polledKeys);
 }
 
-bool NatOrch::checkIfNaptEntryIsActive(const NaptEntry::iterator &iter, time_t now)
+/* Query the hardware activity of the dynamic SNAPT entries for one poll cycle.
+ * Same bulk two-pass scheme as queryNatHitBits, with the protocol specific
+ * timeouts applied per entry. */
+void NatOrch::queryNaptHitBits(time_t now, uint32_t &queried_entries)
 {
-    const NaptEntryKey &naptKey    = iter->first;
-    NaptEntryValue     &entry      = iter->second;
-    int                protoType   = ((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    IpAddress          srcIp;
-    uint16_t           srcPort;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    snat_entry = {};
-    sai_nat_entry_t    dnat_entry;
-    sai_status_t       status;
+    std::vector<NaptEntry::iterator> naptIters;
+    std::vector<NaptEntryKey>        polledKeys;
+    std::vector<sai_nat_entry_t>     snatEntries;
+    HitBitmap                        hitBits;
 
-    if (entry.nat_type == "dnat")
+    NaptEntry::iterator naptIter = m_naptEntries.begin();
+    while (naptIter != m_naptEntries.end())
     {
-        /* Hitbits are queried for both directions when SNAT entry is checked */
-        return 0;
-    }
+        const NaptEntryKey &naptKey = naptIter->first;
+        NaptEntryValue     &entry   = naptIter->second;
 
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get hitbits for %s NAPT entry for [proto %s, ip %s, port %d], as not yet added to HW",
-                       entry.nat_type.c_str(), naptKey.prototype.c_str(), naptKey.ip_address.to_string().c_str(), naptKey.l4_port);
-        return 0;
+        /* Hitbits are queried for both directions when the SNAPT entry is checked */
+        if ((entry.nat_type == "snat") and (entry.addedToHw == true))
+        {
+            if (entry.entry_type == "static")
+            {
+                /* Static NAPT entries are always treated active */
+                entry.activeTime = now;
+            }
+            else
+            {
+                int protoType = ((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+                sai_nat_entry_t snat_entry = {};
+
+                snat_entry.vr_id                 = gVirtualRouterId;
+                snat_entry.switch_id             = gSwitchId;
+                snat_entry.nat_type              = SAI_NAT_TYPE_SOURCE_NAT;
+                snat_entry.data.key.src_ip       = naptKey.ip_address.getV4Addr();
+                snat_entry.data.key.l4_src_port  = (uint16_t)(naptKey.l4_port);
+                snat_entry.data.mask.src_ip      = 0xffffffff;
+                snat_entry.data.mask.l4_src_port = 0xffff;
+                snat_entry.data.key.proto        = (uint8_t)protoType;
+                snat_entry.data.mask.proto       = 0xff;
+
+                naptIters.push_back(naptIter);
+                polledKeys.push_back(naptKey);
+                snatEntries.push_back(snat_entry);
+            }
+        }
+        queried_entries++;
+        naptIter++;
     }
 
-    if (entry.entry_type == "static")
+    queryHitBitsBulk(snatEntries, hitBits);
+
+    /* If the SNAPT HitBit is not set, check for the HitBit in the reverse direction */
+    std::vector<size_t>          missIdx;
+    std::vector<sai_nat_entry_t> dnatEntries;
+    HitBitmap                    reverseHitBits;
+
+    for (size_t i = 0; i < naptIters.size(); i++)
     {
-        /* Static NAPT entries are always treated active */
-        return 1;
-    }
+        if (hitBitmapTest(hitBits, i))
+        {
+            continue;
+        }
 
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
+        const NaptEntryKey &naptKey = naptIters[i]->first;
+        NaptEntryValue     &entry   = naptIters[i]->second;
+        NaptEntryKey        dnaptKey;
 
-    attr_count = 2;
+        dnaptKey.ip_address = entry.translated_ip;
+        dnaptKey.l4_port    = entry.translated_l4_port;
+        dnaptKey.prototype  = naptKey.prototype;
+
+        auto dnaptIter = m_naptEntries.find(dnaptKey);
+        if ((dnaptIter == m_naptEntries.end()) or (dnaptIter->second.addedToHw == false))
+        {
+            continue;
+        }
 
-    snat_entry.vr_id                 = gVirtualRouterId;
-    snat_entry.switch_id             = gSwitchId;
-    snat_entry.nat_type              = SAI_NAT_TYPE_SOURCE_NAT;
+        int protoType = ((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+        sai_nat_entry_t dnat_entry = {};
 
-    srcIp     = naptKey.ip_address;
-    srcPort   = (uint16_t)(naptKey.l4_port);
-    snat_entry.data.key.src_ip       = srcIp.getV4Addr();
-    snat_entry.data.key.l4_src_port  = srcPort;
+        dnat_entry.vr_id                 = gVirtualRouterId;
+        dnat_entry.switch_id             = gSwitchId;
+        dnat_entry.nat_type              = SAI_NAT_TYPE_DESTINATION_NAT;
+        dnat_entry.data.key.dst_ip       = entry.translated_ip.getV4Addr();
+        dnat_entry.data.key.l4_dst_port  = (uint16_t)(entry.translated_l4_port);
+        dnat_entry.data.mask.dst_ip      = 0xffffffff;
+        dnat_entry.data.mask.l4_dst_port = 0xffff;
+        dnat_entry.data.key.proto        = (uint8_t)protoType;
+        dnat_entry.data.mask.proto       = 0xff;
 
-    snat_entry.data.mask.src_ip      = 0xffffffff;
-    snat_entry.data.mask.l4_src_port = 0xffff;
-    snat_entry.data.key.proto        = (uint8_t)protoType;
-    snat_entry.data.mask.proto       = 0xff;
+        missIdx.push_back(i);
+        dnatEntries.push_back(dnat_entry);
+    }
 
-    status = sai_nat_api->get_nat_entry_attribute(&snat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
+    queryHitBitsBulk(dnatEntries, reverseHitBits);
+    for (size_t i = 0; i < missIdx.size(); i++)
     {
-        SWSS_LOG_DEBUG("SNAPT HIT BIT for proto %s, src-ip %s, src-port %d = %d", naptKey.prototype.c_str(),
-                      srcIp.to_string().c_str(), srcPort, nat_entry_attr[0].value.booldata);
-        if (nat_entry_attr[0].value.booldata)
+        if (hitBitmapTest(reverseHitBits, i))
         {
-            entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
-            return 1;
+            hitBitmapSet(hitBits, missIdx[i]);
         }
-        else
-        {
-            NaptEntryKey dnaptKey;
-            dnaptKey.ip_address = entry.translated_ip;
-            dnaptKey.l4_port    = entry.translated_l4_port;
-            dnaptKey.prototype  = naptKey.prototype;
+    }
 
-            auto dnaptIter = m_naptEntries.find(dnaptKey);
-            if (dnaptIter == m_naptEntries.end())
+    /* Word-wise diff against the previous cycle's snapshot, as in
+     * queryNatHitBits */
+    bool aligned = (polledKeys == m_naptPolledKeys);
+    if (!aligned)
+    {
+        /* Entry churn invalidated the snapshot's bit positions. Refresh the
+         * timestamps of every entry seen active in the previous cycle before
+         * evaluating the current one. */
+        for (size_t i = 0; i < m_naptPolledKeys.size(); i++)
+        {
+            if (!hitBitmapTest(m_naptHitBitsSnapshot, i))
             {
-                return 0;
+                continue;
             }
-            if ((dnaptIter->second).addedToHw == false)
+            auto it = m_naptEntries.find(m_naptPolledKeys[i]);
+            if (it != m_naptEntries.end())
             {
-                return 0;
+                int entryTimeout = ((m_naptPolledKeys[i].prototype == "TCP") ? tcp_timeout : udp_timeout);
+                it->second.activeTime = m_prevHitBitPollTime;
+                it->second.ageOutTime = m_prevHitBitPollTime + entryTimeout;
             }
+        }
+    }
 
+    for (size_t w = 0; w < hitBits.size(); w++)
+    {
+        uint64_t pending = aligned ? ~(hitBits[w] & m_naptHitBitsSnapshot[w]) : ~0ULL;
 
-            /* If SNAPT HitBit is not set, check for the HitBit in the reverse direction */
-            memset(&dnat_entry, 0, sizeof(dnat_entry));
-
-            dnat_entry.vr_id                 = gVirtualRouterId;
-            dnat_entry.switch_id             = gSwitchId;
-            dnat_entry.nat_type              = SAI_NAT_TYPE_DESTINATION_NAT;
-
-            dnat_entry.data.key.dst_ip       = entry.translated_ip.getV4Addr();
-            dnat_entry.data.key.l4_dst_port  = (uint16_t)(entry.translated_l4_port);
+        while (pending)
+        {
+            size_t i = (w << 6) + (size_t)__builtin_ctzll(pending);
+            pending &= (pending - 1);
+            if (i >= naptIters.size())
+            {
+                break;
+            }
 
-            dnat_entry.data.mask.dst_ip      = 0xffffffff;
-            dnat_entry.data.mask.l4_dst_port = 0xffff;
-            dnat_entry.data.key.proto        = (uint8_t)protoType;
-            dnat_entry.data.mask.proto       = 0xff;
+            const NaptEntryKey &naptKey = naptIters[i]->first;
+            NaptEntryValue     &entry   = naptIters[i]->second;
+            int entryTimeout = ((naptKey.prototype == "TCP") ? tcp_timeout : udp_timeout);
 
-            status = sai_nat_api->get_nat_entry_attribute(&dnat_entry, attr_count, nat_entry_attr);
-            if (status == SAI_STATUS_SUCCESS)
+            if (hitBitmapTest(hitBits, i))
             {
-                SWSS_LOG_DEBUG("DNAPT HIT BIT for proto %s, dst-ip %s, dst-port %d = %d", naptKey.prototype.c_str(),
-                              entry.translated_ip.to_string().c_str(), entry.translated_l4_port, nat_entry_attr[0].value.booldata);
-                if (nat_entry_attr[0].value.booldata)
-                {
-                    entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
-                    return 1;
-                }
+                /* Since the entry is active in the hardware, reset the active time */
+                entry.ageOutTime = now + entryTimeout;
+                entry.activeTime = now;
+            }
+            else if (aligned and hitBitmapTest(m_naptHitBitsSnapshot, i))
+            {
+                /* The hit-bit cleared this cycle; the entry was last seen
+                 * active at the previous poll. */
+                entry.activeTime = m_prevHitBitPollTime;
+                entry.ageOutTime = m_prevHitBitPollTime + entryTimeout;
+            }
+            else if (now - entry.activeTime >= entryTimeout)
+            {
+                std::vector<FieldValueTuple> fvVector;
+                std::string key = (naptKey.prototype + ":" + naptKey.ip_address.to_string() + ":" + to_string(naptKey.l4_port));
+                setTimeoutNotifier->send("AGEOUT-SINGLE-NAPT", key, fvVector);
             }
         }
     }
-    return 0;
+
+    m_naptHitBitsSnapshot = std::move(hitBits);
+    m_naptPolledKeys      = std::move(polledKeys);
 }
 
 bool NatOrch::checkIfTwiceNatEntryIsActive(const TwiceNatEntry::iterator &iter, time_t now)
@@ -17,6 +17,8 @@
 #ifndef SWSS_NATORCH_H
 #define SWSS_NATORCH_H
 
+#include <cstdint>
+
 #include "orch.h"
 #include "observer.h"
 #include "portsorch.h"
@@ -37,6 +39,7 @@
 #define NAT_HITBIT_N_CNTRS_QUERY_PERIOD   5        // 5 secs
 #define NAT_CONNTRACK_TIMEOUT_PERIOD      86400    // 1 day
 #define NAT_HITBIT_QUERY_MULTIPLE         6        // Hit bits are queried every 30 secs
+#define NAT_HITBIT_BULK_QUERY_SIZE        512      // Hit bits are fetched with bulk gets of this size
 
 struct NatEntryValue
 {
@@ -63,6 +66,11 @@ struct NaptEntryKey
     {
         return tie(ip_address, l4_port, prototype) < tie(other.ip_address, other.l4_port, other.prototype);
     }
+
+    bool operator==(const NaptEntryKey& other) const
+    {
+        return tie(ip_address, l4_port, prototype) == tie(other.ip_address, other.l4_port, other.prototype);
+    }
 };
 
 struct NaptEntryValue
@@ -153,6 +161,9 @@ typedef std::map<TwiceNatEntryKey, TwiceNatEntryValue> TwiceNatEntry;
 
 typedef std::map<TwiceNaptEntryKey, TwiceNaptEntryValue> TwiceNaptEntry;
 
+/* Packed hit-bit snapshot of one poll cycle, one bit per polled entry */
+typedef std::vector<uint64_t> HitBitmap;
+
 /* Cache of DNAT entries that are dependent on the 
  * nexthop resolution of the translated destination ip address.
  */
@@ -200,6 +211,16 @@ private:
     NaptEntry               m_naptEntries;
     TwiceNatEntry           m_twiceNatEntries;
     TwiceNaptEntry          m_twiceNaptEntries;
+
+    /* Hit-bit snapshots of the previous poll cycle, diffed word-wise against
+     * the current cycle so entries active in both cycles need no ageing work.
+     * The snapshots are valid only while the polled entry lists are unchanged;
+     * the key lists detect entry churn between the cycles. */
+    HitBitmap               m_natHitBitsSnapshot;
+    HitBitmap               m_naptHitBitsSnapshot;
+    std::vector<IpAddress>     m_natPolledKeys;
+    std::vector<NaptEntryKey>  m_naptPolledKeys;
+    time_t                  m_prevHitBitPollTime;
     SelectableTimer        *m_natQueryTimer;
     SelectableTimer        *m_natTimeoutTimer;
     DBConnector             m_countersDb;
@@ -289,8 +310,9 @@ private:
     bool addHwDnatPoolEntry(const IpAddress &dstIp);
     bool removeHwDnatPoolEntry(const IpAddress &dstIp);
 
-    bool checkIfNatEntryIsActive(const NatEntry::iterator &iter, time_t now);
-    bool checkIfNaptEntryIsActive(const NaptEntry::iterator &iter, time_t now);
+    void queryHitBitsBulk(const std::vector<sai_nat_entry_t> &nat_entries, HitBitmap &hit_bits);
+    void queryNatHitBits(time_t now, uint32_t &queried_entries);
+    void queryNaptHitBits(time_t now, uint32_t &queried_entries);
     bool checkIfTwiceNatEntryIsActive(const TwiceNatEntry::iterator &iter, time_t now);
     bool checkIfTwiceNaptEntryIsActive(const TwiceNaptEntry::iterator &iter, time_t now);
 
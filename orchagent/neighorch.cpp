@@ -1,5 +1,7 @@
 #include <assert.h>
 #include "neighorch.h"
+#include "fieldvalueview.h"
+#include "pipelineperf.h"
 #include "logger.h"
 #include "swssnet.h"
 #include "crmorch.h"
@@ -36,7 +38,8 @@ NeighOrch::NeighOrch(DBConnector *appDb, string tableName, IntfsOrch *intfsOrch,
         m_intfsOrch(intfsOrch),
         m_fdbOrch(fdbOrch),
         m_portsOrch(portsOrch),
-        m_appNeighResolveProducer(appDb, APP_NEIGH_RESOLVE_TABLE_NAME)
+        m_neighResolvePipeline(new RedisPipeline(appDb)),
+        m_appNeighResolveProducer(m_neighResolvePipeline.get(), APP_NEIGH_RESOLVE_TABLE_NAME, true)
 {
     SWSS_LOG_ENTER();
 
@@ -53,12 +56,16 @@ NeighOrch::NeighOrch(DBConnector *appDb, string tableName, IntfsOrch *intfsOrch,
         //Add subscriber to process VOQ system neigh
         tableName = CHASSIS_APP_SYSTEM_NEIGH_TABLE_NAME;
         Orch::addExecutor(new Consumer(new SubscriberStateTable(chassisAppDb, tableName, TableConsumable::DEFAULT_POP_BATCH_SIZE, 0), this, tableName));
-        m_tableVoqSystemNeighTable = unique_ptr<Table>(new Table(chassisAppDb, CHASSIS_APP_SYSTEM_NEIGH_TABLE_NAME));
+        m_voqSystemNeighPipeline = unique_ptr<RedisPipeline>(new RedisPipeline(chassisAppDb));
+        m_tableVoqSystemNeighTable = unique_ptr<Table>(new Table(m_voqSystemNeighPipeline.get(), CHASSIS_APP_SYSTEM_NEIGH_TABLE_NAME, true));
 
-        //STATE DB connection for setting state of the remote neighbor SAI programming
+        //STATE DB connection for setting state of the remote neighbor SAI programming.
+        //A linecard reboot replays thousands of system neighbors, so the state
+        //writes go through a buffered pipeline flushed once per drain
         unique_ptr<DBConnector> stateDb;
         stateDb = make_unique<DBConnector>("STATE_DB", 0);
-        m_stateSystemNeighTable = unique_ptr<Table>(new Table(stateDb.get(), STATE_SYSTEM_NEIGH_TABLE_NAME));
+        m_stateSystemNeighPipeline = unique_ptr<RedisPipeline>(new RedisPipeline(stateDb.get()));
+        m_stateSystemNeighTable = unique_ptr<Table>(new Table(m_stateSystemNeighPipeline.get(), STATE_SYSTEM_NEIGH_TABLE_NAME, true));
     }
 }
 
@@ -141,6 +148,14 @@ void NeighOrch::clearResolvedNeighborEntry(const NeighborEntry &entry)
     return;
 }
 
+/* The resolve producer is buffered: misses accumulated over a drain
+ * cycle leave in a single pipeline flush once all orchs have run */
+void NeighOrch::flushResponses()
+{
+    PipelinePerf::Instance().flushPipeline("NEIGH_RESOLVE", m_neighResolvePipeline.get());
+    Orch::flushResponses();
+}
+
 /*
  * Function Name: processFDBFlushUpdate
  * Description:
@@ -345,6 +360,7 @@ bool NeighOrch::addNextHop(NeighborContext& ctx)
     next_hop_entry.ref_count = 0;
     next_hop_entry.nh_flags = 0;
     m_syncdNextHops[nexthop] = next_hop_entry;
+    indexNextHopByIp(nexthop);
 
     m_intfsOrch->increaseRouterIntfsRefCount(nh.alias);
 
@@ -437,6 +453,7 @@ bool NeighOrch::processBulkAddNextHop(NeighborContext& ctx)
     next_hop_entry.ref_count = 0;
     next_hop_entry.nh_flags = 0;
     m_syncdNextHops[nexthop] = next_hop_entry;
+    indexNextHopByIp(nexthop);
 
     m_intfsOrch->increaseRouterIntfsRefCount(nh.alias);
 
@@ -590,6 +607,26 @@ bool NeighOrch::ifChangeInformNextHop(const string &alias, bool if_up)
     return rc;
 }
 
+void NeighOrch::indexNextHopByIp(const NextHopKey &nexthop)
+{
+    m_nextHopsByIp[nexthop.ip_address].insert(nexthop);
+}
+
+void NeighOrch::unindexNextHopByIp(const NextHopKey &nexthop)
+{
+    auto group = m_nextHopsByIp.find(nexthop.ip_address);
+    if (group == m_nextHopsByIp.end())
+    {
+        return;
+    }
+
+    group->second.erase(nexthop);
+    if (group->second.empty())
+    {
+        m_nextHopsByIp.erase(group);
+    }
+}
+
 void NeighOrch::updateNextHop(const BfdUpdate& update)
 {
     SWSS_LOG_ENTER();
@@ -621,22 +658,24 @@ void NeighOrch::updateNextHop(const BfdUpdate& update)
         return;
     }
 
-    for (auto nhop = m_syncdNextHops.begin(); nhop != m_syncdNextHops.end(); ++nhop)
+    /* only the next hops sharing the peer address depend on this session */
+    auto dependents = m_nextHopsByIp.find(peer_address);
+    if (dependents == m_nextHopsByIp.end())
     {
-        if (nhop->first.ip_address != peer_address)
-        {
-            continue;
-        }
+        return;
+    }
 
+    for (const auto &nhop : dependents->second)
+    {
         if (state == SAI_BFD_SESSION_STATE_UP)
         {
             SWSS_LOG_INFO("updateNextHop get BFD session UP event, key %s", key.c_str());
-            rc = clearNextHopFlag(nhop->first, NHFLAGS_IFDOWN);
+            rc = clearNextHopFlag(nhop, NHFLAGS_IFDOWN);
         }
         else
         {
             SWSS_LOG_INFO("updateNextHop get BFD session DOWN event, key %s", key.c_str());
-            rc = setNextHopFlag(nhop->first, NHFLAGS_IFDOWN);
+            rc = setNextHopFlag(nhop, NHFLAGS_IFDOWN);
         }
 
         if (!rc)
@@ -673,6 +712,7 @@ bool NeighOrch::removeNextHop(const IpAddress &ipAddress, const string &alias)
     }
 
     m_syncdNextHops.erase(nexthop);
+    unindexNextHopByIp(nexthop);
     m_intfsOrch->decreaseRouterIntfsRefCount(alias);
     return true;
 }
@@ -741,6 +781,7 @@ bool NeighOrch::removeMplsNextHop(const NextHopKey& nh)
     }
 
     m_syncdNextHops.erase(nexthop);
+    unindexNextHopByIp(nexthop);
     m_intfsOrch->decreaseRouterIntfsRefCount(nexthop.alias);
     return true;
 }
@@ -759,6 +800,7 @@ bool NeighOrch::removeOverlayNextHop(const NextHopKey &nexthop)
     }
 
     m_syncdNextHops.erase(nexthop);
+    unindexNextHopByIp(nexthop);
     return true;
 }
 
@@ -890,6 +932,31 @@ void NeighOrch::doTask(Consumer &consumer)
         return;
     }
 
+    /*
+     * Neighbor tasks are batched through the entity bulkers: the scan phase
+     * parses and validates each task, removals are queued on the spot and
+     * additions are deferred until the removals have been flushed, so one
+     * consumer batch becomes a handful of bulk SAI calls instead of one
+     * round trip per neighbor. Per-key ordering is preserved by leaving any
+     * task whose neighbor already has a queued operation for the next pass.
+     */
+    struct NeighborBulkTask
+    {
+        SyncMap::iterator it;       // m_toSync entry the task came from
+        NeighborContext ctx;
+        bool queued = false;        // pre-phase queued bulker operations
+
+        NeighborBulkTask(SyncMap::iterator i, NeighborContext c)
+            : it(i), ctx(std::move(c))
+        {
+        }
+    };
+
+    std::list<NeighborBulkTask> bulk_adds;
+    std::list<NeighborBulkTask> bulk_dels;
+    std::set<std::string> bulked_keys;
+    std::set<std::string> bulked_ips;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -930,12 +997,10 @@ void NeighOrch::doTask(Consumer &consumer)
             //For "vlan" type inband, may identify the remote neighbors and skip
         }
 
-        IpAddress ip_address(key.substr(found+1));
+        IpAddress ip_address = FieldValueView::cachedIp(key.substr(found+1));
 
         NeighborEntry neighbor_entry = { ip_address, alias };
 
-        NeighborContext ctx = NeighborContext(neighbor_entry);
-
         if (op == SET_COMMAND)
         {
             Port p;
@@ -954,14 +1019,7 @@ void NeighOrch::doTask(Consumer &consumer)
             }
 
             MacAddress mac_address;
-            for (auto i = kfvFieldsValues(t).begin();
-                 i  != kfvFieldsValues(t).end(); i++)
-            {
-                if (fvField(*i) == "neigh")
-                    mac_address = MacAddress(fvValue(*i));
-            }
-
-            ctx.mac = mac_address;
+            FieldValueView(t).mac("neigh", mac_address);
 
             bool nbr_not_found = (m_syncdNeighbors.find(neighbor_entry) == m_syncdNeighbors.end());
             if (nbr_not_found || m_syncdNeighbors[neighbor_entry].mac != mac_address)
@@ -991,12 +1049,23 @@ void NeighOrch::doTask(Consumer &consumer)
                         it = consumer.m_toSync.erase(it);
                     }
                 }
-                else if (addNeighbor(ctx))
+                else if (bulked_keys.find(key) != bulked_keys.end() ||
+                         bulked_ips.find(ip_address.to_string()) != bulked_ips.end())
                 {
-                    it = consumer.m_toSync.erase(it);
+                    /* An earlier task for this neighbor (or for the same IP
+                     * on another VLAN, which the add path deduplicates against
+                     * the synced state) is already queued in this batch; keep
+                     * ordering by leaving this one for the next pass */
+                    it++;
+                    continue;
                 }
                 else
                 {
+                    NeighborContext ctx = NeighborContext(neighbor_entry, true);
+                    ctx.mac = mac_address;
+                    bulk_adds.emplace_back(it, std::move(ctx));
+                    bulked_keys.insert(key);
+                    bulked_ips.insert(ip_address.to_string());
                     it++;
                     continue;
                 }
@@ -1022,12 +1091,29 @@ void NeighOrch::doTask(Consumer &consumer)
         {
             if (m_syncdNeighbors.find(neighbor_entry) != m_syncdNeighbors.end())
             {
-                if (removeNeighbor(ctx))
+                if (bulked_keys.find(key) != bulked_keys.end())
+                {
+                    it++;
+                    continue;
+                }
+
+                bulk_dels.emplace_back(it, NeighborContext(neighbor_entry, true));
+                auto& task = bulk_dels.back();
+                if (!removeNeighbor(task.ctx))
                 {
+                    bulk_dels.pop_back();
+                    it++;
+                }
+                else if (task.ctx.object_statuses.empty())
+                {
+                    /* Completed without touching hardware */
+                    bulk_dels.pop_back();
                     it = consumer.m_toSync.erase(it);
                 }
                 else
                 {
+                    task.queued = true;
+                    bulked_keys.insert(key);
                     it++;
                 }
             }
@@ -1041,6 +1127,63 @@ void NeighOrch::doTask(Consumer &consumer)
             it = consumer.m_toSync.erase(it);
         }
     }
+
+    if (!bulk_dels.empty())
+    {
+        gNextHopBulker.flush();
+        gNeighBulker.flush();
+
+        for (auto& task : bulk_dels)
+        {
+            if (removeNeighborPost(task.ctx))
+            {
+                consumer.m_toSync.erase(task.it);
+            }
+        }
+        clearBulkers();
+    }
+
+    if (!bulk_adds.empty())
+    {
+        /* Removals are flushed, now queue the additions */
+        for (auto& task : bulk_adds)
+        {
+            task.queued = addNeighbor(task.ctx);
+        }
+
+        gNeighBulker.flush();
+        gNextHopBulker.flush();
+
+        for (auto& task : bulk_adds)
+        {
+            if (!task.queued)
+            {
+                /* Retry on the next pass */
+                continue;
+            }
+
+            /* Empty statuses means addNeighbor completed synchronously */
+            if (!task.ctx.object_statuses.empty() && !addNeighborPost(task.ctx))
+            {
+                continue;
+            }
+
+            string key = task.it->first;
+            auto next_it = consumer.m_toSync.erase(task.it);
+
+            /* Remove remaining DEL operation in m_toSync for the same neighbor.
+             * Since DEL operation is supposed to be executed before SET for the same neighbor
+             * A remaining DEL after the SET operation means the DEL operation failed previously and should not be executed anymore
+             */
+            auto rit = make_reverse_iterator(next_it);
+            while (rit != consumer.m_toSync.rend() && rit->first == key && kfvOp(rit->second) == DEL_COMMAND)
+            {
+                consumer.m_toSync.erase(next(rit).base());
+                SWSS_LOG_NOTICE("Removed pending neighbor DEL operation for %s after SET operation", key.c_str());
+            }
+        }
+        clearBulkers();
+    }
 }
 
 /* Gets all neighbor entries tied to a given mux port */
@@ -1306,6 +1449,14 @@ bool NeighOrch::addNeighbor(NeighborContext& ctx)
         }
     }
 
+    // prefix-route neighbors need the next hop id synchronously for the
+    // route pointing at them, so they never go through the bulker
+    if (bulk_op && prefix_route)
+    {
+        ctx.bulk_op = false;
+        bulk_op = false;
+    }
+
     bool hw_config = isHwConfigured(neighborEntry);
     // Neighbor is ready to be programmed if it's a prefix-mode neighbor OR if it's active
     bool nbr_add_ready = (prefix_route || is_nbr_active);
@@ -1408,6 +1559,21 @@ bool NeighOrch::addNeighbor(NeighborContext& ctx)
     }
     else if (isHwConfigured(neighborEntry))
     {
+        /* MAC change on an existing neighbor is an in-place attribute update;
+         * a gateway failover re-learns thousands of neighbors at once, so
+         * queue the sets on the bulker instead of one blocking call each */
+        if (bulk_op)
+        {
+            SWSS_LOG_INFO("Updating neighbor entry %s on %s via bulker.", ip_address.to_string().c_str(), alias.c_str());
+            ctx.mac_update = true;
+            for (auto &itr : neighbor_attrs)
+            {
+                object_statuses.emplace_back();
+                gNeighBulker.set_entry_attribute(&object_statuses.back(), &neighbor_entry, &itr);
+            }
+            return true;
+        }
+
         for (auto itr : neighbor_attrs)
         {
             status = sai_neighbor_api->set_neighbor_entry_attribute(&neighbor_entry, &itr);
@@ -1608,6 +1774,250 @@ bool NeighOrch::removeNeighbor(NeighborContext& ctx, bool disable)
     return true;
 }
 
+/* Complete a bulked neighbor addition from doTask after the bulkers are flushed */
+bool NeighOrch::addNeighborPost(NeighborContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& object_statuses = ctx.object_statuses;
+    auto it_status = object_statuses.begin();
+    sai_status_t status;
+
+    const MacAddress &macAddress = ctx.mac;
+    const NeighborEntry neighborEntry = ctx.neighborEntry;
+    string alias = neighborEntry.alias;
+    IpAddress ip_address = neighborEntry.ip_address;
+
+    sai_object_id_t rif_id = m_intfsOrch->getRouterIntfsId(alias);
+    if (rif_id == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_INFO("Failed to get rif_id for %s", alias.c_str());
+        return false;
+    }
+
+    sai_neighbor_entry_t neighbor_entry;
+    neighbor_entry.rif_id = rif_id;
+    neighbor_entry.switch_id = gSwitchId;
+    copy(neighbor_entry.ip_address, ip_address);
+
+    if (ctx.mac_update)
+    {
+        for (auto itr : object_statuses)
+        {
+            if (itr != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Failed to update neighbor %s on %s, rv:%d",
+                               macAddress.to_string().c_str(), alias.c_str(), itr);
+                task_process_status handle_status = handleSaiSetStatus(SAI_API_NEIGHBOR, itr);
+                if (handle_status != task_success)
+                {
+                    return parseHandleSaiStatusFailure(handle_status);
+                }
+            }
+        }
+        SWSS_LOG_NOTICE("Updated neighbor %s on %s", macAddress.to_string().c_str(), alias.c_str());
+
+        m_syncdNeighbors[neighborEntry] = { macAddress, true, 0, false };
+
+        NeighborUpdate update = { neighborEntry, macAddress, true };
+        notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
+
+        if(isChassisDbInUse())
+        {
+            //Sync the neighbor to add to the CHASSIS_APP_DB
+            voqSyncAddNeigh(alias, ip_address, macAddress, neighbor_entry);
+        }
+
+        return true;
+    }
+
+    status = *it_status++;
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        if (status == SAI_STATUS_ITEM_ALREADY_EXISTS)
+        {
+            SWSS_LOG_ERROR("Entry exists: neighbor %s on %s, rv:%d",
+                       macAddress.to_string().c_str(), alias.c_str(), status);
+            /* Returning True so as to skip retry */
+            return true;
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Failed to create neighbor %s on %s, rv:%d",
+                       macAddress.to_string().c_str(), alias.c_str(), status);
+            task_process_status handle_status = handleSaiCreateStatus(SAI_API_NEIGHBOR, status);
+            if (handle_status != task_success)
+            {
+                return parseHandleSaiStatusFailure(handle_status);
+            }
+        }
+    }
+
+    SWSS_LOG_NOTICE("Created neighbor ip %s, %s on %s", ip_address.to_string().c_str(),
+            macAddress.to_string().c_str(), alias.c_str());
+    m_intfsOrch->increaseRouterIntfsRefCount(alias);
+
+    if (neighbor_entry.ip_address.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+    {
+        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
+    }
+    else
+    {
+        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
+    }
+
+    if (!processBulkAddNextHop(ctx))
+    {
+        status = sai_neighbor_api->remove_neighbor_entry(&neighbor_entry);
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to remove neighbor %s on %s, rv:%d",
+                           macAddress.to_string().c_str(), alias.c_str(), status);
+            task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NEIGHBOR, status);
+            if (handle_status != task_success)
+            {
+                return parseHandleSaiStatusFailure(handle_status);
+            }
+        }
+        m_intfsOrch->decreaseRouterIntfsRefCount(alias);
+
+        if (neighbor_entry.ip_address.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+        {
+            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
+        }
+        else
+        {
+            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
+        }
+
+        return false;
+    }
+
+    m_syncdNeighbors[neighborEntry] = { macAddress, true, 0, false };
+
+    NeighborUpdate update = { neighborEntry, macAddress, true };
+    notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
+
+    if(isChassisDbInUse())
+    {
+        //Sync the neighbor to add to the CHASSIS_APP_DB
+        voqSyncAddNeigh(alias, ip_address, macAddress, neighbor_entry);
+    }
+
+    return true;
+}
+
+/* Complete a bulked neighbor removal from doTask after the bulkers are flushed */
+bool NeighOrch::removeNeighborPost(NeighborContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& object_statuses = ctx.object_statuses;
+    auto it_status = object_statuses.begin();
+    sai_status_t status;
+
+    const NeighborEntry neighborEntry = ctx.neighborEntry;
+    string alias = neighborEntry.alias;
+    IpAddress ip_address = neighborEntry.ip_address;
+
+    if (m_syncdNeighbors.find(neighborEntry) == m_syncdNeighbors.end())
+    {
+        return true;
+    }
+
+    if (isHwConfigured(neighborEntry))
+    {
+        sai_neighbor_entry_t neighbor_entry;
+        neighbor_entry.rif_id = m_intfsOrch->getRouterIntfsId(alias);
+        neighbor_entry.switch_id = gSwitchId;
+        copy(neighbor_entry.ip_address, ip_address);
+
+        if (ctx.nexthop_status != SAI_STATUS_SUCCESS)
+        {
+            /* When next hop is not found, we continue to remove neighbor entry. */
+            if (ctx.nexthop_status == SAI_STATUS_ITEM_NOT_FOUND)
+            {
+                SWSS_LOG_NOTICE("Next hop %s on %s doesn't exist, rv:%d",
+                               ip_address.to_string().c_str(), alias.c_str(), ctx.nexthop_status);
+            }
+            else
+            {
+                SWSS_LOG_ERROR("Failed to remove next hop %s on %s, rv:%d",
+                               ip_address.to_string().c_str(), alias.c_str(), ctx.nexthop_status);
+                task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NEXT_HOP, ctx.nexthop_status);
+                if (handle_status != task_success)
+                {
+                    return parseHandleSaiStatusFailure(handle_status);
+                }
+            }
+        }
+
+        if (ctx.nexthop_status != SAI_STATUS_ITEM_NOT_FOUND)
+        {
+            if (neighbor_entry.ip_address.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+            {
+                gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEXTHOP);
+            }
+            else
+            {
+                gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEXTHOP);
+            }
+        }
+
+        SWSS_LOG_NOTICE("Removed next hop %s on %s",
+                        ip_address.to_string().c_str(), alias.c_str());
+
+        status = *it_status++;
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            if (status == SAI_STATUS_ITEM_NOT_FOUND)
+            {
+                SWSS_LOG_NOTICE("Neighbor %s on %s already removed, rv:%d",
+                        m_syncdNeighbors[neighborEntry].mac.to_string().c_str(), alias.c_str(), status);
+            }
+            else
+            {
+                SWSS_LOG_ERROR("Failed to remove neighbor %s on %s, rv:%d",
+                        m_syncdNeighbors[neighborEntry].mac.to_string().c_str(), alias.c_str(), status);
+                task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NEIGHBOR, status);
+                if (handle_status != task_success)
+                {
+                    return parseHandleSaiStatusFailure(handle_status);
+                }
+            }
+        }
+        else
+        {
+            if (neighbor_entry.ip_address.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+            {
+                gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
+            }
+            else
+            {
+                gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
+            }
+
+            removeNextHop(ip_address, alias);
+            m_intfsOrch->decreaseRouterIntfsRefCount(alias);
+            SWSS_LOG_NOTICE("Removed neighbor %s on %s",
+                    m_syncdNeighbors[neighborEntry].mac.to_string().c_str(), alias.c_str());
+        }
+    }
+
+    m_syncdNeighbors.erase(neighborEntry);
+
+    NeighborUpdate update = { neighborEntry, MacAddress(), false };
+    notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
+
+    if(isChassisDbInUse())
+    {
+        //Sync the neighbor to delete from the CHASSIS_APP_DB
+        voqSyncDelNeigh(alias, ip_address);
+    }
+
+    return true;
+}
+
 /* Process bulk ctx entry and enable the neigbor */
 bool NeighOrch::processBulkEnableNeighbor(NeighborContext& ctx)
 {
@@ -2011,6 +2421,7 @@ sai_object_id_t NeighOrch::addTunnelNextHop(const NextHopKey& nh)
     next_hop_entry.ref_count = 0;
     next_hop_entry.nh_flags = 0;
     m_syncdNextHops[nh] = next_hop_entry;
+    indexNextHopByIp(nh);
 
     return nh_id;
 }
@@ -2067,6 +2478,14 @@ void NeighOrch::doVoqSystemNeighTask(Consumer &consumer)
         }
     }
 
+    // Resolved once per drain; a linecard reboot floods this table with
+    // thousands of entries and getenv in the per-entry path adds up
+    string platform = getenv("ASIC_VENDOR") ? getenv("ASIC_VENDOR") : "";
+
+    // Port and router-interface readiness looked up once per interface
+    // rather than once per neighbor
+    map<string, Port> port_cache;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -2093,7 +2512,7 @@ void NeighOrch::doVoqSystemNeighTask(Consumer &consumer)
             continue;
         }
 
-        IpAddress ip_address(key.substr(found+1));
+        IpAddress ip_address = FieldValueView::cachedIp(key.substr(found+1));
 
         NeighborEntry neighbor_entry = { ip_address, alias };
 
@@ -2101,15 +2520,20 @@ void NeighOrch::doVoqSystemNeighTask(Consumer &consumer)
 
         if (op == SET_COMMAND)
         {
-            Port p;
-            if (!gPortsOrch->getPort(alias, p))
+            auto pc = port_cache.find(alias);
+            if (pc == port_cache.end())
             {
-                SWSS_LOG_INFO("Port %s doesn't exist", alias.c_str());
-                it++;
-                continue;
+                Port p;
+                if (!gPortsOrch->getPort(alias, p))
+                {
+                    SWSS_LOG_INFO("Port %s doesn't exist", alias.c_str());
+                    it++;
+                    continue;
+                }
+                pc = port_cache.emplace(alias, p).first;
             }
 
-            if (!p.m_rif_id)
+            if (!pc->second.m_rif_id)
             {
                 SWSS_LOG_INFO("Router interface doesn't exist on %s", alias.c_str());
                 it++;
@@ -2118,17 +2542,9 @@ void NeighOrch::doVoqSystemNeighTask(Consumer &consumer)
 
             MacAddress mac_address, original_mac_address;
             uint32_t encap_index = 0;
-            for (auto i = kfvFieldsValues(t).begin();
-                 i  != kfvFieldsValues(t).end(); i++)
-            {
-                if (fvField(*i) == "neigh")
-                    mac_address = MacAddress(fvValue(*i));
-
-                if(fvField(*i) == "encap_index")
-                {
-                    encap_index = (uint32_t)stoul(fvValue(*i));
-                }
-            }
+            FieldValueView fvs(t);
+            fvs.mac("neigh", mac_address);
+            fvs.u32("encap_index", encap_index);
 
             if(!encap_index)
             {
@@ -2210,7 +2626,6 @@ void NeighOrch::doVoqSystemNeighTask(Consumer &consumer)
                     {
                         original_mac_address = mac_address;
                         mac_address = gMacAddress;
-                        string platform = getenv("ASIC_VENDOR") ? getenv("ASIC_VENDOR") : "";
                         // For VS platform, use the original MAC address
                         if (platform == VS_PLATFORM_SUBSTRING)
                         {
@@ -2276,6 +2691,9 @@ void NeighOrch::doVoqSystemNeighTask(Consumer &consumer)
             it = consumer.m_toSync.erase(it);
         }
     }
+
+    // One flush for all the state writes queued in this drain
+    PipelinePerf::Instance().flushPipeline("SYSTEM_NEIGH_STATE", m_stateSystemNeighPipeline.get());
 }
 
 bool NeighOrch::addInbandNeighbor(string alias, IpAddress ip_address)
@@ -2652,6 +3070,7 @@ void NeighOrch::voqSyncAddNeigh(string &alias, IpAddress &ip_address, const MacA
 
     string key = alias + m_tableVoqSystemNeighTable->getTableNameSeparator().c_str() + ip_address.to_string();
     m_tableVoqSystemNeighTable->set(key, attrs);
+    PipelinePerf::Instance().flushPipeline("VOQ_SYSTEM_NEIGH", m_voqSystemNeighPipeline.get());
 }
 
 void NeighOrch::voqSyncDelNeigh(string &alias, IpAddress &ip_address)
@@ -2686,6 +3105,7 @@ void NeighOrch::voqSyncDelNeigh(string &alias, IpAddress &ip_address)
 
     string key = alias + m_tableVoqSystemNeighTable->getTableNameSeparator().c_str() + ip_address.to_string();
     m_tableVoqSystemNeighTable->del(key);
+    PipelinePerf::Instance().flushPipeline("VOQ_SYSTEM_NEIGH", m_voqSystemNeighPipeline.get());
 }
 
 bool NeighOrch::updateVoqNeighborEncapIndex(const NeighborEntry &neighborEntry, uint32_t encap_index)
@@ -2736,6 +3156,7 @@ void NeighOrch::updateSrv6Nexthop(const NextHopKey &nh, const sai_object_id_t &n
         next_hop_entry.ref_count = 0;
         next_hop_entry.nh_flags = 0;
         m_syncdNextHops[nh] = next_hop_entry;
+        indexNextHopByIp(nh);
         gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SRV6_NEXTHOP);
     }
     else
@@ -2743,6 +3164,7 @@ void NeighOrch::updateSrv6Nexthop(const NextHopKey &nh, const sai_object_id_t &n
         assert(m_syncdNextHops[nh].ref_count == 0);
         gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_SRV6_NEXTHOP);
         m_syncdNextHops.erase(nh);
+        unindexNextHopByIp(nh);
     }
 }
 
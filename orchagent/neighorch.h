@@ -10,6 +10,9 @@
 #include "ipaddress.h"
 #include "nexthopkey.h"
 #include "producerstatetable.h"
+#include "redispipeline.h"
+
+#include <unordered_set>
 #include "schema.h"
 #include "bfdorch.h"
 #include "bulker.h"
@@ -54,6 +57,7 @@ struct NeighborContext
     std::deque<sai_status_t>            object_statuses;            // entity bulk statuses for neighbors
     MacAddress                          mac;                        // neighbor mac
     bool                                bulk_op = false;            // use bulker (only for mux use for now)
+    bool                                mac_update = false;         // hw-configured neighbor, bulked attribute update instead of create
     sai_object_id_t                     next_hop_id;                // next hop id
     sai_status_t                        nexthop_status;             // next hop status
 
@@ -119,19 +123,28 @@ public:
     void getMuxNeighborsForPort(string port_name, NeighborTable &m_neighbors);
 
     void clearBulkers();
-    
+
     bool isNoHostRouteSupported();
 
+    void flushResponses() override;
+
 private:
     PortsOrch *m_portsOrch;
     IntfsOrch *m_intfsOrch;
     FdbOrch *m_fdbOrch;
+    /* NEIGH_RESOLVE writes ride a dedicated buffered pipeline so a route
+     * burst referencing thousands of unresolved neighbors produces one
+     * redis round trip per drain cycle instead of one per miss */
+    std::unique_ptr<swss::RedisPipeline> m_neighResolvePipeline;
     ProducerStateTable m_appNeighResolveProducer;
 
     NeighborTable m_syncdNeighbors;
     NextHopTable m_syncdNextHops;
+    /* next hops grouped by peer address so a BFD state change fans out to
+     * its dependents without scanning the whole next hop table */
+    std::map<swss::IpAddress, std::set<NextHopKey>> m_nextHopsByIp;
 
-    std::set<NextHopKey> m_neighborToResolve;
+    std::unordered_set<NextHopKey, boost::hash<NextHopKey>> m_neighborToResolve;
 
     EntityBulker<sai_neighbor_api_t> gNeighBulker;
     ObjectBulker<sai_next_hop_api_t> gNextHopBulker;
@@ -141,12 +154,17 @@ private:
 
     bool addNeighbor(NeighborContext& ctx);
     bool removeNeighbor(NeighborContext& ctx, bool disable = false);
+    bool addNeighborPost(NeighborContext& ctx);
+    bool removeNeighborPost(NeighborContext& ctx);
     bool processBulkEnableNeighbor(NeighborContext& ctx);
     bool processBulkDisableNeighbor(NeighborContext& ctx);
 
     bool setNextHopFlag(const NextHopKey &, const uint32_t);
     bool clearNextHopFlag(const NextHopKey &, const uint32_t);
 
+    void indexNextHopByIp(const NextHopKey &);
+    void unindexNextHopByIp(const NextHopKey &);
+
     bool addPrefixRouteForNeighbor(const IpAddress& ip_address, string& alias,
                                     sai_object_id_t next_hop_id, bool is_active);
     bool removePrefixRouteForNeighbor(const IpAddress& ip_address, sai_object_id_t vrf_id);
@@ -155,7 +173,14 @@ private:
     void doTask(Consumer &consumer);
     void doVoqSystemNeighTask(Consumer &consumer);
 
+    // Local neighbor encap-index sync to CHASSIS_APP_DB is buffered; under
+    // sustained load the auto-tuned flush coalesces a reboot flood of
+    // per-neighbor updates into batched writes on the chassis connection
+    unique_ptr<swss::RedisPipeline> m_voqSystemNeighPipeline;
     unique_ptr<Table> m_tableVoqSystemNeighTable;
+    // State writes for system neighbors are buffered through the pipeline
+    // and flushed once per drain of the system neigh table
+    unique_ptr<swss::RedisPipeline> m_stateSystemNeighPipeline;
     unique_ptr<Table> m_stateSystemNeighTable;
     bool getSystemPortNeighEncapIndex(string &alias, IpAddress &ip, uint32_t &encap_index);
     bool addVoqEncapIndex(string &alias, IpAddress &ip, vector<sai_attribute_t> &neighbor_attrs);
@@ -108,6 +108,11 @@ public:
 
     inline bool operator==(const NextHopGroupKey &o) const
     {
+        /* Different memoized hashes prove inequality without a member walk */
+        if (m_hash_valid && o.m_hash_valid && m_hash != o.m_hash)
+        {
+            return false;
+        }
         if (m_nexthops != o.m_nexthops)
         {
             return false;
@@ -132,16 +137,19 @@ public:
     void add(const std::string &ip, const std::string &alias)
     {
         m_nexthops.emplace(ip, alias);
+        m_hash_valid = false;
     }
 
     void add(const std::string &nh)
     {
         m_nexthops.insert(nh);
+        m_hash_valid = false;
     }
 
     void add(const NextHopKey &nh)
     {
         m_nexthops.insert(nh);
+        m_hash_valid = false;
     }
 
     bool contains(const std::string &ip, const std::string &alias) const
@@ -188,16 +196,19 @@ public:
     {
         NextHopKey nh(ip, alias);
         m_nexthops.erase(nh);
+        m_hash_valid = false;
     }
 
     void remove(const std::string &nh)
     {
         m_nexthops.erase(nh);
+        m_hash_valid = false;
     }
 
     void remove(const NextHopKey &nh)
     {
         m_nexthops.erase(nh);
+        m_hash_valid = false;
     }
 
     const std::string to_string() const
@@ -238,6 +249,26 @@ public:
     void clear()
     {
         m_nexthops.clear();
+        m_hash_valid = false;
+    }
+
+    /*
+     * Memoized hash over the canonical (sorted) member set. m_nexthops only
+     * changes through add()/remove()/clear(), which drop the cache, so
+     * repeated unordered_map lookups against the same key - the common case
+     * when RouteOrch resolves thousands of routes onto a handful of ECMP
+     * groups - skip the O(n) re-hash of every member. Weights are excluded
+     * deliberately: operator== only compares weights of equal member sets,
+     * so equal keys still hash equal.
+     */
+    size_t hash() const
+    {
+        if (!m_hash_valid)
+        {
+            m_hash = boost::hash_range(m_nexthops.begin(), m_nexthops.end());
+            m_hash_valid = true;
+        }
+        return m_hash;
     }
 
 private:
@@ -246,16 +277,19 @@ private:
     bool m_srv6_nexthops = false;
     bool m_srv6_vpn = false;
 
+    mutable size_t m_hash = 0;
+    mutable bool m_hash_valid = false;
+
     // Support std::unordered_map
     template <typename T>
-    friend class std::hash; 
+    friend class std::hash;
 };
 
 namespace std {
     template <>
     struct hash<NextHopGroupKey> {
         size_t operator()(const NextHopGroupKey& obj) const {
-            return boost::hash_range(obj.m_nexthops.begin(), obj.m_nexthops.end());
+            return obj.hash();
         }
     };
 }
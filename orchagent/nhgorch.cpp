@@ -249,7 +249,8 @@ void NhgOrch::doTask(Consumer& consumer)
                 * to be kept in the sync list so we keep trying to create the
                 * actual group when there are enough resources.
                 */
-                if (gRouteOrch->getNhgCount() + NextHopGroup::getSyncedCount() >= gRouteOrch->getMaxNhgCount())
+                if ((gRouteOrch->getNhgCount() + NextHopGroup::getSyncedCount() >= gRouteOrch->getMaxNhgCount()) &&
+                    !evictLowUseNhg())
                 {
                     SWSS_LOG_DEBUG("Next hop group count reached its limit.");
 
@@ -317,7 +318,8 @@ void NhgOrch::doTask(Consumer& consumer)
                  * resources.
                  */
                 if (nhg_ptr->isTemp() &&
-                    (gRouteOrch->getNhgCount() + NextHopGroup::getSyncedCount() >= gRouteOrch->getMaxNhgCount()))
+                    (gRouteOrch->getNhgCount() + NextHopGroup::getSyncedCount() >= gRouteOrch->getMaxNhgCount()) &&
+                    !evictLowUseNhg())
                 {
                     /*
                      * If the group was updated in such way that the previously
@@ -424,6 +426,7 @@ void NhgOrch::doTask(Consumer& consumer)
 
                 if (success)
                 {
+                    m_pendingPromotions.erase(index);
                     m_syncdNextHopGroups.erase(nhg_it);
                 }
             }
@@ -445,6 +448,141 @@ void NhgOrch::doTask(Consumer& consumer)
             ++it;
         }
     }
+
+    /* Batch-promote any demoted groups that fit in the freed-up space. */
+    promotePendingNhgs();
+}
+
+/*
+ * Purpose:     Demote the least-referenced synced group at the NHG limit.
+ * Description: Rank the synced, non-temporary groups by the number of objects
+ *              referencing them and demote an unreferenced one to its
+ *              temporary single-next-hop form, freeing an ASIC group slot.
+ *              Referenced groups are never demoted, as routes point at their
+ *              SAI ID directly.
+ * Params:      None.
+ * Returns:     true, if a group slot was freed;
+ *              false, otherwise.
+ */
+bool NhgOrch::evictLowUseNhg()
+{
+    SWSS_LOG_ENTER();
+
+    auto victim = m_syncdNextHopGroups.end();
+
+    for (auto it = m_syncdNextHopGroups.begin();
+         it != m_syncdNextHopGroups.end(); ++it)
+    {
+        const auto& entry = it->second;
+
+        /*
+         * Only full, synced groups hold an ASIC group slot; skip srv6 groups
+         * as no temporary form exists for them.
+         */
+        if (entry.nhg->isTemp() || !entry.nhg->isSynced() ||
+            entry.nhg->isRecursive() || entry.nhg->getKey().is_srv6_nexthop())
+        {
+            continue;
+        }
+
+        if (victim == m_syncdNextHopGroups.end() ||
+            entry.ref_count < victim->second.ref_count)
+        {
+            victim = it;
+        }
+    }
+
+    if (victim == m_syncdNextHopGroups.end() || victim->second.ref_count != 0)
+    {
+        return false;
+    }
+
+    auto& entry = victim->second;
+    auto full_key = entry.nhg->getKey();
+
+    try
+    {
+        auto temp_nhg = std::make_unique<NextHopGroup>(createTempNhg(full_key));
+
+        if (!temp_nhg->sync())
+        {
+            SWSS_LOG_INFO("Failed to sync temporary NHG %s for eviction",
+                            full_key.to_string().c_str());
+            return false;
+        }
+
+        if (!entry.nhg->remove())
+        {
+            SWSS_LOG_WARN("Failed to remove next hop group %s for eviction",
+                            full_key.to_string().c_str());
+            temp_nhg->remove();
+            return false;
+        }
+
+        entry.nhg = std::move(temp_nhg);
+        m_pendingPromotions[victim->first] = std::move(full_key);
+
+        SWSS_LOG_NOTICE("Demoted unreferenced next hop group %s to its"
+                        " temporary form", victim->first.c_str());
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_INFO("Got exception: %s while demoting group %s",
+                        e.what(), full_key.to_string().c_str());
+        return false;
+    }
+}
+
+/*
+ * Purpose:     Promote demoted groups once resources free up.
+ * Description: Re-sync the full form of groups previously demoted by
+ *              evictLowUseNhg while there is room below the NHG limit.  Runs
+ *              at the end of each drain so the promotion work is batched.
+ * Params:      None.
+ * Returns:     Nothing.
+ */
+void NhgOrch::promotePendingNhgs()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto it = m_pendingPromotions.begin();
+         it != m_pendingPromotions.end(); )
+    {
+        if (gRouteOrch->getNhgCount() + NextHopGroup::getSyncedCount() >=
+                                                gRouteOrch->getMaxNhgCount())
+        {
+            return;
+        }
+
+        auto nhg_it = m_syncdNextHopGroups.find(it->first);
+
+        /* The group may have been removed or updated to a new full form. */
+        if (nhg_it == m_syncdNextHopGroups.end() ||
+            !nhg_it->second.nhg->isTemp())
+        {
+            it = m_pendingPromotions.erase(it);
+            continue;
+        }
+
+        auto nhg = std::make_unique<NextHopGroup>(it->second, false);
+
+        if (nhg->sync())
+        {
+            /*
+             * Placing the new group in the entry will replace the temporary
+             * group, causing it to be removed and freed.
+             */
+            nhg_it->second.nhg = std::move(nhg);
+            SWSS_LOG_NOTICE("Promoted next hop group %s back to its full"
+                            " form", it->first.c_str());
+            it = m_pendingPromotions.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
 }
 
 /*
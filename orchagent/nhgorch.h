@@ -131,4 +131,21 @@ public:
 
 private:
     void doTask(Consumer& consumer) override;
+
+    /*
+     * When the ASIC is at the NHG limit, demote the least-referenced synced
+     * group to its temporary single-next-hop form to make room.  Only
+     * completely unreferenced groups are eligible, as routes point at a
+     * referenced group's SAI ID directly.
+     */
+    bool evictLowUseNhg();
+
+    /* Promote previously demoted groups once resources free up. */
+    void promotePendingNhgs();
+
+    /*
+     * Groups demoted while at the NHG limit, mapped to the full key to
+     * restore; promoted in batches at the end of each drain.
+     */
+    unordered_map<string, NextHopGroupKey> m_pendingPromotions;
 };
@@ -127,6 +127,11 @@ void on_port_host_tx_ready(sai_object_id_t switch_id, sai_object_id_t port_id, s
     // which causes concurrency access to the DB
 }
 
+/*
+ * This handler runs by libsairedis in a separate thread. Hand the event
+ * off to SwitchOrch's queue so the DB writes happen on the main loop and
+ * a burst of health events can't delay other notifications behind it.
+ */
 void on_switch_asic_sdk_health_event(sai_object_id_t switch_id,
                                      sai_switch_asic_sdk_health_severity_t severity,
                                      sai_timespec_t timestamp,
@@ -134,12 +139,12 @@ void on_switch_asic_sdk_health_event(sai_object_id_t switch_id,
                                      sai_switch_health_data_t data,
                                      const sai_u8_list_t description)
 {
-    gSwitchOrch->onSwitchAsicSdkHealthEvent(switch_id,
-                                            severity,
-                                            timestamp,
-                                            category,
-                                            data,
-                                            description);
+    gSwitchOrch->queueAsicSdkHealthEvent(switch_id,
+                                         severity,
+                                         timestamp,
+                                         category,
+                                         data,
+                                         description);
 }
 
 void on_tam_tel_type_config_change(sai_object_id_t tam_tel_id)
@@ -1,4 +1,6 @@
 #include <stdexcept>
+#include <algorithm>
+#include <mutex>
 #include <thread>
 #include "timestamp.h"
 #include "orch.h"
@@ -11,19 +13,44 @@
 #include "zmqserver.h"
 #include "zmqconsumerstatetable.h"
 #include "sai_serialize.h"
+#include "orchperf.h"
+#include "drainjournal.h"
+#include "drainsched.h"
+#include "eventring.h"
 
 using namespace swss;
 
 int gBatchSize = 0;
 
+/* Upper bound on pending tasks per consumer; 0 disables backpressure */
+size_t gMaxToSyncSize = 0;
+
+/* Low watermark at which a paused consumer resumes popping; 0 means half
+ * the high watermark (see -B <high>[:<low>]) */
+size_t gMinToSyncSize = 0;
+
+/* Exponential backoff for the periodic retry sweep, enabled with -E */
+bool gRetryBackoffEnabled = false;
+
 std::shared_ptr<RingBuffer> Orch::gRingBuffer = nullptr;
 std::shared_ptr<RingBuffer> Executor::gRingBuffer = nullptr;
 
-RingBuffer::RingBuffer(int size): buffer(size)
+RingBuffer::RingBuffer(int size)
 {
     if (size <= 1) {
         throw std::invalid_argument("Buffer size must be greater than 1");
     }
+
+    /* Round the capacity up to a power of two so slot indexing reduces to
+     * a mask instead of a modulo on the hot path. */
+    size_t capacity = 2;
+    while (capacity < static_cast<size_t>(size))
+        capacity <<= 1;
+
+    buffer = std::vector<Cell>(capacity);
+    mask = capacity - 1;
+    for (size_t i = 0; i < capacity; i++)
+        buffer[i].sequence.store(i, std::memory_order_relaxed);
 }
 
 void RingBuffer::pauseThread()
@@ -43,42 +70,90 @@ void RingBuffer::notify()
 
 void RingBuffer::setIdle(bool idle)
 {
-    idle_status = idle;
+    idle_status.store(idle, std::memory_order_release);
 }
 
 bool RingBuffer::IsIdle() const
 {
-    return idle_status;
+    return idle_status.load(std::memory_order_acquire);
 }
 
 bool RingBuffer::IsFull() const
 {
-    return (tail + 1) % static_cast<int>(buffer.size()) == head;
+    return tail.load(std::memory_order_acquire) -
+           head.load(std::memory_order_acquire) > mask;
 }
 
 bool RingBuffer::IsEmpty() const
 {
-    return tail == head;
+    return tail.load(std::memory_order_acquire) ==
+           head.load(std::memory_order_acquire);
 }
 
 bool RingBuffer::push(AnyTask ringEntry)
 {
-    if (IsFull())
-        return false;
-    buffer[tail] = std::move(ringEntry);
-    tail = (tail + 1) % static_cast<int>(buffer.size());
-    return true;
+    size_t pos = tail.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Cell& cell = buffer[pos & mask];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0)
+        {
+            /* The slot is free; try to claim it against other producers */
+            if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.task = std::move(ringEntry);
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+            /* CAS failure reloaded pos; retry with the fresh value */
+        }
+        else if (diff < 0)
+        {
+            /* The consumer has not released this slot yet: ring full */
+            return false;
+        }
+        else
+        {
+            pos = tail.load(std::memory_order_relaxed);
+        }
+    }
 }
 
 bool RingBuffer::pop(AnyTask& ringEntry)
 {
-    if (IsEmpty())
+    size_t pos = head.load(std::memory_order_relaxed);
+    Cell& cell = buffer[pos & mask];
+    size_t seq = cell.sequence.load(std::memory_order_acquire);
+
+    if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0)
         return false;
-    ringEntry = std::move(buffer[head]);
-    head = (head + 1) % static_cast<int>(buffer.size());
+
+    ringEntry = std::move(cell.task);
+    cell.task = nullptr;
+    /* Release the slot for the producer one lap ahead */
+    cell.sequence.store(pos + mask + 1, std::memory_order_release);
+    head.store(pos + 1, std::memory_order_release);
     return true;
 }
 
+size_t RingBuffer::popBatch(std::vector<AnyTask>& entries, size_t maxBatch)
+{
+    size_t popped = 0;
+    AnyTask task;
+
+    while (popped < maxBatch && pop(task))
+    {
+        entries.push_back(std::move(task));
+        popped++;
+    }
+
+    return popped;
+}
+
 void RingBuffer::addExecutor(Executor* executor)
 {
     m_consumerSet.insert(executor->getName());
@@ -102,6 +177,14 @@ Orch::Orch(DBConnector *db, const vector<string> &tableNames)
     }
 }
 
+Orch::Orch(DBConnector *db, const vector<string> &tableNames, int pri)
+{
+    for (auto it : tableNames)
+    {
+        addConsumer(db, it, pri);
+    }
+}
+
 Orch::Orch(swss::DBConnector *db1, swss::DBConnector *db2, 
     const std::vector<std::string> &tableNames_1, const std::vector<std::string> &tableNames_2)
 {
@@ -146,9 +229,33 @@ vector<Selectable *> Orch::getSelectables()
     return selectables;
 }
 
+/*
+ * Registry of every RetryCache in the process, used by
+ * notifyConstraintResolved() to fan a resolution out to all consumers.
+ * Orchs live until daemon teardown, so raw pointers are safe here.
+ */
+static std::vector<RetryCache *> gRetryCacheRegistry;
+static std::mutex gRetryCacheRegistryMutex;
+
 void Orch::createRetryCache(const std::string &executorName) {
     if (m_retryCaches.find(executorName) == m_retryCaches.end())
+    {
         m_retryCaches[executorName] = std::make_shared<RetryCache>(executorName);
+
+        std::lock_guard<std::mutex> lock(gRetryCacheRegistryMutex);
+        gRetryCacheRegistry.push_back(m_retryCaches[executorName].get());
+    }
+}
+
+void Orch::notifyConstraintResolved(const Constraint &cst)
+{
+    std::lock_guard<std::mutex> lock(gRetryCacheRegistryMutex);
+
+    for (auto cache : gRetryCacheRegistry)
+    {
+        /* mark_resolved() ignores caches with no task pending on cst */
+        cache->mark_resolved(cst);
+    }
 }
 
 RetryCache *Orch::getRetryCache(const std::string &executorName)
@@ -236,15 +343,38 @@ void Orch::notifyRetry(Orch *retryOrch, const std::string &executorName, const C
 }
 
 size_t ConsumerBase::addToSync(std::shared_ptr<std::deque<swss::KeyOpFieldsValuesTuple>> entries, bool onRetry) {
-    return addToSync(*entries, onRetry);
+    return addToSync(std::move(*entries), onRetry);
+}
+
+/* Process-wide pending-task gauge behind ConsumerBase::totalPending() */
+static std::atomic<size_t> gTotalPendingTasks{0};
+
+size_t ConsumerBase::totalPending()
+{
+    return gTotalPendingTasks.load(std::memory_order_relaxed);
+}
+
+void ConsumerBase::reportPending()
+{
+    size_t now = m_toSync.size();
+    if (now > m_reportedPending)
+    {
+        gTotalPendingTasks.fetch_add(now - m_reportedPending, std::memory_order_relaxed);
+    }
+    else if (now < m_reportedPending)
+    {
+        gTotalPendingTasks.fetch_sub(m_reportedPending - now, std::memory_order_relaxed);
+    }
+    m_reportedPending = now;
 }
 
 void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry, bool onRetry)
 {
     addToSyncInternal(entry, onRetry, true);
+    reportPending();
 }
 
-void ConsumerBase::addToSyncInternal(const KeyOpFieldsValuesTuple &entry, bool onRetry, bool recordTask)
+void ConsumerBase::addToSyncInternal(KeyOpFieldsValuesTuple entry, bool onRetry, bool recordTask)
 {
     SWSS_LOG_ENTER();
 
@@ -338,14 +468,14 @@ void ConsumerBase::addToSyncInternal(const KeyOpFieldsValuesTuple &entry, bool o
     /* If a new task comes we directly put it into getConsumerTable().m_toSync map */
     if (m_toSync.find(key) == m_toSync.end())
     {
-        m_toSync.emplace(key, entry);
+        m_toSync.emplace(key, std::move(entry));
     }
 
     /* if a DEL task comes, we overwrite the old key */
     else if (op == DEL_COMMAND)
     {
         m_toSync.erase(key);
-        m_toSync.emplace(key, entry);
+        m_toSync.emplace(key, std::move(entry));
     }
     else
     {
@@ -370,33 +500,38 @@ void ConsumerBase::addToSyncInternal(const KeyOpFieldsValuesTuple &entry, bool o
         }
         if (iter == ret.second)
         {
-            m_toSync.emplace(key, entry);
+            m_toSync.emplace(key, std::move(entry));
+        }
+        else if (iter->second == entry)
+        {
+            /*
+             * The pending SET already carries exactly this data; merging
+             * would be a no-op. Dropping the duplicate here keeps repeated
+             * publishes of an unchanged object (a common pattern during
+             * syncd replays) from re-dirtying the task for doTask().
+             */
+            SWSS_LOG_DEBUG("Skip duplicated SET task: %s", dumpTuple(entry).c_str());
         }
         else
         {
-            KeyOpFieldsValuesTuple existing_data = iter->second;
-
-            auto new_values = kfvFieldsValues(entry);
-            auto existing_values = kfvFieldsValues(existing_data);
+            /* Merge in place on the pending tuple instead of rebuilding it */
+            auto& existing_values = kfvFieldsValues(iter->second);
 
-
-            for (auto it : new_values)
+            for (auto& it : kfvFieldsValues(entry))
             {
-                string field = fvField(it);
-                string value = fvValue(it);
+                const string& field = fvField(it);
 
                 auto iu = existing_values.begin();
                 while (iu != existing_values.end())
                 {
-                    string ofield = fvField(*iu);
-                    if (field == ofield)
+                    if (field == fvField(*iu))
                         iu = existing_values.erase(iu);
                     else
                         iu++;
                 }
-                existing_values.push_back(FieldValueTuple(field, value));
+                existing_values.push_back(std::move(it));
             }
-            iter->second = KeyOpFieldsValuesTuple(key, op, existing_values);
+            kfvOp(iter->second) = op;
         }
     }
 
@@ -415,10 +550,33 @@ size_t ConsumerBase::addToSync(const std::deque<KeyOpFieldsValuesTuple> &entries
     {
         addToSyncInternal(entry, onRetry, onRetry);
     }
+    reportPending();
 
     return entries.size();
 }
 
+size_t ConsumerBase::addToSync(std::deque<KeyOpFieldsValuesTuple> &&entries, bool onRetry)
+{
+    SWSS_LOG_ENTER();
+
+    /* Record first: the async recorder copies the batch at call time,
+     * after which the entries are free to be moved into m_toSync */
+    if (!onRetry)
+    {
+        recordTuples(entries);
+    }
+
+    size_t count = entries.size();
+    for (auto& entry: entries)
+    {
+        addToSyncInternal(std::move(entry), onRetry, onRetry);
+    }
+    entries.clear();
+    reportPending();
+
+    return count;
+}
+
 // TODO: Table should be const
 size_t ConsumerBase::refillToSync(Table* table)
 {
@@ -436,10 +594,10 @@ size_t ConsumerBase::refillToSync(Table* table)
         {
             continue;
         }
-        entries.push_back(kco);
+        entries.push_back(std::move(kco));
     }
 
-    return addToSync(entries);
+    return addToSync(std::move(entries));
 }
 
 size_t ConsumerBase::refillToSync()
@@ -453,7 +611,7 @@ size_t ConsumerBase::refillToSync()
         {
             std::deque<KeyOpFieldsValuesTuple> entries;
             subTable->pops(entries);
-            update_size = addToSync(entries);
+            update_size = addToSync(std::move(entries));
             total_size += update_size;
         } while (update_size != 0);
         return total_size;
@@ -548,19 +706,118 @@ void ConsumerBase::dumpPendingTasks(vector<string> &ts)
     }
 }
 
+bool ConsumerBase::retryAllowed() const
+{
+    if (!gRetryBackoffEnabled || m_retryAttempts == 0)
+    {
+        return true;
+    }
+    return std::chrono::steady_clock::now() >= m_nextRetry;
+}
+
+void ConsumerBase::noteDrainResult(size_t before, size_t after)
+{
+    /* Refresh the backlog gauge with the post-drain depth */
+    reportPending();
+
+    if (!gRetryBackoffEnabled)
+    {
+        return;
+    }
+
+    if (after == 0 || after < before)
+    {
+        /* Progress was made; retry eagerly again */
+        m_retryAttempts = 0;
+        return;
+    }
+
+    uint64_t delay = RETRY_BACKOFF_BASE_MSECS << std::min<size_t>(m_retryAttempts, 16);
+    delay = std::min<uint64_t>(delay, RETRY_BACKOFF_MAX_MSECS);
+    m_retryAttempts++;
+    m_nextRetry = std::chrono::steady_clock::now() + std::chrono::milliseconds(delay);
+}
+
+/* Cumulative high-watermark hits per consumer, published to STATE_DB so
+ * backpressure engagement can be monitored without grepping syslog */
+static void publishWatermarkHit(const std::string &consumerName, uint64_t hits)
+{
+    /* Lazy DB handle, matching the other STATE_DB stats publishers */
+    static DBConnector stateDb("STATE_DB", 0);
+    static Table hitsTable(&stateDb, "ORCH_CONSUMER_BACKPRESSURE");
+
+    size_t low = gMinToSyncSize != 0 ? gMinToSyncSize : (gMaxToSyncSize + 1) / 2;
+    std::vector<FieldValueTuple> fvs = {
+        { "watermark_hits", std::to_string(hits) },
+        { "high_watermark", std::to_string(gMaxToSyncSize) },
+        { "low_watermark", std::to_string(low) },
+    };
+    hitsTable.set(consumerName, fvs);
+}
+
 void Consumer::execute()
 {
     SWSS_LOG_ENTER();
 
+    /*
+     * Backpressure: once m_toSync holds gMaxToSyncSize pending tasks, stop
+     * popping and leave the backlog in redis, which is the cheaper place to
+     * queue it. Try to drain first so a blocked consumer still makes
+     * progress; the fd stays readable, so select() re-offers the data on
+     * the next cycle once doTask() has worked the backlog down. Popping
+     * resumes only below gMinToSyncSize, so a consumer pinned at the limit
+     * refills in full batches instead of oscillating one pop per drain.
+     */
+    if (gMaxToSyncSize != 0)
+    {
+        if (!m_popPaused && m_toSync.size() >= gMaxToSyncSize)
+        {
+            m_popPaused = true;
+            m_watermarkHits++;
+            publishWatermarkHit(getName(), m_watermarkHits);
+            SWSS_LOG_INFO("Consumer %s hit pending-task limit (%zu >= %zu), deferring pop",
+                          getName().c_str(), m_toSync.size(), gMaxToSyncSize);
+        }
+
+        if (m_popPaused)
+        {
+            drain();
+
+            size_t low = gMinToSyncSize != 0 ? gMinToSyncSize : (gMaxToSyncSize + 1) / 2;
+            if (m_toSync.size() >= low)
+            {
+                return;
+            }
+            m_popPaused = false;
+        }
+    }
+
     auto entries = std::make_shared<std::deque<KeyOpFieldsValuesTuple>>();
     getConsumerTable()->pops(*entries);
 
+    /* m_name outlives any dump, so its c_str() is a safe raw argument */
+    EventRing::record(OrchEvent::ConsumerPop,
+                      EventRing::strArg(m_name.c_str()), entries->size());
+
     processAnyTask(
         // bundle tasks into a lambda function which takes no argument and returns void
         // this lambda captures variables by value from the surrounding scope
         [=](){
             addToSync(entries);
+            if (gDrainJournal)
+            {
+                /* Journal the intents ahead of the drain that acts on them */
+                for (const auto &entry : *entries)
+                {
+                    gDrainJournal->record(getName(), kfvKey(entry), kfvOp(entry));
+                }
+            }
             drain();
+            if (gDrainJournal && m_toSync.empty())
+            {
+                /* No task of this table is left in flight, not even retries */
+                gDrainJournal->commit(getName());
+            }
         }
     );
 }
@@ -605,6 +862,24 @@ void Consumer::drain()
 {
     if (!m_toSync.empty())
     {
+        /* Feed the per-executor doTask latency histogram in STATE_DB */
+        OrchPerfTimer timer(getName());
+
+        /* Spend this drain's wall time against the fairness deficit */
+        DrainSchedCharge charge(m_name);
+
+        /* Charge heap churn from this drain to the executor's scope */
+        if (m_memCounters == nullptr)
+        {
+            m_memCounters = OrchMem::Instance().scope(getName());
+        }
+        OrchMemScope memScope(m_memCounters);
+
+        size_t before = m_toSync.size();
+
+        EventRing::record(OrchEvent::DrainBegin,
+                          EventRing::strArg(m_name.c_str()), before);
+
         try
         {
             ((Orch *)m_orch)->doTask((Consumer&)*this);
@@ -629,7 +904,42 @@ void Consumer::drain()
             SWSS_LOG_ERROR("Exception caught: type=unknown, table=%s",
                            getName().c_str());
         }
+
+        EventRing::record(OrchEvent::DrainEnd,
+                          EventRing::strArg(m_name.c_str()), m_toSync.size());
+
+        noteDrainResult(before, m_toSync.size());
+    }
+}
+
+void ShmConsumer::execute()
+{
+    SWSS_LOG_ENTER();
+
+    size_t update_size = 0;
+    auto table = static_cast<swss::ShmConsumerTable *>(getSelectable());
+
+    /* Drain everything the ring holds for this wake before running doTask;
+     * the tuples were materialized once at pops() and move straight into
+     * m_toSync. */
+    do
+    {
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        table->pops(entries);
+        update_size = entries.size();
+        addToSync(std::move(entries));
+    } while (update_size != 0);
+
+    drain();
+}
+
+void ShmConsumer::drain()
+{
+    if (!m_toSync.empty())
+    {
+        ((Orch *)m_orch)->doTask((ConsumerBase &)*this);
     }
+    reportPending();
 }
 
 size_t Orch::addExistingData(const string& tableName)
@@ -918,7 +1228,25 @@ void Orch::doTask()
     {
         try
         {
-            count += retryToSync(it.first, threshold - count);
+            size_t moved = retryToSync(it.first, threshold - count);
+            count += moved;
+
+            /* Skip consumers sitting in a backoff window, unless freshly
+             * resolved retry-cache tasks just arrived for them */
+            auto consumer = dynamic_cast<ConsumerBase *>(it.second.get());
+            if (consumer != nullptr && moved == 0 && !consumer->retryAllowed())
+            {
+                continue;
+            }
+
+            /* Deficit round-robin: a consumer still repaying a long drain
+             * yields this sweep to the smaller tables */
+            if (consumer != nullptr &&
+                !DrainSched::Instance().mayDrain(it.first, consumer->m_toSync.size()))
+            {
+                continue;
+            }
+
             it.second->drain();
         }
         catch (const std::invalid_argument& e)
@@ -1183,12 +1511,25 @@ bool Orch::isItemIdsMapContinuous(unsigned long idsMap, sai_uint32_t maxId)
     return true;
 }
 
+/* Tables opted into the shared-memory transport; loaded once, like the ZMQ
+ * table list in orch_zmq_config.cpp */
+static bool isShmTable(const string &tableName)
+{
+    static const set<string> shmTables = load_shm_tables();
+    return shmTables.find(tableName) != shmTables.end();
+}
+
 void Orch::addConsumer(DBConnector *db, string tableName, int pri)
 {
     if (db->getDbId() == CONFIG_DB || db->getDbId() == STATE_DB || db->getDbId() == CHASSIS_APP_DB)
     {
         addExecutor(new Consumer(new SubscriberStateTable(db, tableName, TableConsumable::DEFAULT_POP_BATCH_SIZE, pri), this, tableName));
     }
+    else if (db->getDbId() == APPL_DB && isShmTable(tableName))
+    {
+        SWSS_LOG_NOTICE("ShmConsumer initialize for: %s", tableName.c_str());
+        addExecutor(new ShmConsumer(new ShmConsumerTable(tableName, gBatchSize, pri), this, tableName));
+    }
     else
     {
         addExecutor(new Consumer(new ConsumerStateTable(db, tableName, gBatchSize, pri), this, tableName));
@@ -7,6 +7,8 @@
 #include <set>
 #include <memory>
 #include <utility>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 
 extern "C" {
@@ -20,6 +22,7 @@ extern "C" {
 #include "consumerstatetable.h"
 #include "zmqconsumerstatetable.h"
 #include "zmqserver.h"
+#include "shmtable.h"
 #include "notificationconsumer.h"
 #include "selectabletimer.h"
 #include "macaddress.h"
@@ -27,6 +30,7 @@ extern "C" {
 #include "recorder.h"
 #include "schema.h"
 #include "retrycache.h"
+#include "orchmem.h"
 
 const char delimiter           = ':';
 const char list_item_delimiter = ',';
@@ -54,10 +58,30 @@ const char state_db_key_delimiter  = '|';
 #define VLAN_SUB_INTERFACE_SEPARATOR "."
 
 #define RING_SIZE 30
+#define RING_POP_BATCH_SIZE 128
 #define SLEEP_MSECONDS 500
 
+/* Retry sweep backoff (enabled with -E): first delay and cap */
+#define RETRY_BACKOFF_BASE_MSECS 10
+#define RETRY_BACKOFF_MAX_MSECS  5000
+
+/* Pending-task depth at which timer executors yield to consumer drains
+ * (see ExecutableTimer in timer.h) */
+#define TIMER_DEFER_BACKLOG_TASKS 1000
+
 const int default_orch_pri = 0;
 
+/*
+ * Executor priority classes. Select services ready Selectables in
+ * descending priority order and Executor forwards the wrapped table's
+ * priority, so when several tables are ready in the same select cycle the
+ * higher class is always drained first. PORT/NEIGH/ROUTE consumers already
+ * carry elevated per-table priorities (see OrchDaemon::init); counter and
+ * telemetry consumers register in the low class so a link flap is never
+ * queued behind a counter refresh.
+ */
+const int counter_orch_pri = -10;
+
 typedef enum
 {
     task_success,
@@ -117,6 +141,7 @@ public:
 
     // Decorating Selectable
     int getFd() override { return m_selectable->getFd(); }
+    int getPri() const override { return m_selectable->getPri(); }
     uint64_t readData() override { return m_selectable->readData(); }
     bool hasCachedData() override { return m_selectable->hasCachedData(); }
     bool initializedWithData() override { return m_selectable->initializedWithData(); }
@@ -146,6 +171,9 @@ protected:
     // Name for Executor
     std::string m_name;
 
+    /* Heap attribution scope for this executor, registered on first drain */
+    OrchMem::Counters *m_memCounters = nullptr;
+
     // Get the underlying selectable
     swss::Selectable *getSelectable() const { return m_selectable; }
 };
@@ -181,7 +209,15 @@ public:
 
     // Returns: the number of entries added to m_toSync
     size_t addToSync(const std::deque<swss::KeyOpFieldsValuesTuple> &entries, bool onRetry=false);
-    size_t addToSync(std::shared_ptr<std::deque<swss::KeyOpFieldsValuesTuple>> entries, bool onRetry=false); 
+
+    /**
+     * Move-ingestion variant: a whole pops() batch is transferred into
+     * m_toSync wholesale, so the per-field strings allocated by pops()
+     * are adopted instead of being reallocated and copied entry by entry.
+     * The batch deque is left in a drained state.
+     */
+    size_t addToSync(std::deque<swss::KeyOpFieldsValuesTuple> &&entries, bool onRetry=false);
+    size_t addToSync(std::shared_ptr<std::deque<swss::KeyOpFieldsValuesTuple>> entries, bool onRetry=false);
 
     /**
      * @brief Add the failed task and its constraint to the consumer's RetryCache
@@ -193,21 +229,60 @@ public:
     size_t refillToSync();
     size_t refillToSync(swss::Table* table);
 
+    /**
+     * Exponential backoff for the periodic retry sweep. A drain that leaves
+     * m_toSync non-empty without consuming anything counts as a failed
+     * attempt; each failure doubles the delay before Orch::doTask() drains
+     * this consumer again, up to RETRY_BACKOFF_MAX_MSECS. Any progress or
+     * newly arrived data resets the budget. Inactive unless orchagent runs
+     * with -E.
+     */
+    bool retryAllowed() const;
+    void noteDrainResult(size_t before, size_t after);
+
+    /*
+     * Process-wide gauge of pending tasks across all consumers, refreshed
+     * as batches arrive and drains finish. Timer executors consult it to
+     * yield to a convergence backlog instead of preempting it (timer.h).
+     */
+    static size_t totalPending();
+    void reportPending();
+
 private:
-    void addToSyncInternal(const swss::KeyOpFieldsValuesTuple &entry, bool onRetry, bool recordTask);
+    size_t m_reportedPending = 0;
+    size_t m_retryAttempts = 0;
+    std::chrono::steady_clock::time_point m_nextRetry = std::chrono::steady_clock::time_point::min();
+
+    /* Takes the entry by value: lvalue callers pay the same single copy as
+     * before, while batch ingestion moves entries through without copying */
+    void addToSyncInternal(swss::KeyOpFieldsValuesTuple entry, bool onRetry, bool recordTask);
 };
 
+/**
+ * Lock-free multi-producer/single-consumer ring (Vyukov bounded MPSC queue).
+ * Each cell carries a sequence number that producers and the consumer use to
+ * claim and release slots with plain atomics, so push() never takes a lock
+ * and concurrent producers cannot corrupt the ring. The condvar is only used
+ * to park/wake the ring thread, not to protect the buffer itself.
+ */
 class RingBuffer
 {
 private:
-    std::vector<AnyTask> buffer;
-    int head = 0;
-    int tail = 0;
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        AnyTask task;
+    };
+
+    std::vector<Cell> buffer;
+    size_t mask;
+    std::atomic<size_t> head{0};
+    std::atomic<size_t> tail{0};
     std::set<std::string> m_consumerSet;
 
     std::condition_variable cv;
     std::mutex mtx;
-    bool idle_status = true;
+    std::atomic<bool> idle_status{true};
 
 public:
     RingBuffer(int size=RING_SIZE);
@@ -226,6 +301,14 @@ public:
     bool push(AnyTask entry);
     bool pop(AnyTask& entry);
 
+    /**
+     * Drain up to maxBatch tasks in one call. The ring thread pays one
+     * wakeup per batch instead of one per task, which matters when
+     * producers enqueue millions of small tasks during route churn.
+     * Returns the number of tasks popped into entries (appended).
+     */
+    size_t popBatch(std::vector<AnyTask>& entries, size_t maxBatch);
+
     void addExecutor(Executor* executor);
     bool serves(const std::string& tableName);
     void setIdle(bool idle);
@@ -260,6 +343,37 @@ public:
         return getDbConnector()->getDbName();
     }
 
+    void execute() override;
+    void drain() override;
+
+private:
+    /* Backpressure hysteresis: popping pauses at gMaxToSyncSize pending
+     * tasks and resumes only below gMinToSyncSize (see execute()) */
+    bool m_popPaused = false;
+    uint64_t m_watermarkHits = 0;
+};
+
+/*
+ * Executor for tables riding the shared-memory transport (lib/shmtable.h).
+ * Entries follow the same KeyOpFieldsValuesTuple flow as Consumer, but they
+ * arrive through a cross-process ring instead of redis, so there is no DB to
+ * refill from and nothing is persisted. Tables opt in through
+ * SHM_TABLE_CONFIGFILE; an Orch owning an opted-in table must handle it in
+ * doTask(ConsumerBase &), the same contract ZmqConsumer already imposes.
+ */
+class ShmConsumer : public ConsumerBase {
+public:
+    ShmConsumer(swss::ShmConsumerTable *select, Orch *orch, const std::string &name)
+        : ConsumerBase(select, orch, name)
+    {
+    }
+
+    swss::TableBase *getConsumerTable() const override
+    {
+        // ShmConsumerTable is a subclass of TableBase
+        return static_cast<swss::ShmConsumerTable *>(getSelectable());
+    }
+
     void execute() override;
     void drain() override;
 };
@@ -284,6 +398,7 @@ class Orch
 public:
     Orch(swss::DBConnector *db, const std::string tableName, int pri = default_orch_pri);
     Orch(swss::DBConnector *db, const std::vector<std::string> &tableNames);
+    Orch(swss::DBConnector *db, const std::vector<std::string> &tableNames, int pri);
     Orch(swss::DBConnector *db1, swss::DBConnector *db2,
         const std::vector<std::string> &tableNames_1, const std::vector<std::string> &tableNames_2);
     Orch(swss::DBConnector *db, const std::vector<table_name_with_pri_t> &tableNameWithPri);
@@ -307,6 +422,8 @@ public:
 
     /* Run doTask against a specific executor */
     virtual void doTask(Consumer &consumer) { };
+    /* Transport-agnostic variant: ShmConsumer drains through this overload */
+    virtual void doTask(ConsumerBase &consumer) { };
     virtual void doTask(swss::NotificationConsumer &consumer) { }
     virtual void doTask(swss::SelectableTimer &timer) { }
 
@@ -322,6 +439,7 @@ public:
 
     void dumpPendingTasks(std::vector<std::string> &ts);
     
+    /* Also registers the cache for notifyConstraintResolved() broadcasts */
     void createRetryCache(const std::string &executorName);
     RetryCache* getRetryCache(const std::string &executorName);
     ConsumerBase* getConsumerBase(const std::string &executorName);
@@ -352,10 +470,20 @@ public:
      */
     virtual void notifyRetry(Orch *retryOrch, const std::string &executorName, const Constraint &cst);
 
+    /**
+     * @brief Broadcast a constraint resolution to every RetryCache in the
+     * process. Each cache filters on its own pending constraints, so the
+     * producing Orch does not need to know which consumers are blocked on
+     * the object it just created. Tasks flow back to their SyncMaps through
+     * the regular retryToSync() sweep.
+     * @param cst - the constraint that is resolved
+     */
+    static void notifyConstraintResolved(const Constraint &cst);
+
     /**
      * @brief Flush pending responses
      */
-    void flushResponses();
+    virtual void flushResponses();
 protected:
     ConsumerMap m_consumerMap;
     RetryCacheMap m_retryCaches;
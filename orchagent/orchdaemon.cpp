@@ -1,4 +1,6 @@
 #include <unistd.h>
+#include <inttypes.h>
+#include <algorithm>
 #include <unordered_map>
 #include <chrono>
 #include <thread>
@@ -6,9 +8,17 @@
 #include <errno.h>
 #include <signal.h>
 #include "orchdaemon.h"
+#include "timer.h"
+#include "orchperf.h"
+#include "pipelineperf.h"
+#include "saitrace.h"
+#include "drainjournal.h"
+#include "drainsched.h"
+#include "eventring.h"
 #include "logger.h"
 #include <sairedis.h>
 #include "warm_restart.h"
+#include "warmviewcmp.h"
 #include <iostream>
 #include "orch_zmq_config.h"
 
@@ -24,6 +34,12 @@ using namespace swss;
 #define SELECT_TIMEOUT 1000
 #define PFC_WD_POLL_MSECS 100
 
+/* Upper bound for the adaptive event batching budget in start() */
+#define EVENT_BATCH_MAX 128
+
+/* A sweep longer than this dumps the event ring for offline analysis */
+#define DRAIN_STALL_DUMP_MSECS 5000
+
 #define APP_FABRIC_MONITOR_PORT_TABLE_NAME      "FABRIC_PORT_TABLE"
 #define APP_FABRIC_MONITOR_DATA_TABLE_NAME      "FABRIC_MONITOR_TABLE"
 
@@ -153,15 +169,24 @@ void OrchDaemon::popRingBuffer()
     gRingBuffer->thread_created = true;
     SWSS_LOG_NOTICE("OrchDaemon starts the popRingBuffer thread!");
 
+    std::vector<AnyTask> batch;
+    batch.reserve(RING_POP_BATCH_SIZE);
+
     while (!gRingBuffer->thread_exited)
     {
         gRingBuffer->pauseThread();
 
         gRingBuffer->setIdle(false);
 
-        AnyTask func;
-        while (gRingBuffer->pop(func)) {
-            func();
+        /* Drain in batches so each condvar wakeup amortizes over many
+         * tasks instead of paying a wake per enqueued entry */
+        while (gRingBuffer->popBatch(batch, RING_POP_BATCH_SIZE) > 0)
+        {
+            for (auto& func : batch)
+            {
+                func();
+            }
+            batch.clear();
         }
 
         gRingBuffer->setIdle(true);
@@ -184,6 +209,210 @@ void OrchDaemon::disableRingBuffer() {
     Orch::gRingBuffer = nullptr;
 }
 
+void OrchDaemon::enableDrainJournal(const std::string &path)
+{
+    SWSS_LOG_ENTER();
+
+    gDrainJournal = new DrainJournal();
+    if (!gDrainJournal->open(path))
+    {
+        SWSS_LOG_ERROR("Failed to open drain journal %s, continuing without it", path.c_str());
+        delete gDrainJournal;
+        gDrainJournal = nullptr;
+        return;
+    }
+
+    auto incomplete = gDrainJournal->recover();
+    if (incomplete.empty())
+    {
+        SWSS_LOG_NOTICE("Drain journal %s shows a clean shutdown, nothing to re-validate", path.c_str());
+        return;
+    }
+
+    /* Publish the keys that were mid-drain so recovery tooling can scope its
+     * ASIC_DB re-validation to them instead of a full-table audit */
+    Table recoveryTable(m_stateDb, "DRAIN_JOURNAL_RECOVERY_TABLE");
+    for (const auto &table : incomplete)
+    {
+        for (const auto &keyOp : table.second)
+        {
+            recoveryTable.hset(table.first + ":" + keyOp.first, "op", keyOp.second);
+        }
+        SWSS_LOG_NOTICE("Drain journal: %zu keys of table %s were in flight at last shutdown",
+                        table.second.size(), table.first.c_str());
+    }
+}
+
+void OrchDaemon::enableParallelExec()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_scheduler)
+    {
+        return;
+    }
+
+    m_scheduler = std::unique_ptr<OrchScheduler>(new OrchScheduler());
+    buildOrchGraph();
+    m_scheduler->buildGroups(m_orchList);
+}
+
+void OrchDaemon::buildOrchGraph()
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Orchs that resolve references from another Orch, or mutate state that
+     * another Orch reads outside the redis pipeline, must share a serialized
+     * execution group. Anything reachable from the port/intf/neigh/route
+     * chain collapses into one group; counter, CRM and telemetry Orchs stay
+     * independent so a convergence storm no longer starves them (and vice
+     * versa). Null pointers are tolerated: not every Orch is instantiated
+     * on every platform.
+     */
+    m_scheduler->addDependency(gIntfsOrch, gPortsOrch);
+    m_scheduler->addDependency(gBufferOrch, gPortsOrch);
+    m_scheduler->addDependency(gQosOrch, gPortsOrch);
+    m_scheduler->addDependency(gFdbOrch, gPortsOrch);
+    m_scheduler->addDependency(gStpOrch, gPortsOrch);
+    m_scheduler->addDependency(gMacsecOrch, gPortsOrch);
+    m_scheduler->addDependency(gPolicerOrch, gPortsOrch);
+    m_scheduler->addDependency(gCoppOrch, gPortsOrch);
+    m_scheduler->addDependency(gPortsOrch, gSwitchOrch);
+
+    m_scheduler->addDependency(gNeighOrch, gIntfsOrch);
+    m_scheduler->addDependency(gNeighOrch, gFdbOrch);
+    m_scheduler->addDependency(gRouteOrch, gNeighOrch);
+    m_scheduler->addDependency(gNhgOrch, gNeighOrch);
+    m_scheduler->addDependency(gCbfNhgOrch, gNhgOrch);
+    m_scheduler->addDependency(gNhgMapOrch, gNhgOrch);
+    m_scheduler->addDependency(gFgNhgOrch, gNeighOrch);
+    m_scheduler->addDependency(gSrv6Orch, gNeighOrch);
+    m_scheduler->addDependency(gMuxOrch, gNeighOrch);
+    m_scheduler->addDependency(gNatOrch, gRouteOrch);
+    m_scheduler->addDependency(gMirrorOrch, gRouteOrch);
+    m_scheduler->addDependency(gAclOrch, gMirrorOrch);
+    m_scheduler->addDependency(gPbhOrch, gAclOrch);
+    m_scheduler->addDependency(gFlowCounterRouteOrch, gRouteOrch);
+    m_scheduler->addDependency(gIsoGrpOrch, gPortsOrch);
+    m_scheduler->addDependency(gTunneldecapOrch, gIntfsOrch);
+
+    /*
+     * Call-through couplings: the Orchs below do not consume each other's
+     * tables but invoke each other synchronously during doTask, so they
+     * must never land on different workers. Orchs without a global live in
+     * gDirectory; a lookup that misses yields a null pointer, which
+     * addDependency() ignores.
+     */
+    VRFOrch *vrf_orch = gDirectory.get<VRFOrch*>();
+    VNetOrch *vnet_orch = gDirectory.get<VNetOrch*>();
+    VNetRouteOrch *vnet_rt_orch = gDirectory.get<VNetRouteOrch*>();
+    VNetCfgRouteOrch *cfg_vnet_rt_orch = gDirectory.get<VNetCfgRouteOrch*>();
+    VxlanTunnelOrch *vxlan_tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
+    VxlanTunnelMapOrch *vxlan_tunnel_map_orch = gDirectory.get<VxlanTunnelMapOrch*>();
+    VxlanVrfMapOrch *vxlan_vrf_orch = gDirectory.get<VxlanVrfMapOrch*>();
+    EvpnNvoOrch *evpn_nvo_orch = gDirectory.get<EvpnNvoOrch*>();
+    NvgreTunnelOrch *nvgre_tunnel_orch = gDirectory.get<NvgreTunnelOrch*>();
+    NvgreTunnelMapOrch *nvgre_tunnel_map_orch = gDirectory.get<NvgreTunnelMapOrch*>();
+    TwampOrch *twamp_orch = gDirectory.get<TwampOrch*>();
+
+    /* RouteOrch and IntfsOrch resolve and refcount VRFs mid-drain */
+    m_scheduler->addDependency(gRouteOrch, vrf_orch);
+    m_scheduler->addDependency(gIntfsOrch, vrf_orch);
+    m_scheduler->addDependency(vxlan_vrf_orch, vrf_orch);
+
+    /* BfdOrch's doTask notifies NeighOrch and VNetRouteOrch observers inline */
+    m_scheduler->addDependency(gNeighOrch, gBfdOrch);
+    m_scheduler->addDependency(vnet_rt_orch, gBfdOrch);
+
+    /* The tunnel family creates and removes ports through PortsOrch */
+    m_scheduler->addDependency(vxlan_tunnel_orch, gPortsOrch);
+    m_scheduler->addDependency(vxlan_tunnel_map_orch, vxlan_tunnel_orch);
+    m_scheduler->addDependency(evpn_nvo_orch, vxlan_tunnel_orch);
+    m_scheduler->addDependency(nvgre_tunnel_orch, gPortsOrch);
+    m_scheduler->addDependency(nvgre_tunnel_map_orch, nvgre_tunnel_orch);
+    m_scheduler->addDependency(vnet_orch, vxlan_tunnel_orch);
+    m_scheduler->addDependency(vnet_rt_orch, vnet_orch);
+    m_scheduler->addDependency(cfg_vnet_rt_orch, vnet_orch);
+
+    /*
+     * CRM counters are bumped inline from most Orchs' drains and read by
+     * CrmOrch's timer doTask. Serialize CrmOrch with the main group and
+     * pull in the CRM writers that are not already chained into it.
+     */
+    m_scheduler->addDependency(gCrmOrch, gSwitchOrch);
+    m_scheduler->addDependency(gP4Orch, gCrmOrch);
+    m_scheduler->addDependency(twamp_orch, gCrmOrch);
+    m_scheduler->addDependency(gDirectory.get<DashOrch*>(), gCrmOrch);
+    m_scheduler->addDependency(gDirectory.get<DashVnetOrch*>(), gCrmOrch);
+    m_scheduler->addDependency(gDirectory.get<DashRouteOrch*>(), gCrmOrch);
+    m_scheduler->addDependency(gDirectory.get<DashAclOrch*>(), gCrmOrch);
+    m_scheduler->addDependency(gDirectory.get<DashTunnelOrch*>(), gCrmOrch);
+    m_scheduler->addDependency(gDirectory.get<DashMeterOrch*>(), gCrmOrch);
+    m_scheduler->addDependency(gDirectory.get<DashHaOrch*>(), gCrmOrch);
+    m_scheduler->addDependency(gDirectory.get<DashHaFlowOrch*>(), gCrmOrch);
+    m_scheduler->addDependency(gDirectory.get<DashPortMapOrch*>(), gCrmOrch);
+}
+
+void OrchDaemon::doTaskAll()
+{
+    if (m_scheduler)
+    {
+        m_scheduler->runAll();
+    }
+    else
+    {
+        for (Orch *o : m_orchList)
+        {
+            o->doTask();
+        }
+    }
+}
+
+/*
+ * Startup profiling: every Orch in init() is constructed through
+ * profiledNew(), which times the constructor (synchronous CONFIG_DB reads
+ * and SAI queries included) and appends the result here in construction
+ * order. Construction stays serial on purpose: the constructors share the
+ * daemon's DB connections and the SAI channel and register into gDirectory
+ * in dependency order, none of which is safe to run concurrently.
+ */
+static vector<pair<string, uint64_t>> gOrchConstructTimings;
+
+template <typename OrchType, typename... Args>
+static OrchType *profiledNew(const char *name, Args &&... args)
+{
+    auto start = chrono::steady_clock::now();
+    OrchType *orch = new OrchType(forward<Args>(args)...);
+    auto usecs = chrono::duration_cast<chrono::microseconds>(
+            chrono::steady_clock::now() - start).count();
+
+    gOrchConstructTimings.emplace_back(name, static_cast<uint64_t>(usecs));
+    return orch;
+}
+
+void OrchDaemon::publishStartupTimings()
+{
+    SWSS_LOG_ENTER();
+
+    Table timingsTable(m_stateDb, "ORCH_STARTUP_TIMINGS");
+
+    uint64_t total = 0;
+    size_t order = 0;
+    for (const auto &it : gOrchConstructTimings)
+    {
+        vector<FieldValueTuple> fvs = {
+            { "construct_usecs", to_string(it.second) },
+            { "order", to_string(order++) },
+        };
+        timingsTable.set(it.first, fvs);
+        total += it.second;
+    }
+
+    SWSS_LOG_NOTICE("Constructed %zu orchs in %" PRIu64 " ms",
+                    gOrchConstructTimings.size(), total / 1000);
+}
+
 bool OrchDaemon::init()
 {
     SWSS_LOG_ENTER();
@@ -192,7 +421,7 @@ bool OrchDaemon::init()
 
     g_events_handle = events_init_publisher("sonic-events-swss");
 
-    gCrmOrch = new CrmOrch(m_configDb, CFG_CRM_TABLE_NAME);
+    gCrmOrch = profiledNew<CrmOrch>("CrmOrch", m_configDb, CFG_CRM_TABLE_NAME);
 
     TableConnector stateDbSwitchTable(m_stateDb, STATE_SWITCH_CAPABILITY_TABLE_NAME);
     TableConnector app_switch_table(m_applDb, APP_SWITCH_TABLE_NAME);
@@ -211,7 +440,7 @@ bool OrchDaemon::init()
         app_switch_table
     };
 
-    gSwitchOrch = new SwitchOrch(m_applDb, switch_tables, stateDbSwitchTable);
+    gSwitchOrch = profiledNew<SwitchOrch>("SwitchOrch", m_applDb, switch_tables, stateDbSwitchTable);
 
     const int portsorch_base_pri = 40;
 
@@ -230,28 +459,28 @@ bool OrchDaemon::init()
         { APP_MCLAG_FDB_TABLE_NAME,  FdbOrch::fdborch_pri}
     };
 
-    gPortsOrch = new PortsOrch(m_applDb, m_stateDb, ports_tables, m_chassisAppDb);
+    gPortsOrch = profiledNew<PortsOrch>("PortsOrch", m_applDb, m_stateDb, ports_tables, m_chassisAppDb);
     TableConnector stateDbFdb(m_stateDb, STATE_FDB_TABLE_NAME);
     TableConnector stateMclagDbFdb(m_stateDb, STATE_MCLAG_REMOTE_FDB_TABLE_NAME);
-    gFdbOrch = new FdbOrch(m_applDb, app_fdb_tables, stateDbFdb, stateMclagDbFdb, gPortsOrch);
+    gFdbOrch = profiledNew<FdbOrch>("FdbOrch", m_applDb, app_fdb_tables, stateDbFdb, stateMclagDbFdb, gPortsOrch);
 
     TableConnector stateDbBfdSessionTable(m_stateDb, STATE_BFD_SESSION_TABLE_NAME);
 
     BgpGlobalStateOrch* bgp_global_state_orch;
-    bgp_global_state_orch = new BgpGlobalStateOrch(m_configDb, CFG_BGP_DEVICE_GLOBAL_TABLE_NAME);
+    bgp_global_state_orch = profiledNew<BgpGlobalStateOrch>("BgpGlobalStateOrch", m_configDb, CFG_BGP_DEVICE_GLOBAL_TABLE_NAME);
     gDirectory.set(bgp_global_state_orch);
 
-    gBfdOrch = new BfdOrch(m_applDb, APP_BFD_SESSION_TABLE_NAME, stateDbBfdSessionTable);
+    gBfdOrch = profiledNew<BfdOrch>("BfdOrch", m_applDb, APP_BFD_SESSION_TABLE_NAME, stateDbBfdSessionTable);
     gDirectory.set(gBfdOrch);
 
     TableConnector stateDbIcmpSessionTable(m_stateDb, STATE_ICMP_ECHO_SESSION_TABLE_NAME);
-    gIcmpOrch = new IcmpOrch(m_applDb, APP_ICMP_ECHO_SESSION_TABLE_NAME, stateDbIcmpSessionTable);
+    gIcmpOrch = profiledNew<IcmpOrch>("IcmpOrch", m_applDb, APP_ICMP_ECHO_SESSION_TABLE_NAME, stateDbIcmpSessionTable);
     gDirectory.set(gIcmpOrch);
 
     static const  vector<string> route_pattern_tables = {
         CFG_FLOW_COUNTER_ROUTE_PATTERN_TABLE_NAME,
     };
-    gFlowCounterRouteOrch = new FlowCounterRouteOrch(m_configDb, route_pattern_tables);
+    gFlowCounterRouteOrch = profiledNew<FlowCounterRouteOrch>("FlowCounterRouteOrch", m_configDb, route_pattern_tables);
     gDirectory.set(gFlowCounterRouteOrch);
 
     vector<string> stp_tables = {
@@ -260,7 +489,7 @@ bool OrchDaemon::init()
         APP_STP_FASTAGEING_FLUSH_TABLE_NAME,
         APP_STP_INST_PORT_FLUSH_TABLE_NAME
     };
-    gStpOrch = new StpOrch(m_applDb, m_stateDb, stp_tables);
+    gStpOrch = profiledNew<StpOrch>("StpOrch", m_applDb, m_stateDb, stp_tables);
     gDirectory.set(gStpOrch);
 
     vector<string> vnet_tables = {
@@ -274,29 +503,29 @@ bool OrchDaemon::init()
     };
 
     VNetOrch *vnet_orch;
-    vnet_orch = new VNetOrch(m_applDb, APP_VNET_TABLE_NAME);
+    vnet_orch = profiledNew<VNetOrch>("VNetOrch", m_applDb, APP_VNET_TABLE_NAME);
 
     gDirectory.set(vnet_orch);
-    VNetCfgRouteOrch *cfg_vnet_rt_orch = new VNetCfgRouteOrch(m_configDb, m_applDb, cfg_vnet_tables);
+    VNetCfgRouteOrch *cfg_vnet_rt_orch = profiledNew<VNetCfgRouteOrch>("VNetCfgRouteOrch", m_configDb, m_applDb, cfg_vnet_tables);
     gDirectory.set(cfg_vnet_rt_orch);
-    VNetRouteOrch *vnet_rt_orch = new VNetRouteOrch(m_applDb, vnet_tables, vnet_orch);
+    VNetRouteOrch *vnet_rt_orch = profiledNew<VNetRouteOrch>("VNetRouteOrch", m_applDb, vnet_tables, vnet_orch);
     gDirectory.set(vnet_rt_orch);
-    VRFOrch *vrf_orch = new VRFOrch(m_applDb, APP_VRF_TABLE_NAME, m_stateDb, STATE_VRF_OBJECT_TABLE_NAME);
+    VRFOrch *vrf_orch = profiledNew<VRFOrch>("VRFOrch", m_applDb, APP_VRF_TABLE_NAME, m_stateDb, STATE_VRF_OBJECT_TABLE_NAME);
     gDirectory.set(vrf_orch);
-    gMonitorOrch = new MonitorOrch(m_stateDb, STATE_VNET_MONITOR_TABLE_NAME);
+    gMonitorOrch = profiledNew<MonitorOrch>("MonitorOrch", m_stateDb, STATE_VNET_MONITOR_TABLE_NAME);
     gDirectory.set(gMonitorOrch);
-    gBfdMonitorOrch = new BfdMonitorOrch(m_stateDb, STATE_BFD_SESSION_TABLE_NAME);
+    gBfdMonitorOrch = profiledNew<BfdMonitorOrch>("BfdMonitorOrch", m_stateDb, STATE_BFD_SESSION_TABLE_NAME);
     gDirectory.set(gBfdMonitorOrch);
 
     const vector<string> chassis_frontend_tables = {
         CFG_PASS_THROUGH_ROUTE_TABLE_NAME,
     };
-    ChassisOrch* chassis_frontend_orch = new ChassisOrch(m_configDb, m_applDb, chassis_frontend_tables, vnet_rt_orch);
+    ChassisOrch* chassis_frontend_orch = profiledNew<ChassisOrch>("ChassisOrch", m_configDb, m_applDb, chassis_frontend_tables, vnet_rt_orch);
     gDirectory.set(chassis_frontend_orch);
 
-    gIntfsOrch = new IntfsOrch(m_applDb, APP_INTF_TABLE_NAME, vrf_orch, m_chassisAppDb);
+    gIntfsOrch = profiledNew<IntfsOrch>("IntfsOrch", m_applDb, APP_INTF_TABLE_NAME, vrf_orch, m_chassisAppDb);
     gDirectory.set(gIntfsOrch);
-    gNeighOrch = new NeighOrch(m_applDb, APP_NEIGH_TABLE_NAME, gIntfsOrch, gFdbOrch, gPortsOrch, m_chassisAppDb);
+    gNeighOrch = profiledNew<NeighOrch>("NeighOrch", m_applDb, APP_NEIGH_TABLE_NAME, gIntfsOrch, gFdbOrch, gPortsOrch, m_chassisAppDb);
     gDirectory.set(gNeighOrch);
 
     const int fgnhgorch_pri = 15;
@@ -307,7 +536,7 @@ bool OrchDaemon::init()
         { CFG_FG_NHG_MEMBER,          fgnhgorch_pri }
     };
 
-    gFgNhgOrch = new FgNhgOrch(m_configDb, m_applDb, m_stateDb, fgnhg_tables, gNeighOrch, gIntfsOrch, vrf_orch);
+    gFgNhgOrch = profiledNew<FgNhgOrch>("FgNhgOrch", m_configDb, m_applDb, m_stateDb, fgnhg_tables, gNeighOrch, gIntfsOrch, vrf_orch);
     gDirectory.set(gFgNhgOrch);
 
     TableConnector srv6_sid_list_table(m_applDb, APP_SRV6_SID_LIST_TABLE_NAME);
@@ -335,33 +564,33 @@ bool OrchDaemon::init()
     auto enable_route_zmq = get_feature_status(ORCH_NORTHBOND_ROUTE_ZMQ_ENABLED, false);
     auto route_zmq_sever = enable_route_zmq ? m_zmqServer : nullptr;
 
-    gRouteOrch = new RouteOrch(m_applDb, route_tables, gSwitchOrch, gNeighOrch, gIntfsOrch, vrf_orch, gFgNhgOrch, gSrv6Orch, route_zmq_sever);
-    gNhgOrch = new NhgOrch(m_applDb, APP_NEXTHOP_GROUP_TABLE_NAME);
-    gCbfNhgOrch = new CbfNhgOrch(m_applDb, APP_CLASS_BASED_NEXT_HOP_GROUP_TABLE_NAME);
+    gRouteOrch = profiledNew<RouteOrch>("RouteOrch", m_applDb, route_tables, gSwitchOrch, gNeighOrch, gIntfsOrch, vrf_orch, gFgNhgOrch, gSrv6Orch, route_zmq_sever);
+    gNhgOrch = profiledNew<NhgOrch>("NhgOrch", m_applDb, APP_NEXTHOP_GROUP_TABLE_NAME);
+    gCbfNhgOrch = profiledNew<CbfNhgOrch>("CbfNhgOrch", m_applDb, APP_CLASS_BASED_NEXT_HOP_GROUP_TABLE_NAME);
 
-    gCoppOrch = new CoppOrch(m_applDb, APP_COPP_TABLE_NAME);
+    gCoppOrch = profiledNew<CoppOrch>("CoppOrch", m_applDb, APP_COPP_TABLE_NAME);
 
     vector<string> tunnel_tables = {
         APP_TUNNEL_DECAP_TABLE_NAME,
         APP_TUNNEL_DECAP_TERM_TABLE_NAME
     };
-    gTunneldecapOrch = new TunnelDecapOrch(m_applDb, m_stateDb, m_configDb, tunnel_tables);
+    gTunneldecapOrch = profiledNew<TunnelDecapOrch>("TunnelDecapOrch", m_applDb, m_stateDb, m_configDb, tunnel_tables);
     gDirectory.set(gTunneldecapOrch);
 
-    VxlanTunnelOrch *vxlan_tunnel_orch = new VxlanTunnelOrch(m_stateDb, m_applDb, APP_VXLAN_TUNNEL_TABLE_NAME);
+    VxlanTunnelOrch *vxlan_tunnel_orch = profiledNew<VxlanTunnelOrch>("VxlanTunnelOrch", m_stateDb, m_applDb, APP_VXLAN_TUNNEL_TABLE_NAME);
     gDirectory.set(vxlan_tunnel_orch);
-    VxlanTunnelMapOrch *vxlan_tunnel_map_orch = new VxlanTunnelMapOrch(m_applDb, APP_VXLAN_TUNNEL_MAP_TABLE_NAME);
+    VxlanTunnelMapOrch *vxlan_tunnel_map_orch = profiledNew<VxlanTunnelMapOrch>("VxlanTunnelMapOrch", m_applDb, APP_VXLAN_TUNNEL_MAP_TABLE_NAME);
     gDirectory.set(vxlan_tunnel_map_orch);
-    VxlanVrfMapOrch *vxlan_vrf_orch = new VxlanVrfMapOrch(m_applDb, APP_VXLAN_VRF_TABLE_NAME);
+    VxlanVrfMapOrch *vxlan_vrf_orch = profiledNew<VxlanVrfMapOrch>("VxlanVrfMapOrch", m_applDb, APP_VXLAN_VRF_TABLE_NAME);
     gDirectory.set(vxlan_vrf_orch);
 
 
-    EvpnNvoOrch* evpn_nvo_orch = new EvpnNvoOrch(m_applDb, APP_VXLAN_EVPN_NVO_TABLE_NAME);
+    EvpnNvoOrch* evpn_nvo_orch = profiledNew<EvpnNvoOrch>("EvpnNvoOrch", m_applDb, APP_VXLAN_EVPN_NVO_TABLE_NAME);
     gDirectory.set(evpn_nvo_orch);
 
-    NvgreTunnelOrch *nvgre_tunnel_orch = new NvgreTunnelOrch(m_configDb, CFG_NVGRE_TUNNEL_TABLE_NAME);
+    NvgreTunnelOrch *nvgre_tunnel_orch = profiledNew<NvgreTunnelOrch>("NvgreTunnelOrch", m_configDb, CFG_NVGRE_TUNNEL_TABLE_NAME);
     gDirectory.set(nvgre_tunnel_orch);
-    NvgreTunnelMapOrch *nvgre_tunnel_map_orch = new NvgreTunnelMapOrch(m_configDb, CFG_NVGRE_TUNNEL_MAP_TABLE_NAME);
+    NvgreTunnelMapOrch *nvgre_tunnel_map_orch = profiledNew<NvgreTunnelMapOrch>("NvgreTunnelMapOrch", m_configDb, CFG_NVGRE_TUNNEL_MAP_TABLE_NAME);
     gDirectory.set(nvgre_tunnel_map_orch);
 
 
@@ -382,7 +611,7 @@ bool OrchDaemon::init()
         CFG_TC_TO_DOT1P_MAP_TABLE_NAME,
         CFG_TC_TO_DSCP_MAP_TABLE_NAME
     };
-    gQosOrch = new QosOrch(m_configDb, qos_tables);
+    gQosOrch = profiledNew<QosOrch>("QosOrch", m_configDb, qos_tables);
 
     vector<string> buffer_tables = {
         APP_BUFFER_POOL_TABLE_NAME,
@@ -392,7 +621,7 @@ bool OrchDaemon::init()
         APP_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME,
         APP_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME
     };
-    gBufferOrch = new BufferOrch(m_applDb, m_configDb, m_stateDb, buffer_tables);
+    gBufferOrch = profiledNew<BufferOrch>("BufferOrch", m_applDb, m_configDb, m_stateDb, buffer_tables);
 
     vector<TableConnector> policer_tables = {
         TableConnector(m_configDb, CFG_POLICER_TABLE_NAME),
@@ -400,11 +629,11 @@ bool OrchDaemon::init()
     };
 
     TableConnector stateDbStorm(m_stateDb, "BUM_STORM_CAPABILITY");
-    gPolicerOrch = new PolicerOrch(policer_tables, gPortsOrch);
+    gPolicerOrch = profiledNew<PolicerOrch>("PolicerOrch", policer_tables, gPortsOrch);
 
     TableConnector stateDbMirrorSession(m_stateDb, STATE_MIRROR_SESSION_TABLE_NAME);
     TableConnector confDbMirrorSession(m_configDb, CFG_MIRROR_SESSION_TABLE_NAME);
-    gMirrorOrch = new MirrorOrch(stateDbMirrorSession, confDbMirrorSession, gPortsOrch, gRouteOrch, gNeighOrch, gFdbOrch, gPolicerOrch, gSwitchOrch);
+    gMirrorOrch = profiledNew<MirrorOrch>("MirrorOrch", stateDbMirrorSession, confDbMirrorSession, gPortsOrch, gRouteOrch, gNeighOrch, gFdbOrch, gPolicerOrch, gSwitchOrch);
 
     TableConnector confDbAclTable(m_configDb, CFG_ACL_TABLE_TABLE_NAME);
     TableConnector confDbAclTableType(m_configDb, CFG_ACL_TABLE_TYPE_TABLE_NAME);
@@ -435,14 +664,14 @@ bool OrchDaemon::init()
         CFG_FLEX_COUNTER_TABLE_NAME
     };
 
-    WatermarkOrch *wm_orch = new WatermarkOrch(m_configDb, wm_tables);
+    WatermarkOrch *wm_orch = profiledNew<WatermarkOrch>("WatermarkOrch", m_configDb, wm_tables);
 
     vector<string> sflow_tables = {
             APP_SFLOW_TABLE_NAME,
             APP_SFLOW_SESSION_TABLE_NAME,
             APP_SFLOW_SAMPLE_RATE_TABLE_NAME
     };
-    SflowOrch *sflow_orch = new SflowOrch(m_applDb,  sflow_tables);
+    SflowOrch *sflow_orch = profiledNew<SflowOrch>("SflowOrch", m_applDb,  sflow_tables);
 
     vector<string> debug_counter_tables = {
         CFG_DEBUG_COUNTER_TABLE_NAME,
@@ -450,7 +679,7 @@ bool OrchDaemon::init()
         CFG_DEBUG_DROP_MONITOR_TABLE_NAME
     };
 
-    gDebugCounterOrch = new DebugCounterOrch(m_configDb, debug_counter_tables, 1000);
+    gDebugCounterOrch = profiledNew<DebugCounterOrch>("DebugCounterOrch", m_configDb, debug_counter_tables, 1000);
 
     const int natorch_base_pri = 50;
 
@@ -463,19 +692,19 @@ bool OrchDaemon::init()
         { APP_NAT_GLOBAL_TABLE_NAME,     natorch_base_pri     }
     };
 
-    gNatOrch = new NatOrch(m_applDb, m_stateDb, nat_tables, gRouteOrch, gNeighOrch);
+    gNatOrch = profiledNew<NatOrch>("NatOrch", m_applDb, m_stateDb, nat_tables, gRouteOrch, gNeighOrch);
 
     vector<string> mux_tables = {
         CFG_MUX_CABLE_TABLE_NAME,
         CFG_PEER_SWITCH_TABLE_NAME
     };
-    gMuxOrch = new MuxOrch(m_configDb, mux_tables, gTunneldecapOrch, gNeighOrch, gFdbOrch);
+    gMuxOrch = profiledNew<MuxOrch>("MuxOrch", m_configDb, mux_tables, gTunneldecapOrch, gNeighOrch, gFdbOrch);
     gDirectory.set(gMuxOrch);
 
-    MuxCableOrch *mux_cb_orch = new MuxCableOrch(m_applDb, m_stateDb, APP_MUX_CABLE_TABLE_NAME);
+    MuxCableOrch *mux_cb_orch = profiledNew<MuxCableOrch>("MuxCableOrch", m_applDb, m_stateDb, APP_MUX_CABLE_TABLE_NAME);
     gDirectory.set(mux_cb_orch);
 
-    MuxStateOrch *mux_st_orch = new MuxStateOrch(m_stateDb, STATE_HW_MUX_CABLE_TABLE_NAME);
+    MuxStateOrch *mux_st_orch = profiledNew<MuxStateOrch>("MuxStateOrch", m_stateDb, STATE_HW_MUX_CABLE_TABLE_NAME);
     gDirectory.set(mux_st_orch);
 
     vector<string> macsec_app_tables = {
@@ -486,9 +715,9 @@ bool OrchDaemon::init()
         APP_MACSEC_INGRESS_SA_TABLE_NAME,
     };
 
-    gMacsecOrch = new MACsecOrch(m_applDb, m_stateDb, macsec_app_tables, gPortsOrch);
+    gMacsecOrch = profiledNew<MACsecOrch>("MACsecOrch", m_applDb, m_stateDb, macsec_app_tables, gPortsOrch);
 
-    gNhgMapOrch = new NhgMapOrch(m_applDb, APP_FC_TO_NHG_INDEX_MAP_TABLE_NAME);
+    gNhgMapOrch = profiledNew<NhgMapOrch>("NhgMapOrch", m_applDb, APP_FC_TO_NHG_INDEX_MAP_TABLE_NAME);
 
     /*
      * The order of the orch list is important for state restore of warm start and
@@ -527,25 +756,25 @@ bool OrchDaemon::init()
     DTelOrch *dtel_orch = NULL;
     if (initialize_dtel)
     {
-        dtel_orch = new DTelOrch(m_configDb, dtel_tables, gPortsOrch);
+        dtel_orch = profiledNew<DTelOrch>("DTelOrch", m_configDb, dtel_tables, gPortsOrch);
         m_orchList.push_back(dtel_orch);
     }
 
-    gAclOrch = new AclOrch(acl_table_connectors, m_stateDb,
+    gAclOrch = profiledNew<AclOrch>("AclOrch", acl_table_connectors, m_stateDb,
         gSwitchOrch, gPortsOrch, gMirrorOrch, gNeighOrch, gRouteOrch, dtel_orch);
 
     vector<string> mlag_tables = {
         { CFG_MCLAG_TABLE_NAME },
         { CFG_MCLAG_INTF_TABLE_NAME }
     };
-    gMlagOrch = new MlagOrch(m_configDb, mlag_tables);
+    gMlagOrch = profiledNew<MlagOrch>("MlagOrch", m_configDb, mlag_tables);
 
     TableConnector appDbIsoGrpTbl(m_applDb, APP_ISOLATION_GROUP_TABLE_NAME);
     vector<TableConnector> iso_grp_tbl_ctrs = {
         appDbIsoGrpTbl
     };
 
-    gIsoGrpOrch = new IsoGrpOrch(iso_grp_tbl_ctrs);
+    gIsoGrpOrch = profiledNew<IsoGrpOrch>("IsoGrpOrch", iso_grp_tbl_ctrs);
 
     //
     // Policy Based Hashing (PBH) orchestrator
@@ -563,7 +792,7 @@ bool OrchDaemon::init()
         cfgDbPbhHashFieldTable
     };
 
-    gPbhOrch = new PbhOrch(pbhTableConnectorList, gAclOrch, gPortsOrch);
+    gPbhOrch = profiledNew<PbhOrch>("PbhOrch", pbhTableConnectorList, gAclOrch, gPortsOrch);
 
     m_orchList.push_back(gFdbOrch);
     m_orchList.push_back(gMirrorOrch);
@@ -607,13 +836,13 @@ bool OrchDaemon::init()
            { APP_FABRIC_MONITOR_PORT_TABLE_NAME, fabric_portsorch_base_pri },
            { APP_FABRIC_MONITOR_DATA_TABLE_NAME, fabric_portsorch_base_pri }
         };
-        gFabricPortsOrch = new FabricPortsOrch(m_applDb, fabric_port_tables, m_fabricPortStatEnabled, m_fabricQueueStatEnabled);
+        gFabricPortsOrch = profiledNew<FabricPortsOrch>("FabricPortsOrch", m_applDb, fabric_port_tables, m_fabricPortStatEnabled, m_fabricQueueStatEnabled);
         m_orchList.push_back(gFabricPortsOrch);
     }
 
     if (gMySwitchSubType == "SmartSwitch")
     {
-        DashEniFwdOrch *dash_eni_fwd_orch = new DashEniFwdOrch(m_configDb, m_applDb, APP_DASH_ENI_FORWARD_TABLE, gNeighOrch);
+        DashEniFwdOrch *dash_eni_fwd_orch = profiledNew<DashEniFwdOrch>("DashEniFwdOrch", m_configDb, m_applDb, APP_DASH_ENI_FORWARD_TABLE, gNeighOrch);
         gDirectory.set(dash_eni_fwd_orch);
         m_orchList.push_back(dash_eni_fwd_orch);
     }
@@ -623,7 +852,7 @@ bool OrchDaemon::init()
         CFG_DEVICE_METADATA_TABLE_NAME
     };
 
-    auto* flexCounterOrch = new FlexCounterOrch(m_configDb, flex_counter_tables);
+    auto* flexCounterOrch = profiledNew<FlexCounterOrch>("FlexCounterOrch", m_configDb, flex_counter_tables);
     m_orchList.push_back(flexCounterOrch);
 
     gDirectory.set(flexCounterOrch);
@@ -664,7 +893,7 @@ bool OrchDaemon::init()
 
         static const vector<sai_queue_attr_t> queueAttrIds;
 
-        m_orchList.push_back(new PfcWdSwOrch<PfcWdZeroBufferHandler, PfcWdLossyHandler>(
+        m_orchList.push_back(profiledNew<PfcWdSwOrch<PfcWdZeroBufferHandler, PfcWdLossyHandler>>("PfcWdSwOrch", 
                     m_configDb,
                     pfc_wd_tables,
                     portStatIds,
@@ -712,7 +941,7 @@ bool OrchDaemon::init()
 	    (platform == CLX_PLATFORM_SUBSTRING) ||
 	    (platform == NPS_PLATFORM_SUBSTRING))
         {
-            m_orchList.push_back(new PfcWdSwOrch<PfcWdZeroBufferHandler, PfcWdLossyHandler>(
+            m_orchList.push_back(profiledNew<PfcWdSwOrch<PfcWdZeroBufferHandler, PfcWdLossyHandler>>("PfcWdSwOrch", 
                         m_configDb,
                         pfc_wd_tables,
                         portStatIds,
@@ -722,7 +951,7 @@ bool OrchDaemon::init()
         }
         else if (platform == BFN_PLATFORM_SUBSTRING)
         {
-            m_orchList.push_back(new PfcWdSwOrch<PfcWdAclHandler, PfcWdLossyHandler>(
+            m_orchList.push_back(profiledNew<PfcWdSwOrch<PfcWdAclHandler, PfcWdLossyHandler>>("PfcWdSwOrch", 
                         m_configDb,
                         pfc_wd_tables,
                         portStatIds,
@@ -784,7 +1013,7 @@ bool OrchDaemon::init()
 
         if(pfcDlrInit)
         {
-            m_orchList.push_back(new PfcWdSwOrch<PfcWdDlrHandler, PfcWdDlrHandler>(
+            m_orchList.push_back(profiledNew<PfcWdSwOrch<PfcWdDlrHandler, PfcWdDlrHandler>>("PfcWdSwOrch", 
                         m_configDb,
                         pfc_wd_tables,
                         portStatIds,
@@ -794,7 +1023,7 @@ bool OrchDaemon::init()
         }
         else
         {
-            m_orchList.push_back(new PfcWdSwOrch<PfcWdAclHandler, PfcWdLossyHandler>(
+            m_orchList.push_back(profiledNew<PfcWdSwOrch<PfcWdAclHandler, PfcWdLossyHandler>>("PfcWdSwOrch", 
                         m_configDb,
                         pfc_wd_tables,
                         portStatIds,
@@ -834,7 +1063,7 @@ bool OrchDaemon::init()
             SAI_QUEUE_ATTR_PAUSE_STATUS,
         };
 
-        m_orchList.push_back(new PfcWdSwOrch<PfcWdSaiDlrInitHandler, PfcWdActionHandler>(
+        m_orchList.push_back(profiledNew<PfcWdSwOrch<PfcWdSaiDlrInitHandler, PfcWdActionHandler>>("PfcWdSwOrch", 
                     m_configDb,
                     pfc_wd_tables,
                     portStatIds,
@@ -845,14 +1074,42 @@ bool OrchDaemon::init()
 
     m_orchList.push_back(&CounterCheckOrch::getInstance(m_configDb));
 
+    /* Consistency audit engine; the timer is armed from CONFIG_DB AUDIT */
+    AuditOrch &audit_orch = AuditOrch::getInstance(m_configDb);
+    audit_orch.registerTarget(gRouteOrch->routeAuditTarget());
+    audit_orch.registerContributor("route_entry", gIntfsOrch->routeAuditContributor());
+    m_orchList.push_back(&audit_orch);
+
+    /* Operator bias for the drain fairness scheduler, if configured */
+    Table drainFairnessTable(m_configDb, DRAIN_SCHED_STATE_TABLE);
+    vector<string> fairnessKeys;
+    drainFairnessTable.getKeys(fairnessKeys);
+    for (const auto &key : fairnessKeys)
+    {
+        string weight;
+        if (drainFairnessTable.hget(key, "weight", weight))
+        {
+            try
+            {
+                DrainSched::Instance().setWeight(key, static_cast<uint32_t>(stoul(weight)));
+            }
+            catch (const exception &e)
+            {
+                SWSS_LOG_WARN("Ignoring invalid drain fairness weight '%s' for %s",
+                              weight.c_str(), key.c_str());
+            }
+        }
+    }
+
     vector<string> p4rt_tables = {APP_P4RT_TABLE_NAME};
     m_p4OrchZmqServer = new swss::ZmqServer(m_p4OrchZmqServerEp, "", false, true);
-    gP4Orch = new P4Orch(m_applDb, p4rt_tables, m_p4OrchZmqServer, vrf_orch, gCoppOrch);
+    gP4Orch = profiledNew<P4Orch>("P4Orch", m_applDb, p4rt_tables, m_p4OrchZmqServer, vrf_orch, gCoppOrch);
     m_orchList.push_back(gP4Orch);
 
     TableConnector confDbTwampTable(m_configDb, CFG_TWAMP_SESSION_TABLE_NAME);
     TableConnector stateDbTwampTable(m_stateDb, STATE_TWAMP_SESSION_TABLE_NAME);
-    TwampOrch *twamp_orch = new TwampOrch(confDbTwampTable, stateDbTwampTable, gSwitchOrch, gPortsOrch, vrf_orch);
+    TwampOrch *twamp_orch = profiledNew<TwampOrch>("TwampOrch", confDbTwampTable, stateDbTwampTable, gSwitchOrch, gPortsOrch, vrf_orch);
+    gDirectory.set(twamp_orch);
     m_orchList.push_back(twamp_orch);
 
     if (HFTelOrch::isSupportedHFTel(gSwitchId))
@@ -861,7 +1118,7 @@ bool OrchDaemon::init()
             CFG_HIGH_FREQUENCY_TELEMETRY_PROFILE_TABLE_NAME,
             CFG_HIGH_FREQUENCY_TELEMETRY_GROUP_TABLE_NAME
         };
-        gHFTOrch = new HFTelOrch(m_configDb, m_stateDb, stel_tables);
+        gHFTOrch = profiledNew<HFTelOrch>("HFTelOrch", m_configDb, m_stateDb, stel_tables);
         m_orchList.push_back(gHFTOrch);
         SWSS_LOG_NOTICE("High Frequency Telemetry is supported on this platform");
     }
@@ -879,6 +1136,8 @@ bool OrchDaemon::init()
         }
     }
 
+    publishStartupTimings();
+
     return true;
 }
 
@@ -915,6 +1174,24 @@ void OrchDaemon::flush()
             orch->flushResponses();
         }
     }
+
+    /* Bounds how long auto-tuned pipeline flush deferrals can hold data */
+    PipelinePerf::Instance().flushPending();
+
+    /* Rate-limited internally; publishes the doTask latency histograms */
+    OrchPerf::Instance().flush();
+
+    /* Likewise for the per-pipeline flush statistics */
+    PipelinePerf::Instance().flush();
+
+    /* Likewise for the per-executor heap attribution */
+    OrchMem::Instance().flush();
+
+    /* Likewise for the drain fairness counters */
+    DrainSched::Instance().flush();
+
+    /* No-op unless SAI call tracing was enabled at startup */
+    SaiTrace::Instance().flush();
 }
 
 /* Release the file handle so the log can be rotated */
@@ -1027,8 +1304,8 @@ void OrchDaemon::start(long heartBeatInterval)
                 }
                 else
                 {
-                    for (Orch *o : m_orchList)
-                        o->doTask();
+                    doTaskAll();
+                    ExecutableTimer::runDeferred();
                 }
             }
 
@@ -1043,17 +1320,58 @@ void OrchDaemon::start(long heartBeatInterval)
             logRotate();
         }
 
+        auto sweepStart = std::chrono::steady_clock::now();
+
         auto *c = (Executor *)s;
         c->execute();
 
+        /*
+         * Adaptive event batching: the epoll readiness list usually holds
+         * more than one consumer during bursts, and the doTask() sweep
+         * below is too expensive to run once per event. Drain additional
+         * ready Selectables with a zero timeout up to the current budget,
+         * then sweep once. The budget doubles while bursts keep the
+         * readiness list full and decays back to one event per wakeup
+         * when the system goes quiet, so idle latency stays unchanged.
+         */
+        int batched = 1;
+        while (batched < m_eventBatchSize &&
+               m_select->select(&s, 0) == Select::OBJECT)
+        {
+            ((Executor *)s)->execute();
+            batched++;
+        }
+
+        if (batched >= m_eventBatchSize)
+        {
+            m_eventBatchSize = std::min(m_eventBatchSize * 2, EVENT_BATCH_MAX);
+        }
+        else if (batched <= m_eventBatchSize / 4)
+        {
+            m_eventBatchSize = std::max(m_eventBatchSize / 2, 1);
+        }
+
         /* After each iteration, periodically check all m_toSync map to
          * execute all the remaining tasks that need to be retried. */
 
         if (!gRingBuffer || (gRingBuffer->IsEmpty() && gRingBuffer->IsIdle()))
         {
-            for (Orch *o : m_orchList)
-                o->doTask();
+            doTaskAll();
+            ExecutableTimer::runDeferred();
+        }
+
+        /*
+         * A sweep that ran this long stalled every other consumer; capture
+         * the event ring while the lead-up is still in the buffers. The
+         * dump itself is rate limited inside EventRing.
+         */
+        auto sweepMsecs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - sweepStart).count();
+        if (sweepMsecs >= DRAIN_STALL_DUMP_MSECS)
+        {
+            EventRing::Instance().dump("drain stall");
         }
+
         /*
          * Asked to check warm restart readiness.
          * Not doing this under Select::TIMEOUT condition because of
@@ -1170,6 +1488,13 @@ bool OrchDaemon::warmRestoreAndSyncUp()
 
     SWSS_LOG_NOTICE("Orchagent state restore done");
 
+    /*
+     * Advisory pre-validation: compare the replayed temporary ASIC view
+     * against the surviving one before handing the diff to syncd, so the
+     * expected amount of reprogramming is known (and logged) up front.
+     */
+    WarmViewCmp::prevalidate();
+
     syncd_apply_view();
 
     for (Orch *o : m_orchList)
@@ -1313,13 +1638,15 @@ bool FabricOrchDaemon::init()
         { APP_FABRIC_MONITOR_PORT_TABLE_NAME, fabric_portsorch_base_pri },
         { APP_FABRIC_MONITOR_DATA_TABLE_NAME, fabric_portsorch_base_pri }
     };
-    gFabricPortsOrch = new FabricPortsOrch(m_applDb, fabric_port_tables);
+    gFabricPortsOrch = profiledNew<FabricPortsOrch>("FabricPortsOrch", m_applDb, fabric_port_tables);
     addOrchList(gFabricPortsOrch);
 
     vector<string> flex_counter_tables = {
         CFG_FLEX_COUNTER_TABLE_NAME
     };
-    addOrchList(new FlexCounterOrch(m_configDb, flex_counter_tables));
+    addOrchList(profiledNew<FlexCounterOrch>("FlexCounterOrch", m_configDb, flex_counter_tables));
+
+    publishStartupTimings();
 
     return true;
 }
@@ -1350,7 +1677,7 @@ bool DpuOrchDaemon::init()
         APP_DASH_VNET_TABLE_NAME,
         APP_DASH_VNET_MAPPING_TABLE_NAME
     };
-    DashVnetOrch *dash_vnet_orch = new DashVnetOrch(m_dpu_appDb, dash_vnet_tables, m_dpu_appstateDb, dash_zmq_server);
+    DashVnetOrch *dash_vnet_orch = profiledNew<DashVnetOrch>("DashVnetOrch", m_dpu_appDb, dash_vnet_tables, m_dpu_appstateDb, dash_zmq_server);
     gDirectory.set(dash_vnet_orch);
 
     vector<string> dash_tables = {
@@ -1361,7 +1688,7 @@ bool DpuOrchDaemon::init()
         APP_DASH_QOS_TABLE_NAME
     };
 
-    DashOrch *dash_orch = new DashOrch(m_dpu_appDb, dash_tables, m_dpu_appstateDb, dash_zmq_server);
+    DashOrch *dash_orch = profiledNew<DashOrch>("DashOrch", m_dpu_appDb, dash_tables, m_dpu_appstateDb, dash_zmq_server);
     gDirectory.set(dash_orch);
 
     vector<string> dash_ha_tables = {
@@ -1370,7 +1697,7 @@ bool DpuOrchDaemon::init()
         APP_BFD_SESSION_TABLE_NAME
     };
 
-    DashHaOrch *dash_ha_orch = new DashHaOrch(m_dpu_appDb, dash_ha_tables, dash_orch, gBfdOrch, m_dpu_appstateDb, dash_zmq_server);
+    DashHaOrch *dash_ha_orch = profiledNew<DashHaOrch>("DashHaOrch", m_dpu_appDb, dash_ha_tables, dash_orch, gBfdOrch, m_dpu_appstateDb, dash_zmq_server);
     gDirectory.set(dash_ha_orch);
 
     vector<string> dash_route_tables = {
@@ -1379,7 +1706,7 @@ bool DpuOrchDaemon::init()
         APP_DASH_ROUTE_GROUP_TABLE_NAME
     };
 
-    DashRouteOrch *dash_route_orch = new DashRouteOrch(m_dpu_appDb, dash_route_tables, dash_orch, m_dpu_appstateDb, dash_zmq_server);
+    DashRouteOrch *dash_route_orch = profiledNew<DashRouteOrch>("DashRouteOrch", m_dpu_appDb, dash_route_tables, dash_orch, m_dpu_appstateDb, dash_zmq_server);
     gDirectory.set(dash_route_orch);
 
     vector<string> dash_acl_tables = {
@@ -1389,13 +1716,13 @@ bool DpuOrchDaemon::init()
         APP_DASH_ACL_GROUP_TABLE_NAME,
         APP_DASH_ACL_RULE_TABLE_NAME
     };
-    DashAclOrch *dash_acl_orch = new DashAclOrch(m_dpu_appDb, dash_acl_tables, dash_orch, m_dpu_appstateDb, dash_zmq_server);
+    DashAclOrch *dash_acl_orch = profiledNew<DashAclOrch>("DashAclOrch", m_dpu_appDb, dash_acl_tables, dash_orch, m_dpu_appstateDb, dash_zmq_server);
     gDirectory.set(dash_acl_orch);
 
     vector<string> dash_tunnel_tables = {
         APP_DASH_TUNNEL_TABLE_NAME
     };
-    DashTunnelOrch *dash_tunnel_orch = new DashTunnelOrch(m_dpu_appDb, dash_tunnel_tables, m_dpu_appstateDb, dash_zmq_server);
+    DashTunnelOrch *dash_tunnel_orch = profiledNew<DashTunnelOrch>("DashTunnelOrch", m_dpu_appDb, dash_tunnel_tables, m_dpu_appstateDb, dash_zmq_server);
     gDirectory.set(dash_tunnel_orch);
 
     vector<string> dash_meter_tables = {
@@ -1403,21 +1730,21 @@ bool DpuOrchDaemon::init()
         APP_DASH_METER_RULE_TABLE_NAME
     };
 
-    DashMeterOrch *dash_meter_orch = new DashMeterOrch(m_dpu_appDb, dash_meter_tables, m_dpu_appstateDb, dash_zmq_server);
+    DashMeterOrch *dash_meter_orch = profiledNew<DashMeterOrch>("DashMeterOrch", m_dpu_appDb, dash_meter_tables, m_dpu_appstateDb, dash_zmq_server);
     gDirectory.set(dash_meter_orch);
 
     vector<string> dash_port_map_tables = {
         APP_DASH_OUTBOUND_PORT_MAP_TABLE_NAME,
         APP_DASH_OUTBOUND_PORT_MAP_RANGE_TABLE_NAME
     };
-    DashPortMapOrch *dash_port_map_orch = new DashPortMapOrch(m_dpu_appDb, dash_port_map_tables, m_dpu_appstateDb, dash_zmq_server);
+    DashPortMapOrch *dash_port_map_orch = profiledNew<DashPortMapOrch>("DashPortMapOrch", m_dpu_appDb, dash_port_map_tables, m_dpu_appstateDb, dash_zmq_server);
     gDirectory.set(dash_port_map_orch);
 
     vector<string> dash_ha_flow_tables = {
         APP_DASH_FLOW_SYNC_SESSION_TABLE_NAME,
         APP_DASH_FLOW_DUMP_FILTER_TABLE_NAME
     };
-    DashHaFlowOrch *dash_ha_flow_orch = new DashHaFlowOrch(m_dpu_appDb, dash_ha_flow_tables, m_dpu_appstateDb, dash_zmq_server);
+    DashHaFlowOrch *dash_ha_flow_orch = profiledNew<DashHaFlowOrch>("DashHaFlowOrch", m_dpu_appDb, dash_ha_flow_tables, m_dpu_appstateDb, dash_zmq_server);
     gDirectory.set(dash_ha_flow_orch);
 
     addOrchList(dash_acl_orch);
@@ -1430,5 +1757,8 @@ bool DpuOrchDaemon::init()
     addOrchList(dash_port_map_orch);
     addOrchList(dash_ha_flow_orch);
 
+    /* Includes the base class orchs; republishing them is harmless */
+    publishStartupTimings();
+
     return true;
 }
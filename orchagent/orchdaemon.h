@@ -60,6 +60,7 @@
 #include "dash/dashmeterorch.h"
 #include "dash/dashportmaporch.h"
 #include "high_frequency_telemetry/hftelorch.h"
+#include "orchscheduler.h"
 #include <sairedis.h>
 
 using namespace swss;
@@ -101,6 +102,23 @@ public:
      */
     void enableRingBuffer();
     void disableRingBuffer();
+
+    /**
+     * Open the drain-cycle write-ahead journal, replay whatever the previous
+     * run left uncommitted and publish those keys to STATE_DB so recovery can
+     * scope its ASIC_DB re-validation to them. Call before consumers start
+     * draining.
+     */
+    void enableDrainJournal(const std::string &path);
+
+    /**
+     * Enable the parallel Orch execution engine. The doTask() sweep over
+     * m_orchList is handed to an OrchScheduler which dispatches independent
+     * Orch groups onto a worker pool while dependent Orchs stay serialized.
+     * The dependency graph is declared in buildOrchGraph() and frozen on
+     * the first sweep.
+     */
+    void enableParallelExec();
     /**
      * This method describes how the ring consumer consumes this ring.
      */
@@ -111,6 +129,13 @@ public:
     std::thread ring_thread;
 
 protected:
+    /**
+     * Publish the per-Orch construction times collected by profiledNew()
+     * to STATE_DB ORCH_STARTUP_TIMINGS. Called at the end of init(); cold
+     * start regressions then show up per Orch instead of as one number.
+     */
+    void publishStartupTimings();
+
     DBConnector *m_applDb;
     DBConnector *m_configDb;
     DBConnector *m_stateDb;
@@ -127,10 +152,20 @@ protected:
 
     std::vector<Orch *> m_orchList;
     Select *m_select;
+    std::unique_ptr<OrchScheduler> m_scheduler;
+
+    /* Adaptive batching budget: ready events drained per doTask() sweep */
+    int m_eventBatchSize = 1;
     std::chrono::time_point<std::chrono::high_resolution_clock> m_lastHeartBeat;
 
     void flush();
 
+    /* Run one doTask() sweep over m_orchList, serial or scheduled */
+    void doTaskAll();
+
+    /* Declare the static inter-Orch dependency edges for the scheduler */
+    void buildOrchGraph();
+
     void heartBeat(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent, long interval);
 
     void freezeAndHeartBeat(unsigned int duration, long interval);
@@ -0,0 +1,106 @@
+#include "orchmem.h"
+
+#include <vector>
+
+#include "logger.h"
+
+using namespace std;
+using namespace swss;
+
+constexpr long OrchMem::FLUSH_INTERVAL_SECS;
+
+thread_local OrchMem::Counters *OrchMem::t_current = nullptr;
+
+/* Static storage so the accounting path never allocates: allocations made
+ * outside any drain scope (startup, notification threads, timers) land here */
+static OrchMem::Counters g_untracked;
+
+OrchMem &OrchMem::Instance()
+{
+    static OrchMem mem;
+    return mem;
+}
+
+OrchMem::Counters *OrchMem::scope(const string &name)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    auto &counters = m_scopes[name];
+    if (!counters)
+    {
+        counters = unique_ptr<Counters>(new Counters());
+    }
+    return counters.get();
+}
+
+void OrchMem::accountAlloc(size_t bytes)
+{
+    Counters *counters = (t_current != nullptr) ? t_current : &g_untracked;
+    counters->live_bytes.fetch_add((int64_t)bytes, std::memory_order_relaxed);
+    counters->live_allocs.fetch_add(1, std::memory_order_relaxed);
+    counters->total_allocs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void OrchMem::accountFree(size_t bytes)
+{
+    /* Frees are charged to the allocating structure's owner only while its
+     * drain is running; releases from elsewhere (observers, destructors)
+     * stay with the active scope so the books still balance globally */
+    Counters *counters = (t_current != nullptr) ? t_current : &g_untracked;
+    counters->live_bytes.fetch_sub((int64_t)bytes, std::memory_order_relaxed);
+    counters->live_allocs.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void OrchMem::flush()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+
+        auto now = chrono::steady_clock::now();
+        if (chrono::duration_cast<chrono::seconds>(now - m_lastFlush).count() < FLUSH_INTERVAL_SECS)
+        {
+            return;
+        }
+        m_lastFlush = now;
+    }
+
+    /* Nothing to report until the allocation hooks have fired (the hooks
+     * are only linked into the orchagent binary) */
+    if (g_untracked.total_allocs.load(std::memory_order_relaxed) == 0)
+    {
+        return;
+    }
+
+    /* The DB handle is created lazily so OrchMem can be used before redis
+     * is reachable (e.g. in unit tests that never flush) */
+    if (!m_table)
+    {
+        m_stateDb = unique_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
+        m_table = unique_ptr<Table>(new Table(m_stateDb.get(), ORCH_HEAP_TABLE));
+    }
+
+    size_t published = 0;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        for (const auto &it : m_scopes)
+        {
+            const auto &counters = *it.second;
+            vector<FieldValueTuple> fvs = {
+                { "live_bytes", to_string(counters.live_bytes.load(std::memory_order_relaxed)) },
+                { "live_allocs", to_string(counters.live_allocs.load(std::memory_order_relaxed)) },
+                { "total_allocs", to_string(counters.total_allocs.load(std::memory_order_relaxed)) },
+            };
+            m_table->set(it.first, fvs);
+            published++;
+        }
+    }
+
+    vector<FieldValueTuple> fvs = {
+        { "live_bytes", to_string(g_untracked.live_bytes.load(std::memory_order_relaxed)) },
+        { "live_allocs", to_string(g_untracked.live_allocs.load(std::memory_order_relaxed)) },
+        { "total_allocs", to_string(g_untracked.total_allocs.load(std::memory_order_relaxed)) },
+    };
+    m_table->set("untracked", fvs);
+
+    SWSS_LOG_INFO("Published heap attribution for %zu executor scopes", published);
+}
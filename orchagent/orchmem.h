@@ -0,0 +1,86 @@
+#ifndef SWSS_ORCHMEM_H
+#define SWSS_ORCHMEM_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "dbconnector.h"
+#include "table.h"
+
+#define ORCH_HEAP_TABLE "ORCH_HEAP_STATS"
+
+/*
+ * OrchMem attributes heap usage to the executor whose drain is running.
+ * Process-wide operator new/delete hooks (orchmem_hooks.cpp, linked into the
+ * orchagent binary only) charge every allocation to the scope installed by
+ * the drain path, or to "untracked" when no drain is active. flush()
+ * publishes live bytes/allocations per executor to STATE_DB under
+ * ORCH_HEAP_STATS — same cadence and registry style as OrchPerf — so RSS
+ * growth can be pinned to an Orch without taking a heap dump.
+ */
+class OrchMem
+{
+public:
+    static constexpr long FLUSH_INTERVAL_SECS = 60;
+
+    struct Counters
+    {
+        std::atomic<int64_t> live_bytes{0};
+        std::atomic<int64_t> live_allocs{0};
+        std::atomic<uint64_t> total_allocs{0};
+    };
+
+    static OrchMem &Instance();
+
+    /* Find or create the counters published under the given scope name */
+    Counters *scope(const std::string &name);
+
+    /* Charge/release one allocation against the active scope. Called from
+     * the allocation hooks, so these must not allocate themselves. */
+    static void accountAlloc(size_t bytes);
+    static void accountFree(size_t bytes);
+
+    /* Publish the per-scope counters if the flush interval has elapsed */
+    void flush();
+
+    /* Scope the current thread's allocations are charged to */
+    static thread_local Counters *t_current;
+
+private:
+    OrchMem() = default;
+    OrchMem(const OrchMem &) = delete;
+    OrchMem &operator=(const OrchMem &) = delete;
+
+    std::unordered_map<std::string, std::unique_ptr<Counters>> m_scopes;
+    std::mutex m_mutex;
+    std::chrono::steady_clock::time_point m_lastFlush = std::chrono::steady_clock::now();
+
+    std::unique_ptr<swss::DBConnector> m_stateDb;
+    std::unique_ptr<swss::Table> m_table;
+};
+
+/* RAII helper: allocations made while alive are charged to `counters` */
+class OrchMemScope
+{
+public:
+    OrchMemScope(OrchMem::Counters *counters) :
+        m_prev(OrchMem::t_current)
+    {
+        OrchMem::t_current = counters;
+    }
+
+    ~OrchMemScope()
+    {
+        OrchMem::t_current = m_prev;
+    }
+
+private:
+    OrchMem::Counters *m_prev;
+};
+
+#endif /* SWSS_ORCHMEM_H */
@@ -0,0 +1,80 @@
+/*
+ * Process-wide allocation hooks feeding OrchMem. Kept in their own
+ * translation unit and linked into the orchagent binary only, so test
+ * binaries that install their own counting operator new do not collide.
+ *
+ * malloc_usable_size() is used on both sides of the ledger, so frees
+ * balance allocations exactly regardless of which delete overload fires.
+ */
+#include <malloc.h>
+
+#include <cstdlib>
+#include <new>
+
+#include "orchmem.h"
+
+void *operator new(size_t size)
+{
+    void *p = malloc(size);
+    if (p == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    OrchMem::accountAlloc(malloc_usable_size(p));
+    return p;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    void *p = malloc(size);
+    if (p != NULL)
+    {
+        OrchMem::accountAlloc(malloc_usable_size(p));
+    }
+    return p;
+}
+
+void *operator new[](size_t size, const std::nothrow_t &tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void *p) noexcept
+{
+    if (p == NULL)
+    {
+        return;
+    }
+    OrchMem::accountFree(malloc_usable_size(p));
+    free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    operator delete(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    operator delete(p);
+}
+
+void operator delete[](void *p, size_t) noexcept
+{
+    operator delete(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept
+{
+    operator delete(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept
+{
+    operator delete(p);
+}
@@ -0,0 +1,96 @@
+#include "orchperf.h"
+
+#include <vector>
+
+#include "logger.h"
+
+using namespace std;
+using namespace swss;
+
+constexpr size_t OrchPerf::NUM_BUCKETS;
+constexpr long OrchPerf::FLUSH_INTERVAL_SECS;
+
+OrchPerf &OrchPerf::Instance()
+{
+    static OrchPerf perf;
+    return perf;
+}
+
+void OrchPerf::record(const string &name, uint64_t usecs)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    auto &histogram = m_stats[name];
+
+    size_t bucket = 0;
+    while (bucket < NUM_BUCKETS && (1ULL << bucket) <= usecs)
+    {
+        bucket++;
+    }
+    histogram.buckets[bucket]++;
+
+    histogram.count++;
+    histogram.sum_usecs += usecs;
+    if (usecs > histogram.max_usecs)
+    {
+        histogram.max_usecs = usecs;
+    }
+}
+
+void OrchPerf::flush()
+{
+    unordered_map<string, Histogram> snapshot;
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+
+        auto now = chrono::steady_clock::now();
+        if (chrono::duration_cast<chrono::seconds>(now - m_lastFlush).count() < FLUSH_INTERVAL_SECS)
+        {
+            return;
+        }
+        m_lastFlush = now;
+
+        if (m_stats.empty())
+        {
+            return;
+        }
+        snapshot.swap(m_stats);
+    }
+
+    /* The DB handle is created lazily so OrchPerf can be used before redis
+     * is reachable (e.g. in unit tests that never flush) */
+    if (!m_table)
+    {
+        m_stateDb = unique_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
+        m_table = unique_ptr<Table>(new Table(m_stateDb.get(), ORCH_PERF_TABLE));
+    }
+
+    for (const auto &it : snapshot)
+    {
+        const auto &histogram = it.second;
+
+        string buckets;
+        for (size_t i = 0; i <= NUM_BUCKETS; i++)
+        {
+            if (i > 0)
+            {
+                buckets += ',';
+            }
+            buckets += to_string(histogram.buckets[i]);
+        }
+
+        vector<FieldValueTuple> fvs = {
+            { "count", to_string(histogram.count) },
+            { "sum_usecs", to_string(histogram.sum_usecs) },
+            { "max_usecs", to_string(histogram.max_usecs) },
+            { "avg_usecs", to_string(histogram.count ? histogram.sum_usecs / histogram.count : 0) },
+            /* bucket i counts invocations shorter than 2^i microseconds;
+             * the final bucket is the overflow */
+            { "buckets_usecs_pow2", buckets },
+        };
+        m_table->set(it.first, fvs);
+    }
+
+    SWSS_LOG_INFO("Published doTask latency histograms for %zu executors", snapshot.size());
+}
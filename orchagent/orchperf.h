@@ -0,0 +1,82 @@
+#ifndef SWSS_ORCHPERF_H
+#define SWSS_ORCHPERF_H
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "dbconnector.h"
+#include "table.h"
+
+#define ORCH_PERF_TABLE "ORCH_DOTASK_HISTOGRAM"
+
+/*
+ * OrchPerf collects doTask() latency histograms per executor (keyed by the
+ * consumer table name, so RouteOrch shows up as ROUTE_TABLE, AclOrch as
+ * ACL_RULE, etc.) and periodically publishes them to STATE_DB under
+ * ORCH_DOTASK_HISTOGRAM. Buckets are powers of two in microseconds, which
+ * keeps record() to two clock reads and a couple of increments on the hot
+ * path. Recording happens from the select loop, the ring thread and the
+ * scheduler workers, so the stats map is guarded by a mutex; the lock is
+ * uncontended except when a flush coincides with a drain.
+ */
+class OrchPerf
+{
+public:
+    static constexpr size_t NUM_BUCKETS = 20;       /* 1us .. ~0.5s, then overflow */
+    static constexpr long FLUSH_INTERVAL_SECS = 60;
+
+    static OrchPerf &Instance();
+
+    /* Record one doTask() invocation of duration usecs for the named executor */
+    void record(const std::string &name, uint64_t usecs);
+
+    /* Publish and reset the histograms if the flush interval has elapsed */
+    void flush();
+
+private:
+    OrchPerf() = default;
+    OrchPerf(const OrchPerf &) = delete;
+    OrchPerf &operator=(const OrchPerf &) = delete;
+
+    struct Histogram
+    {
+        uint64_t buckets[NUM_BUCKETS + 1] = {};
+        uint64_t count = 0;
+        uint64_t sum_usecs = 0;
+        uint64_t max_usecs = 0;
+    };
+
+    std::unordered_map<std::string, Histogram> m_stats;
+    std::mutex m_mutex;
+    std::chrono::steady_clock::time_point m_lastFlush = std::chrono::steady_clock::now();
+
+    std::unique_ptr<swss::DBConnector> m_stateDb;
+    std::unique_ptr<swss::Table> m_table;
+};
+
+/* RAII helper timing one doTask() invocation on the hot path */
+class OrchPerfTimer
+{
+public:
+    OrchPerfTimer(const std::string &name) :
+        m_name(name),
+        m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~OrchPerfTimer()
+    {
+        auto usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - m_start).count();
+        OrchPerf::Instance().record(m_name, static_cast<uint64_t>(usecs));
+    }
+
+private:
+    const std::string &m_name;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+#endif /* SWSS_ORCHPERF_H */
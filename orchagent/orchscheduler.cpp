@@ -0,0 +1,156 @@
+#include "orchscheduler.h"
+#include "logger.h"
+
+using namespace std;
+
+OrchScheduler::OrchScheduler(size_t numWorkers)
+{
+    SWSS_LOG_ENTER();
+
+    if (numWorkers == 0)
+    {
+        numWorkers = 1;
+    }
+
+    for (size_t i = 0; i < numWorkers; i++)
+    {
+        m_workers.emplace_back(&OrchScheduler::workerLoop, this);
+    }
+
+    SWSS_LOG_NOTICE("OrchScheduler started with %zu workers", numWorkers);
+}
+
+OrchScheduler::~OrchScheduler()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_taskPending.notify_all();
+
+    for (auto &worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void OrchScheduler::addDependency(Orch *dependent, Orch *dependency)
+{
+    SWSS_LOG_ENTER();
+
+    if (dependent == nullptr || dependency == nullptr || dependent == dependency)
+    {
+        return;
+    }
+
+    m_edges.emplace_back(dependent, dependency);
+}
+
+size_t OrchScheduler::rootOf(size_t idx)
+{
+    while (m_parent[idx] != idx)
+    {
+        /* Path halving keeps the find nearly O(1) over repeated lookups */
+        m_parent[idx] = m_parent[m_parent[idx]];
+        idx = m_parent[idx];
+    }
+    return idx;
+}
+
+void OrchScheduler::buildGroups(const vector<Orch *> &orchList)
+{
+    SWSS_LOG_ENTER();
+
+    m_orchIndex.clear();
+    m_parent.resize(orchList.size());
+    for (size_t i = 0; i < orchList.size(); i++)
+    {
+        m_orchIndex[orchList[i]] = i;
+        m_parent[i] = i;
+    }
+
+    for (const auto &edge : m_edges)
+    {
+        auto first = m_orchIndex.find(edge.first);
+        auto second = m_orchIndex.find(edge.second);
+        if (first == m_orchIndex.end() || second == m_orchIndex.end())
+        {
+            /* An edge may name an Orch that is not instantiated on this
+             * platform (e.g. DTelOrch); it simply constrains nothing. */
+            continue;
+        }
+        m_parent[rootOf(first->second)] = rootOf(second->second);
+    }
+
+    /* Collect components; iterating in index order preserves the relative
+     * m_orchList order inside each serialized group. */
+    map<size_t, size_t> rootToGroup;
+    m_groups.clear();
+    for (size_t i = 0; i < orchList.size(); i++)
+    {
+        size_t root = rootOf(i);
+        auto it = rootToGroup.find(root);
+        if (it == rootToGroup.end())
+        {
+            it = rootToGroup.emplace(root, m_groups.size()).first;
+            m_groups.emplace_back();
+        }
+        m_groups[it->second].push_back(orchList[i]);
+    }
+
+    SWSS_LOG_NOTICE("OrchScheduler partitioned %zu orchs into %zu execution groups",
+                    orchList.size(), m_groups.size());
+}
+
+void OrchScheduler::runAll()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        unique_lock<mutex> lock(m_mutex);
+        for (auto &group : m_groups)
+        {
+            m_tasksInFlight++;
+            m_taskQueue.push([&group]() {
+                for (Orch *o : group)
+                {
+                    o->doTask();
+                }
+            });
+        }
+    }
+    m_taskPending.notify_all();
+
+    unique_lock<mutex> lock(m_mutex);
+    m_taskDone.wait(lock, [&]() { return m_tasksInFlight == 0; });
+}
+
+void OrchScheduler::workerLoop()
+{
+    SWSS_LOG_ENTER();
+
+    while (true)
+    {
+        function<void()> task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_taskPending.wait(lock, [&]() { return m_shutdown || !m_taskQueue.empty(); });
+            if (m_shutdown && m_taskQueue.empty())
+            {
+                return;
+            }
+            task = move(m_taskQueue.front());
+            m_taskQueue.pop();
+        }
+
+        task();
+
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_tasksInFlight--;
+        }
+        m_taskDone.notify_all();
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef SWSS_ORCHSCHEDULER_H
+#define SWSS_ORCHSCHEDULER_H
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "orch.h"
+
+/*
+ * OrchScheduler drives the periodic doTask() sweep over all Orchs on a
+ * worker pool instead of the single select thread.
+ *
+ * A static dependency graph is declared once after all Orchs are
+ * constructed (e.g. RouteOrch depends on NeighOrch and IntfsOrch).
+ * Orchs connected through dependency edges are collapsed into one
+ * execution group and stay strictly serialized, in the same relative
+ * order they hold in OrchDaemon::m_orchList. Orchs with no path between
+ * them land in different groups, and independent groups are dispatched
+ * onto the worker pool concurrently. runAll() returns only after every
+ * group has finished its sweep, so the select loop observes the same
+ * "all Orchs drained" semantics as the serial loop.
+ *
+ * Orchs that share mutable state outside the SAI/redis pipeline must be
+ * connected with an edge even if they never resolve references from one
+ * another; an undeclared dependency means an undeclared data race.
+ */
+class OrchScheduler
+{
+public:
+    OrchScheduler(size_t numWorkers = std::thread::hardware_concurrency());
+    ~OrchScheduler();
+
+    // Disable copying: the scheduler owns its worker threads
+    OrchScheduler(const OrchScheduler &) = delete;
+    OrchScheduler &operator=(const OrchScheduler &) = delete;
+
+    /* Declare that dependent must never run concurrently with dependency */
+    void addDependency(Orch *dependent, Orch *dependency);
+
+    /*
+     * Partition the Orch list into serialized execution groups using the
+     * declared dependency edges. Must be called once, after all
+     * addDependency() calls and before the first runAll().
+     */
+    void buildGroups(const std::vector<Orch *> &orchList);
+
+    /* Run one doTask() sweep over all groups and wait for completion */
+    void runAll();
+
+private:
+    void workerLoop();
+    size_t rootOf(size_t idx);
+
+    std::vector<std::thread> m_workers;
+    std::vector<std::vector<Orch *>> m_groups;
+
+    /* Union-find parent per m_orchList index, valid during buildGroups() */
+    std::vector<size_t> m_parent;
+    std::map<Orch *, size_t> m_orchIndex;
+    std::vector<std::pair<Orch *, Orch *>> m_edges;
+
+    std::queue<std::function<void()>> m_taskQueue;
+    std::mutex m_mutex;
+    std::condition_variable m_taskPending;
+    std::condition_variable m_taskDone;
+    size_t m_tasksInFlight = 0;
+    bool m_shutdown = false;
+};
+
+#endif /* SWSS_ORCHSCHEDULER_H */
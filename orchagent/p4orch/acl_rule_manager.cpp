@@ -1993,6 +1993,7 @@ ReturnCode AclRuleManager::processAddRuleRequest(const std::string &acl_rule_key
     acl_rule.priority = app_db_entry.priority;
     acl_rule.acl_rule_key = acl_rule_key;
     acl_rule.p4_action = app_db_entry.action;
+    acl_rule.action_param_fvs = app_db_entry.action_param_fvs;
     acl_rule.db_key = app_db_entry.db_key;
     const auto *acl_table = gP4Orch->getAclTableManager()->getAclTable(app_db_entry.acl_table_name);
     acl_rule.acl_table_oid = acl_table->table_oid;
@@ -2118,8 +2119,45 @@ ReturnCode AclRuleManager::processUpdateRuleRequest(
 {
     SWSS_LOG_ENTER();
 
-    P4AclRule acl_rule{};
     const auto *acl_table = gP4Orch->getAclTableManager()->getAclTable(app_db_entry.acl_table_name);
+
+    // Telemetry-driven meter retuning rewrites rules at a high rate with
+    // identical match and action content. When the cached rule differs only
+    // in its meter configuration and the policer already exists, update the
+    // policer directly and skip action re-translation and the ACL entry
+    // attribute diff.
+    if (old_acl_rule.meter.meter_oid != SAI_NULL_OBJECT_ID && app_db_entry.meter.enabled &&
+        app_db_entry.action == old_acl_rule.p4_action &&
+        app_db_entry.action_param_fvs == old_acl_rule.action_param_fvs)
+    {
+        P4AclMeter new_meter;
+        LOG_AND_RETURN_IF_ERROR(setMeterValue(acl_table, app_db_entry, new_meter));
+        if (new_meter.mode != old_acl_rule.meter.mode)
+        {
+            // TODO: SAI_POLICER_ATTR_MODE is CREATE_ONLY
+            LOG_ERROR_AND_RETURN(ReturnCode(StatusCode::SWSS_RC_UNIMPLEMENTED)
+                                 << "Updating ACL rule meter mode is not supported for ACL entry: "
+                                 << QuotedVar(old_acl_rule.acl_rule_key) << " in table "
+                                 << QuotedVar(old_acl_rule.acl_table_name));
+        }
+        if (new_meter != old_acl_rule.meter)
+        {
+            auto meter_status = updateAclMeter(new_meter, old_acl_rule.meter);
+            if (!meter_status.ok())
+            {
+                SWSS_LOG_ERROR("Failed to update ACL meter for rule %s",
+                               QuotedVar(old_acl_rule.acl_rule_key).c_str());
+                return meter_status;
+            }
+            new_meter.meter_oid = old_acl_rule.meter.meter_oid;
+            new_meter.policer_label = old_acl_rule.meter.policer_label;
+            old_acl_rule.meter = new_meter;
+        }
+        old_acl_rule.db_key = app_db_entry.db_key;
+        return ReturnCode();
+    }
+
+    P4AclRule acl_rule{};
     acl_rule.acl_table_oid = acl_table->table_oid;
     acl_rule.acl_table_name = acl_table->acl_table_name;
     acl_rule.db_key = app_db_entry.db_key;
@@ -2139,6 +2177,7 @@ ReturnCode AclRuleManager::processUpdateRuleRequest(
 
     // Update action field
     acl_rule.p4_action = app_db_entry.action;
+    acl_rule.action_param_fvs = app_db_entry.action_param_fvs;
     acl_rule.acl_entry_oid = old_acl_rule.acl_entry_oid;
     auto set_actions_rc = setAllActionFieldValues(app_db_entry, acl_table, acl_rule);
     if (!set_actions_rc.ok())
@@ -134,6 +134,9 @@ struct P4AclRule
 
     sai_uint32_t priority;
     std::string p4_action;
+    // Raw action parameters from APP_DB, kept so meter-only updates can be
+    // recognized without re-translating the action.
+    std::map<std::string, std::string> action_param_fvs;
     std::map<sai_acl_entry_attr_t, sai_attribute_value_t> match_fvs;
     std::map<sai_acl_entry_attr_t, sai_attribute_value_t> action_fvs;
     P4AclMeter meter;
@@ -250,7 +250,12 @@ ReturnCodeOr<P4ExtTableAppDbEntry> ExtTablesManager::deserializeP4ExtTableEntry(
 ReturnCode ExtTablesManager::prepareP4SaiExtAPIParams(const P4ExtTableAppDbEntry &app_db_entry,
                                                       std::string &ext_table_entry_attr)
 {
-    nlohmann::json sai_j, sai_metadata_j, sai_array_j = {}, sai_entry_j;
+    nlohmann::json sai_j, sai_array_j = {}, sai_entry_j;
+    // Metadata fragments are compiled once per table at schema ingest (see
+    // parseTablesInfo) and for OID references below; encoding an entry only
+    // places its values into the precompiled layout.
+    static const nlohmann::json oid_metadata_j =
+        nlohmann::json::object({{"sai_attr_value_type", "SAI_ATTR_VALUE_TYPE_OBJECT_ID"}});
 
     SWSS_LOG_ENTER();
 
@@ -306,12 +311,9 @@ ReturnCode ExtTablesManager::prepareP4SaiExtAPIParams(const P4ExtTableAppDbEntry
                        << "extension entry for invalid match field " << match.c_str();
             }
 
-            sai_metadata_j = nlohmann::json::object({});
-            sai_metadata_j["sai_attr_value_type"] = match_defn_it->second.datatype;
-
             sai_j = nlohmann::json::object({});
             sai_j[match]["value"] = value;
-            sai_j[match]["sai_metadata"] = sai_metadata_j;
+            sai_j[match]["sai_metadata"] = match_defn_it->second.sai_metadata;
 
             sai_array_j.push_back(sai_j);
         }
@@ -333,10 +335,7 @@ ReturnCode ExtTablesManager::prepareP4SaiExtAPIParams(const P4ExtTableAppDbEntry
                         auto param_defn_it = action_defn_it->second.params.find(app_db_param_it->first);
                         if (param_defn_it != action_defn_it->second.params.end())
                         {
-                            sai_metadata_j = nlohmann::json::object({});
-                            sai_metadata_j["sai_attr_value_type"] = param_defn_it->second.datatype;
-
-                            params_j[app_db_param_it->first]["sai_metadata"] = sai_metadata_j;
+                            params_j[app_db_param_it->first]["sai_metadata"] = param_defn_it->second.sai_metadata;
                         }
                     }
                     params_j[app_db_param_it->first]["value"] = app_db_param_it->second;
@@ -347,10 +346,7 @@ ReturnCode ExtTablesManager::prepareP4SaiExtAPIParams(const P4ExtTableAppDbEntry
             {
                 auto action_dep_object = action_dep_object_it->second;
 
-                sai_metadata_j = nlohmann::json::object({});
-                sai_metadata_j["sai_attr_value_type"] = "SAI_ATTR_VALUE_TYPE_OBJECT_ID";
-
-                sai_j[app_db_action_it->first]["sai_metadata"] = sai_metadata_j;
+                sai_j[app_db_action_it->first]["sai_metadata"] = oid_metadata_j;
                 sai_j[app_db_action_it->first]["value"] = action_dep_object.oid;
             }
 
@@ -365,7 +361,7 @@ ReturnCode ExtTablesManager::prepareP4SaiExtAPIParams(const P4ExtTableAppDbEntry
 
     sai_entry_j = nlohmann::json::object({});
     sai_entry_j.push_back(nlohmann::json::object_t::value_type("attributes", sai_array_j));
-    SWSS_LOG_ERROR("table: %s, sai entry: %s", app_db_entry.table_name.c_str(), sai_entry_j.dump().c_str());
+    SWSS_LOG_INFO("table: %s, sai entry: %s", app_db_entry.table_name.c_str(), sai_entry_j.dump().c_str());
     ext_table_entry_attr = sai_entry_j.dump();
 
     return ReturnCode();
@@ -22,13 +22,13 @@ bool P4OidMapper::setOID(_In_ sai_object_type_t object_type, _In_ const std::str
 {
     SWSS_LOG_ENTER();
 
-    if (m_oidTables[object_type].find(key) != m_oidTables[object_type].end())
+    auto rc = m_oidTables[object_type].emplace(key, MapperEntry{oid, ref_count});
+    if (!rc.second)
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d already exists in centralized mapper", key.c_str(), object_type);
         return false;
     }
 
-    m_oidTables[object_type][key] = {oid, ref_count};
     return true;
 }
 
@@ -43,13 +43,14 @@ bool P4OidMapper::getOID(_In_ sai_object_type_t object_type, _In_ const std::str
         return false;
     }
 
-    if (m_oidTables[object_type].find(key) == m_oidTables[object_type].end())
+    auto it = m_oidTables[object_type].find(key);
+    if (it == m_oidTables[object_type].end())
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d does not exist in centralized mapper", key.c_str(), object_type);
         return false;
     }
 
-    *oid = m_oidTables[object_type].at(key).sai_oid;
+    *oid = it->second.sai_oid;
     return true;
 }
 
@@ -64,7 +65,8 @@ bool P4OidMapper::getRefCount(_In_ sai_object_type_t object_type, _In_ const std
         return false;
     }
 
-    if (m_oidTables[object_type].find(key) == m_oidTables[object_type].end())
+    auto it = m_oidTables[object_type].find(key);
+    if (it == m_oidTables[object_type].end())
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d does not exist in "
                        "centralized mapper",
@@ -72,7 +74,7 @@ bool P4OidMapper::getRefCount(_In_ sai_object_type_t object_type, _In_ const std
         return false;
     }
 
-    *ref_count = m_oidTables[object_type].at(key).ref_count;
+    *ref_count = it->second.ref_count;
     return true;
 }
 
@@ -80,7 +82,8 @@ bool P4OidMapper::eraseOID(_In_ sai_object_type_t object_type, _In_ const std::s
 {
     SWSS_LOG_ENTER();
 
-    if (m_oidTables[object_type].find(key) == m_oidTables[object_type].end())
+    auto it = m_oidTables[object_type].find(key);
+    if (it == m_oidTables[object_type].end())
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d does not exist in "
                        "centralized mapper",
@@ -88,7 +91,7 @@ bool P4OidMapper::eraseOID(_In_ sai_object_type_t object_type, _In_ const std::s
         return false;
     }
 
-    if (m_oidTables[object_type][key].ref_count != 0)
+    if (it->second.ref_count != 0)
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d has non-zero reference count in "
                        "centralized mapper",
@@ -96,7 +99,7 @@ bool P4OidMapper::eraseOID(_In_ sai_object_type_t object_type, _In_ const std::s
         return false;
     }
 
-    m_oidTables[object_type].erase(key);
+    m_oidTables[object_type].erase(it);
     return true;
 }
 
@@ -125,7 +128,8 @@ bool P4OidMapper::increaseRefCount(_In_ sai_object_type_t object_type, _In_ cons
 {
     SWSS_LOG_ENTER();
 
-    if (m_oidTables[object_type].find(key) == m_oidTables[object_type].end())
+    auto it = m_oidTables[object_type].find(key);
+    if (it == m_oidTables[object_type].end())
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d does not exist in "
                        "centralized mapper",
@@ -133,15 +137,15 @@ bool P4OidMapper::increaseRefCount(_In_ sai_object_type_t object_type, _In_ cons
         return false;
     }
 
-    if (m_oidTables[object_type][key].ref_count == std::numeric_limits<uint32_t>::max())
+    if (it->second.ref_count == std::numeric_limits<uint32_t>::max())
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d reached maximum ref_count %u in "
                        "centralized mapper",
-                       key.c_str(), object_type, m_oidTables[object_type][key].ref_count);
+                       key.c_str(), object_type, it->second.ref_count);
         return false;
     }
 
-    m_oidTables[object_type][key].ref_count++;
+    it->second.ref_count++;
     return true;
 }
 
@@ -149,7 +153,8 @@ bool P4OidMapper::decreaseRefCount(_In_ sai_object_type_t object_type, _In_ cons
 {
     SWSS_LOG_ENTER();
 
-    if (m_oidTables[object_type].find(key) == m_oidTables[object_type].end())
+    auto it = m_oidTables[object_type].find(key);
+    if (it == m_oidTables[object_type].end())
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d does not exist in "
                        "centralized mapper",
@@ -157,7 +162,7 @@ bool P4OidMapper::decreaseRefCount(_In_ sai_object_type_t object_type, _In_ cons
         return false;
     }
 
-    if (m_oidTables[object_type][key].ref_count == 0)
+    if (it->second.ref_count == 0)
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d reached zero ref_count in "
                        "centralized mapper",
@@ -165,7 +170,7 @@ bool P4OidMapper::decreaseRefCount(_In_ sai_object_type_t object_type, _In_ cons
         return false;
     }
 
-    m_oidTables[object_type][key].ref_count--;
+    it->second.ref_count--;
     return true;
 }
 
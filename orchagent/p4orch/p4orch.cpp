@@ -158,7 +158,6 @@ void P4Orch::doTask(ConsumerBase &consumer)
     }   
 
     std::string prev_op = "";
-    ObjectManagerInterface* prev_manager = nullptr;
     std::string p4rt_table_name;
     ReturnCode status;
     for (const auto& kco : zmq_consumer->m_queue) {
@@ -182,30 +181,30 @@ void P4Orch::doTask(ConsumerBase &consumer)
     if (prev_op.empty()) {
       prev_op = op;
     }
-    if (prev_manager == nullptr) {
-      prev_manager = manager;
-    }
 
-        // Call drain after grouping the same type of requests together.
-    if (op != prev_op || prev_manager != manager) {
-      status = prev_manager->drain();
-            prev_op = op; 
-      prev_manager = manager;
+    // Requests with the same operation accumulate in their managers and are
+    // drained together when the operation flips. Manager dependency order is
+    // decided by precedence at drain time, so a tunnel and its next hop
+    // arriving in the same batch are programmed in one pass -- in whichever
+    // order the controller sent them -- and each manager keeps a full batch
+    // for its bulk SAI call instead of draining on every table transition.
+    if (op != prev_op) {
+      status = drainManagers(/*reverse=*/prev_op == DEL_COMMAND);
+            prev_op = op;
         }
 
         if (status.ok()) {
-      prev_manager->enqueue(p4rt_table_name, kco);
+      manager->enqueue(p4rt_table_name, kco);
         } else {
            m_publisher.publish(APP_P4RT_TABLE_NAME, kfvKey(kco),
                                kfvFieldsValues(kco),
                                ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED),
                                /*replace=*/true);
-      prev_manager = nullptr;
         }
     }
-  if (prev_manager != nullptr) {
-    prev_manager->drain();
-    }   
+  if (!prev_op.empty() && status.ok()) {
+    drainManagers(/*reverse=*/prev_op == DEL_COMMAND);
+    }
     m_publisher.flush();
     zmq_consumer->m_queue.clear();
 }
@@ -264,8 +263,18 @@ void P4Orch::enqueue(const swss::KeyOpFieldsValuesTuple& entry) {
 }
 
 ReturnCode P4Orch::drain() {
+  return drainManagers(/*reverse=*/false);
+}
+
+ReturnCode P4Orch::drainManagers(bool reverse) {
+  // Creations drain in add precedence so dependencies exist before their
+  // dependents; deletions drain in the reverse order so referencing objects
+  // go away before the objects they reference.
   ReturnCode status;
-  for (const auto& manager : m_p4ManagerAddPrecedence) {
+  for (size_t i = 0; i < m_p4ManagerAddPrecedence.size(); ++i) {
+    auto* manager =
+        reverse ? m_p4ManagerAddPrecedence[m_p4ManagerAddPrecedence.size() - 1 - i]
+                : m_p4ManagerAddPrecedence[i];
     if (status.ok()) {
       status = manager->drain();
     } else {
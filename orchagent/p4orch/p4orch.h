@@ -72,6 +72,7 @@ class P4Orch : public ZmqOrch
                                         std::string& table_name);
     void enqueue(const swss::KeyOpFieldsValuesTuple& entry);
     ReturnCode drain();
+    ReturnCode drainManagers(bool reverse);
     void handlePortStatusChangeNotification(const std::string &op, const std::string &data);
 
     // P4 object manager request processing order.
@@ -3,6 +3,7 @@
 #include <deque>
 #include <iomanip>
 #include <map>
+#include <nlohmann/json.hpp>
 #include <set>
 #include <sstream>
 #include <string>
@@ -146,6 +147,9 @@ struct ActionParamInfo
     std::string name;
     std::string fieldtype;
     std::string datatype;
+    // "sai_metadata" fragment compiled from datatype at schema ingest; entry
+    // encoding copies it instead of rebuilding it per entry.
+    nlohmann::json sai_metadata;
     std::unordered_map<std::string, std::string> table_reference_map;
 };
 
@@ -161,6 +165,8 @@ struct TableMatchInfo
     std::string name;
     std::string fieldtype;
     std::string datatype;
+    // "sai_metadata" fragment compiled from datatype at schema ingest.
+    nlohmann::json sai_metadata;
     std::unordered_map<std::string, std::string> table_reference_map;
 };
 
@@ -4,6 +4,7 @@
 #include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -626,6 +627,25 @@ std::vector<ReturnCode> RouteManager::createRouteEntries(const std::vector<P4Rou
     std::vector<sai_status_t> object_statuses(route_entries.size());
     std::vector<ReturnCode> statuses(route_entries.size());
 
+    // Nexthop and WCMP group ids repeat heavily across a route batch. Resolve
+    // each distinct id once per call instead of regenerating the mapper key
+    // string and re-querying the mapper for every route.
+    std::unordered_map<std::string, sai_object_id_t> nexthop_oids;
+    std::unordered_map<std::string, sai_object_id_t> wcmp_group_oids;
+    auto resolveNexthopOid = [&](const P4RouteEntry &entry) {
+        bool is_wcmp = (entry.action == p4orch::kSetWcmpGroupId || entry.action == p4orch::kSetWcmpGroupIdAndMetadata);
+        auto &cache = is_wcmp ? wcmp_group_oids : nexthop_oids;
+        const auto &id = is_wcmp ? entry.wcmp_group : entry.nexthop_id;
+        auto it = cache.find(id);
+        if (it != cache.end())
+        {
+            return it->second;
+        }
+        auto oid = getNexthopOid(entry, *m_p4OidMapper);
+        cache.emplace(id, oid);
+        return oid;
+    };
+
     for (size_t i = 0; i < route_entries.size(); ++i)
     {
         const auto &route_entry = route_entries[i];
@@ -653,7 +673,7 @@ std::vector<ReturnCode> RouteManager::createRouteEntries(const std::vector<P4Rou
         {
             // Default SAI_ROUTE_ATTR_PACKET_ACTION is SAI_PACKET_ACTION_FORWARD.
             sai_attrs[2 * i].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
-            sai_attrs[2 * i].value.oid = getNexthopOid(route_entry, *m_p4OidMapper);
+            sai_attrs[2 * i].value.oid = resolveNexthopOid(route_entry);
             if (route_entry.action == p4orch::kSetNexthopIdAndMetadata ||
                 route_entry.action == p4orch::kSetWcmpGroupIdAndMetadata)
             {
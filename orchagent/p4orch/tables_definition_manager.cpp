@@ -151,6 +151,7 @@ ReturnCode parseTableActionParams(const nlohmann::json &action_json, ActionInfo
                 param.name = param_name;
                 param.datatype = parseBitwidthToDatatype(param_json);
                 param.datatype = parseFormatToDatatype(param_json, param.datatype);
+                param.sai_metadata = nlohmann::json::object({{"sai_attr_value_type", param.datatype}});
                 parseActionParamReferences(param_json, param);
                 action.params[param_name] = param;
 
@@ -237,6 +238,7 @@ ReturnCode parseTablesInfo(const nlohmann::json &info_json, TablesInfo &info_ent
                 match.name = match_name;
                 match.datatype = parseBitwidthToDatatype(match_json);
                 match.datatype = parseFormatToDatatype(match_json, match.datatype);
+                match.sai_metadata = nlohmann::json::object({{"sai_attr_value_type", match.datatype}});
                 parseTableMatchReferences(match_json, match);
                 table.match_fields[match_name] = match;
             }
@@ -3,6 +3,7 @@
 #include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "SaiAttributeList.h"
@@ -403,59 +404,90 @@ std::vector<ReturnCode> WcmpManager::updateWcmpGroups(
     std::vector<P4WcmpGroupEntry>& entries) {
   SWSS_LOG_ENTER();
 
-  // Each group update will have two SAI attrs:
+  // Each group update carries at most two SAI attrs:
   // SAI_NEXT_HOP_GROUP_ATTR_NEXT_HOP_LIST and
   // SAI_NEXT_HOP_GROUP_ATTR_NEXT_HOP_MEMBER_WEIGHT_LIST.
+  // An attr whose value matches what is already programmed is not re-sent,
+  // so a pure weight rebalance updates only the weight list and a no-op
+  // update skips the SAI call altogether.
   std::vector<P4WcmpGroupEntry*> old_entries(entries.size());
-  std::vector<sai_attribute_t> sai_attr(2 * entries.size());
-  std::vector<sai_object_id_t> oids(2 * entries.size());
-  std::vector<sai_status_t> object_statuses(2 * entries.size());
+  std::vector<sai_attribute_t> sai_attr;
+  std::vector<sai_object_id_t> oids;
+  std::vector<size_t> attr_counts(entries.size(), 0);
   std::vector<ReturnCode> statuses(entries.size());
 
   for (size_t i = 0; i < entries.size(); ++i) {
     old_entries[i] = getWcmpGroupEntry(entries[i].wcmp_group_id);
     entries[i].wcmp_group_oid = old_entries[i]->wcmp_group_oid;
-    oids[2 * i] = old_entries[i]->wcmp_group_oid;
-    oids[2 * i + 1] = old_entries[i]->wcmp_group_oid;
     auto attrs = prepareSaiGroupAttrs(entries[i], /*update=*/true);
-    sai_attr[2 * i] = attrs[0];
-    sai_attr[2 * i + 1] = attrs[1];
+    if (entries[i].nexthop_ids != old_entries[i]->nexthop_ids) {
+      oids.push_back(entries[i].wcmp_group_oid);
+      sai_attr.push_back(attrs[0]);
+      attr_counts[i]++;
+    }
+    if (entries[i].nexthop_weights != old_entries[i]->nexthop_weights) {
+      oids.push_back(entries[i].wcmp_group_oid);
+      sai_attr.push_back(attrs[1]);
+      attr_counts[i]++;
+    }
+  }
+  std::vector<sai_status_t> object_statuses(sai_attr.size(),
+                                            SAI_STATUS_SUCCESS);
+  if (!sai_attr.empty()) {
+    // This SAI operation is assumed to be atomic.
+    sai_next_hop_group_api->set_next_hop_groups_attribute(
+        static_cast<uint32_t>(sai_attr.size()), oids.data(), sai_attr.data(),
+        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, object_statuses.data());
   }
-  // This SAI operation is assumed to be atomic.
-  sai_next_hop_group_api->set_next_hop_groups_attribute(
-      static_cast<uint32_t>(sai_attr.size()), oids.data(), sai_attr.data(),
-      SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, object_statuses.data());
 
+  size_t attr_idx = 0;
   for (size_t i = 0; i < entries.size(); ++i) {
-    CHECK_ERROR_AND_LOG(object_statuses[2 * i + 1],
+    sai_status_t object_status = SAI_STATUS_SUCCESS;
+    for (size_t j = 0; j < attr_counts[i]; ++j) {
+      if (object_statuses[attr_idx + j] != SAI_STATUS_SUCCESS) {
+        object_status = object_statuses[attr_idx + j];
+      }
+    }
+    attr_idx += attr_counts[i];
+    CHECK_ERROR_AND_LOG(object_status,
                         "Failed to update WCMP group with id "
                             << QuotedVar(entries[i].wcmp_group_id));
 
-    if (object_statuses[2 * i + 1] == SAI_STATUS_SUCCESS) {
+    if (object_status == SAI_STATUS_SUCCESS) {
+      // Members present in both the old and the new group keep their nexthop
+      // reference; only the membership delta touches the mapper and the CRM
+      // counters.
+      std::unordered_map<std::string, int> member_delta;
       for (auto& member : old_entries[i]->wcmp_group_members) {
-        const std::string& next_hop_key =
-            KeyGenerator::generateNextHopKey(member->next_hop_id);
-        gCrmOrch->decCrmResUsedCounter(
-            CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
-        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_NEXT_HOP, next_hop_key);
+        member_delta[KeyGenerator::generateNextHopKey(member->next_hop_id)]--;
         if (!member->watch_port.empty()) {
           removeMemberFromPortNameToWcmpGroupMemberMap(member);
         }
       }
       for (auto& member : entries[i].wcmp_group_members) {
-        const std::string& next_hop_key =
-            KeyGenerator::generateNextHopKey(member->next_hop_id);
-        gCrmOrch->incCrmResUsedCounter(
-            CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
-        m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_NEXT_HOP, next_hop_key);
+        member_delta[KeyGenerator::generateNextHopKey(member->next_hop_id)]++;
         if (!member->watch_port.empty()) {
           insertMemberInPortNameToWcmpGroupMemberMap(member);
         }
       }
+      for (const auto& delta : member_delta) {
+        for (int j = 0; j < delta.second; ++j) {
+          gCrmOrch->incCrmResUsedCounter(
+              CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
+          m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_NEXT_HOP,
+                                          delta.first);
+        }
+        for (int j = 0; j < -delta.second; ++j) {
+          gCrmOrch->decCrmResUsedCounter(
+              CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
+          m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_NEXT_HOP,
+                                          delta.first);
+        }
+      }
       m_wcmpGroupTable[entries[i].wcmp_group_id] = entries[i];
       statuses[i] = ReturnCode();
     } else {
-      statuses[i] = ReturnCode(object_statuses[2 * i + 1])
+      statuses[i] = ReturnCode(object_status)
                     << "Failed to update WCMP group with id "
                     << QuotedVar(entries[i].wcmp_group_id);
       }
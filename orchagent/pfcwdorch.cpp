@@ -891,28 +891,35 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::doTask(swss::NotificationConsumer
 {
     SWSS_LOG_ENTER();
 
-    string queueIdStr;
-    string event;
-    vector<swss::FieldValueTuple> values;
+    // Storm events arrive in bursts during incast, so drain the whole
+    // backlog in one wake-up instead of taking another trip through the
+    // select loop for every queue in storm
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    wdNotification.pops(entries);
 
-    wdNotification.pop(queueIdStr, event, values);
-
-    string info;
-    for (auto &fv : values)
-    {
-        info += fvField(fv) + ":" + fvValue(fv) + "|";
-    }
-    if (!info.empty())
+    for (auto &entry : entries)
     {
-        info.pop_back();
-    }
+        string &queueIdStr = kfvKey(entry);
+        string &event = kfvOp(entry);
+        vector<swss::FieldValueTuple> &values = kfvFieldsValues(entry);
+
+        string info;
+        for (auto &fv : values)
+        {
+            info += fvField(fv) + ":" + fvValue(fv) + "|";
+        }
+        if (!info.empty())
+        {
+            info.pop_back();
+        }
 
-    sai_object_id_t queueId = SAI_NULL_OBJECT_ID;
-    sai_deserialize_object_id(queueIdStr, queueId);
+        sai_object_id_t queueId = SAI_NULL_OBJECT_ID;
+        sai_deserialize_object_id(queueIdStr, queueId);
 
-    if (!startWdActionOnQueue(event, queueId, info))
-    {
-        SWSS_LOG_ERROR("Failed to start PFC watchdog %s event action on queue %s", event.c_str(), queueIdStr.c_str());
+        if (!startWdActionOnQueue(event, queueId, info))
+        {
+            SWSS_LOG_ERROR("Failed to start PFC watchdog %s event action on queue %s", event.c_str(), queueIdStr.c_str());
+        }
     }
 }
 
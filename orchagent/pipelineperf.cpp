@@ -0,0 +1,186 @@
+#include "pipelineperf.h"
+
+#include <stdlib.h>
+
+#include <vector>
+
+#include "logger.h"
+
+using namespace std;
+using namespace swss;
+
+constexpr size_t PipelinePerf::NUM_BUCKETS;
+constexpr long PipelinePerf::FLUSH_INTERVAL_SECS;
+constexpr uint64_t PipelinePerf::DEFER_GAP_USECS;
+constexpr uint64_t PipelinePerf::MAX_HOLD_USECS;
+
+PipelinePerf::PipelinePerf() :
+    m_autotune(getenv(PIPELINE_AUTOTUNE_ENV_VAR) != nullptr)
+{
+    if (m_autotune)
+    {
+        SWSS_LOG_NOTICE("Redis pipeline auto-tuning enabled, coalescing flushes under load");
+    }
+}
+
+PipelinePerf &PipelinePerf::Instance()
+{
+    static PipelinePerf perf;
+    return perf;
+}
+
+void PipelinePerf::doFlush(Stats &stats)
+{
+    size_t batch = stats.pipe->size();
+
+    auto start = chrono::steady_clock::now();
+    stats.pipe->flush();
+    auto usecs = static_cast<uint64_t>(chrono::duration_cast<chrono::microseconds>(
+            chrono::steady_clock::now() - start).count());
+
+    size_t bucket = 0;
+    while (bucket < NUM_BUCKETS && (1ULL << bucket) <= batch)
+    {
+        bucket++;
+    }
+    stats.buckets[bucket]++;
+
+    stats.flushes++;
+    stats.total_usecs += usecs;
+    if (usecs > stats.max_usecs)
+    {
+        stats.max_usecs = usecs;
+    }
+    stats.pending = false;
+}
+
+void PipelinePerf::flushPipeline(const string &name, RedisPipeline *pipe, bool allowDefer)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    auto &stats = m_stats[name];
+    stats.pipe = pipe;
+
+    auto now = chrono::steady_clock::now();
+    uint64_t gap = static_cast<uint64_t>(chrono::duration_cast<chrono::microseconds>(
+            now - stats.last_request).count());
+    stats.last_request = now;
+
+    if (m_autotune && allowDefer && gap < DEFER_GAP_USECS)
+    {
+        uint64_t held = stats.pending
+                ? static_cast<uint64_t>(chrono::duration_cast<chrono::microseconds>(
+                        now - stats.pending_since).count())
+                : 0;
+        if (held < MAX_HOLD_USECS)
+        {
+            if (!stats.pending)
+            {
+                stats.pending = true;
+                stats.pending_since = now;
+            }
+            stats.deferrals++;
+            return;
+        }
+    }
+
+    doFlush(stats);
+}
+
+void PipelinePerf::flushPending()
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    auto now = chrono::steady_clock::now();
+    for (auto &it : m_stats)
+    {
+        auto &stats = it.second;
+        if (!stats.pending)
+        {
+            continue;
+        }
+        uint64_t held = static_cast<uint64_t>(chrono::duration_cast<chrono::microseconds>(
+                now - stats.pending_since).count());
+        if (held >= MAX_HOLD_USECS)
+        {
+            doFlush(stats);
+        }
+    }
+}
+
+void PipelinePerf::flush()
+{
+    map<string, Stats> snapshot;
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+
+        auto now = chrono::steady_clock::now();
+        if (chrono::duration_cast<chrono::seconds>(now - m_lastFlush).count() < FLUSH_INTERVAL_SECS)
+        {
+            return;
+        }
+        m_lastFlush = now;
+
+        if (m_stats.empty())
+        {
+            return;
+        }
+
+        for (auto &it : m_stats)
+        {
+            /* Snapshot and reset the counters; the auto-tune state (the
+             * pipeline handle and any pending deferral) stays live */
+            snapshot[it.first] = it.second;
+            auto &stats = it.second;
+            stats.flushes = 0;
+            stats.deferrals = 0;
+            stats.total_usecs = 0;
+            stats.max_usecs = 0;
+            for (size_t i = 0; i <= NUM_BUCKETS; i++)
+            {
+                stats.buckets[i] = 0;
+            }
+        }
+    }
+
+    /* The DB handle is created lazily so the stats can be collected before
+     * redis is reachable (e.g. in unit tests that never flush) */
+    if (!m_table)
+    {
+        m_stateDb = unique_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
+        m_table = unique_ptr<Table>(new Table(m_stateDb.get(), PIPELINE_PERF_TABLE));
+    }
+
+    for (const auto &it : snapshot)
+    {
+        const auto &stats = it.second;
+        if (stats.flushes == 0 && stats.deferrals == 0)
+        {
+            continue;
+        }
+
+        string buckets;
+        for (size_t i = 0; i <= NUM_BUCKETS; i++)
+        {
+            if (i > 0)
+            {
+                buckets += ',';
+            }
+            buckets += to_string(stats.buckets[i]);
+        }
+
+        vector<FieldValueTuple> fvs = {
+            { "flushes", to_string(stats.flushes) },
+            { "deferrals", to_string(stats.deferrals) },
+            { "wait_usecs", to_string(stats.total_usecs) },
+            { "max_wait_usecs", to_string(stats.max_usecs) },
+            /* bucket i counts flushes of fewer than 2^i commands;
+             * the final bucket is the overflow */
+            { "batch_size_pow2", buckets },
+        };
+        m_table->set(it.first, fvs);
+    }
+
+    SWSS_LOG_INFO("Published flush stats for %zu redis pipelines", snapshot.size());
+}
@@ -199,6 +199,33 @@ task_process_status PolicerOrch::handlePortStormControlTable(swss::KeyOpFieldsVa
             return task_process_status::task_failed;
         }
 
+        /* A retune carrying the same rate needs no SAI update and, more
+         * importantly, no detach/re-attach cycle on the port */
+        if (update)
+        {
+            bool rate_changed = false;
+            const auto &rates = m_policerRates[storm_policer_name];
+            for (const auto &attr : attrs)
+            {
+                if (attr.id != SAI_POLICER_ATTR_CIR)
+                {
+                    continue;
+                }
+
+                auto rate = rates.find((sai_policer_attr_t)attr.id);
+                if (rate == rates.end() || rate->second != attr.value.u64)
+                {
+                    rate_changed = true;
+                }
+            }
+
+            if (!rate_changed)
+            {
+                SWSS_LOG_INFO("Storm-control policer %s rate is unchanged, skipping", storm_policer_name.c_str());
+                return task_process_status::task_success;
+            }
+        }
+
         /*Enabling storm-control on port*/
         sai_attribute_t port_attr;
         if (storm_type == storm_broadcast)
@@ -238,6 +265,13 @@ task_process_status PolicerOrch::handlePortStormControlTable(swss::KeyOpFieldsVa
             SWSS_LOG_DEBUG("Created storm-control policer %s", storm_policer_name.c_str());
             m_syncdPolicers[storm_policer_name] = policer_id;
             m_policerRefCounts[storm_policer_name] = 0;
+            for (const auto &attr : attrs)
+            {
+                if (attr.id == SAI_POLICER_ATTR_CIR)
+                {
+                    m_policerRates[storm_policer_name][(sai_policer_attr_t)attr.id] = attr.value.u64;
+                }
+            }
         }
         // Update an existing policer
         else
@@ -266,6 +300,10 @@ task_process_status PolicerOrch::handlePortStormControlTable(swss::KeyOpFieldsVa
                     }
 
                 }
+                else
+                {
+                    m_policerRates[storm_policer_name][(sai_policer_attr_t)attr.id] = attr.value.u64;
+                }
             }
         }
         policer_id = m_syncdPolicers[storm_policer_name];
@@ -304,10 +342,11 @@ task_process_status PolicerOrch::handlePortStormControlTable(swss::KeyOpFieldsVa
                 /*TODO: Just doing a syslog. */
             }
 
-            SWSS_LOG_NOTICE("Removed policer %s as set_port_attribute for %s failed", 
+            SWSS_LOG_NOTICE("Removed policer %s as set_port_attribute for %s failed",
                     storm_policer_name.c_str(),interface_name.c_str());
             m_syncdPolicers.erase(storm_policer_name);
             m_policerRefCounts.erase(storm_policer_name);
+            m_policerRates.erase(storm_policer_name);
 
             return task_process_status::task_need_retry;
         }
@@ -367,6 +406,7 @@ task_process_status PolicerOrch::handlePortStormControlTable(swss::KeyOpFieldsVa
         SWSS_LOG_NOTICE("Removed policer %s", storm_policer_name.c_str());
         m_syncdPolicers.erase(storm_policer_name);
         m_policerRefCounts.erase(storm_policer_name);
+        m_policerRates.erase(storm_policer_name);
     }
     return task_process_status::task_success;
 }
@@ -511,6 +551,16 @@ void PolicerOrch::doTask(Consumer &consumer)
                 SWSS_LOG_NOTICE("Created policer %s", key.c_str());
                 m_syncdPolicers[key] = policer_id;
                 m_policerRefCounts[key] = 0;
+                for (const auto &attr : attrs)
+                {
+                    if (attr.id == SAI_POLICER_ATTR_CBS ||
+                            attr.id == SAI_POLICER_ATTR_CIR ||
+                            attr.id == SAI_POLICER_ATTR_PBS ||
+                            attr.id == SAI_POLICER_ATTR_PIR)
+                    {
+                        m_policerRates[key][(sai_policer_attr_t)attr.id] = attr.value.u64;
+                    }
+                }
             }
             // Update an existing policer
             else
@@ -522,6 +572,7 @@ void PolicerOrch::doTask(Consumer &consumer)
                 // SR_TCM: CIR, CBS, PBS
                 // TR_TCM: CIR, CBS, PIR, PBS
                 // STORM_CONTROL: CIR, CBS
+                auto &rates = m_policerRates[key];
                 for (auto & attr: attrs)
                 {
                     if (attr.id != SAI_POLICER_ATTR_CBS &&
@@ -532,6 +583,14 @@ void PolicerOrch::doTask(Consumer &consumer)
                         continue;
                     }
 
+                    // Skip attributes already programmed with this value, so a
+                    // retune burst only touches the rates that actually moved
+                    auto rate = rates.find((sai_policer_attr_t)attr.id);
+                    if (rate != rates.end() && rate->second == attr.value.u64)
+                    {
+                        continue;
+                    }
+
                     sai_status_t status = sai_policer_api->set_policer_attribute(
                             policer_id, &attr);
                     if (status != SAI_STATUS_SUCCESS)
@@ -544,6 +603,10 @@ void PolicerOrch::doTask(Consumer &consumer)
                             continue;
                         }
                     }
+                    else
+                    {
+                        rates[(sai_policer_attr_t)attr.id] = attr.value.u64;
+                    }
                 }
 
                 SWSS_LOG_NOTICE("Update policer %s attributes", key.c_str());
@@ -583,6 +646,7 @@ void PolicerOrch::doTask(Consumer &consumer)
             SWSS_LOG_NOTICE("Removed policer %s", key.c_str());
             m_syncdPolicers.erase(key);
             m_policerRefCounts.erase(key);
+            m_policerRates.erase(key);
             it = consumer.m_toSync.erase(it);
         }
     }
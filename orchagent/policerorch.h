@@ -10,6 +10,8 @@ using namespace std;
 
 typedef map<string, sai_object_id_t> PolicerTable;
 typedef map<string, int> PolicerRefCountTable;
+/* Last applied rate/size attribute values per policer */
+typedef map<string, map<sai_policer_attr_t, uint64_t>> PolicerRateTable;
 
 class PolicerOrch : public Orch
 {
@@ -28,6 +30,9 @@ private:
 
     PolicerTable m_syncdPolicers;
     PolicerRefCountTable m_policerRefCounts;
+    /* Tracks the rates already programmed so a retune burst only sets the
+     * attributes whose value actually changed */
+    PolicerRateTable m_policerRates;
 };
 
 
@@ -125,10 +125,11 @@ local function find_lanes_and_serdes(interface_name)
 
     -- Get the port configure
     redis.call('SELECT', appl_db)
-    local lanes = redis.call('HGET', appl_db_port ..':'..interface_name, 'lanes')
+    local port_config = redis.call('HMGET', appl_db_port ..':'..interface_name, 'lanes', 'speed')
+    local lanes = port_config[1]
 
     if lanes then
-        local speed = redis.call('HGET', appl_db_port ..':'..interface_name, 'speed')
+        local speed = port_config[2]
 
         -- we were spliting it on ','
         _, count = string.gsub(lanes, ",", ",")
@@ -196,9 +197,14 @@ end
 
 local function find_maxT(port)
     local maxT = -1
+    local fec_cwi_fields = {}
     for i = 0, 15 do
-        local fec_cwi = 'SAI_PORT_STAT_IF_IN_FEC_CODEWORD_ERRORS_S' .. i
-        local fec_cwi_val = redis.call('HGET', counters_table_name .. ':' .. port, fec_cwi)
+        fec_cwi_fields[i + 1] = 'SAI_PORT_STAT_IF_IN_FEC_CODEWORD_ERRORS_S' .. i
+    end
+    -- Read the whole histogram in one round trip
+    local fec_cwi_vals = redis.call('HMGET', counters_table_name .. ':' .. port, unpack(fec_cwi_fields))
+    for i = 0, 15 do
+        local fec_cwi_val = fec_cwi_vals[i + 1]
         if fec_cwi_val then
             fec_cwi_val = tonumber(fec_cwi_val) or 0
             if fec_cwi_val > 0 then
@@ -230,14 +236,16 @@ local function compute_ber(port)
         end
  
         if lanes_count and serdes_speed then
-            fec_corr_bits = redis.call('HGET', counters_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS')
-            fec_uncorr_frames = redis.call('HGET', counters_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES')
+            local fec_counters = redis.call('HMGET', counters_table_name .. ':' .. port,
+                'SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS', 'SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES')
+            fec_corr_bits, fec_uncorr_frames = fec_counters[1], fec_counters[2]
         end
     end
-        
+
     if fec_corr_bits and fec_uncorr_frames and lanes_count and serdes_speed then
-        local fec_corr_bits_last = redis.call('HGET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_FEC_CORRECTED_BITS_last')
-        local fec_uncorr_frames_last = redis.call('HGET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_FEC_NOT_CORRECTABLE_FARMES_last')
+        local fec_last = redis.call('HMGET', rates_table_name .. ':' .. port,
+            'SAI_PORT_STAT_IF_FEC_CORRECTED_BITS_last', 'SAI_PORT_STAT_IF_FEC_NOT_CORRECTABLE_FARMES_last')
+        local fec_corr_bits_last, fec_uncorr_frames_last = fec_last[1], fec_last[2]
 
         -- Initialize to 0 if last counter values does not exist (during first boot for eg)
         fec_corr_bits_last = tonumber(fec_corr_bits_last) or 0
@@ -268,11 +276,13 @@ local function compute_ber(port)
     if fec_corr_bits_ber_new > fec_pre_ber_max then
         redis.call('HSET', rates_table_name .. ':' .. port, 'FEC_PRE_BER_MAX', fec_corr_bits_ber_new)
     end
-    redis.call('HSET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_FEC_CORRECTED_BITS_last', fec_corr_bits)
-    redis.call('HSET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_FEC_NOT_CORRECTABLE_FARMES_last', fec_uncorr_frames)
-    redis.call('HSET', rates_table_name .. ':' .. port, 'FEC_PRE_BER', fec_corr_bits_ber_new)
-    redis.call('HSET', rates_table_name .. ':' .. port, 'FEC_POST_BER', fec_uncorr_bits_ber_new)
-    redis.call('HSET', rates_table_name .. ':' .. port, 'FEC_MAX_T', maxT)
+    -- Store the BER values and counter snapshots in one round trip
+    redis.call('HSET', rates_table_name .. ':' .. port,
+        'SAI_PORT_STAT_IF_FEC_CORRECTED_BITS_last', fec_corr_bits,
+        'SAI_PORT_STAT_IF_FEC_NOT_CORRECTABLE_FARMES_last', fec_uncorr_frames,
+        'FEC_PRE_BER', fec_corr_bits_ber_new,
+        'FEC_POST_BER', fec_uncorr_bits_ber_new,
+        'FEC_MAX_T', maxT)
 end
 
 local function compute_rate(port)
@@ -286,13 +296,14 @@ local function compute_rate(port)
     local initialized = redis.call('HGET', state_table, 'INIT_DONE')
     logit(initialized)
 
-    -- Get new COUNTERS values
-    local in_ucast_pkts = redis.call('HGET', counters_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_IN_UCAST_PKTS')
-    local in_non_ucast_pkts = redis.call('HGET', counters_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS')
-    local out_ucast_pkts = redis.call('HGET', counters_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_OUT_UCAST_PKTS')
-    local out_non_ucast_pkts = redis.call('HGET', counters_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS')
-    local in_octets = redis.call('HGET', counters_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_IN_OCTETS')
-    local out_octets = redis.call('HGET', counters_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_OUT_OCTETS')
+    -- Get new COUNTERS values in one round trip
+    local counters = redis.call('HMGET', counters_table_name .. ':' .. port,
+        'SAI_PORT_STAT_IF_IN_UCAST_PKTS', 'SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS',
+        'SAI_PORT_STAT_IF_OUT_UCAST_PKTS', 'SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS',
+        'SAI_PORT_STAT_IF_IN_OCTETS', 'SAI_PORT_STAT_IF_OUT_OCTETS')
+    local in_ucast_pkts, in_non_ucast_pkts = counters[1], counters[2]
+    local out_ucast_pkts, out_non_ucast_pkts = counters[3], counters[4]
+    local in_octets, out_octets = counters[5], counters[6]
 
     if not in_ucast_pkts or not in_non_ucast_pkts or not out_ucast_pkts or
        not out_non_ucast_pkts or not in_octets or not out_octets then
@@ -301,13 +312,14 @@ local function compute_rate(port)
     end
 
     if initialized == 'DONE' or initialized == 'COUNTERS_LAST' then
-        -- Get old COUNTERS values
-        local in_ucast_pkts_last = redis.call('HGET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_IN_UCAST_PKTS_last')
-        local in_non_ucast_pkts_last = redis.call('HGET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS_last')
-        local out_ucast_pkts_last = redis.call('HGET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_OUT_UCAST_PKTS_last')
-        local out_non_ucast_pkts_last = redis.call('HGET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS_last')
-        local in_octets_last = redis.call('HGET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_IN_OCTETS_last')
-        local out_octets_last = redis.call('HGET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_OUT_OCTETS_last')
+        -- Get old COUNTERS values in one round trip
+        local counters_last = redis.call('HMGET', rates_table_name .. ':' .. port,
+            'SAI_PORT_STAT_IF_IN_UCAST_PKTS_last', 'SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS_last',
+            'SAI_PORT_STAT_IF_OUT_UCAST_PKTS_last', 'SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS_last',
+            'SAI_PORT_STAT_IF_IN_OCTETS_last', 'SAI_PORT_STAT_IF_OUT_OCTETS_last')
+        local in_ucast_pkts_last, in_non_ucast_pkts_last = counters_last[1], counters_last[2]
+        local out_ucast_pkts_last, out_non_ucast_pkts_last = counters_last[3], counters_last[4]
+        local in_octets_last, out_octets_last = counters_last[5], counters_last[6]
 
         -- Calculate new rates values
         local scale_factor = 1000 / delta
@@ -318,22 +330,23 @@ local function compute_rate(port)
 
         if initialized == "DONE" then
             -- Get old rates values
-            local rx_bps_old = redis.call('HGET', rates_table_name .. ':' .. port, 'RX_BPS')
-            local rx_pps_old = redis.call('HGET', rates_table_name .. ':' .. port, 'RX_PPS')
-            local tx_bps_old = redis.call('HGET', rates_table_name .. ':' .. port, 'TX_BPS')
-            local tx_pps_old = redis.call('HGET', rates_table_name .. ':' .. port, 'TX_PPS')
+            local rates_old = redis.call('HMGET', rates_table_name .. ':' .. port,
+                'RX_BPS', 'RX_PPS', 'TX_BPS', 'TX_PPS')
+            local rx_bps_old, rx_pps_old, tx_bps_old, tx_pps_old = rates_old[1], rates_old[2], rates_old[3], rates_old[4]
 
             -- Smooth the rates values and store them in DB
-            redis.call('HSET', rates_table_name .. ':' .. port, 'RX_BPS', alpha*rx_bps_new + one_minus_alpha*rx_bps_old)
-            redis.call('HSET', rates_table_name .. ':' .. port, 'RX_PPS', alpha*rx_pps_new + one_minus_alpha*rx_pps_old)
-            redis.call('HSET', rates_table_name .. ':' .. port, 'TX_BPS', alpha*tx_bps_new + one_minus_alpha*tx_bps_old)
-            redis.call('HSET', rates_table_name .. ':' .. port, 'TX_PPS', alpha*tx_pps_new + one_minus_alpha*tx_pps_old)
+            redis.call('HSET', rates_table_name .. ':' .. port,
+                'RX_BPS', alpha*rx_bps_new + one_minus_alpha*rx_bps_old,
+                'RX_PPS', alpha*rx_pps_new + one_minus_alpha*rx_pps_old,
+                'TX_BPS', alpha*tx_bps_new + one_minus_alpha*tx_bps_old,
+                'TX_PPS', alpha*tx_pps_new + one_minus_alpha*tx_pps_old)
         else
             -- Store unsmoothed initial rates values in DB
-            redis.call('HSET', rates_table_name .. ':' .. port, 'RX_BPS', rx_bps_new)
-            redis.call('HSET', rates_table_name .. ':' .. port, 'RX_PPS', rx_pps_new)
-            redis.call('HSET', rates_table_name .. ':' .. port, 'TX_BPS', tx_bps_new)
-            redis.call('HSET', rates_table_name .. ':' .. port, 'TX_PPS', tx_pps_new)
+            redis.call('HSET', rates_table_name .. ':' .. port,
+                'RX_BPS', rx_bps_new,
+                'RX_PPS', rx_pps_new,
+                'TX_BPS', tx_bps_new,
+                'TX_PPS', tx_pps_new)
             redis.call('HSET', state_table, 'INIT_DONE', 'DONE')
         end
 
@@ -341,13 +354,14 @@ local function compute_rate(port)
         redis.call('HSET', state_table, 'INIT_DONE', 'COUNTERS_LAST')
     end
 
-    -- Set old COUNTERS values
-    redis.call('HSET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_IN_UCAST_PKTS_last', in_ucast_pkts)
-    redis.call('HSET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS_last', in_non_ucast_pkts)
-    redis.call('HSET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_OUT_UCAST_PKTS_last', out_ucast_pkts)
-    redis.call('HSET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS_last', out_non_ucast_pkts)
-    redis.call('HSET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_IN_OCTETS_last', in_octets)
-    redis.call('HSET', rates_table_name .. ':' .. port, 'SAI_PORT_STAT_IF_OUT_OCTETS_last', out_octets)
+    -- Set old COUNTERS values in one round trip
+    redis.call('HSET', rates_table_name .. ':' .. port,
+        'SAI_PORT_STAT_IF_IN_UCAST_PKTS_last', in_ucast_pkts,
+        'SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS_last', in_non_ucast_pkts,
+        'SAI_PORT_STAT_IF_OUT_UCAST_PKTS_last', out_ucast_pkts,
+        'SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS_last', out_non_ucast_pkts,
+        'SAI_PORT_STAT_IF_IN_OCTETS_last', in_octets,
+        'SAI_PORT_STAT_IF_OUT_OCTETS_last', out_octets)
 
 end
 
@@ -3,6 +3,7 @@
 #include <algorithm>
 
 #include "portsorch.h"
+#include "fieldvalueview.h"
 #include "intfsorch.h"
 #include "bufferorch.h"
 #include "neighorch.h"
@@ -15,10 +16,12 @@
 
 #include <inttypes.h>
 #include <cassert>
+#include <chrono>
 #include <fstream>
 #include <sstream>
 #include <set>
 #include <algorithm>
+#include <list>
 #include <tuple>
 #include <sstream>
 #include <unordered_set>
@@ -67,6 +70,7 @@ extern StpOrch *gStpOrch;
 extern Directory<Orch*> gDirectory;
 extern sai_system_port_api_t *sai_system_port_api;
 extern string gMySwitchType;
+extern size_t gMaxBulkSize;
 extern int32_t gVoqMySwitchId;
 extern string gMyHostName;
 extern string gMyAsicName;
@@ -724,6 +728,7 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
         Orch(db, tableNames),
         m_portStateTable(stateDb, STATE_PORT_TABLE_NAME),
         m_portOpErrTable(stateDb, STATE_PORT_OPER_ERR_TABLE_NAME),
+        m_portTeardownTable(stateDb, "PORT_TEARDOWN_TABLE"),
         port_stat_manager(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP, StatsMode::READ, PORT_STAT_FLEX_COUNTER_POLLING_INTERVAL_MS, false),
         port_phy_attr_manager(PORT_PHY_ATTR_FLEX_COUNTER_GROUP, StatsMode::READ, PORT_PHY_ATTR_FLEX_COUNTER_POLLING_INTERVAL_MS, false),
         port_phy_serdes_attr_manager(PORT_PHY_SERDES_ATTR_FLEX_COUNTER_GROUP, StatsMode::READ, PORT_PHY_ATTR_FLEX_COUNTER_POLLING_INTERVAL_MS, false),
@@ -750,13 +755,14 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
                 ref(wred_queue_stat_manager)
             }),
         m_port_state_poller(new SelectableTimer(timespec { .tv_sec = PORT_STATE_POLLING_SEC, .tv_nsec = 0 })),
+        m_vlanMemberBulker(sai_vlan_api, gSwitchId, gMaxBulkSize),
         m_isWarmRestoreStage(WarmStart::isWarmStart())
 {
     SWSS_LOG_ENTER();
 
     /* Initialize counter table */
     m_counter_db = shared_ptr<DBConnector>(new DBConnector("COUNTERS_DB", 0));
-    m_counterNameMapUpdater = unique_ptr<CounterNameMapUpdater>(new CounterNameMapUpdater("COUNTERS_DB", COUNTERS_PORT_NAME_MAP));
+    m_counterNameMapUpdater = CounterNameMapUpdater::getUpdater("COUNTERS_DB", COUNTERS_PORT_NAME_MAP);
     m_counterSysPortTable = unique_ptr<Table>(
                     new Table(m_counter_db.get(), COUNTERS_SYSTEM_PORT_NAME_MAP));
     m_counterLagTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_LAG_NAME_MAP));
@@ -775,19 +781,20 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
     m_gearboxTable = unique_ptr<Table>(new Table(db, "_GEARBOX_TABLE"));
 
     /* Initialize queue tables */
-    m_queueCounterNameMapUpdater = unique_ptr<CounterNameMapUpdater>(new CounterNameMapUpdater("COUNTERS_DB", COUNTERS_QUEUE_NAME_MAP));
+    m_queueCounterNameMapUpdater = CounterNameMapUpdater::getUpdater("COUNTERS_DB", COUNTERS_QUEUE_NAME_MAP);
     m_voqTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_VOQ_NAME_MAP));
     m_queuePortTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_QUEUE_PORT_MAP));
     m_queueIndexTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_QUEUE_INDEX_MAP));
     m_queueTypeTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_QUEUE_TYPE_MAP));
 
     /* Initialize ingress priority group tables */
-    m_pgCounterNameMapUpdater = unique_ptr<CounterNameMapUpdater>(new CounterNameMapUpdater("COUNTERS_DB", COUNTERS_PG_NAME_MAP));
+    m_pgCounterNameMapUpdater = CounterNameMapUpdater::getUpdater("COUNTERS_DB", COUNTERS_PG_NAME_MAP);
     m_pgPortTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_PG_PORT_MAP));
     m_pgIndexTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_PG_INDEX_MAP));
 
     m_state_db = shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
     m_stateBufferMaximumValueTable = unique_ptr<Table>(new Table(m_state_db.get(), STATE_BUFFER_MAXIMUM_VALUE_TABLE));
+    m_queueStatsTable = unique_ptr<Table>(new Table(m_state_db.get(), "PORTS_ORCH_QUEUE_STATS"));
 
     /* Initialize counter capability table*/
     m_queueCounterCapabilitiesTable = unique_ptr<Table>(new Table(m_state_db.get(), STATE_QUEUE_COUNTER_CAPABILITIES_NAME));
@@ -795,95 +802,9 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
 
     initGearbox();
 
-    string queueWmSha, pgWmSha, portRateSha, nvdaPortTrimSha, portFlrSha, gbPortRateSha;
-    string queueWmPluginName = "watermark_queue.lua";
-    string pgWmPluginName = "watermark_pg.lua";
-    string portRatePluginName = "port_rates.lua";
-    string nvdaPortTrimPluginName = "nvda_port_trim_drop.lua";
-    string portFlrPluginName = "port_flr.lua";
-
-    try
-    {
-        string queueLuaScript = swss::loadLuaScript(queueWmPluginName);
-        queueWmSha = swss::loadRedisScript(m_counter_db.get(), queueLuaScript);
-
-        string pgLuaScript = swss::loadLuaScript(pgWmPluginName);
-        pgWmSha = swss::loadRedisScript(m_counter_db.get(), pgLuaScript);
-
-        string portRateLuaScript = swss::loadLuaScript(portRatePluginName);
-        portRateSha = swss::loadRedisScript(m_counter_db.get(), portRateLuaScript);
-
-        string nvdaPortTrimLuaScript = swss::loadLuaScript(nvdaPortTrimPluginName);
-        nvdaPortTrimSha = swss::loadRedisScript(m_counter_db.get(), nvdaPortTrimLuaScript);
-
-        string portFlrLuaScript = swss::loadLuaScript(portFlrPluginName);
-        portFlrSha = swss::loadRedisScript(m_counter_db.get(), portFlrLuaScript);
-
-        if (m_gearboxEnabled && m_gb_counter_db)
-        {
-            string gbportRateLuaScript = swss::loadLuaScript(portRatePluginName);
-            gbPortRateSha = swss::loadRedisScript(m_gb_counter_db.get(), gbportRateLuaScript);
-
-            // Register plugin for gearbox flex counter group
-            setFlexCounterGroupParameter(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP,
-                                        PORT_RATE_FLEX_COUNTER_POLLING_INTERVAL_MS,
-                                        STATS_MODE_READ,
-                                        PORT_PLUGIN_FIELD,
-                                        gbPortRateSha,
-                                        "",        // operation
-                                        true);     // is_gearbox = true
-        }
-    }
-    catch (const runtime_error &e)
-    {
-        SWSS_LOG_ERROR("Port flex counter groups were not set successfully: %s", e.what());
-    }
-
-    // Build portStatPlugins string, only adding non-empty plugin SHAs
-    std::string portStatPlugins;
-    if (!portRateSha.empty())
-    {
-        portStatPlugins = portRateSha;
-    }
-    if (!portFlrSha.empty())
-    {
-        if (!portStatPlugins.empty())
-        {
-            portStatPlugins += ",";
-        }
-        portStatPlugins += portFlrSha;
-    }
-
-    // Nvidia custom trim stat calculation
-    if (isMlnxPlatform() && \
-        isPortStatSupported(SAI_PORT_STAT_TRIM_PACKETS) && \
-        isPortStatSupported(SAI_PORT_STAT_TX_TRIM_PACKETS) && \
-        !isPortStatSupported(SAI_PORT_STAT_DROPPED_TRIM_PACKETS))
-    {
-        portStatPlugins += "," + nvdaPortTrimSha;
-    }
-
-    setFlexCounterGroupParameter(QUEUE_WATERMARK_STAT_COUNTER_FLEX_COUNTER_GROUP,
-                                 QUEUE_WATERMARK_FLEX_STAT_COUNTER_POLL_MSECS,
-                                 STATS_MODE_READ_AND_CLEAR,
-                                 QUEUE_PLUGIN_FIELD,
-                                 queueWmSha);
-
-    setFlexCounterGroupParameter(PG_WATERMARK_STAT_COUNTER_FLEX_COUNTER_GROUP,
-                                 PG_WATERMARK_FLEX_STAT_COUNTER_POLL_MSECS,
-                                 STATS_MODE_READ_AND_CLEAR,
-                                 PG_PLUGIN_FIELD,
-                                 pgWmSha);
-
-    setFlexCounterGroupParameter(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP,
-                                 PORT_RATE_FLEX_COUNTER_POLLING_INTERVAL_MS,
-                                 STATS_MODE_READ,
-                                 PORT_PLUGIN_FIELD,
-                                 portStatPlugins);
-
-    setFlexCounterGroupParameter(PG_DROP_STAT_COUNTER_FLEX_COUNTER_GROUP,
-                                 PG_DROP_FLEX_STAT_COUNTER_POLL_MSECS,
-                                 STATS_MODE_READ);
+    /* The port/queue/PG flex counter groups and their rate plugins are
+     * created lazily on the first counter group enable; see
+     * initPortFlexCounterGroups() */
 
     /* Get CPU port */
     this->initializeCpuPort();
@@ -1200,30 +1121,45 @@ void PortsOrch::initializePorts()
         }
     }
 
-    // Get port hardware lane info
-    for (const auto &portId : portList)
-    {
-        std::vector<sai_uint32_t> laneList(Port::max_lanes, 0);
+    // Get port hardware lane info with a single bulk query instead of
+    // one SAI round trip per port
+    std::vector<std::vector<sai_uint32_t>> laneLists(
+        this->m_portCount, std::vector<sai_uint32_t>(Port::max_lanes, 0)
+    );
+
+    PortBulker bulker(this->m_portCount);
 
+    for (sai_uint32_t idx = 0; idx < this->m_portCount; idx++)
+    {
         attr.id = SAI_PORT_ATTR_HW_LANE_LIST;
-        attr.value.u32list.count = static_cast<sai_uint32_t>(laneList.size());
-        attr.value.u32list.list = laneList.data();
+        attr.value.u32list.count = static_cast<sai_uint32_t>(laneLists[idx].size());
+        attr.value.u32list.list = laneLists[idx].data();
 
-        status = sai_port_api->get_port_attribute(portId, 1, &attr);
-        if (status != SAI_STATUS_SUCCESS)
+        bulker.add(portList[idx], attr);
+    }
+
+    bulker.executeGet();
+
+    for (sai_uint32_t idx = 0; idx < this->m_portCount; idx++)
+    {
+        const auto &portId = portList[idx];
+
+        if (bulker.statuses[idx] != SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_ERROR("Failed to get hardware lane list pid:%" PRIx64, portId);
-            auto handle_status = handleSaiGetStatus(SAI_API_PORT, status);
+            auto handle_status = handleSaiGetStatus(SAI_API_PORT, bulker.statuses[idx]);
             if (handle_status != task_process_status::task_success)
             {
                 SWSS_LOG_THROW("PortsOrch initialization failure");
             }
         }
 
+        const auto &laneAttr = bulker.attrList[idx];
+
         std::set<std::uint32_t> laneSet;
-        for (sai_uint32_t i = 0; i < attr.value.u32list.count; i++)
+        for (sai_uint32_t i = 0; i < laneAttr.value.u32list.count; i++)
         {
-            laneSet.insert(attr.value.u32list.list[i]);
+            laneSet.insert(laneAttr.value.u32list.list[i]);
         }
 
         this->m_portListLaneMap[laneSet] = portId;
@@ -1721,17 +1657,21 @@ bool PortsOrch::getDestPortId(sai_object_id_t src_port_id, dest_port_type_t port
 
     if (m_gearboxEnabled)
     {
-        if (m_gearboxPortListLaneMap.find(src_port_id) != m_gearboxPortListLaneMap.end())
+        /* The side ids filled in at gearbox port creation double as the
+         * per-port handle, no lane-map lookup needed */
+        const Port *port = getPortRef(src_port_id);
+        if (port != nullptr && port->m_port_id == src_port_id &&
+            port->m_system_side_id != SAI_NULL_OBJECT_ID)
         {
             if (PHY_PORT_TYPE == port_type)
             {
-                des_port_id = get<0>(m_gearboxPortListLaneMap[src_port_id]);
+                des_port_id = port->m_system_side_id;
                 SWSS_LOG_DEBUG("BOX: port id:%" PRIx64 " has a phy-side port id:%" PRIx64, src_port_id, des_port_id);
                 status = true;
             }
             else if (LINE_PORT_TYPE == port_type)
             {
-                des_port_id = get<1>(m_gearboxPortListLaneMap[src_port_id]);
+                des_port_id = port->m_line_side_id;
                 SWSS_LOG_DEBUG("BOX: port id:%" PRIx64 " has a line-side port id:%" PRIx64, src_port_id, des_port_id);
                 status = true;
             }
@@ -1782,21 +1722,41 @@ bool PortsOrch::getPort(sai_object_id_t id, Port &port)
 {
     SWSS_LOG_ENTER();
 
+    const Port *ref = getPortRef(id);
+    if (ref == nullptr)
+    {
+        return false;
+    }
+
+    port = *ref;
+    return true;
+}
+
+/* Internal no-copy variant of getPort(oid). The returned pointer follows the
+ * same lifetime rules as m_portOidCache: it points into m_portList and stays
+ * valid until the port object is erased. */
+const Port *PortsOrch::getPortRef(sai_object_id_t id)
+{
+    auto cached = m_portOidCache.find(id);
+    if (cached != m_portOidCache.end())
+    {
+        return cached->second;
+    }
+
     auto itr = saiOidToAlias.find(id);
     if (itr == saiOidToAlias.end())
     {
-        return false;
+        return nullptr;
     }
-    else
+
+    auto pitr = m_portList.find(itr->second);
+    if (pitr == m_portList.end())
     {
-        if (!getPort(itr->second, port))
-        {
-            SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
-        }
-        return true;
+        SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
     }
 
-    return false;
+    m_portOidCache[id] = &pitr->second;
+    return &pitr->second;
 }
 
 bool PortsOrch::isFrontPanelPort(Port& port)
@@ -1972,18 +1932,7 @@ bool PortsOrch::getPortByBridgePortId(sai_object_id_t bridge_port_id, Port &port
 {
     SWSS_LOG_ENTER();
 
-    auto itr = saiOidToAlias.find(bridge_port_id);
-    if (itr == saiOidToAlias.end())
-    {
-        return false;
-    }
-    else
-    {
-        getPort(itr->second, port);
-        return true;
-    }
-
-    return false;
+    return getPort(bridge_port_id, port);
 }
 
 bool PortsOrch::addSubPort(Port &port, const string &alias, const string &vlan, const bool &adminUp, const uint32_t &mtu)
@@ -2118,6 +2067,7 @@ bool PortsOrch::removeSubPort(const string &alias)
     m_portList[parentPort.m_alias] = parentPort;
 
     m_portList.erase(it);
+    m_portOidCache.clear();
 
     // Restore hostif vlan tag for the parent port when the last subport is removed
     if (parentPort.m_child_ports.empty())
@@ -2677,7 +2627,6 @@ bool PortsOrch::unbindRemoveAclTableGroup(sai_object_id_t  port_oid,
 {
     SWSS_LOG_ENTER();
 
-    sai_status_t       status;
     bool               ingress = (acl_stage == ACL_STAGE_INGRESS);
     Port               port;
 
@@ -2711,39 +2660,86 @@ bool PortsOrch::unbindRemoveAclTableGroup(sai_object_id_t  port_oid,
         return true;
     }
 
-    SWSS_LOG_NOTICE("Removing port OID %" PRIx64" ACL table group ID", port_oid);
+    // Last member is gone; park the empty group for reuse instead of
+    // destroying it right away. A rebind in the same drain picks the
+    // group up again, sparing the slow group destroy/create round trip,
+    // and flushAclTableGroupQuarantine() reaps it otherwise.
+    SWSS_LOG_NOTICE("Quarantining empty ACL table group of port OID %" PRIx64, port_oid);
+    m_emptyAclTableGroups.insert(make_pair(port_oid, acl_stage));
+    setPort(port.m_alias, port);
+    return true;
+}
 
-    // Unbind ACL group
-    if (!bindUnbindAclTableGroup(port, ingress, false))
-    {
-        SWSS_LOG_ERROR("Failed to remove ACL group ID from port");
-        return false;
-    }
+void PortsOrch::flushAclTableGroupQuarantine()
+{
+    SWSS_LOG_ENTER();
 
-    // Remove ACL group
-    status = sai_acl_api->remove_acl_table_group(group_oid_ref);
-    if (SAI_STATUS_SUCCESS != status)
+    auto it = m_emptyAclTableGroups.begin();
+    while (it != m_emptyAclTableGroups.end())
     {
-        SWSS_LOG_ERROR("Failed to remove ACL table group, rv:%d", status);
-        task_process_status handle_status = handleSaiRemoveStatus(SAI_API_ACL, status);
-        if (handle_status != task_success)
+        sai_object_id_t  port_oid = it->first;
+        acl_stage_type_t acl_stage = it->second;
+        bool             ingress = (acl_stage == ACL_STAGE_INGRESS);
+
+        Port port;
+        if (!getPort(port_oid, port))
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            // Port is gone, removeAclTableGroup() took the group with it
+            it = m_emptyAclTableGroups.erase(it);
+            continue;
         }
-    }
-    sai_acl_bind_point_type_t bind_type;
-    if (!getSaiAclBindPointType(port.m_type, bind_type))
-    {
-        SWSS_LOG_ERROR("Unknown SAI ACL bind point type");
-        return false;
-    }
-    gCrmOrch->decCrmAclUsedCounter(CrmResourceType::CRM_ACL_GROUP,
-                                   ingress ? SAI_ACL_STAGE_INGRESS : SAI_ACL_STAGE_EGRESS,
-                                   bind_type, group_oid_ref);
 
-    group_oid_ref = SAI_NULL_OBJECT_ID;
-    setPort(port.m_alias, port);
-    return true;
+        sai_object_id_t &group_oid_ref =
+                ingress ? port.m_ingress_acl_table_group_id :
+                          port.m_egress_acl_table_group_id;
+        unordered_set<sai_object_id_t> &acl_list_ref =
+                ingress ? port.m_ingress_acl_tables_uset :
+                          port.m_egress_acl_tables_uset;
+
+        if (!acl_list_ref.empty() || SAI_NULL_OBJECT_ID == group_oid_ref)
+        {
+            // Group got reused since it was parked
+            it = m_emptyAclTableGroups.erase(it);
+            continue;
+        }
+
+        SWSS_LOG_NOTICE("Removing quarantined %s ACL table group of port %s",
+                        ingress ? "ingress" : "egress", port.m_alias.c_str());
+
+        // Unbind ACL group
+        if (!bindUnbindAclTableGroup(port, ingress, false))
+        {
+            SWSS_LOG_ERROR("Failed to remove ACL group ID from port");
+            it++;
+            continue;
+        }
+
+        // Remove ACL group
+        sai_status_t status = sai_acl_api->remove_acl_table_group(group_oid_ref);
+        if (SAI_STATUS_SUCCESS != status)
+        {
+            SWSS_LOG_ERROR("Failed to remove ACL table group, rv:%d", status);
+            task_process_status handle_status = handleSaiRemoveStatus(SAI_API_ACL, status);
+            if (handle_status != task_success)
+            {
+                parseHandleSaiStatusFailure(handle_status);
+                it++;
+                continue;
+            }
+        }
+
+        sai_acl_bind_point_type_t bind_type;
+        if (getSaiAclBindPointType(port.m_type, bind_type))
+        {
+            gCrmOrch->decCrmAclUsedCounter(CrmResourceType::CRM_ACL_GROUP,
+                                           ingress ? SAI_ACL_STAGE_INGRESS : SAI_ACL_STAGE_EGRESS,
+                                           bind_type, group_oid_ref);
+        }
+
+        group_oid_ref = SAI_NULL_OBJECT_ID;
+        setPort(port.m_alias, port);
+        it = m_emptyAclTableGroups.erase(it);
+    }
 }
 
 bool PortsOrch::createBindAclTableGroup(sai_object_id_t  port_oid,
@@ -2777,7 +2773,14 @@ bool PortsOrch::createBindAclTableGroup(sai_object_id_t  port_oid,
             ingress ? port.m_ingress_acl_table_group_id :
                       port.m_egress_acl_table_group_id;
 
-    if (acl_list_ref.empty())
+    if (acl_list_ref.empty() && group_oid_ref != SAI_NULL_OBJECT_ID)
+    {
+        // Pick the quarantined group back up, it is still bound to the port
+        SWSS_LOG_NOTICE("Reusing quarantined %s ACL table group of port %s",
+                        ingress ? "ingress" : "egress", port.m_alias.c_str());
+        m_emptyAclTableGroups.erase(make_pair(port_oid, acl_stage));
+    }
+    else if (acl_list_ref.empty())
     {
         // Port ACL table group does not exist, create one
         assert(group_oid_ref == SAI_NULL_OBJECT_ID);
@@ -4676,9 +4679,39 @@ void PortsOrch::doPortTask(Consumer &consumer)
             else
             {
                 // Port is already created, gather updated field-values.
+                // Fields whose value matches the last successfully applied
+                // configuration are dropped here, so a full-config re-push
+                // (e.g. during breakout) only dispatches the attributes
+                // that actually changed instead of re-walking every handler.
                 std::unordered_map<std::string, std::string> fvMap;
+                const auto &appliedCfg = m_appliedPortConfig[key];
 
-                if (!parsePortFvs(fvMap))
+                for (const auto &cit : kfvFieldsValues(keyOpFieldsValues))
+                {
+                    auto fieldName = fvField(cit);
+                    auto fieldValue = fvValue(cit);
+
+                    SWSS_LOG_INFO("FIELD: %s, VALUE: %s", fieldName.c_str(), fieldValue.c_str());
+
+                    auto applied = appliedCfg.find(fieldName);
+                    if (applied != appliedCfg.end() && applied->second == fieldValue)
+                    {
+                        continue;
+                    }
+
+                    fvMap[fieldName] = fieldValue;
+                }
+
+                if (fvMap.empty())
+                {
+                    // Nothing changed against the applied configuration
+                    it = taskMap.erase(it);
+                    continue;
+                }
+
+                pCfg.fieldValueMap = fvMap;
+
+                if (!m_portHlpr.parsePortConfig(pCfg))
                 {
                     it = taskMap.erase(it);
                     continue;
@@ -5631,6 +5664,14 @@ void PortsOrch::doPortTask(Consumer &consumer)
                         );
                     }
                 }
+
+                /* The whole chain went through: remember what was applied so
+                 * subsequent re-pushes can skip unchanged attributes */
+                auto &appliedCfg = m_appliedPortConfig[pCfg.key];
+                for (const auto &cit : pCfg.fieldValueMap)
+                {
+                    appliedCfg[cit.first] = cit.second;
+                }
             }
         }
         else if (op == DEL_COMMAND)
@@ -5640,15 +5681,31 @@ void PortsOrch::doPortTask(Consumer &consumer)
             {
                 SWSS_LOG_ERROR("Failed to remove port: alias %s doesn't exist", pCfg.key.c_str());
                 m_portConfigMap.erase(pCfg.key);
+                m_appliedPortConfig.erase(pCfg.key);
+                m_portTeardownProgress.erase(pCfg.key);
                 it = taskMap.erase(it);
                 continue;
             }
 
             const auto &alias = pCfg.key;
 
+            auto teardownIt = m_portTeardownProgress.find(alias);
+            if (teardownIt == m_portTeardownProgress.end())
+            {
+                teardownIt = m_portTeardownProgress.emplace(alias, PortTeardownProgress()).first;
+                teardownIt->second.del_received = std::chrono::steady_clock::now();
+            }
+            auto &teardown = teardownIt->second;
+
             if (m_port_ref_count[alias] > 0)
             {
                 SWSS_LOG_WARN("Unable to remove port %s: ref count %u", alias.c_str(), m_port_ref_count[alias]);
+                teardown.retries++;
+                vector<FieldValueTuple> fvs;
+                fvs.emplace_back("phase", "wait-dependencies");
+                fvs.emplace_back("pending_references", to_string(m_port_ref_count[alias]));
+                fvs.emplace_back("retries", to_string(teardown.retries));
+                m_portTeardownTable.set(alias, fvs);
                 it++;
                 continue;
             }
@@ -5665,10 +5722,21 @@ void PortsOrch::doPortTask(Consumer &consumer)
                 // Ideally this should be tracked by SAI redis.
                 // Until then, let this snippet be here.
                 SWSS_LOG_WARN("Cannot remove port as bridge port OID is present %" PRIx64 , bridge_port_oid);
+                teardown.retries++;
+                vector<FieldValueTuple> fvs;
+                fvs.emplace_back("phase", "wait-bridge-port");
+                fvs.emplace_back("retries", to_string(teardown.retries));
+                m_portTeardownTable.set(alias, fvs);
                 it++;
                 continue;
             }
 
+            if (!teardown.deps_done)
+            {
+                teardown.deps_done = true;
+                teardown.deps_cleared = std::chrono::steady_clock::now();
+            }
+
             if (m_portList[alias].m_init)
             {
                 deInitPort(alias, port_id);
@@ -5699,6 +5767,7 @@ void PortsOrch::doPortTask(Consumer &consumer)
                 );
             }
 
+            auto saiRemoveStart = std::chrono::steady_clock::now();
             sai_status_t status = removePort(port_id);
             if (SAI_STATUS_SUCCESS != status)
             {
@@ -5707,18 +5776,47 @@ void PortsOrch::doPortTask(Consumer &consumer)
                     throw runtime_error("Delete port failed");
                 }
                 SWSS_LOG_WARN("Failed to remove port %" PRIx64 ", as the object is in use", port_id);
+                teardown.retries++;
+                vector<FieldValueTuple> fvs;
+                fvs.emplace_back("phase", "wait-sai-in-use");
+                fvs.emplace_back("retries", to_string(teardown.retries));
+                m_portTeardownTable.set(alias, fvs);
                 it++;
                 continue;
             }
             removePortFromLanesMap(alias);
             removePortFromPortListMap(port_id);
 
+            auto removeDone = std::chrono::steady_clock::now();
+            auto toMs = [](std::chrono::steady_clock::duration d)
+            {
+                return std::chrono::duration_cast<std::chrono::milliseconds>(d).count();
+            };
+            auto depsWaitMs = toMs(teardown.deps_cleared - teardown.del_received);
+            auto deinitMs = toMs(saiRemoveStart - teardown.deps_cleared);
+            auto saiRemoveMs = toMs(removeDone - saiRemoveStart);
+
+            vector<FieldValueTuple> fvs;
+            fvs.emplace_back("phase", "done");
+            fvs.emplace_back("dependency_wait_ms", to_string(depsWaitMs));
+            fvs.emplace_back("deinit_ms", to_string(deinitMs));
+            fvs.emplace_back("sai_remove_ms", to_string(saiRemoveMs));
+            fvs.emplace_back("total_ms", to_string(toMs(removeDone - teardown.del_received)));
+            fvs.emplace_back("retries", to_string(teardown.retries));
+            m_portTeardownTable.set(alias, fvs);
+
+            SWSS_LOG_NOTICE("Removed port %s (dependency wait %lld ms, deinit %lld ms, "
+                            "SAI remove %lld ms, %u retries)",
+                            alias.c_str(), (long long)depsWaitMs, (long long)deinitMs,
+                            (long long)saiRemoveMs, teardown.retries);
+
             /* Delete port from port list */
             m_portConfigMap.erase(alias);
+            m_appliedPortConfig.erase(alias);
+            m_portTeardownProgress.erase(alias);
             m_portList.erase(alias);
             saiOidToAlias.erase(port_id);
-
-            SWSS_LOG_NOTICE("Removed port %s", alias.c_str());
+            m_portOidCache.clear();
         }
         else
         {
@@ -5761,21 +5859,10 @@ void PortsOrch::doVlanTask(Consumer &consumer)
             uint32_t mtu = 0;
             MacAddress mac;
             string hostif_name = "";
-            for (auto i : kfvFieldsValues(t))
-            {
-                if (fvField(i) == "mtu")
-                {
-                    mtu = (uint32_t)stoul(fvValue(i));
-                }
-                if (fvField(i) == "mac")
-                {
-                    mac = MacAddress(fvValue(i));
-                }
-                if (fvField(i) == "host_ifname")
-                {
-                    hostif_name = fvValue(i);
-                }
-            }
+            FieldValueView fvs(t);
+            fvs.u32("mtu", mtu);
+            fvs.mac("mac", mac);
+            fvs.str("host_ifname", hostif_name);
 
             /*
              * Only creation is supported for now.
@@ -5858,6 +5945,20 @@ void PortsOrch::doVlanMemberTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    /* Tasks whose SAI operation went through m_vlanMemberBulker; the
+     * bookkeeping is resolved per entry once the flushed statuses are
+     * known. Contexts live in lists since the bulker keeps pointers
+     * into them until the flush. */
+    struct VlanMemberTask
+    {
+        SyncMap::iterator it;
+        VlanMemberContext ctx;
+    };
+
+    std::list<VlanMemberTask> bulk_adds;
+    std::list<VlanMemberTask> bulk_dels;
+    std::set<std::string> bulked_keys;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -5893,6 +5994,14 @@ void PortsOrch::doVlanMemberTask(Consumer &consumer)
         vlan_alias = VLAN_PREFIX + to_string(vlan_id);
         string op = kfvOp(t);
 
+        /* A second operation on a key already in this batch keeps its
+         * SAI ordering by waiting for the next pass */
+        if (bulked_keys.find(kfvKey(t)) != bulked_keys.end())
+        {
+            it++;
+            continue;
+        }
+
         assert(m_portList.find(vlan_alias) != m_portList.end());
         Port vlan, port;
 
@@ -5937,28 +6046,40 @@ void PortsOrch::doVlanMemberTask(Consumer &consumer)
                 continue;
             }
 
-            if (addBridgePort(port) && addVlanMember(vlan, port, tagging_mode))
-                it = consumer.m_toSync.erase(it);
-            else
+            if (!addBridgePort(port))
+            {
                 it++;
+                continue;
+            }
+
+            bulk_adds.push_back({it, VlanMemberContext()});
+            auto &ctx = bulk_adds.back().ctx;
+            ctx.vlan_alias = vlan.m_alias;
+            ctx.port_alias = port.m_alias;
+            if (tagging_mode == "untagged")
+                ctx.tagging_mode = SAI_VLAN_TAGGING_MODE_UNTAGGED;
+            else if (tagging_mode == "tagged")
+                ctx.tagging_mode = SAI_VLAN_TAGGING_MODE_TAGGED;
+            else
+                ctx.tagging_mode = SAI_VLAN_TAGGING_MODE_PRIORITY_TAGGED;
+
+            addVlanMemberBulk(vlan, port, ctx);
+            bulked_keys.insert(kfvKey(t));
+            it++;
         }
         else if (op == DEL_COMMAND)
         {
             if (vlan.m_members.find(port_alias) != vlan.m_members.end())
             {
-                if (removeVlanMember(vlan, port))
-                {
-		    if (getBridgePortReferenceCount(port) == 0)
-                    {
-                        removeBridgePort(port);
-                    }
-                    it = consumer.m_toSync.erase(it);
-                }
-                else
-                {
-                    it++;
-                }
-            }
+                bulk_dels.push_back({it, VlanMemberContext()});
+                auto &ctx = bulk_dels.back().ctx;
+                ctx.vlan_alias = vlan.m_alias;
+                ctx.port_alias = port.m_alias;
+
+                removeVlanMemberBulk(vlan, port, ctx);
+                bulked_keys.insert(kfvKey(t));
+                it++;
+            }
             else
                 /* Cannot locate the VLAN */
                 it = consumer.m_toSync.erase(it);
@@ -5969,6 +6090,35 @@ void PortsOrch::doVlanMemberTask(Consumer &consumer)
             it = consumer.m_toSync.erase(it);
         }
     }
+
+    if (bulk_adds.empty() && bulk_dels.empty())
+    {
+        return;
+    }
+
+    m_vlanMemberBulker.flush();
+
+    for (auto &task : bulk_dels)
+    {
+        if (removeVlanMemberPost(task.ctx))
+        {
+            Port port;
+            if (getPort(task.ctx.port_alias, port) &&
+                getBridgePortReferenceCount(port) == 0)
+            {
+                removeBridgePort(port);
+            }
+            consumer.m_toSync.erase(task.it);
+        }
+    }
+
+    for (auto &task : bulk_adds)
+    {
+        if (addVlanMemberPost(task.ctx))
+        {
+            consumer.m_toSync.erase(task.it);
+        }
+    }
 }
 
 void PortsOrch::doTransceiverPresenceCheck(Consumer &consumer)
@@ -6495,6 +6645,9 @@ void PortsOrch::doTask(Consumer &consumer)
 
     string table_name = consumer.getTableName();
 
+    auto queueDepth = consumer.m_toSync.size();
+    auto drainStart = std::chrono::steady_clock::now();
+
     if (table_name == STATE_TRANSCEIVER_INFO_TABLE_NAME)
     {
         doTransceiverPresenceCheck(consumer);
@@ -6513,6 +6666,7 @@ void PortsOrch::doTask(Consumer &consumer)
         /* Wait for all ports to be initialized */
         if (!allPortsReady())
         {
+            updateConsumerQueueStats(table_name, queueDepth, consumer.m_toSync.size(), drainStart);
             return;
         }
 
@@ -6533,6 +6687,31 @@ void PortsOrch::doTask(Consumer &consumer)
             doLagMemberTask(consumer);
         }
     }
+
+    updateConsumerQueueStats(table_name, queueDepth, consumer.m_toSync.size(), drainStart);
+}
+
+/* Publish per-consumer backlog figures to STATE_DB so a port-task
+ * pile-up (e.g. during dynamic breakout) can be observed without
+ * correlating syslog timestamps. One key per application table with
+ * the depth left after the drain, the number of tasks retired and
+ * the wall time the drain took. */
+void PortsOrch::updateConsumerQueueStats(const string &tableName, size_t queued, size_t pending,
+                                         const std::chrono::steady_clock::time_point &drainStart)
+{
+    if (queued == 0)
+    {
+        return;
+    }
+
+    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - drainStart).count();
+
+    vector<FieldValueTuple> fvs;
+    fvs.emplace_back("depth", to_string(pending));
+    fvs.emplace_back("drained", to_string(queued > pending ? queued - pending : 0));
+    fvs.emplace_back("drain_latency_us", to_string(latency));
+    m_queueStatsTable->set(tableName, fvs);
 }
 
 void PortsOrch::initializeVoqs(Port &port)
@@ -6933,6 +7112,51 @@ void PortsOrch::initializeQueuesBulk(std::vector<Port>& ports)
             SWSS_LOG_INFO("Get queues for port %s", port.m_alias.c_str());
         }
     }
+
+    // Prime the queue type/index cache with one bulk query, so the
+    // buffer/QoS flows consulting getQueueTypeAndIndex() never pay a
+    // first-touch get_queue_attribute per queue
+    {
+        std::vector<sai_object_id_t> queueIds;
+        for (const auto& port: ports)
+        {
+            queueIds.insert(queueIds.end(), port.m_queue_ids.begin(), port.m_queue_ids.end());
+        }
+
+        if (!queueIds.empty())
+        {
+            const auto queueCount = static_cast<uint32_t>(queueIds.size());
+
+            std::vector<sai_attribute_t> attrList(queueCount * 2);
+            std::vector<sai_attribute_t*> attrPtrs(queueCount);
+            std::vector<uint32_t> attrCounts(queueCount, 2);
+            std::vector<sai_status_t> statuses(queueCount, SAI_STATUS_NOT_EXECUTED);
+
+            for (uint32_t idx = 0; idx < queueCount; idx++)
+            {
+                attrList[idx * 2].id = SAI_QUEUE_ATTR_TYPE;
+                attrList[idx * 2 + 1].id = SAI_QUEUE_ATTR_INDEX;
+                attrPtrs[idx] = &attrList[idx * 2];
+            }
+
+            sai_queue_api->get_queues_attribute(queueCount, queueIds.data(), attrCounts.data(),
+                attrPtrs.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+
+            for (uint32_t idx = 0; idx < queueCount; idx++)
+            {
+                if (statuses[idx] != SAI_STATUS_SUCCESS)
+                {
+                    // getQueueTypeAndIndex() falls back to a per-queue query
+                    SWSS_LOG_NOTICE("Failed to prefetch type/index for queue %" PRIx64 " rv:%d",
+                                    queueIds[idx], statuses[idx]);
+                    continue;
+                }
+
+                m_queueInfo[queueIds[idx]].type = static_cast<sai_queue_type_t>(attrList[idx * 2].value.s32);
+                m_queueInfo[queueIds[idx]].index = attrList[idx * 2 + 1].value.u8;
+            }
+        }
+    }
 }
 
 void PortsOrch::initializeSchedulerGroupsBulk(std::vector<Port>& ports)
@@ -7335,6 +7559,7 @@ bool PortsOrch::removeBridgePort(Port &port)
         }
     }
     saiOidToAlias.erase(port.m_bridge_port_id);
+    m_portOidCache.erase(port.m_bridge_port_id);
     port.m_bridge_port_id = SAI_NULL_OBJECT_ID;
 
     /* Remove bridge port */
@@ -7485,6 +7710,7 @@ bool PortsOrch::removeVlan(Port vlan)
 
     saiOidToAlias.erase(vlan.m_vlan_info.vlan_oid);
     m_portList.erase(vlan.m_alias);
+    m_portOidCache.clear();
     m_port_ref_count.erase(vlan.m_alias);
     m_bridge_port_ref_count.erase(vlan.m_alias);
     m_vlanPorts.erase(vlan.m_alias);
@@ -7588,6 +7814,75 @@ bool PortsOrch::addVlanMember(Port &vlan, Port &port, string &tagging_mode, stri
     return true;
 }
 
+/* Queue a VLAN member create on m_vlanMemberBulker. The created member
+ * id lands in ctx.vlan_member_id at flush time and the bookkeeping is
+ * applied by addVlanMemberPost(). */
+void PortsOrch::addVlanMemberBulk(const Port &vlan, const Port &port, VlanMemberContext &ctx)
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attr;
+    vector<sai_attribute_t> attrs;
+
+    attr.id = SAI_VLAN_MEMBER_ATTR_VLAN_ID;
+    attr.value.oid = vlan.m_vlan_info.vlan_oid;
+    attrs.push_back(attr);
+
+    attr.id = SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID;
+    attr.value.oid = port.m_bridge_port_id;
+    attrs.push_back(attr);
+
+    attr.id = SAI_VLAN_MEMBER_ATTR_VLAN_TAGGING_MODE;
+    attr.value.s32 = ctx.tagging_mode;
+    attrs.push_back(attr);
+
+    m_vlanMemberBulker.create_entry(&ctx.vlan_member_id, (uint32_t)attrs.size(), attrs.data());
+}
+
+bool PortsOrch::addVlanMemberPost(VlanMemberContext &ctx)
+{
+    SWSS_LOG_ENTER();
+
+    Port vlan, port;
+    if (!getPort(ctx.vlan_alias, vlan) || !getPort(ctx.port_alias, port))
+    {
+        return false;
+    }
+
+    if (ctx.vlan_member_id == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_ERROR("Failed to add member %s to VLAN %s vid:%hu pid:%" PRIx64,
+                port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, port.m_port_id);
+        return false;
+    }
+
+    SWSS_LOG_NOTICE("Add member %s to VLAN %s vid:%hu pid%" PRIx64,
+            port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, port.m_port_id);
+
+    /* Use untagged VLAN as pvid of the member port */
+    if (ctx.tagging_mode == SAI_VLAN_TAGGING_MODE_UNTAGGED &&
+        port.m_type != Port::TUNNEL)
+    {
+        if (!setPortPvid(port, vlan.m_vlan_info.vlan_id))
+        {
+            return false;
+        }
+    }
+
+    /* a physical port may join multiple vlans */
+    VlanMemberEntry vme = {ctx.vlan_member_id, ctx.tagging_mode};
+    m_portVlanMember[port.m_alias][vlan.m_vlan_info.vlan_id] = vme;
+    m_portList[port.m_alias] = port;
+    vlan.m_members.insert(port.m_alias);
+    m_portList[vlan.m_alias] = vlan;
+    increaseBridgePortRefCount(port);
+
+    VlanMemberUpdate update = { vlan, port, true };
+    notify(SUBJECT_TYPE_VLAN_MEMBER_CHANGE, static_cast<void *>(&update));
+
+    return true;
+}
+
 bool PortsOrch::getPortVlanMembers(Port &port, vlan_members_t &vlan_members)
 {
     vlan_members = m_portVlanMember[port.m_alias];
@@ -7922,6 +8217,73 @@ bool PortsOrch::removeVlanMember(Port &vlan, Port &port, string end_point_ip)
     return true;
 }
 
+/* Queue a VLAN member remove on m_vlanMemberBulker; the status lands in
+ * ctx.remove_status at flush time and the bookkeeping is applied by
+ * removeVlanMemberPost(). */
+void PortsOrch::removeVlanMemberBulk(const Port &vlan, const Port &port, VlanMemberContext &ctx)
+{
+    SWSS_LOG_ENTER();
+
+    auto vlan_member = m_portVlanMember[port.m_alias].find(vlan.m_vlan_info.vlan_id);
+
+    /* Assert the port belongs to this VLAN */
+    assert (vlan_member != m_portVlanMember[port.m_alias].end());
+    ctx.tagging_mode = vlan_member->second.vlan_mode;
+    ctx.vlan_member_id = vlan_member->second.vlan_member_id;
+
+    m_vlanMemberBulker.remove_entry(&ctx.remove_status, ctx.vlan_member_id);
+}
+
+bool PortsOrch::removeVlanMemberPost(VlanMemberContext &ctx)
+{
+    SWSS_LOG_ENTER();
+
+    Port vlan, port;
+    if (!getPort(ctx.vlan_alias, vlan) || !getPort(ctx.port_alias, port))
+    {
+        return false;
+    }
+
+    if (ctx.remove_status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to remove member %s from VLAN %s vid:%hx vmid:%" PRIx64,
+                port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, ctx.vlan_member_id);
+        task_process_status handle_status = handleSaiRemoveStatus(SAI_API_VLAN, ctx.remove_status);
+        if (handle_status != task_success)
+        {
+            return parseHandleSaiStatusFailure(handle_status);
+        }
+    }
+
+    m_portVlanMember[port.m_alias].erase(vlan.m_vlan_info.vlan_id);
+    if (m_portVlanMember[port.m_alias].empty())
+    {
+        m_portVlanMember.erase(port.m_alias);
+    }
+    SWSS_LOG_NOTICE("Remove member %s from VLAN %s lid:%hx vmid:%" PRIx64,
+            port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, ctx.vlan_member_id);
+
+    /* Restore to default pvid if this port joined this VLAN in untagged mode previously */
+    if (ctx.tagging_mode == SAI_VLAN_TAGGING_MODE_UNTAGGED &&
+        port.m_type != Port::TUNNEL)
+    {
+        if (!setPortPvid(port, DEFAULT_PORT_VLAN_ID))
+        {
+            return false;
+        }
+    }
+
+    m_portList[port.m_alias] = port;
+    vlan.m_members.erase(port.m_alias);
+    m_portList[vlan.m_alias] = vlan;
+    decreaseBridgePortRefCount(port);
+
+    VlanMemberUpdate update = { vlan, port, false };
+    notify(SUBJECT_TYPE_VLAN_MEMBER_CHANGE, static_cast<void *>(&update));
+
+    return true;
+}
+
 bool PortsOrch::isVlanMember(Port &vlan, Port &port, string end_point_ip)
 {
     if (!end_point_ip.empty())
@@ -8086,6 +8448,7 @@ bool PortsOrch::removeLag(Port lag)
 
     saiOidToAlias.erase(lag.m_lag_id);
     m_portList.erase(lag.m_alias);
+    m_portOidCache.clear();
     m_port_ref_count.erase(lag.m_alias);
     m_bridge_port_ref_count.erase(lag.m_alias);
 
@@ -8384,12 +8747,15 @@ bool PortsOrch::removeTunnel(Port tunnel)
 
     saiOidToAlias.erase(tunnel.m_tunnel_id);
     m_portList.erase(tunnel.m_alias);
+    m_portOidCache.clear();
 
     return true;
 }
 
 void PortsOrch::generateQueueMap(map<string, FlexCounterQueueStates> queuesStateVector)
 {
+    initPortFlexCounterGroups();
+
     if (m_isQueueMapGenerated)
     {
         return;
@@ -8821,6 +9187,8 @@ void PortsOrch::deletePortBufferQueueCounters(const Port &port, uint32_t startIn
 
 void PortsOrch::generatePriorityGroupMap(map<string, FlexCounterPgStates> pgsStateVector)
 {
+    initPortFlexCounterGroups();
+
     if (m_isPriorityGroupMapGenerated)
     {
         return;
@@ -9099,8 +9467,111 @@ void PortsOrch::deletePortBufferPgCounters(const Port& port, uint32_t startIndex
     CounterCheckOrch::getInstance().removePort(port);
 }
 
+void PortsOrch::initPortFlexCounterGroups()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_flexCounterGroupsInitialized)
+    {
+        return;
+    }
+    m_flexCounterGroupsInitialized = true;
+
+    string queueWmSha, pgWmSha, portRateSha, nvdaPortTrimSha, portFlrSha, gbPortRateSha;
+    string queueWmPluginName = "watermark_queue.lua";
+    string pgWmPluginName = "watermark_pg.lua";
+    string portRatePluginName = "port_rates.lua";
+    string nvdaPortTrimPluginName = "nvda_port_trim_drop.lua";
+    string portFlrPluginName = "port_flr.lua";
+
+    try
+    {
+        string queueLuaScript = swss::loadLuaScript(queueWmPluginName);
+        queueWmSha = swss::loadRedisScript(m_counter_db.get(), queueLuaScript);
+
+        string pgLuaScript = swss::loadLuaScript(pgWmPluginName);
+        pgWmSha = swss::loadRedisScript(m_counter_db.get(), pgLuaScript);
+
+        string portRateLuaScript = swss::loadLuaScript(portRatePluginName);
+        portRateSha = swss::loadRedisScript(m_counter_db.get(), portRateLuaScript);
+
+        string nvdaPortTrimLuaScript = swss::loadLuaScript(nvdaPortTrimPluginName);
+        nvdaPortTrimSha = swss::loadRedisScript(m_counter_db.get(), nvdaPortTrimLuaScript);
+
+        string portFlrLuaScript = swss::loadLuaScript(portFlrPluginName);
+        portFlrSha = swss::loadRedisScript(m_counter_db.get(), portFlrLuaScript);
+
+        if (m_gearboxEnabled && m_gb_counter_db)
+        {
+            string gbportRateLuaScript = swss::loadLuaScript(portRatePluginName);
+            gbPortRateSha = swss::loadRedisScript(m_gb_counter_db.get(), gbportRateLuaScript);
+
+            // Register plugin for gearbox flex counter group
+            setFlexCounterGroupParameter(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP,
+                                        PORT_RATE_FLEX_COUNTER_POLLING_INTERVAL_MS,
+                                        STATS_MODE_READ,
+                                        PORT_PLUGIN_FIELD,
+                                        gbPortRateSha,
+                                        "",        // operation
+                                        true);     // is_gearbox = true
+        }
+    }
+    catch (const runtime_error &e)
+    {
+        SWSS_LOG_ERROR("Port flex counter groups were not set successfully: %s", e.what());
+    }
+
+    // Build portStatPlugins string, only adding non-empty plugin SHAs
+    std::string portStatPlugins;
+    if (!portRateSha.empty())
+    {
+        portStatPlugins = portRateSha;
+    }
+    if (!portFlrSha.empty())
+    {
+        if (!portStatPlugins.empty())
+        {
+            portStatPlugins += ",";
+        }
+        portStatPlugins += portFlrSha;
+    }
+
+    // Nvidia custom trim stat calculation
+    if (isMlnxPlatform() && \
+        isPortStatSupported(SAI_PORT_STAT_TRIM_PACKETS) && \
+        isPortStatSupported(SAI_PORT_STAT_TX_TRIM_PACKETS) && \
+        !isPortStatSupported(SAI_PORT_STAT_DROPPED_TRIM_PACKETS))
+    {
+        portStatPlugins += "," + nvdaPortTrimSha;
+    }
+
+    setFlexCounterGroupParameter(QUEUE_WATERMARK_STAT_COUNTER_FLEX_COUNTER_GROUP,
+                                 QUEUE_WATERMARK_FLEX_STAT_COUNTER_POLL_MSECS,
+                                 STATS_MODE_READ_AND_CLEAR,
+                                 QUEUE_PLUGIN_FIELD,
+                                 queueWmSha);
+
+    setFlexCounterGroupParameter(PG_WATERMARK_STAT_COUNTER_FLEX_COUNTER_GROUP,
+                                 PG_WATERMARK_FLEX_STAT_COUNTER_POLL_MSECS,
+                                 STATS_MODE_READ_AND_CLEAR,
+                                 PG_PLUGIN_FIELD,
+                                 pgWmSha);
+
+    setFlexCounterGroupParameter(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP,
+                                 PORT_RATE_FLEX_COUNTER_POLLING_INTERVAL_MS,
+                                 STATS_MODE_READ,
+                                 PORT_PLUGIN_FIELD,
+                                 portStatPlugins);
+
+    setFlexCounterGroupParameter(PG_DROP_STAT_COUNTER_FLEX_COUNTER_GROUP,
+                                 PG_DROP_FLEX_STAT_COUNTER_POLL_MSECS,
+                                 STATS_MODE_READ);
+}
+
 void PortsOrch::generatePortCounterMap()
 {
+    initPortFlexCounterGroups();
+
     if (m_isPortCounterMapGenerated)
     {
         return;
@@ -9130,6 +9601,8 @@ void PortsOrch::generatePortCounterMap()
 
 void PortsOrch::generatePortBufferDropCounterMap()
 {
+    initPortFlexCounterGroups();
+
     if (m_isPortBufferDropCounterMapGenerated)
     {
         return;
@@ -9475,6 +9948,8 @@ const std::vector<sai_port_serdes_attr_t>& PortsOrch::getPortPhySerdesAttrIds()
 **/
 void PortsOrch::generateWredPortCounterMap()
 {
+    initPortFlexCounterGroups();
+
     if (m_isWredPortCounterMapGenerated)
     {
         return;
@@ -10120,14 +10595,47 @@ bool PortsOrch::removeAclTableGroup(const Port &p)
     return true;
 }
 
+std::shared_ptr<PortSerdesProgram> PortsOrch::compileSerdesProgram(const map<sai_port_serdes_attr_t, SerdesValue> &serdes_attr)
+{
+    SWSS_LOG_ENTER();
+
+    auto found = m_serdesProgramCache.find(serdes_attr);
+    if (found != m_serdesProgramCache.end())
+    {
+        return found->second;
+    }
+
+    auto program = make_shared<PortSerdesProgram>();
+    program->values = serdes_attr;
+    program->attrs.reserve(serdes_attr.size() + 1);
+
+    sai_attribute_t attr;
+    attr.id = SAI_PORT_SERDES_ATTR_PORT_ID;
+    attr.value.oid = SAI_NULL_OBJECT_ID;
+    program->attrs.emplace_back(attr);
+
+    // List pointers reference program->values, whose storage stays put for
+    // the lifetime of the program
+    for (const auto &it : program->values)
+    {
+        attr.id = it.first;
+        boost::apply_visitor(SerdesValueVisitor(attr), it.second);
+        program->attrs.emplace_back(attr);
+    }
+
+    m_serdesProgramCache[serdes_attr] = program;
+    SWSS_LOG_NOTICE("Compiled serdes program with %zu attributes, %zu distinct profiles cached",
+                    serdes_attr.size(), m_serdesProgramCache.size());
+
+    return program;
+}
+
 bool PortsOrch::setPortSerdesAttribute(sai_object_id_t port_id, sai_object_id_t switch_id,
                                        map<sai_port_serdes_attr_t, SerdesValue> &serdes_attr)
 {
     SWSS_LOG_ENTER();
 
-    vector<sai_attribute_t> attr_list;
     sai_attribute_t port_attr;
-    sai_attribute_t port_serdes_attr;
     sai_status_t status;
     sai_object_id_t port_serdes_id = SAI_NULL_OBJECT_ID;
     auto flex_counters_orch = gDirectory.get<FlexCounterOrch*>();
@@ -10179,24 +10687,15 @@ bool PortsOrch::setPortSerdesAttribute(sai_object_id_t port_id, sai_object_id_t
     }
 
 
-    port_serdes_attr.id = SAI_PORT_SERDES_ATTR_PORT_ID;
-    port_serdes_attr.value.oid = port_id;
-    attr_list.emplace_back(port_serdes_attr);
     SWSS_LOG_INFO("Creating serdes for port 0x%" PRIx64, port_id);
 
-    for (auto it = serdes_attr.begin(); it != serdes_attr.end(); it++)
-    {
-        port_serdes_attr.id = it->first;
-
-        // Use boost::variant visitor to handle both vector and string types
-        boost::apply_visitor(SerdesValueVisitor(port_serdes_attr), it->second);
-
-        attr_list.emplace_back(port_serdes_attr);
-    }
-    assert(serdes_attr.size() + 1 == attr_list.size());
+    // The attribute list is pre-compiled; only the port id slot varies
+    // between applications of the same profile
+    auto program = compileSerdesProgram(serdes_attr);
+    program->attrs[0].value.oid = port_id;
     status = sai_port_api->create_port_serdes(&port_serdes_id, switch_id,
-                                              static_cast<uint32_t>(attr_list.size()),
-                                              attr_list.data());
+                                              static_cast<uint32_t>(program->attrs.size()),
+                                              program->attrs.data());
 
     if (status != SAI_STATUS_SUCCESS)
     {
@@ -10641,7 +11140,6 @@ bool PortsOrch::initGearboxPort(Port &port)
             }
 
             SWSS_LOG_NOTICE("BOX: Connected Gearbox ports; system-side:0x%" PRIx64 " to line-side:0x%" PRIx64, systemPort, linePort);
-            m_gearboxPortListLaneMap[port.m_port_id] = make_tuple(systemPort, linePort);
             port.m_line_side_id = linePort;
             saiOidToAlias[systemPort] = port.m_alias;
             saiOidToAlias[linePort] = port.m_alias;
@@ -10808,9 +11306,12 @@ bool PortsOrch::getSystemPorts()
         uint32_t spcnt = attr.value.objlist.count;
         for(i = 0; i < spcnt; i++)
         {
-            attr.id = SAI_SYSTEM_PORT_ATTR_CONFIG_INFO;
+            sai_attribute_t sp_attrs[2];
+
+            sp_attrs[0].id = SAI_SYSTEM_PORT_ATTR_CONFIG_INFO;
+            sp_attrs[1].id = SAI_SYSTEM_PORT_ATTR_TYPE;
 
-            status = sai_system_port_api->get_system_port_attribute(system_port_list[i], 1, &attr);
+            status = sai_system_port_api->get_system_port_attribute(system_port_list[i], 2, sp_attrs);
             if (status != SAI_STATUS_SUCCESS)
             {
                 SWSS_LOG_ERROR("Failed to get system port config info spid:%" PRIx64, system_port_list[i]);
@@ -10823,19 +11324,21 @@ bool PortsOrch::getSystemPorts()
 
             SWSS_LOG_NOTICE("SystemPort(0x%" PRIx64 ") - port_id:%u, switch_id:%u, core:%u, core_port:%u, speed:%u, voqs:%u",
                             system_port_list[i],
-                            attr.value.sysportconfig.port_id,
-                            attr.value.sysportconfig.attached_switch_id,
-                            attr.value.sysportconfig.attached_core_index,
-                            attr.value.sysportconfig.attached_core_port_index,
-                            attr.value.sysportconfig.speed,
-                            attr.value.sysportconfig.num_voq);
+                            sp_attrs[0].value.sysportconfig.port_id,
+                            sp_attrs[0].value.sysportconfig.attached_switch_id,
+                            sp_attrs[0].value.sysportconfig.attached_core_index,
+                            sp_attrs[0].value.sysportconfig.attached_core_port_index,
+                            sp_attrs[0].value.sysportconfig.speed,
+                            sp_attrs[0].value.sysportconfig.num_voq);
 
-            tuple<int, int, int> sp_key(attr.value.sysportconfig.attached_switch_id,
-                    attr.value.sysportconfig.attached_core_index,
-                    attr.value.sysportconfig.attached_core_port_index);
+            tuple<int, int, int> sp_key(sp_attrs[0].value.sysportconfig.attached_switch_id,
+                    sp_attrs[0].value.sysportconfig.attached_core_index,
+                    sp_attrs[0].value.sysportconfig.attached_core_port_index);
 
             systemPortMapInfo system_port_info;
             system_port_info.system_port_id = system_port_list[i];
+            system_port_info.config = sp_attrs[0].value.sysportconfig;
+            system_port_info.type = (sai_system_port_type_t) sp_attrs[1].value.s32;
             m_systemPortOidMap[sp_key] = system_port_info;
         }
     }
@@ -10863,24 +11366,23 @@ bool PortsOrch::getRecircPort(Port &port, Port::Role role)
 
 bool PortsOrch::addSystemPorts()
 {
-    vector<string> keys;
-    vector<FieldValueTuple> spFv;
-
     DBConnector appDb("APPL_DB", 0);
     Table appSystemPortTable(&appDb, APP_SYSTEM_PORT_TABLE_NAME);
 
-    //Retrieve system port configurations from APP DB
-    appSystemPortTable.getKeys(keys);
-    for ( auto &alias : keys )
+    //Retrieve all system port configurations from APP DB in one dump
+    //instead of one round trip per port; a chassis can carry thousands
+    vector<KeyOpFieldsValuesTuple> entries;
+    appSystemPortTable.getContent(entries);
+    for ( auto &entry : entries )
     {
-        appSystemPortTable.get(alias, spFv);
+        const string &alias = kfvKey(entry);
 
         int32_t system_port_id = -1;
         int32_t switch_id = -1;
         int32_t core_index = -1;
         int32_t core_port_index = -1;
 
-        for ( auto &fv : spFv )
+        for ( auto &fv : kfvFieldsValues(entry) )
         {
             if(fv.first == "switch_id")
             {
@@ -10915,41 +11417,23 @@ bool PortsOrch::addSystemPorts()
 
         if(m_systemPortOidMap.find(sp_key) != m_systemPortOidMap.end())
         {
-
             sai_attribute_t attr;
-            vector<sai_attribute_t> attrs;
             sai_object_id_t system_port_oid;
             sai_status_t status;
 
-            //Retrive system port config info and enable
-            system_port_oid = m_systemPortOidMap[sp_key].system_port_id;
-
-
-            attr.id = SAI_SYSTEM_PORT_ATTR_TYPE;
-            attrs.push_back(attr);
-
-            attr.id = SAI_SYSTEM_PORT_ATTR_CONFIG_INFO;
-            attrs.push_back(attr);
-
-            status = sai_system_port_api->get_system_port_attribute(system_port_oid, static_cast<uint32_t>(attrs.size()), attrs.data());
-            if (status != SAI_STATUS_SUCCESS)
-            {
-                SWSS_LOG_ERROR("Failed to get system port config info spid:%" PRIx64, system_port_oid);
-                task_process_status handle_status = handleSaiGetStatus(SAI_API_SYSTEM_PORT, status);
-                if (handle_status != task_process_status::task_success)
-                {
-                    continue;
-                }
-            }
+            //Config and type were read back when the system ports were
+            //discovered; no further SAI queries are needed per port
+            const systemPortMapInfo &sp_info = m_systemPortOidMap[sp_key];
+            system_port_oid = sp_info.system_port_id;
 
             //Create or update system port and add to the port list.
             Port port(alias, Port::SYSTEM);
             port.m_port_id = system_port_oid;
             port.m_admin_state_up = true;
             port.m_oper_status = SAI_PORT_OPER_STATUS_UP;
-            port.m_speed = attrs[1].value.sysportconfig.speed;
+            port.m_speed = sp_info.config.speed;
             port.m_mtu = DEFAULT_SYSTEM_PORT_MTU;
-            if (attrs[0].value.s32 == SAI_SYSTEM_PORT_TYPE_LOCAL)
+            if (sp_info.type == SAI_SYSTEM_PORT_TYPE_LOCAL)
             {
                 //Get the local port oid
                 attr.id = SAI_SYSTEM_PORT_ATTR_PORT;
@@ -10978,13 +11462,13 @@ bool PortsOrch::addSystemPorts()
             port.m_system_port_oid = system_port_oid;
 
             port.m_system_port_info.alias = alias;
-            port.m_system_port_info.type = (sai_system_port_type_t) attrs[0].value.s32;
-            port.m_system_port_info.port_id = attrs[1].value.sysportconfig.port_id;
-            port.m_system_port_info.switch_id = attrs[1].value.sysportconfig.attached_switch_id;
-            port.m_system_port_info.core_index = attrs[1].value.sysportconfig.attached_core_index;
-            port.m_system_port_info.core_port_index = attrs[1].value.sysportconfig.attached_core_port_index;
-            port.m_system_port_info.speed = attrs[1].value.sysportconfig.speed;
-            port.m_system_port_info.num_voq = attrs[1].value.sysportconfig.num_voq;
+            port.m_system_port_info.type = sp_info.type;
+            port.m_system_port_info.port_id = sp_info.config.port_id;
+            port.m_system_port_info.switch_id = sp_info.config.attached_switch_id;
+            port.m_system_port_info.core_index = sp_info.config.attached_core_index;
+            port.m_system_port_info.core_port_index = sp_info.config.attached_core_port_index;
+            port.m_system_port_info.speed = sp_info.config.speed;
+            port.m_system_port_info.num_voq = sp_info.config.num_voq;
 
             //Update the system Port Info to the m_systemPortOidMap to be used later when the Port Speed is changed dynamically
             m_systemPortOidMap[sp_key].system_port_info = port.m_system_port_info;
@@ -1,6 +1,7 @@
 #ifndef SWSS_PORTSORCH_H
 #define SWSS_PORTSORCH_H
 
+#include <chrono>
 #include <map>
 #include <unordered_set>
 
@@ -13,6 +14,7 @@
 #include "flex_counter_manager.h"
 #include "gearboxutils.h"
 #include "saihelper.h"
+#include "bulker.h"
 #include "lagid.h"
 #include "flexcounterorch.h"
 #include "events.h"
@@ -85,6 +87,19 @@ static const std::map<std::string, sai_port_serdes_attr_t> tx_fir_strings_line_s
     {"line_tx_fir_main", SAI_PORT_SERDES_ATTR_TX_FIR_MAIN}
 };
 
+/*
+ * Serdes attributes compiled into a ready-to-apply SAI attribute list.
+ * The values map owns the backing storage the list pointers reference,
+ * so a program is compiled once per distinct tuning profile and applied
+ * to any number of ports without rebuilding the list. attrs[0] is the
+ * SAI_PORT_SERDES_ATTR_PORT_ID slot patched at apply time.
+ */
+struct PortSerdesProgram
+{
+    std::map<sai_port_serdes_attr_t, SerdesValue> values;
+    std::vector<sai_attribute_t> attrs;
+};
+
 struct PortUpdate
 {
     Port port;
@@ -124,6 +139,10 @@ struct systemPortMapInfo
     sai_object_id_t system_port_id;
     SystemPortInfo system_port_info;
     bool info_valid = false;
+    // Config and type read back once at discovery, so APP DB ingestion
+    // does not have to query SAI again for every system port
+    sai_system_port_config_t config;
+    sai_system_port_type_t type = SAI_SYSTEM_PORT_TYPE_REMOTE;
 };
 
 template<typename T>
@@ -204,6 +223,7 @@ public:
     bool bindUnbindAclTableGroup(Port &port,
                                  bool ingress,
                                  bool bind);
+    void flushAclTableGroupQuarantine();
     bool getPortPfc(sai_object_id_t portId, uint8_t *pfc_bitmask);
     bool setPortPfc(sai_object_id_t portId, uint8_t pfc_bitmask);
 
@@ -300,7 +320,9 @@ public:
     task_process_status setPortFastLinkupEnabled(Port &port, bool enable);
 
 private:
-    unique_ptr<CounterNameMapUpdater> m_counterNameMapUpdater;
+    const Port *getPortRef(sai_object_id_t id);
+
+    shared_ptr<CounterNameMapUpdater> m_counterNameMapUpdater;
     unique_ptr<Table> m_counterSysPortTable;
     unique_ptr<Table> m_counterLagTable;
     unique_ptr<Table> m_portSerdesIdToPortIdTable;
@@ -308,17 +330,31 @@ private:
     unique_ptr<Table> m_sendToIngressPortTable;
     unique_ptr<Table> m_systemPortTable;
     unique_ptr<Table> m_gearboxTable;
-    unique_ptr<CounterNameMapUpdater> m_queueCounterNameMapUpdater;
+    shared_ptr<CounterNameMapUpdater> m_queueCounterNameMapUpdater;
     unique_ptr<Table> m_voqTable;
     unique_ptr<Table> m_queuePortTable;
     unique_ptr<Table> m_queueIndexTable;
     unique_ptr<Table> m_queueTypeTable;
-    unique_ptr<CounterNameMapUpdater> m_pgCounterNameMapUpdater;
+    shared_ptr<CounterNameMapUpdater> m_pgCounterNameMapUpdater;
     unique_ptr<Table> m_pgPortTable;
     unique_ptr<Table> m_pgIndexTable;
     unique_ptr<Table> m_stateBufferMaximumValueTable;
+    unique_ptr<Table> m_queueStatsTable;
     Table m_portStateTable;
     Table m_portOpErrTable;
+    Table m_portTeardownTable;
+
+    /* Per-phase progress of an in-flight port removal (dynamic breakout).
+     * Timings are published to STATE_DB PORT_TEARDOWN_TABLE so a slow
+     * breakout can be pinned to the phase that is actually stalling. */
+    struct PortTeardownProgress
+    {
+        std::chrono::steady_clock::time_point del_received;
+        std::chrono::steady_clock::time_point deps_cleared;
+        uint32_t retries = 0;
+        bool deps_done = false;
+    };
+    map<string, PortTeardownProgress> m_portTeardownProgress;
 
     std::string getQueueWatermarkFlexCounterTableKey(std::string s);
     std::string getPriorityGroupWatermarkFlexCounterTableKey(std::string s);
@@ -381,7 +417,6 @@ private:
     map<int, gearbox_interface_t> m_gearboxInterfaceMap;
     map<int, gearbox_lane_t> m_gearboxLaneMap;
     map<int, gearbox_port_t> m_gearboxPortMap;
-    map<sai_object_id_t, tuple<sai_object_id_t, sai_object_id_t>> m_gearboxPortListLaneMap;
 
     unordered_set<string> m_vlanPorts;
     port_config_state_t m_portConfigState = PORT_CONFIG_MISSING;
@@ -397,9 +432,19 @@ private:
      * coming from SAI
      */
     unordered_map<sai_object_id_t, string> saiOidToAlias;
+    /* Lazily built OID -> port object shortcut for getPort(oid), so hot
+     * consumers (FDB events, mirror updates) skip the string-keyed
+     * m_portList lookup. Values point into m_portList, whose std::map
+     * nodes are address-stable; the cache is dropped whenever a port
+     * object is erased. */
+    unordered_map<sai_object_id_t, Port*> m_portOidCache;
     unordered_map<sai_object_id_t, uint16_t> m_portOidToIndex;
     map<string, uint32_t> m_port_ref_count;
     unordered_set<string> m_pendingPortSet;
+    /* Empty ACL table groups parked for reuse instead of being destroyed
+     * on the last member removal; reaped by flushAclTableGroupQuarantine()
+     * once the ACL drain that emptied them is over */
+    set<pair<sai_object_id_t, acl_stage_type_t>> m_emptyAclTableGroups;
     const uint32_t max_flood_control_types = 4;
     set<sai_vlan_flood_control_type_t> uuc_sup_flood_control_type;
     set<sai_vlan_flood_control_type_t> bc_sup_flood_control_type;
@@ -422,10 +467,33 @@ private:
     void doTask() override;
     void onWarmBootEnd() override;
     void doTask(Consumer &consumer);
+    void updateConsumerQueueStats(const std::string &tableName, size_t queued, size_t pending,
+                                  const std::chrono::steady_clock::time_point &drainStart);
     void doPortTask(Consumer &consumer);
     void doSendToIngressPortTask(Consumer &consumer);
     void doVlanTask(Consumer &consumer);
     void doVlanMemberTask(Consumer &consumer);
+
+    /* Context for a VLAN member travelling through m_vlanMemberBulker:
+     * the pre-phase queues the SAI operation, the post-phase applies the
+     * bookkeeping once the flushed status is known. Port objects are
+     * re-fetched in the post-phase so members batched for the same VLAN
+     * do not overwrite each other's state. */
+    struct VlanMemberContext
+    {
+        std::string vlan_alias;
+        std::string port_alias;
+        sai_vlan_tagging_mode_t tagging_mode = SAI_VLAN_TAGGING_MODE_UNTAGGED;
+        sai_object_id_t vlan_member_id = SAI_NULL_OBJECT_ID;
+        sai_status_t remove_status = SAI_STATUS_NOT_EXECUTED;
+    };
+
+    void addVlanMemberBulk(const Port &vlan, const Port &port, VlanMemberContext &ctx);
+    bool addVlanMemberPost(VlanMemberContext &ctx);
+    void removeVlanMemberBulk(const Port &vlan, const Port &port, VlanMemberContext &ctx);
+    bool removeVlanMemberPost(VlanMemberContext &ctx);
+
+    ObjectBulker<sai_vlan_api_t> m_vlanMemberBulker;
     void doLagTask(Consumer &consumer);
     void doLagMemberTask(Consumer &consumer);
     void doTransceiverPresenceCheck(Consumer &consumer);
@@ -515,6 +583,11 @@ private:
 
     bool getQueueTypeAndIndex(sai_object_id_t queue_id, sai_queue_type_t &type, uint8_t &index);
 
+    /* Deferred from the constructor; runs once on the first counter group
+     * enable so disabled-telemetry systems skip the plugin/group setup */
+    bool m_flexCounterGroupsInitialized = false;
+    void initPortFlexCounterGroups();
+
     bool m_isQueueMapGenerated = false;
     void generateQueueMapPerPort(const Port& port, FlexCounterQueueStates& queuesState, bool voq);
     bool m_isQueueFlexCountersAdded = false;
@@ -578,6 +651,11 @@ private:
     void refreshPortStateLinkTraining(const Port &port);
 
     void getPortSerdesVal(const std::string& s, std::vector<uint32_t> &lane_values, int base = 16);
+
+    /* Compiled serdes programs keyed by the tuning profile they were built
+     * from; platforms reuse a handful of profiles across all ports */
+    std::map<std::map<sai_port_serdes_attr_t, SerdesValue>, std::shared_ptr<PortSerdesProgram>> m_serdesProgramCache;
+    std::shared_ptr<PortSerdesProgram> compileSerdesProgram(const std::map<sai_port_serdes_attr_t, SerdesValue> &serdes_attr);
     bool setPortSerdesAttribute(sai_object_id_t port_id, sai_object_id_t switch_id,
                                 std::map<sai_port_serdes_attr_t, SerdesValue> &serdes_attr);
 
@@ -654,6 +732,10 @@ private:
     // Port config aggregator
     std::unordered_map<std::string, std::unordered_map<std::string, std::string>> m_portConfigMap;
 
+    // Last successfully applied field-values per created port, used to
+    // skip unchanged attributes on config re-pushes
+    std::unordered_map<std::string, std::unordered_map<std::string, std::string>> m_appliedPortConfig;
+
     // Port OA capabilities
     PortCapabilities m_portCap;
 
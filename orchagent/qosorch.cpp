@@ -121,6 +121,28 @@ map<string, string> qos_to_ref_table_map = {
 
 #define PORT_NAME_GLOBAL "global"
 
+map<string, size_t> QosMapHandler::m_lastAppliedContent;
+
+size_t QosMapHandler::contentHash(const KeyOpFieldsValuesTuple &tuple)
+{
+    /* Field order in the tuple is not stable across config pushes,
+     * so sort before hashing */
+    vector<string> fields;
+    for (const auto &fv : kfvFieldsValues(tuple))
+    {
+        fields.push_back(fvField(fv) + ":" + fvValue(fv));
+    }
+    sort(fields.begin(), fields.end());
+
+    string content;
+    for (const auto &field : fields)
+    {
+        content += field + "|";
+    }
+
+    return hash<string>{}(content);
+}
+
 task_process_status QosMapHandler::processWorkItem(Consumer& consumer, KeyOpFieldsValuesTuple &tuple)
 {
     SWSS_LOG_ENTER();
@@ -141,6 +163,17 @@ task_process_status QosMapHandler::processWorkItem(Consumer& consumer, KeyOpFiel
     }
     if (op == SET_COMMAND)
     {
+        auto content_key = qos_map_type_name + ":" + qos_object_name;
+        auto content_hash = contentHash(tuple);
+        if (SAI_NULL_OBJECT_ID != sai_object)
+        {
+            auto last_it = m_lastAppliedContent.find(content_key);
+            if (last_it != m_lastAppliedContent.end() && last_it->second == content_hash)
+            {
+                SWSS_LOG_INFO("Content of [%s:%s] is unchanged, skipping", qos_map_type_name.c_str(), qos_object_name.c_str());
+                return task_process_status::task_success;
+            }
+        }
         vector<sai_attribute_t> attributes;
         if (!convertFieldValuesToAttributes(tuple, attributes))
         {
@@ -169,6 +202,7 @@ task_process_status QosMapHandler::processWorkItem(Consumer& consumer, KeyOpFiel
             (*(QosOrch::getTypeMap()[qos_map_type_name]))[qos_object_name].m_pendingRemove = false;
             SWSS_LOG_NOTICE("Created [%s:%s]", qos_map_type_name.c_str(), qos_object_name.c_str());
         }
+        m_lastAppliedContent[content_key] = content_hash;
         freeAttribResources(attributes);
     }
     else if (op == DEL_COMMAND)
@@ -192,6 +226,7 @@ task_process_status QosMapHandler::processWorkItem(Consumer& consumer, KeyOpFiel
         }
         auto it_to_delete = (QosOrch::getTypeMap()[qos_map_type_name])->find(qos_object_name);
         (QosOrch::getTypeMap()[qos_map_type_name])->erase(it_to_delete);
+        m_lastAppliedContent.erase(qos_map_type_name + ":" + qos_object_name);
     }
     else
     {
@@ -2172,6 +2207,7 @@ task_process_status QosOrch::handlePortQosMapTable(Consumer& consumer, KeyOpFiel
         }
     }
 
+    vector<Port> ports;
     for (string port_name : port_names)
     {
         Port port;
@@ -2183,26 +2219,52 @@ task_process_status QosOrch::handlePortQosMapTable(Consumer& consumer, KeyOpFiel
             continue;
         }
 
-        /* Apply a list of attributes to be applied */
+        ports.push_back(port);
+    }
+
+    /* Apply the list of attributes across all ports in one bulk call */
+    vector<sai_object_id_t> oids;
+    vector<sai_attribute_t> attrs;
+    vector<pair<string, string>> map_port_names;
+    for (const auto &port : ports)
+    {
         for (auto it = update_list.begin(); it != update_list.end(); it++)
         {
             sai_attribute_t attr;
             attr.id = it->first;
             attr.value.oid = it->second.second;
 
-            sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
-            if (status != SAI_STATUS_SUCCESS)
+            oids.push_back(port.m_port_id);
+            attrs.push_back(attr);
+            map_port_names.emplace_back(it->second.first, port.m_alias);
+        }
+    }
+
+    if (!oids.empty())
+    {
+        vector<sai_status_t> statuses(oids.size(), SAI_STATUS_NOT_EXECUTED);
+        sai_port_api->set_ports_attribute((uint32_t)oids.size(), oids.data(), attrs.data(),
+            SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+
+        for (size_t i = 0; i < statuses.size(); i++)
+        {
+            if (statuses[i] != SAI_STATUS_SUCCESS)
             {
                 SWSS_LOG_ERROR("Failed to apply %s to port %s, rv:%d",
-                               it->second.first.c_str(), port_name.c_str(), status);
-                task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, status);
+                               map_port_names[i].first.c_str(), map_port_names[i].second.c_str(), statuses[i]);
+                task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, statuses[i]);
                 if (handle_status != task_process_status::task_success)
                 {
                     return task_process_status::task_invalid_entry;
                 }
             }
-            SWSS_LOG_INFO("Applied %s to port %s", it->second.first.c_str(), port_name.c_str());
+            SWSS_LOG_INFO("Applied %s to port %s", map_port_names[i].first.c_str(), map_port_names[i].second.c_str());
         }
+    }
+
+    for (const auto &port : ports)
+    {
+        string port_name = port.m_alias;
 
         sai_uint8_t old_pfc_enable = 0;
         if (!gPortsOrch->getPortPfc(port.m_port_id, &old_pfc_enable))
@@ -71,6 +71,13 @@ public:
     virtual bool modifyQosItem(sai_object_id_t, vector<sai_attribute_t> &attributes);
     virtual sai_object_id_t addQosItem(const vector<sai_attribute_t> &attributes) = 0;//different for sub-classes
     virtual bool removeQosItem(sai_object_id_t sai_object);
+
+private:
+    static size_t contentHash(const KeyOpFieldsValuesTuple &tuple);
+    /* Content hash of the last applied field-values per map object, keyed by
+     * "table:object". A SET whose resolved content is unchanged is skipped
+     * instead of being re-pushed to SAI on every config reload. */
+    static std::map<std::string, size_t> m_lastAppliedContent;
 };
 
 class DscpToTcMapHandler : public QosMapHandler
@@ -15,6 +15,78 @@
 using namespace std;
 using namespace swss;
 
+static inline uint64_t hashFieldName(const std::string& str, uint64_t seed)
+{
+    /* FNV-1a, seeded so that reseeding yields an independent hash function */
+    uint64_t h = 14695981039346656037ULL ^ seed;
+    for (const char c : str)
+    {
+        h = (h ^ static_cast<uint8_t>(c)) * 1099511628211ULL;
+    }
+    return h;
+}
+
+void Request::compileAttrSchema()
+{
+    const auto& attrs = request_description_.attr_item_types;
+    if (attrs.empty())
+    {
+        return;
+    }
+
+    size_t table_size = 1;
+    while (table_size < attrs.size() * 2)
+    {
+        table_size <<= 1;
+    }
+
+    /*
+     * Schemas are small (a dozen attributes at most), so a seed making the
+     * hash collision-free over the table is found within a few attempts;
+     * grow the table in the unlikely case a whole round of seeds fails.
+     */
+    while (true)
+    {
+        for (uint64_t seed = 0; seed < 64; seed++)
+        {
+            std::vector<const std::pair<const std::string, request_types_t>*> table(table_size, nullptr);
+            bool collision = false;
+            for (const auto& item : attrs)
+            {
+                auto& slot = table[hashFieldName(item.first, seed) & (table_size - 1)];
+                if (slot != nullptr)
+                {
+                    collision = true;
+                    break;
+                }
+                slot = &item;
+            }
+            if (!collision)
+            {
+                attr_dispatch_ = std::move(table);
+                attr_hash_seed_ = seed;
+                attr_dispatch_mask_ = table_size - 1;
+                return;
+            }
+        }
+        table_size <<= 1;
+    }
+}
+
+const request_types_t* Request::findAttrType(const std::string& name) const
+{
+    if (attr_dispatch_.empty())
+    {
+        return nullptr;
+    }
+
+    const auto* item = attr_dispatch_[hashFieldName(name, attr_hash_seed_) & attr_dispatch_mask_];
+    if (item != nullptr && item->first == name)
+    {
+        return &item->second;
+    }
+    return nullptr;
+}
 
 void Request::parse(const KeyOpFieldsValuesTuple& request)
 {
@@ -143,8 +215,6 @@ void Request::parseKey(const KeyOpFieldsValuesTuple& request)
 
 void Request::parseAttrs(const KeyOpFieldsValuesTuple& request)
 {
-    const auto not_found = std::end(request_description_.attr_item_types);
-
     for (auto i = kfvFieldsValues(request).begin();
          i != kfvFieldsValues(request).end(); i++)
     {
@@ -154,8 +224,8 @@ void Request::parseAttrs(const KeyOpFieldsValuesTuple& request)
             // it's used when we don't have any attributes, but we have to provide one for redis
             continue;
         }
-        const auto item = request_description_.attr_item_types.find(fvField(*i));
-        if (item == not_found)
+        const auto* attr_type = findAttrType(fvField(*i));
+        if (attr_type == nullptr)
         {
             if (!relaxed_attr_parsing_)
             {
@@ -168,7 +238,7 @@ void Request::parseAttrs(const KeyOpFieldsValuesTuple& request)
         }
 
         attr_names_.insert(fvField(*i));
-        switch(item->second)
+        switch(*attr_type)
         {
             case REQ_T_STRING:
                 attr_item_strings_[fvField(*i)] = fvValue(*i);
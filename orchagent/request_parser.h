@@ -190,10 +190,14 @@ protected:
           relaxed_attr_parsing_(relaxed_attr_parsing),
           number_of_key_items_(request_description.key_item_types.size())
     {
+        compileAttrSchema();
     }
 
 
 private:
+    void compileAttrSchema();
+    const request_types_t* findAttrType(const std::string& name) const;
+
     void parseOperation(const swss::KeyOpFieldsValuesTuple& request);
     void parseKey(const swss::KeyOpFieldsValuesTuple& request);
     void parseAttrs(const swss::KeyOpFieldsValuesTuple& request);
@@ -213,6 +217,16 @@ private:
     sai_packet_action_t parsePacketAction(const std::string& str);
 
     const request_description_t& request_description_;
+    /*
+     * Schema compiled at construction time: a collision-free hash table over
+     * the attribute names, so field dispatch while parsing is a single hash
+     * and one string compare instead of a generic map lookup. The entries
+     * point into request_description_.attr_item_types, whose nodes are
+     * stable for the lifetime of the request.
+     */
+    std::vector<const std::pair<const std::string, request_types_t>*> attr_dispatch_;
+    uint64_t attr_hash_seed_ = 0;
+    size_t attr_dispatch_mask_ = 0;
     char key_separator_;
     bool is_parsed_;
     size_t number_of_key_items_;
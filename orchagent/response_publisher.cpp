@@ -5,9 +5,17 @@
 #include <string>
 #include <vector>
 
+#include "pipelineperf.h"
+
 namespace
 {
 
+// The publisher is one of the heaviest redis producers during convergence:
+// every programmed entry leaves through these pipelines. Size them well
+// above the library default so bursts coalesce instead of self-flushing
+// every 128 commands.
+constexpr size_t kPipelineSize = 4096;
+
 // Returns the component string that we need to prepend for sending the error
 // message.
 // Returns an empty string if the status is OK.
@@ -68,8 +76,8 @@ ResponsePublisher::ResponsePublisher(const std::string& dbName, bool buffered,
                                      bool db_write_thread,
                                      swss::ZmqServer* zmqServer)
     : m_db(std::make_unique<swss::DBConnector>(dbName, 0)),
-      m_ntf_pipe(std::make_unique<swss::RedisPipeline>(m_db.get())),
-      m_db_pipe(std::make_unique<swss::RedisPipeline>(m_db.get())),
+      m_ntf_pipe(std::make_unique<swss::RedisPipeline>(m_db.get(), kPipelineSize)),
+      m_db_pipe(std::make_unique<swss::RedisPipeline>(m_db.get(), kPipelineSize)),
       m_buffered(buffered),
       m_zmqServer(zmqServer)
 {
@@ -97,31 +105,59 @@ void ResponsePublisher::publish(const std::string &table, const std::string &key
                                 const std::vector<swss::FieldValueTuple> &intent_attrs, const ReturnCode &status,
                                 const std::vector<swss::FieldValueTuple> &state_attrs, bool replace)
 {
-    auto intent_attrs_copy = intent_attrs;
-    // Add error message as the first field-value-pair.
-    swss::FieldValueTuple err_str("err_str", PrependedComponent(status) + status.message());
-    intent_attrs_copy.insert(intent_attrs_copy.begin(), err_str);
-    std::string response_channel = "APPL_DB_" + table + "_RESPONSE_CHANNEL";
+    bool record = swss::Recorder::Instance().respub.isRecord();
+    // The recorder wants the attributes prefixed with the error message; only
+    // assemble that copy when a consumer actually needs it.
+    auto recordResponseWithErrStr = [&]() {
+        auto intent_attrs_copy = intent_attrs;
+        swss::FieldValueTuple err_str("err_str", PrependedComponent(status) + status.message());
+        intent_attrs_copy.insert(intent_attrs_copy.begin(), err_str);
+        RecordResponse("APPL_DB_" + table + "_RESPONSE_CHANNEL", key, intent_attrs_copy, status.codeStr());
+    };
 
     if (m_enable_db_write_and_notify) {
       if (m_zmqServer != nullptr) {
-        auto intent_attrs_zmq_copy = intent_attrs;
-        // Add status code and error message as the first field-value-pair.
-        swss::FieldValueTuple fvs(status.codeStr(),
-                                  PrependedComponent(status) + status.message());
-        intent_attrs_zmq_copy.insert(intent_attrs_zmq_copy.begin(), fvs);
-        // Queue the response.
-        responses[table].push_back(
-            swss::KeyOpFieldsValuesTuple{key, SET_COMMAND, intent_attrs_zmq_copy});
+        // Queue the response, built in place in the per-table batch: the
+        // status pair first, then the intent attributes, with storage
+        // reserved up front instead of a copy plus front insert per entry.
+        auto &batch = responses[table];
+        batch.emplace_back();
+        auto &response = batch.back();
+        kfvKey(response) = key;
+        kfvOp(response) = SET_COMMAND;
+        auto &values = kfvFieldsValues(response);
+        values.reserve(intent_attrs.size() + 1);
+        values.emplace_back(status.codeStr(),
+                            PrependedComponent(status) + status.message());
+        values.insert(values.end(), intent_attrs.begin(), intent_attrs.end());
+        if (record)
+        {
+            recordResponseWithErrStr();
+        }
       } else {
+        auto intent_attrs_copy = intent_attrs;
+        // Add error message as the first field-value-pair.
+        swss::FieldValueTuple err_str("err_str", PrependedComponent(status) + status.message());
+        intent_attrs_copy.insert(intent_attrs_copy.begin(), err_str);
+        std::string response_channel = "APPL_DB_" + table + "_RESPONSE_CHANNEL";
+
         // Sends the response to the notification channel.
-        swss::NotificationProducer notificationProducer{
-            m_ntf_pipe.get(), response_channel, m_buffered};
-        notificationProducer.send(status.codeStr(), key, intent_attrs_copy);
+        auto notifier_it = m_notifiers.find(response_channel);
+        if (notifier_it == m_notifiers.end())
+        {
+            notifier_it = m_notifiers
+                              .emplace(std::piecewise_construct, std::forward_as_tuple(response_channel),
+                                       std::forward_as_tuple(m_ntf_pipe.get(), response_channel, m_buffered))
+                              .first;
+        }
+        notifier_it->second.send(status.codeStr(), key, intent_attrs_copy);
+        RecordResponse(response_channel, key, intent_attrs_copy, status.codeStr());
       }
     }
-
-    RecordResponse(response_channel, key, intent_attrs_copy, status.codeStr());
+    else if (record)
+    {
+        recordResponseWithErrStr();
+    }
 
     // Write to the DB only if: m_enable_db_write_and_notify is true and:
     // 1) A write operation is being performed and state attributes are specified.
@@ -171,7 +207,15 @@ void ResponsePublisher::writeToDBInternal(const std::string &table, const std::s
                                           const std::vector<swss::FieldValueTuple> &values, const std::string &op,
                                           bool replace)
 {
-    swss::Table applStateTable{m_db_pipe.get(), table, m_buffered};
+    auto table_it = m_stateTables.find(table);
+    if (table_it == m_stateTables.end())
+    {
+        table_it = m_stateTables
+                       .emplace(std::piecewise_construct, std::forward_as_tuple(table),
+                                std::forward_as_tuple(m_db_pipe.get(), table, m_buffered))
+                       .first;
+    }
+    swss::Table &applStateTable = table_it->second;
 
     auto attrs = values;
     if (op == SET_COMMAND)
@@ -181,14 +225,20 @@ void ResponsePublisher::writeToDBInternal(const std::string &table, const std::s
             applStateTable.set(key, attrs);
             return;
         }
-        if (replace)
-        {
-            applStateTable.del(key);
-        }
         if (!values.size())
         {
             attrs.push_back(swss::FieldValueTuple("NULL", "NULL"));
         }
+        if (replace)
+        {
+            // The delete guarantees the key is absent when the set applies, so
+            // the existence check below is skipped and the whole operation
+            // stays on the buffered pipeline instead of forcing a flush and a
+            // read round trip per entry.
+            applStateTable.del(key);
+            applStateTable.set(key, attrs);
+            return;
+        }
 
         // Write to DB only if the key does not exist or non-NULL attributes are
         // being written to the entry.
@@ -222,12 +272,19 @@ void ResponsePublisher::writeToDBInternal(const std::string &table, const std::s
 
 void ResponsePublisher::flush() {
   if (m_zmqServer != nullptr) {
-    for (const auto& response : responses) {
+    for (auto& response : responses) {
+      if (response.second.empty())
+      {
+          continue;
+      }
       m_zmqServer->sendMsg("APPL_DB", response.first, response.second);
+      // Keep the per-table batch storage; the next drain refills it
+      response.second.clear();
     }
-    responses.clear();
   } else {
-    m_ntf_pipe->flush();
+    // Callers may be blocked waiting on the notification channel; never defer
+    PipelinePerf::Instance().flushPipeline("RESPONSE_NTF", m_ntf_pipe.get(),
+                                           false /* allowDefer */);
   }
   if (m_update_thread != nullptr)
   {
@@ -240,13 +297,17 @@ void ResponsePublisher::flush() {
   }
   else
   {
-      m_db_pipe->flush();
+      PipelinePerf::Instance().flushPipeline("RESPONSE_DB", m_db_pipe.get());
   }
 }
 
 void ResponsePublisher::setBuffered(bool buffered)
 {
     m_buffered = buffered;
+    // Cached producers and tables captured the old buffering mode; rebuild
+    // them on next use.
+    m_notifiers.clear();
+    m_stateTables.clear();
 }
 
 void ResponsePublisher::dbUpdateThread()
@@ -270,7 +331,7 @@ void ResponsePublisher::dbUpdateThread()
         }
         if (e.flush)
         {
-            m_db_pipe->flush();
+            PipelinePerf::Instance().flushPipeline("RESPONSE_DB", m_db_pipe.get());
         }
         else
         {
@@ -101,6 +101,13 @@ class ResponsePublisher : public ResponsePublisherInterface
     std::unique_ptr<swss::RedisPipeline> m_ntf_pipe;
     std::unique_ptr<swss::RedisPipeline> m_db_pipe;
 
+    // Producers and state tables are keyed by channel/table name and reused
+    // across publish calls so a drain's responses ride the buffered pipelines
+    // instead of paying per-entry object construction. Cleared when the
+    // buffering mode changes.
+    std::unordered_map<std::string, swss::NotificationProducer> m_notifiers;
+    std::unordered_map<std::string, swss::Table> m_stateTables;
+
     bool m_buffered{false};
   swss::ZmqServer* m_zmqServer;
   std::unordered_map<std::string, std::vector<swss::KeyOpFieldsValuesTuple>>
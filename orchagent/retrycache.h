@@ -11,7 +11,21 @@ enum ConstraintType
 {
     RETRY_CST_DUMMY,
     RETRY_CST_PIC,          // context doesn't exist
-    RETRY_CST_PIC_REF      // context refcnt nonzero
+    RETRY_CST_PIC_REF,     // context refcnt nonzero
+    /*
+     * Generic dependency classes so any Orch can key a failed task on the
+     * object it is waiting for. The ConstraintData carries the object name
+     * in its table's key format (e.g. "Ethernet0", "Vrf1", "10.0.0.1").
+     * The producing Orch broadcasts Orch::notifyConstraintResolved() once
+     * the object exists (or, for *_REF, once its refcount drops to zero).
+     */
+    RETRY_CST_PORT,        // port/LAG/VLAN not ready
+    RETRY_CST_INTF,        // router interface doesn't exist
+    RETRY_CST_NEIGH,       // neighbor not resolved
+    RETRY_CST_NHG,         // next hop group doesn't exist or table full
+    RETRY_CST_VRF,         // VRF doesn't exist
+    RETRY_CST_TUNNEL,      // tunnel/decap term not ready
+    RETRY_CST_REF          // object still referenced, removal blocked
 };
 
 static inline std::ostream& operator<<(std::ostream& os, ConstraintType t) {
@@ -19,6 +33,13 @@ static inline std::ostream& operator<<(std::ostream& os, ConstraintType t) {
         case ConstraintType::RETRY_CST_DUMMY:   return os << "RETRY_CST_DUMMY";
         case ConstraintType::RETRY_CST_PIC: return os << "RETRY_CST_PIC";
         case ConstraintType::RETRY_CST_PIC_REF:  return os << "RETRY_CST_PIC_REF";
+        case ConstraintType::RETRY_CST_PORT:   return os << "RETRY_CST_PORT";
+        case ConstraintType::RETRY_CST_INTF:   return os << "RETRY_CST_INTF";
+        case ConstraintType::RETRY_CST_NEIGH:  return os << "RETRY_CST_NEIGH";
+        case ConstraintType::RETRY_CST_NHG:    return os << "RETRY_CST_NHG";
+        case ConstraintType::RETRY_CST_VRF:    return os << "RETRY_CST_VRF";
+        case ConstraintType::RETRY_CST_TUNNEL: return os << "RETRY_CST_TUNNEL";
+        case ConstraintType::RETRY_CST_REF:    return os << "RETRY_CST_REF";
         default:           return os << "UNKNOWN";
     }
 }
@@ -31,22 +31,23 @@ for i = 1, n do
     local initialized = redis.call('HGET', state_table, 'INIT_DONE')
     logit(initialized)
 
-    -- Get new COUNTERS values
-    local in_octets = redis.call('HGET', counters_table_name .. ':' .. KEYS[i], 'SAI_ROUTER_INTERFACE_STAT_IN_OCTETS')
-    local in_pkts = redis.call('HGET', counters_table_name .. ':' .. KEYS[i], 'SAI_ROUTER_INTERFACE_STAT_IN_PACKETS')
-    local out_octets = redis.call('HGET', counters_table_name .. ':' .. KEYS[i], 'SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS')
-    local out_pkts = redis.call('HGET', counters_table_name .. ':' .. KEYS[i], 'SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS')
+    -- Get new COUNTERS values in one round trip
+    local counters = redis.call('HMGET', counters_table_name .. ':' .. KEYS[i],
+        'SAI_ROUTER_INTERFACE_STAT_IN_OCTETS', 'SAI_ROUTER_INTERFACE_STAT_IN_PACKETS',
+        'SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS', 'SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS')
+    local in_octets, in_pkts, out_octets, out_pkts = counters[1], counters[2], counters[3], counters[4]
 
     if not in_octets or not in_pkts or not out_octets or not out_pkts then
         return logtable
     end
 
     if initialized == "DONE" or initialized == "COUNTERS_LAST" then
-        -- Get old COUNTERS values
-        local in_octets_last = redis.call('HGET', rates_table_name .. ':' .. KEYS[i], 'SAI_ROUTER_INTERFACE_STAT_IN_OCTETS_last')
-        local in_pkts_last = redis.call('HGET', rates_table_name .. ':' .. KEYS[i], 'SAI_ROUTER_INTERFACE_STAT_IN_PACKETS_last')
-        local out_octets_last = redis.call('HGET', rates_table_name .. ':' .. KEYS[i], 'SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS_last')
-        local out_pkts_last = redis.call('HGET', rates_table_name .. ':' .. KEYS[i], 'SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS_last')
+        -- Get old COUNTERS values in one round trip
+        local counters_last = redis.call('HMGET', rates_table_name .. ':' .. KEYS[i],
+            'SAI_ROUTER_INTERFACE_STAT_IN_OCTETS_last', 'SAI_ROUTER_INTERFACE_STAT_IN_PACKETS_last',
+            'SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS_last', 'SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS_last')
+        local in_octets_last, in_pkts_last = counters_last[1], counters_last[2]
+        local out_octets_last, out_pkts_last = counters_last[3], counters_last[4]
 
         if not in_octets_last or not in_pkts_last or not out_octets_last or not out_pkts_last then
             return logtable
@@ -60,33 +61,35 @@ for i = 1, n do
 
         if initialized == "DONE" then
             -- Get old rates values
-            local rx_bps_old = redis.call('HGET', rates_table_name .. ':' .. KEYS[i], 'RX_BPS')
-            local rx_pps_old = redis.call('HGET', rates_table_name .. ':' .. KEYS[i], 'RX_PPS')
-            local tx_bps_old = redis.call('HGET', rates_table_name .. ':' .. KEYS[i], 'TX_BPS')
-            local tx_pps_old = redis.call('HGET', rates_table_name .. ':' .. KEYS[i], 'TX_PPS')
+            local rates_old = redis.call('HMGET', rates_table_name .. ':' .. KEYS[i],
+                'RX_BPS', 'RX_PPS', 'TX_BPS', 'TX_PPS')
+            local rx_bps_old, rx_pps_old, tx_bps_old, tx_pps_old = rates_old[1], rates_old[2], rates_old[3], rates_old[4]
 
             -- Smooth the rates values and store them in DB
-            redis.call('HSET', rates_table_name .. ':' .. KEYS[i], 'RX_BPS', alpha*rx_bps_new + one_minus_alpha*rx_bps_old)
-            redis.call('HSET', rates_table_name .. ':' .. KEYS[i], 'RX_PPS', alpha*rx_pps_new + one_minus_alpha*rx_pps_old)
-            redis.call('HSET', rates_table_name .. ':' .. KEYS[i], 'TX_BPS', alpha*tx_bps_new + one_minus_alpha*tx_bps_old)
-            redis.call('HSET', rates_table_name .. ':' .. KEYS[i], 'TX_PPS', alpha*tx_pps_new + one_minus_alpha*tx_pps_old)
+            redis.call('HSET', rates_table_name .. ':' .. KEYS[i],
+                'RX_BPS', alpha*rx_bps_new + one_minus_alpha*rx_bps_old,
+                'RX_PPS', alpha*rx_pps_new + one_minus_alpha*rx_pps_old,
+                'TX_BPS', alpha*tx_bps_new + one_minus_alpha*tx_bps_old,
+                'TX_PPS', alpha*tx_pps_new + one_minus_alpha*tx_pps_old)
         else
             -- Store unsmoothed initial rates values in DB
-            redis.call('HSET', rates_table_name .. ':' .. KEYS[i], 'RX_BPS', rx_bps_new)
-            redis.call('HSET', rates_table_name .. ':' .. KEYS[i], 'RX_PPS', rx_pps_new)
-            redis.call('HSET', rates_table_name .. ':' .. KEYS[i], 'TX_BPS', tx_bps_new)
-            redis.call('HSET', rates_table_name .. ':' .. KEYS[i], 'TX_PPS', tx_pps_new)
+            redis.call('HSET', rates_table_name .. ':' .. KEYS[i],
+                'RX_BPS', rx_bps_new,
+                'RX_PPS', rx_pps_new,
+                'TX_BPS', tx_bps_new,
+                'TX_PPS', tx_pps_new)
             redis.call('HSET', state_table, 'INIT_DONE', 'DONE')
         end
     else
         redis.call('HSET', state_table, 'INIT_DONE', 'COUNTERS_LAST')
     end
 
-    -- Set old COUNTERS values
-    redis.call('HSET', rates_table_name .. ':' .. KEYS[i], 'SAI_ROUTER_INTERFACE_STAT_IN_OCTETS_last', in_octets)
-    redis.call('HSET', rates_table_name .. ':' .. KEYS[i], 'SAI_ROUTER_INTERFACE_STAT_IN_PACKETS_last', in_pkts)
-    redis.call('HSET', rates_table_name .. ':' .. KEYS[i], 'SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS_last', out_octets)
-    redis.call('HSET', rates_table_name .. ':' .. KEYS[i], 'SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS_last', out_pkts)
+    -- Set old COUNTERS values in one round trip
+    redis.call('HSET', rates_table_name .. ':' .. KEYS[i],
+        'SAI_ROUTER_INTERFACE_STAT_IN_OCTETS_last', in_octets,
+        'SAI_ROUTER_INTERFACE_STAT_IN_PACKETS_last', in_pkts,
+        'SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS_last', out_octets,
+        'SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS_last', out_pkts)
 end
 
 return logtable
@@ -4,6 +4,7 @@
 #include <inttypes.h>
 #include <algorithm>
 #include "routeorch.h"
+#include "fieldvalueview.h"
 #include "nhgorch.h"
 #include "tunneldecaporch.h"
 #include "cbf/cbfnhgorch.h"
@@ -11,6 +12,7 @@
 #include "flowcounterrouteorch.h"
 #include "muxorch.h"
 #include "swssnet.h"
+#include "sai_serialize.h"
 #include "crmorch.h"
 #include "directory.h"
 
@@ -149,6 +151,7 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
 
     /* Add default IPv4 route into the m_syncdRoutes */
     m_syncdRoutes[gVirtualRouterId][default_ip_prefix] = RouteNhg();
+    m_routeDigest.add(routeAuditKey(gVirtualRouterId, default_ip_prefix));
 
     SWSS_LOG_NOTICE("Create IPv4 default route with packet action drop");
 
@@ -169,6 +172,7 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
 
     /* Add default IPv6 route into the m_syncdRoutes */
     m_syncdRoutes[gVirtualRouterId][v6_default_ip_prefix] = RouteNhg();
+    m_routeDigest.add(routeAuditKey(gVirtualRouterId, v6_default_ip_prefix));
 
     SWSS_LOG_NOTICE("Create IPv6 default route with packet action drop");
 
@@ -257,6 +261,8 @@ void RouteOrch::addLinkLocalRouteToMe(sai_object_id_t vrf_id, IpPrefix linklocal
     gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_ROUTE);
 
     gFlowCounterRouteOrch->onAddMiscRouteEntry(vrf_id, linklocal_prefix.getSubnet());
+    m_routeDigest.add(routeAuditKey(vrf_id, linklocal_prefix.getSubnet()));
+    m_miscRouteKeys.insert(routeAuditKey(vrf_id, linklocal_prefix.getSubnet()));
 
     SWSS_LOG_NOTICE("Created link local ipv6 route  %s to cpu", linklocal_prefix.to_string().c_str());
 }
@@ -280,10 +286,67 @@ void RouteOrch::delLinkLocalRouteToMe(sai_object_id_t vrf_id, IpPrefix linklocal
     gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_ROUTE);
 
     gFlowCounterRouteOrch->onRemoveMiscRouteEntry(vrf_id, linklocal_prefix.getSubnet());
+    m_routeDigest.remove(routeAuditKey(vrf_id, linklocal_prefix.getSubnet()));
+    m_miscRouteKeys.erase(routeAuditKey(vrf_id, linklocal_prefix.getSubnet()));
 
     SWSS_LOG_NOTICE("Deleted link local ipv6 route  %s to cpu", linklocal_prefix.to_string().c_str());
 }
 
+string RouteOrch::routeAuditKey(sai_object_id_t vrf_id, const IpPrefix &prefix)
+{
+    /* The ASIC destination has its host bits cleared by subnet(), so fold
+     * the masked form on our side as well */
+    return sai_serialize_object_id(vrf_id) + ":" + prefix.getSubnet().to_string();
+}
+
+AuditTarget RouteOrch::routeAuditTarget()
+{
+    AuditTarget target;
+    target.name = "route_entry";
+    target.pattern = "ASIC_STATE:SAI_OBJECT_TYPE_ROUTE_ENTRY:*";
+
+    target.canonicalize = [](const string &asicKey, string &canonical)
+    {
+        size_t json = asicKey.find('{');
+        if (json == string::npos)
+        {
+            return false;
+        }
+
+        sai_route_entry_t route_entry;
+        try
+        {
+            sai_deserialize_route_entry(asicKey.substr(json), route_entry);
+            canonical = routeAuditKey(route_entry.vr_id, getIpPrefixFromSaiPrefix(route_entry.destination));
+        }
+        catch (const exception &e)
+        {
+            SWSS_LOG_WARN("Failed to parse ASIC route key %s: %s", asicKey.c_str(), e.what());
+            return false;
+        }
+
+        return true;
+    };
+
+    target.contributors.push_back(AuditContributor{
+        "RouteOrch",
+        [this]() { return m_routeDigest; },
+        [this](set<string> &keys)
+        {
+            /* Rebuilt from scratch only during a drill-down */
+            for (const auto &table : m_syncdRoutes)
+            {
+                for (const auto &entry : table.second)
+                {
+                    keys.insert(routeAuditKey(table.first, entry.first));
+                }
+            }
+            keys.insert(m_miscRouteKeys.begin(), m_miscRouteKeys.end());
+        }});
+
+    return target;
+}
+
 void RouteOrch::updateDefRouteState(string ip, bool add)
 {
     vector<FieldValueTuple> tuples;
@@ -602,6 +665,27 @@ bool RouteOrch::invalidnexthopinNextHopGroup(const NextHopKey &nexthop, uint32_t
     return true;
 }
 
+RouteBulkContext *RouteOrch::acquireBulkContext(const std::string &key, bool is_set)
+{
+    if (m_bulkCtxInUse == m_bulkCtxPool.size())
+    {
+        m_bulkCtxPool.emplace_back(new RouteBulkContext(key, is_set));
+        m_bulkCtxInUse++;
+        return m_bulkCtxPool.back().get();
+    }
+
+    RouteBulkContext *ctx = m_bulkCtxPool[m_bulkCtxInUse++].get();
+    ctx->clear();
+    ctx->key = key;
+    ctx->is_set = is_set;
+    return ctx;
+}
+
+void RouteOrch::releaseBulkContexts()
+{
+    m_bulkCtxInUse = 0;
+}
+
 void RouteOrch::doTask(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
@@ -623,15 +707,27 @@ void RouteOrch::doTask(ConsumerBase& consumer)
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
-        // Route bulk results will be stored in a map
+        // Route bulk results will be stored in a map; the contexts are
+        // borrowed from the recycling pool for the duration of the batch
+        releaseBulkContexts();
         std::map<
                 std::pair<
                         std::string,            // Key
                         std::string             // Op
                 >,
-                RouteBulkContext
+                RouteBulkContext *
         >                                       toBulk;
 
+        /* m_toSync is key-ordered, so routes of the same VRF arrive as a
+         * contiguous run ("VrfX:..." keys sort together). Memoize the last
+         * VRF name-to-oid resolution: the VRF table cannot change underneath
+         * a single doTask() sweep, and this turns one VrfOrch lookup per
+         * route into one per VRF run. Sharding the runs onto worker threads
+         * was considered instead and does not fit: next-hop groups, their
+         * refcounts and CRM accounting are VRF-global RouteOrch state. */
+        string last_vrf_name;
+        sai_object_id_t last_vrf_id = SAI_NULL_OBJECT_ID;
+
         // Add or remove routes with a route bulker
         while (it != consumer.m_toSync.end())
         {
@@ -640,53 +736,74 @@ void RouteOrch::doTask(ConsumerBase& consumer)
             string key = kfvKey(t);
             string op = kfvOp(t);
 
-            auto rc = toBulk.emplace(std::piecewise_construct,
-                    std::forward_as_tuple(key, op),
-                    std::forward_as_tuple(key, (op == SET_COMMAND)));
+            auto rc = toBulk.emplace(std::make_pair(key, op), nullptr);
 
             bool inserted = rc.second;
-            auto& ctx = rc.first->second;
+            if (inserted)
+            {
+                rc.first->second = acquireBulkContext(key, (op == SET_COMMAND));
+            }
+            auto& ctx = *rc.first->second;
             if (!inserted)
             {
                 ctx.clear();
+                ctx.key = key;
+                ctx.is_set = (op == SET_COMMAND);
             }
 
             /* Get notification from application */
             /* resync application:
              * When routeorch receives 'resync' message, it marks all current
-             * routes as dirty and waits for 'resync complete' message. For all
-             * newly received routes, if they match current dirty routes, it unmarks
-             * them dirty. After receiving 'resync complete' message, it creates all
-             * newly added routes and removes all dirty routes.
+             * routes as dirty and waits for 'resync complete' message. Every
+             * route announced in between settles its key. After receiving the
+             * 'resync complete' message, the announced routes flow through the
+             * regular update path (a no-op when nothing changed) and only the
+             * keys nobody re-announced are deleted.
              */
             if (key == "resync")
             {
                 if (op == "SET")
                 {
-                    /* Mark all current routes as dirty (DEL) in consumer.m_toSync map */
-                    SWSS_LOG_NOTICE("Start resync routes\n");
-                    for (auto j : m_syncdRoutes)
+                    if (m_resync)
                     {
-                        string vrf;
-
-                        if (j.first != gVirtualRouterId)
+                        /* The in-flight resync still reconciles against the
+                         * full dirty set, so the upcoming replay answers this
+                         * request as well; a second walk would only repeat
+                         * the first. */
+                        SWSS_LOG_NOTICE("Absorbing route resync request into generation %" PRIu64, m_resyncGeneration);
+                    }
+                    else
+                    {
+                        m_resyncGeneration++;
+                        SWSS_LOG_NOTICE("Start resync routes, generation %" PRIu64, m_resyncGeneration);
+                        for (auto j : m_syncdRoutes)
                         {
-                            vrf = m_vrfOrch->getVRFname(j.first) + ":";
-                        }
+                            string vrf;
 
-                        for (auto i : j.second)
-                        {
-                            vector<FieldValueTuple> v;
-                            key = vrf + i.first.to_string();
-                            auto x = KeyOpFieldsValuesTuple(key, DEL_COMMAND, v);
-                            consumer.addToSync(x);
+                            if (j.first != gVirtualRouterId)
+                            {
+                                vrf = m_vrfOrch->getVRFname(j.first) + ":";
+                            }
+
+                            for (auto i : j.second)
+                            {
+                                m_resyncDirtyRoutes.emplace(vrf + i.first.to_string());
+                            }
                         }
+                        m_resync = true;
                     }
-                    m_resync = true;
                 }
                 else
                 {
-                    SWSS_LOG_NOTICE("Complete resync routes\n");
+                    SWSS_LOG_NOTICE("Complete resync routes, generation %" PRIu64 ", %zu stale routes",
+                                    m_resyncGeneration, m_resyncDirtyRoutes.size());
+                    for (const auto &stale : m_resyncDirtyRoutes)
+                    {
+                        vector<FieldValueTuple> v;
+                        auto x = KeyOpFieldsValuesTuple(stale, DEL_COMMAND, v);
+                        consumer.addToSync(x);
+                    }
+                    m_resyncDirtyRoutes.clear();
                     m_resync = false;
                 }
 
@@ -696,6 +813,9 @@ void RouteOrch::doTask(ConsumerBase& consumer)
 
             if (m_resync)
             {
+                /* Any operation on the key settles it; the task itself stays
+                 * queued and runs once the complete marker arrives */
+                m_resyncDirtyRoutes.erase(key);
                 it++;
                 continue;
             }
@@ -708,18 +828,27 @@ void RouteOrch::doTask(ConsumerBase& consumer)
                 size_t found = key.find(':');
                 string vrf_name = key.substr(0, found);
 
-                if (!m_vrfOrch->isVRFexists(vrf_name))
+                if (vrf_name == last_vrf_name)
                 {
-                    it++;
-                    continue;
+                    vrf_id = last_vrf_id;
                 }
-                vrf_id = m_vrfOrch->getVRFid(vrf_name);
-                ip_prefix = IpPrefix(key.substr(found+1));
+                else
+                {
+                    if (!m_vrfOrch->isVRFexists(vrf_name))
+                    {
+                        it++;
+                        continue;
+                    }
+                    vrf_id = m_vrfOrch->getVRFid(vrf_name);
+                    last_vrf_name = std::move(vrf_name);
+                    last_vrf_id = vrf_id;
+                }
+                ip_prefix = FieldValueView::cachedIpPrefix(key.substr(found+1));
             }
             else
             {
                 vrf_id = gVirtualRouterId;
-                ip_prefix = IpPrefix(key);
+                ip_prefix = FieldValueView::cachedIpPrefix(key);
             }
 
             if (op == SET_COMMAND)
@@ -1113,30 +1242,37 @@ void RouteOrch::doTask(ConsumerBase& consumer)
             }
         }
 
-        // Flush the route bulker, so routes will be written to syncd and ASIC
-        gRouteBulker.flush();
+        // Submit the route bulker asynchronously: the SAI bulk calls run on
+        // a worker task while we pair every pending task with its bulk
+        // context below, which only touches m_toSync and toBulk, never the
+        // object statuses.
+        gRouteBulker.flush_async();
 
-        // Go through the bulker results
-        auto it_prev = consumer.m_toSync.begin();
         m_bulkNhgReducedRefCnt.clear();
         NextHopGroupKey v4_default_nhg_key;
         NextHopGroupKey v6_default_nhg_key;
         m_bulkSrv6NhgReducedVec.clear();
 
-        while (it_prev != it)
+        std::vector<std::pair<SyncMap::iterator, RouteBulkContext *>> order;
+        order.reserve(toBulk.size());
+        for (auto it_prev = consumer.m_toSync.begin(); it_prev != it; ++it_prev)
         {
-            KeyOpFieldsValuesTuple t = it_prev->second;
-
-            string key = kfvKey(t);
-            string op = kfvOp(t);
-            auto found = toBulk.find(make_pair(key, op));
-            if (found == toBulk.end())
+            auto found = toBulk.find(make_pair(kfvKey(it_prev->second), kfvOp(it_prev->second)));
+            if (found != toBulk.end())
             {
-                it_prev++;
-                continue;
+                order.emplace_back(it_prev, found->second);
             }
+        }
+
+        // The route programming results are needed from here on
+        gRouteBulker.wait();
 
-            const auto& ctx = found->second;
+        // Go through the bulker results
+        for (const auto &ordered : order)
+        {
+            auto it_cur = ordered.first;
+            const string &op = kfvOp(it_cur->second);
+            const auto& ctx = *ordered.second;
 
             // if retry_cst field is set, move this task to retry cache:
             // - add it to retry cache before executing addRoutePost/removeRoutePost
@@ -1144,15 +1280,13 @@ void RouteOrch::doTask(ConsumerBase& consumer)
             // - delete it from m_toSync after addRoutePost/removeRoutePost to avoid duplicates
             bool rc_inserted = false;
             if (ctx.retry_cst != DUMMY_CONSTRAINT)
-                rc_inserted = consumer.addToRetry(it_prev->second, ctx.retry_cst);
+                rc_inserted = consumer.addToRetry(it_cur->second, ctx.retry_cst);
 
             const auto& object_statuses = ctx.object_statuses;
             if (object_statuses.empty())
             {
                 if (rc_inserted)
-                    it_prev = consumer.m_toSync.erase(it_prev);
-                else
-                    it_prev++;
+                    consumer.m_toSync.erase(it_cur);
                 continue;
             }
 
@@ -1163,7 +1297,7 @@ void RouteOrch::doTask(ConsumerBase& consumer)
             route_entry.vr_id = vrf_id;
             route_entry.switch_id = gSwitchId;
             copy(route_entry.destination, ip_prefix);
-            
+
             if (op == SET_COMMAND)
             {
                 const bool& excp_intfs_flag = ctx.excp_intfs_flag;
@@ -1173,9 +1307,7 @@ void RouteOrch::doTask(ConsumerBase& consumer)
                     /* If any existing routes are updated to point to the
                      * above interfaces, remove them from the ASIC. */
                     if (removeRoutePost(ctx) || rc_inserted)
-                        it_prev = consumer.m_toSync.erase(it_prev);
-                    else
-                        it_prev++;
+                        consumer.m_toSync.erase(it_cur);
                     continue;
                 }
 
@@ -1184,22 +1316,32 @@ void RouteOrch::doTask(ConsumerBase& consumer)
                 if (nhg.getSize() == 1 && nhg.hasIntfNextHop())
                 {
                     if (addRoutePost(ctx, nhg) || rc_inserted)
-                        it_prev = consumer.m_toSync.erase(it_prev);
-                    else
-                        it_prev++;
+                        consumer.m_toSync.erase(it_cur);
+                    continue;
                 }
-                else if (m_syncdRoutes.find(vrf_id) == m_syncdRoutes.end() ||
-                         m_syncdRoutes.at(vrf_id).find(ip_prefix) == m_syncdRoutes.at(vrf_id).end() ||
-                         m_syncdRoutes.at(vrf_id).at(ip_prefix) != RouteNhg(nhg, ctx.nhg_index, ctx.context_index) ||
-                         gRouteBulker.bulk_entry_pending_removal(route_entry) ||
-                         ctx.using_temp_nhg)
+
+                /* Resolve the VRF's route store once instead of per clause */
+                bool route_changed;
+                auto vrfRoutes = m_syncdRoutes.find(vrf_id);
+                if (vrfRoutes == m_syncdRoutes.end())
+                {
+                    route_changed = true;
+                }
+                else
+                {
+                    auto routeIt = vrfRoutes->second.find(ip_prefix);
+                    route_changed = routeIt == vrfRoutes->second.end() ||
+                                    routeIt->second != RouteNhg(nhg, ctx.nhg_index, ctx.context_index);
+                }
+
+                if (route_changed ||
+                    gRouteBulker.bulk_entry_pending_removal(route_entry) ||
+                    ctx.using_temp_nhg)
                 {
                     if (addRoutePost(ctx, nhg) || rc_inserted)
-                        it_prev = consumer.m_toSync.erase(it_prev);
-                    else
-                        it_prev++;
+                        consumer.m_toSync.erase(it_cur);
 
-		    // Save the Default Route of Default VRF to be used for 
+		    // Save the Default Route of Default VRF to be used for
 		    // enabling fallback to it as needed
                     if (ip_prefix.isDefaultRoute() && vrf_id == gVirtualRouterId)
                     {
@@ -1218,9 +1360,7 @@ void RouteOrch::doTask(ConsumerBase& consumer)
             {
                 /* Cannot locate the route or remove succeed */
                 if (removeRoutePost(ctx) || rc_inserted)
-                    it_prev = consumer.m_toSync.erase(it_prev);
-                else
-                    it_prev++;
+                    consumer.m_toSync.erase(it_cur);
             }
         }
 
@@ -2009,7 +2149,7 @@ bool RouteOrch::addRoute(RouteBulkContext& ctx, const NextHopGroupKey &nextHops)
 
     if (m_syncdRoutes.find(vrf_id) == m_syncdRoutes.end())
     {
-        m_syncdRoutes.emplace(vrf_id, RouteTable());
+        m_syncdRoutes.emplace(vrf_id, RouteStore());
         m_vrfOrch->increaseVrfRefCount(vrf_id);
     }
 
@@ -2706,6 +2846,7 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
     if (it_route == routeTableIter->second.end())
     {
         gFlowCounterRouteOrch->handleRouteAdd(vrf_id, ipPrefix);
+        m_routeDigest.add(routeAuditKey(vrf_id, ipPrefix));
     }
 
     m_syncdRoutes[vrf_id][ipPrefix] = RouteNhg(nextHops, ctx.nhg_index, ctx.context_index);
@@ -2983,6 +3124,7 @@ bool RouteOrch::removeRoutePost(const RouteBulkContext& ctx)
     else
     {
         it_route_table->second.erase(ipPrefix);
+        m_routeDigest.remove(routeAuditKey(vrf_id, ipPrefix));
 
         /* Notify about the route next hop removal */
         notifyNextHopChangeObservers(vrf_id, ipPrefix, NextHopGroupKey(), false);
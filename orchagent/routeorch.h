@@ -5,6 +5,9 @@
 #include "observer.h"
 #include "switchorch.h"
 #include "intfsorch.h"
+#include "routetrie.h"
+#include "labelroutestore.h"
+#include "auditorch.h"
 #include "neighorch.h"
 #include "vxlanorch.h"
 #include "srv6orch.h"
@@ -16,6 +19,7 @@
 #include "bulker.h"
 #include "fgnhgorch.h"
 #include <map>
+#include <memory>
 #include "zmqorch.h"
 #include "zmqserver.h"
 #include <unordered_map>
@@ -108,12 +112,19 @@ struct RouteKey
 
 /* NextHopGroupTable: NextHopGroupKey, NextHopGroupEntry */
 typedef std::unordered_map<NextHopGroupKey, NextHopGroupEntry> NextHopGroupTable;
-/* RouteTable: destination network, NextHopGroupKey */
+/* RouteTable: destination network, NextHopGroupKey.
+ * Ordered map: next hop observers rely on rbegin() being the longest
+ * matching prefix, so this stays a std::map. */
 typedef std::map<IpPrefix, RouteNhg> RouteTable;
-/* RouteTables: vrf_id, RouteTable */
-typedef std::map<sai_object_id_t, RouteTable> RouteTables;
-/* LabelRouteTable: destination label, next hop address(es) */
-typedef std::map<Label, RouteNhg> LabelRouteTable;
+/* RouteStore: destination network, NextHopGroupKey in a compressed binary
+ * trie; all accesses on the synced-route store are exact-match, so lookups
+ * are bounded by the prefix length instead of log(route count). */
+typedef RouteTrie<RouteNhg> RouteStore;
+/* RouteTables: vrf_id, RouteStore */
+typedef std::map<sai_object_id_t, RouteStore> RouteTables;
+/* LabelRouteTable: destination label, next hop address(es).
+ * Direct-indexed by label for O(1) lookup on the MPLS hot path. */
+typedef LabelRouteStore<RouteNhg> LabelRouteTable;
 /* LabelRouteTables: vrf_id, LabelRouteTable */
 typedef std::map<sai_object_id_t, LabelRouteTable> LabelRouteTables;
 /* Host: vrf_id, IpAddress */
@@ -169,7 +180,13 @@ struct RouteBulkContext
         object_statuses.clear();
         tmp_next_hop.clear();
         nhg.clear();
+        nhg_index.clear();
+        context_index.clear();
         ipv.clear();
+        alsv.clear();
+        vni_labelv.clear();
+        rmacv.clear();
+        vrf_group_flag = false;
         vrf_id = SAI_NULL_OBJECT_ID;
         excp_intfs_flag = false;
         using_temp_nhg = false;
@@ -271,6 +288,13 @@ public:
     bool checkNextHopGroupCount();
     const RouteTables& getSyncdRoutes() const { return m_syncdRoutes; }
 
+    /* Consistency-audit hookup: digest over every route entry this Orch
+     * has programmed, compared against ASIC_DB by AuditOrch */
+    AuditTarget routeAuditTarget();
+    /* Canonical digest key for a route entry; shared with the other route
+     * entry writers so their contributions fold into the same target */
+    static std::string routeAuditKey(sai_object_id_t vrf_id, const swss::IpPrefix &prefix);
+
 private:
     SwitchOrch *m_switchOrch;
     NeighOrch *m_neighOrch;
@@ -283,12 +307,27 @@ private:
     unsigned int m_maxNextHopGroupCount;
     bool m_resync;
 
+    /* Keys the in-flight resync has not seen re-announced yet, one set per
+     * table. Whatever remains when the complete marker arrives is stale and
+     * gets deleted; everything re-announced meanwhile goes through the
+     * regular update path, which is a no-op for unchanged routes. */
+    std::set<std::string> m_resyncDirtyRoutes;
+    std::set<std::string> m_resyncDirtyLabelRoutes;
+    /* Bumped once per accepted resync; a start marker that lands while a
+     * resync is already reconciling is absorbed into the current generation
+     * instead of restarting the full-table walk */
+    uint64_t m_resyncGeneration = 0;
+
     std::set<NextHopKey> v4_active_default_route_nhops;
     std::set<NextHopKey> v6_active_default_route_nhops;
     shared_ptr<DBConnector> m_stateDb;
     unique_ptr<swss::Table> m_stateDefaultRouteTb;
 
     RouteTables m_syncdRoutes;
+    /* Incrementally maintained audit digest over the programmed route
+     * entries, plus the misc (link-local) entries outside m_syncdRoutes */
+    AuditDigest m_routeDigest;
+    std::set<std::string> m_miscRouteKeys;
     LabelRouteTables m_syncdLabelRoutes;
     NextHopGroupTable m_syncdNextHopGroups;
     NextHopRouteTable m_nextHops;
@@ -306,6 +345,16 @@ private:
     EntityBulker<sai_mpls_api_t>            gLabelRouteBulker;
     ObjectBulker<sai_next_hop_group_api_t>  gNextHopGroupMemberBulker;
 
+    /* Recycled RouteBulkContext pool: contexts (and the capacity of their
+     * internal vectors) survive across doTask() batches, clear() is the
+     * reset hook. Entries below m_bulkCtxInUse are owned by the current
+     * batch; releaseBulkContexts() returns them all at once. */
+    std::vector<std::unique_ptr<RouteBulkContext>> m_bulkCtxPool;
+    size_t m_bulkCtxInUse = 0;
+
+    RouteBulkContext *acquireBulkContext(const std::string &key, bool is_set);
+    void releaseBulkContexts();
+
     void addTempRoute(RouteBulkContext& ctx, const NextHopGroupKey&);
 
     void addTempLabelRoute(LabelRouteBulkContext& ctx, const NextHopGroupKey&);
@@ -0,0 +1,419 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "ipprefix.h"
+
+/**
+ * RouteTrie is a compressed binary trie keyed by swss::IpPrefix, used as the
+ * synced-route store in RouteOrch. With half a million routes a red-black
+ * tree walk costs ~20 pointer chases with poor locality per lookup; the trie
+ * bounds every operation by the prefix length and only materializes nodes at
+ * branch points, so memory stays at roughly two nodes per stored route.
+ *
+ * The exposed surface is the std::map subset RouteOrch relies on: find(),
+ * at(), operator[], emplace(), erase() by key or iterator, size(), empty()
+ * and forward iteration. Nodes are individually heap-allocated, so like
+ * std::map, iterators and references stay valid under insertion and are only
+ * invalidated for erased entries. Iteration order is bit-string order of
+ * (address family, prefix bits), not IpPrefix::operator< order; RouteOrch
+ * does not depend on the order for this container.
+ *
+ * The key is encoded as a bit string: one leading byte for the address
+ * family followed by the masked address bits, so a v4 and a v6 prefix can
+ * never collide or nest.
+ */
+template <typename T>
+class RouteTrie
+{
+private:
+    /* 1 family byte + 16 address bytes */
+    static const size_t MAX_KEY_BYTES = 17;
+    static const uint16_t FAMILY_BITS = 8;
+
+    struct Node
+    {
+        uint8_t bits[MAX_KEY_BYTES] = {};
+        uint16_t len = 0;                   /* prefix length of this node, in bits */
+        Node *parent = nullptr;
+        Node *child[2] = {nullptr, nullptr};
+        std::pair<const swss::IpPrefix, T> *value = nullptr;
+
+        ~Node()
+        {
+            delete value;
+            delete child[0];
+            delete child[1];
+        }
+    };
+
+    static void encode(const swss::IpPrefix &key, uint8_t (&bits)[MAX_KEY_BYTES], uint16_t &len)
+    {
+        std::memset(bits, 0, MAX_KEY_BYTES);
+        bits[0] = key.isV4() ? 0 : 1;
+        if (key.isV4())
+        {
+            uint32_t addr = key.getIp().getV4Addr();
+            std::memcpy(&bits[1], &addr, 4);
+        }
+        else
+        {
+            std::memcpy(&bits[1], key.getIp().getV6Addr(), 16);
+        }
+        len = static_cast<uint16_t>(FAMILY_BITS + key.getMaskLength());
+    }
+
+    static bool getBit(const uint8_t *bits, uint16_t pos)
+    {
+        return (bits[pos >> 3] >> (7 - (pos & 7))) & 1;
+    }
+
+    /* Length of the common prefix of two bit strings, capped at maxLen */
+    static uint16_t commonPrefixLen(const uint8_t *a, const uint8_t *b, uint16_t maxLen)
+    {
+        uint16_t i = 0;
+        while (i < maxLen && getBit(a, i) == getBit(b, i))
+        {
+            i++;
+        }
+        return i;
+    }
+
+    Node m_root;
+    size_t m_size = 0;
+
+    /* Pre-order successor: child[0], child[1], then up and right */
+    static Node *nextNode(Node *node)
+    {
+        if (node->child[0] != nullptr)
+        {
+            return node->child[0];
+        }
+        if (node->child[1] != nullptr)
+        {
+            return node->child[1];
+        }
+        while (node->parent != nullptr)
+        {
+            Node *parent = node->parent;
+            if (parent->child[0] == node && parent->child[1] != nullptr)
+            {
+                return parent->child[1];
+            }
+            node = parent;
+        }
+        return nullptr;
+    }
+
+    static Node *nextValueNode(Node *node)
+    {
+        while (node != nullptr && node->value == nullptr)
+        {
+            node = nextNode(node);
+        }
+        return node;
+    }
+
+    Node *findNode(const swss::IpPrefix &key) const
+    {
+        uint8_t bits[MAX_KEY_BYTES];
+        uint16_t len;
+        encode(key, bits, len);
+
+        const Node *node = &m_root;
+        while (node->len < len)
+        {
+            const Node *next = node->child[getBit(bits, node->len)];
+            if (next == nullptr || next->len > len ||
+                commonPrefixLen(next->bits, bits, next->len) < next->len)
+            {
+                return nullptr;
+            }
+            node = next;
+        }
+        return (node->len == len && node->value != nullptr) ? const_cast<Node *>(node) : nullptr;
+    }
+
+    /* Unlink value-less pass-through nodes left behind by an erase */
+    void compact(Node *node)
+    {
+        while (node != &m_root && node->value == nullptr)
+        {
+            Node *parent = node->parent;
+            size_t children = (node->child[0] != nullptr) + (node->child[1] != nullptr);
+
+            if (children == 0)
+            {
+                parent->child[getBit(node->bits, parent->len)] = nullptr;
+                node->child[0] = node->child[1] = nullptr;
+                delete node;
+            }
+            else if (children == 1)
+            {
+                Node *child = node->child[0] != nullptr ? node->child[0] : node->child[1];
+                parent->child[getBit(node->bits, parent->len)] = child;
+                child->parent = parent;
+                node->child[0] = node->child[1] = nullptr;
+                delete node;
+            }
+            node = parent;
+        }
+    }
+
+public:
+    typedef std::pair<const swss::IpPrefix, T> value_type;
+
+    class iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef RouteTrie::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef value_type *pointer;
+        typedef value_type &reference;
+
+        iterator() : m_node(nullptr) {}
+        explicit iterator(Node *node) : m_node(node) {}
+
+        reference operator*() const { return *m_node->value; }
+        pointer operator->() const { return m_node->value; }
+
+        iterator &operator++()
+        {
+            m_node = nextValueNode(nextNode(m_node));
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const iterator &other) const { return m_node == other.m_node; }
+        bool operator!=(const iterator &other) const { return m_node != other.m_node; }
+
+    private:
+        friend class RouteTrie;
+        Node *m_node;
+    };
+
+    RouteTrie() = default;
+
+    RouteTrie(const RouteTrie &other)
+    {
+        for (const auto &entry : other)
+        {
+            emplace(entry.first, entry.second);
+        }
+    }
+
+    RouteTrie &operator=(const RouteTrie &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (const auto &entry : other)
+            {
+                emplace(entry.first, entry.second);
+            }
+        }
+        return *this;
+    }
+
+    ~RouteTrie() = default;
+
+    iterator begin()
+    {
+        return iterator(nextValueNode(nextNode(&m_root)));
+    }
+
+    iterator end()
+    {
+        return iterator(nullptr);
+    }
+
+    iterator begin() const
+    {
+        return const_cast<RouteTrie *>(this)->begin();
+    }
+
+    iterator end() const
+    {
+        return iterator(nullptr);
+    }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    iterator find(const swss::IpPrefix &key) const
+    {
+        return iterator(findNode(key));
+    }
+
+    size_t count(const swss::IpPrefix &key) const
+    {
+        return findNode(key) != nullptr ? 1 : 0;
+    }
+
+    /* Longest stored prefix containing key (key itself included), end() if
+     * none; cost is bounded by the key's prefix length */
+    iterator longestMatch(const swss::IpPrefix &key) const
+    {
+        uint8_t bits[MAX_KEY_BYTES];
+        uint16_t len;
+        encode(key, bits, len);
+
+        const Node *best = nullptr;
+        const Node *node = &m_root;
+        while (node != nullptr && node->len <= len &&
+               commonPrefixLen(node->bits, bits, node->len) == node->len)
+        {
+            if (node->value != nullptr)
+            {
+                best = node;
+            }
+            if (node->len == len)
+            {
+                break;
+            }
+            node = node->child[getBit(bits, node->len)];
+        }
+        return iterator(const_cast<Node *>(best));
+    }
+
+    T &at(const swss::IpPrefix &key)
+    {
+        Node *node = findNode(key);
+        if (node == nullptr)
+        {
+            throw std::out_of_range("RouteTrie::at: no entry for " + key.to_string());
+        }
+        return node->value->second;
+    }
+
+    const T &at(const swss::IpPrefix &key) const
+    {
+        return const_cast<RouteTrie *>(this)->at(key);
+    }
+
+    T &operator[](const swss::IpPrefix &key)
+    {
+        return emplace(key, T()).first->second;
+    }
+
+    std::pair<iterator, bool> emplace(const swss::IpPrefix &key, T val)
+    {
+        uint8_t bits[MAX_KEY_BYTES];
+        uint16_t len;
+        encode(key, bits, len);
+
+        Node *node = &m_root;
+        while (true)
+        {
+            if (node->len == len)
+            {
+                /* Exact node already on the path */
+                break;
+            }
+
+            Node *&slot = node->child[getBit(bits, node->len)];
+            if (slot == nullptr)
+            {
+                Node *leaf = new Node();
+                std::memcpy(leaf->bits, bits, MAX_KEY_BYTES);
+                leaf->len = len;
+                leaf->parent = node;
+                slot = leaf;
+                node = leaf;
+                break;
+            }
+
+            Node *child = slot;
+            uint16_t cpl = commonPrefixLen(child->bits, bits, std::min(child->len, len));
+
+            if (cpl == child->len)
+            {
+                /* Full match of the child's compressed path; descend */
+                node = child;
+                continue;
+            }
+
+            /* Diverge inside the child's path: split at cpl */
+            Node *split = new Node();
+            std::memcpy(split->bits, bits, MAX_KEY_BYTES);
+            /* Only the first cpl bits are meaningful; they match both keys */
+            split->len = cpl;
+            split->parent = node;
+            slot = split;
+
+            split->child[getBit(child->bits, cpl)] = child;
+            child->parent = split;
+
+            if (cpl == len)
+            {
+                /* The new key is itself the split point */
+                node = split;
+                break;
+            }
+
+            Node *leaf = new Node();
+            std::memcpy(leaf->bits, bits, MAX_KEY_BYTES);
+            leaf->len = len;
+            leaf->parent = split;
+            split->child[getBit(bits, cpl)] = leaf;
+            node = leaf;
+            break;
+        }
+
+        if (node->value != nullptr)
+        {
+            return std::make_pair(iterator(node), false);
+        }
+
+        node->value = new value_type(key, std::move(val));
+        m_size++;
+        return std::make_pair(iterator(node), true);
+    }
+
+    size_t erase(const swss::IpPrefix &key)
+    {
+        Node *node = findNode(key);
+        if (node == nullptr)
+        {
+            return 0;
+        }
+
+        delete node->value;
+        node->value = nullptr;
+        m_size--;
+        compact(node);
+        return 1;
+    }
+
+    iterator erase(iterator pos)
+    {
+        Node *node = pos.m_node;
+        iterator next = ++pos;
+
+        delete node->value;
+        node->value = nullptr;
+        m_size--;
+        compact(node);
+        return next;
+    }
+
+    void clear()
+    {
+        delete m_root.child[0];
+        delete m_root.child[1];
+        m_root.child[0] = m_root.child[1] = nullptr;
+        m_size = 0;
+    }
+};
@@ -1,8 +1,57 @@
 #include "saiattr.h"
 
+#include <string.h>
+
 #include <swss/logger.h>
 #include <sai_serialize.h>
 
+/*
+ * Value size for attribute types whose active member is a plain scalar
+ * with no internal union or trailing string data, so that byte equality
+ * matches serialized equality once the unused union bytes are zeroed.
+ * Returns 0 for every other type, which then goes through serialization.
+ */
+static size_t scalarAttrValueSize(sai_attr_value_type_t type)
+{
+    switch (type)
+    {
+    case SAI_ATTR_VALUE_TYPE_BOOL:
+        return sizeof(sai_attribute_value_t::booldata);
+    case SAI_ATTR_VALUE_TYPE_UINT8:
+        return sizeof(sai_attribute_value_t::u8);
+    case SAI_ATTR_VALUE_TYPE_INT8:
+        return sizeof(sai_attribute_value_t::s8);
+    case SAI_ATTR_VALUE_TYPE_UINT16:
+        return sizeof(sai_attribute_value_t::u16);
+    case SAI_ATTR_VALUE_TYPE_INT16:
+        return sizeof(sai_attribute_value_t::s16);
+    case SAI_ATTR_VALUE_TYPE_UINT32:
+        return sizeof(sai_attribute_value_t::u32);
+    case SAI_ATTR_VALUE_TYPE_INT32:
+        return sizeof(sai_attribute_value_t::s32);
+    case SAI_ATTR_VALUE_TYPE_UINT64:
+        return sizeof(sai_attribute_value_t::u64);
+    case SAI_ATTR_VALUE_TYPE_INT64:
+        return sizeof(sai_attribute_value_t::s64);
+    case SAI_ATTR_VALUE_TYPE_MAC:
+        return sizeof(sai_attribute_value_t::mac);
+    case SAI_ATTR_VALUE_TYPE_IPV4:
+        return sizeof(sai_attribute_value_t::ip4);
+    case SAI_ATTR_VALUE_TYPE_IPV6:
+        return sizeof(sai_attribute_value_t::ip6);
+    case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+        return sizeof(sai_attribute_value_t::oid);
+    case SAI_ATTR_VALUE_TYPE_POINTER:
+        return sizeof(sai_attribute_value_t::ptr);
+    case SAI_ATTR_VALUE_TYPE_UINT32_RANGE:
+        return sizeof(sai_attribute_value_t::u32range);
+    case SAI_ATTR_VALUE_TYPE_INT32_RANGE:
+        return sizeof(sai_attribute_value_t::s32range);
+    default:
+        return 0;
+    }
+}
+
 SaiAttrWrapper::SaiAttrWrapper(sai_object_type_t objectType, const sai_attribute_t& attr)
 {
     auto meta = sai_metadata_get_attr_metadata(objectType, attr.id);
@@ -46,7 +95,17 @@ SaiAttrWrapper& SaiAttrWrapper::operator=(SaiAttrWrapper&& other)
 
 bool SaiAttrWrapper::operator<(const SaiAttrWrapper& other) const
 {
-    return m_serializedAttr < other.m_serializedAttr;
+    /*
+     * Scalar fast path: for the same attribute the value bytes decide,
+     * no serialization needed. Different attributes (or non-scalar types)
+     * keep the serialized-string order.
+     */
+    if (m_scalarSize != 0 && m_attr.id == other.m_attr.id &&
+        m_meta == other.m_meta)
+    {
+        return memcmp(&m_attr.value, &other.m_attr.value, m_scalarSize) < 0;
+    }
+    return serializedAttr() < other.serializedAttr();
 }
 
 const sai_attribute_t& SaiAttrWrapper::getSaiAttr() const
@@ -56,7 +115,7 @@ const sai_attribute_t& SaiAttrWrapper::getSaiAttr() const
 
 std::string SaiAttrWrapper::toString() const
 {
-    return m_serializedAttr;
+    return serializedAttr();
 }
 
 sai_attr_id_t SaiAttrWrapper::getAttrId() const
@@ -69,7 +128,9 @@ void SaiAttrWrapper::swap(SaiAttrWrapper&& other)
     std::swap(m_objectType, other.m_objectType);
     std::swap(m_meta, other.m_meta);
     std::swap(m_attr, other.m_attr);
+    std::swap(m_scalarSize, other.m_scalarSize);
     std::swap(m_serializedAttr, other.m_serializedAttr);
+    std::swap(m_serialized, other.m_serialized);
 }
 
 void SaiAttrWrapper::init(
@@ -81,9 +142,33 @@ void SaiAttrWrapper::init(
     m_attr.id = attr.id;
     m_meta = &meta;
 
+    m_scalarSize = scalarAttrValueSize(meta.attrvaluetype);
+    if (m_scalarSize != 0)
+    {
+        // A plain copy of the value bytes is a deep copy for scalars; the
+        // unused union bytes are zeroed so raw comparison is well defined.
+        // Serialization is deferred until somebody asks for it.
+        memset(&m_attr.value, 0, sizeof(m_attr.value));
+        memcpy(&m_attr.value, &attr.value, m_scalarSize);
+        m_serializedAttr.clear();
+        m_serialized = false;
+        return;
+    }
+
     m_serializedAttr = sai_serialize_attr_value(*m_meta, attr);
+    m_serialized = true;
 
     // deserialize to actually preform a deep copy of attr
     // and attribute value's dynamically allocated lists.
     sai_deserialize_attr_value(m_serializedAttr, *m_meta, m_attr);
 }
+
+const std::string& SaiAttrWrapper::serializedAttr() const
+{
+    if (!m_serialized && m_meta)
+    {
+        m_serializedAttr = sai_serialize_attr_value(*m_meta, m_attr);
+        m_serialized = true;
+    }
+    return m_serializedAttr;
+}
@@ -34,8 +34,20 @@ private:
         const sai_attribute_t& attr);
     void swap(SaiAttrWrapper&& other);
 
+    const std::string& serializedAttr() const;
+
     sai_object_type_t m_objectType {SAI_OBJECT_TYPE_NULL};
     const sai_attr_metadata_t* m_meta {nullptr};
     sai_attribute_t m_attr {};
-    std::string m_serializedAttr;
+
+    /*
+     * Size of the value for scalar attribute types (0 for anything that
+     * can carry a list or an internal union), enabling a raw byte compare
+     * and a plain union copy instead of a serialize/deserialize round trip.
+     */
+    size_t m_scalarSize {0};
+
+    /* Serialized form, built lazily on first comparison or toString() */
+    mutable std::string m_serializedAttr;
+    mutable bool m_serialized {false};
 };
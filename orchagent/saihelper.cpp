@@ -20,6 +20,7 @@ extern "C" {
 #include "timestamp.h"
 #include "sai_serialize.h"
 #include "saihelper.h"
+#include "saitrace.h"
 #include "orch.h"
 
 using namespace std;
@@ -192,6 +193,96 @@ const sai_service_method_table_t test_services = {
     test_profile_get_next_value
 };
 
+/*
+ * Install SaiTrace wrappers on the api table entries orchagent exercises on
+ * its programming paths. Control-plane-only tables (dash, macsec, dtel, ...)
+ * are left alone: they are not where programming time goes and keeping the
+ * list to the hot tables keeps the folded output readable.
+ */
+static void wrapSaiApis()
+{
+    SWSS_LOG_ENTER();
+
+    SAI_TRACE_WRAP(sai_switch_api, set_switch_attribute);
+    SAI_TRACE_WRAP(sai_switch_api, get_switch_attribute);
+
+    SAI_TRACE_WRAP(sai_port_api, create_port);
+    SAI_TRACE_WRAP(sai_port_api, remove_port);
+    SAI_TRACE_WRAP(sai_port_api, set_port_attribute);
+    SAI_TRACE_WRAP(sai_port_api, get_port_attribute);
+
+    SAI_TRACE_WRAP(sai_vlan_api, create_vlan);
+    SAI_TRACE_WRAP(sai_vlan_api, remove_vlan);
+    SAI_TRACE_WRAP(sai_vlan_api, create_vlan_member);
+    SAI_TRACE_WRAP(sai_vlan_api, remove_vlan_member);
+
+    SAI_TRACE_WRAP(sai_lag_api, create_lag);
+    SAI_TRACE_WRAP(sai_lag_api, remove_lag);
+    SAI_TRACE_WRAP(sai_lag_api, create_lag_member);
+    SAI_TRACE_WRAP(sai_lag_api, remove_lag_member);
+
+    SAI_TRACE_WRAP(sai_bridge_api, create_bridge_port);
+    SAI_TRACE_WRAP(sai_bridge_api, remove_bridge_port);
+
+    SAI_TRACE_WRAP(sai_virtual_router_api, create_virtual_router);
+    SAI_TRACE_WRAP(sai_virtual_router_api, remove_virtual_router);
+
+    SAI_TRACE_WRAP(sai_router_intfs_api, create_router_interface);
+    SAI_TRACE_WRAP(sai_router_intfs_api, remove_router_interface);
+    SAI_TRACE_WRAP(sai_router_intfs_api, set_router_interface_attribute);
+
+    SAI_TRACE_WRAP(sai_neighbor_api, create_neighbor_entry);
+    SAI_TRACE_WRAP(sai_neighbor_api, remove_neighbor_entry);
+    SAI_TRACE_WRAP(sai_neighbor_api, set_neighbor_entry_attribute);
+
+    SAI_TRACE_WRAP(sai_next_hop_api, create_next_hop);
+    SAI_TRACE_WRAP(sai_next_hop_api, remove_next_hop);
+
+    SAI_TRACE_WRAP(sai_next_hop_group_api, create_next_hop_group);
+    SAI_TRACE_WRAP(sai_next_hop_group_api, remove_next_hop_group);
+    SAI_TRACE_WRAP(sai_next_hop_group_api, create_next_hop_group_member);
+    SAI_TRACE_WRAP(sai_next_hop_group_api, remove_next_hop_group_member);
+    SAI_TRACE_WRAP(sai_next_hop_group_api, create_next_hop_group_members);
+    SAI_TRACE_WRAP(sai_next_hop_group_api, remove_next_hop_group_members);
+
+    SAI_TRACE_WRAP(sai_route_api, create_route_entry);
+    SAI_TRACE_WRAP(sai_route_api, remove_route_entry);
+    SAI_TRACE_WRAP(sai_route_api, set_route_entry_attribute);
+    SAI_TRACE_WRAP(sai_route_api, create_route_entries);
+    SAI_TRACE_WRAP(sai_route_api, remove_route_entries);
+    SAI_TRACE_WRAP(sai_route_api, set_route_entries_attribute);
+
+    SAI_TRACE_WRAP(sai_fdb_api, create_fdb_entry);
+    SAI_TRACE_WRAP(sai_fdb_api, remove_fdb_entry);
+    SAI_TRACE_WRAP(sai_fdb_api, set_fdb_entry_attribute);
+    SAI_TRACE_WRAP(sai_fdb_api, flush_fdb_entries);
+
+    SAI_TRACE_WRAP(sai_acl_api, create_acl_table);
+    SAI_TRACE_WRAP(sai_acl_api, remove_acl_table);
+    SAI_TRACE_WRAP(sai_acl_api, create_acl_entry);
+    SAI_TRACE_WRAP(sai_acl_api, remove_acl_entry);
+    SAI_TRACE_WRAP(sai_acl_api, set_acl_entry_attribute);
+    SAI_TRACE_WRAP(sai_acl_api, create_acl_counter);
+    SAI_TRACE_WRAP(sai_acl_api, remove_acl_counter);
+
+    SAI_TRACE_WRAP(sai_hostif_api, create_hostif);
+    SAI_TRACE_WRAP(sai_hostif_api, remove_hostif);
+    SAI_TRACE_WRAP(sai_hostif_api, create_hostif_trap);
+    SAI_TRACE_WRAP(sai_hostif_api, remove_hostif_trap);
+    SAI_TRACE_WRAP(sai_hostif_api, create_hostif_table_entry);
+    SAI_TRACE_WRAP(sai_hostif_api, remove_hostif_table_entry);
+
+    SAI_TRACE_WRAP(sai_tunnel_api, create_tunnel);
+    SAI_TRACE_WRAP(sai_tunnel_api, remove_tunnel);
+    SAI_TRACE_WRAP(sai_tunnel_api, create_tunnel_term_table_entry);
+    SAI_TRACE_WRAP(sai_tunnel_api, remove_tunnel_term_table_entry);
+
+    SAI_TRACE_WRAP(sai_buffer_api, create_buffer_pool);
+    SAI_TRACE_WRAP(sai_buffer_api, remove_buffer_pool);
+    SAI_TRACE_WRAP(sai_buffer_api, create_buffer_profile);
+    SAI_TRACE_WRAP(sai_buffer_api, remove_buffer_profile);
+}
+
 void initSaiApi()
 {
     SWSS_LOG_ENTER();
@@ -268,6 +359,12 @@ void initSaiApi()
     sai_api_query(SAI_API_TAM,                  (void **)&sai_tam_api);
     sai_api_query(SAI_API_STP,                  (void **)&sai_stp_api);
 
+    if (getenv(SAI_TRACE_ENV_VAR) != nullptr)
+    {
+        SaiTrace::Instance().enable();
+        wrapSaiApis();
+    }
+
     sai_log_set(SAI_API_SWITCH,                 SAI_LOG_LEVEL_NOTICE);
     sai_log_set(SAI_API_BRIDGE,                 SAI_LOG_LEVEL_NOTICE);
     sai_log_set(SAI_API_VIRTUAL_ROUTER,         SAI_LOG_LEVEL_NOTICE);
@@ -796,6 +893,70 @@ void handleSaiFailure(sai_api_t api, string oper, sai_status_t status, bool abor
     }
 }
 
+/* Objects per sai_bulk_object_get_attribute call when verifying in bulk */
+static const uint32_t gBulkVerifyChunkSize = 256;
+
+vector<sai_status_t> verifySaiObjects(vector<SaiObjectCheck> &checks)
+{
+    SWSS_LOG_ENTER();
+
+    vector<sai_status_t> results(checks.size(), SAI_STATUS_FAILURE);
+
+    /* Group the request indices by object type; one bulk call covers one type */
+    map<sai_object_type_t, vector<size_t>> checksByType;
+    for (size_t i = 0; i < checks.size(); i++)
+    {
+        checksByType[checks[i].objectType].push_back(i);
+    }
+
+    for (const auto &group : checksByType)
+    {
+        const auto &indices = group.second;
+
+        for (size_t base = 0; base < indices.size(); base += gBulkVerifyChunkSize)
+        {
+            uint32_t count = (uint32_t)min((size_t)gBulkVerifyChunkSize, indices.size() - base);
+
+            vector<sai_object_id_t> oids(count);
+            vector<uint32_t> attrCounts(count, 1);
+            vector<sai_attribute_t *> attrLists(count);
+            vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+
+            for (uint32_t j = 0; j < count; j++)
+            {
+                auto &check = checks[indices[base + j]];
+                oids[j] = check.oid;
+                attrLists[j] = &check.attr;
+            }
+
+            sai_status_t status = sai_bulk_object_get_attribute(
+                    gSwitchId, group.first, count,
+                    oids.data(), attrCounts.data(), attrLists.data(),
+                    SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+
+            if (status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_WARN("Bulk get for object type %s returned %s",
+                              sai_serialize_object_type(group.first).c_str(),
+                              sai_serialize_status(status).c_str());
+            }
+
+            for (uint32_t j = 0; j < count; j++)
+            {
+                /*
+                 * With IGNORE_ERROR the per-object statuses are authoritative;
+                 * an object left NOT_EXECUTED (e.g. bulk get unimplemented for
+                 * this type) inherits the overall call status instead.
+                 */
+                results[indices[base + j]] =
+                    (statuses[j] == SAI_STATUS_NOT_EXECUTED) ? status : statuses[j];
+            }
+        }
+    }
+
+    return results;
+}
+
 static inline void initSaiRedisCounterEmptyParameter(sai_s8_list_t &sai_s8_list)
 {
     sai_s8_list.list = nullptr;
@@ -23,6 +23,25 @@ task_process_status handleSaiGetStatus(sai_api_t api, sai_status_t status, void
 bool parseHandleSaiStatusFailure(task_process_status status);
 void handleSaiFailure(sai_api_t api, std::string oper, sai_status_t status, bool abort_on_failure);
 
+/*
+ * One object to verify: the attribute is fetched as the existence probe and
+ * its value is overwritten with whatever the get returns.
+ */
+struct SaiObjectCheck
+{
+    sai_object_type_t objectType;
+    sai_object_id_t oid;
+    sai_attribute_t attr;
+};
+
+/*
+ * Verify a batch of SAI objects in one pass instead of serial per-object
+ * gets. Returns one status per check, in input order: SAI_STATUS_SUCCESS
+ * when the object exists and the probe attribute could be read, the
+ * per-object failure otherwise.
+ */
+std::vector<sai_status_t> verifySaiObjects(std::vector<SaiObjectCheck> &checks);
+
 void setFlexCounterGroupParameter(const std::string &group,
                                   const std::string &poll_interval,
                                   const std::string &stats_mode,
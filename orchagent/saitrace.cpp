@@ -0,0 +1,168 @@
+#include "saitrace.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <logger.h>
+
+using namespace std;
+
+thread_local SaiTrace::Ring *SaiTrace::t_ring = nullptr;
+
+SaiTrace &SaiTrace::Instance()
+{
+    static SaiTrace instance;
+    return instance;
+}
+
+void SaiTrace::enable()
+{
+    SWSS_LOG_ENTER();
+
+#if defined(__x86_64__)
+    /*
+     * Calibrate tsc ticks against CLOCK_MONOTONIC over a short busy window.
+     * A constant-rate tsc is assumed, which holds on the x86 platforms that
+     * run orchagent; the ratio is only used when converting at flush time.
+     */
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t startNs = static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+    uint64_t startTicks = now();
+
+    usleep(10 * 1000);
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t endNs = static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+    uint64_t endTicks = now();
+
+    if (endNs > startNs && endTicks > startTicks)
+    {
+        m_ticksPerNs = static_cast<double>(endTicks - startTicks) /
+                       static_cast<double>(endNs - startNs);
+    }
+#else
+    /* now() already returns nanoseconds on non-x86 */
+    m_ticksPerNs = 1.0;
+#endif
+
+    m_enabled = true;
+
+    SWSS_LOG_NOTICE("SAI call tracing enabled (%.3f ticks/ns), folded output in %s",
+                    m_ticksPerNs, SAI_TRACE_FOLDED_FILE);
+}
+
+uint64_t SaiTrace::toNs(uint64_t ticks) const
+{
+    return static_cast<uint64_t>(static_cast<double>(ticks) / m_ticksPerNs);
+}
+
+SaiTrace::Ring *SaiTrace::threadRing()
+{
+    /* First event from this thread: allocate its ring and register it */
+    auto ring = unique_ptr<Ring>(new Ring());
+    t_ring = ring.get();
+
+    lock_guard<mutex> lock(m_mutex);
+    m_rings.push_back(move(ring));
+
+    return t_ring;
+}
+
+void SaiTrace::record(const char *name, uint64_t startTicks, uint64_t endTicks)
+{
+    SaiTrace &inst = Instance();
+
+    Ring *ring = t_ring != nullptr ? t_ring : inst.threadRing();
+
+    uint64_t head = ring->head.load(memory_order_relaxed);
+    uint64_t tail = ring->tail.load(memory_order_acquire);
+
+    if (head - tail >= Ring::SIZE)
+    {
+        ring->dropped.fetch_add(1, memory_order_relaxed);
+        return;
+    }
+
+    Event &ev = ring->events[head & (Ring::SIZE - 1)];
+    ev.name = name;
+    ev.ticks = endTicks - startTicks;
+
+    ring->head.store(head + 1, memory_order_release);
+}
+
+void SaiTrace::flush()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    auto elapsed = chrono::steady_clock::now() - m_lastFlush;
+    if (chrono::duration_cast<chrono::seconds>(elapsed).count() < FLUSH_INTERVAL_SECS)
+    {
+        return;
+    }
+    m_lastFlush = chrono::steady_clock::now();
+
+    uint64_t dropped = 0;
+
+    lock_guard<mutex> lock(m_mutex);
+
+    for (auto &ring : m_rings)
+    {
+        uint64_t head = ring->head.load(memory_order_acquire);
+        uint64_t tail = ring->tail.load(memory_order_relaxed);
+
+        for (; tail != head; tail++)
+        {
+            const Event &ev = ring->events[tail & (Ring::SIZE - 1)];
+            Stat &stat = m_stats[ev.name];
+            uint64_t ns = toNs(ev.ticks);
+            stat.count++;
+            stat.total_ns += ns;
+            stat.max_ns = max(stat.max_ns, ns);
+        }
+
+        ring->tail.store(tail, memory_order_release);
+        dropped += ring->dropped.exchange(0, memory_order_relaxed);
+    }
+
+    if (dropped != 0)
+    {
+        SWSS_LOG_WARN("SAI trace rings overflowed, dropped %" PRIu64 " events", dropped);
+    }
+
+    if (m_stats.empty())
+    {
+        return;
+    }
+
+    /*
+     * Rewrite the folded file as a complete cumulative snapshot. Each line
+     * is a collapsed stack weighted by total microseconds spent, which is
+     * exactly what flamegraph.pl consumes; call counts and the worst case
+     * go to the log so they survive even if nobody renders the graph.
+     */
+    string tmp = string(SAI_TRACE_FOLDED_FILE) + ".tmp";
+    FILE *fp = fopen(tmp.c_str(), "w");
+    if (fp == nullptr)
+    {
+        SWSS_LOG_ERROR("Failed to open %s for SAI trace export", tmp.c_str());
+        return;
+    }
+
+    for (const auto &it : m_stats)
+    {
+        fprintf(fp, "orchagent;%s %" PRIu64 "\n", it.first, it.second.total_ns / 1000);
+        SWSS_LOG_INFO("SAI trace %s: calls %" PRIu64 ", total %" PRIu64 " us, max %" PRIu64 " us",
+                      it.first, it.second.count, it.second.total_ns / 1000,
+                      it.second.max_ns / 1000);
+    }
+
+    fclose(fp);
+    rename(tmp.c_str(), SAI_TRACE_FOLDED_FILE);
+}
@@ -0,0 +1,169 @@
+#ifndef SWSS_SAITRACE_H
+#define SWSS_SAITRACE_H
+
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define SAI_TRACE_ENV_VAR     "ORCHAGENT_SAI_TRACE"
+#define SAI_TRACE_FOLDED_FILE "/var/log/swss/sai_trace.folded"
+
+/*
+ * SaiTrace is an optional tracing shim around the SAI api tables queried in
+ * saihelper. When the ORCHAGENT_SAI_TRACE environment variable is set,
+ * initSaiApi() replaces the function pointers on the hot api tables with
+ * thin wrappers that timestamp every call (rdtsc on x86_64, CLOCK_MONOTONIC
+ * elsewhere) and push the duration into a per-thread single-producer ring.
+ * OrchDaemon drains the rings on its flush cadence and rewrites a
+ * folded-stacks file that flamegraph.pl consumes directly, so when
+ * programming slows down SAI latency can be separated from orchagent
+ * overhead without vendor tooling.
+ *
+ * With tracing disabled (the default) the wrappers are never installed and
+ * SAI calls go straight to the queried pointers.
+ */
+class SaiTrace
+{
+public:
+    struct Event
+    {
+        const char *name;
+        uint64_t ticks;
+    };
+
+    /*
+     * One ring per SAI-calling thread; the thread is the only producer and
+     * flush() is the only consumer, so two indices and release/acquire
+     * ordering are enough. Full rings drop and count rather than block.
+     */
+    struct Ring
+    {
+        static constexpr size_t SIZE = 4096;        /* power of two */
+        Event events[SIZE];
+        std::atomic<uint64_t> head{0};
+        std::atomic<uint64_t> tail{0};
+        std::atomic<uint64_t> dropped{0};
+    };
+
+    static constexpr long FLUSH_INTERVAL_SECS = 60;
+
+    static SaiTrace &Instance();
+
+    bool enabled() const { return m_enabled; }
+
+    /* Calibrate the tick clock and start accepting events */
+    void enable();
+
+    /* Raw timestamp; cheap enough to take on both sides of every SAI call */
+    static inline uint64_t now()
+    {
+#if defined(__x86_64__)
+        uint32_t lo, hi;
+        __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+        return (static_cast<uint64_t>(hi) << 32) | lo;
+#else
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+#endif
+    }
+
+    /* Called from the wrappers; must not allocate or lock on the fast path */
+    static void record(const char *name, uint64_t startTicks, uint64_t endTicks);
+
+    /* Drain the rings and rewrite the folded file if the interval elapsed */
+    void flush();
+
+private:
+    SaiTrace() = default;
+    SaiTrace(const SaiTrace &) = delete;
+    SaiTrace &operator=(const SaiTrace &) = delete;
+
+    struct Stat
+    {
+        uint64_t count = 0;
+        uint64_t total_ns = 0;
+        uint64_t max_ns = 0;
+    };
+
+    /* Allocate and register this thread's ring on its first event */
+    Ring *threadRing();
+
+    uint64_t toNs(uint64_t ticks) const;
+
+    bool m_enabled = false;
+    double m_ticksPerNs = 1.0;
+
+    /* Guards ring registration and the cumulative stats; never taken by record() */
+    std::mutex m_mutex;
+    std::vector<std::unique_ptr<Ring>> m_rings;
+    std::map<const char *, Stat> m_stats;
+    std::chrono::steady_clock::time_point m_lastFlush = std::chrono::steady_clock::now();
+
+    static thread_local Ring *t_ring;
+};
+
+/*
+ * Wrapper generator. Each macro expansion gets its own local tag type, so
+ * every wrapped function pointer owns a distinct shim instantiation holding
+ * the real pointer and a static name. The shim forwards unchanged and books
+ * the elapsed ticks into the caller's ring.
+ */
+template <typename Tag, typename Fn>
+struct SaiTraceShim;
+
+template <typename Tag, typename R, typename... Args>
+struct SaiTraceShim<Tag, R (*)(Args...)>
+{
+    using Fn = R (*)(Args...);
+
+    static Fn s_real;
+    static const char *s_name;
+
+    static R invoke(Args... args)
+    {
+        uint64_t start = SaiTrace::now();
+        R rv = s_real(args...);
+        SaiTrace::record(s_name, start, SaiTrace::now());
+        return rv;
+    }
+
+    static Fn install(Fn real, const char *name)
+    {
+        s_real = real;
+        s_name = name;
+        return &invoke;
+    }
+};
+
+template <typename Tag, typename R, typename... Args>
+typename SaiTraceShim<Tag, R (*)(Args...)>::Fn SaiTraceShim<Tag, R (*)(Args...)>::s_real = nullptr;
+
+template <typename Tag, typename R, typename... Args>
+const char *SaiTraceShim<Tag, R (*)(Args...)>::s_name = nullptr;
+
+/*
+ * Replace one api table entry with its traced wrapper. The recorded name is
+ * "<table>;<function>" so the folded output groups by api table. Vendor SDKs
+ * may leave optional entries null; those are skipped.
+ */
+#define SAI_TRACE_WRAP(api, fn)                                                             \
+    do                                                                                      \
+    {                                                                                       \
+        struct SaiTraceTag {};                                                              \
+        if ((api) != nullptr && (api)->fn != nullptr)                                       \
+        {                                                                                   \
+            (api)->fn = SaiTraceShim<SaiTraceTag, decltype((api)->fn)>::install(            \
+                    (api)->fn, #api ";" #fn);                                               \
+        }                                                                                   \
+    } while (0)
+
+#endif /* SWSS_SAITRACE_H */
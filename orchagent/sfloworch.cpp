@@ -46,6 +46,10 @@ bool SflowOrch::sflowDestroySession(SflowSession &session)
 {
     sai_status_t    sai_rc;
 
+    /* Queued port rebinds may still reference this session; apply them
+     * before the object goes away */
+    sflowFlushPortAttrs();
+
     sai_rc = sai_samplepacket_api->remove_samplepacket(session.m_sample_id);
     if (sai_rc != SAI_STATUS_SUCCESS)
     {
@@ -110,7 +114,6 @@ bool SflowOrch::sflowUpdateRate(sai_object_id_t port_id, uint32_t rate)
 bool SflowOrch::sflowAddPort(sai_object_id_t sample_id, sai_object_id_t port_id, string direction)
 {
     sai_attribute_t attr;
-    sai_status_t    sai_rc;
 
     SWSS_LOG_DEBUG("sflowAddPort  %" PRIx64 " portOid %" PRIx64 " dir %s",
                            sample_id, port_id, direction.c_str());
@@ -119,34 +122,14 @@ bool SflowOrch::sflowAddPort(sai_object_id_t sample_id, sai_object_id_t port_id,
     {
         attr.id = SAI_PORT_ATTR_INGRESS_SAMPLEPACKET_ENABLE;
         attr.value.oid = sample_id;
-        sai_rc = sai_port_api->set_port_attribute(port_id, &attr);
-
-        if (sai_rc != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("Failed to set session %" PRIx64 " on port %" PRIx64, sample_id, port_id);
-            task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, sai_rc);
-            if (handle_status != task_success)
-            {
-                return parseHandleSaiStatusFailure(handle_status);
-            }
-        }
+        sflowQueuePortAttr(port_id, attr);
     }
 
     if (direction == "both" || direction == "tx")
     {
         attr.id = SAI_PORT_ATTR_EGRESS_SAMPLEPACKET_ENABLE;
         attr.value.oid = sample_id;
-        sai_rc = sai_port_api->set_port_attribute(port_id, &attr);
-
-        if (sai_rc != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("Failed to set session %" PRIx64 " on port %" PRIx64, sample_id, port_id);
-            task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, sai_rc);
-            if (handle_status != task_success)
-            {
-                return parseHandleSaiStatusFailure(handle_status);
-            }
-        }
+        sflowQueuePortAttr(port_id, attr);
     }
     return true;
 }
@@ -154,7 +137,6 @@ bool SflowOrch::sflowAddPort(sai_object_id_t sample_id, sai_object_id_t port_id,
 bool SflowOrch::sflowDelPort(sai_object_id_t port_id, string direction)
 {
     sai_attribute_t attr;
-    sai_status_t    sai_rc;
 
     SWSS_LOG_DEBUG("sflowDelPort  portOid %" PRIx64 " dir %s",
                            port_id, direction.c_str());
@@ -163,36 +145,56 @@ bool SflowOrch::sflowDelPort(sai_object_id_t port_id, string direction)
     {
         attr.id = SAI_PORT_ATTR_INGRESS_SAMPLEPACKET_ENABLE;
         attr.value.oid = SAI_NULL_OBJECT_ID;
-        sai_rc = sai_port_api->set_port_attribute(port_id, &attr);
-
-        if (sai_rc != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("Failed to delete session on port %" PRIx64, port_id);
-            task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, sai_rc);
-            if (handle_status != task_success)
-            {
-                return parseHandleSaiStatusFailure(handle_status);
-            }
-        }
+        sflowQueuePortAttr(port_id, attr);
     }
 
     if (direction == "both" || direction == "tx")
     {
         attr.id = SAI_PORT_ATTR_EGRESS_SAMPLEPACKET_ENABLE;
         attr.value.oid = SAI_NULL_OBJECT_ID;
-        sai_rc = sai_port_api->set_port_attribute(port_id, &attr);
+        sflowQueuePortAttr(port_id, attr);
+    }
+    return true;
+}
+
+void SflowOrch::sflowQueuePortAttr(sai_object_id_t port_id, const sai_attribute_t &attr)
+{
+    m_pendingPortIds.push_back(port_id);
+    m_pendingPortAttrs.push_back(attr);
+}
+
+void SflowOrch::sflowFlushPortAttrs()
+{
+    SWSS_LOG_ENTER();
 
-        if (sai_rc != SAI_STATUS_SUCCESS)
+    if (m_pendingPortIds.empty())
+    {
+        return;
+    }
+
+    vector<sai_status_t> statuses(m_pendingPortIds.size(), SAI_STATUS_SUCCESS);
+    sai_status_t sai_rc = sai_port_api->set_ports_attribute((uint32_t)m_pendingPortIds.size(),
+                                                            m_pendingPortIds.data(),
+                                                            m_pendingPortAttrs.data(),
+                                                            SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                                                            statuses.data());
+    if (sai_rc != SAI_STATUS_SUCCESS)
+    {
+        /* A failed port is logged and picked up by the next config replay
+         * rather than retried inline */
+        for (size_t i = 0; i < statuses.size(); i++)
         {
-            SWSS_LOG_ERROR("Failed to delete session on port %" PRIx64, port_id);
-            task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, sai_rc);
-            if (handle_status != task_success)
+            if (statuses[i] != SAI_STATUS_SUCCESS)
             {
-                return parseHandleSaiStatusFailure(handle_status);
+                SWSS_LOG_ERROR("Failed to apply samplepacket attribute %d on port %" PRIx64 ", status %d",
+                               m_pendingPortAttrs[i].id, m_pendingPortIds[i], statuses[i]);
+                handleSaiSetStatus(SAI_API_PORT, statuses[i]);
             }
         }
     }
-    return true;
+
+    m_pendingPortIds.clear();
+    m_pendingPortAttrs.clear();
 }
 
 bool SflowOrch::sflowUpdateSampleDirection(sai_object_id_t port_id, string old_dir, string new_dir)
@@ -200,7 +202,6 @@ bool SflowOrch::sflowUpdateSampleDirection(sai_object_id_t port_id, string old_d
     sai_object_id_t ing_sample_oid = SAI_NULL_OBJECT_ID;
     sai_object_id_t egr_sample_oid = SAI_NULL_OBJECT_ID;
     sai_attribute_t attr;
-    sai_status_t    sai_rc;
     auto            port_info = m_sflowPortInfoMap.find(port_id);
 
     SWSS_LOG_DEBUG("sflowUpdateSampleDirection  portOid %" PRIx64 " old dir %s new dir %s",
@@ -226,31 +227,11 @@ bool SflowOrch::sflowUpdateSampleDirection(sai_object_id_t port_id, string old_d
 
     attr.id = SAI_PORT_ATTR_INGRESS_SAMPLEPACKET_ENABLE;
     attr.value.oid = ing_sample_oid;
-    sai_rc = sai_port_api->set_port_attribute(port_id, &attr);
-
-    if (sai_rc != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to Ingress session on port %" PRIx64, port_id);
-        task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, sai_rc);
-        if (handle_status != task_success)
-        {
-            return parseHandleSaiStatusFailure(handle_status);
-        }
-    }
+    sflowQueuePortAttr(port_id, attr);
 
     attr.id = SAI_PORT_ATTR_EGRESS_SAMPLEPACKET_ENABLE;
     attr.value.oid = egr_sample_oid;
-    sai_rc = sai_port_api->set_port_attribute(port_id, &attr);
-
-    if (sai_rc != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to Update Egress session on port %" PRIx64, port_id);
-        task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, sai_rc);
-        if (handle_status != task_success)
-        {
-            return parseHandleSaiStatusFailure(handle_status);
-        }
-    }
+    sflowQueuePortAttr(port_id, attr);
 
     return true;
 }
@@ -497,4 +478,7 @@ void SflowOrch::doTask(Consumer &consumer)
         }
         it = consumer.m_toSync.erase(it);
     }
+
+    /* One bulk apply for every port touched in this drain */
+    sflowFlushPortAttrs();
 }
@@ -36,11 +36,19 @@ private:
     SflowRateSampleMap  m_sflowRateSampleMap;
     bool                m_sflowStatus;
 
+    /* Port samplepacket attribute writes queued during a drain and applied
+     * in one bulk call, so a fleet-wide enable/disable sweep is one flush
+     * instead of one round trip per port */
+    std::vector<sai_object_id_t> m_pendingPortIds;
+    std::vector<sai_attribute_t> m_pendingPortAttrs;
+
     virtual void doTask(Consumer& consumer);
     bool sflowCreateSession(uint32_t rate, SflowSession &session);
     bool sflowDestroySession(SflowSession &session);
     bool sflowAddPort(sai_object_id_t sample_id, sai_object_id_t port_id, string direction);
     bool sflowDelPort(sai_object_id_t port_id, string direction);
+    void sflowQueuePortAttr(sai_object_id_t port_id, const sai_attribute_t &attr);
+    void sflowFlushPortAttrs();
     void sflowStatusSet(Consumer &consumer);
     bool sflowUpdateRate(sai_object_id_t port_id, uint32_t rate);
     bool sflowUpdateSampleDirection(sai_object_id_t port_id, string old_dir, string new_dir);
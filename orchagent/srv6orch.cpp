@@ -36,6 +36,7 @@ extern sai_router_interface_api_t* sai_router_intfs_api;
 
 extern RouteOrch *gRouteOrch;
 extern CrmOrch *gCrmOrch;
+extern size_t gMaxBulkSize;
 extern bool gTraditionalFlexCounter;
 
 const map<string, sai_my_sid_entry_endpoint_behavior_t> end_behavior_map =
@@ -100,6 +101,7 @@ Srv6Orch::Srv6Orch(DBConnector *cfgDb, DBConnector *applDb, const vector<TableCo
     m_vrfOrch(vrfOrch),
     m_switchOrch(switchOrch),
     m_neighOrch(neighOrch),
+    gMySidBulker(sai_srv6_api, gMaxBulkSize),
     m_sidTable(applDb, APP_SRV6_SID_LIST_TABLE_NAME),
     m_mysidTable(applDb, APP_SRV6_MY_SID_TABLE_NAME),
     m_piccontextTable(applDb, APP_PIC_CONTEXT_TABLE_NAME),
@@ -1045,6 +1047,13 @@ bool Srv6Orch::createUpdateSidList(const string sid_name, const string sid_list,
 {
     SWSS_LOG_ENTER();
     bool exists = (sid_table_.find(sid_name) != sid_table_.end()) && sid_table_[sid_name].sid_object_id;
+    if (exists && sid_table_[sid_name].sid_list == sid_list)
+    {
+        /* TE controllers re-push whole policies on reopt; an unchanged
+         * segment list needs neither re-parsing nor a SAI update */
+        SWSS_LOG_INFO("Segment list for %s unchanged, skip", sid_name.c_str());
+        return true;
+    }
     sai_segment_list_t segment_list;
     vector<string>sid_ips = tokenize(sid_list, SID_LIST_DELIMITER);
     sai_object_id_t segment_oid;
@@ -1112,6 +1121,7 @@ bool Srv6Orch::createUpdateSidList(const string sid_name, const string sid_list,
             return false;
         }
     }
+    sid_table_[sid_name].sid_list = sid_list;
     delete segment_list.list;
     return true;
 }
@@ -1428,7 +1438,8 @@ bool Srv6Orch::mySidTunnelRequired(const string& my_sid_addr, const sai_my_sid_e
     return status && dscp_mode.has_value();
 }
 
-bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf, const string adj, const string end_action)
+bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf, const string adj, const string end_action,
+                                      MySidBulkContext *bulk_ctx)
 {
     SWSS_LOG_ENTER();
     vector<sai_attribute_t> attributes;
@@ -1548,8 +1559,10 @@ bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf,
     }
 
     boost::optional<sai_tunnel_dscp_mode_t> dscp_mode;
+    bool tunnel_installed = false;
     if (mySidTunnelRequired(my_sid_string, my_sid_entry, end_behavior, dscp_mode))
     {
+        tunnel_installed = true;
         sai_object_id_t tunnel_oid;
         auto ok = createMySidIpInIpTunnel(dscp_mode.get(), tunnel_oid);
         if (!ok)
@@ -1603,6 +1616,26 @@ bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf,
             attributes.push_back(attr);
         }
 
+        /* entries that installed a decap tunnel stay on the single-call path
+         * so a failed create does not have to unwind the tunnel from the
+         * post-flush handler */
+        if (bulk_ctx != nullptr && !tunnel_installed)
+        {
+            bulk_ctx->object_statuses.emplace_back();
+            gMySidBulker.create_entry(&bulk_ctx->object_statuses.back(), &my_sid_entry,
+                    (uint32_t) attributes.size(), attributes.data());
+            bulk_ctx->key = key_string;
+            bulk_ctx->dt_vrf = dt_vrf;
+            bulk_ctx->adj = adj;
+            bulk_ctx->entry = my_sid_entry;
+            bulk_ctx->end_behavior = end_behavior;
+            bulk_ctx->nexthop = nexthop;
+            bulk_ctx->counter = counter_oid;
+            bulk_ctx->vrf_update = vrf_update;
+            bulk_ctx->nh_update = nh_update;
+            return true;
+        }
+
         status = sai_srv6_api->create_my_sid_entry(&my_sid_entry, (uint32_t) attributes.size(), attributes.data());
         if (status != SAI_STATUS_SUCCESS)
         {
@@ -1654,6 +1687,40 @@ bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf,
     return true;
 }
 
+bool Srv6Orch::createMysidEntryPost(const MySidBulkContext &bulk_ctx)
+{
+    SWSS_LOG_ENTER();
+
+    sai_status_t status = bulk_ctx.object_statuses.front();
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to create my_sid entry %s, rv %d", bulk_ctx.key.c_str(), status);
+        return false;
+    }
+    gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SRV6_MY_SID_ENTRY);
+    srv6_my_sid_table_[bulk_ctx.key].counter = bulk_ctx.counter;
+
+    SWSS_LOG_INFO("Store keystring %s in cache", bulk_ctx.key.c_str());
+    if (bulk_ctx.vrf_update)
+    {
+        m_vrfOrch->increaseVrfRefCount(bulk_ctx.dt_vrf);
+        srv6_my_sid_table_[bulk_ctx.key].endVrfString = bulk_ctx.dt_vrf;
+    }
+    if (bulk_ctx.nh_update)
+    {
+        m_neighOrch->increaseNextHopRefCount(bulk_ctx.nexthop, 1);
+
+        SWSS_LOG_INFO("Increasing refcount to %d for Nexthop %s",
+          m_neighOrch->getNextHopRefCount(bulk_ctx.nexthop), bulk_ctx.nexthop.to_string(false,true).c_str());
+
+        srv6_my_sid_table_[bulk_ctx.key].endAdjString = bulk_ctx.adj;
+    }
+    srv6_my_sid_table_[bulk_ctx.key].endBehavior = bulk_ctx.end_behavior;
+    srv6_my_sid_table_[bulk_ctx.key].entry = bulk_ctx.entry;
+
+    return true;
+}
+
 bool Srv6Orch::deleteMysidEntry(const string my_sid_string)
 {
     sai_status_t status = SAI_STATUS_SUCCESS;
@@ -2201,7 +2268,7 @@ bool Srv6Orch::deleteSrv6Vpn(const std::string &endpoint, const std::string &sid
     return true;
 }
 
-void Srv6Orch::doTaskMySidTable(const KeyOpFieldsValuesTuple & tuple)
+void Srv6Orch::doTaskMySidTable(const KeyOpFieldsValuesTuple & tuple, std::list<MySidBulkContext> &bulk_ctxs)
 {
     SWSS_LOG_ENTER();
     string op = kfvOp(tuple);
@@ -2227,11 +2294,18 @@ void Srv6Orch::doTaskMySidTable(const KeyOpFieldsValuesTuple & tuple)
     }
     if (op == SET_COMMAND)
     {
-        if(!createUpdateMysidEntry(keyString, dt_vrf, adj, end_action))
+        bulk_ctxs.emplace_back();
+        if(!createUpdateMysidEntry(keyString, dt_vrf, adj, end_action, &bulk_ctxs.back()))
         {
+          bulk_ctxs.pop_back();
           SWSS_LOG_ERROR("Failed to create/update my_sid entry for sid %s", keyString.c_str());
           return;
         }
+        if (bulk_ctxs.back().object_statuses.empty())
+        {
+            /* consumed by the single-call path (update or tunnel entry) */
+            bulk_ctxs.pop_back();
+        }
     }
     else if(op == DEL_COMMAND)
     {
@@ -2354,6 +2428,7 @@ void Srv6Orch::doTask(Consumer &consumer)
     SWSS_LOG_ENTER();
     task_process_status status;
     const string &table_name = consumer.getTableName();
+    std::list<MySidBulkContext> mySidBulkCtxs;
     auto it = consumer.m_toSync.begin();
     while(it != consumer.m_toSync.end())
     {
@@ -2370,7 +2445,7 @@ void Srv6Orch::doTask(Consumer &consumer)
         }
         else if (table_name == APP_SRV6_MY_SID_TABLE_NAME)
         {
-            doTaskMySidTable(t);
+            doTaskMySidTable(t, mySidBulkCtxs);
         }
         else if (table_name == APP_PIC_CONTEXT_TABLE_NAME)
         {
@@ -2391,4 +2466,13 @@ void Srv6Orch::doTask(Consumer &consumer)
         }
         consumer.m_toSync.erase(it++);
     }
+
+    if (!mySidBulkCtxs.empty())
+    {
+        gMySidBulker.flush();
+        for (const auto &bulk_ctx : mySidBulkCtxs)
+        {
+            createMysidEntryPost(bulk_ctx);
+        }
+    }
 }
@@ -4,6 +4,8 @@
 #include <vector>
 #include <string>
 #include <set>
+#include <deque>
+#include <list>
 #include <unordered_map>
 #include <boost/optional.hpp>
 
@@ -19,6 +21,7 @@
 #include "nexthopkey.h"
 #include "neighorch.h"
 #include "producerstatetable.h"
+#include "bulker.h"
 
 #include "ipaddress.h"
 #include "ipaddresses.h"
@@ -33,6 +36,8 @@ struct SidTableEntry
 {
     sai_object_id_t sid_object_id;         // SRV6 SID list object id
     set<NextHopKey> nexthops;              // number of nexthops referencing the object
+    string sid_list;                       // last programmed segment list, re-pushes with
+                                           // unchanged segments skip parse and SAI update
 };
 
 struct SidTunnelEntry
@@ -135,6 +140,24 @@ struct Srv6PicContextInfo
     uint32_t ref_count;
 };
 
+/*
+ * Bookkeeping carried for a MySID entry staged in the bulker; applied by
+ * createMysidEntryPost once the bulk create has flushed
+ */
+struct MySidBulkContext
+{
+    string key;
+    string dt_vrf;
+    string adj;
+    sai_my_sid_entry_t entry;
+    sai_my_sid_entry_endpoint_behavior_t end_behavior;
+    NextHopKey nexthop;
+    sai_object_id_t counter = SAI_NULL_OBJECT_ID;
+    bool vrf_update = false;
+    bool nh_update = false;
+    deque<sai_status_t> object_statuses;
+};
+
 typedef unordered_map<string, SidTableEntry> SidTable;
 typedef unordered_map<string, SidTunnelEntry> Srv6TunnelTable;
 typedef map<NextHopKey, sai_object_id_t> Srv6NextHopTable;
@@ -177,7 +200,7 @@ class Srv6Orch : public Orch, public Observer
         void doTask(Consumer &consumer);
         void doTask(SelectableTimer &timer);
         task_process_status doTaskSidTable(const KeyOpFieldsValuesTuple &tuple);
-        void doTaskMySidTable(const KeyOpFieldsValuesTuple &tuple);
+        void doTaskMySidTable(const KeyOpFieldsValuesTuple &tuple, std::list<MySidBulkContext> &bulk_ctxs);
         task_process_status doTaskPicContextTable(const KeyOpFieldsValuesTuple &tuple);
         void doTaskCfgMySidTable(const KeyOpFieldsValuesTuple &tuple);
         bool createUpdateSidList(const string seg_name, const string ips, const string sidlist_type);
@@ -186,7 +209,9 @@ class Srv6Orch : public Orch, public Observer
         bool createSrv6Nexthop(const NextHopKey &nh);
         bool deleteSrv6Nexthop(const NextHopKey &nh);
         bool srv6NexthopExists(const NextHopKey &nh);
-        bool createUpdateMysidEntry(string my_sid_string, const string vrf, const string adj, const string end_action);
+        bool createUpdateMysidEntry(string my_sid_string, const string vrf, const string adj, const string end_action,
+                                    MySidBulkContext *bulk_ctx = nullptr);
+        bool createMysidEntryPost(const MySidBulkContext &bulk_ctx);
         bool deleteMysidEntry(const string my_sid_string);
         bool sidEntryEndpointBehavior(const string action, sai_my_sid_entry_endpoint_behavior_t &end_behavior,
                                       sai_my_sid_entry_endpoint_behavior_flavor_t &end_flavor);
@@ -257,6 +282,8 @@ class Srv6Orch : public Orch, public Observer
         SwitchOrch *m_switchOrch;
         NeighOrch *m_neighOrch;
 
+        EntityBulker<sai_srv6_api_t> gMySidBulker;
+
         FlexCounterManager m_counter_manager;
         unique_ptr<Table> m_mysid_counters_table;
         unique_ptr<Table> m_vid_to_rid_table;
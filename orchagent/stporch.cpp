@@ -1,8 +1,10 @@
 #include <tuple>
+#include <deque>
 #include "portsorch.h"
 #include "logger.h"
 #include "fdborch.h"
 #include "stporch.h"
+#include "bulker.h"
 
 extern sai_stp_api_t *sai_stp_api;
 extern sai_vlan_api_t *sai_vlan_api;
@@ -13,6 +15,7 @@ extern PortsOrch *gPortsOrch;
 
 
 extern sai_object_id_t gSwitchId;
+extern size_t gMaxBulkSize;
 
 StpOrch::StpOrch(DBConnector * db, DBConnector * stateDb, vector<string> &tableNames) :
     Orch(db, tableNames)
@@ -45,15 +48,12 @@ StpOrch::StpOrch(DBConnector * db, DBConnector * stateDb, vector<string> &tableN
 
 sai_object_id_t StpOrch::getStpInstanceOid(sai_uint16_t stp_instance)
 {
-    std::map<sai_uint16_t, sai_object_id_t>::iterator it;
-
-    it = m_stpInstToOid.find(stp_instance);
-    if (it == m_stpInstToOid.end())
+    if (stp_instance >= m_stpInstToOid.size())
     {
         return SAI_NULL_OBJECT_ID;
     }
 
-    return it->second;
+    return m_stpInstToOid[stp_instance];
 }
 
 sai_object_id_t StpOrch::addStpInstance(sai_uint16_t stp_instance)
@@ -71,6 +71,10 @@ sai_object_id_t StpOrch::addStpInstance(sai_uint16_t stp_instance)
         return SAI_NULL_OBJECT_ID;
     }
 
+    if (stp_instance >= m_stpInstToOid.size())
+    {
+        m_stpInstToOid.resize(stp_instance + 1, SAI_NULL_OBJECT_ID);
+    }
     m_stpInstToOid[stp_instance] = stp_oid;
     SWSS_LOG_INFO("Added STP instance:%hu oid:%" PRIx64 "", stp_instance, stp_oid);
     return stp_oid;
@@ -107,7 +111,7 @@ bool StpOrch::removeStpInstance(sai_uint16_t stp_instance)
         return false;
     }
 
-    m_stpInstToOid.erase(stp_instance);
+    m_stpInstToOid[stp_instance] = SAI_NULL_OBJECT_ID;
     SWSS_LOG_INFO("Removed STP instance:%hu oid:%" PRIx64 "", stp_instance, stp_oid);
     return true;
 }
@@ -146,17 +150,13 @@ bool StpOrch::addVlanToStpInstance(string vlan_alias, sai_uint16_t stp_instance)
     vlan.m_stp_id = stp_instance;
     gPortsOrch->setPort(vlan_alias, vlan);
 
-    // Update the new map structure
-    auto it = m_vlanAliasToStpInstanceMap.find(stp_instance);
-    if (it == m_vlanAliasToStpInstanceMap.end())
+    // Update the instance-indexed cache
+    if (stp_instance >= m_vlanAliasToStpInstanceMap.size())
     {
-        StpInstEntry entry = {stp_oid, {vlan_alias}};
-        m_vlanAliasToStpInstanceMap[stp_instance] = entry;
-    }
-    else
-    {
-        it->second.stp_inst_vlan_list.insert(vlan_alias);
+        m_vlanAliasToStpInstanceMap.resize(stp_instance + 1, {SAI_NULL_OBJECT_ID, {}});
     }
+    m_vlanAliasToStpInstanceMap[stp_instance].stp_inst_oid = stp_oid;
+    m_vlanAliasToStpInstanceMap[stp_instance].stp_inst_vlan_list.insert(vlan_alias);
 
     SWSS_LOG_INFO("Add VLAN %s to STP instance:%hu m_stp_id:%d", vlan_alias.c_str(), stp_instance, vlan.m_stp_id);
     return true;
@@ -186,15 +186,14 @@ bool StpOrch::removeVlanFromStpInstance(string vlan_alias, sai_uint16_t stp_inst
 
     SWSS_LOG_INFO("Remove %s from instance:%d add instance:%" PRIx64 "", vlan_alias.c_str(), vlan.m_stp_id, m_defaultStpId);
 
-    // Update the new map structure
-    auto it = m_vlanAliasToStpInstanceMap.find(stp_instance);
-    if (it != m_vlanAliasToStpInstanceMap.end())
+    // Update the instance-indexed cache
+    if (stp_instance < m_vlanAliasToStpInstanceMap.size())
     {
-        it->second.stp_inst_vlan_list.erase(vlan_alias);
-        if (it->second.stp_inst_vlan_list.empty())
+        auto &entry = m_vlanAliasToStpInstanceMap[stp_instance];
+        entry.stp_inst_vlan_list.erase(vlan_alias);
+        if (entry.stp_inst_vlan_list.empty())
         {
-            //removeStpInstance(stp_instance);
-            m_vlanAliasToStpInstanceMap.erase(it);
+            entry.stp_inst_oid = SAI_NULL_OBJECT_ID;
         }
     }
     removeStpInstance(vlan.m_stp_id);
@@ -203,8 +202,8 @@ bool StpOrch::removeVlanFromStpInstance(string vlan_alias, sai_uint16_t stp_inst
     return true;
 }
 
-/* If STP Port exists return else create a new STP Port */
-sai_object_id_t StpOrch::addStpPort(Port &port, sai_uint16_t stp_instance)
+/* If STP Port exists return else create a new STP Port in the given state */
+sai_object_id_t StpOrch::addStpPort(Port &port, sai_uint16_t stp_instance, sai_stp_port_state_t state)
 {
     sai_object_id_t stp_port_id = SAI_NULL_OBJECT_ID;
     sai_object_id_t stp_id = SAI_NULL_OBJECT_ID;
@@ -242,7 +241,7 @@ sai_object_id_t StpOrch::addStpPort(Port &port, sai_uint16_t stp_instance)
     attr[1].value.oid = stp_id;
 
     attr[2].id = SAI_STP_PORT_ATTR_STATE;
-    attr[2].value.s32 = SAI_STP_PORT_STATE_BLOCKING;
+    attr[2].value.s32 = state;
 
     sai_status_t status = sai_stp_api->create_stp_port(&stp_port_id, gSwitchId, 3, attr);
     if (status != SAI_STATUS_SUCCESS)
@@ -285,6 +284,10 @@ bool StpOrch::removeStpPorts(Port &port)
     if(port.m_stp_port_ids.empty())
         return true;
 
+    ObjectBulker<sai_stp_api_t> stpPortBulker(sai_stp_api, gSwitchId, gMaxBulkSize);
+    std::vector<sai_status_t> statuses(port.m_stp_port_ids.size(), SAI_STATUS_NOT_EXECUTED);
+    std::vector<std::pair<sai_uint16_t, sai_object_id_t>> queued;
+
     for(auto stp_port_id: port.m_stp_port_ids)
     {
         uint16_t stp_instance = stp_port_id.first;
@@ -295,14 +298,21 @@ bool StpOrch::removeStpPorts(Port &port)
             continue;
         }
 
-        sai_status_t status = sai_stp_api->remove_stp_port(stp_port_oid);
-        if (status != SAI_STATUS_SUCCESS)
+        stpPortBulker.remove_entry(&statuses[queued.size()], stp_port_oid);
+        queued.emplace_back(stp_instance, stp_port_oid);
+    }
+
+    stpPortBulker.flush();
+
+    for (size_t i = 0; i < queued.size(); i++)
+    {
+        if (statuses[i] != SAI_STATUS_SUCCESS)
         {
-            SWSS_LOG_ERROR("Failed to remove STP port %s instance %d oid %" PRIx64 " status %x", port.m_alias.c_str(), stp_instance, stp_port_oid, status);
+            SWSS_LOG_ERROR("Failed to remove STP port %s instance %d oid %" PRIx64 " status %x", port.m_alias.c_str(), queued[i].first, queued[i].second, statuses[i]);
         }
         else
         {
-            SWSS_LOG_INFO("Remove STP port %s instance %d oid %" PRIx64 "", port.m_alias.c_str(), stp_instance, stp_port_oid);
+            SWSS_LOG_INFO("Remove STP port %s instance %d oid %" PRIx64 "", port.m_alias.c_str(), queued[i].first, queued[i].second);
         }
     }
 
@@ -338,13 +348,22 @@ bool StpOrch::updateStpPortState(Port &port, sai_uint16_t stp_instance, sai_uint
 {
     sai_attribute_t attr[1];
     sai_object_id_t stp_port_oid;
+    bool existing = (port.m_stp_port_ids.find(stp_instance) != port.m_stp_port_ids.end());
 
-    stp_port_oid = addStpPort(port, stp_instance);
+    stp_port_oid = addStpPort(port, stp_instance, getStpSaiState(stp_state));
     if (stp_port_oid == SAI_NULL_OBJECT_ID)
     {
         SWSS_LOG_ERROR("Failed to get STP port oid port %s instance %d state %d ", port.m_alias.c_str(), stp_instance, stp_state);
         return true;
     }
+
+    /* A freshly created STP port already carries the requested state */
+    if (!existing)
+    {
+        SWSS_LOG_INFO("Set STP port state %s instance %d state %d ", port.m_alias.c_str(), stp_instance, stp_state);
+        return true;
+    }
+
     attr[0].id = SAI_STP_PORT_ATTR_STATE;
     attr[0].value.u32 = getStpSaiState(stp_state);
 
@@ -430,16 +449,31 @@ void StpOrch::doStpPortStateTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    /* STP port creations are staged in the bulker and programmed with a
+     * single flush at the end of the drain; state changes on existing STP
+     * ports are applied directly as SAI has no bulk STP port attribute set */
+    struct StpPortCreate
+    {
+        SyncMap::iterator task;
+        string port_alias;
+        sai_uint16_t instance;
+        sai_uint8_t state;
+        sai_object_id_t stp_port_id;
+    };
+
+    ObjectBulker<sai_stp_api_t> stpPortBulker(sai_stp_api, gSwitchId, gMaxBulkSize);
+    std::deque<StpPortCreate> pending;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
         auto &t = it->second;
         string key = kfvKey(t);
         size_t found = key.find(':');
-        /* Return if the format of key is wrong */
+        /* Stop if the format of key is wrong */
         if (found == string::npos)
         {
-            return;
+            break;
         }
         string port_alias = key.substr(0, found);
         string stp_instance = key.substr(found+1);
@@ -448,7 +482,7 @@ void StpOrch::doStpPortStateTask(Consumer &consumer)
 
         if (!gPortsOrch->getPort(port_alias, port))
         {
-            return;
+            break;
         }
 
         string op = kfvOp(t);
@@ -466,10 +500,48 @@ void StpOrch::doStpPortStateTask(Consumer &consumer)
             }
             if(state != STP_STATE_INVALID)
             {
-                if(!updateStpPortState(port, instance, state))
+                if(port.m_stp_port_ids.find(instance) != port.m_stp_port_ids.end())
                 {
-                    it++;
-                    continue;
+                    if(!updateStpPortState(port, instance, state))
+                    {
+                        it++;
+                        continue;
+                    }
+                }
+                else
+                {
+                    /* Resolve the bridge port and STP instance now, stage the
+                     * creation and erase the task once the flush programmed it */
+                    if (port.m_bridge_port_id == SAI_NULL_OBJECT_ID)
+                    {
+                        gPortsOrch->addBridgePort(port);
+                    }
+
+                    sai_object_id_t stp_id = getStpInstanceOid(instance);
+                    if (stp_id == SAI_NULL_OBJECT_ID)
+                    {
+                        stp_id = addStpInstance(instance);
+                    }
+
+                    if (port.m_bridge_port_id == SAI_NULL_OBJECT_ID || stp_id == SAI_NULL_OBJECT_ID)
+                    {
+                        SWSS_LOG_ERROR("Failed to get STP port oid port %s instance %d state %d ", port_alias.c_str(), instance, state);
+                    }
+                    else
+                    {
+                        sai_attribute_t attr[3];
+                        attr[0].id = SAI_STP_PORT_ATTR_BRIDGE_PORT;
+                        attr[0].value.oid = port.m_bridge_port_id;
+                        attr[1].id = SAI_STP_PORT_ATTR_STP;
+                        attr[1].value.oid = stp_id;
+                        attr[2].id = SAI_STP_PORT_ATTR_STATE;
+                        attr[2].value.s32 = getStpSaiState(state);
+
+                        pending.push_back(StpPortCreate{it, port_alias, instance, state, SAI_NULL_OBJECT_ID});
+                        stpPortBulker.create_entry(&pending.back().stp_port_id, 3, attr);
+                        it++;
+                        continue;
+                    }
                 }
             }
         }
@@ -483,6 +555,27 @@ void StpOrch::doStpPortStateTask(Consumer &consumer)
         }
         it = consumer.m_toSync.erase(it);
     }
+
+    stpPortBulker.flush();
+
+    for (auto &entry : pending)
+    {
+        if (entry.stp_port_id == SAI_NULL_OBJECT_ID)
+        {
+            SWSS_LOG_ERROR("Failed to add STP port %s instance %d state %d", entry.port_alias.c_str(), entry.instance, entry.state);
+        }
+        else
+        {
+            Port port;
+            if (gPortsOrch->getPort(entry.port_alias, port))
+            {
+                port.m_stp_port_ids[entry.instance] = entry.stp_port_id;
+                gPortsOrch->setPort(entry.port_alias, port);
+                SWSS_LOG_INFO("Add STP port %s instance %d oid %" PRIx64 " state %d", entry.port_alias.c_str(), entry.instance, entry.stp_port_id, entry.state);
+            }
+        }
+        consumer.m_toSync.erase(entry.task);
+    }
 }
 
 void StpOrch::doStpFastageTask(Consumer &consumer)
@@ -551,10 +644,9 @@ void StpOrch::doMstInstPortFlushTask(Consumer &consumer)
             if (state.compare("true") == 0)
             {
                 // Get all VLAN aliases for the given STP instance
-                auto it_map = m_vlanAliasToStpInstanceMap.find(instance);
-                if (it_map != m_vlanAliasToStpInstanceMap.end())
+                if (instance < m_vlanAliasToStpInstanceMap.size())
                 {
-                    for (const auto& vlan_alias : it_map->second.stp_inst_vlan_list)
+                    for (const auto& vlan_alias : m_vlanAliasToStpInstanceMap[instance].stp_inst_vlan_list)
                     {
                         stpVlanFdbFlush(vlan_alias);
                     }
@@ -604,6 +696,9 @@ bool StpOrch::updateMaxStpInstance(uint32_t max_stp_instances)
 {
     m_maxStpInstance = (sai_uint16_t)max_stp_instances - 1;
 
+    m_stpInstToOid.resize(max_stp_instances, SAI_NULL_OBJECT_ID);
+    m_vlanAliasToStpInstanceMap.resize(max_stp_instances, {SAI_NULL_OBJECT_ID, {}});
+
     SWSS_LOG_NOTICE("StpOrch Max STP instances %d", m_maxStpInstance);
 
     vector<FieldValueTuple> tuples;
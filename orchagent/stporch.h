@@ -3,6 +3,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 #include "orch.h"
 
 #define STP_INVALID_INSTANCE 0xFFFF
@@ -36,9 +37,9 @@ public:
 
 private:
     unique_ptr<Table> m_stpTable;
-    std::map<sai_uint16_t, sai_object_id_t> m_stpInstToOid;//Mapping from STP instance id to corresponding object id
+    std::vector<sai_object_id_t> m_stpInstToOid;//Dense array indexed by STP instance id holding the corresponding object id
     sai_object_id_t m_defaultStpId;
-    std::map<sai_uint16_t, StpInstEntry> m_vlanAliasToStpInstanceMap;
+    std::vector<StpInstEntry> m_vlanAliasToStpInstanceMap;//Dense array indexed by STP instance id
 
     sai_uint16_t m_maxStpInstance;
 
@@ -54,7 +55,7 @@ private:
     bool addVlanToStpInstance(string vlan, sai_uint16_t stp_instance);
     sai_object_id_t getStpInstanceOid(sai_uint16_t stp_instance);
     
-    sai_object_id_t addStpPort(Port &port, sai_uint16_t stp_instance);
+    sai_object_id_t addStpPort(Port &port, sai_uint16_t stp_instance, sai_stp_port_state_t state);
     bool removeStpPort(Port &port, sai_uint16_t stp_instance);
     sai_stp_port_state_t getStpSaiState(sai_uint8_t stp_state);
     bool updateStpPortState(Port &port, sai_uint16_t stp_instance, sai_uint8_t stp_state);
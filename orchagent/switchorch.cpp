@@ -160,6 +160,11 @@ SwitchOrch::SwitchOrch(DBConnector *db, vector<TableConnector>& connectors, Tabl
     auto restartCheckNotifier = new Notifier(m_restartCheckNotificationConsumer, this, "RESTARTCHECK");
     Orch::addExecutor(restartCheckNotifier);
 
+    m_asicSdkHealthEventQueue = make_shared<RingBuffer>(ASIC_SDK_HEALTH_EVENT_QUEUE_SIZE);
+    m_asicSdkHealthEventSignal = new swss::SelectableEvent();
+    auto asicSdkHealthEventNotifier = new AsicSdkHealthEventNotifier(m_asicSdkHealthEventSignal, this, "ASIC_SDK_HEALTH_EVENT_QUEUE");
+    Orch::addExecutor(asicSdkHealthEventNotifier);
+
     initAsicSdkHealthEventNotification();
     set_switch_pfc_dlr_init_capability();
     initSensorsTable();
@@ -1530,17 +1535,22 @@ void SwitchOrch::doTask(NotificationConsumer& consumer)
 {
     SWSS_LOG_ENTER();
 
+    if (&consumer == m_restartCheckNotificationConsumer)
+    {
+        doRestartCheckNotificationConsumerTask(consumer);
+    }
+}
+
+void SwitchOrch::doRestartCheckNotificationConsumerTask(NotificationConsumer& consumer)
+{
+    SWSS_LOG_ENTER();
+
     std::string op;
     std::string data;
     std::vector<swss::FieldValueTuple> values;
 
     consumer.pop(op, data, values);
 
-    if (&consumer != m_restartCheckNotificationConsumer)
-    {
-        return;
-    }
-
     m_warmRestartCheck.checkRestartReadyState = false;
     m_warmRestartCheck.noFreeze = false;
     m_warmRestartCheck.skipPendingTaskCheck = false;
@@ -1668,6 +1678,53 @@ void SwitchOrch::onSwitchAsicSdkHealthEvent(sai_object_id_t switch_id,
     }
 }
 
+void SwitchOrch::queueAsicSdkHealthEvent(sai_object_id_t switch_id,
+                                         sai_switch_asic_sdk_health_severity_t severity,
+                                         sai_timespec_t timestamp,
+                                         sai_switch_asic_sdk_health_category_t category,
+                                         sai_switch_health_data_t data,
+                                         const sai_u8_list_t &description)
+{
+    std::vector<uint8_t> description_copy(description.list, description.list + description.count);
+
+    AnyTask task = [this, switch_id, severity, timestamp, category, data, description_copy]() {
+        sai_u8_list_t desc;
+        desc.count = static_cast<uint32_t>(description_copy.size());
+        desc.list = const_cast<uint8_t *>(description_copy.data());
+        onSwitchAsicSdkHealthEvent(switch_id, severity, timestamp, category, data, desc);
+    };
+
+    if (!m_asicSdkHealthEventQueue->push(std::move(task)))
+    {
+        /* Shed load instead of blocking the notification thread; the
+         * drop count keeps the loss visible without flooding the log */
+        auto dropped = m_droppedAsicSdkHealthEvents.fetch_add(1) + 1;
+        if (dropped % 1000 == 1)
+        {
+            SWSS_LOG_WARN("ASIC/SDK health event queue full, %" PRIu64 " events dropped so far", dropped);
+        }
+        return;
+    }
+
+    m_asicSdkHealthEventSignal->notify();
+}
+
+void SwitchOrch::drainAsicSdkHealthEvents()
+{
+    SWSS_LOG_ENTER();
+
+    AnyTask task;
+    while (m_asicSdkHealthEventQueue->pop(task))
+    {
+        task();
+    }
+}
+
+void AsicSdkHealthEventNotifier::execute()
+{
+    static_cast<SwitchOrch *>(getOrch())->drainAsicSdkHealthEvents();
+}
+
 bool SwitchOrch::setAgingFDB(uint32_t sec)
 {
     sai_attribute_t attr;
@@ -3,6 +3,7 @@
 #include "acltable.h"
 #include "orch.h"
 #include "timer.h"
+#include "selectableevent.h"
 #include "flex_counter/flex_counter_manager.h"
 #include "switch/switch_capabilities.h"
 #include "switch/switch_helper.h"
@@ -27,6 +28,7 @@
 #define SWITCH_CAPABILITY_TABLE_FAST_LINKUP_GUARD_TIMER_RANGE          "FAST_LINKUP_GUARD_TIMER_RANGE"
 
 #define ASIC_SDK_HEALTH_EVENT_ELIMINATE_INTERVAL 3600
+#define ASIC_SDK_HEALTH_EVENT_QUEUE_SIZE 4096
 #define SWITCH_CAPABILITY_TABLE_ASIC_SDK_HEALTH_EVENT_CAPABLE          "ASIC_SDK_HEALTH_EVENT"
 #define SWITCH_CAPABILITY_TABLE_REG_FATAL_ASIC_SDK_HEALTH_CATEGORY     "REG_FATAL_ASIC_SDK_HEALTH_CATEGORY"
 #define SWITCH_CAPABILITY_TABLE_REG_WARNING_ASIC_SDK_HEALTH_CATEGORY   "REG_WARNING_ASIC_SDK_HEALTH_CATEGORY"
@@ -43,6 +45,23 @@ struct WarmRestartCheck
     bool    skipPendingTaskCheck;
 };
 
+/*
+ * Executor draining the ASIC/SDK health event queue on the main loop.
+ * The SAI callback enqueues events into a lock-free ring and signals
+ * this executor, so a flood of health events never holds up port state
+ * or FDB notification delivery on the SAI notification thread.
+ */
+class AsicSdkHealthEventNotifier : public Executor
+{
+public:
+    AsicSdkHealthEventNotifier(swss::SelectableEvent *signal, Orch *orch, const std::string &name)
+        : Executor(signal, orch, name)
+    {
+    }
+
+    void execute() override;
+};
+
 class SwitchOrch : public Orch
 {
 public:
@@ -74,6 +93,21 @@ public:
                                     sai_switch_health_data_t data,
                                     const sai_u8_list_t &description);
 
+    /*
+     * Hand a health event off from the SAI notification thread to the
+     * main loop. Only a copy of the event is taken here; the recording
+     * work happens in drainAsicSdkHealthEvents(). Events are dropped
+     * (and counted) when the queue is full so a flood cannot block the
+     * notification thread.
+     */
+    void queueAsicSdkHealthEvent(sai_object_id_t switch_id,
+                                 sai_switch_asic_sdk_health_severity_t severity,
+                                 sai_timespec_t timestamp,
+                                 sai_switch_asic_sdk_health_category_t category,
+                                 sai_switch_health_data_t data,
+                                 const sai_u8_list_t &description);
+    void drainAsicSdkHealthEvents();
+
     inline bool isFatalEventReceived() const
         {
             return (m_fatalEventCount != 0);
@@ -159,8 +193,13 @@ private:
 
     swss::NotificationConsumer* m_restartCheckNotificationConsumer;
     void doTask(swss::NotificationConsumer& consumer);
-    void doAsicSdkHealthEventNotificationConsumerTask(swss::NotificationConsumer& consumer);
     void doRestartCheckNotificationConsumerTask(swss::NotificationConsumer& consumer);
+
+    /* Dedicated queue for ASIC/SDK health events, fed by the SAI
+     * notification thread and drained on the main loop */
+    std::shared_ptr<RingBuffer> m_asicSdkHealthEventQueue;
+    swss::SelectableEvent* m_asicSdkHealthEventSignal = nullptr;
+    std::atomic<uint64_t> m_droppedAsicSdkHealthEvents{0};
     swss::DBConnector *m_db;
     swss::Table m_switchTable;
     std::map<sai_acl_stage_t, referenced_object> m_aclGroups;
@@ -0,0 +1,58 @@
+#include <algorithm>
+#include <vector>
+
+#include "timer.h"
+#include "logger.h"
+
+namespace swss {
+
+/* All live timer executors; constructed and fired on the main thread only,
+ * so no locking is needed */
+static std::vector<ExecutableTimer *> gTimers;
+
+ExecutableTimer::ExecutableTimer(swss::SelectableTimer *timer, Orch *orch, const std::string &name)
+    : Executor(timer, orch, name)
+{
+    gTimers.push_back(this);
+}
+
+ExecutableTimer::~ExecutableTimer()
+{
+    gTimers.erase(std::remove(gTimers.begin(), gTimers.end(), this), gTimers.end());
+}
+
+void ExecutableTimer::execute()
+{
+    if (ConsumerBase::totalPending() >= TIMER_DEFER_BACKLOG_TASKS)
+    {
+        if (!m_deferred)
+        {
+            SWSS_LOG_INFO("Deferring timer %s behind %zu pending tasks",
+                          getName().c_str(), ConsumerBase::totalPending());
+            m_deferred = true;
+        }
+        return;
+    }
+
+    m_deferred = false;
+    m_orch->doTask(*getSelectableTimer());
+}
+
+void ExecutableTimer::runDeferred()
+{
+    if (ConsumerBase::totalPending() >= TIMER_DEFER_BACKLOG_TASKS)
+    {
+        return;
+    }
+
+    for (auto timer : gTimers)
+    {
+        if (timer->m_deferred)
+        {
+            timer->m_deferred = false;
+            timer->m_orch->doTask(*timer->getSelectableTimer());
+        }
+    }
+}
+
+}
@@ -5,24 +5,36 @@
 
 namespace swss {
 
+/*
+ * Timer executors (CRM polling, watermark telemetry, fabric port scans) fire
+ * on fixed intervals and would otherwise run in the middle of a convergence
+ * backlog, delaying consumer drains by the full length of their callback.
+ * When the process-wide pending-task gauge (ConsumerBase::totalPending())
+ * is at or above TIMER_DEFER_BACKLOG_TASKS, execute() parks the expiry
+ * instead of running it; the main loop replays parked timers through
+ * runDeferred() once the backlog has drained. Multiple expiries absorbed
+ * while deferred coalesce into a single callback, which is safe for the
+ * periodic-refresh work these timers do.
+ */
 class ExecutableTimer : public Executor
 {
 public:
-    ExecutableTimer(swss::SelectableTimer *timer, Orch *orch, const std::string &name)
-        : Executor(timer, orch, name)
-    {
-    }
+    ExecutableTimer(swss::SelectableTimer *timer, Orch *orch, const std::string &name);
+    ~ExecutableTimer() override;
 
     swss::SelectableTimer *getSelectableTimer()
     {
         return static_cast<swss::SelectableTimer *>(getSelectable());
     }
 
-    void execute()
-    {
-        m_orch->doTask(*getSelectableTimer());
-    }
+    void execute() override;
+
+    /* Replay timers parked by execute(); called from the main select loop
+     * after consumer drains complete */
+    static void runDeferred();
+
+private:
+    bool m_deferred = false;
 };
 
 }
-
@@ -40,17 +40,16 @@ for i = 1, n do
     local in_pkts = tonumber(in_pkts_str) or 0
 
     if initialized == 'DONE' or initialized == 'COUNTERS_LAST' then
-        -- Get old COUNTERS values
-        local in_pkts_last = redis.call('HGET', rates_table_name .. ':' .. KEYS[i], 'SAI_COUNTER_STAT_PACKETS_last')
-        
+        -- Get old COUNTERS and rates values in one round trip
+        local rates_old = redis.call('HMGET', rates_table_name .. ':' .. KEYS[i], 'SAI_COUNTER_STAT_PACKETS_last', 'RX_PPS')
+        local in_pkts_last = rates_old[1]
+
         -- Calculate new rates values
         local rx_pps_new = (in_pkts - in_pkts_last) / delta * 1000
 
         if initialized == "DONE" then
-            -- Get old rates values
-            local rx_pps_old = redis.call('HGET', rates_table_name .. ':' .. KEYS[i], 'RX_PPS')
-
             -- Smooth the rates values and store them in DB
+            local rx_pps_old = rates_old[2]
             redis.call('HSET', rates_table_name .. ':' .. KEYS[i], 'RX_PPS', alpha*rx_pps_new + one_minus_alpha*rx_pps_old)
         else
             -- Store unsmoothed initial rates values in DB
@@ -7,6 +7,7 @@
 #include "swssnet.h"
 #include "qosorch.h"
 #include "subscriberstatetable.h"
+#include "bulker.h"
 
 using namespace std;
 using namespace swss;
@@ -26,6 +27,7 @@ extern sai_object_id_t  gSwitchId;
 extern PortsOrch*       gPortsOrch;
 extern CrmOrch*         gCrmOrch;
 extern QosOrch*         gQosOrch;
+extern size_t           gMaxBulkSize;
 
 TunnelDecapOrch::TunnelDecapOrch(
     DBConnector *appDb, DBConnector *stateDb,
@@ -889,117 +891,165 @@ bool TunnelDecapOrch::addDecapTunnel(
  * Return Values:
  *    @return true on success and false if there's an error
  */
-bool TunnelDecapOrch::addDecapTunnelTermEntry(
-    std::string tunnel_name,
-    std::string src_ip_str,
-    std::string dst_ip_str,
-    TunnelTermType term_type,
-    std::string subnet_type)
+bool TunnelDecapOrch::getDecapTunnelTermAttrs(
+    const TunnelEntry &tunnel,
+    const TunnelTermEntry &term,
+    std::vector<sai_attribute_t> &tunnel_term_entry_attrs)
 {
     SWSS_LOG_ENTER();
 
-    auto tunnel_it = tunnelTable.find(tunnel_name);
-    if (tunnel_it == tunnelTable.end())
-    {
-        SWSS_LOG_ERROR("Tunnel %s does not exist.", tunnel_name.c_str());
-        return false;
-    }
-    auto &tunnel = tunnel_it->second;
-
     sai_attribute_t attr;
-    IpPrefix src_ip{src_ip_str};
-    IpPrefix dst_ip{dst_ip_str};
+    IpPrefix src_ip{term.src_ip};
+    IpPrefix dst_ip{term.dst_ip};
 
-    if (tunnel.tunnel_term_info.find(dst_ip) != tunnel.tunnel_term_info.end())
-    {
-        SWSS_LOG_NOTICE("Tunnel decap term entry %s already exists.", dst_ip_str.c_str());
-        return true;
-    }
-
-    // adding tunnel table entry attributes to array and writing to ASIC_DB
-    vector<sai_attribute_t> tunnel_table_entry_attrs;
     attr.id = SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_VR_ID;
     attr.value.oid = gVirtualRouterId;
-    tunnel_table_entry_attrs.push_back(attr);
+    tunnel_term_entry_attrs.push_back(attr);
 
     attr.id = SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_TYPE;
-    if (term_type == TUNNEL_TERM_TYPE_P2P)
+    if (term.term_type == TUNNEL_TERM_TYPE_P2P)
     {
         attr.value.u32 = SAI_TUNNEL_TERM_TABLE_ENTRY_TYPE_P2P;
     }
-    else if (term_type == TUNNEL_TERM_TYPE_P2MP)
+    else if (term.term_type == TUNNEL_TERM_TYPE_P2MP)
     {
         attr.value.u32 = SAI_TUNNEL_TERM_TABLE_ENTRY_TYPE_P2MP;
     }
-    else if (term_type == TUNNEL_TERM_TYPE_MP2MP)
+    else if (term.term_type == TUNNEL_TERM_TYPE_MP2MP)
     {
         attr.value.u32 = SAI_TUNNEL_TERM_TABLE_ENTRY_TYPE_MP2MP;
     }
-    tunnel_table_entry_attrs.push_back(attr);
+    tunnel_term_entry_attrs.push_back(attr);
 
     attr.id = SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_TUNNEL_TYPE;
     attr.value.s32 = SAI_TUNNEL_TYPE_IPINIP;
-    tunnel_table_entry_attrs.push_back(attr);
+    tunnel_term_entry_attrs.push_back(attr);
 
     attr.id = SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_ACTION_TUNNEL_ID;
     attr.value.oid = tunnel.tunnel_id;
-    tunnel_table_entry_attrs.push_back(attr);
+    tunnel_term_entry_attrs.push_back(attr);
 
-    if (term_type == TUNNEL_TERM_TYPE_P2P || term_type == TUNNEL_TERM_TYPE_MP2MP)
+    if (term.term_type == TUNNEL_TERM_TYPE_P2P || term.term_type == TUNNEL_TERM_TYPE_MP2MP)
     {
         if (src_ip.isV4() != dst_ip.isV4())
         {
-            SWSS_LOG_ERROR("Src IP %s doesn't match IP version of dst IP %s.", src_ip_str.c_str(), dst_ip_str.c_str());
+            SWSS_LOG_ERROR("Src IP %s doesn't match IP version of dst IP %s.", term.src_ip.c_str(), term.dst_ip.c_str());
             return false;
         }
         // Set src ip for P2P or MP2MP
         attr.id = SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_SRC_IP;
         copy(attr.value.ipaddr, src_ip.getIp());
-        tunnel_table_entry_attrs.push_back(attr);
+        tunnel_term_entry_attrs.push_back(attr);
     }
 
     attr.id = SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_DST_IP;
     copy(attr.value.ipaddr, dst_ip.getIp());
-    tunnel_table_entry_attrs.push_back(attr);
+    tunnel_term_entry_attrs.push_back(attr);
 
-    if (term_type == TUNNEL_TERM_TYPE_MP2MP)
+    if (term.term_type == TUNNEL_TERM_TYPE_MP2MP)
     {
         // Set src/dst ip mask for MP2MP
         attr.id = SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_SRC_IP_MASK;
         copy(attr.value.ipaddr, src_ip.getMask());
-        tunnel_table_entry_attrs.push_back(attr);
+        tunnel_term_entry_attrs.push_back(attr);
 
         attr.id = SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_DST_IP_MASK;
         copy(attr.value.ipaddr, dst_ip.getMask());
-        tunnel_table_entry_attrs.push_back(attr);
+        tunnel_term_entry_attrs.push_back(attr);
     }
 
-    // create the tunnel table entry
-    sai_object_id_t tunnel_term_table_entry_id;
-    sai_status_t status = sai_tunnel_api->create_tunnel_term_table_entry(&tunnel_term_table_entry_id, gSwitchId, (uint32_t)tunnel_table_entry_attrs.size(), tunnel_table_entry_attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to create tunnel decap term entry %s.", dst_ip.to_string().c_str());
-        task_process_status handle_status = handleSaiCreateStatus(SAI_API_TUNNEL, status);
-        if (handle_status != task_success)
-        {
-            return parseHandleSaiStatusFailure(handle_status);
-        }
-    }
+    return true;
+}
 
-    tunnel.tunnel_term_info[dst_ip] = {
-        tunnel_term_table_entry_id, // tunnel_term_id
+bool TunnelDecapOrch::addDecapTunnelTermEntry(
+    std::string tunnel_name,
+    std::string src_ip_str,
+    std::string dst_ip_str,
+    TunnelTermType term_type,
+    std::string subnet_type)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<TunnelTermEntry> terms = {{
+        SAI_NULL_OBJECT_ID,         // tunnel_term_id
         src_ip_str,                 // src_ip
         dst_ip_str,                 // dst_ip
         term_type,                  // tunnel_type
         subnet_type                 // subnet_type
-    };
-    increaseTunnelRefCount(tunnel_name);
-    setDecapTunnelTermStatus(tunnel_name, dst_ip_str, src_ip_str, term_type, subnet_type);
+    }};
+    return addDecapTunnelTermEntries(tunnel_name, terms);
+}
 
-    SWSS_LOG_NOTICE("Created tunnel decap term entry %s.", dst_ip_str.c_str());
+bool TunnelDecapOrch::addDecapTunnelTermEntries(
+    const std::string &tunnel_name,
+    const std::vector<TunnelTermEntry> &terms)
+{
+    SWSS_LOG_ENTER();
 
-    return true;
+    auto tunnel_it = tunnelTable.find(tunnel_name);
+    if (tunnel_it == tunnelTable.end())
+    {
+        SWSS_LOG_ERROR("Tunnel %s does not exist.", tunnel_name.c_str());
+        return false;
+    }
+    auto &tunnel = tunnel_it->second;
+
+    ObjectBulker<sai_tunnel_api_t> tunnelTermBulker(sai_tunnel_api, gSwitchId, gMaxBulkSize);
+
+    // OID storage filled in by the bulker on flush, one slot per queued term
+    std::vector<sai_object_id_t> term_ids(terms.size(), SAI_NULL_OBJECT_ID);
+    std::vector<size_t> queued_terms;
+    bool success = true;
+
+    for (size_t i = 0; i < terms.size(); i++)
+    {
+        const auto &term = terms[i];
+        IpPrefix dst_ip{term.dst_ip};
+
+        if (tunnel.tunnel_term_info.find(dst_ip) != tunnel.tunnel_term_info.end())
+        {
+            SWSS_LOG_NOTICE("Tunnel decap term entry %s already exists.", term.dst_ip.c_str());
+            continue;
+        }
+
+        vector<sai_attribute_t> tunnel_term_entry_attrs;
+        if (!getDecapTunnelTermAttrs(tunnel, term, tunnel_term_entry_attrs))
+        {
+            success = false;
+            continue;
+        }
+
+        tunnelTermBulker.create_entry(&term_ids[i], (uint32_t)tunnel_term_entry_attrs.size(),
+                                      tunnel_term_entry_attrs.data());
+        queued_terms.push_back(i);
+    }
+
+    tunnelTermBulker.flush();
+
+    for (size_t i : queued_terms)
+    {
+        const auto &term = terms[i];
+        if (term_ids[i] == SAI_NULL_OBJECT_ID)
+        {
+            SWSS_LOG_ERROR("Failed to create tunnel decap term entry %s.", term.dst_ip.c_str());
+            success = false;
+            continue;
+        }
+
+        tunnel.tunnel_term_info[IpPrefix(term.dst_ip)] = {
+            term_ids[i],                // tunnel_term_id
+            term.src_ip,                // src_ip
+            term.dst_ip,                // dst_ip
+            term.term_type,             // tunnel_type
+            term.subnet_type            // subnet_type
+        };
+        increaseTunnelRefCount(tunnel_name);
+        setDecapTunnelTermStatus(tunnel_name, term.dst_ip, term.src_ip, term.term_type, term.subnet_type);
+
+        SWSS_LOG_NOTICE("Created tunnel decap term entry %s.", term.dst_ip.c_str());
+    }
+
+    return success;
 }
 
 /**
@@ -1138,29 +1188,35 @@ bool TunnelDecapOrch::setIpAttribute(string tunnel_name, string src_ip_str)
     TunnelEntry *tunnel_info = &tunnel_it->second;
     map<swss::IpPrefix, TunnelTermEntry> decap_terms_copy(tunnel_info->tunnel_term_info.begin(), tunnel_info->tunnel_term_info.end());
 
+    std::vector<IpPrefix> dst_ips;
     for (auto it = decap_terms_copy.begin(); it != decap_terms_copy.end(); ++it)
     {
-        TunnelTermEntry &term_entry = it->second;
-        if (!removeDecapTunnelTermEntry(tunnel_name, term_entry.dst_ip))
-        {
-            return false;
-        }
+        dst_ips.push_back(it->first);
+    }
+
+    if (!removeDecapTunnelTermEntries(tunnel_name, dst_ips))
+    {
+        return false;
     }
 
+    std::vector<TunnelTermEntry> new_terms;
     for (auto it = decap_terms_copy.begin(); it != decap_terms_copy.end(); ++it)
     {
         if (tunnel_info->tunnel_term_info.find(it->first) == tunnel_info->tunnel_term_info.end())
         {
             TunnelTermEntry &term_entry = it->second;
-            // add the decap term with new src ip
-            if (!addDecapTunnelTermEntry(tunnel_name, src_ip_str, term_entry.dst_ip, term_entry.term_type, term_entry.subnet_type))
-            {
-                return false;
-            }
+            // re-add the decap term with new src ip
+            new_terms.push_back({
+                SAI_NULL_OBJECT_ID,         // tunnel_term_id
+                src_ip_str,                 // src_ip
+                term_entry.dst_ip,          // dst_ip
+                term_entry.term_type,       // tunnel_type
+                term_entry.subnet_type      // subnet_type
+            });
         }
     }
 
-    return true;
+    return addDecapTunnelTermEntries(tunnel_name, new_terms);
 }
 
 /**
@@ -1227,7 +1283,15 @@ bool TunnelDecapOrch::removeDecapTunnel(string table_name, string key)
  */
 bool TunnelDecapOrch::removeDecapTunnelTermEntry(std::string tunnel_name, std::string dst_ip_str)
 {
-    sai_status_t status;
+    std::vector<IpPrefix> dst_ips = {IpPrefix(dst_ip_str)};
+    return removeDecapTunnelTermEntries(tunnel_name, dst_ips);
+}
+
+bool TunnelDecapOrch::removeDecapTunnelTermEntries(
+    const std::string &tunnel_name,
+    const std::vector<swss::IpPrefix> &dst_ips)
+{
+    SWSS_LOG_ENTER();
 
     auto tunnel_it = tunnelTable.find(tunnel_name);
     if (tunnel_it == tunnelTable.end())
@@ -1236,31 +1300,50 @@ bool TunnelDecapOrch::removeDecapTunnelTermEntry(std::string tunnel_name, std::s
         return false;
     }
 
-    IpPrefix dst_ip{dst_ip_str};
-    auto term_it = tunnel_it->second.tunnel_term_info.find(dst_ip);
-    if (term_it == tunnel_it->second.tunnel_term_info.end())
+    ObjectBulker<sai_tunnel_api_t> tunnelTermBulker(sai_tunnel_api, gSwitchId, gMaxBulkSize);
+
+    // Status storage filled in by the bulker on flush, one slot per queued term
+    std::vector<sai_status_t> statuses(dst_ips.size(), SAI_STATUS_NOT_EXECUTED);
+    std::vector<size_t> queued_terms;
+    bool success = true;
+
+    for (size_t i = 0; i < dst_ips.size(); i++)
     {
-        SWSS_LOG_ERROR("Tunnel decap term entry %s does not exist.", dst_ip_str.c_str());
-        return false;
+        auto term_it = tunnel_it->second.tunnel_term_info.find(dst_ips[i]);
+        if (term_it == tunnel_it->second.tunnel_term_info.end())
+        {
+            SWSS_LOG_ERROR("Tunnel decap term entry %s does not exist.", dst_ips[i].to_string().c_str());
+            success = false;
+            continue;
+        }
+
+        tunnelTermBulker.remove_entry(&statuses[i], term_it->second.tunnel_term_id);
+        queued_terms.push_back(i);
     }
-    auto &decap_term = term_it->second;
 
-    status = sai_tunnel_api->remove_tunnel_term_table_entry(decap_term.tunnel_term_id);
-    if (status != SAI_STATUS_SUCCESS)
+    tunnelTermBulker.flush();
+
+    for (size_t i : queued_terms)
     {
-        SWSS_LOG_ERROR("Failed to remove tunnel table entry: %" PRIu64, decap_term.tunnel_term_id);
-        task_process_status handle_status = handleSaiRemoveStatus(SAI_API_TUNNEL, status);
-        if (handle_status != task_success)
+        auto term_it = tunnel_it->second.tunnel_term_info.find(dst_ips[i]);
+        if (statuses[i] != SAI_STATUS_SUCCESS)
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            SWSS_LOG_ERROR("Failed to remove tunnel table entry: %" PRIu64, term_it->second.tunnel_term_id);
+            task_process_status handle_status = handleSaiRemoveStatus(SAI_API_TUNNEL, statuses[i]);
+            if (handle_status != task_success)
+            {
+                success = false;
+                continue;
+            }
         }
+
+        tunnel_it->second.tunnel_term_info.erase(term_it);
+        decreaseTunnelRefCount(tunnel_name);
+        removeDecapTunnelTermStatus(tunnel_name, dst_ips[i].to_string());
+        SWSS_LOG_NOTICE("Removed decap tunnel term entry with ip address: %s.", dst_ips[i].to_string().c_str());
     }
 
-    tunnel_it->second.tunnel_term_info.erase(term_it);
-    decreaseTunnelRefCount(tunnel_name);
-    removeDecapTunnelTermStatus(tunnel_name, dst_ip_str);
-    SWSS_LOG_NOTICE("Removed decap tunnel term entry with ip address: %s.", dst_ip_str.c_str());
-    return true;
+    return success;
 }
 
 sai_object_id_t TunnelDecapOrch::getNextHopTunnel(std::string tunnelKey, IpAddress& ipAddr)
@@ -1503,10 +1586,21 @@ void TunnelDecapOrch::processUnhandledDecapTunnelTerms(const string &tunnel_name
     auto tunnel_it = unhandledDecapTerms.find(tunnel_name);
     if (tunnel_it != unhandledDecapTerms.end())
     {
+        std::vector<TunnelTermEntry> terms;
+        for (auto term_it = tunnel_it->second.begin(); term_it != tunnel_it->second.end(); ++term_it)
+        {
+            terms.push_back(term_it->second);
+        }
+
+        addDecapTunnelTermEntries(tunnel_name, terms);
+
+        // Keep the terms the bulk create failed to program for a later retry
+        auto tunnel_table_it = tunnelTable.find(tunnel_name);
         for (auto term_it = tunnel_it->second.begin(); term_it != tunnel_it->second.end();)
         {
-            auto &term = term_it->second;
-            if (addDecapTunnelTermEntry(tunnel_name, term.src_ip, term.dst_ip, term.term_type, term.subnet_type))
+            if (tunnel_table_it != tunnelTable.end() &&
+                tunnel_table_it->second.tunnel_term_info.find(term_it->first) !=
+                    tunnel_table_it->second.tunnel_term_info.end())
             {
                 term_it = tunnel_it->second.erase(term_it);
             }
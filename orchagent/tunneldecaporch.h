@@ -109,7 +109,11 @@ private:
 
     bool addDecapTunnelTermEntry(std::string tunnel_name, std::string src_ip_str,
                                  std::string dst_ip_str, TunnelTermType term_type, std::string subnet_type);
+    bool addDecapTunnelTermEntries(const std::string &tunnel_name, const std::vector<TunnelTermEntry> &terms);
     bool removeDecapTunnelTermEntry(std::string tunnel_name, std::string dst_ip_str);
+    bool removeDecapTunnelTermEntries(const std::string &tunnel_name, const std::vector<swss::IpPrefix> &dst_ips);
+    bool getDecapTunnelTermAttrs(const TunnelEntry &tunnel, const TunnelTermEntry &term,
+                                 std::vector<sai_attribute_t> &tunnel_term_entry_attrs);
 
     void addUnhandledDecapTunnelTerm(const std::string &tunnel_name, const std::string &src_ip_str,
                                      const std::string &dst_ip_str, TunnelTermType term_type,
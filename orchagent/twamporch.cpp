@@ -52,6 +52,10 @@ using namespace swss;
 #define TWAMP_SESSION_TIMEOUT_MIN    1
 #define TWAMP_SESSION_TIMEOUT_MAX    10
 
+/* Minimum spacing between COUNTERS_DB writes for one session; the final
+ * stats of a monitor run are published immediately regardless */
+#define TWAMP_STATS_PUBLISH_INTERVAL_SECS    10
+
 static map<string, sai_twamp_session_role_t> twamp_role_map =
 {
     { "SENDER",       SAI_TWAMP_SESSION_ROLE_SENDER    },
@@ -174,16 +178,14 @@ bool TwampOrch::getSessionName(const sai_object_id_t oid, string& name)
 {
     SWSS_LOG_ENTER();
 
-    for (const auto& it: m_twampEntries)
+    auto it = m_twampSessionNameMap.find(oid);
+    if (it == m_twampSessionNameMap.end())
     {
-        if (it.second.session_id == oid)
-        {
-            name = it.first;
-            return true;
-        }
+        return false;
     }
 
-    return false;
+    name = it->second;
+    return true;
 }
 
 bool TwampOrch::validateUdpPort(uint16_t udp_port)
@@ -283,6 +285,8 @@ void TwampOrch::initSessionStats(const string& name)
     total_stats.avg_jitter        = 0;
     total_stats.avg_latency_total = 0;
     total_stats.avg_jitter_total  = 0;
+    memset(total_stats.latency_hist, 0, sizeof(total_stats.latency_hist));
+    memset(total_stats.jitter_hist, 0, sizeof(total_stats.jitter_hist));
 }
 
 bool TwampOrch::registerTwampEventNotification(void)
@@ -429,6 +433,8 @@ bool TwampOrch::activateSession(const string& name, TwampEntry& entry)
     m_vrfOrch->increaseVrfRefCount(entry.vrf_id);
     gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_TWAMP_ENTRY);
 
+    m_twampSessionNameMap[entry.session_id] = name;
+
     increaseTwampSessionCount();
 
     if (entry.role == SAI_TWAMP_SESSION_ROLE_REFLECTOR)
@@ -459,6 +465,8 @@ bool TwampOrch::deactivateSession(const string& name, TwampEntry& entry)
     m_vrfOrch->decreaseVrfRefCount(entry.vrf_id);
     gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_TWAMP_ENTRY);
 
+    m_twampSessionNameMap.erase(entry.session_id);
+
     decreaseTwampSessionCount();
 
     setSessionStatus(name, TWAMP_SESSION_STATUS_INACTIVE);
@@ -803,6 +811,7 @@ task_process_status TwampOrch::deleteEntry(const string& key)
     /* remove soft table in orchagent */
     m_twampEntries.erase(key);
     m_twampStatistics.erase(key);
+    m_lastStatsPublish.erase(key);
 
     SWSS_LOG_NOTICE("Removed twamp session %s", key.c_str());
 
@@ -884,22 +893,6 @@ bool TwampOrch::addCounterNameMap(const string& name, const sai_object_id_t sess
     return false;
 }
 
-void TwampOrch::saveSessionStatsLatest(const sai_object_id_t session_id, const uint32_t index, const vector<uint64_t>& stats)
-{
-    SWSS_LOG_ENTER();
-
-    vector<FieldValueTuple> values;
-
-    for (const auto& it: twamp_session_stat_ids)
-    {
-        values.emplace_back(sai_serialize_twamp_session_stat(it), to_string(stats[it]));
-    }
-
-    m_countersTable->set(sai_serialize_object_id(session_id) + ":INDEX:" + to_string(index), values);
-
-    return;
-}
-
 void TwampOrch::calculateCounters(const string& name, const uint32_t index, const vector<uint64_t>& stats)
 {
     SWSS_LOG_ENTER();
@@ -936,6 +929,21 @@ void TwampOrch::calculateCounters(const string& name, const uint32_t index, cons
                                 stats[SAI_TWAMP_SESSION_STAT_MIN_JITTER] : total_stats.min_jitter);
     total_stats.avg_jitter_total += stats[SAI_TWAMP_SESSION_STAT_AVG_JITTER];
     total_stats.avg_jitter = total_stats.avg_jitter_total / index;
+
+    /* fold this interval's averages into the percentile sketches */
+    size_t bucket = 0;
+    while (bucket < TWAMP_LATENCY_BUCKETS && (1ULL << bucket) <= stats[SAI_TWAMP_SESSION_STAT_AVG_LATENCY])
+    {
+        bucket++;
+    }
+    total_stats.latency_hist[bucket]++;
+
+    bucket = 0;
+    while (bucket < TWAMP_LATENCY_BUCKETS && (1ULL << bucket) <= stats[SAI_TWAMP_SESSION_STAT_AVG_JITTER])
+    {
+        bucket++;
+    }
+    total_stats.jitter_hist[bucket]++;
 }
 
 void TwampOrch::saveCountersTotal(const string& name, const sai_object_id_t session_id)
@@ -966,31 +974,75 @@ void TwampOrch::saveCountersTotal(const string& name, const sai_object_id_t sess
     values.emplace_back(sai_serialize_twamp_session_stat(SAI_TWAMP_SESSION_STAT_MIN_JITTER), to_string(total_stats.min_jitter));
     values.emplace_back(sai_serialize_twamp_session_stat(SAI_TWAMP_SESSION_STAT_AVG_JITTER), to_string(total_stats.avg_jitter));
 
+    /* bucket i counts intervals whose average was below 2^i; the final
+     * bucket is the overflow */
+    string latency_buckets;
+    string jitter_buckets;
+    for (size_t i = 0; i <= TWAMP_LATENCY_BUCKETS; i++)
+    {
+        if (i > 0)
+        {
+            latency_buckets += ',';
+            jitter_buckets += ',';
+        }
+        latency_buckets += to_string(total_stats.latency_hist[i]);
+        jitter_buckets += to_string(total_stats.jitter_hist[i]);
+    }
+    values.emplace_back("LATENCY_HIST_POW2", latency_buckets);
+    values.emplace_back("JITTER_HIST_POW2", jitter_buckets);
+
     m_countersTable->set(sai_serialize_object_id(session_id), values);
 }
 
-void TwampOrch::doTask(NotificationConsumer& consumer)
+void TwampOrch::publishCounters(const string& name, const sai_object_id_t session_id, bool force)
 {
     SWSS_LOG_ENTER();
 
-    if (!m_portsOrch->allPortsReady())
+    auto now = chrono::steady_clock::now();
+    auto it = m_lastStatsPublish.find(name);
+    if (!force && it != m_lastStatsPublish.end() &&
+        chrono::duration_cast<chrono::seconds>(now - it->second).count() < TWAMP_STATS_PUBLISH_INTERVAL_SECS)
     {
         return;
     }
+    m_lastStatsPublish[name] = now;
 
-    std::string op;
-    std::string data;
-    std::vector<swss::FieldValueTuple> values;
+    saveCountersTotal(name, session_id);
+}
 
-    consumer.pop(op, data, values);
+void TwampOrch::doTask(NotificationConsumer& consumer)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_portsOrch->allPortsReady())
+    {
+        return;
+    }
 
     if (&consumer != m_twampNotificationConsumer)
     {
         return;
     }
 
-    if (op == "twamp_session_event")
+    /* A large monitoring mesh delivers one event per session every
+     * statistics interval; drain the whole backlog in one pass and fold the
+     * counters into the in-memory aggregates, then publish each touched
+     * session at most once at the end instead of once per event */
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    consumer.pops(entries);
+
+    map<string, bool> touched;  /* session name -> publish immediately */
+
+    for (auto &entry : entries)
     {
+        string op = kfvOp(entry);
+        string data = kfvKey(entry);
+
+        if (op != "twamp_session_event")
+        {
+            continue;
+        }
+
         uint32_t count = 0;
         sai_twamp_session_event_notification_data_t *twamp_session = nullptr;
 
@@ -1018,7 +1070,7 @@ void TwampOrch::doTask(NotificationConsumer& consumer)
                 setSessionStatus(name, TWAMP_SESSION_STATUS_INACTIVE);
             }
 
-            /* save counter db */
+            /* fold counters into the in-memory aggregate */
             if (twamp_session[i].session_stats.number_of_counters)
             {
                 if (0 == stats_index)
@@ -1042,12 +1094,31 @@ void TwampOrch::doTask(NotificationConsumer& consumer)
                     }
                 }
 
-                saveSessionStatsLatest(session_id, stats_index, hw_stats);
                 calculateCounters(name, stats_index, hw_stats);
-                saveCountersTotal(name, session_id);
+
+                /* The end of a monitor run skips the rate limit so the
+                 * final numbers land right away */
+                if (session_state != SAI_TWAMP_SESSION_STATE_ACTIVE)
+                {
+                    touched[name] = true;
+                }
+                else
+                {
+                    touched.emplace(name, false);
+                }
             }
         }
 
         sai_deserialize_free_twamp_session_event_ntf(count, twamp_session);
     }
+
+    for (auto &it : touched)
+    {
+        auto entry = m_twampEntries.find(it.first);
+        if (entry == m_twampEntries.end())
+        {
+            continue;
+        }
+        publishCounters(it.first, entry->second.session_id, it.second);
+    }
 }
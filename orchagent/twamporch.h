@@ -8,8 +8,12 @@
 #include "vrforch.h"
 #include "ipaddress.h"
 #include "table.h"
+#include <chrono>
 #include <map>
 
+/* Power-of-two histogram buckets for per-interval latency/jitter samples */
+#define TWAMP_LATENCY_BUCKETS 24
+
 struct TwampStats
 {
     uint64_t rx_packets;
@@ -25,6 +29,13 @@ struct TwampStats
     uint64_t avg_jitter;
     uint64_t avg_latency_total;
     uint64_t avg_jitter_total;
+
+    /* One sample per statistics interval folded into power-of-two buckets,
+     * in the unit the SAI latency counters report; the last bucket is the
+     * overflow. Percentiles over the whole monitor run can be read off the
+     * bucket counts without keeping per-interval history in COUNTERS_DB. */
+    uint64_t latency_hist[TWAMP_LATENCY_BUCKETS + 1];
+    uint64_t jitter_hist[TWAMP_LATENCY_BUCKETS + 1];
 };
 
 struct TwampEntry
@@ -97,6 +108,8 @@ private:
 
     TwampEntryTable m_twampEntries;
     TwampStatsTable m_twampStatistics;
+    map<sai_object_id_t, string> m_twampSessionNameMap;  /* session OID -> name, for notification lookup */
+    map<string, std::chrono::steady_clock::time_point> m_lastStatsPublish;
 
     shared_ptr<DBConnector> m_asicDb;
     shared_ptr<DBConnector> m_countersDb;
@@ -127,9 +140,9 @@ private:
     void doTask(Consumer& consumer);
 
     bool addCounterNameMap(const string&, const sai_object_id_t session_id);
-    void saveSessionStatsLatest(const sai_object_id_t session_id, const uint32_t index, const vector<uint64_t>& stats);
     void calculateCounters(const string&, const uint32_t index, const vector<uint64_t>& stats);
     void saveCountersTotal(const string&, const sai_object_id_t session_id);
+    void publishCounters(const string&, const sai_object_id_t session_id, bool force);
     void doTask(NotificationConsumer& consumer);
 };
 
@@ -762,6 +762,37 @@ sai_object_id_t VNetRouteOrch::getNextHopGroupId(const string& vnet, const NextH
     return syncd_nexthop_groups_[vnet][nexthops].next_hop_group_id;
 }
 
+void VNetRouteOrch::indexNextHopGroup(const string& vnet, const NextHopGroupKey& nexthops)
+{
+    for (const auto& nh : nexthops.getNextHops())
+    {
+        nhgs_by_endpoint_[vnet][nh].insert(nexthops);
+    }
+}
+
+void VNetRouteOrch::unindexNextHopGroup(const string& vnet, const NextHopGroupKey& nexthops)
+{
+    auto it_vnet = nhgs_by_endpoint_.find(vnet);
+    if (it_vnet == nhgs_by_endpoint_.end())
+    {
+        return;
+    }
+
+    for (const auto& nh : nexthops.getNextHops())
+    {
+        auto it_ep = it_vnet->second.find(nh);
+        if (it_ep == it_vnet->second.end())
+        {
+            continue;
+        }
+        it_ep->second.erase(nexthops);
+        if (it_ep->second.empty())
+        {
+            it_vnet->second.erase(it_ep);
+        }
+    }
+}
+
 bool VNetRouteOrch::addNextHopGroup(const string& vnet, const NextHopGroupKey &nexthops, VNetVrfObject *vrf_obj, const string& monitoring,  const bool isLocalEp)
 {
     SWSS_LOG_ENTER();
@@ -871,6 +902,7 @@ bool VNetRouteOrch::addNextHopGroup(const string& vnet, const NextHopGroupKey &n
      */
     next_hop_group_entry.ref_count = 0;
     syncd_nexthop_groups_[vnet][nexthops] = next_hop_group_entry;
+    indexNextHopGroup(vnet, nexthops);
 
     return true;
 }
@@ -928,6 +960,7 @@ bool VNetRouteOrch::removeNextHopGroup(const string& vnet, const NextHopGroupKey
     gRouteOrch->decreaseNextHopGroupCount();
     gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP);
 
+    unindexNextHopGroup(vnet, nexthops);
     syncd_nexthop_groups_[vnet].erase(nexthops);
 
     return true;
@@ -971,6 +1004,7 @@ bool VNetRouteOrch::createNextHopGroup(const string& vnet,
             next_hop_group_entry.active_members[nexthop] = SAI_NULL_OBJECT_ID;
         }
         syncd_nexthop_groups_[vnet][nexthops] = next_hop_group_entry;
+        indexNextHopGroup(vnet, nexthops);
     }
     else
     {
@@ -992,34 +1026,49 @@ NextHopGroupKey VNetRouteOrch::getActiveNHSet(const string& vnet,
     // to identify the ones which are active based on their monitor session state.
     // These next hops are collected into another next hop group key called nhg_custom and returned.
     NextHopGroupKey nhg_custom("", true);
-    set<NextHopKey> next_hop_set = nexthops.getNextHops();
-    for (auto it : next_hop_set)
+
+    auto it_vnet = monitor_info_.find(vnet);
+    if (it_vnet == monitor_info_.end())
     {
-        if(monitor_info_.find(vnet) != monitor_info_.end() &&
-            monitor_info_[vnet].find(ipPrefix) != monitor_info_[vnet].end())
+        return nhg_custom;
+    }
+
+    auto it_prefix = it_vnet->second.find(ipPrefix);
+    if (it_prefix == it_vnet->second.end())
+    {
+        return nhg_custom;
+    }
+
+    // Collect the endpoints whose monitor session is up in one pass over
+    // the session table, then intersect with the group's next hops. The
+    // previous code rescanned every session once per next hop, which made
+    // each monitor update quadratic in the endpoint count.
+    set<NextHopKey> active_endpoints;
+    for (const auto& monitor : it_prefix->second)
+    {
+        const auto& info = monitor.second;
+        if (info.monitoring_type == VNET_MONITORING_TYPE_CUSTOM &&
+            info.state == MONITOR_SESSION_STATE_UP)
         {
-            for (auto monitor : monitor_info_[vnet][ipPrefix])
-            {
-                if (monitor.second.endpoint == it)
-                {
-                    if (monitor.second.monitoring_type == VNET_MONITORING_TYPE_CUSTOM && monitor.second.state == MONITOR_SESSION_STATE_UP)
-                    {
-                        // monitor session exists and is up
-                        nhg_custom.add(it);
+            // monitor session exists and is up
+            active_endpoints.insert(info.endpoint);
+        }
 
-                    }
+        if (info.monitoring_type == VNET_MONITORING_TYPE_CUSTOM_BFD &&
+            (info.pinned_state == PINNED_STATE_UP ||
+                (info.custom_bfd_state == SAI_BFD_SESSION_STATE_UP &&
+                 info.pinned_state != PINNED_STATE_DOWN)))
+        {
+            // BFD session exists and is up
+            active_endpoints.insert(info.endpoint);
+        }
+    }
 
-                    if (monitor.second.monitoring_type == VNET_MONITORING_TYPE_CUSTOM_BFD &&
-                        (monitor.second.pinned_state == PINNED_STATE_UP ||
-                            (monitor.second.custom_bfd_state == SAI_BFD_SESSION_STATE_UP &&
-                             monitor.second.pinned_state != PINNED_STATE_DOWN)))
-                    {
-                        // BFD session exists and is up
-                        nhg_custom.add(it);
-                    }
-                    continue;
-                }
-            }
+    for (const auto& nh : nexthops.getNextHops())
+    {
+        if (active_endpoints.find(nh) != active_endpoints.end())
+        {
+            nhg_custom.add(nh);
         }
     }
     return nhg_custom;
@@ -1124,6 +1173,7 @@ bool VNetRouteOrch::selectNextHopGroup(const string& vnet,
             next_hop_group_entry.next_hop_group_id = SAI_NULL_OBJECT_ID;
             next_hop_group_entry.ref_count = 0;
             syncd_nexthop_groups_[vnet][nhg_custom] = next_hop_group_entry;
+            indexNextHopGroup(vnet, nhg_custom);
         }
         nexthops_selected = nhg_custom;
         return true;
@@ -1325,6 +1375,7 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
                         }
                         else
                         {
+                            unindexNextHopGroup(vnet, nhg);
                             syncd_nexthop_groups_[vnet].erase(nhg);
                             if(nhg.getSize() == 1)
                             {
@@ -1428,6 +1479,7 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
             }
             else
             {
+                unindexNextHopGroup(vnet, nhg);
                 syncd_nexthop_groups_[vnet].erase(nhg);
                 // We need to check specifically if there is only one next hop active.
                 // In case of Priority routes we can end up in a situation where the active NHG has 0 nexthops.
@@ -2730,10 +2782,33 @@ void VNetRouteOrch::updateVnetTunnel(const BfdUpdate& update)
 
     nexthop_info_[vnet][endpoint.ip_address].bfd_state = state;
 
-    for (auto& nhg_info_pair : syncd_nexthop_groups_[vnet])
+    auto it_ep_index = nhgs_by_endpoint_.find(vnet);
+    if (it_ep_index == nhgs_by_endpoint_.end())
     {
-        NextHopGroupKey nexthops = nhg_info_pair.first;
-        NextHopGroupInfo& nhg_info = nhg_info_pair.second;
+        return;
+    }
+
+    auto it_groups = it_ep_index->second.find(endpoint);
+    if (it_groups == it_ep_index->second.end())
+    {
+        SWSS_LOG_INFO("No next hop group references endpoint %s", endpoint.to_string().c_str());
+        return;
+    }
+
+    /*
+     * Walk only the groups referencing the endpoint, on a copy of the key
+     * set: re-creating or withdrawing routes below can re-index groups.
+     */
+    auto group_keys = it_groups->second;
+
+    for (auto nexthops : group_keys)
+    {
+        auto it_nhg = syncd_nexthop_groups_[vnet].find(nexthops);
+        if (it_nhg == syncd_nexthop_groups_[vnet].end())
+        {
+            continue;
+        }
+        NextHopGroupInfo& nhg_info = it_nhg->second;
 
         std::set<NextHopKey> next_hop_set = nexthops.getNextHops();
         uint32_t seq_id = 0;
@@ -3047,6 +3122,7 @@ void VNetRouteOrch::updateVnetTunnelCustomMonitor(const MonitorUpdate& update)
             next_hop_group_entry.next_hop_group_id = SAI_NULL_OBJECT_ID;
             next_hop_group_entry.ref_count = 0;
             syncd_nexthop_groups_[vnet][nhg_custom] = next_hop_group_entry;
+            indexNextHopGroup(vnet, nhg_custom);
         }
     }
     auto active_nhg_size = active_nhg.getSize();
@@ -3132,6 +3208,7 @@ void VNetRouteOrch::updateVnetTunnelCustomMonitor(const MonitorUpdate& update)
             }
             else
             {
+                unindexNextHopGroup(vnet, active_nhg);
                 syncd_nexthop_groups_[vnet].erase(active_nhg);
                 if(active_nhg_size == 1)
                 {
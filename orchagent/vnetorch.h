@@ -529,6 +529,8 @@ private:
 
     bool hasNextHopGroup(const string&, const NextHopGroupKey&);
     sai_object_id_t getNextHopGroupId(const string&, const NextHopGroupKey&);
+    void indexNextHopGroup(const string&, const NextHopGroupKey&);
+    void unindexNextHopGroup(const string&, const NextHopGroupKey&);
     bool addNextHopGroup(const string&, const NextHopGroupKey&, VNetVrfObject *vrf_obj,
                             const string& monitoring, const bool isLocalEp=false);
     bool removeNextHopGroup(const string&, const NextHopGroupKey&, VNetVrfObject *vrf_obj);
@@ -595,6 +597,12 @@ private:
     VNetRouteTable syncd_routes_;
     VNetNextHopObserverTable next_hop_observers_;
     std::map<std::string, VNetNextHopGroupInfoTable> syncd_nexthop_groups_;
+    /*
+     * Reverse index: endpoint -> next hop groups referencing it, so an
+     * endpoint state change only visits the groups that actually contain
+     * the endpoint instead of scanning every group in the vnet.
+     */
+    std::map<std::string, std::map<NextHopKey, std::set<NextHopGroupKey>>> nhgs_by_endpoint_;
     std::map<std::string, VNetTunnelRouteTable> syncd_tunnel_routes_;
     std::map<std::string, bool> vnet_tunnel_route_check_directly_connected;
     BfdSessionTable bfd_sessions_;
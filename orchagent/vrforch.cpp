@@ -1,4 +1,5 @@
 #include <cassert>
+#include <inttypes.h>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -19,6 +20,7 @@ using namespace swss;
 
 extern sai_virtual_router_api_t* sai_virtual_router_api;
 extern sai_object_id_t gSwitchId;
+extern MacAddress gMacAddress;
 
 extern Directory<Orch*>      gDirectory;
 extern PortsOrch*            gPortsOrch;
@@ -89,18 +91,52 @@ bool VRFOrch::addOperation(const Request& request)
     if (it == std::end(vrf_table_))
     {
         // Create a new vrf
-        sai_object_id_t router_id;
-        sai_status_t status = sai_virtual_router_api->create_virtual_router(&router_id,
-                                                                            gSwitchId,
-                                                                            static_cast<uint32_t>(attrs.size()),
-                                                                            attrs.data());
-        if (status != SAI_STATUS_SUCCESS)
+        sai_object_id_t router_id = SAI_NULL_OBJECT_ID;
+
+        /* Serve the creation from the pool when a quarantined virtual
+         * router is available. Its attributes were reset to defaults on
+         * release, so only the requested deviations are applied here. */
+        while (!vrf_pool_.empty() && router_id == SAI_NULL_OBJECT_ID)
         {
-            SWSS_LOG_ERROR("Failed to create virtual router name: %s, rv: %d", vrf_name.c_str(), status);
-            task_process_status handle_status = handleSaiCreateStatus(SAI_API_VIRTUAL_ROUTER, status);
-            if (handle_status != task_success)
+            sai_object_id_t pooled_id = vrf_pool_.front();
+            vrf_pool_.pop_front();
+
+            bool applied = true;
+            for (const auto& pool_attr: attrs)
             {
-                return parseHandleSaiStatusFailure(handle_status);
+                sai_status_t set_status = sai_virtual_router_api->set_virtual_router_attribute(pooled_id, &pool_attr);
+                if (set_status != SAI_STATUS_SUCCESS)
+                {
+                    SWSS_LOG_WARN("Failed to apply attribute %d on pooled virtual router 0x%" PRIx64 ", rv: %d, discarding it",
+                                  pool_attr.id, pooled_id, set_status);
+                    sai_virtual_router_api->remove_virtual_router(pooled_id);
+                    applied = false;
+                    break;
+                }
+            }
+
+            if (applied)
+            {
+                router_id = pooled_id;
+                SWSS_LOG_INFO("VRF '%s' reuses pooled virtual router 0x%" PRIx64, vrf_name.c_str(), router_id);
+            }
+        }
+        publishVrfPoolGauge();
+
+        if (router_id == SAI_NULL_OBJECT_ID)
+        {
+            sai_status_t status = sai_virtual_router_api->create_virtual_router(&router_id,
+                                                                                gSwitchId,
+                                                                                static_cast<uint32_t>(attrs.size()),
+                                                                                attrs.data());
+            if (status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Failed to create virtual router name: %s, rv: %d", vrf_name.c_str(), status);
+                task_process_status handle_status = handleSaiCreateStatus(SAI_API_VIRTUAL_ROUTER, status);
+                if (handle_status != task_success)
+                {
+                    return parseHandleSaiStatusFailure(handle_status);
+                }
             }
         }
 
@@ -170,14 +206,26 @@ bool VRFOrch::delOperation(const Request& request)
         return false;
 
     sai_object_id_t router_id = vrf_table_[vrf_name].vrf_id;
-    sai_status_t status = sai_virtual_router_api->remove_virtual_router(router_id);
-    if (status != SAI_STATUS_SUCCESS)
+    if (vrf_pool_.size() < VRF_POOL_MAX_SIZE && resetVirtualRouterAttributes(router_id))
     {
-        SWSS_LOG_ERROR("Failed to remove virtual router name: %s, rv:%d", vrf_name.c_str(), status);
-        task_process_status handle_status = handleSaiRemoveStatus(SAI_API_VIRTUAL_ROUTER, status);
-        if (handle_status != task_success)
+        /* Quarantine the virtual router for reuse instead of paying the
+         * remove/create round trip on the next churn cycle */
+        vrf_pool_.push_back(router_id);
+        publishVrfPoolGauge();
+        SWSS_LOG_INFO("Virtual router 0x%" PRIx64 " of VRF '%s' returned to the pool, %zu pooled",
+                      router_id, vrf_name.c_str(), vrf_pool_.size());
+    }
+    else
+    {
+        sai_status_t status = sai_virtual_router_api->remove_virtual_router(router_id);
+        if (status != SAI_STATUS_SUCCESS)
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            SWSS_LOG_ERROR("Failed to remove virtual router name: %s, rv:%d", vrf_name.c_str(), status);
+            task_process_status handle_status = handleSaiRemoveStatus(SAI_API_VIRTUAL_ROUTER, status);
+            if (handle_status != task_success)
+            {
+                return parseHandleSaiStatusFailure(handle_status);
+            }
         }
     }
 
@@ -197,6 +245,62 @@ bool VRFOrch::delOperation(const Request& request)
     return true;
 }
 
+/*
+ * Reset a virtual router back to SAI attribute defaults before parking it
+ * in the pool, so a later reuse starts from the same state a freshly
+ * created virtual router would have.
+ */
+bool VRFOrch::resetVirtualRouterAttributes(sai_object_id_t router_id)
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attr;
+    vector<sai_attribute_t> attrs;
+
+    attr.id = SAI_VIRTUAL_ROUTER_ATTR_ADMIN_V4_STATE;
+    attr.value.booldata = true;
+    attrs.push_back(attr);
+
+    attr.id = SAI_VIRTUAL_ROUTER_ATTR_ADMIN_V6_STATE;
+    attr.value.booldata = true;
+    attrs.push_back(attr);
+
+    attr.id = SAI_VIRTUAL_ROUTER_ATTR_SRC_MAC_ADDRESS;
+    memcpy(attr.value.mac, gMacAddress.getMac(), sizeof(sai_mac_t));
+    attrs.push_back(attr);
+
+    attr.id = SAI_VIRTUAL_ROUTER_ATTR_VIOLATION_TTL1_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_TRAP;
+    attrs.push_back(attr);
+
+    attr.id = SAI_VIRTUAL_ROUTER_ATTR_VIOLATION_IP_OPTIONS_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_TRAP;
+    attrs.push_back(attr);
+
+    attr.id = SAI_VIRTUAL_ROUTER_ATTR_UNKNOWN_L3_MULTICAST_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_DROP;
+    attrs.push_back(attr);
+
+    for (const auto& reset_attr: attrs)
+    {
+        sai_status_t status = sai_virtual_router_api->set_virtual_router_attribute(router_id, &reset_attr);
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_WARN("Failed to reset virtual router 0x%" PRIx64 " attribute %d, rv: %d",
+                          router_id, reset_attr.id, status);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void VRFOrch::publishVrfPoolGauge()
+{
+    m_stateVrfPoolTable.hset("POOL", "occupancy", std::to_string(vrf_pool_.size()));
+    m_stateVrfPoolTable.hset("POOL", "capacity", std::to_string(VRF_POOL_MAX_SIZE));
+}
+
 bool VRFOrch::updateVrfVNIMap(const std::string& vrf_name, uint32_t vni)
 {
     SWSS_LOG_ENTER();
@@ -1,6 +1,8 @@
 #ifndef __VRFORCH_H
 #define __VRFORCH_H
 
+#include <deque>
+
 #include "request_parser.h"
 
 extern sai_object_id_t gVirtualRouterId;
@@ -51,7 +53,8 @@ class VRFOrch : public Orch2
 public:
     VRFOrch(swss::DBConnector *appDb, const std::string& appTableName, swss::DBConnector *stateDb, const std::string& stateTableName) :
         Orch2(appDb, appTableName, request_),
-        m_stateVrfObjectTable(stateDb, stateTableName)
+        m_stateVrfObjectTable(stateDb, stateTableName),
+        m_stateVrfPoolTable(stateDb, "VRF_POOL_TABLE")
     {
     }
 
@@ -175,12 +178,22 @@ private:
     bool updateVrfVNIMap(const std::string& vrf_name, uint32_t vni);
     bool delVrfVNIMap(const std::string& vrf_name, uint32_t vni);
 
+    bool resetVirtualRouterAttributes(sai_object_id_t router_id);
+    void publishVrfPoolGauge();
+
     VRFTable vrf_table_;
     VRFIdNameTable vrf_id_table_;
     VRFRequest request_;
     VRFNameVNIMapTable vrf_vni_map_table_;
     swss::Table m_stateVrfObjectTable;
+    swss::Table m_stateVrfPoolTable;
     L3VNITable l3vni_table_;
+
+    /* Removed virtual routers are parked here after their attributes are
+     * reset to SAI defaults, ready to serve the next VRF creation without
+     * a create round trip */
+    std::deque<sai_object_id_t> vrf_pool_;
+    static const size_t VRF_POOL_MAX_SIZE = 16;
 };
 
 #endif // __VRFORCH_H
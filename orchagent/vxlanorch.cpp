@@ -34,6 +34,10 @@ extern FlexManagerDirectory g_FlexManagerDirectory;
 extern bool gTraditionalFlexCounter;
 
 #define FLEX_COUNTER_UPD_INTERVAL 1
+/* Grace period before an unused remote VTEP tunnel is torn down, and the
+ * interval at which parked deletions are swept. */
+#define DIP_TUNNEL_DEL_GRACE_PERIOD 1
+#define DIP_TUNNEL_DEL_SWEEP_INTERVAL 1
 
 const map<MAP_T, uint32_t> vxlanTunnelMap =
 {
@@ -611,6 +615,24 @@ sai_object_id_t VxlanTunnel::getNextHop(IpAddress& ipAddr,
     return nh_tunnels_.at(key).nh_id;
 }
 
+sai_object_id_t VxlanTunnel::refNextHop(IpAddress& ipAddr, MacAddress macAddress, uint32_t vni)
+{
+    auto key = nh_key_t(ipAddr, macAddress, vni);
+
+    auto it = nh_tunnels_.find(key);
+    if (it == nh_tunnels_.end())
+    {
+        return SAI_NULL_OBJECT_ID;
+    }
+
+    it->second.ref_count ++;
+    SWSS_LOG_INFO("refcnt increment NH tunnel for ip %s, mac %s, vni %d, ref_count %d",
+            ipAddr.to_string().c_str(), macAddress.to_string().c_str(), vni,
+            it->second.ref_count);
+
+    return it->second.nh_id;
+}
+
 void VxlanTunnel::incNextHopRefCount(IpAddress& ipAddr, MacAddress macAddress, uint32_t vni)
 {
     auto key = nh_key_t(ipAddr, macAddress, vni);
@@ -645,14 +667,14 @@ bool VxlanTunnel::removeNextHop(IpAddress& ipAddr, MacAddress macAddress, uint32
 
     SWSS_LOG_INFO("remove NH tunnel for ip %s, mac %s, vni %d, ref_count %d",
                     ipAddr.to_string().c_str(), macAddress.to_string().c_str(), vni,
-                    nh_tunnels_[key].ref_count);
+                    it->second.ref_count);
 
     //Decrement ref count if already exists
-    nh_tunnels_[key].ref_count --;
+    it->second.ref_count --;
 
-    if (!nh_tunnels_[key].ref_count)
+    if (!it->second.ref_count)
     {
-        sai_status_t status = sai_next_hop_api->remove_next_hop(nh_tunnels_[key].nh_id);
+        sai_status_t status = sai_next_hop_api->remove_next_hop(it->second.nh_id);
         if (status != SAI_STATUS_SUCCESS)
         {
             task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NEXT_HOP, status);
@@ -664,7 +686,7 @@ bool VxlanTunnel::removeNextHop(IpAddress& ipAddr, MacAddress macAddress, uint32
             }
         }
 
-        nh_tunnels_.erase(key);
+        nh_tunnels_.erase(it);
     }
 
     SWSS_LOG_INFO("NH tunnel for ip '%s', mac '%s' vni %d updated/deleted",
@@ -1169,27 +1191,26 @@ bool VxlanTunnel::createDynamicDIPTunnel(const std::string dip, tunnel_user_t us
         dip_tunnel->createTunnelHw(mapper_list,TUNNEL_MAP_USE_COMMON_ENCAP_DECAP, false);
         SWSS_LOG_NOTICE("Created P2P Tunnel remote IP %s ", dip.c_str());
     }
-    else 
+    else
     {
         tnl_refcnts = it->second;
         updateRemoteEndPointRefCnt(true,tnl_refcnts,usr);
         tnl_users_[dip] = tnl_refcnts;
+        // The tunnel may be parked for deferred deletion; reuse it.
+        tunnel_orch->cancelDipTunnelDelete(dip);
     }
 
     return true;
 }
 
-bool VxlanTunnel::deleteDynamicDIPTunnel(const std::string dip, tunnel_user_t usr, 
+bool VxlanTunnel::deleteDynamicDIPTunnel(const std::string dip, tunnel_user_t usr,
                                                                 bool update_refcnt)
 {
-    uint8_t mapper_list = 0;
     tunnel_refcnt_t tnl_refcnts;
-    VxlanTunnel* dip_tunnel = NULL;
     VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
     Port tunnelPort;
-    std::string tunnel_name;
 
-    auto it = tnl_users_.find(dip); 
+    auto it = tnl_users_.find(dip);
     if (it != tnl_users_.end())
     {
         tnl_refcnts = it->second;
@@ -1207,32 +1228,20 @@ bool VxlanTunnel::deleteDynamicDIPTunnel(const std::string dip, tunnel_user_t us
         {
             return true;
         }
- 
+
         if (tunnel_orch->getTunnelPort(dip, tunnelPort))
         {
             SWSS_LOG_NOTICE("DIP = %s Not deleting tunnel from HW as tunnelPort is not yet deleted. fdbcount = %d",
                            dip.c_str(),tunnelPort.m_fdb_count);
             return true;
         }
- 
-        tunnel_orch->getTunnelNameFromDIP(dip, tunnel_name);
-        dip_tunnel = tunnel_orch->getVxlanTunnel(tunnel_name);
-        if (!dip_tunnel)
-        {
-            SWSS_LOG_INFO("DIP Tunnel is NULL unexpected");
-            return false;
-        }
- 
-        TUNNELMAP_SET_VLAN(mapper_list);
-        TUNNELMAP_SET_VRF(mapper_list);
-        dip_tunnel->deleteTunnelHw(mapper_list,TUNNEL_MAP_USE_COMMON_ENCAP_DECAP, false);
- 
-        tnl_users_.erase(dip);
- 
-        tunnel_orch->delTunnel(tunnel_name);
-        SWSS_LOG_NOTICE("P2P Tunnel deleted : %s", tunnel_name.c_str());
+
+        // Last user gone: park the tunnel for a grace period instead of
+        // tearing it down, so a type-5 route that flaps back shortly
+        // afterwards reuses the hardware objects.
+        tunnel_orch->deferDipTunnelDelete(dip, this);
     }
-    else 
+    else
     {
         SWSS_LOG_WARN("Unable to find dynamic tunnel for deletion");
     }
@@ -1240,6 +1249,56 @@ bool VxlanTunnel::deleteDynamicDIPTunnel(const std::string dip, tunnel_user_t us
     return true;
 }
 
+bool VxlanTunnel::destroyDynamicDIPTunnel(const std::string dip)
+{
+    uint8_t mapper_list = 0;
+    tunnel_refcnt_t tnl_refcnts;
+    VxlanTunnel* dip_tunnel = NULL;
+    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
+    Port tunnelPort;
+    std::string tunnel_name;
+
+    auto it = tnl_users_.find(dip);
+    if (it == tnl_users_.end())
+    {
+        SWSS_LOG_WARN("Unable to find dynamic tunnel for deletion");
+        return true;
+    }
+
+    tnl_refcnts = it->second;
+    if (tnl_refcnts.imr_refcnt + tnl_refcnts.mac_refcnt + tnl_refcnts.ip_refcnt)
+    {
+        // A user came back while the deletion was parked; keep the tunnel.
+        return true;
+    }
+
+    if (tunnel_orch->getTunnelPort(dip, tunnelPort))
+    {
+        SWSS_LOG_NOTICE("DIP = %s Not deleting tunnel from HW as tunnelPort is not yet deleted. fdbcount = %d",
+                       dip.c_str(),tunnelPort.m_fdb_count);
+        return true;
+    }
+
+    tunnel_orch->getTunnelNameFromDIP(dip, tunnel_name);
+    dip_tunnel = tunnel_orch->getVxlanTunnel(tunnel_name);
+    if (!dip_tunnel)
+    {
+        SWSS_LOG_INFO("DIP Tunnel is NULL unexpected");
+        return false;
+    }
+
+    TUNNELMAP_SET_VLAN(mapper_list);
+    TUNNELMAP_SET_VRF(mapper_list);
+    dip_tunnel->deleteTunnelHw(mapper_list,TUNNEL_MAP_USE_COMMON_ENCAP_DECAP, false);
+
+    tnl_users_.erase(dip);
+
+    tunnel_orch->delTunnel(tunnel_name);
+    SWSS_LOG_NOTICE("P2P Tunnel deleted : %s", tunnel_name.c_str());
+
+    return true;
+}
+
 //------------------- VxlanTunnelOrch Implementation --------------------------//
 
 VxlanTunnelOrch::VxlanTunnelOrch(DBConnector *statedb, DBConnector *db, const std::string& tableName) :
@@ -1304,12 +1363,23 @@ VxlanTunnelOrch::VxlanTunnelOrch(DBConnector *statedb, DBConnector *db, const st
     auto executorT = new ExecutableTimer(m_FlexCounterUpdTimer, this, "FLEX_COUNTER_UPD_TIMER");
     Orch::addExecutor(executorT);
 
+    auto delIntervT = timespec { .tv_sec = DIP_TUNNEL_DEL_SWEEP_INTERVAL , .tv_nsec = 0 };
+    m_DipTunnelDelTimer = new SelectableTimer(delIntervT);
+    auto delExecutorT = new ExecutableTimer(m_DipTunnelDelTimer, this, "DIP_TUNNEL_DEL_TIMER");
+    Orch::addExecutor(delExecutorT);
+
 }
 
 void VxlanTunnelOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    if (&timer == m_DipTunnelDelTimer)
+    {
+        sweepDipTunnelDeletes();
+        return;
+    }
+
     for (auto it = m_pendingAddToFlexCntr.begin(); it != m_pendingAddToFlexCntr.end(); )
     {
         string value;
@@ -1339,6 +1409,90 @@ void VxlanTunnelOrch::doTask(SelectableTimer &timer)
         }
     }
 }
+void VxlanTunnelOrch::deferDipTunnelDelete(const std::string& dip, VxlanTunnel* vtep)
+{
+    SWSS_LOG_ENTER();
+
+    if (pending_dip_deletes_.empty())
+    {
+        m_DipTunnelDelTimer->start();
+    }
+
+    pending_dip_deletes_[dip] = PendingDipTunnelDelete {
+        vtep,
+        std::chrono::steady_clock::now() +
+            std::chrono::seconds(DIP_TUNNEL_DEL_GRACE_PERIOD)
+    };
+    SWSS_LOG_INFO("Parked DIP tunnel %s for deferred deletion", dip.c_str());
+}
+
+void VxlanTunnelOrch::cancelDipTunnelDelete(const std::string& dip)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = pending_dip_deletes_.find(dip);
+    if (it == pending_dip_deletes_.end())
+    {
+        return;
+    }
+
+    pending_dip_deletes_.erase(it);
+    SWSS_LOG_NOTICE("Reusing parked DIP tunnel %s", dip.c_str());
+    if (pending_dip_deletes_.empty())
+    {
+        m_DipTunnelDelTimer->stop();
+    }
+}
+
+void VxlanTunnelOrch::flushDipTunnelDeletes(VxlanTunnel* vtep)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto it = pending_dip_deletes_.begin(); it != pending_dip_deletes_.end(); )
+    {
+        if (it->second.vtep == vtep)
+        {
+            vtep->destroyDynamicDIPTunnel(it->first);
+            it = pending_dip_deletes_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if (pending_dip_deletes_.empty())
+    {
+        m_DipTunnelDelTimer->stop();
+    }
+}
+
+void VxlanTunnelOrch::sweepDipTunnelDeletes(void)
+{
+    SWSS_LOG_ENTER();
+
+    auto now = std::chrono::steady_clock::now();
+
+    for (auto it = pending_dip_deletes_.begin(); it != pending_dip_deletes_.end(); )
+    {
+        if (it->second.expiry > now)
+        {
+            ++it;
+            continue;
+        }
+
+        // When the tunnel port still exists the actual teardown is retried
+        // from the deleteTunnelPort path, which re-parks the tunnel.
+        it->second.vtep->destroyDynamicDIPTunnel(it->first);
+        it = pending_dip_deletes_.erase(it);
+    }
+
+    if (pending_dip_deletes_.empty())
+    {
+        m_DipTunnelDelTimer->stop();
+    }
+}
+
 void VxlanTunnelOrch::addTunnelToFlexCounter(sai_object_id_t oid, const string &name)
 {
     m_pendingAddToFlexCntr[oid] = name;
@@ -1397,18 +1551,18 @@ VxlanTunnelOrch::createNextHopTunnel(string tunnelName, IpAddress& ipAddr,
 {
     SWSS_LOG_ENTER();
 
-    if (!isTunnelExists(tunnelName))
+    auto tunnel_it = vxlan_tunnel_table_.find(tunnelName);
+    if (tunnel_it == vxlan_tunnel_table_.end())
     {
         SWSS_LOG_ERROR("Vxlan tunnel '%s' does not exists", tunnelName.c_str());
         return SAI_NULL_OBJECT_ID;
     }
 
-    auto tunnel_obj = getVxlanTunnel(tunnelName);
+    auto tunnel_obj = tunnel_it->second.get();
     sai_object_id_t nh_id, tunnel_id = tunnel_obj->getTunnelId();
 
-    if ((nh_id = tunnel_obj->getNextHop(ipAddr, macAddress, vni)) != SAI_NULL_OBJECT_ID)
+    if ((nh_id = tunnel_obj->refNextHop(ipAddr, macAddress, vni)) != SAI_NULL_OBJECT_ID)
     {
-        tunnel_obj->incNextHopRefCount(ipAddr, macAddress, vni);
         return nh_id;
     }
 
@@ -1455,16 +1609,15 @@ VxlanTunnelOrch::removeNextHopTunnel(string tunnelName, IpAddress& ipAddr, MacAd
                     tunnelName.c_str(), ipAddr.to_string().c_str(), 
                     macAddress.to_string().c_str(), vni);
 
-    if (!isTunnelExists(tunnelName))
+    auto tunnel_it = vxlan_tunnel_table_.find(tunnelName);
+    if (tunnel_it == vxlan_tunnel_table_.end())
     {
         SWSS_LOG_ERROR("Vxlan tunnel '%s' does not exists", tunnelName.c_str());
         return false;
     }
 
-    auto tunnel_obj = getVxlanTunnel(tunnelName);
-
     //Delete request for the nh tunnel id
-    return tunnel_obj->removeNextHop(ipAddr, macAddress, vni);
+    return tunnel_it->second->removeNextHop(ipAddr, macAddress, vni);
 }
 
 bool VxlanTunnelOrch::createVxlanTunnelMap(string tunnelName, tunnel_map_type_t map, uint32_t vni,
@@ -1664,6 +1817,13 @@ bool VxlanTunnelOrch::delOperation(const Request& request)
         return false;
     }
 
+    if (vtep_ptr)
+    {
+        // Execute any deferred DIP tunnel deletions owned by this VTEP
+        // before the object goes away.
+        flushDipTunnelDeletes(vtep_ptr);
+    }
+
     vxlan_tunnel_table_.erase(tunnel_name);
 
     SWSS_LOG_NOTICE("Vxlan tunnel '%s' was removed", tunnel_name.c_str());
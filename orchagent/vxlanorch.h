@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <unordered_map>
 #include <set>
@@ -198,6 +199,9 @@ public:
     void updateNextHop(IpAddress& ipAddr, MacAddress macAddress, uint32_t vni, sai_object_id_t nhId);
     bool removeNextHop(IpAddress& ipAddr, MacAddress macAddress, uint32_t vni);
     sai_object_id_t getNextHop(IpAddress& ipAddr, MacAddress macAddress, uint32_t vni) const;
+    // single-lookup variant of getNextHop + incNextHopRefCount for the
+    // resolution hot path where thousands of routes share one endpoint
+    sai_object_id_t refNextHop(IpAddress& ipAddr, MacAddress macAddress, uint32_t vni);
 
     void incNextHopRefCount(IpAddress& ipAddr, MacAddress macAddress, uint32_t vni);
     void decNextHopRefCount(IpAddress& ipAddr, MacAddress macAddress, uint32_t vni);
@@ -218,6 +222,7 @@ public:
     int getDipTunnelCnt();
     bool createDynamicDIPTunnel(const string dip, tunnel_user_t usr);
     bool deleteDynamicDIPTunnel(const string dip, tunnel_user_t usr, bool update_refcnt = true);
+    bool destroyDynamicDIPTunnel(const string dip);
     bool isTunnelReferenced(void);
     void updateRemoteEndPointIpRef(const std::string remote_vtep, bool inc);
     uint32_t vlan_vrf_vni_count = 0;
@@ -331,6 +336,10 @@ public:
 
     void deleteTunnelPort(Port &tunnelPort);
 
+    void deferDipTunnelDelete(const std::string& dip, VxlanTunnel* vtep);
+    void cancelDipTunnelDelete(const std::string& dip);
+    void flushDipTunnelDeletes(VxlanTunnel* vtep);
+
     void addRemoveStateTableEntry(const string, IpAddress&, IpAddress&, tunnel_creation_src_t, bool);
 
     std::string getTunnelPortName(const std::string& vtep, bool local=false);
@@ -375,6 +384,19 @@ private:
     virtual bool addOperation(const Request& request);
     virtual bool delOperation(const Request& request);
     void doTask(swss::SelectableTimer&);
+    void sweepDipTunnelDeletes(void);
+
+    /*
+     * Remote VTEPs whose last user went away, parked for a grace period
+     * before the SAI tunnel is torn down so a route that flaps back
+     * shortly afterwards reuses the existing hardware objects.
+     */
+    struct PendingDipTunnelDelete
+    {
+        VxlanTunnel* vtep;
+        std::chrono::steady_clock::time_point expiry;
+    };
+    std::map<std::string, PendingDipTunnelDelete> pending_dip_deletes_;
 
     VxlanTunnelTable vxlan_tunnel_table_;
     VxlanTunnelRequest request_;
@@ -391,6 +413,7 @@ private:
     shared_ptr<DBConnector> m_counter_db;
     shared_ptr<DBConnector> m_asic_db;
     SelectableTimer* m_FlexCounterUpdTimer = nullptr;
+    SelectableTimer* m_DipTunnelDelTimer = nullptr;
     bool is_dip_tunnel_supported;
 };
 
@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "warmviewcmp.h"
+#include "dbconnector.h"
+#include "logger.h"
+#include "table.h"
+
+using namespace std;
+using namespace swss;
+
+#define ASIC_STATE_PREFIX      "ASIC_STATE:"
+#define TEMP_ASIC_STATE_PREFIX "TEMP_ASIC_STATE:"
+
+namespace
+{
+
+struct FamilyStats
+{
+    size_t identical = 0;
+    size_t changed = 0;
+    size_t created = 0;
+    size_t removed = 0;
+};
+
+/* Presence of an object key in the two views */
+enum
+{
+    IN_CURRENT = 0x1,
+    IN_TEMP    = 0x2,
+};
+
+/*
+ * Split "<prefix>SAI_OBJECT_TYPE_X:<serialized id>" into family and id. The
+ * serialized id can itself contain colons (entry keys carry JSON), so only
+ * the first separator after the object type counts.
+ */
+bool splitAsicKey(const string &key, size_t prefix_len, string &family, string &id)
+{
+    auto sep = key.find(':', prefix_len);
+    if (sep == string::npos)
+    {
+        return false;
+    }
+
+    family = key.substr(prefix_len, sep - prefix_len);
+    id = key.substr(sep + 1);
+    return true;
+}
+
+}
+
+size_t WarmViewCmp::prevalidate()
+{
+    SWSS_LOG_ENTER();
+
+    auto start = chrono::steady_clock::now();
+
+    DBConnector asicDb("ASIC_DB", 0);
+
+    /* family -> object id -> presence flags */
+    map<string, map<string, int>> families;
+
+    for (const auto &key : asicDb.keys(ASIC_STATE_PREFIX "*"))
+    {
+        string family, id;
+        if (splitAsicKey(key, sizeof(ASIC_STATE_PREFIX) - 1, family, id))
+        {
+            families[family][id] |= IN_CURRENT;
+        }
+    }
+
+    for (const auto &key : asicDb.keys(TEMP_ASIC_STATE_PREFIX "*"))
+    {
+        string family, id;
+        if (splitAsicKey(key, sizeof(TEMP_ASIC_STATE_PREFIX) - 1, family, id))
+        {
+            families[family][id] |= IN_TEMP;
+        }
+    }
+
+    vector<string> familyNames;
+    familyNames.reserve(families.size());
+    for (const auto &entry : families)
+    {
+        familyNames.push_back(entry.first);
+    }
+
+    map<string, FamilyStats> results;
+    mutex resultsMutex;
+    atomic<size_t> nextFamily(0);
+
+    auto worker = [&]()
+    {
+        /* redis connections are not thread safe, one per worker */
+        DBConnector workerDb("ASIC_DB", 0);
+
+        size_t idx;
+        while ((idx = nextFamily.fetch_add(1)) < familyNames.size())
+        {
+            const string &family = familyNames[idx];
+            FamilyStats stats;
+
+            for (const auto &object : families[family])
+            {
+                if (object.second == IN_CURRENT)
+                {
+                    stats.removed++;
+                    continue;
+                }
+                if (object.second == IN_TEMP)
+                {
+                    stats.created++;
+                    continue;
+                }
+
+                auto current = workerDb.hgetall(ASIC_STATE_PREFIX + family + ":" + object.first);
+                auto intended = workerDb.hgetall(TEMP_ASIC_STATE_PREFIX + family + ":" + object.first);
+                if (current == intended)
+                {
+                    stats.identical++;
+                }
+                else
+                {
+                    stats.changed++;
+                }
+            }
+
+            lock_guard<mutex> lock(resultsMutex);
+            results[family] = stats;
+        }
+    };
+
+    size_t numWorkers = thread::hardware_concurrency();
+    if (numWorkers == 0)
+    {
+        numWorkers = 1;
+    }
+    numWorkers = min(numWorkers, familyNames.size());
+
+    vector<thread> pool;
+    for (size_t i = 0; i < numWorkers; i++)
+    {
+        pool.emplace_back(worker);
+    }
+    for (auto &t : pool)
+    {
+        t.join();
+    }
+
+    DBConnector stateDb("STATE_DB", 0);
+    Table cmpTable(&stateDb, WARM_VIEW_CMP_TABLE);
+
+    FamilyStats total;
+    for (const auto &entry : results)
+    {
+        const auto &stats = entry.second;
+
+        vector<FieldValueTuple> fvs;
+        fvs.emplace_back("identical", to_string(stats.identical));
+        fvs.emplace_back("changed", to_string(stats.changed));
+        fvs.emplace_back("created", to_string(stats.created));
+        fvs.emplace_back("removed", to_string(stats.removed));
+        cmpTable.set(entry.first, fvs);
+
+        total.identical += stats.identical;
+        total.changed += stats.changed;
+        total.created += stats.created;
+        total.removed += stats.removed;
+
+        if (stats.changed || stats.created || stats.removed)
+        {
+            SWSS_LOG_NOTICE("Warm view compare %s: %zu identical, %zu changed, %zu created, %zu removed",
+                            entry.first.c_str(), stats.identical, stats.changed, stats.created, stats.removed);
+        }
+    }
+
+    auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+    SWSS_LOG_NOTICE("Warm view compare finished in %lld ms over %zu families with %zu workers: "
+                    "%zu identical, %zu changed, %zu created, %zu removed",
+                    (long long)elapsed.count(), familyNames.size(), numWorkers,
+                    total.identical, total.changed, total.created, total.removed);
+
+    return total.changed + total.created + total.removed;
+}
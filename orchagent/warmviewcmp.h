@@ -0,0 +1,33 @@
+#ifndef SWSS_WARMVIEWCMP_H
+#define SWSS_WARMVIEWCMP_H
+
+#include <string>
+
+#define WARM_VIEW_CMP_TABLE "WARM_VIEW_COMPARE"
+
+/*
+ * WarmViewCmp pre-validates the warm restore before the APPLY_VIEW
+ * notification is sent to syncd. The replayed intended state sits in the
+ * temporary ASIC view next to the view that survived the reboot; a worker
+ * pool compares the two per object-type family concurrently and publishes
+ * identical/changed/created/removed counts to STATE_DB under
+ * WARM_VIEW_COMPARE, plus a one-line summary to the log.
+ *
+ * The comparison is strictly advisory. syncd's view comparison treats an
+ * object missing from the applied view as deleted, so orchagent cannot skip
+ * submitting unchanged objects; what this buys is an early, cheap answer to
+ * "how much will this warm reboot actually reprogram" while syncd is still
+ * holding the old view.
+ */
+class WarmViewCmp
+{
+public:
+    /* Compare the temporary ASIC view against the current one and publish
+     * the per-family results. Returns the number of changed objects. */
+    static size_t prevalidate();
+
+private:
+    WarmViewCmp() = default;
+};
+
+#endif /* SWSS_WARMVIEWCMP_H */
@@ -1,59 +1,79 @@
 -- KEYS - buffer IDs
 -- ARGV[1] - counters db index
 -- ARGV[2] - counters table name
--- ARGV[3] - poll time interval
+-- ARGV[3] - poll time interval (milliseconds)
 -- return nothing for now
 
 local counters_db = ARGV[1]
 local counters_table_name = 'COUNTERS'
+local poll_interval = tonumber(ARGV[3])
 
 local user_table_name = 'USER_WATERMARKS'
 local persistent_table_name = 'PERSISTENT_WATERMARKS'
 local periodic_table_name = 'PERIODIC_WATERMARKS'
+local history_table_name = 'WATERMARK_HISTORY'
 
 local sai_buffer_pool_watermark_stat_name = 'SAI_BUFFER_POOL_STAT_WATERMARK_BYTES'
 local sai_hdrm_pool_watermark_stat_name = 'SAI_BUFFER_POOL_STAT_XOFF_ROOM_WATERMARK_BYTES'
 
+-- Keep roughly ten minutes of per-pool samples for history queries
+local history_depth = 60
+if poll_interval and poll_interval > 0 then
+    history_depth = math.max(1, math.floor(600000 / poll_interval))
+end
+
 local rets = {}
 
 redis.call('SELECT', counters_db)
 
+local timestamp_struct = redis.call('TIME')
+local timestamp = timestamp_struct[1]
+
 -- Iterate through each buffer pool oid
 local n = table.getn(KEYS)
 for i = n, 1, -1 do
-    -- Get new watermark value from COUNTERS
-    local buffer_pool_wm = redis.call('HGET', counters_table_name .. ':' .. KEYS[i], sai_buffer_pool_watermark_stat_name)
-    local hdrm_pool_wm = redis.call('HGET', counters_table_name .. ':' .. KEYS[i], sai_hdrm_pool_watermark_stat_name)
+    -- Get both new watermark values from COUNTERS in a single read per pool
+    local pool_wms = redis.call('HMGET', counters_table_name .. ':' .. KEYS[i],
+                                sai_buffer_pool_watermark_stat_name, sai_hdrm_pool_watermark_stat_name)
+    local buffer_pool_wm = pool_wms[1]
+    local hdrm_pool_wm = pool_wms[2]
 
-    -- Get last value from *_WATERMARKS
-    local user_buffer_pool_wm = redis.call('HGET', user_table_name .. ':' .. KEYS[i], sai_buffer_pool_watermark_stat_name)
-    local persistent_buffer_pool_wm = redis.call('HGET', persistent_table_name .. ':' .. KEYS[i], sai_buffer_pool_watermark_stat_name)
-    local periodic_buffer_pool_wm = redis.call('HGET', periodic_table_name .. ':' .. KEYS[i], sai_buffer_pool_watermark_stat_name)
-
-    local user_hdrm_pool_wm = redis.call('HGET', user_table_name .. ':' .. KEYS[i], sai_hdrm_pool_watermark_stat_name)
-    local persistent_hdrm_pool_wm = redis.call('HGET', persistent_table_name .. ':' .. KEYS[i], sai_hdrm_pool_watermark_stat_name)
-    local periodic_hdrm_pool_wm = redis.call('HGET', periodic_table_name .. ':' .. KEYS[i], sai_hdrm_pool_watermark_stat_name)
+    -- Get last values from *_WATERMARKS, again one read per table
+    local user_wms = redis.call('HMGET', user_table_name .. ':' .. KEYS[i],
+                                sai_buffer_pool_watermark_stat_name, sai_hdrm_pool_watermark_stat_name)
+    local persistent_wms = redis.call('HMGET', persistent_table_name .. ':' .. KEYS[i],
+                                      sai_buffer_pool_watermark_stat_name, sai_hdrm_pool_watermark_stat_name)
+    local periodic_wms = redis.call('HMGET', periodic_table_name .. ':' .. KEYS[i],
+                                    sai_buffer_pool_watermark_stat_name, sai_hdrm_pool_watermark_stat_name)
 
     if buffer_pool_wm then
         buffer_pool_wm = tonumber(buffer_pool_wm)
 
         redis.call('HSET', user_table_name .. ':' .. KEYS[i], sai_buffer_pool_watermark_stat_name,
-                   user_buffer_pool_wm and math.max(buffer_pool_wm, user_buffer_pool_wm) or buffer_pool_wm)
+                   user_wms[1] and math.max(buffer_pool_wm, user_wms[1]) or buffer_pool_wm)
         redis.call('HSET', persistent_table_name .. ':' .. KEYS[i], sai_buffer_pool_watermark_stat_name,
-                   persistent_buffer_pool_wm and math.max(buffer_pool_wm, persistent_buffer_pool_wm) or buffer_pool_wm)
+                   persistent_wms[1] and math.max(buffer_pool_wm, persistent_wms[1]) or buffer_pool_wm)
         redis.call('HSET', periodic_table_name .. ':' .. KEYS[i], sai_buffer_pool_watermark_stat_name,
-                   periodic_buffer_pool_wm and math.max(buffer_pool_wm, periodic_buffer_pool_wm) or buffer_pool_wm)
+                   periodic_wms[1] and math.max(buffer_pool_wm, periodic_wms[1]) or buffer_pool_wm)
     end
 
     if hdrm_pool_wm then
         hdrm_pool_wm = tonumber(hdrm_pool_wm)
 
         redis.call('HSET', user_table_name .. ':' .. KEYS[i], sai_hdrm_pool_watermark_stat_name,
-                   user_hdrm_pool_wm and math.max(hdrm_pool_wm, user_hdrm_pool_wm) or hdrm_pool_wm)
+                   user_wms[2] and math.max(hdrm_pool_wm, user_wms[2]) or hdrm_pool_wm)
         redis.call('HSET', persistent_table_name .. ':' .. KEYS[i], sai_hdrm_pool_watermark_stat_name,
-                   persistent_hdrm_pool_wm and math.max(hdrm_pool_wm, persistent_hdrm_pool_wm) or hdrm_pool_wm)
+                   persistent_wms[2] and math.max(hdrm_pool_wm, persistent_wms[2]) or hdrm_pool_wm)
         redis.call('HSET', periodic_table_name .. ':' .. KEYS[i], sai_hdrm_pool_watermark_stat_name,
-                   periodic_hdrm_pool_wm and math.max(hdrm_pool_wm, periodic_hdrm_pool_wm) or hdrm_pool_wm)
+                   periodic_wms[2] and math.max(hdrm_pool_wm, periodic_wms[2]) or hdrm_pool_wm)
+    end
+
+    -- Append a capped history sample "timestamp:wm:hdrm_wm" so recent pool
+    -- watermark history can be queried without waiting for the next poll
+    if buffer_pool_wm or hdrm_pool_wm then
+        redis.call('LPUSH', history_table_name .. ':' .. KEYS[i],
+                   timestamp .. ':' .. tostring(buffer_pool_wm or '') .. ':' .. tostring(hdrm_pool_wm or ''))
+        redis.call('LTRIM', history_table_name .. ':' .. KEYS[i], 0, history_depth - 1)
     end
 end
 
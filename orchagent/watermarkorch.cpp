@@ -1,4 +1,5 @@
 #include "watermarkorch.h"
+#include "pipelineperf.h"
 #include "sai_serialize.h"
 #include "portsorch.h"
 #include "notifier.h"
@@ -21,16 +22,11 @@ extern BufferOrch *gBufferOrch;
 
 
 WatermarkOrch::WatermarkOrch(DBConnector *db, const vector<string> &tables):
-    Orch(db, tables)
+    Orch(db, tables, counter_orch_pri)
 {
     SWSS_LOG_ENTER();
 
-    m_countersDb = make_shared<DBConnector>("COUNTERS_DB", 0);
     m_appDb = make_shared<DBConnector>("APPL_DB", 0);
-    m_countersTable = make_shared<Table>(m_countersDb.get(), COUNTERS_TABLE);
-    m_periodicWatermarkTable = make_shared<Table>(m_countersDb.get(), PERIODIC_WATERMARKS_TABLE);
-    m_persistentWatermarkTable = make_shared<Table>(m_countersDb.get(), PERSISTENT_WATERMARKS_TABLE);
-    m_userWatermarkTable = make_shared<Table>(m_countersDb.get(), USER_WATERMARKS_TABLE);
 
     m_clearNotificationConsumer = new swss::NotificationConsumer(
             m_appDb.get(),
@@ -49,6 +45,21 @@ WatermarkOrch::~WatermarkOrch()
     SWSS_LOG_ENTER();
 }
 
+void WatermarkOrch::ensureCounterTables()
+{
+    if (m_countersDb != nullptr)
+    {
+        return;
+    }
+
+    m_countersDb = make_shared<DBConnector>("COUNTERS_DB", 0);
+    m_countersTable = make_shared<Table>(m_countersDb.get(), COUNTERS_TABLE);
+    m_countersPipeline = unique_ptr<RedisPipeline>(new RedisPipeline(m_countersDb.get()));
+    m_periodicWatermarkTable = make_shared<Table>(m_countersPipeline.get(), PERIODIC_WATERMARKS_TABLE, true);
+    m_persistentWatermarkTable = make_shared<Table>(m_countersPipeline.get(), PERSISTENT_WATERMARKS_TABLE, true);
+    m_userWatermarkTable = make_shared<Table>(m_countersPipeline.get(), USER_WATERMARKS_TABLE, true);
+}
+
 void WatermarkOrch::doTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
@@ -149,6 +160,8 @@ void WatermarkOrch::doTask(NotificationConsumer &consumer)
         return;
     }
 
+    ensureCounterTables();
+
     if (m_pg_ids.empty())
     {
         init_pg_ids();
@@ -228,12 +241,16 @@ void WatermarkOrch::doTask(NotificationConsumer &consumer)
         SWSS_LOG_WARN("Unknown watermark clear request data: %s", data.c_str());
         return;
     }
+
+    PipelinePerf::Instance().flushPipeline("WATERMARK", m_countersPipeline.get());
 }
 
 void WatermarkOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    ensureCounterTables();
+
     if (m_pg_ids.empty())
     {
         init_pg_ids();
@@ -277,6 +294,7 @@ void WatermarkOrch::doTask(SelectableTimer &timer)
         clearSingleWm(m_periodicWatermarkTable.get(),
                       "SAI_BUFFER_POOL_STAT_XOFF_ROOM_WATERMARK_BYTES",
                       gBufferOrch->getBufferPoolNameOidMap());
+        PipelinePerf::Instance().flushPipeline("WATERMARK", m_countersPipeline.get());
         SWSS_LOG_DEBUG("Periodic watermark cleared by timer!");
     }
 }
@@ -289,9 +307,9 @@ void WatermarkOrch::init_pg_ids()
     pg_index_table.get("", values);
     for (auto fv: values)
     {
-        sai_object_id_t id;
-        sai_deserialize_object_id(fv.first, id);
-        m_pg_ids.push_back(id);
+        /* The map keys are already the serialized oids the clear cycle
+         * writes back, keep them as-is */
+        m_pg_ids.push_back(fv.first);
     }
 }
 
@@ -303,24 +321,22 @@ void WatermarkOrch::init_queue_ids()
     m_queue_type_table.get("", values);
     for (auto fv: values)
     {
-        sai_object_id_t id;
-        sai_deserialize_object_id(fv.first, id);
         if (fv.second == "SAI_QUEUE_TYPE_UNICAST")
         {
-            m_unicast_queue_ids.push_back(id);
+            m_unicast_queue_ids.push_back(fv.first);
         }
         else if (fv.second == "SAI_QUEUE_TYPE_MULTICAST")
         {
-            m_multicast_queue_ids.push_back(id);
+            m_multicast_queue_ids.push_back(fv.first);
         }
         else if (fv.second == "SAI_QUEUE_TYPE_ALL")
         {
-            m_all_queue_ids.push_back(id);
+            m_all_queue_ids.push_back(fv.first);
         }
     }
 }
 
-void WatermarkOrch::clearSingleWm(Table *table, string wm_name, vector<sai_object_id_t> &obj_ids)
+void WatermarkOrch::clearSingleWm(Table *table, string wm_name, const vector<string> &obj_ids)
 {
     /* Zero-out some WM in some table for some vector of object ids*/
     SWSS_LOG_ENTER();
@@ -328,9 +344,9 @@ void WatermarkOrch::clearSingleWm(Table *table, string wm_name, vector<sai_objec
 
     vector<FieldValueTuple> vfvt = {{wm_name, "0"}};
 
-    for (sai_object_id_t id: obj_ids)
+    for (const string &id: obj_ids)
     {
-        table->set(sai_serialize_object_id(id), vfvt);
+        table->set(id, vfvt);
     }
 }
 
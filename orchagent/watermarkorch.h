@@ -7,6 +7,7 @@
 #include "port.h"
 
 #include "notificationconsumer.h"
+#include "redispipeline.h"
 #include "timer.h"
 
 const uint8_t queue_wm_status_mask = 1 << 0;
@@ -34,20 +35,27 @@ public:
     void handleWmConfigUpdate(const std::string &key, const std::vector<swss::FieldValueTuple> &fvt);
     void handleFcConfigUpdate(const std::string &key, const std::vector<swss::FieldValueTuple> &fvt);
 
-    void clearSingleWm(swss::Table *table, std::string wm_name, std::vector<sai_object_id_t> &obj_ids);
+    void clearSingleWm(swss::Table *table, std::string wm_name, const std::vector<std::string> &obj_ids);
     void clearSingleWm(swss::Table *table, std::string wm_name, const object_reference_map &nameOidMap);
 
     std::shared_ptr<swss::Table> getCountersTable(void)
     {
+        ensureCounterTables();
         return m_countersTable;
     }
 
     std::shared_ptr<swss::DBConnector> getCountersDb(void)
     {
+        ensureCounterTables();
         return m_countersDb;
     }
 
 private:
+    /* The COUNTERS_DB connection and watermark tables are created on first
+     * use instead of in the constructor; they stay unallocated on systems
+     * where the watermark counter groups are never enabled */
+    void ensureCounterTables();
+
     /*
     [7-2] - unused
     [1] - pg wm status
@@ -59,6 +67,9 @@ private:
     std::shared_ptr<swss::DBConnector> m_countersDb = nullptr;
     std::shared_ptr<swss::DBConnector> m_appDb = nullptr;
     std::shared_ptr<swss::Table> m_countersTable = nullptr;
+    /* The watermark tables are buffered over a dedicated pipeline so a
+     * clear cycle costs one redis round trip instead of one per object */
+    std::unique_ptr<swss::RedisPipeline> m_countersPipeline;
     std::shared_ptr<swss::Table> m_periodicWatermarkTable = nullptr;
     std::shared_ptr<swss::Table> m_persistentWatermarkTable = nullptr;
     std::shared_ptr<swss::Table> m_userWatermarkTable = nullptr;
@@ -66,10 +77,12 @@ private:
     swss::NotificationConsumer* m_clearNotificationConsumer = nullptr;
     swss::SelectableTimer* m_telemetryTimer = nullptr;
 
-    std::vector<sai_object_id_t> m_unicast_queue_ids;
-    std::vector<sai_object_id_t> m_multicast_queue_ids;
-    std::vector<sai_object_id_t> m_all_queue_ids;
-    std::vector<sai_object_id_t> m_pg_ids;
+    /* Serialized object ids, kept as the COUNTERS_DB key strings the clear
+     * cycle writes so they are not re-serialized every interval */
+    std::vector<std::string> m_unicast_queue_ids;
+    std::vector<std::string> m_multicast_queue_ids;
+    std::vector<std::string> m_all_queue_ids;
+    std::vector<std::string> m_pg_ids;
 };
 
 #endif // WATERMARKORCH_H
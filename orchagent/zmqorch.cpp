@@ -1,3 +1,5 @@
+#include <iterator>
+
 #include "zmqorch.h"
 
 using namespace swss;
@@ -12,22 +14,29 @@ void ZmqConsumer::execute()
     size_t update_size = 0;
     auto table = static_cast<swss::ZmqConsumerStateTable*>(getSelectable());
 
-    if (!m_ordered_queue)
+    /*
+     * Drain everything delivered for this wake before running doTask, so
+     * a burst costs a single doTask invocation instead of one per pop,
+     * and move the tuples into the pending containers rather than copying
+     * every key and field-value string.
+     */
+    do
     {
         std::deque<KeyOpFieldsValuesTuple> entries;
         table->pops(entries);
-        addToSync(entries);
-    }
-    else
-    {
-        do
+        update_size = entries.size();
+
+        if (!m_ordered_queue)
         {
-            std::deque<KeyOpFieldsValuesTuple> entries;
-            table->pops(entries);
-            update_size = entries.size();
-            m_queue.insert(m_queue.end(), entries.begin(), entries.end());
-        } while (update_size != 0);
-    }
+            addToSync(std::move(entries));
+        }
+        else
+        {
+            m_queue.insert(m_queue.end(),
+                           std::make_move_iterator(entries.begin()),
+                           std::make_move_iterator(entries.end()));
+        }
+    } while (update_size != 0);
 
     drain();
 }
@@ -36,6 +45,7 @@ void ZmqConsumer::drain()
 {
     if (!m_toSync.empty() || !m_queue.empty())
         (static_cast<ZmqOrch*>(m_orch))->doTask(*this);
+    reportPending();
 }
 
 ZmqOrch::ZmqOrch(DBConnector *db, const vector<string> &tableNames, ZmqServer *zmqServer, bool orderedQueue, bool dbPersistence)
@@ -130,13 +130,47 @@ void LinkSync::onMsg(int nlmsg_type, struct nl_object *obj)
     bool admin = flags & IFF_UP;
     bool oper = flags & IFF_RUNNING;
 
+    unsigned int ifindex = rtnl_link_get_ifindex(link);
+    int master = rtnl_link_get_master(link);
+    unsigned int mtu = rtnl_link_get_mtu(link);
+
+    /* Fast path: for a port already validated and published, a message that
+     * only toggles admin/oper flags is written straight to STATE_DB, so link
+     * transitions are not queued behind the PORT_TABLE lookup and the full
+     * attribute parse below. */
+    if (nlmsg_type == RTM_NEWLINK)
+    {
+        auto cached = m_ifindexPortCache.find(ifindex);
+        if (cached != m_ifindexPortCache.end() && cached->second.key == key &&
+            cached->second.mtu == mtu && cached->second.master == master)
+        {
+            unsigned int changed = cached->second.flags ^ flags;
+            if ((changed & ~(IFF_UP | IFF_RUNNING)) == 0)
+            {
+                if (changed)
+                {
+                    vector<FieldValueTuple> fvs;
+                    if (changed & IFF_UP)
+                    {
+                        fvs.emplace_back("admin_status", admin ? "up" : "down");
+                    }
+                    if (changed & IFF_RUNNING)
+                    {
+                        fvs.emplace_back("netdev_oper_status", oper ? "up" : "down");
+                    }
+                    m_statePortTable.set(key, fvs);
+                    cached->second.flags = flags;
+                    SWSS_LOG_NOTICE("Publish %s(ok:%s) to state db", key.c_str(), oper ? "up" : "down");
+                }
+                return;
+            }
+        }
+    }
+
     char addrStr[MAX_ADDR_SIZE+1] = {0};
     nl_addr2str(rtnl_link_get_addr(link), addrStr, MAX_ADDR_SIZE);
 
-    unsigned int ifindex = rtnl_link_get_ifindex(link);
-    int master = rtnl_link_get_master(link);
     char *type = rtnl_link_get_type(link);
-    unsigned int mtu = rtnl_link_get_mtu(link);
 
     if (type)
     {
@@ -181,6 +215,7 @@ void LinkSync::onMsg(int nlmsg_type, struct nl_object *obj)
 
     if (nlmsg_type == RTM_DELLINK)
     {
+        m_ifindexPortCache.erase(ifindex);
         m_statePortTable.del(key);
         SWSS_LOG_NOTICE("Delete %s(ok) from state db", key.c_str());
         return;
@@ -203,6 +238,7 @@ void LinkSync::onMsg(int nlmsg_type, struct nl_object *obj)
         vector.push_back(admin_status);
         vector.push_back(port_mtu);
         m_statePortTable.set(key, vector);
+        m_ifindexPortCache[ifindex] = { key, flags, mtu, master };
         SWSS_LOG_NOTICE("Publish %s(ok:%s) to state db", key.c_str(), oper ? "up" : "down");
     }
     else
@@ -6,9 +6,20 @@
 #include "netmsg.h"
 
 #include <map>
+#include <string>
 
 namespace swss {
 
+/* Last published link attributes, keyed by ifindex. Lets oper-status-only
+ * RTM_NEWLINK changes skip the PORT_TABLE lookup and full attribute parse. */
+struct LinkPortInfo
+{
+    std::string  key;
+    unsigned int flags;
+    unsigned int mtu;
+    int          master;
+};
+
 class LinkSync : public NetMsg
 {
 public:
@@ -24,6 +35,7 @@ private:
 
     std::map<unsigned int, std::string> m_ifindexNameMap;
     std::map<unsigned int, std::string> m_ifindexOldNameMap;
+    std::map<unsigned int, LinkPortInfo> m_ifindexPortCache;
 };
 
 }
@@ -0,0 +1,237 @@
+#include <errno.h>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * LD_PRELOAD sampling profiler, the production-grade sibling of
+ * gcovpreload: instead of flushing coverage on exit it captures the stack
+ * on every SIGPROF tick and appends the raw return addresses to a
+ * memory-mapped ring file. No symbolization, no allocation and no I/O
+ * happens in the signal handler, so the steady-state overhead is the
+ * backtrace walk itself; symbols are resolved offline from the binary and
+ * the /proc/self/maps snapshot written next to the ring. Because the ring
+ * is a shared mapping, the kernel persists whatever was captured even if
+ * the process dies on a fatal signal.
+ *
+ * Environment:
+ *   PROF_PRELOAD_FILE        ring file path (default /var/log/swss/profpreload.ring)
+ *   PROF_PRELOAD_HZ          sample frequency, 0 disables (default 99)
+ *   PROF_PRELOAD_RING_BYTES  ring size, rounded down to whole slots (default 4 MiB)
+ */
+
+#define PROF_MAGIC      0x53505246  /* "SPRF" */
+#define PROF_VERSION    1
+#define PROF_MAX_DEPTH  32
+
+#define PROF_DEFAULT_FILE   "/var/log/swss/profpreload.ring"
+#define PROF_DEFAULT_HZ     99
+#define PROF_DEFAULT_BYTES  (4u << 20)
+
+struct prof_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slot_count;
+    uint32_t max_depth;
+    uint64_t sample_period_usec;
+    /* Monotonically increasing; the slot in use is next_slot % slot_count,
+     * so the offline reader knows both the write position and how many
+     * samples wrapped away. */
+    volatile uint64_t next_slot;
+};
+
+struct prof_sample
+{
+    uint64_t timestamp_usec;    /* CLOCK_MONOTONIC */
+    uint32_t depth;             /* 0 marks a slot mid-write; readers skip it */
+    uint32_t pad;
+    uint64_t pc[PROF_MAX_DEPTH];
+};
+
+static struct prof_header *prof_hdr;
+static struct prof_sample *prof_slots;
+static size_t prof_map_size;
+
+static void prof_handler(int signo)
+{
+    (void)signo;
+
+    void *frames[PROF_MAX_DEPTH];
+    int depth = backtrace(frames, PROF_MAX_DEPTH);
+    if (depth <= 0)
+    {
+        return;
+    }
+
+    /* Process-directed SIGPROF is delivered to one thread at a time, but
+     * claim the slot atomically so an overlapping tick can never corrupt a
+     * neighbour's sample. */
+    uint64_t seq = __atomic_fetch_add(&prof_hdr->next_slot, 1, __ATOMIC_RELAXED);
+    struct prof_sample *s = &prof_slots[seq % prof_hdr->slot_count];
+
+    s->depth = 0;
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    s->timestamp_usec = (uint64_t)ts.tv_sec * 1000000u + (uint64_t)(ts.tv_nsec / 1000);
+
+    for (int i = 0; i < depth; ++i)
+    {
+        s->pc[i] = (uint64_t)frames[i];
+    }
+    s->depth = (uint32_t)depth;
+}
+
+/* Snapshot /proc/self/maps next to the ring so offline tooling can undo
+ * ASLR when resolving the captured addresses. */
+static void prof_dump_maps(const char *ring_path)
+{
+    char maps_path[4096];
+    snprintf(maps_path, sizeof(maps_path), "%s.maps", ring_path);
+
+    FILE *in = fopen("/proc/self/maps", "r");
+    FILE *out = fopen(maps_path, "w");
+    if (in != NULL && out != NULL)
+    {
+        char buf[4096];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), in)) > 0)
+        {
+            fwrite(buf, 1, n, out);
+        }
+    }
+    if (in != NULL)
+    {
+        fclose(in);
+    }
+    if (out != NULL)
+    {
+        fclose(out);
+    }
+}
+
+__attribute__ ((constructor))
+void prof_ctor()
+{
+    const char *env;
+
+    long hz = PROF_DEFAULT_HZ;
+    if ((env = getenv("PROF_PRELOAD_HZ")) != NULL)
+    {
+        hz = atol(env);
+    }
+    if (hz <= 0)
+    {
+        return;
+    }
+
+    const char *path = PROF_DEFAULT_FILE;
+    if ((env = getenv("PROF_PRELOAD_FILE")) != NULL && env[0] != '\0')
+    {
+        path = env;
+    }
+
+    size_t ring_bytes = PROF_DEFAULT_BYTES;
+    if ((env = getenv("PROF_PRELOAD_RING_BYTES")) != NULL)
+    {
+        long bytes = atol(env);
+        if (bytes > 0)
+        {
+            ring_bytes = (size_t)bytes;
+        }
+    }
+
+    uint32_t slot_count = (uint32_t)(ring_bytes / sizeof(struct prof_sample));
+    if (slot_count == 0)
+    {
+        slot_count = 1;
+    }
+    prof_map_size = sizeof(struct prof_header) + (size_t)slot_count * sizeof(struct prof_sample);
+
+    int fd = open(path, O_CREAT | O_RDWR | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        perror("profpreload: could not open ring file");
+        return;
+    }
+    if (ftruncate(fd, (off_t)prof_map_size) < 0)
+    {
+        perror("profpreload: could not size ring file");
+        close(fd);
+        return;
+    }
+
+    void *base = mmap(NULL, prof_map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        perror("profpreload: could not map ring file");
+        return;
+    }
+
+    prof_hdr = (struct prof_header *)base;
+    prof_slots = (struct prof_sample *)(prof_hdr + 1);
+    prof_hdr->version = PROF_VERSION;
+    prof_hdr->slot_count = slot_count;
+    prof_hdr->max_depth = PROF_MAX_DEPTH;
+    prof_hdr->sample_period_usec = (uint64_t)(1000000 / hz);
+    prof_hdr->next_slot = 0;
+    prof_hdr->magic = PROF_MAGIC;
+
+    prof_dump_maps(path);
+
+    /* backtrace() resolves its unwinder through the dynamic loader on
+     * first use, which may allocate; take that hit here rather than inside
+     * the signal handler. */
+    void *warm[PROF_MAX_DEPTH];
+    backtrace(warm, PROF_MAX_DEPTH);
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = prof_handler;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_RESTART;
+    if (sigaction(SIGPROF, &sa, NULL) == -1)
+    {
+        perror("profpreload: could not set SIGPROF handler");
+        return;
+    }
+
+    /* ITIMER_PROF ticks on consumed CPU time, so an idle orchagent costs
+     * nothing and a busy one is sampled evenly across its threads. */
+    struct itimerval timer;
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = (suseconds_t)(1000000 / hz);
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, NULL) == -1)
+    {
+        perror("profpreload: could not start profiling timer");
+    }
+}
+
+__attribute__ ((destructor))
+void prof_dtor()
+{
+    if (prof_hdr == NULL)
+    {
+        return;
+    }
+
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_PROF, &timer, NULL);
+
+    msync(prof_hdr, prof_map_size, MS_SYNC);
+    munmap(prof_hdr, prof_map_size);
+    prof_hdr = NULL;
+    prof_slots = NULL;
+}
@@ -23,6 +23,10 @@ const char* const op_name            = "OP";
 const char* const name_delimiter     = ":";
 const int el_count = 2;
 
+/* Number of commands buffered client-side before the pipeline flushes;
+ * sized so that a large config snapshot goes out in a few round trips */
+const size_t bulk_pipeline_size = 16384;
+
 const string SWSS_CONFIG_DIR    = "/etc/swss/config.d/";
 
 void usage()
@@ -74,9 +78,13 @@ bool write_db_data(vector<KeyOpFieldsValuesTuple> &db_items, set<string>  &zmq_t
     // Otherwise use APPL_DB
     string db_name = use_custom_endpoint ? "DPU_APPL_DB" : "APPL_DB";
     DBConnector db(db_name, 0, true);
-    RedisPipeline pipeline(&db); // dtor of RedisPipeline will automatically flush data
+    RedisPipeline pipeline(&db, bulk_pipeline_size); // dtor of RedisPipeline will automatically flush data
     unordered_map<string, shared_ptr<ProducerStateTable>> table_map;
 
+    // Validate and split every key up front so that a malformed entry
+    // aborts the file before anything has been written
+    vector<pair<string, string>> split_keys;
+    split_keys.reserve(db_items.size());
     for (auto &db_item : db_items)
     {
         dump_db_item(db_item);
@@ -88,22 +96,56 @@ bool write_db_data(vector<KeyOpFieldsValuesTuple> &db_items, set<string>  &zmq_t
             SWSS_LOG_ERROR("Invalid formatted hash:%s\n", key.c_str());
             return false;
         }
-        string table_name = key.substr(0, pos);
-        string key_name = key.substr(pos + 1);
+        if ((kfvOp(db_item) != SET_COMMAND) && (kfvOp(db_item) != DEL_COMMAND))
+        {
+            SWSS_LOG_ERROR("Invalid operation: %s\n", kfvOp(db_item).c_str());
+            return false;
+        }
+        split_keys.emplace_back(key.substr(0, pos), key.substr(pos + 1));
+    }
+
+    // Apply contiguous runs of the same table and operation with the
+    // vectorized producer calls; the runs are applied in file order, so
+    // the per-file ordering semantics are unchanged
+    for (size_t i = 0; i < db_items.size();)
+    {
+        const string &table_name = split_keys[i].first;
+        const string &op = kfvOp(db_items[i]);
+
+        size_t j = i;
+        while (j < db_items.size() && split_keys[j].first == table_name && kfvOp(db_items[j]) == op)
+        {
+            j++;
+        }
 
-        auto p_table= get_table(table_map, pipeline, table_name, zmq_tables, zmq_client);
+        auto p_table = get_table(table_map, pipeline, table_name, zmq_tables, zmq_client);
 
-        if (kfvOp(db_item) == SET_COMMAND)
-            p_table->set(key_name, kfvFieldsValues(db_item), SET_COMMAND);
-        else if (kfvOp(db_item) == DEL_COMMAND)
-            p_table->del(key_name, DEL_COMMAND);
+        if (op == SET_COMMAND)
+        {
+            vector<KeyOpFieldsValuesTuple> sets;
+            sets.reserve(j - i);
+            for (size_t k = i; k < j; k++)
+            {
+                sets.emplace_back(split_keys[k].second, SET_COMMAND, kfvFieldsValues(db_items[k]));
+            }
+            p_table->set(sets);
+        }
         else
         {
-            SWSS_LOG_ERROR("Invalid operation: %s\n", kfvOp(db_item).c_str());
-            return false;
+            vector<string> dels;
+            dels.reserve(j - i);
+            for (size_t k = i; k < j; k++)
+            {
+                dels.emplace_back(split_keys[k].second);
+            }
+            p_table->del(dels);
         }
+
+        i = j;
     }
 
+    pipeline.flush();
+
     return true;
 }
 
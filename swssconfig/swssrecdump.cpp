@@ -0,0 +1,178 @@
+#include <inttypes.h>
+#include <string.h>
+#include <time.h>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "recformat.h"
+
+using namespace std;
+using namespace swss;
+
+void usage()
+{
+    cout << "Usage: swssrecdump <file> [start-time] [end-time]" << endl;
+    cout << "       Prints a binary recording as the usual pipe-delimited text lines." << endl;
+    cout << "       Times are of the form 2024-01-01.12:00:00 (local time); when a" << endl;
+    cout << "       start time is given, the index sidecar <file>.idx is used to seek" << endl;
+    cout << "       to it instead of scanning the recording." << endl;
+}
+
+/* Parse "YYYY-MM-DD.HH:MM:SS" (local time) into epoch microseconds */
+bool parse_time(const string &text, uint64_t &usecs)
+{
+    struct tm tm_info = {};
+
+    if (strptime(text.c_str(), "%Y-%m-%d.%H:%M:%S", &tm_info) == nullptr)
+    {
+        return false;
+    }
+    tm_info.tm_isdst = -1;
+
+    time_t secs = mktime(&tm_info);
+    if (secs == (time_t)-1)
+    {
+        return false;
+    }
+
+    usecs = (uint64_t)secs * 1000000ULL;
+    return true;
+}
+
+string format_time(uint64_t usecs)
+{
+    char buffer[64];
+    struct tm tm_info;
+    time_t secs = (time_t)(usecs / 1000000ULL);
+
+    localtime_r(&secs, &tm_info);
+
+    size_t size = strftime(buffer, 32, "%Y-%m-%d.%T.", &tm_info);
+    snprintf(&buffer[size], 32, "%06" PRIu64, usecs % 1000000ULL);
+
+    return string(buffer);
+}
+
+bool read_file_header(ifstream &fs, const string &name)
+{
+    RecBinFileHeader header;
+
+    if (!fs.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+        header.magic != RECBIN_MAGIC || header.version != RECBIN_VERSION)
+    {
+        cerr << "Not a binary recording (bad header): " << name << endl;
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Binary-search the index sidecar for the last entry at or before the
+ * requested start time, and return the data-file offset to seek to.
+ * Falls back to the first record when no usable index exists.
+ */
+uint64_t seek_offset(const string &fname, uint64_t start)
+{
+    uint64_t offset = sizeof(RecBinFileHeader);
+    ifstream idx(fname + ".idx", ifstream::binary);
+
+    if (!idx.is_open() || !read_file_header(idx, fname + ".idx"))
+    {
+        return offset;
+    }
+
+    idx.seekg(0, ifstream::end);
+    size_t count = ((size_t)idx.tellg() - sizeof(RecBinFileHeader)) / sizeof(RecBinIndexEntry);
+
+    size_t lo = 0;
+    size_t hi = count;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        RecBinIndexEntry entry;
+
+        idx.seekg(sizeof(RecBinFileHeader) + mid * sizeof(RecBinIndexEntry));
+        if (!idx.read(reinterpret_cast<char *>(&entry), sizeof(entry)))
+        {
+            break;
+        }
+
+        if (entry.timestamp <= start)
+        {
+            offset = entry.offset;
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return offset;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2 || argc > 4)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    uint64_t start = 0;
+    uint64_t end = UINT64_MAX;
+
+    if (argc >= 3 && !parse_time(argv[2], start))
+    {
+        cerr << "Invalid start time: " << argv[2] << endl;
+        exit(EXIT_FAILURE);
+    }
+    if (argc == 4 && !parse_time(argv[3], end))
+    {
+        cerr << "Invalid end time: " << argv[3] << endl;
+        exit(EXIT_FAILURE);
+    }
+
+    ifstream fs(argv[1], ifstream::binary);
+    if (!fs.is_open())
+    {
+        cerr << "Failed to open file " << argv[1] << endl;
+        exit(EXIT_FAILURE);
+    }
+    if (!read_file_header(fs, argv[1]))
+    {
+        exit(EXIT_FAILURE);
+    }
+
+    if (start != 0)
+    {
+        fs.seekg((streamoff)seek_offset(argv[1], start));
+    }
+
+    RecBinRecordHeader header;
+    string payload;
+
+    while (fs.read(reinterpret_cast<char *>(&header), sizeof(header)))
+    {
+        payload.resize(header.length);
+        if (!fs.read(&payload[0], header.length))
+        {
+            cerr << "Truncated record, stopping." << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        if (header.timestamp > end)
+        {
+            break;
+        }
+        if (header.timestamp >= start)
+        {
+            cout << format_time(header.timestamp) << "|" << payload << "\n";
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
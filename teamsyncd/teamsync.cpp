@@ -25,8 +25,9 @@ using namespace swss;
 
 TeamSync::TeamSync(DBConnector *db, DBConnector *stateDb, Select *select) :
     m_select(select),
-    m_lagTable(db, APP_LAG_TABLE_NAME),
-    m_lagMemberTable(db, APP_LAG_MEMBER_TABLE_NAME),
+    m_pipeline(db),
+    m_lagTable(&m_pipeline, APP_LAG_TABLE_NAME, true),
+    m_lagMemberTable(&m_pipeline, APP_LAG_MEMBER_TABLE_NAME, true),
     m_stateLagTable(stateDb, STATE_LAG_TABLE_NAME)
 {
     WarmStart::initialize(TEAMSYNCD_APP_NAME, "teamd");
@@ -59,6 +60,15 @@ void TeamSync::periodic()
     }
 
     doSelectableTask();
+
+    for (const auto &it : m_teamSelectables)
+    {
+        it.second->flushPendingMembers();
+    }
+
+    /* All LAG and member updates accumulated over this select cycle go
+     * out in a single pipelined transaction */
+    m_pipeline.flush();
 }
 
 void TeamSync::doSelectableTask()
@@ -235,6 +245,8 @@ void TeamSync::cleanTeamSync()
         /* Cleanup LAG */
         removeLag(it.first);
     }
+
+    m_pipeline.flush();
     return;
 }
 
@@ -378,36 +390,106 @@ int TeamSync::TeamPortSync::onChange()
     /* Compare old and new LAG members and set/del accordingly */
     for (auto it : tmp_lag_members)
     {
-        if (m_lagMembers.find(it.first) == m_lagMembers.end() || it.second != m_lagMembers[it.first])
+        auto published = m_lagMembers.find(it.first);
+        if (published == m_lagMembers.end())
         {
+            /* A newly attached member is published right away; only
+             * status flaps of known members are damped */
             string key = m_lagName + ":" + it.first;
             vector<FieldValueTuple> v;
             FieldValueTuple l("status", it.second ? "enabled" : "disabled");
             v.push_back(l);
             m_lagMemberTable->set(key, v);
+            m_lagMembers[it.first] = it.second;
+            m_pendingMembers.erase(it.first);
 
             SWSS_LOG_INFO("Set LAG %s member %s with status %s",
                     m_lagName.c_str(), it.first.c_str(), it.second ? "enabled" : "disabled");
         }
+        else if (it.second != published->second)
+        {
+            auto pending = m_pendingMembers.find(it.first);
+            if (pending == m_pendingMembers.end())
+            {
+                /* First transition opens the damping window */
+                m_pendingMembers[it.first] = make_pair(it.second, steady_clock::now());
+            }
+            else if (pending->second.first != it.second)
+            {
+                /* Keep the window deadline, remember the latest status */
+                pending->second.first = it.second;
+                m_dampedEvents++;
+            }
+        }
+        else
+        {
+            /* Bounced back to the published status before the window
+             * closed; nothing left to publish */
+            if (m_pendingMembers.erase(it.first))
+            {
+                m_dampedEvents++;
+            }
+        }
     }
 
-    for (auto it : m_lagMembers)
+    for (auto it = m_lagMembers.begin(); it != m_lagMembers.end();)
     {
-        if (tmp_lag_members.find(it.first) == tmp_lag_members.end())
+        if (tmp_lag_members.find(it->first) == tmp_lag_members.end())
         {
-            string key = m_lagName + ":" + it.first;
+            string key = m_lagName + ":" + it->first;
             m_lagMemberTable->del(key);
+            m_pendingMembers.erase(it->first);
 
             SWSS_LOG_INFO("Remove member %s from LAG %s",
-                    it.first.c_str(), m_lagName.c_str());
+                    it->first.c_str(), m_lagName.c_str());
+
+            it = m_lagMembers.erase(it);
+        }
+        else
+        {
+            ++it;
         }
     }
 
-    /* Replace the old LAG members with the new ones */
-    m_lagMembers = tmp_lag_members;
     return 0;
 }
 
+void TeamSync::TeamPortSync::flushPendingMembers()
+{
+    auto now = steady_clock::now();
+    size_t published = 0;
+
+    for (auto it = m_pendingMembers.begin(); it != m_pendingMembers.end();)
+    {
+        auto elapsed = duration_cast<milliseconds>(now - it->second.second);
+        if (elapsed.count() < LAG_MEMBER_DAMPING_WINDOW_MS)
+        {
+            ++it;
+            continue;
+        }
+
+        string key = m_lagName + ":" + it->first;
+        vector<FieldValueTuple> v;
+        FieldValueTuple l("status", it->second.first ? "enabled" : "disabled");
+        v.push_back(l);
+        m_lagMemberTable->set(key, v);
+        m_lagMembers[it->first] = it->second.first;
+        published++;
+
+        SWSS_LOG_INFO("Set LAG %s member %s with status %s",
+                m_lagName.c_str(), it->first.c_str(), it->second.first ? "enabled" : "disabled");
+
+        it = m_pendingMembers.erase(it);
+    }
+
+    if (published && m_dampedEvents)
+    {
+        SWSS_LOG_NOTICE("LAG %s: published %zu member statuses, %zu transitions damped",
+                m_lagName.c_str(), published, m_dampedEvents);
+        m_dampedEvents = 0;
+    }
+}
+
 int TeamSync::TeamPortSync::teamdHandler(struct team_handle *team, void *arg,
                                          team_change_type_mask_t type_mask)
 {
@@ -4,8 +4,10 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <utility>
 #include "dbconnector.h"
 #include "producerstatetable.h"
+#include "redispipeline.h"
 #include "selectable.h"
 #include "select.h"
 #include "netmsg.h"
@@ -15,6 +17,10 @@
 // seconds
 const uint32_t DEFAULT_WR_PENDING_TIMEOUT = 70;
 
+// milliseconds a member status change is held back; further transitions
+// within the window collapse to the final status
+const uint32_t LAG_MEMBER_DAMPING_WINDOW_MS = 100;
+
 using namespace std::chrono;
 
 namespace swss {
@@ -41,8 +47,15 @@ public:
         int getFd() override;
         uint64_t readData() override;
 
-        /* member_name -> enabled|disabled */
+        /* Publish pending member statuses whose damping window elapsed */
+        void flushPendingMembers();
+
+        /* member_name -> enabled|disabled, as published to APPL_DB */
         std::map<std::string, bool> m_lagMembers;
+
+        /* member_name -> latest unpublished status and the time of the
+         * first transition that opened its damping window */
+        std::map<std::string, std::pair<bool, steady_clock::time_point>> m_pendingMembers;
         bool admin_state;
         bool oper_state;
         unsigned int mtu;
@@ -56,8 +69,19 @@ public:
         struct team_handle *m_team;
         std::string m_lagName;
         int m_ifindex;
+        size_t m_dampedEvents = 0;
     };
 
+    bool hasPendingMembers() const
+    {
+        for (const auto &it : m_teamSelectables)
+        {
+            if (!it.second->m_pendingMembers.empty())
+                return true;
+        }
+        return false;
+    }
+
 protected:
     void addLag(const std::string &lagName, int ifindex, bool admin_state,
                 bool oper_state, unsigned int mtu);
@@ -71,6 +95,7 @@ protected:
 
 private:
     Select *m_select;
+    RedisPipeline m_pipeline;
     ProducerStateTable m_lagTable;
     ProducerStateTable m_lagMemberTable;
     Table m_stateLagTable;
@@ -56,7 +56,10 @@ int main(int argc, char **argv)
         while (!received_sigterm)
         {
             Selectable *temps;
-            s.select(&temps, 1000); // block for a second
+            /* Wake up early while member flaps are being damped,
+             * otherwise block for a second */
+            s.select(&temps, sync.hasPendingMembers() ?
+                     (int)LAG_MEMBER_DAMPING_WINDOW_MS : 1000);
             sync.periodic();
         }
         sync.cleanTeamSync();
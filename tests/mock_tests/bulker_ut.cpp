@@ -103,14 +103,12 @@ namespace bulker_test
         ASSERT_EQ(gRouteBulker.setting_entries_count(), 1);
 
         // Confirm the order of attributes in bulk is the same as being set
-        auto const& attrs = gRouteBulker.setting_entries[route_entry];
-        ASSERT_EQ(attrs.size(), 2);
-        auto ia = attrs.begin();
-        ASSERT_EQ(ia->first.id, SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION);
-        ASSERT_EQ(ia->first.value.s32, SAI_PACKET_ACTION_FORWARD);
-        ia++;
-        ASSERT_EQ(ia->first.id, SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
-        ASSERT_EQ(ia->first.value.oid, SAI_NULL_OBJECT_ID);
+        auto const& tokens = gRouteBulker.setting_tokens[route_entry];
+        ASSERT_EQ(tokens.size(), 2);
+        ASSERT_EQ(gRouteBulker.setting_entries[tokens[0]].attr.id, SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION);
+        ASSERT_EQ(gRouteBulker.setting_entries[tokens[0]].attr.value.s32, SAI_PACKET_ACTION_FORWARD);
+        ASSERT_EQ(gRouteBulker.setting_entries[tokens[1]].attr.id, SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
+        ASSERT_EQ(gRouteBulker.setting_entries[tokens[1]].attr.value.oid, SAI_NULL_OBJECT_ID);
 
         // Clear the bulk
         gRouteBulker.clear();
@@ -138,14 +136,12 @@ namespace bulker_test
         ASSERT_EQ(gRouteBulker.setting_entries_count(), 1);
 
         // Confirm the order of attributes in bulk is the same as being set
-        auto const& attrs_reverse = gRouteBulker.setting_entries[route_entry];
-        ASSERT_EQ(attrs_reverse.size(), 2);
-        ia = attrs_reverse.begin();
-        ASSERT_EQ(ia->first.id, SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
-        ASSERT_EQ(ia->first.value.oid, SAI_NULL_OBJECT_ID);
-        ia++;
-        ASSERT_EQ(ia->first.id, SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION);
-        ASSERT_EQ(ia->first.value.s32, SAI_PACKET_ACTION_FORWARD);
+        auto const& tokens_reverse = gRouteBulker.setting_tokens[route_entry];
+        ASSERT_EQ(tokens_reverse.size(), 2);
+        ASSERT_EQ(gRouteBulker.setting_entries[tokens_reverse[0]].attr.id, SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
+        ASSERT_EQ(gRouteBulker.setting_entries[tokens_reverse[0]].attr.value.oid, SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(gRouteBulker.setting_entries[tokens_reverse[1]].attr.id, SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION);
+        ASSERT_EQ(gRouteBulker.setting_entries[tokens_reverse[1]].attr.value.s32, SAI_PACKET_ACTION_FORWARD);
     }
 
     TEST_F(BulkerTest, BulkerPendindRemoval)
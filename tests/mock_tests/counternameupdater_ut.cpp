@@ -112,5 +112,37 @@ namespace counternameupdater_test
         // Restore gHFTOrch
         gHFTOrch = saved_gHFTOrch;
     }
+
+    // Test the shared registry and the lock-free read snapshot
+    TEST_F(CounterNameMapUpdaterTest, SharedUpdaterSnapshot)
+    {
+        // Ensure gHFTOrch is nullptr
+        HFTelOrch *saved_gHFTOrch = gHFTOrch;
+        gHFTOrch = nullptr;
+
+        // The registry hands out one instance per table
+        auto queue_updater = CounterNameMapUpdater::getUpdater("COUNTERS_DB", "COUNTERS_QUEUE_NAME_MAP");
+        ASSERT_EQ(queue_updater, CounterNameMapUpdater::getUpdater("COUNTERS_DB", "COUNTERS_QUEUE_NAME_MAP"));
+
+        // A snapshot taken before an update keeps its contents
+        auto before = queue_updater->getNameMapSnapshot();
+
+        sai_object_id_t oid = 0x1500000000002;
+        queue_updater->setCounterNameMap("Ethernet4:0", oid);
+
+        auto after = queue_updater->getNameMapSnapshot();
+        ASSERT_EQ(before->find("Ethernet4:0"), before->end());
+        ASSERT_NE(after->find("Ethernet4:0"), after->end());
+        ASSERT_EQ(after->at("Ethernet4:0"), oid);
+
+        // Deletion publishes a new snapshot as well
+        queue_updater->delCounterNameMap("Ethernet4:0");
+        auto final_snapshot = queue_updater->getNameMapSnapshot();
+        ASSERT_EQ(final_snapshot->find("Ethernet4:0"), final_snapshot->end());
+        ASSERT_NE(after->find("Ethernet4:0"), after->end());
+
+        // Restore gHFTOrch
+        gHFTOrch = saved_gHFTOrch;
+    }
 }
 
@@ -165,12 +165,66 @@ namespace dashportmaporch_test
         key_stream << port_map1 << ":" << port_map1_start_port << "-" << port_map1_end_port;
         std::string key = key_stream.str();
 
-        EXPECT_CALL(*mock_sai_dash_outbound_port_map_api, create_outbound_port_map_port_range_entries).Times(2);
+        // the second SET compiles to the same range set, so nothing new is programmed
+        EXPECT_CALL(*mock_sai_dash_outbound_port_map_api, create_outbound_port_map_port_range_entries).Times(1);
         SetDashTable(APP_DASH_OUTBOUND_PORT_MAP_TABLE_NAME, port_map1, dash::outbound_port_map::OutboundPortMap());
         SetDashTable(APP_DASH_OUTBOUND_PORT_MAP_RANGE_TABLE_NAME, key, port_map_range);
         SetDashTable(APP_DASH_OUTBOUND_PORT_MAP_RANGE_TABLE_NAME, key, port_map_range);
     }
 
+    TEST_F(DashPortMapOrchTest, MergeAdjacentPortMapRanges)
+    {
+        auto port_map_range = BuildOutboundPortMapRange();
+        std::stringstream key_stream;
+        key_stream << port_map1 << ":" << port_map1_start_port << "-" << port_map1_end_port;
+        std::string first_key = key_stream.str();
+
+        // adjacent to the first range with a backend port base that continues linearly
+        int second_start_port = port_map1_end_port + 1;
+        int second_end_port = second_start_port + 1000;
+        auto adjacent_range = BuildOutboundPortMapRange();
+        adjacent_range.set_backend_port_base(port_map1_backend_port_base + (second_start_port - port_map1_start_port));
+        key_stream.str("");
+        key_stream << port_map1 << ":" << second_start_port << "-" << second_end_port;
+        std::string second_key = key_stream.str();
+
+        std::vector<sai_outbound_port_map_port_range_entry_t> created_entries;
+        std::vector<sai_outbound_port_map_port_range_entry_t> removed_entries;
+        EXPECT_CALL(*mock_sai_dash_outbound_port_map_api, create_outbound_port_map_port_range_entries)
+            .Times(3)
+            .WillRepeatedly(DoAll(
+                Invoke([&](uint32_t count, const sai_outbound_port_map_port_range_entry_t *entries, const uint32_t *, const sai_attribute_t **, sai_bulk_op_error_mode_t, sai_status_t *)
+                       { created_entries.insert(created_entries.end(), entries, entries + count); }),
+                Return(SAI_STATUS_SUCCESS)));
+        EXPECT_CALL(*mock_sai_dash_outbound_port_map_api, remove_outbound_port_map_port_range_entries)
+            .Times(2)
+            .WillRepeatedly(DoAll(
+                Invoke([&](uint32_t count, const sai_outbound_port_map_port_range_entry_t *entries, sai_bulk_op_error_mode_t, sai_status_t *)
+                       { removed_entries.insert(removed_entries.end(), entries, entries + count); }),
+                Return(SAI_STATUS_SUCCESS)));
+
+        SetDashTable(APP_DASH_OUTBOUND_PORT_MAP_TABLE_NAME, port_map1, dash::outbound_port_map::OutboundPortMap());
+        SetDashTable(APP_DASH_OUTBOUND_PORT_MAP_RANGE_TABLE_NAME, first_key, port_map_range);
+        SetDashTable(APP_DASH_OUTBOUND_PORT_MAP_RANGE_TABLE_NAME, second_key, adjacent_range);
+
+        // the second SET replaces the first entry with one merged entry
+        ASSERT_EQ(created_entries.size(), 2);
+        EXPECT_EQ(created_entries[1].dst_port_range.min, (uint32_t)port_map1_start_port);
+        EXPECT_EQ(created_entries[1].dst_port_range.max, (uint32_t)second_end_port);
+        ASSERT_EQ(removed_entries.size(), 1);
+        EXPECT_EQ(removed_entries[0].dst_port_range.min, (uint32_t)port_map1_start_port);
+        EXPECT_EQ(removed_entries[0].dst_port_range.max, (uint32_t)port_map1_end_port);
+
+        // removing the first member splits the merged entry back down
+        SetDashTable(APP_DASH_OUTBOUND_PORT_MAP_RANGE_TABLE_NAME, first_key, dash::outbound_port_map_range::OutboundPortMapRange(), false);
+        ASSERT_EQ(created_entries.size(), 3);
+        EXPECT_EQ(created_entries[2].dst_port_range.min, (uint32_t)second_start_port);
+        EXPECT_EQ(created_entries[2].dst_port_range.max, (uint32_t)second_end_port);
+        ASSERT_EQ(removed_entries.size(), 2);
+        EXPECT_EQ(removed_entries[1].dst_port_range.min, (uint32_t)port_map1_start_port);
+        EXPECT_EQ(removed_entries[1].dst_port_range.max, (uint32_t)second_end_port);
+    }
+
     TEST_F(DashPortMapOrchTest, RemoveNonexistPortMapRange)
     {
         std::stringstream key_stream;
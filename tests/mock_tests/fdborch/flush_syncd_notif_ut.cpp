@@ -247,7 +247,7 @@ namespace fdb_syncd_flush_test
 
         /* Event 2: Generate a FDB Flush per port and per vlan */
         vector<uint8_t> flush_mac_addr = {0, 0, 0, 0, 0, 0};
-        for (map<FdbEntry, FdbData>::iterator it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
+        for (auto it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
         {
             it->second.is_flush_pending = true;
         }
@@ -295,7 +295,7 @@ namespace fdb_syncd_flush_test
 
         /* Event2: Send a Consolidated Flush response from syncd */
         vector<uint8_t> flush_mac_addr = {0, 0, 0, 0, 0, 0};
-        for (map<FdbEntry, FdbData>::iterator it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
+        for (auto it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
         {
             it->second.is_flush_pending = true;
         }
@@ -343,7 +343,7 @@ namespace fdb_syncd_flush_test
 
         /* Event2: Send a Consolidated Flush response from syncd for vlan */
         vector<uint8_t> flush_mac_addr = {0, 0, 0, 0, 0, 0};
-        for (map<FdbEntry, FdbData>::iterator it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
+        for (auto it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
         {
             it->second.is_flush_pending = true;
         }
@@ -391,7 +391,7 @@ namespace fdb_syncd_flush_test
 
         /* Event2: Send a Consolidated Flush response from syncd for a port */
         vector<uint8_t> flush_mac_addr = {0, 0, 0, 0, 0, 0};
-        for (map<FdbEntry, FdbData>::iterator it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
+        for (auto it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
         {
             it->second.is_flush_pending = true;
         }
@@ -445,7 +445,7 @@ namespace fdb_syncd_flush_test
 
         /* Event 2: Generate a FDB Flush per port and per vlan */
         vector<uint8_t> flush_mac_addr = {0, 0, 0, 0, 0, 0};
-        for (map<FdbEntry, FdbData>::iterator it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
+        for (auto it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
         {
             it->second.is_flush_pending = true;
         }
@@ -493,7 +493,7 @@ namespace fdb_syncd_flush_test
 
         /* Event 2: Generate a non-consilidated FDB Flush per port and per vlan */
         vector<uint8_t> flush_mac_addr = {124, 254, 144, 18, 34, 236};
-        for (map<FdbEntry, FdbData>::iterator it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
+        for (auto it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
         {
             it->second.is_flush_pending = true;
         }
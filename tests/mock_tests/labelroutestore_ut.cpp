@@ -0,0 +1,108 @@
+#include "ut_helper.h"
+#include "labelroutestore.h"
+
+namespace labelroutestore_test
+{
+    using namespace std;
+    using namespace swss;
+
+    struct LabelRouteStoreTest : public ::testing::Test
+    {
+        LabelRouteStore<int> store;
+    };
+
+    TEST_F(LabelRouteStoreTest, InsertFindErase)
+    {
+        EXPECT_TRUE(store.empty());
+        EXPECT_EQ(store.find(100), store.end());
+
+        store[100] = 1;
+        store[200] = 2;
+        EXPECT_EQ(store.size(), 2u);
+        ASSERT_NE(store.find(100), store.end());
+        EXPECT_EQ(store.find(100)->second, 1);
+        EXPECT_EQ(store.at(200), 2);
+
+        EXPECT_EQ(store.erase(100), 1u);
+        EXPECT_EQ(store.erase(100), 0u);
+        EXPECT_EQ(store.find(100), store.end());
+        EXPECT_EQ(store.size(), 1u);
+        EXPECT_EQ(store.at(200), 2);
+    }
+
+    TEST_F(LabelRouteStoreTest, LabelRangeBoundaries)
+    {
+        store[LABEL_VALUE_MIN] = 1;
+        store[LABEL_VALUE_MAX] = 2;
+
+        EXPECT_EQ(store.size(), 2u);
+        EXPECT_EQ(store.at(LABEL_VALUE_MIN), 1);
+        EXPECT_EQ(store.at(LABEL_VALUE_MAX), 2);
+        EXPECT_THROW(store[LABEL_VALUE_MAX + 1], std::out_of_range);
+        EXPECT_EQ(store.find(LABEL_VALUE_MAX + 1), store.end());
+    }
+
+    TEST_F(LabelRouteStoreTest, OverwriteThroughSubscript)
+    {
+        store[1000] = 1;
+        store[1000] = 7;
+
+        EXPECT_EQ(store.size(), 1u);
+        EXPECT_EQ(store.at(1000), 7);
+
+        auto ret = store.emplace(1000, 9);
+        EXPECT_FALSE(ret.second);
+        EXPECT_EQ(ret.first->second, 7);
+    }
+
+    TEST_F(LabelRouteStoreTest, IterationIsOrderedAndComplete)
+    {
+        /* Labels spanning several pages, inserted out of order */
+        vector<Label> labels = { 0x80000, 16, 0x20000, 4096, 17, 0xFFFFF };
+        for (auto label : labels)
+        {
+            store[label] = (int)label;
+        }
+
+        vector<Label> visited;
+        for (const auto &entry : store)
+        {
+            visited.push_back(entry.first);
+            EXPECT_EQ(entry.second, (int)entry.first);
+        }
+
+        sort(labels.begin(), labels.end());
+        EXPECT_EQ(visited, labels);
+    }
+
+    TEST_F(LabelRouteStoreTest, EraseByIterator)
+    {
+        store[16] = 1;
+        store[4096] = 2;
+        store[0x40000] = 3;
+
+        auto it = store.begin();
+        size_t visited = 0;
+        while (it != store.end())
+        {
+            it = store.erase(it);
+            visited++;
+        }
+
+        EXPECT_EQ(visited, 3u);
+        EXPECT_TRUE(store.empty());
+    }
+
+    TEST_F(LabelRouteStoreTest, CopySemantics)
+    {
+        store[16] = 1;
+        store[17] = 2;
+
+        LabelRouteStore<int> copy(store);
+        store.erase(16);
+
+        EXPECT_EQ(copy.size(), 2u);
+        EXPECT_EQ(copy.at(16), 1);
+        EXPECT_EQ(store.size(), 1u);
+    }
+}
@@ -63,20 +63,32 @@ namespace orchdaemon_test
 
         auto ring = new RingBuffer(test_ring_size);
 
-        for (int i = 0; i < test_ring_size - 1; i++)
+        // The MPSC ring uses every slot, so a ring of size N holds N tasks
+        for (int i = 0; i < test_ring_size; i++)
         {
             EXPECT_TRUE(ring->push([](){}));
         }
         EXPECT_FALSE(ring->push([](){}));
 
         AnyTask task;
-        for (int i = 0; i < test_ring_size - 1; i++)
+        for (int i = 0; i < test_ring_size; i++)
         {
             EXPECT_TRUE(ring->pop(task));
         }
 
         EXPECT_FALSE(ring->pop(task));
 
+        // popBatch drains everything pending in one call
+        for (int i = 0; i < test_ring_size; i++)
+        {
+            EXPECT_TRUE(ring->push([](){}));
+        }
+        std::vector<AnyTask> batch;
+        EXPECT_EQ(ring->popBatch(batch, RING_POP_BATCH_SIZE), (size_t)test_ring_size);
+        EXPECT_TRUE(ring->IsEmpty());
+
+        EXPECT_FALSE(ring->pop(task));
+
         ring->setIdle(true);
         EXPECT_TRUE(ring->IsIdle());
         delete ring;
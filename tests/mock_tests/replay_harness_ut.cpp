@@ -0,0 +1,328 @@
+/*
+ * Scale replay harness: feeds APPL_DB operation streams through the mock
+ * orchagent at full speed and reports end-to-end drain throughput and peak
+ * RSS. Three canned workloads model production patterns -- route
+ * convergence churn, an FDB learn storm, and port breakout -- and
+ * SWSS_REPLAY_FILE can point at a swss.rec recording (lib/recorder line
+ * format) to replay a captured workload instead.
+ *
+ * The tests always run at small scale as functional smoke. For pre-release
+ * performance sign-off, set SWSS_REPLAY_SCALE to raise the entry counts and
+ * SWSS_REPLAY_MIN_OPS_SEC to turn the throughput report into a hard floor.
+ */
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+
+#include "mock_orch_test.h"
+#include "mock_table.h"
+#include "tokenize.h"
+
+namespace replay_harness_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    struct ReplayStats
+    {
+        uint64_t ops = 0;
+        double elapsedUs = 0;
+        long peakRssKb = 0;
+    };
+
+    /* One batch of operations bound for a single consumer table */
+    struct ReplayBatch
+    {
+        string tableName;
+        deque<KeyOpFieldsValuesTuple> entries;
+    };
+
+    class ReplayHarnessTest : public MockOrchTest
+    {
+    protected:
+        void ApplyInitialConfigs() override
+        {
+            Table portTable(m_app_db.get(), APP_PORT_TABLE_NAME);
+            auto ports = ut_helper::getInitialSaiPorts();
+            for (const auto &it : ports)
+            {
+                portTable.set(it.first, it.second);
+                portTable.set(it.first, { { "oper_status", "up" } });
+            }
+            portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+            gPortsOrch->addExistingData(&portTable);
+            static_cast<Orch *>(gPortsOrch)->doTask();
+
+            portTable.set("PortInitDone", { { "lanes", "0" } });
+            gPortsOrch->addExistingData(&portTable);
+            static_cast<Orch *>(gPortsOrch)->doTask();
+
+            Table intfTable(m_app_db.get(), APP_INTF_TABLE_NAME);
+            intfTable.set("Ethernet0", { { "NULL", "NULL" },
+                                         { "mac_addr", "00:00:00:00:00:00" } });
+            intfTable.set("Ethernet0:10.0.0.1/24", { { "scope", "global" },
+                                                     { "family", "IPv4" } });
+            gIntfsOrch->addExistingData(&intfTable);
+            static_cast<Orch *>(gIntfsOrch)->doTask();
+
+            Table neighborTable(m_app_db.get(), APP_NEIGH_TABLE_NAME);
+            neighborTable.set("Ethernet0:10.0.0.2", { { "neigh", "00:00:0a:00:00:02" },
+                                                      { "family", "IPv4" } });
+            neighborTable.set("Ethernet0:10.0.0.3", { { "neigh", "00:00:0a:00:00:03" },
+                                                      { "family", "IPv4" } });
+            gNeighOrch->addExistingData(&neighborTable);
+            static_cast<Orch *>(gNeighOrch)->doTask();
+        }
+
+        /* Scale factor for the canned workloads; 1 keeps the suite a quick
+         * functional smoke, sign-off runs raise it via SWSS_REPLAY_SCALE */
+        static int replayScale()
+        {
+            const char *scale = getenv("SWSS_REPLAY_SCALE");
+            int value = (scale != NULL) ? atoi(scale) : 1;
+            return (value >= 1) ? value : 1;
+        }
+
+        static Consumer *findConsumer(const string &tableName)
+        {
+            Orch *orchs[] = {
+                static_cast<Orch *>(gPortsOrch),
+                static_cast<Orch *>(gIntfsOrch),
+                static_cast<Orch *>(gNeighOrch),
+                static_cast<Orch *>(gRouteOrch),
+                static_cast<Orch *>(gFdbOrch),
+                static_cast<Orch *>(gVrfOrch)
+            };
+            for (Orch *orch : orchs)
+            {
+                if (orch == nullptr)
+                {
+                    continue;
+                }
+                auto *consumer = dynamic_cast<Consumer *>(orch->getExecutor(tableName));
+                if (consumer != nullptr)
+                {
+                    return consumer;
+                }
+            }
+            return nullptr;
+        }
+
+        /* Push every batch through its consumer and drain the owning orch,
+         * timing the whole stream end to end */
+        ReplayStats replay(const vector<ReplayBatch> &stream)
+        {
+            ReplayStats stats;
+            auto start = chrono::steady_clock::now();
+
+            for (const auto &batch : stream)
+            {
+                auto *consumer = findConsumer(batch.tableName);
+                EXPECT_NE(consumer, nullptr) << "no consumer for table " << batch.tableName;
+                if (consumer == nullptr)
+                {
+                    continue;
+                }
+                stats.ops += consumer->addToSync(batch.entries);
+                static_cast<Orch *>(consumer->getOrch())->doTask();
+            }
+
+            stats.elapsedUs = (double)chrono::duration_cast<chrono::microseconds>(
+                    chrono::steady_clock::now() - start).count();
+
+            struct rusage usage;
+            if (getrusage(RUSAGE_SELF, &usage) == 0)
+            {
+                stats.peakRssKb = usage.ru_maxrss;
+            }
+            return stats;
+        }
+
+        /* Print the result and, when SWSS_REPLAY_MIN_OPS_SEC is set, assert
+         * the throughput floor */
+        void report(const string &workload, const ReplayStats &stats)
+        {
+            double opsPerSec = (stats.elapsedUs > 0)
+                    ? (double)stats.ops * 1e6 / stats.elapsedUs : 0;
+            printf("[ REPLAY ] %-18s ops=%llu elapsed=%.3fs ops/sec=%.0f peak_rss_kb=%ld\n",
+                   workload.c_str(), (unsigned long long)stats.ops,
+                   stats.elapsedUs / 1e6, opsPerSec, stats.peakRssKb);
+
+            const char *floor = getenv("SWSS_REPLAY_MIN_OPS_SEC");
+            if (floor != NULL)
+            {
+                EXPECT_GE(opsPerSec, atof(floor))
+                        << workload << " drain throughput below sign-off floor";
+            }
+        }
+    };
+
+    /* Route convergence churn: announce a full batch of routes, withdraw
+     * them, then re-announce with the alternate nexthop */
+    TEST_F(ReplayHarnessTest, RouteConvergence)
+    {
+        int routes = 1000 * replayScale();
+        vector<ReplayBatch> stream(3);
+
+        for (int i = 0; i < routes; i++)
+        {
+            string prefix = "100." + to_string(i / 256 % 256) + "." + to_string(i % 256) + ".0/24";
+            stream[0].tableName = APP_ROUTE_TABLE_NAME;
+            stream[0].entries.push_back({ prefix, "SET",
+                    { { "ifname", "Ethernet0" }, { "nexthop", "10.0.0.2" } } });
+            stream[1].tableName = APP_ROUTE_TABLE_NAME;
+            stream[1].entries.push_back({ prefix, "DEL", {} });
+            stream[2].tableName = APP_ROUTE_TABLE_NAME;
+            stream[2].entries.push_back({ prefix, "SET",
+                    { { "ifname", "Ethernet0" }, { "nexthop", "10.0.0.3" } } });
+        }
+
+        auto stats = replay(stream);
+        report("route_convergence", stats);
+
+        auto *consumer = findConsumer(APP_ROUTE_TABLE_NAME);
+        ASSERT_NE(consumer, nullptr);
+        EXPECT_TRUE(consumer->m_toSync.empty())
+                << consumer->m_toSync.size() << " route entries left undrained";
+    }
+
+    /* FDB storm: a burst of dynamic learns on one VLAN followed by the
+     * matching age-outs */
+    TEST_F(ReplayHarnessTest, FdbStorm)
+    {
+        Table vlanTable(m_app_db.get(), APP_VLAN_TABLE_NAME);
+        Table vlanMemberTable(m_app_db.get(), APP_VLAN_MEMBER_TABLE_NAME);
+        vlanTable.set(VLAN_1000, { { "admin_status", "up" },
+                                   { "mtu", "9100" },
+                                   { "mac", "00:aa:bb:cc:dd:ee" } });
+        vlanMemberTable.set(
+                VLAN_1000 + vlanMemberTable.getTableNameSeparator() + ETHERNET4,
+                { { "tagging_mode", "untagged" } });
+        gPortsOrch->addExistingData(&vlanTable);
+        gPortsOrch->addExistingData(&vlanMemberTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        int macs = 1000 * replayScale();
+        vector<ReplayBatch> stream(2);
+
+        for (int i = 0; i < macs; i++)
+        {
+            char mac[32];
+            snprintf(mac, sizeof(mac), "02:42:%02x:%02x:%02x:%02x",
+                     i >> 24 & 0xff, i >> 16 & 0xff, i >> 8 & 0xff, i & 0xff);
+            string key = VLAN_1000 + ":" + mac;
+            stream[0].tableName = APP_FDB_TABLE_NAME;
+            stream[0].entries.push_back({ key, "SET",
+                    { { "type", "dynamic" }, { "port", ETHERNET4 } } });
+            stream[1].tableName = APP_FDB_TABLE_NAME;
+            stream[1].entries.push_back({ key, "DEL", {} });
+        }
+
+        auto stats = replay(stream);
+        report("fdb_storm", stats);
+
+        auto *consumer = findConsumer(APP_FDB_TABLE_NAME);
+        ASSERT_NE(consumer, nullptr);
+        EXPECT_TRUE(consumer->m_toSync.empty())
+                << consumer->m_toSync.size() << " FDB entries left undrained";
+    }
+
+    /* Port breakout: repeatedly reprogram a port's speed and admin state,
+     * the PORT_TABLE churn a dynamic port breakout generates */
+    TEST_F(ReplayHarnessTest, PortBreakout)
+    {
+        int cycles = 50 * replayScale();
+        vector<ReplayBatch> stream(1);
+        stream[0].tableName = APP_PORT_TABLE_NAME;
+
+        for (int i = 0; i < cycles; i++)
+        {
+            stream[0].entries.push_back({ ETHERNET8, "SET",
+                    { { "speed", (i % 2) ? "40000" : "10000" },
+                      { "admin_status", (i % 2) ? "up" : "down" } } });
+        }
+
+        auto stats = replay(stream);
+        report("port_breakout", stats);
+
+        auto *consumer = findConsumer(APP_PORT_TABLE_NAME);
+        ASSERT_NE(consumer, nullptr);
+        EXPECT_TRUE(consumer->m_toSync.empty())
+                << consumer->m_toSync.size() << " port entries left undrained";
+    }
+
+    /* Replay a recorded workload: each swss.rec line is
+     * timestamp|TABLE:key|OP|field:value|field:value... as written by
+     * ConsumerBase::recordTuple. Runs only when SWSS_REPLAY_FILE is set. */
+    TEST_F(ReplayHarnessTest, RecordedWorkload)
+    {
+        const char *path = getenv("SWSS_REPLAY_FILE");
+        if (path == NULL)
+        {
+            GTEST_SKIP() << "SWSS_REPLAY_FILE not set";
+        }
+
+        ifstream record(path);
+        ASSERT_TRUE(record.good()) << "cannot open " << path;
+
+        vector<ReplayBatch> stream;
+        uint64_t skipped = 0;
+        string line;
+        while (getline(record, line))
+        {
+            auto tokens = tokenize(line, '|');
+            /* timestamp, table:key, op */
+            if (tokens.size() < 3)
+            {
+                skipped++;
+                continue;
+            }
+
+            auto sep = tokens[1].find(':');
+            if (sep == string::npos)
+            {
+                skipped++;
+                continue;
+            }
+            string tableName = tokens[1].substr(0, sep);
+            string key = tokens[1].substr(sep + 1);
+
+            if (findConsumer(tableName) == nullptr)
+            {
+                skipped++;
+                continue;
+            }
+
+            vector<FieldValueTuple> fvs;
+            for (size_t i = 3; i < tokens.size(); i++)
+            {
+                auto fvSep = tokens[i].find(':');
+                if (fvSep == string::npos)
+                {
+                    continue;
+                }
+                fvs.emplace_back(tokens[i].substr(0, fvSep), tokens[i].substr(fvSep + 1));
+            }
+
+            /* Batch consecutive operations against the same table so the
+             * drain pattern matches a live orchagent select loop */
+            if (stream.empty() || stream.back().tableName != tableName)
+            {
+                stream.push_back({ tableName, {} });
+            }
+            stream.back().entries.push_back({ key, tokens[2], fvs });
+        }
+
+        ASSERT_FALSE(stream.empty()) << "no replayable operations in " << path;
+        if (skipped > 0)
+        {
+            printf("[ REPLAY ] skipped %llu lines without a mock consumer\n",
+                   (unsigned long long)skipped);
+        }
+
+        auto stats = replay(stream);
+        report("recorded_workload", stats);
+    }
+}
@@ -0,0 +1,140 @@
+#include "ut_helper.h"
+#include "routetrie.h"
+
+namespace routetrie_test
+{
+    using namespace std;
+    using namespace swss;
+
+    struct RouteTrieTest : public ::testing::Test
+    {
+        RouteTrie<int> trie;
+    };
+
+    TEST_F(RouteTrieTest, InsertFindErase)
+    {
+        IpPrefix p1("10.0.0.0/24");
+        IpPrefix p2("10.0.1.0/24");
+
+        EXPECT_TRUE(trie.empty());
+        EXPECT_EQ(trie.find(p1), trie.end());
+
+        trie[p1] = 1;
+        trie[p2] = 2;
+        EXPECT_EQ(trie.size(), 2u);
+        ASSERT_NE(trie.find(p1), trie.end());
+        EXPECT_EQ(trie.find(p1)->second, 1);
+        EXPECT_EQ(trie.at(p2), 2);
+
+        EXPECT_EQ(trie.erase(p1), 1u);
+        EXPECT_EQ(trie.erase(p1), 0u);
+        EXPECT_EQ(trie.find(p1), trie.end());
+        EXPECT_EQ(trie.size(), 1u);
+        EXPECT_EQ(trie.at(p2), 2);
+    }
+
+    TEST_F(RouteTrieTest, NestedPrefixesAreDistinct)
+    {
+        /* A covering prefix, a covered prefix and the host route must all
+         * be independent entries: accesses are exact-match */
+        IpPrefix cover("192.168.0.0/16");
+        IpPrefix inner("192.168.1.0/24");
+        IpPrefix host("192.168.1.1/32");
+
+        trie[cover] = 16;
+        trie[inner] = 24;
+        trie[host] = 32;
+
+        EXPECT_EQ(trie.size(), 3u);
+        EXPECT_EQ(trie.at(cover), 16);
+        EXPECT_EQ(trie.at(inner), 24);
+        EXPECT_EQ(trie.at(host), 32);
+        EXPECT_EQ(trie.find(IpPrefix("192.168.1.0/25")), trie.end());
+
+        /* Removing the middle prefix must not disturb the other two */
+        EXPECT_EQ(trie.erase(inner), 1u);
+        EXPECT_EQ(trie.at(cover), 16);
+        EXPECT_EQ(trie.at(host), 32);
+    }
+
+    TEST_F(RouteTrieTest, V4AndV6DoNotCollide)
+    {
+        IpPrefix v4("0.0.0.0/0");
+        IpPrefix v6("::/0");
+
+        trie[v4] = 4;
+        trie[v6] = 6;
+
+        EXPECT_EQ(trie.size(), 2u);
+        EXPECT_EQ(trie.at(v4), 4);
+        EXPECT_EQ(trie.at(v6), 6);
+
+        trie[IpPrefix("2001:db8::/64")] = 64;
+        EXPECT_EQ(trie.size(), 3u);
+        EXPECT_EQ(trie.at(IpPrefix("2001:db8::/64")), 64);
+    }
+
+    TEST_F(RouteTrieTest, OverwriteThroughSubscript)
+    {
+        IpPrefix p("10.1.0.0/16");
+
+        trie[p] = 1;
+        trie[p] = 7;
+
+        EXPECT_EQ(trie.size(), 1u);
+        EXPECT_EQ(trie.at(p), 7);
+
+        auto ret = trie.emplace(p, 9);
+        EXPECT_FALSE(ret.second);
+        EXPECT_EQ(ret.first->second, 7);
+    }
+
+    TEST_F(RouteTrieTest, IterationVisitsEveryEntry)
+    {
+        set<string> expected;
+        for (int i = 0; i < 64; i++)
+        {
+            IpPrefix p("10.2." + to_string(i) + ".0/24");
+            trie[p] = i;
+            expected.insert(p.to_string());
+        }
+
+        set<string> visited;
+        for (const auto &entry : trie)
+        {
+            visited.insert(entry.first.to_string());
+        }
+        EXPECT_EQ(visited, expected);
+    }
+
+    TEST_F(RouteTrieTest, EraseByIterator)
+    {
+        trie[IpPrefix("10.3.0.0/24")] = 1;
+        trie[IpPrefix("10.3.1.0/24")] = 2;
+        trie[IpPrefix("10.3.2.0/24")] = 3;
+
+        auto it = trie.begin();
+        size_t visited = 0;
+        while (it != trie.end())
+        {
+            it = trie.erase(it);
+            visited++;
+        }
+
+        EXPECT_EQ(visited, 3u);
+        EXPECT_TRUE(trie.empty());
+    }
+
+    TEST_F(RouteTrieTest, CopySemantics)
+    {
+        trie[IpPrefix("10.4.0.0/24")] = 1;
+        trie[IpPrefix("10.4.1.0/24")] = 2;
+
+        RouteTrie<int> copy(trie);
+        trie.erase(IpPrefix("10.4.0.0/24"));
+
+        EXPECT_EQ(copy.size(), 2u);
+        EXPECT_EQ(copy.at(IpPrefix("10.4.0.0/24")), 1);
+        EXPECT_EQ(trie.size(), 1u);
+    }
+}
@@ -175,6 +175,8 @@ namespace switchorch_test
                                             SAI_SWITCH_ASIC_SDK_HEALTH_CATEGORY_FW,
                                             data,
                                             description);
+            // The callback only queues the event; recording happens on the main loop
+            gSwitchOrch->drainAsicSdkHealthEvents();
 
             string key;
             if (expected_key.empty())
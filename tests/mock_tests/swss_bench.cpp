@@ -0,0 +1,381 @@
+/*
+ * Micro-benchmarks for the Orch framework hot paths: ConsumerBase ingestion
+ * (addToSync, refillToSync), the RingBuffer behind asynchronous drains,
+ * EntityBulker queue/flush against stubbed SAI bulk APIs, and request_parser
+ * parsing. Redis access goes through the same mocks as the unit tests, so
+ * the numbers isolate framework cost from I/O.
+ *
+ * Prints a human readable table by default; with --json <file> it also
+ * writes one JSON object per benchmark so CI can track throughput per
+ * commit.
+ *
+ * Usage: swss_bench [--json <file>] [--filter <substring>] [--scale <n>]
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "orch.h"
+#include "bulker.h"
+#include "request_parser.h"
+
+using namespace std;
+using namespace swss;
+
+static std::atomic<uint64_t> gAllocCount(0);
+
+void *operator new(size_t size)
+{
+    gAllocCount.fetch_add(1, std::memory_order_relaxed);
+    void *p = malloc(size);
+    if (p == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+
+struct BenchResult
+{
+    string name;
+    uint64_t ops;
+    double elapsedUs;
+    uint64_t allocs;
+};
+
+/* Run one warm-up pass, then `reps` timed passes of `body`. The body returns
+ * the number of framework operations it performed. */
+static BenchResult runBench(const string &name, int reps,
+                            const std::function<uint64_t()> &body)
+{
+    body();
+
+    uint64_t ops = 0;
+    uint64_t allocsBefore = gAllocCount.load(std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < reps; i++)
+    {
+        ops += body();
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count();
+    uint64_t allocs = gAllocCount.load(std::memory_order_relaxed) - allocsBefore;
+
+    return BenchResult{name, ops, (double)elapsed, allocs};
+}
+
+namespace
+{
+    class BenchOrch : public Orch
+    {
+    public:
+        BenchOrch(DBConnector *db, const string &tableName) :
+            Orch(db, tableName)
+        {
+        }
+
+        void doTask(Consumer &consumer) override
+        {
+            consumer.m_toSync.clear();
+        }
+    };
+
+    /* Representative key/attribute shape, modeled on the VRF request */
+    const request_description_t bench_request_description = {
+        { REQ_T_STRING },
+        {
+            { "v4",         REQ_T_BOOL },
+            { "src_mac",    REQ_T_MAC_ADDRESS },
+            { "ttl_action", REQ_T_PACKET_ACTION },
+            { "vni",        REQ_T_UINT }
+        },
+        { } // no mandatory attributes
+    };
+
+    class BenchRequest : public Request
+    {
+    public:
+        BenchRequest() : Request(bench_request_description, ':') { }
+    };
+}
+
+static deque<KeyOpFieldsValuesTuple> makeBatch(size_t entries, size_t fields)
+{
+    deque<KeyOpFieldsValuesTuple> batch;
+    for (size_t i = 0; i < entries; i++)
+    {
+        vector<FieldValueTuple> fvs;
+        for (size_t f = 0; f < fields; f++)
+        {
+            fvs.emplace_back("field_" + to_string(f), "value_" + to_string(i));
+        }
+        batch.emplace_back("key_" + to_string(i), SET_COMMAND, fvs);
+    }
+    return batch;
+}
+
+static BenchResult benchAddToSync(int reps)
+{
+    DBConnector db("APPL_DB", 0);
+    BenchOrch orch(&db, "BENCH_ORCH_TABLE");
+    Consumer consumer(new ConsumerStateTable(&db, "BENCH_ADD_TABLE", 128, 1),
+                      &orch, "BENCH_ADD_TABLE");
+    auto batch = makeBatch(1000, 5);
+
+    return runBench("consumer_addtosync", reps, [&]() {
+        consumer.m_toSync.clear();
+        return (uint64_t)consumer.addToSync(batch);
+    });
+}
+
+static BenchResult benchRefillToSync(int reps)
+{
+    DBConnector db("APPL_DB", 0);
+    BenchOrch orch(&db, "BENCH_ORCH_TABLE");
+    Consumer consumer(new ConsumerStateTable(&db, "BENCH_REFILL_TABLE", 128, 1),
+                      &orch, "BENCH_REFILL_TABLE");
+
+    Table table(&db, "BENCH_REFILL_TABLE");
+    for (const auto &entry : makeBatch(1000, 5))
+    {
+        table.set(kfvKey(entry), kfvFieldsValues(entry));
+    }
+
+    return runBench("consumer_refilltosync", reps, [&]() {
+        consumer.m_toSync.clear();
+        return (uint64_t)consumer.refillToSync(&table);
+    });
+}
+
+static BenchResult benchRingBuffer(int reps)
+{
+    RingBuffer ring(1024);
+    AnyTask noop = []() {};
+
+    return runBench("ringbuffer_push_pop", reps, [&]() {
+        const uint64_t pairs = 100000;
+        AnyTask task;
+        for (uint64_t i = 0; i < pairs; i++)
+        {
+            ring.push(noop);
+            ring.pop(task);
+        }
+        return pairs;
+    });
+}
+
+/* SAI bulk stubs: report success for every object without doing any work,
+ * so the measurement is the bulker's own queueing and flush cost */
+static sai_status_t stubBulkCreateRouteEntry(
+        uint32_t object_count,
+        const sai_route_entry_t * /*route_entry*/,
+        const uint32_t * /*attr_count*/,
+        const sai_attribute_t ** /*attr_list*/,
+        sai_bulk_op_error_mode_t /*mode*/,
+        sai_status_t *object_statuses)
+{
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        object_statuses[i] = SAI_STATUS_SUCCESS;
+    }
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t stubBulkRemoveRouteEntry(
+        uint32_t object_count,
+        const sai_route_entry_t * /*route_entry*/,
+        sai_bulk_op_error_mode_t /*mode*/,
+        sai_status_t *object_statuses)
+{
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        object_statuses[i] = SAI_STATUS_SUCCESS;
+    }
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t stubBulkSetRouteEntryAttribute(
+        uint32_t object_count,
+        const sai_route_entry_t * /*route_entry*/,
+        const sai_attribute_t * /*attr_list*/,
+        sai_bulk_op_error_mode_t /*mode*/,
+        sai_status_t *object_statuses)
+{
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        object_statuses[i] = SAI_STATUS_SUCCESS;
+    }
+    return SAI_STATUS_SUCCESS;
+}
+
+static BenchResult benchEntityBulker(int reps)
+{
+    sai_route_api_t api;
+    memset(&api, 0, sizeof(api));
+    api.create_route_entries = stubBulkCreateRouteEntry;
+    api.remove_route_entries = stubBulkRemoveRouteEntry;
+    api.set_route_entries_attribute = stubBulkSetRouteEntryAttribute;
+
+    EntityBulker<sai_route_api_t> bulker(&api, 512);
+
+    sai_attribute_t attr;
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+    return runBench("bulker_insert_flush", reps, [&]() {
+        const uint64_t entries = 1000;
+        vector<sai_status_t> statuses(entries);
+        for (uint64_t i = 0; i < entries; i++)
+        {
+            sai_route_entry_t route_entry;
+            memset(&route_entry, 0, sizeof(route_entry));
+            route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+            route_entry.destination.addr.ip4 = htonl(0x0a000000 + (uint32_t)i);
+            route_entry.destination.mask.ip4 = htonl(0xffffffff);
+            bulker.create_entry(&statuses[i], &route_entry, 1, &attr);
+        }
+        bulker.flush();
+        return entries;
+    });
+}
+
+static BenchResult benchRequestParser(int reps)
+{
+    BenchRequest request;
+    KeyOpFieldsValuesTuple tuple("BenchKey", SET_COMMAND,
+    {
+        { "v4",         "true" },
+        { "src_mac",    "02:42:ac:11:00:02" },
+        { "ttl_action", "drop" },
+        { "vni",        "10000" }
+    });
+
+    return runBench("request_parse", reps, [&]() {
+        const uint64_t parses = 10000;
+        for (uint64_t i = 0; i < parses; i++)
+        {
+            request.clear();
+            request.parse(tuple);
+        }
+        return parses;
+    });
+}
+
+int main(int argc, char **argv)
+{
+    const char *jsonPath = NULL;
+    const char *filter = NULL;
+    int scale = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+        {
+            jsonPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+        {
+            filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--scale") == 0 && i + 1 < argc)
+        {
+            scale = atoi(argv[++i]);
+            if (scale < 1)
+            {
+                fprintf(stderr, "invalid scale '%s'\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        }
+        else
+        {
+            fprintf(stderr,
+                    "Usage: %s [--json <file>] [--filter <substring>] [--scale <n>]\n",
+                    argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    struct
+    {
+        const char *name;
+        BenchResult (*run)(int reps);
+        int reps;
+    } benchmarks[] = {
+        { "consumer_addtosync",    benchAddToSync,     100 },
+        { "consumer_refilltosync", benchRefillToSync,  100 },
+        { "ringbuffer_push_pop",   benchRingBuffer,    10  },
+        { "bulker_insert_flush",   benchEntityBulker,  100 },
+        { "request_parse",         benchRequestParser, 100 },
+    };
+
+    vector<BenchResult> results;
+    for (const auto &bench : benchmarks)
+    {
+        if (filter != NULL && strstr(bench.name, filter) == NULL)
+        {
+            continue;
+        }
+        results.push_back(bench.run(bench.reps * scale));
+    }
+
+    if (results.empty())
+    {
+        fprintf(stderr, "no benchmark matches filter '%s'\n", filter);
+        return EXIT_FAILURE;
+    }
+
+    for (const auto &r : results)
+    {
+        printf("%-24s %12llu ops %10.3f s %14.0f ops/sec %8.1f ns/op %6.1f allocs/op\n",
+               r.name.c_str(), (unsigned long long)r.ops, r.elapsedUs / 1e6,
+               (double)r.ops * 1e6 / r.elapsedUs,
+               r.elapsedUs * 1e3 / (double)r.ops,
+               (double)r.allocs / (double)r.ops);
+    }
+
+    if (jsonPath != NULL)
+    {
+        FILE *out = fopen(jsonPath, "w");
+        if (out == NULL)
+        {
+            perror("fopen");
+            return EXIT_FAILURE;
+        }
+        fprintf(out, "[\n");
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const auto &r = results[i];
+            fprintf(out,
+                    "  {\"name\": \"%s\", \"ops\": %llu, \"elapsed_us\": %.0f, "
+                    "\"ops_per_sec\": %.0f, \"ns_per_op\": %.1f, \"allocs_per_op\": %.1f}%s\n",
+                    r.name.c_str(), (unsigned long long)r.ops, r.elapsedUs,
+                    (double)r.ops * 1e6 / r.elapsedUs,
+                    r.elapsedUs * 1e3 / (double)r.ops,
+                    (double)r.allocs / (double)r.ops,
+                    i + 1 < results.size() ? "," : "");
+        }
+        fprintf(out, "]\n");
+        fclose(out);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -1,5 +1,6 @@
 #include <cstring>
 #include <algorithm>
+#include <thread>
 
 #include <logger.h>
 
@@ -190,68 +191,102 @@ TeamdCtlDump TeamdCtlMgr::get_dump(const std::string & lag_name, bool to_retry)
         if (r == 0)
         {
             res = { true, std::string(dump) };
+        }
+        note_dump_result(lag_name, r == 0, to_retry);
+    }
+    else
+    {
+        SWSS_LOG_ERROR("Can't update state. LAG not found. LAG='%s'", lag_name.c_str());
+    }
+
+    return res;
+}
+
+///
+/// Update the error-retry bookkeeping after a dump attempt
+/// @param lag_name a name for LAG interface
+/// @param ok       whether the dump was fetched successfully
+/// @param to_retry is the flag used to do retry or not.
+///
+void TeamdCtlMgr::note_dump_result(const std::string & lag_name, bool ok, bool to_retry)
+{
+    if (ok)
+    {
+        // If this lag interface errored last time, remove the entry
+        if (m_lags_err_retry.find(lag_name) != m_lags_err_retry.end())
+        {
+            SWSS_LOG_NOTICE("The LAG '%s' had errored in get_dump earlier, removing it", lag_name.c_str());
+            m_lags_err_retry.erase(lag_name);
+        }
+        return;
+    }
 
-            // If this lag interface errored last time, remove the entry
-            if (m_lags_err_retry.find(lag_name) != m_lags_err_retry.end())
+    // In case of failure and retry flag is set, check if it fails for MAX_RETRY times.
+    if (to_retry)
+    {
+        if (m_lags_err_retry.find(lag_name) != m_lags_err_retry.end())
+        {
+            if (m_lags_err_retry[lag_name] == MAX_RETRY)
             {
-                SWSS_LOG_NOTICE("The LAG '%s' had errored in get_dump earlier, removing it", lag_name.c_str());
+                SWSS_LOG_ERROR("Can't get dump for LAG '%s'. Skipping", lag_name.c_str());
                 m_lags_err_retry.erase(lag_name);
             }
+            else
+                m_lags_err_retry[lag_name]++;
         }
         else
         {
-            // In case of failure and retry flag is set, check if it fails for MAX_RETRY times.
-            if (to_retry)
-            {
-                if (m_lags_err_retry.find(lag_name) != m_lags_err_retry.end())
-                {
-                    if (m_lags_err_retry[lag_name] == MAX_RETRY)
-                    {
-                        SWSS_LOG_ERROR("Can't get dump for LAG '%s'. Skipping", lag_name.c_str());
-                        m_lags_err_retry.erase(lag_name);
-                    }
-                    else
-                        m_lags_err_retry[lag_name]++;
-                }
-                else
-                {
 
-                    // This time a different lag interface errored out.
-		    m_lags_err_retry[lag_name] = 1;
-                }
-            }
-            else
-            {
-                // No need to retry if the flag is not set.
-                SWSS_LOG_ERROR("Can't get dump for LAG '%s'. Skipping", lag_name.c_str());
-            }
+            // This time a different lag interface errored out.
+            m_lags_err_retry[lag_name] = 1;
         }
     }
     else
     {
-        SWSS_LOG_ERROR("Can't update state. LAG not found. LAG='%s'", lag_name.c_str());
+        // No need to retry if the flag is not set.
+        SWSS_LOG_ERROR("Can't get dump for LAG '%s'. Skipping", lag_name.c_str());
     }
-
-    return res;
 }
 
 ///
-/// Get dumps for all registered LAG interfaces
+/// Get dumps for all registered LAG interfaces. Every LAG owns a separate
+/// teamdctl connection, so the dumps are fetched concurrently and one poll
+/// cycle costs as much as the slowest teamd instance instead of the sum of
+/// all of them.
 /// @return vector of pairs. Each pair first value is a name of LAG, second value is a dump
 ///
 TeamdCtlDumps TeamdCtlMgr::get_dumps(bool to_retry)
 {
     TeamdCtlDumps res;
 
-    for (const auto & p: m_handlers)
+    const std::vector<std::pair<std::string, struct teamdctl *>> instances(m_handlers.begin(), m_handlers.end());
+    std::vector<TeamdCtlDump> raw(instances.size(), { false, "" });
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < instances.size(); i++)
     {
-        const auto & lag_name = p.first;
-        const auto & result = get_dump(lag_name, to_retry);
-        const auto & status = result.first;
-        const auto & dump = result.second;
-        if (status)
+        workers.emplace_back([i, &instances, &raw]()
+        {
+            char * dump;
+            if (teamdctl_state_get_raw_direct(instances[i].second, &dump) == 0)
+            {
+                raw[i] = { true, std::string(dump) };
+            }
+        });
+    }
+    for (auto & worker: workers)
+    {
+        worker.join();
+    }
+
+    // The retry bookkeeping is shared state, update it from this thread only
+    for (size_t i = 0; i < instances.size(); i++)
+    {
+        const auto & lag_name = instances[i].first;
+        note_dump_result(lag_name, raw[i].first, to_retry);
+        if (raw[i].first)
         {
-            res.push_back({ lag_name, dump });
+            res.push_back({ lag_name, raw[i].second });
         }
     }
 
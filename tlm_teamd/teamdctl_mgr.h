@@ -25,6 +25,7 @@ public:
 private:
     bool has_key(const std::string & lag_name) const;
     bool try_add_lag(const std::string & lag_name);
+    void note_dump_result(const std::string & lag_name, bool ok, bool to_retry);
 
     std::unordered_map<std::string, struct teamdctl*> m_handlers;
     std::unordered_map<std::string, int> m_lags_to_add;
@@ -226,16 +226,23 @@ HashOfRecords ValuesStore::from_json(const std::vector<StringPair> & dumps)
 ///
 /// Extract a list of stale keys from the storage.
 /// The stale key is a key which a presented in the storage, but not presented
-/// in the temporary storage. That means that the key must be removed
+/// in the temporary storage. That means that the key must be removed.
+/// Keys belonging to a LAG whose raw dump didn't change this cycle were not
+/// re-parsed, so they are not stale.
 /// @param storage a reference to the temporary storage
+/// @param unchanged_lags LAGs that were skipped this cycle
 /// @return list of stale keys
 ///
-std::vector<std::string> ValuesStore::get_old_keys(const HashOfRecords & storage)
+std::vector<std::string> ValuesStore::get_old_keys(const HashOfRecords & storage, const std::unordered_set<std::string> & unchanged_lags)
 {
     std::vector<std::string> old_keys;
     for (const auto & p: m_storage)
     {
         const auto & db_key = p.first;
+        if (unchanged_lags.find(lag_of_key(db_key)) != unchanged_lags.end())
+        {
+            continue;
+        }
         if (storage.find(db_key) == storage.end())
         {
             old_keys.push_back(db_key);
@@ -270,6 +277,19 @@ StringPair ValuesStore::split_key(const std::string & key)
     return std::make_pair(key.substr(0, sep_pos), key.substr(sep_pos + 1));
 }
 
+///
+/// Extract the LAG name from a database key
+/// For example "LAG_MEMBER_TABLE|PortChannel1|Ethernet0" would return "PortChannel1"
+/// @param key a database key.
+/// @return the LAG name
+///
+std::string ValuesStore::lag_of_key(const std::string & key)
+{
+    auto start = key.find('|') + 1;
+    auto end = key.find('|', start);
+    return key.substr(start, end == std::string::npos ? std::string::npos : end - start);
+}
+
 ///
 /// Remove keys from the db
 /// @param keys a list of keys to remove
@@ -301,42 +321,42 @@ void ValuesStore::remove_keys_db(const std::vector<std::string> & keys)
 /// 2. if not, we insert the key and value to the storage
 /// 3. if yes, we check that value of the key is not changed. If the value is changed we
 ///    replace that value with the value from the temporary storage
-/// This method returns a list of keys which should be updated in the database
+/// This method returns the keys which should be updated in the database,
+/// each with only the fields whose values changed
 /// @param storage the temporary storage
-/// @retorun a list of keys which must be updated in the storage
+/// @retorun keys with their changed fields
 ///
-std::vector<std::string> ValuesStore::update_storage(const HashOfRecords & storage)
+HashOfRecords ValuesStore::update_storage(const HashOfRecords & storage)
 {
-    std::vector<std::string> to_update;
+    HashOfRecords to_update;
 
     for (const auto & entry_pair: storage)
     {
         const auto & entry_key    = entry_pair.first;
         const auto & entry_values = entry_pair.second;
-        if (m_storage.find(entry_key) == m_storage.end())
+        auto found = m_storage.find(entry_key);
+        if (found == m_storage.end())
         {
             m_storage.emplace(entry_pair);
-            to_update.emplace_back(entry_key);
+            to_update.emplace(entry_pair);
         }
         else
         {
-            bool is_changed = false;
+            Records changed_rows;
             for (const auto & row_pair: entry_values)
             {
                 const auto & row_key   = row_pair.first;
                 const auto & row_value = row_pair.second;
-                if (m_storage[entry_key][row_key] != row_value)
+                if (found->second[row_key] != row_value)
                 {
-                    is_changed = true;
-                    break;
+                    changed_rows.emplace(row_pair);
                 }
             }
 
-            if (is_changed)
+            if (!changed_rows.empty())
             {
-                m_storage.erase(entry_key);
-                m_storage.emplace(entry_pair);
-                to_update.emplace_back(entry_key);
+                found->second = entry_values;
+                to_update.emplace(entry_key, std::move(changed_rows));
             }
         }
     }
@@ -345,20 +365,20 @@ std::vector<std::string> ValuesStore::update_storage(const HashOfRecords & stora
 }
 
 ///
-/// Update values in the db with values from the temporary storage
-/// @param storage a reference to the temporary storage
-/// @param keys_to_refresh a list of keys which must be refreshed in the db
+/// Update values in the db with values from the temporary storage.
+/// Only the fields whose values changed are written.
+/// @param to_update keys with their changed fields
 ///
-void ValuesStore::update_db(const HashOfRecords & storage, const std::vector<std::string> & keys_to_refresh)
+void ValuesStore::update_db(const HashOfRecords & to_update)
 {
-    for (const auto & key: keys_to_refresh)
+    for (const auto & entry_pair: to_update)
     {
         std::vector<swss::FieldValueTuple> fvp;
-        for (const auto & row_pair: storage.at(key))
+        for (const auto & row_pair: entry_pair.second)
         {
             fvp.emplace_back(row_pair);
         }
-        const auto & table_pair = split_key(key);
+        const auto & table_pair = split_key(entry_pair.first);
         swss::Table table(m_db, table_pair.first);
         table.set(table_pair.second, fvp);
     }
@@ -372,12 +392,50 @@ void ValuesStore::update(const std::vector<StringPair> & dumps)
 {
     try
     {
-        const auto & storage = from_json(dumps);
-        const auto & old_keys = get_old_keys(storage);
+        /* Dumps whose raw json is identical to the previous cycle carry no
+         * changes; skip parsing them so the per-cycle cost is proportional
+         * to what changed, not to the number of LAGs */
+        std::vector<StringPair> changed;
+        std::unordered_set<std::string> unchanged_lags;
+        std::unordered_set<std::string> seen_lags;
+        for (const auto & p: dumps)
+        {
+            seen_lags.insert(p.first);
+            const auto & cached = m_last_dumps.find(p.first);
+            if (cached != m_last_dumps.end() && cached->second == p.second)
+            {
+                unchanged_lags.insert(p.first);
+            }
+            else
+            {
+                changed.push_back(p);
+            }
+        }
+
+        const auto & storage = from_json(changed);
+
+        /* Remember the raw dumps only after they were parsed successfully */
+        for (auto it = m_last_dumps.begin(); it != m_last_dumps.end();)
+        {
+            if (seen_lags.find(it->first) == seen_lags.end())
+            {
+                it = m_last_dumps.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        for (const auto & p: changed)
+        {
+            m_last_dumps[p.first] = p.second;
+        }
+
+        const auto & old_keys = get_old_keys(storage, unchanged_lags);
         remove_keys_db(old_keys);
         remove_keys_storage(old_keys);
-        const auto & keys_to_refresh = update_storage(storage);
-        update_db(storage, keys_to_refresh);
+        const auto & to_update = update_storage(storage);
+        update_db(to_update);
     }
     catch (const std::exception & e)
     {
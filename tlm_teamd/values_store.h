@@ -2,6 +2,8 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <jansson.h>
 
@@ -34,15 +36,17 @@ private:
     std::string unpack_integer(json_t * root, const std::string & key, const std::string & path);
     std::string get_value(json_t * root, const std::string & path, ValuesStore::json_type type);
     HashOfRecords from_json(const std::vector<StringPair> & dumps);
-    std::vector<std::string> get_old_keys(const HashOfRecords & storage);
+    std::vector<std::string> get_old_keys(const HashOfRecords & storage, const std::unordered_set<std::string> & unchanged_lags);
     void remove_keys_storage(const std::vector<std::string> & keys);
     void remove_keys_db(const std::vector<std::string> & keys);
     StringPair split_key(const std::string & key);
-    std::vector<std::string> update_storage(const HashOfRecords & storage);
-    void update_db(const HashOfRecords & storage, const std::vector<std::string> & keys_to_refresh);
+    std::string lag_of_key(const std::string & key);
+    HashOfRecords update_storage(const HashOfRecords & storage);
+    void update_db(const HashOfRecords & to_update);
     void extract_values(const std::string & lag_name, json_t * root, HashOfRecords & storage);
 
     HashOfRecords m_storage;  // our main storage
+    std::unordered_map<std::string, std::string> m_last_dumps;  // raw json per LAG from the previous cycle
     const swss::DBConnector * m_db;
 
     const std::vector<std::pair<std::string, ValuesStore::json_type>> m_lag_paths = {
@@ -1,3 +1,9 @@
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
 #include <string>
 #include <algorithm>
 #include "logger.h"
@@ -8,15 +14,6 @@
 using namespace std;
 using namespace swss;
 
-// Translation map from enum to string for cache entry state.
-const AppRestartAssist::cache_state_map AppRestartAssist::cacheStateMap =
-{
-    {STALE,     "STALE"},
-    {SAME,      "SAME"},
-    {NEW,       "NEW"},
-    {DELETE,    "DELETE"}
-};
-
 AppRestartAssist::AppRestartAssist(RedisPipeline *pipelineAppDB, const std::string &appName,
                                    const std::string &dockerName, const uint32_t defaultWarmStartTimerValue):
     m_pipeLine(pipelineAppDB),
@@ -97,24 +94,166 @@ string AppRestartAssist::joinVectorString(const vector<FieldValueTuple> &fv)
     return s;
 }
 
-// Set the cache entry state
-void AppRestartAssist::setCacheEntryState(std::vector<FieldValueTuple> &fvVector,
-    cache_state_t state)
+/*
+ * Order-insensitive digest of a field-value vector: per-field hashes are
+ * summed, so entries read back from redis in a different field order still
+ * compare equal. A digest mismatch only ever costs a redundant SET of an
+ * identical value, never a lost update.
+ */
+uint64_t AppRestartAssist::fvDigest(const std::vector<FieldValueTuple> &fv)
+{
+    std::hash<std::string> hasher;
+    uint64_t digest = 0;
+
+    for (const auto &it : fv)
+    {
+        digest += hasher(it.first + ":" + it.second);
+    }
+    return digest;
+}
+
+AppRestartAssist::SpillCache::~SpillCache()
 {
-    fvVector.back().second = cacheStateMap.at(state);
+    close();
+}
+
+/*
+ * Lay the restored entries out in a file: a count header, a record array
+ * sorted by key, then the key bytes, mapped shared and writable so the
+ * kernel can write dirty pages back and evict them under memory pressure.
+ * The file is unlinked right after creation, so it never outlives the
+ * process whatever way the process ends.
+ */
+bool AppRestartAssist::SpillCache::build(const std::string &path, std::vector<std::pair<std::string, uint64_t>> &entries)
+{
+    close();
+
+    m_fd = open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0600);
+    if (m_fd < 0)
+    {
+        SWSS_LOG_WARN("Failed to create spill file %s: %s", path.c_str(), strerror(errno));
+        return false;
+    }
+    unlink(path.c_str());
+
+    sort(entries.begin(), entries.end(),
+         [](const pair<string, uint64_t> &a, const pair<string, uint64_t> &b)
+         {
+             return a.first < b.first;
+         });
+
+    size_t keyBytes = 0;
+    for (const auto &entry : entries)
+    {
+        keyBytes += entry.first.size();
+    }
+
+    m_count = entries.size();
+    m_size = sizeof(uint64_t) + m_count * sizeof(Record) + keyBytes;
+
+    if (ftruncate(m_fd, (off_t)m_size) != 0)
+    {
+        SWSS_LOG_WARN("Failed to size spill file %s: %s", path.c_str(), strerror(errno));
+        close();
+        return false;
+    }
+
+    m_base = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (m_base == MAP_FAILED)
+    {
+        SWSS_LOG_WARN("Failed to map spill file %s: %s", path.c_str(), strerror(errno));
+        m_base = nullptr;
+        close();
+        return false;
+    }
+
+    *reinterpret_cast<uint64_t *>(m_base) = m_count;
+
+    Record *recs = record(0);
+    char *blob = reinterpret_cast<char *>(recs + m_count);
+    uint32_t off = 0;
+    for (size_t i = 0; i < m_count; i++)
+    {
+        const string &entryKey = entries[i].first;
+
+        recs[i].digest = entries[i].second;
+        recs[i].keyOff = off;
+        recs[i].keyLen = (uint32_t)entryKey.size();
+        recs[i].state = STALE;
+        recs[i].pad = 0;
+        memcpy(blob + off, entryKey.data(), entryKey.size());
+        off += (uint32_t)entryKey.size();
+    }
+    return true;
 }
 
-// Get the cache entry state
-AppRestartAssist::cache_state_t AppRestartAssist::getCacheEntryState(const std::vector<FieldValueTuple> &fvVector)
+// Binary search over the sorted record array; nullptr if the key was not restored
+AppRestartAssist::SpillCache::Record *AppRestartAssist::SpillCache::find(const std::string &key)
 {
-    for (auto &iter : cacheStateMap)
+    if (m_base == nullptr)
+    {
+        return nullptr;
+    }
+
+    size_t lo = 0;
+    size_t hi = m_count;
+    while (lo < hi)
     {
-        if (fvVector.back().second == iter.second)
+        size_t mid = lo + (hi - lo) / 2;
+        Record *rec = record(mid);
+        size_t common = key.size() < rec->keyLen ? key.size() : rec->keyLen;
+        int cmp = memcmp(key.data(), keyBlob() + rec->keyOff, common);
+
+        if (cmp == 0 && key.size() != rec->keyLen)
         {
-            return iter.first;
+            cmp = key.size() < rec->keyLen ? -1 : 1;
         }
+
+        if (cmp == 0)
+        {
+            return rec;
+        }
+        else if (cmp < 0)
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+    return nullptr;
+}
+
+AppRestartAssist::SpillCache::Record *AppRestartAssist::SpillCache::record(size_t index)
+{
+    return reinterpret_cast<Record *>(reinterpret_cast<char *>(m_base) + sizeof(uint64_t)) + index;
+}
+
+std::string AppRestartAssist::SpillCache::key(const Record *rec) const
+{
+    return string(keyBlob() + rec->keyOff, rec->keyLen);
+}
+
+const char *AppRestartAssist::SpillCache::keyBlob() const
+{
+    return reinterpret_cast<const char *>(m_base) + sizeof(uint64_t) + m_count * sizeof(Record);
+}
+
+void AppRestartAssist::SpillCache::close()
+{
+    if (m_base != nullptr)
+    {
+        munmap(m_base, m_size);
+        m_base = nullptr;
     }
-    throw std::logic_error("cache entry state is invalid");
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+    m_size = 0;
+    m_count = 0;
 }
 
 void AppRestartAssist::appDataReplayed()
@@ -127,7 +266,11 @@ void AppRestartAssist::warmStartDisabled()
     WarmStart::setWarmStartState(m_appName, WarmStart::WSDISABLED);
 }
 
-// Read table(s) from APPDB and append stale flag then insert to cachemap
+// Read table(s) from APPDB and store each entry's key and digest, marked
+// stale, in a per-table spill file. The old values themselves are not
+// cached: a digest is enough to classify the replayed entries, and the
+// delta map keeps its own data. If a spill file can't be set up, fall
+// back to holding the digests in the in-memory cache map.
 void AppRestartAssist::readTablesToMap()
 {
     vector<string> keys;
@@ -135,8 +278,9 @@ void AppRestartAssist::readTablesToMap()
     for (auto it = m_appTables.begin(); it != m_appTables.end(); it++)
     {
         (it->second)->getKeys(keys);
-        FieldValueTuple state(CACHE_STATE_FIELD, "");
 
+        vector<pair<string, uint64_t>> entries;
+        entries.reserve(keys.size());
         for (const auto &key: keys)
         {
             vector<FieldValueTuple> fv;
@@ -147,19 +291,25 @@ void AppRestartAssist::readTablesToMap()
                 continue;
             }
 
-            fv.push_back(state);
-            setCacheEntryState(fv, STALE);
+            SWSS_LOG_INFO("restore entry: %s, key: %s, "
+                   "%s", (it->first).c_str(), key.c_str(), joinVectorString(fv).c_str());
 
-            string s = joinVectorString(fv);
-
-            SWSS_LOG_INFO("write to cachemap: %s, key: %s, "
-                   "%s", (it->first).c_str(), key.c_str(), s.c_str());
+            entries.emplace_back(key, fvDigest(fv));
+        }
 
-            // insert to the cache map
-            appTableCacheMap[it->first][key] = fv;
+        string spillPath = "/tmp/" + m_appName + "." + it->first + ".spill";
+        if (!m_spillCaches[it->first].build(spillPath, entries))
+        {
+            m_spillCaches.erase(it->first);
+            for (const auto &entry: entries)
+            {
+                CacheEntry &cacheEntry = appTableCacheMap[it->first][entry.first];
+                cacheEntry.digest = entry.second;
+                cacheEntry.state = STALE;
+            }
         }
         WarmStart::setWarmStartState(m_appName, WarmStart::RESTORED);
-        SWSS_LOG_NOTICE("Restored appDB table to %s internal cache map", (it->first).c_str());
+        SWSS_LOG_NOTICE("Restored appDB table %s, %zu entries", (it->first).c_str(), entries.size());
     }
     return;
 }
@@ -181,48 +331,60 @@ void AppRestartAssist::insertToMap(string tableName, string key, vector<FieldVal
     SWSS_LOG_INFO("Received message %s, key: %s, "
             "%s, delete = %d", tableName.c_str(), key.c_str(), joinVectorString(fvVector).c_str(), delete_key);
 
-    auto found = appTableCacheMap[tableName].find(key);
+    auto &tableCache = appTableCacheMap[tableName];
+    auto found = tableCache.find(key);
+
+    /* entries not in the delta map may still live in the table's spill file */
+    SpillCache::Record *rec = nullptr;
+    auto spillIter = m_spillCaches.find(tableName);
+    if (found == tableCache.end() && spillIter != m_spillCaches.end())
+    {
+        rec = spillIter->second.find(key);
+    }
 
     if (delete_key)
     {
         SWSS_LOG_NOTICE("%s, delete key: %s, ", tableName.c_str(), key.c_str());
         /* mark it as DELETE if exist, otherwise, no-op */
-        if (found != appTableCacheMap[tableName].end())
+        if (found != tableCache.end())
         {
-            setCacheEntryState(found->second, DELETE);
+            found->second.state = DELETE;
+            found->second.fvVector.clear();
+        }
+        else if (rec != nullptr)
+        {
+            rec->state = DELETE;
         }
     }
-    else if (found != appTableCacheMap[tableName].end())
+    else if (found != tableCache.end())
     {
-        // check only the original vector range (exclude cache-state field/value)
-        if(! contains(found->second, fvVector))
+        uint64_t digest = fvDigest(fvVector);
+
+        if (digest != found->second.digest)
         {
             SWSS_LOG_NOTICE("%s, found key: %s, new value ", tableName.c_str(), key.c_str());
 
-            FieldValueTuple state(CACHE_STATE_FIELD, "");
-            fvVector.push_back(state);
-
-            // mark as NEW flag
-            setCacheEntryState(fvVector, NEW);
-            appTableCacheMap[tableName][key] = fvVector;
+            // mark as NEW flag and keep the value: it is part of the delta
+            found->second.state = NEW;
+            found->second.digest = digest;
+            found->second.fvVector = std::move(fvVector);
         }
         else
         {
-            auto state = getCacheEntryState(found->second);
             /*
              * In case an entry has been updated for more than once with the same value but different from the stored one,
              * keep the state as NEW.
              * Eg.
              * Assume the entry's value that is restored from last warm reboot is V0.
-             * 1. The first update with value V1 is received and handled by the above `if (found != appTableCacheMap[tableName].end())` branch,
+             * 1. The first update with value V1 is received and handled by the digest-mismatch branch above,
              *    - state is set to NEW
-             *    - value is updated to V1
+             *    - digest is updated to V1's
              * 2. The second update with the same value V1 is received and handled by this branch
              *    - Originally, state was set to SAME, which is wrong because V1 is different from the stored value V0
              *    - The correct logic should be: set the state to same only if the state is not NEW
              * This is a very rare case because in most of times the entry won't be updated for multiple times
              */
-            if (state == NEW)
+            if (found->second.state == NEW)
             {
                 SWSS_LOG_NOTICE("%s, found key: %s, it has been updated for the second time, keep state as NEW",
                                 tableName.c_str(), key.c_str());
@@ -231,18 +393,44 @@ void AppRestartAssist::insertToMap(string tableName, string key, vector<FieldVal
             {
                 SWSS_LOG_INFO("%s, found key: %s, same value", tableName.c_str(), key.c_str());
                 // mark as SAME flag
-                setCacheEntryState(found->second, SAME);
+                found->second.state = SAME;
             }
         }
     }
+    else if (rec != nullptr)
+    {
+        uint64_t digest = fvDigest(fvVector);
+
+        if (digest != rec->digest)
+        {
+            SWSS_LOG_NOTICE("%s, found key: %s, new value ", tableName.c_str(), key.c_str());
+
+            /*
+             * The changed value is part of the delta, so it moves to the
+             * in-memory map; the spill record is marked NEW so that the
+             * reconcile pass over the spill leaves it alone.
+             */
+            rec->state = NEW;
+            CacheEntry &entry = tableCache[key];
+            entry.digest = digest;
+            entry.state = NEW;
+            entry.fvVector = std::move(fvVector);
+        }
+        else
+        {
+            SWSS_LOG_INFO("%s, found key: %s, same value", tableName.c_str(), key.c_str());
+            // mark as SAME flag
+            rec->state = SAME;
+        }
+    }
     else
     {
         // not found, mark the entry as NEW and insert to map
         SWSS_LOG_NOTICE("%s, not found key: %s, new", tableName.c_str(), key.c_str());
-        FieldValueTuple state(CACHE_STATE_FIELD, "");
-        fvVector.push_back(state);
-        setCacheEntryState(fvVector, NEW);
-        appTableCacheMap[tableName][key] = fvVector;
+        CacheEntry &entry = tableCache[key];
+        entry.digest = fvDigest(fvVector);
+        entry.state = NEW;
+        entry.fvVector = std::move(fvVector);
     }
     return;
 }
@@ -260,24 +448,50 @@ void AppRestartAssist::reconcile()
     std::string tableName;
 
     SWSS_LOG_ENTER();
+
+    /*
+     * Stream the restored entries out of the spill files first: STALE and
+     * DELETE records are removed from appDB, SAME needs nothing, and NEW
+     * records are written from the delta map below, which holds their values.
+     */
+    for (auto spillIter = m_spillCaches.begin(); spillIter != m_spillCaches.end(); ++spillIter)
+    {
+        tableName = spillIter->first;
+        SpillCache &spill = spillIter->second;
+        for (size_t i = 0; i < spill.count(); i++)
+        {
+            SpillCache::Record *rec = spill.record(i);
+            if (rec->state == STALE || rec->state == DELETE)
+            {
+                string key = spill.key(rec);
+                SWSS_LOG_NOTICE("%s STALE/DELETE, key: %s",
+                        tableName.c_str(), key.c_str());
+
+                //delete from appDB
+                m_psTables[tableName]->del(key);
+            }
+        }
+        spill.close();
+    }
+    m_spillCaches.clear();
+
     for (auto tableIter = appTableCacheMap.begin(); tableIter != appTableCacheMap.end(); ++tableIter)
     {
         tableName = tableIter->first;
         for (auto it = (tableIter->second).begin(); it != (tableIter->second).end(); ++it)
         {
-            string s = joinVectorString(it->second);
-            auto state = getCacheEntryState(it->second);
+            auto state = it->second.state;
 
             if (state == SAME)
             {
-                SWSS_LOG_INFO("%s SAME, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
+                SWSS_LOG_INFO("%s SAME, key: %s",
+                        tableName.c_str(), it->first.c_str());
                 continue;
             }
             else if (state == STALE || state == DELETE)
             {
-                SWSS_LOG_NOTICE("%s STALE/DELETE, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
+                SWSS_LOG_NOTICE("%s STALE/DELETE, key: %s",
+                        tableName.c_str(), it->first.c_str());
 
                 //delete from appDB
                 m_psTables[tableName]->del(it->first);
@@ -285,11 +499,10 @@ void AppRestartAssist::reconcile()
             else if (state == NEW)
             {
                 SWSS_LOG_NOTICE("%s NEW, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
+                        tableName.c_str(), it->first.c_str(), joinVectorString(it->second.fvVector).c_str());
 
-                //add to appDB, exclude the state
-                it->second.pop_back();
-                m_psTables[tableName]->set(it->first, it->second);
+                //add to appDB
+                m_psTables[tableName]->set(it->first, it->second.fvVector);
             }
             else
             {
@@ -335,18 +548,3 @@ bool AppRestartAssist::checkReconcileTimer(Selectable *s)
     }
     return false;
 }
-
-// check if left vector contains all elements of right vector
-bool AppRestartAssist::contains(const std::vector<FieldValueTuple>& left,
-              const std::vector<FieldValueTuple>& right)
-{
-    for (auto const& rv : right)
-    {
-        if (std::find(left.begin(), left.end(), rv) == left.end())
-        {
-            return false;
-        }
-    }
-
-    return true;
-}
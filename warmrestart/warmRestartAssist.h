@@ -91,10 +91,6 @@ public:
     void registerAppTable(const std::string &tableName, ProducerStateTable *psTable);
 
 private:
-    typedef std::map<cache_state_t, std::string> cache_state_map;
-    // Enum to string translation map
-    static const cache_state_map cacheStateMap;
-    const std::string CACHE_STATE_FIELD = "cache-state";
 
     /*
      * Default timer to be 5 seconds
@@ -102,11 +98,72 @@ private:
      * Precedence ascent order: Default -> loading class with value -> configuration
      */
     static const uint32_t DEFAULT_INTERNAL_TIMER_VALUE = 5;
-    typedef std::map<std::string, std::unordered_map<std::string, std::vector<swss::FieldValueTuple>>> AppTableMap;
+
+    /*
+     * Per-key cache entry. Entries restored from the old APPL_DB table only
+     * keep a 64-bit order-insensitive digest of their field-values; the full
+     * vector is stored just for the delta (NEW entries), which is what
+     * reconcile() has to write back. This bounds the cache to key + digest
+     * per unchanged route instead of the complete value, which is what keeps
+     * fpmsyncd RSS flat across a full-table warm restart.
+     */
+    struct CacheEntry
+    {
+        uint64_t digest = 0;
+        cache_state_t state = STALE;
+        std::vector<swss::FieldValueTuple> fvVector;
+    };
+    typedef std::map<std::string, std::unordered_map<std::string, CacheEntry>> AppTableMap;
+
+    /*
+     * Sorted-key spill file for the entries restored from the old APPL_DB.
+     * The records are (digest, state, key), sorted by key and accessed
+     * through a shared file-backed mapping, so under memory pressure the
+     * kernel can page the restored set out to disk instead of it sitting
+     * in anonymous memory at the moment memory is scarcest. Entries that
+     * the replay proves changed keep their values in the in-memory delta
+     * map; the spill only ever answers "was this key restored, with which
+     * digest, and what happened to it".
+     */
+    class SpillCache
+    {
+    public:
+        struct Record
+        {
+            uint64_t digest;
+            uint32_t keyOff;
+            uint32_t keyLen;
+            uint32_t state;
+            uint32_t pad;
+        };
+
+        ~SpillCache();
+
+        bool build(const std::string &path, std::vector<std::pair<std::string, uint64_t>> &entries);
+        Record *find(const std::string &key);
+        Record *record(size_t index);
+        std::string key(const Record *rec) const;
+        size_t count() const
+        {
+            return m_count;
+        }
+        void close();
+
+    private:
+        const char *keyBlob() const;
+
+        void *m_base = nullptr;
+        size_t m_size = 0;
+        size_t m_count = 0;
+        int m_fd = -1;
+    };
 
     // cache map to store temporary application table
     AppTableMap appTableCacheMap;
 
+    // per-table spill files with the restored entries
+    std::map<std::string, SpillCache> m_spillCaches;
+
     RedisPipeline      *m_pipeLine;
     Tables              m_appTables;  // app tables
     std::string         m_dockerName; // docker name of the application
@@ -117,12 +174,10 @@ private:
     time_t m_reconcileTimer;          // reconcile timer value
     SelectableTimer m_warmStartTimer; // reconcile timer
 
-    // Set or get cache entry state
     std::string joinVectorString(const std::vector<FieldValueTuple> &fv);
-    void setCacheEntryState(std::vector<FieldValueTuple> &fvVector, cache_state_t state);
-    cache_state_t getCacheEntryState(const std::vector<FieldValueTuple> &fvVector);
-    bool contains(const std::vector<FieldValueTuple>& left,
-                  const std::vector<FieldValueTuple>& right);
+
+    // Order-insensitive digest of a field-value vector
+    static uint64_t fvDigest(const std::vector<FieldValueTuple> &fv);
 };
 
 }
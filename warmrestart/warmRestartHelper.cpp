@@ -1,5 +1,15 @@
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #include <cassert>
+#include <ctime>
+#include <fstream>
 #include <sstream>
+#include <thread>
 
 #include "warmRestartHelper.h"
 
@@ -7,6 +17,53 @@
 using namespace swss;
 
 
+namespace {
+
+/*
+ * Per-entry verdict of the reconciliation compare phase. The verdicts are
+ * computed concurrently and applied to the sync-table serially.
+ */
+enum class ReconcileAction : uint8_t
+{
+    NOOP,
+    DELETE_STALE,
+    DELETE_EXPLICIT,
+    UPDATE
+};
+
+/* Minimum number of restored entries a reconcile worker is worth spawning for */
+constexpr size_t RECONCILE_ENTRIES_PER_WORKER = 1024;
+
+/*
+ * Pre-shutdown snapshot format: a header followed by length-prefixed
+ * records, one per restored element. Each record is a 32-bit key length,
+ * a 32-bit field-value count, the key bytes, then per field-value a pair
+ * of 32-bit lengths and the bytes. The snapshot lives under the warm-boot
+ * directory so it survives the reboot, and carries its write time so a
+ * leftover from an aborted warm-reboot attempt is never trusted.
+ */
+struct SnapshotHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t writeTime;
+    uint64_t recordCount;
+};
+
+constexpr uint32_t SNAPSHOT_MAGIC = 0x77727373;      /* "wrss" */
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+constexpr uint64_t SNAPSHOT_MAX_AGE_SECS = 900;
+
+const std::string WARM_BOOT_SNAPSHOT_DIR = "/var/warmboot/";
+
+void appendUint32(std::string &buf, uint32_t val)
+{
+    buf.append(reinterpret_cast<const char *>(&val), sizeof(val));
+}
+
+}
+
+
 WarmStartHelper::WarmStartHelper(RedisPipeline      *pipeline,
                                  ProducerStateTable *syncTable,
                                  const std::string  &syncTableName,
@@ -104,7 +161,22 @@ bool WarmStartHelper::runRestoration()
     SWSS_LOG_NOTICE("Warm-Restart: Initiating AppDB restoration process for %s "
                     "application.", m_appName.c_str());
 
-    m_restorationTable.getContent(m_restorationVector);
+    /*
+     * Prefer the snapshot the previous instance left behind at shutdown:
+     * it holds the same AppDB view, but deserializing it is much cheaper
+     * than a full-table read from redis. Fall back to redis whenever no
+     * usable snapshot is found.
+     */
+    if (loadSnapshot(m_restorationVector))
+    {
+        SWSS_LOG_NOTICE("Warm-Restart: Restored %zu records from pre-shutdown "
+                        "snapshot for %s application.",
+                        m_restorationVector.size(), m_appName.c_str());
+    }
+    else
+    {
+        m_restorationTable.getContent(m_restorationVector);
+    }
 
     /*
      * If there's no AppDB state to restore, then alert callee right away to avoid
@@ -134,6 +206,199 @@ bool WarmStartHelper::runRestoration()
 }
 
 
+std::string WarmStartHelper::snapshotPath(void) const
+{
+    return WARM_BOOT_SNAPSHOT_DIR + m_appName + "_" + m_syncTableName + ".snapshot";
+}
+
+
+/*
+ * To be called during the pre-shutdown window, once the warm-reboot signal
+ * has been received. Serializes the current AppDB view of the sync-table
+ * into a binary snapshot, which the restarting instance will pick up in
+ * runRestoration() instead of re-reading the full table from redis. The
+ * file is written to a temporary name first and renamed into place, so a
+ * partially written snapshot is never visible.
+ */
+bool WarmStartHelper::dumpSnapshot(void)
+{
+    kfvVector content;
+
+    m_restorationTable.getContent(content);
+
+    std::string buf;
+    SnapshotHeader header = {};
+
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.writeTime = (uint64_t)time(nullptr);
+    header.recordCount = content.size();
+    buf.append(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    for (const auto &kfv : content)
+    {
+        const std::string &key = kfvKey(kfv);
+        const auto &fvs        = kfvFieldsValues(kfv);
+
+        appendUint32(buf, (uint32_t)key.size());
+        appendUint32(buf, (uint32_t)fvs.size());
+        buf += key;
+        for (const auto &fv : fvs)
+        {
+            appendUint32(buf, (uint32_t)fv.first.size());
+            appendUint32(buf, (uint32_t)fv.second.size());
+            buf += fv.first;
+            buf += fv.second;
+        }
+    }
+
+    const std::string path = snapshotPath();
+    const std::string tmpPath = path + ".tmp";
+
+    std::ofstream ofs(tmpPath, std::ofstream::binary | std::ofstream::trunc);
+    if (!ofs.write(buf.data(), (std::streamsize)buf.size()))
+    {
+        SWSS_LOG_WARN("Warm-Restart: Failed to write snapshot %s for %s "
+                      "application.", tmpPath.c_str(), m_appName.c_str());
+        return false;
+    }
+    ofs.close();
+
+    if (rename(tmpPath.c_str(), path.c_str()) != 0)
+    {
+        SWSS_LOG_WARN("Warm-Restart: Failed to publish snapshot %s: %s",
+                      path.c_str(), strerror(errno));
+        return false;
+    }
+
+    SWSS_LOG_NOTICE("Warm-Restart: Wrote pre-shutdown snapshot with %zu records "
+                    "for %s application.", content.size(), m_appName.c_str());
+
+    return true;
+}
+
+
+/*
+ * Map the pre-shutdown snapshot and deserialize it into the restoration
+ * vector. The snapshot is consumed exactly once: it is unlinked as soon as
+ * it has been opened, and rejected if it is malformed, from a different
+ * format version, or too old to belong to this warm-reboot cycle.
+ */
+bool WarmStartHelper::loadSnapshot(kfvVector &restorationVector)
+{
+    const std::string path = snapshotPath();
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    /* One warm-reboot cycle, one snapshot: never leave it behind for the next one */
+    unlink(path.c_str());
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(SnapshotHeader))
+    {
+        close(fd);
+        return false;
+    }
+
+    size_t size = (size_t)st.st_size;
+    void *base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        SWSS_LOG_WARN("Warm-Restart: Failed to map snapshot %s: %s",
+                      path.c_str(), strerror(errno));
+        return false;
+    }
+
+    const char *cur = static_cast<const char *>(base);
+    const char *end = cur + size;
+
+    SnapshotHeader header;
+    memcpy(&header, cur, sizeof(header));
+    cur += sizeof(header);
+
+    bool valid = (header.magic == SNAPSHOT_MAGIC &&
+                  header.version == SNAPSHOT_VERSION &&
+                  (uint64_t)time(nullptr) - header.writeTime <= SNAPSHOT_MAX_AGE_SECS);
+    if (!valid)
+    {
+        SWSS_LOG_WARN("Warm-Restart: Ignoring stale or malformed snapshot %s.",
+                      path.c_str());
+        munmap(base, size);
+        return false;
+    }
+
+    kfvVector content;
+    content.reserve(header.recordCount);
+
+    auto readUint32 = [&cur, end](uint32_t &val)
+    {
+        if (end - cur < (ptrdiff_t)sizeof(val))
+        {
+            return false;
+        }
+        memcpy(&val, cur, sizeof(val));
+        cur += sizeof(val);
+        return true;
+    };
+
+    auto readString = [&cur, end](std::string &val, uint32_t len)
+    {
+        if (end - cur < (ptrdiff_t)len)
+        {
+            return false;
+        }
+        val.assign(cur, len);
+        cur += len;
+        return true;
+    };
+
+    for (uint64_t i = 0; i < header.recordCount && valid; ++i)
+    {
+        uint32_t keyLen, fvCount;
+        std::string key;
+
+        valid = readUint32(keyLen) && readUint32(fvCount) && readString(key, keyLen);
+
+        std::vector<FieldValueTuple> fvs;
+        for (uint32_t j = 0; j < fvCount && valid; ++j)
+        {
+            uint32_t fieldLen, valueLen;
+            std::string field, value;
+
+            valid = readUint32(fieldLen) && readUint32(valueLen) &&
+                    readString(field, fieldLen) && readString(value, valueLen);
+            if (valid)
+            {
+                fvs.emplace_back(std::move(field), std::move(value));
+            }
+        }
+
+        if (valid)
+        {
+            content.emplace_back(std::move(key), SET_COMMAND, std::move(fvs));
+        }
+    }
+
+    munmap(base, size);
+
+    if (!valid)
+    {
+        SWSS_LOG_WARN("Warm-Restart: Snapshot %s is truncated, falling back to "
+                      "redis restoration.", path.c_str());
+        return false;
+    }
+
+    restorationVector = std::move(content);
+
+    return true;
+}
+
+
 void WarmStartHelper::insertRefreshMap(const KeyOpFieldsValuesTuple &kfv)
 {
     const std::string key = kfvKey(kfv);
@@ -156,60 +421,112 @@ void WarmStartHelper::reconcile(void)
 
     assert(getState() == WarmStart::RESTORED);
 
-    for (auto &restoredElem : m_restorationVector)
+    /*
+     * Compare phase: classify every restored element against the refreshMap.
+     * The workers only read the restorationVector and the refreshMap, each
+     * writing verdicts into its own slice of the actions vector, so the
+     * field-value comparison of the full table runs on all cores. All
+     * sync-table writes and the refreshMap cleanup stay on this thread,
+     * after the workers have been joined.
+     */
+    const size_t total = m_restorationVector.size();
+    std::vector<ReconcileAction> actions(total, ReconcileAction::NOOP);
+
+    size_t workerCount = std::thread::hardware_concurrency();
+    if (workerCount == 0)
+    {
+        workerCount = 1;
+    }
+    workerCount = std::min(workerCount,
+                           (total + RECONCILE_ENTRIES_PER_WORKER - 1) / RECONCILE_ENTRIES_PER_WORKER);
+
+    auto classifyRange = [this, &actions](size_t begin, size_t end)
     {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const auto &restoredElem = m_restorationVector[i];
+            auto iter = m_refreshMap.find(kfvKey(restoredElem));
+
+            if (iter == m_refreshMap.end())
+            {
+                actions[i] = ReconcileAction::DELETE_STALE;
+            }
+            else if (kfvOp(iter->second) == DEL_COMMAND)
+            {
+                actions[i] = ReconcileAction::DELETE_EXPLICIT;
+            }
+            else if (compareAllFV(kfvFieldsValues(restoredElem),
+                                  kfvFieldsValues(iter->second)))
+            {
+                actions[i] = ReconcileAction::UPDATE;
+            }
+        }
+    };
+
+    if (workerCount <= 1)
+    {
+        classifyRange(0, total);
+    }
+    else
+    {
+        std::vector<std::thread> workers;
+        size_t chunk = (total + workerCount - 1) / workerCount;
+        for (size_t begin = 0; begin < total; begin += chunk)
+        {
+            workers.emplace_back(classifyRange, begin, std::min(begin + chunk, total));
+        }
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    /* Apply phase: push the verdicts down to AppDB in restoration order */
+    for (size_t i = 0; i < total; ++i)
+    {
+        auto &restoredElem       = m_restorationVector[i];
         std::string restoredKey  = kfvKey(restoredElem);
         auto restoredFV          = kfvFieldsValues(restoredElem);
 
-        auto iter = m_refreshMap.find(restoredKey);
-
+        switch (actions[i])
+        {
         /*
-         * If the restored element is not found in the refreshMap, we must
+         * If the restored element was not found in the refreshMap, we must
          * push a delete operation for this entry.
          */
-        if (iter == m_refreshMap.end())
-        {
+        case ReconcileAction::DELETE_STALE:
             SWSS_LOG_NOTICE("Warm-Restart reconciliation: deleting stale entry %s",
                             printKFV(restoredKey, restoredFV).c_str());
 
             m_syncTable->del(restoredKey);
             continue;
-        }
 
-        /*
-         * If an explicit delete request is sent by the application, process it
-         * right away.
-         */
-        else if (kfvOp(iter->second) == DEL_COMMAND)
-        {
+        /* An explicit delete request was sent by the application */
+        case ReconcileAction::DELETE_EXPLICIT:
             SWSS_LOG_NOTICE("Warm-Restart reconciliation: deleting entry %s",
                             printKFV(restoredKey, restoredFV).c_str());
 
             m_syncTable->del(restoredKey);
-        }
+            break;
 
-        /*
-         * If a matching entry is found in refreshMap, proceed to compare it
-         * with its restored counterpart.
-         */
-        else
+        /* The refreshed counterpart differs from the restored state */
+        case ReconcileAction::UPDATE:
         {
-            auto refreshedKey = kfvKey(iter->second);
-            auto refreshedFV  = kfvFieldsValues(iter->second);
+            auto &refreshed   = m_refreshMap[restoredKey];
+            auto refreshedKey = kfvKey(refreshed);
+            auto refreshedFV  = kfvFieldsValues(refreshed);
 
-            if (compareAllFV(restoredFV, refreshedFV))
-            {
-                SWSS_LOG_NOTICE("Warm-Restart reconciliation: updating entry %s",
-                                printKFV(refreshedKey, refreshedFV).c_str());
+            SWSS_LOG_NOTICE("Warm-Restart reconciliation: updating entry %s",
+                            printKFV(refreshedKey, refreshedFV).c_str());
 
-                m_syncTable->set(refreshedKey, refreshedFV);
-            }
-            else
-            {
-                SWSS_LOG_INFO("Warm-Restart reconciliation: no changes needed for "
-                              "existing entry %s",
-                              printKFV(refreshedKey, refreshedFV).c_str());
-            }
+            m_syncTable->set(refreshedKey, refreshedFV);
+            break;
+        }
+
+        case ReconcileAction::NOOP:
+            SWSS_LOG_INFO("Warm-Restart reconciliation: no changes needed for "
+                          "existing entry %s", restoredKey.c_str());
+            break;
         }
 
         /* Deleting the just-processed restored entry from the refreshMap */
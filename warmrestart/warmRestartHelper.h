@@ -52,6 +52,8 @@ class WarmStartHelper {
 
     bool runRestoration(void);
 
+    bool dumpSnapshot(void);
+
     void insertRefreshMap(const KeyOpFieldsValuesTuple &kfv);
 
     void reconcile(void);
@@ -61,6 +63,10 @@ class WarmStartHelper {
 
   private:
 
+    bool loadSnapshot(kfvVector &restorationVector);
+
+    std::string snapshotPath(void) const;
+
     bool compareAllFV(const std::vector<FieldValueTuple> &left,
                       const std::vector<FieldValueTuple> &right);
 